@@ -0,0 +1,220 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * Compares a hash of 50000 server-name-like keys built in a pool, as
+ * cycle->pool, and in a frozen arena, as cycle->arena.  The keys arrays
+ * and strings are allocated from the pool in both cases, and a temporary
+ * pool is destroyed after the hash is built, as during configuration
+ * parsing.
+ *
+ * A forked process then acts as a worker: it allocates from the pool,
+ * mallocs and frees memory, and looks up all keys.  The memory shared
+ * with the parent process it loses, that is, the inherited pages it writes
+ * to, is read from /proc/self/smaps_rollup.  The lookup cost is also
+ * reported.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include "ngx_bench.h"
+
+
+#define NGX_ARENA_BENCH_KEYS     50000
+#define NGX_ARENA_BENCH_LOOKUPS  1000000
+#define NGX_ARENA_BENCH_ALLOCS   20000
+
+
+static void ngx_arena_bench_run(ngx_uint_t arena);
+static void ngx_arena_bench_worker(ngx_uint_t arena, ngx_pool_t *pool,
+    ngx_hash_t *hash, ngx_str_t *names);
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    int         status;
+    ngx_pid_t   pid;
+    ngx_uint_t  arena;
+
+    ngx_bench_init();
+
+    /* each case is run in a new process, so the heap is the same */
+
+    for (arena = 0; arena < 2; arena++) {
+        pid = fork();
+
+        if (pid == -1) {
+            return 1;
+        }
+
+        if (pid == 0) {
+            ngx_arena_bench_run(arena);
+            return 0;
+        }
+
+        if (waitpid(pid, &status, 0) == -1 || status != 0) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+static void
+ngx_arena_bench_run(ngx_uint_t arena)
+{
+    int                     status;
+    u_char                 *p;
+    uint64_t                start;
+    ngx_str_t              *names;
+    ngx_uint_t              i, k;
+    ngx_pid_t               pid;
+    ngx_hash_t              hash;
+    ngx_pool_t             *pool, *temp, *hpool;
+    ngx_hash_init_t         hinit;
+    ngx_hash_keys_arrays_t  ha;
+
+    pool = ngx_create_pool(16384, ngx_bench_log);
+    temp = ngx_create_pool(16384, ngx_bench_log);
+    hpool = arena ? ngx_create_arena(16384, ngx_bench_log) : pool;
+
+    if (pool == NULL || temp == NULL || hpool == NULL) {
+        exit(1);
+    }
+
+    names = ngx_palloc(pool, NGX_ARENA_BENCH_KEYS * sizeof(ngx_str_t));
+    if (names == NULL) {
+        exit(1);
+    }
+
+    ngx_memzero(&ha, sizeof(ngx_hash_keys_arrays_t));
+
+    ha.pool = pool;
+    ha.temp_pool = temp;
+
+    if (ngx_hash_keys_array_init(&ha, NGX_HASH_LARGE) != NGX_OK) {
+        exit(1);
+    }
+
+    for (i = 0; i < NGX_ARENA_BENCH_KEYS; i++) {
+        p = ngx_pnalloc(pool, sizeof("www.example-4294967295.com") - 1);
+        if (p == NULL) {
+            exit(1);
+        }
+
+        names[i].data = p;
+        names[i].len = ngx_sprintf(p, "www.example-%ui.com", i) - p;
+
+        if (ngx_hash_add_key(&ha, &names[i], &names[i],
+                             NGX_HASH_READONLY_KEY)
+            != NGX_OK)
+        {
+            exit(1);
+        }
+    }
+
+    hinit.hash = &hash;
+    hinit.key = ngx_hash_key_lc;
+    hinit.max_size = 262144;
+    hinit.bucket_size = 128;
+    hinit.name = "bench_hash";
+    hinit.pool = hpool;
+    hinit.temp_pool = temp;
+
+    if (ngx_hash_init(&hinit, ha.keys.elts, ha.keys.nelts) != NGX_OK) {
+        exit(1);
+    }
+
+    ngx_destroy_pool(temp);
+
+    if (arena) {
+        ngx_pool_freeze(hpool);
+    }
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_ARENA_BENCH_LOOKUPS; i++) {
+        k = ngx_random() % NGX_ARENA_BENCH_KEYS;
+
+        if (ngx_hash_find(&hash, ngx_hash_key(names[k].data, names[k].len),
+                          names[k].data, names[k].len)
+            != &names[k])
+        {
+            exit(1);
+        }
+    }
+
+    ngx_bench_report(arena ? "hash in arena, lookup" : "hash in pool, lookup",
+                     NGX_ARENA_BENCH_LOOKUPS, ngx_bench_nsec() - start);
+
+    fflush(stdout);
+
+    pid = fork();
+
+    if (pid == -1) {
+        exit(1);
+    }
+
+    if (pid == 0) {
+        ngx_arena_bench_worker(arena, pool, &hash, names);
+        exit(0);
+    }
+
+    if (waitpid(pid, &status, 0) == -1 || status != 0) {
+        exit(1);
+    }
+}
+
+
+static void
+ngx_arena_bench_worker(ngx_uint_t arena, ngx_pool_t *pool, ngx_hash_t *hash,
+    ngx_str_t *names)
+{
+    void        *p[NGX_ARENA_BENCH_ALLOCS];
+    size_t       shared, private, before;
+    ngx_uint_t   i;
+
+    if (ngx_linux_memory_usage(&before, &private, ngx_bench_log) != NGX_OK) {
+        exit(1);
+    }
+
+    for (i = 0; i < 1000; i++) {
+        if (ngx_palloc(pool, 16 + ngx_random() % 1009) == NULL) {
+            exit(1);
+        }
+    }
+
+    for (i = 0; i < NGX_ARENA_BENCH_ALLOCS; i++) {
+        p[i] = ngx_alloc(16 + ngx_random() % 2033, ngx_bench_log);
+        if (p[i] == NULL) {
+            exit(1);
+        }
+    }
+
+    for (i = 0; i < NGX_ARENA_BENCH_ALLOCS; i += 2) {
+        ngx_free(p[i]);
+    }
+
+    for (i = 0; i < NGX_ARENA_BENCH_KEYS; i++) {
+        if (ngx_hash_find(hash, ngx_hash_key(names[i].data, names[i].len),
+                          names[i].data, names[i].len)
+            != &names[i])
+        {
+            exit(1);
+        }
+    }
+
+    if (ngx_linux_memory_usage(&shared, &private, ngx_bench_log) != NGX_OK) {
+        exit(1);
+    }
+
+    printf("%-40s %10zu bytes unshared\n",
+           arena ? "hash in arena, worker" : "hash in pool, worker",
+           before - shared);
+}
@@ -0,0 +1,87 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include "ngx_bench.h"
+
+
+/*
+ * The benchmarks are linked with all objects of a built tree except
+ * src/core/nginx.o, so the few symbols it provides to other objects
+ * are defined here.
+ */
+
+ngx_module_t  ngx_core_module;
+
+ngx_log_t    *ngx_bench_log;
+
+static ngx_log_t          ngx_bench_log_s;
+static ngx_open_file_t    ngx_bench_log_file;
+
+
+char **
+ngx_set_environment(ngx_cycle_t *cycle, ngx_uint_t *last)
+{
+    return NULL;
+}
+
+
+ngx_pid_t
+ngx_exec_new_binary(ngx_cycle_t *cycle, char *const *argv)
+{
+    return NGX_INVALID_PID;
+}
+
+
+ngx_cpuset_t *
+ngx_get_cpu_affinity(ngx_uint_t n)
+{
+    return NULL;
+}
+
+
+void
+ngx_bench_init(void)
+{
+    ngx_uint_t  n;
+
+    ngx_bench_log_file.fd = ngx_stderr;
+
+    ngx_bench_log_s.file = &ngx_bench_log_file;
+    ngx_bench_log_s.log_level = NGX_LOG_NOTICE;
+
+    ngx_bench_log = &ngx_bench_log_s;
+
+    ngx_pid = ngx_getpid();
+
+    ngx_pagesize = getpagesize();
+    ngx_cacheline_size = NGX_CPU_CACHE_LINE;
+
+    for (n = ngx_pagesize; n >>= 1; ngx_pagesize_shift++) { /* void */ }
+
+    ngx_time_init();
+    srandom(1);
+}
+
+
+uint64_t
+ngx_bench_nsec(void)
+{
+    struct timespec  ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+void
+ngx_bench_report(char *name, ngx_uint_t n, uint64_t nsec)
+{
+    printf("%-40s %10lu ops %10.1f ns/op\n",
+           name, (unsigned long) n, n ? (double) nsec / n : 0.0);
+}
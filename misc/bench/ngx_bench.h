@@ -0,0 +1,23 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#ifndef _NGX_BENCH_H_INCLUDED_
+#define _NGX_BENCH_H_INCLUDED_
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+
+
+void ngx_bench_init(void);
+uint64_t ngx_bench_nsec(void);
+void ngx_bench_report(char *name, ngx_uint_t n, uint64_t nsec);
+
+
+extern ngx_log_t  *ngx_bench_log;
+
+
+#endif /* _NGX_BENCH_H_INCLUDED_ */
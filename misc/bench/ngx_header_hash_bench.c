@@ -0,0 +1,164 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * Measures lookups of request header names in the headers_in hash, built
+ * with the same parameters as in ngx_http_init_headers_in_hash(), with
+ * the hash calculated by the parser, as r->header_hash is now passed by
+ * all protocols, and with the name hashed once more, as HTTP/2 and HTTP/3
+ * did.
+ *
+ * The names are those of the headers sent by common clients, known and
+ * unknown ones, lowercased as the parsers do.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+#include "ngx_bench.h"
+
+
+#define NGX_HEADER_HASH_BENCH_LOOPS  10000000
+
+
+static void ngx_header_hash_bench_run(ngx_array_t *keys, ngx_pool_t *pool);
+
+
+static ngx_str_t  ngx_header_hash_bench_names[] = {
+    ngx_string("host"),
+    ngx_string("connection"),
+    ngx_string("sec-ch-ua"),
+    ngx_string("sec-ch-ua-mobile"),
+    ngx_string("sec-ch-ua-platform"),
+    ngx_string("upgrade-insecure-requests"),
+    ngx_string("user-agent"),
+    ngx_string("accept"),
+    ngx_string("sec-fetch-site"),
+    ngx_string("sec-fetch-mode"),
+    ngx_string("sec-fetch-user"),
+    ngx_string("sec-fetch-dest"),
+    ngx_string("referer"),
+    ngx_string("accept-encoding"),
+    ngx_string("accept-language"),
+    ngx_string("cookie"),
+    ngx_string("if-none-match"),
+    ngx_string("if-modified-since"),
+    ngx_string("authorization"),
+    ngx_string("content-type"),
+    ngx_string("content-length"),
+    ngx_string("x-request-id"),
+    ngx_string("x-forwarded-for"),
+    ngx_string("range"),
+    ngx_null_string
+};
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    ngx_pool_t         *pool;
+    ngx_array_t         keys;
+    ngx_hash_key_t     *hk;
+    ngx_http_header_t  *header;
+
+    ngx_bench_init();
+
+    pool = ngx_create_pool(16384, ngx_bench_log);
+    if (pool == NULL) {
+        return 1;
+    }
+
+    if (ngx_array_init(&keys, pool, 32, sizeof(ngx_hash_key_t)) != NGX_OK) {
+        return 1;
+    }
+
+    for (header = ngx_http_headers_in; header->name.len; header++) {
+        hk = ngx_array_push(&keys);
+        if (hk == NULL) {
+            return 1;
+        }
+
+        hk->key = header->name;
+        hk->key_hash = ngx_hash_key_lc(header->name.data, header->name.len);
+        hk->value = header;
+    }
+
+    ngx_header_hash_bench_run(&keys, pool);
+
+    return 0;
+}
+
+
+static void
+ngx_header_hash_bench_run(ngx_array_t *keys, ngx_pool_t *pool)
+{
+    u_char              name[64];
+    uint64_t            start;
+    ngx_str_t          *s;
+    ngx_uint_t          i, n, found, known, hashes[64];
+    ngx_hash_t          hash;
+    ngx_hash_init_t     hinit;
+
+    hinit.hash = &hash;
+    hinit.key = ngx_hash_key_lc;
+    hinit.max_size = 512;
+    hinit.bucket_size = ngx_align(64, ngx_cacheline_size);
+    hinit.name = "headers_in_hash";
+    hinit.pool = pool;
+    hinit.temp_pool = NULL;
+
+    if (ngx_hash_init(&hinit, keys->elts, keys->nelts) != NGX_OK) {
+        exit(1);
+    }
+
+    found = 0;
+    known = 0;
+
+    for (n = 0; ngx_header_hash_bench_names[n].len; n++) {
+        s = &ngx_header_hash_bench_names[n];
+        hashes[n] = ngx_hash_key(s->data, s->len);
+
+        if (ngx_hash_find(&hash, hashes[n], s->data, s->len)) {
+            found++;
+        }
+    }
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_HEADER_HASH_BENCH_LOOPS; i++) {
+        s = &ngx_header_hash_bench_names[i % n];
+
+        if (ngx_hash_find(&hash, hashes[i % n], s->data, s->len)) {
+            known++;
+        }
+    }
+
+    ngx_sprintf(name, "ngx_hash_find(), %ui buckets%Z", hash.size);
+
+    ngx_bench_report((char *) name, NGX_HEADER_HASH_BENCH_LOOPS,
+                     ngx_bench_nsec() - start);
+
+    printf("%-40s %10lu of %lu names known, %lu found\n", name,
+           (unsigned long) found, (unsigned long) n, (unsigned long) known);
+
+    /* HTTP/2 and HTTP/3 hashed each name again before the lookup */
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_HEADER_HASH_BENCH_LOOPS; i++) {
+        s = &ngx_header_hash_bench_names[i % n];
+
+        if (ngx_hash_find(&hash, ngx_hash_key(s->data, s->len),
+                          s->data, s->len))
+        {
+            known++;
+        }
+    }
+
+    ngx_bench_report("ngx_hash_find(), ngx_hash_key()",
+                     NGX_HEADER_HASH_BENCH_LOOPS, ngx_bench_nsec() - start);
+}
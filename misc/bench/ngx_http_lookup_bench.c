@@ -0,0 +1,511 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * Measures location and server name lookups in a large configuration.
+ *
+ * A configuration is generated in a temporary directory: 500 servers with
+ * 100 names each, 50000 names in total, of them 5000 wildcard names, and,
+ * in the first server, 10000 static locations:
+ *
+ *     location /api0/ {
+ *         location /api0/r0/ { }          60 nested prefix locations
+ *         location = /api0/r0 { }         20 nested exact locations
+ *         ...
+ *     }
+ *     ...                                 100 such blocks
+ *     location ^~ /static0/ { }           1900 prefix locations
+ *     ...
+ *     location / { }
+ *
+ * The configuration is loaded with ngx_init_cycle(), as nginx does.  Then
+ * the location of each URI is found with ngx_http_core_find_config_phase(),
+ * and the server of each name is looked up in the virtual names hash,
+ * as in ngx_http_find_virtual_server().
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+#include "ngx_bench.h"
+
+
+#define NGX_HTTP_LOOKUP_BENCH_SERVERS   500
+#define NGX_HTTP_LOOKUP_BENCH_NAMES     100
+#define NGX_HTTP_LOOKUP_BENCH_GROUPS    100
+#define NGX_HTTP_LOOKUP_BENCH_NESTED    60
+#define NGX_HTTP_LOOKUP_BENCH_EXACT     20
+#define NGX_HTTP_LOOKUP_BENCH_STATIC    1900
+
+#define NGX_HTTP_LOOKUP_BENCH_KEYS      4096
+#define NGX_HTTP_LOOKUP_BENCH_LOOPS     1000000
+
+
+static void *ngx_http_lookup_bench_core_create_conf(ngx_cycle_t *cycle);
+static ngx_int_t ngx_http_lookup_bench_conf(char *prefix);
+static void ngx_http_lookup_bench_locations(ngx_cycle_t *cycle);
+static void ngx_http_lookup_bench_names(ngx_cycle_t *cycle);
+static ngx_int_t ngx_http_lookup_bench_delete_file(ngx_tree_ctx_t *ctx,
+    ngx_str_t *path);
+static ngx_int_t ngx_http_lookup_bench_delete_dir(ngx_tree_ctx_t *ctx,
+    ngx_str_t *path);
+static ngx_int_t ngx_http_lookup_bench_noop(ngx_tree_ctx_t *ctx,
+    ngx_str_t *path);
+
+
+/*
+ * ngx_bench.c leaves ngx_core_module empty, the configuration is
+ * loaded with a core module context which does not daemonize, runs
+ * no workers, and creates no pid file
+ */
+
+static ngx_core_module_t  ngx_http_lookup_bench_core_module_ctx = {
+    ngx_string("core"),
+    ngx_http_lookup_bench_core_create_conf,
+    NULL
+};
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    char            prefix[] = "/tmp/ngx_http_lookup_bench.XXXXXX";
+    u_char          conf[NGX_MAX_PATH], path[NGX_MAX_PATH];
+    uint64_t        start;
+    ngx_cycle_t    *cycle, init_cycle;
+    ngx_tree_ctx_t  tree;
+
+    ngx_bench_init();
+
+    /* as in main() */
+
+    ngx_argc = argc;
+    ngx_argv = (char **) argv;
+    ngx_os_argv = (char **) argv;
+
+    if (ngx_strerror_init() != NGX_OK) {
+        return 1;
+    }
+
+    if (ngx_os_init(ngx_bench_log) != NGX_OK) {
+        return 1;
+    }
+
+    if (ngx_crc32_table_init() != NGX_OK) {
+        return 1;
+    }
+
+    ngx_slab_sizes_init();
+
+#if (NGX_PCRE)
+    ngx_regex_init();
+#endif
+
+    ngx_core_module.ctx = &ngx_http_lookup_bench_core_module_ctx;
+    ngx_core_module.type = NGX_CORE_MODULE;
+
+    if (ngx_preinit_modules() != NGX_OK) {
+        return 1;
+    }
+
+    if (mkdtemp(prefix) == NULL) {
+        perror("mkdtemp()");
+        return 1;
+    }
+
+    if (ngx_http_lookup_bench_conf(prefix) != NGX_OK) {
+        return 1;
+    }
+
+    ngx_memzero(&init_cycle, sizeof(ngx_cycle_t));
+    init_cycle.log = ngx_bench_log;
+    ngx_cycle = &init_cycle;
+
+    init_cycle.pool = ngx_create_pool(1024, ngx_bench_log);
+    if (init_cycle.pool == NULL) {
+        return 1;
+    }
+
+    /* the prefix ends with a slash, as NGX_PREFIX and "-p" do */
+
+    init_cycle.prefix.data = path;
+    init_cycle.prefix.len = ngx_sprintf(path, "%s/%Z", prefix) - path - 1;
+    init_cycle.conf_prefix = init_cycle.prefix;
+
+    init_cycle.conf_file.data = conf;
+    init_cycle.conf_file.len = ngx_sprintf(conf, "%s/nginx.conf%Z", prefix)
+                               - conf - 1;
+
+    ngx_str_set(&init_cycle.error_log, "stderr");
+
+    start = ngx_bench_nsec();
+
+    cycle = ngx_init_cycle(&init_cycle);
+    if (cycle == NULL) {
+        return 1;
+    }
+
+    printf("%-40s %10.1f ms\n", "configuration loaded",
+           (double) (ngx_bench_nsec() - start) / 1000000);
+
+    ngx_cycle = cycle;
+
+    ngx_http_lookup_bench_locations(cycle);
+    ngx_http_lookup_bench_names(cycle);
+
+    /* the listening socket and logs are created in the prefix */
+
+    tree.init_handler = NULL;
+    tree.file_handler = ngx_http_lookup_bench_delete_file;
+    tree.pre_tree_handler = ngx_http_lookup_bench_noop;
+    tree.post_tree_handler = ngx_http_lookup_bench_delete_dir;
+    tree.spec_handler = ngx_http_lookup_bench_delete_file;
+    tree.data = NULL;
+    tree.alloc = 0;
+    tree.log = ngx_bench_log;
+
+    init_cycle.prefix.len--;
+    path[init_cycle.prefix.len] = '\0';
+
+    if (ngx_walk_tree(&tree, &init_cycle.prefix) != NGX_OK
+        || ngx_delete_dir(prefix) == NGX_FILE_ERROR)
+    {
+        printf("configuration is left in %s\n", prefix);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+static void *
+ngx_http_lookup_bench_core_create_conf(ngx_cycle_t *cycle)
+{
+    ngx_core_conf_t  *ccf;
+
+    ccf = ngx_pcalloc(cycle->pool, sizeof(ngx_core_conf_t));
+    if (ccf == NULL) {
+        return NULL;
+    }
+
+    ccf->worker_processes = 1;
+    ccf->rlimit_nofile = NGX_CONF_UNSET;
+    ccf->rlimit_core = NGX_CONF_UNSET;
+    ccf->user = (ngx_uid_t) NGX_CONF_UNSET_UINT;
+    ccf->group = (ngx_gid_t) NGX_CONF_UNSET_UINT;
+
+    if (ngx_array_init(&ccf->env, cycle->pool, 1, sizeof(ngx_str_t))
+        != NGX_OK)
+    {
+        return NULL;
+    }
+
+    return ccf;
+}
+
+
+static ngx_int_t
+ngx_http_lookup_bench_conf(char *prefix)
+{
+    FILE        *f;
+    u_char       name[NGX_MAX_PATH];
+    ngx_uint_t   s, k, g;
+
+    ngx_sprintf(name, "%s/logs%Z", prefix);
+
+    if (ngx_create_dir(name, 0700) == NGX_FILE_ERROR) {
+        perror("mkdir()");
+        return NGX_ERROR;
+    }
+
+    ngx_sprintf(name, "%s/nginx.conf%Z", prefix);
+
+    f = fopen((char *) name, "w");
+    if (f == NULL) {
+        perror("fopen()");
+        return NGX_ERROR;
+    }
+
+    fprintf(f, "error_log stderr;\n"
+               "events { worker_connections 64; }\n"
+               "http {\n"
+               "    access_log off;\n"
+               "    server_names_hash_max_size 262144;\n"
+               "    server_names_hash_bucket_size 128;\n");
+
+    for (s = 0; s < NGX_HTTP_LOOKUP_BENCH_SERVERS; s++) {
+        fprintf(f, "    server {\n"
+                   "        listen unix:%s/http.sock;\n"
+                   "        server_name", prefix);
+
+        for (k = 0; k < NGX_HTTP_LOOKUP_BENCH_NAMES; k++) {
+            if (k % 20 == 18) {
+                fprintf(f, " *.w%lu.site%lu.example.net",
+                        (unsigned long) k, (unsigned long) s);
+
+            } else if (k % 20 == 19) {
+                fprintf(f, " site%lu-%lu.example.*",
+                        (unsigned long) s, (unsigned long) k);
+
+            } else {
+                fprintf(f, " www%lu.site%lu.example.com",
+                        (unsigned long) k, (unsigned long) s);
+            }
+        }
+
+        fprintf(f, ";\n");
+
+        if (s > 0) {
+            fprintf(f, "    }\n");
+            continue;
+        }
+
+        for (g = 0; g < NGX_HTTP_LOOKUP_BENCH_GROUPS; g++) {
+            fprintf(f, "        location /api%lu/ {\n", (unsigned long) g);
+
+            for (k = 0; k < NGX_HTTP_LOOKUP_BENCH_NESTED; k++) {
+                fprintf(f, "            location /api%lu/r%lu/ { }\n",
+                        (unsigned long) g, (unsigned long) k);
+            }
+
+            for (k = 0; k < NGX_HTTP_LOOKUP_BENCH_EXACT; k++) {
+                fprintf(f, "            location = /api%lu/r%lu { }\n",
+                        (unsigned long) g, (unsigned long) k);
+            }
+
+            fprintf(f, "        }\n");
+        }
+
+        for (k = 0; k < NGX_HTTP_LOOKUP_BENCH_STATIC; k++) {
+            fprintf(f, "        location ^~ /static%lu/ { }\n",
+                    (unsigned long) k);
+        }
+
+        fprintf(f, "        location / { }\n"
+                   "    }\n");
+    }
+
+    fprintf(f, "}\n");
+
+    if (fclose(f) != 0) {
+        perror("fclose()");
+        return NGX_ERROR;
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_http_lookup_bench_locations(ngx_cycle_t *cycle)
+{
+    u_char                      *p;
+    void                       **loc_conf;
+    uint64_t                     start;
+    ngx_uint_t                   i, n, g;
+    ngx_str_t                   *uris;
+    ngx_pool_t                  *pool;
+    ngx_connection_t             c;
+    ngx_http_request_t           r;
+    ngx_http_core_srv_conf_t   **cscfp;
+    ngx_http_core_main_conf_t   *cmcf;
+
+    cmcf = ngx_http_cycle_get_module_main_conf(cycle, ngx_http_core_module);
+    cscfp = cmcf->servers.elts;
+
+    loc_conf = cscfp[0]->ctx->loc_conf;
+
+    pool = ngx_create_pool(16384, ngx_bench_log);
+    if (pool == NULL) {
+        exit(1);
+    }
+
+    uris = ngx_palloc(pool, NGX_HTTP_LOOKUP_BENCH_KEYS * sizeof(ngx_str_t));
+    if (uris == NULL) {
+        exit(1);
+    }
+
+    /* nested prefix, nested exact, "^~" and unmatched locations */
+
+    for (i = 0; i < NGX_HTTP_LOOKUP_BENCH_KEYS; i++) {
+        p = ngx_pnalloc(pool, 64);
+        if (p == NULL) {
+            exit(1);
+        }
+
+        uris[i].data = p;
+
+        g = ngx_random() % NGX_HTTP_LOOKUP_BENCH_GROUPS;
+        n = ngx_random() % 10;
+
+        if (n < 6) {
+            p = ngx_sprintf(p, "/api%ui/r%ui/items/%ui", g,
+                            ngx_random() % NGX_HTTP_LOOKUP_BENCH_NESTED,
+                            ngx_random() % 100000);
+
+        } else if (n < 8) {
+            p = ngx_sprintf(p, "/api%ui/r%ui", g,
+                            ngx_random() % NGX_HTTP_LOOKUP_BENCH_EXACT);
+
+        } else if (n < 9) {
+            p = ngx_sprintf(p, "/static%ui/css/site.css",
+                            ngx_random() % NGX_HTTP_LOOKUP_BENCH_STATIC);
+
+        } else {
+            p = ngx_sprintf(p, "/blog/2024/%ui", ngx_random() % 100000);
+        }
+
+        uris[i].len = p - uris[i].data;
+    }
+
+    ngx_memzero(&c, sizeof(ngx_connection_t));
+    c.log = ngx_bench_log;
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_HTTP_LOOKUP_BENCH_LOOPS; i++) {
+        ngx_memzero(&r, sizeof(ngx_http_request_t));
+
+        r.main = &r;
+        r.connection = &c;
+        r.pool = pool;
+        r.method = NGX_HTTP_GET;
+        r.headers_in.content_length_n = -1;
+        r.loc_conf = loc_conf;
+        r.uri = uris[i % NGX_HTTP_LOOKUP_BENCH_KEYS];
+
+        if (ngx_http_core_find_config_phase(&r, NULL) != NGX_AGAIN) {
+            printf("no location for \"%.*s\"\n",
+                   (int) r.uri.len, r.uri.data);
+            exit(1);
+        }
+    }
+
+    ngx_bench_report("10000 locations, find config",
+                     NGX_HTTP_LOOKUP_BENCH_LOOPS, ngx_bench_nsec() - start);
+
+    ngx_destroy_pool(pool);
+}
+
+
+static void
+ngx_http_lookup_bench_names(ngx_cycle_t *cycle)
+{
+    u_char                    *p;
+    uint64_t                   start;
+    ngx_uint_t                 i, n, s, k, found;
+    ngx_str_t                 *names;
+    ngx_pool_t                *pool;
+    ngx_http_port_t           *port;
+    ngx_listening_t           *ls;
+    ngx_http_in_addr_t        *addr;
+    ngx_http_virtual_names_t  *vn;
+
+    ls = cycle->listening.elts;
+    port = ls[0].servers;
+    addr = port->addrs;
+    vn = addr[0].conf.virtual_names;
+
+    pool = ngx_create_pool(16384, ngx_bench_log);
+    if (pool == NULL) {
+        exit(1);
+    }
+
+    names = ngx_palloc(pool, NGX_HTTP_LOOKUP_BENCH_KEYS * sizeof(ngx_str_t));
+    if (names == NULL) {
+        exit(1);
+    }
+
+    /* exact, wildcard and unknown names */
+
+    for (i = 0; i < NGX_HTTP_LOOKUP_BENCH_KEYS; i++) {
+        p = ngx_pnalloc(pool, 64);
+        if (p == NULL) {
+            exit(1);
+        }
+
+        names[i].data = p;
+
+        s = ngx_random() % NGX_HTTP_LOOKUP_BENCH_SERVERS;
+        k = ngx_random() % NGX_HTTP_LOOKUP_BENCH_NAMES;
+        n = ngx_random() % 20;
+
+        if (n < 16) {
+            k -= (k % 20 >= 18) ? 2 : 0;
+            p = ngx_sprintf(p, "www%ui.site%ui.example.com", k, s);
+
+        } else if (n < 18) {
+            p = ngx_sprintf(p, "img.w%ui.site%ui.example.net",
+                            k - k % 20 + 18, s);
+
+        } else if (n < 19) {
+            p = ngx_sprintf(p, "site%ui-%ui.example.org", s,
+                            k - k % 20 + 19);
+
+        } else {
+            p = ngx_sprintf(p, "www.example%ui.com", k);
+        }
+
+        names[i].len = p - names[i].data;
+    }
+
+    found = 0;
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_HTTP_LOOKUP_BENCH_LOOPS; i++) {
+        n = i % NGX_HTTP_LOOKUP_BENCH_KEYS;
+
+        if (ngx_hash_find_combined(&vn->names,
+                                   ngx_hash_key(names[n].data, names[n].len),
+                                   names[n].data, names[n].len))
+        {
+            found++;
+        }
+    }
+
+    ngx_bench_report("50000 server names, find",
+                     NGX_HTTP_LOOKUP_BENCH_LOOPS, ngx_bench_nsec() - start);
+
+    printf("%-40s %10.1f%%\n", "names found",
+           (double) found * 100 / NGX_HTTP_LOOKUP_BENCH_LOOPS);
+
+    ngx_destroy_pool(pool);
+}
+
+
+static ngx_int_t
+ngx_http_lookup_bench_delete_file(ngx_tree_ctx_t *ctx, ngx_str_t *path)
+{
+    if (ngx_delete_file(path->data) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_CRIT, ctx->log, ngx_errno,
+                      ngx_delete_file_n " \"%s\" failed", path->data);
+        return NGX_ERROR;
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_lookup_bench_delete_dir(ngx_tree_ctx_t *ctx, ngx_str_t *path)
+{
+    if (ngx_delete_dir(path->data) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_CRIT, ctx->log, ngx_errno,
+                      ngx_delete_dir_n " \"%s\" failed", path->data);
+        return NGX_ERROR;
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_http_lookup_bench_noop(ngx_tree_ctx_t *ctx, ngx_str_t *path)
+{
+    return NGX_OK;
+}
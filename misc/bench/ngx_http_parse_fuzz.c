@@ -0,0 +1,394 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * Differential test of the vector fast paths of the HTTP request line and
+ * header parsers:
+ *
+ *     ngx_http_parse_fuzz [seed [iterations]]
+ *
+ * Random requests, valid and not, are parsed in random parts, as they
+ * would be read from a socket, once with the vector code disabled and once
+ * with the CPU features detected at run time.  The return codes and the
+ * request fields after each call must be the same.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+#include "ngx_bench.h"
+
+
+#define NGX_HTTP_PARSE_FUZZ_LEN     4096
+#define NGX_HTTP_PARSE_FUZZ_TRACE   65536
+#define NGX_HTTP_PARSE_FUZZ_PARTS   16
+
+
+static size_t ngx_http_parse_fuzz_request(u_char *buf);
+static u_char *ngx_http_parse_fuzz_add(u_char *p, u_char *last,
+    char *chars, size_t size, size_t max);
+static size_t ngx_http_parse_fuzz_run(u_char *buf, size_t *parts,
+    ngx_uint_t n, ngx_uint_t underscores, u_char *trace);
+static u_char *ngx_http_parse_fuzz_record(u_char *p, ngx_http_request_t *r,
+    ngx_buf_t *b, ngx_int_t rc);
+static ngx_int_t ngx_http_parse_fuzz_offset(u_char *base, u_char *p);
+static int ngx_libc_cdecl ngx_http_parse_fuzz_cmp(const void *one,
+    const void *two);
+static ngx_uint_t ngx_http_parse_fuzz_random(ngx_uint_t n);
+
+
+static uint64_t  ngx_http_parse_fuzz_state;
+
+
+/* mostly valid characters, with some that the parsers handle specially */
+
+static char  ngx_http_parse_fuzz_uri[] =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+    "abcdefghijklmnopqrstuvwxyz0123456789-._~/////...%%%??&&==++;;##"
+    "\"\\<>{}|^`\x01\x7f\x80\xff\t";
+
+static char  ngx_http_parse_fuzz_name[] =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+    "---------_. :/\x01\x80";
+
+static char  ngx_http_parse_fuzz_value[] =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+    "       ,;=/.:-_()\"'*+?!@#$%&[]{}<>\\|~^`\t\x01\x7f\x80\xc3\xa9\xff";
+
+static char  *ngx_http_parse_fuzz_methods[] = {
+    "GET", "GET", "GET", "POST", "HEAD", "PUT", "DELETE", "MKCOL", "COPY",
+    "MOVE", "OPTIONS", "PROPFIND", "PROPPATCH", "LOCK", "UNLOCK", "PATCH",
+    "TRACE", "CONNECT", "get", "G_T", ""
+};
+
+static char  *ngx_http_parse_fuzz_schemas[] = {
+    "", "", "", "", "", "", "http://example.com", "https://[::1]:8443",
+    "http://a.b-c.example:80", "HTTP://EXAMPLE.COM", "http://", "http:/"
+};
+
+static char  *ngx_http_parse_fuzz_versions[] = {
+    " HTTP/1.1", " HTTP/1.1", " HTTP/1.1", " HTTP/1.0", " HTTP/2.0",
+    " HTTP/1.10", " HTTP/0.9", " http/1.1", " HTTP/1", "  HTTP/1.1 ", ""
+};
+
+static char  *ngx_http_parse_fuzz_eols[] = {
+    "\r\n", "\r\n", "\r\n", "\r\n", "\r\n", "\r\n", "\n", "\r", "\r\r\n",
+    " \r\n", "\t\r\n"
+};
+
+
+#define ngx_http_parse_fuzz_pick(a)                                           \
+    a[ngx_http_parse_fuzz_random(sizeof(a) / sizeof(a[0]))]
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    size_t          len, scalar, vector, parts[NGX_HTTP_PARSE_FUZZ_PARTS];
+    uint64_t        seed;
+    ngx_int_t       iterations;
+    ngx_uint_t      i, k, n, underscores, features;
+    static u_char   buf[NGX_HTTP_PARSE_FUZZ_LEN];
+    static u_char   trace0[NGX_HTTP_PARSE_FUZZ_TRACE];
+    static u_char   trace1[NGX_HTTP_PARSE_FUZZ_TRACE];
+
+    ngx_bench_init();
+
+    seed = (argc > 1) ? (uint64_t) strtoull(argv[1], NULL, 10)
+                      : (uint64_t) time(NULL);
+
+    iterations = (argc > 2) ? ngx_atoi((u_char *) argv[2],
+                                       ngx_strlen(argv[2]))
+                            : 1000000;
+
+    if (argc > 3 || iterations == NGX_ERROR) {
+        printf("usage: ngx_http_parse_fuzz [seed [iterations]]\n");
+        return 1;
+    }
+
+    /* xorshift needs a non-zero state */
+
+    ngx_http_parse_fuzz_state = seed ^ 0x9e3779b97f4a7c15ULL;
+
+    ngx_cpuinfo();
+    features = ngx_cpu_features;
+
+    printf("seed %llu, %ld iterations, cpu features:%s%s\n",
+           (unsigned long long) seed, (long) iterations,
+           (features & NGX_CPU_SSE42) ? " sse4.2" : "",
+           (features & NGX_CPU_AVX2) ? " avx2" : "");
+
+    for (i = 0; i < (ngx_uint_t) iterations; i++) {
+
+        len = ngx_http_parse_fuzz_request(buf);
+
+        /* the request is read in one part or up to 16 random parts */
+
+        n = ngx_http_parse_fuzz_random(2)
+            ? 1 : 1 + ngx_http_parse_fuzz_random(NGX_HTTP_PARSE_FUZZ_PARTS);
+
+        for (k = 0; k < n - 1; k++) {
+            parts[k] = ngx_http_parse_fuzz_random(len + 1);
+        }
+
+        parts[k] = len;
+
+        ngx_qsort(parts, n, sizeof(size_t), ngx_http_parse_fuzz_cmp);
+
+        underscores = ngx_http_parse_fuzz_random(2);
+
+        ngx_cpu_features = 0;
+        scalar = ngx_http_parse_fuzz_run(buf, parts, n, underscores, trace0);
+
+        ngx_cpu_features = features;
+        vector = ngx_http_parse_fuzz_run(buf, parts, n, underscores, trace1);
+
+        if (scalar != vector || ngx_memcmp(trace0, trace1, scalar) != 0) {
+            printf("mismatch at iteration %lu, request:\n", (unsigned long) i);
+            fwrite(buf, 1, len, stdout);
+            printf("\nscalar:\n%.*s\nvector:\n%.*s\n",
+                   (int) scalar, trace0, (int) vector, trace1);
+            return 1;
+        }
+    }
+
+    printf("no mismatches\n");
+
+    return 0;
+}
+
+
+static size_t
+ngx_http_parse_fuzz_request(u_char *buf)
+{
+    u_char      *p, *last;
+    ngx_uint_t   i, n;
+
+    p = buf;
+    last = buf + NGX_HTTP_PARSE_FUZZ_LEN - 4;
+
+    p = ngx_cpystrn(p, (u_char *) ngx_http_parse_fuzz_pick(
+                                               ngx_http_parse_fuzz_methods),
+                    last - p);
+    *p++ = ' ';
+
+    p = ngx_cpystrn(p, (u_char *) ngx_http_parse_fuzz_pick(
+                                               ngx_http_parse_fuzz_schemas),
+                    last - p);
+
+    if (ngx_http_parse_fuzz_random(8)) {
+        *p++ = '/';
+    }
+
+    /* short and long URIs, so that the vector loops run and stop anywhere */
+
+    p = ngx_http_parse_fuzz_add(p, last, ngx_http_parse_fuzz_uri,
+                                sizeof(ngx_http_parse_fuzz_uri) - 1,
+                                ngx_http_parse_fuzz_random(2) ? 16 : 200);
+
+    p = ngx_cpystrn(p, (u_char *) ngx_http_parse_fuzz_pick(
+                                               ngx_http_parse_fuzz_versions),
+                    last - p);
+    p = ngx_cpystrn(p, (u_char *) ngx_http_parse_fuzz_pick(
+                                               ngx_http_parse_fuzz_eols),
+                    last - p);
+
+    n = ngx_http_parse_fuzz_random(12);
+
+    for (i = 0; i < n; i++) {
+        p = ngx_http_parse_fuzz_add(p, last, ngx_http_parse_fuzz_name,
+                                    sizeof(ngx_http_parse_fuzz_name) - 1,
+                                    ngx_http_parse_fuzz_random(4) ? 20 : 48);
+
+        if (p < last && ngx_http_parse_fuzz_random(16)) {
+            *p++ = ':';
+        }
+
+        p = ngx_http_parse_fuzz_add(p, last, ngx_http_parse_fuzz_value,
+                                    sizeof(ngx_http_parse_fuzz_value) - 1,
+                                    ngx_http_parse_fuzz_random(2) ? 24 : 300);
+
+        p = ngx_cpystrn(p, (u_char *) ngx_http_parse_fuzz_pick(
+                                                   ngx_http_parse_fuzz_eols),
+                        last - p);
+    }
+
+    if (ngx_http_parse_fuzz_random(8)) {
+        p = ngx_cpystrn(p, (u_char *) ngx_http_parse_fuzz_pick(
+                                                   ngx_http_parse_fuzz_eols),
+                        last - p);
+    }
+
+    return p - buf;
+}
+
+
+static u_char *
+ngx_http_parse_fuzz_add(u_char *p, u_char *last, char *chars, size_t size,
+    size_t max)
+{
+    ngx_uint_t  n;
+
+    n = ngx_http_parse_fuzz_random(max + 1);
+
+    /* mostly plain characters, so that the special ones stay rare */
+
+    while (n-- && p < last) {
+        *p++ = chars[ngx_http_parse_fuzz_random(ngx_http_parse_fuzz_random(8)
+                                                ? 62 : size)];
+    }
+
+    return p;
+}
+
+
+static size_t
+ngx_http_parse_fuzz_run(u_char *buf, size_t *parts, ngx_uint_t n,
+    ngx_uint_t underscores, u_char *trace)
+{
+    u_char              *p;
+    ngx_int_t            rc;
+    ngx_uint_t           i, line;
+    ngx_buf_t            b;
+    ngx_connection_t     c;
+    ngx_http_request_t   r;
+
+    ngx_memzero(&c, sizeof(ngx_connection_t));
+    c.log = ngx_bench_log;
+
+    ngx_memzero(&r, sizeof(ngx_http_request_t));
+    r.connection = &c;
+
+    ngx_memzero(&b, sizeof(ngx_buf_t));
+    b.start = buf;
+    b.pos = buf;
+    b.last = buf + parts[0];
+    b.end = buf + NGX_HTTP_PARSE_FUZZ_LEN;
+
+    p = trace;
+    line = 1;
+    i = 0;
+
+    for ( ;; ) {
+
+        if (line) {
+            rc = ngx_http_parse_request_line(&r, &b);
+
+        } else {
+            rc = ngx_http_parse_header_line(&r, &b, underscores);
+        }
+
+        p = ngx_http_parse_fuzz_record(p, &r, &b, rc);
+
+        if (rc == NGX_AGAIN) {
+            if (++i == n) {
+                break;
+            }
+
+            b.last = buf + parts[i];
+            continue;
+        }
+
+        if (rc == NGX_OK) {
+            line = 0;
+            continue;
+        }
+
+        /* errors and the end of the header */
+
+        break;
+    }
+
+    return p - trace;
+}
+
+
+static u_char *
+ngx_http_parse_fuzz_record(u_char *p, ngx_http_request_t *r, ngx_buf_t *b,
+    ngx_int_t rc)
+{
+    u_char  *base;
+
+    base = b->start;
+
+    p = ngx_sprintf(p, "rc:%i state:%ui pos:%i method:%ui version:%ui "
+                    "%ui.%ui",
+                    rc, r->state, ngx_http_parse_fuzz_offset(base, b->pos),
+                    r->method, r->http_version, (ngx_uint_t) r->http_major,
+                    (ngx_uint_t) r->http_minor);
+
+    p = ngx_sprintf(p, " request:%i-%i method:%i schema:%i-%i host:%i-%i"
+                    " uri:%i-%i ext:%i args:%i protocol:%i+%uz",
+                    ngx_http_parse_fuzz_offset(base, r->request_start),
+                    ngx_http_parse_fuzz_offset(base, r->request_end),
+                    ngx_http_parse_fuzz_offset(base, r->method_end),
+                    ngx_http_parse_fuzz_offset(base, r->schema_start),
+                    ngx_http_parse_fuzz_offset(base, r->schema_end),
+                    ngx_http_parse_fuzz_offset(base, r->host_start),
+                    ngx_http_parse_fuzz_offset(base, r->host_end),
+                    ngx_http_parse_fuzz_offset(base, r->uri_start),
+                    ngx_http_parse_fuzz_offset(base, r->uri_end),
+                    ngx_http_parse_fuzz_offset(base, r->uri_ext),
+                    ngx_http_parse_fuzz_offset(base, r->args_start),
+                    ngx_http_parse_fuzz_offset(base, r->http_protocol.data),
+                    r->http_protocol.len);
+
+    p = ngx_sprintf(p, " flags:%ui%ui%ui%ui%ui",
+                    (ngx_uint_t) r->complex_uri, (ngx_uint_t) r->quoted_uri,
+                    (ngx_uint_t) r->plus_in_uri,
+                    (ngx_uint_t) r->empty_path_in_uri,
+                    (ngx_uint_t) r->invalid_header);
+
+    p = ngx_sprintf(p, " name:%i-%i header:%i-%i hash:%ui lowcase:%ui \"%*s\"\n",
+                    ngx_http_parse_fuzz_offset(base, r->header_name_start),
+                    ngx_http_parse_fuzz_offset(base, r->header_name_end),
+                    ngx_http_parse_fuzz_offset(base, r->header_start),
+                    ngx_http_parse_fuzz_offset(base, r->header_end),
+                    r->header_hash, r->lowcase_index,
+                    (size_t) ngx_min(r->lowcase_index, NGX_HTTP_LC_HEADER_LEN),
+                    r->lowcase_header);
+
+    return p;
+}
+
+
+static ngx_int_t
+ngx_http_parse_fuzz_offset(u_char *base, u_char *p)
+{
+    return p ? p - base : -1;
+}
+
+
+static int ngx_libc_cdecl
+ngx_http_parse_fuzz_cmp(const void *one, const void *two)
+{
+    size_t  a, b;
+
+    a = *(size_t *) one;
+    b = *(size_t *) two;
+
+    return (a > b) - (a < b);
+}
+
+
+/* a fixed generator, so that a seed reproduces a failure on any system */
+
+static ngx_uint_t
+ngx_http_parse_fuzz_random(ngx_uint_t n)
+{
+    uint64_t  x;
+
+    x = ngx_http_parse_fuzz_state;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+
+    ngx_http_parse_fuzz_state = x;
+
+    return (ngx_uint_t) ((x >> 11) % n);
+}
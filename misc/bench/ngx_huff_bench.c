@@ -0,0 +1,580 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * Compares the HPACK/QPACK Huffman coders of the tree with the previous
+ * decoder and a symbol at a time encoder:
+ *
+ *     decode  - ngx_http_huff_decode(), one table lookup per input byte,
+ *               and the previous decoder, two lookups in the table of
+ *               nibble transitions per byte;
+ *     encode  - ngx_http_huff_encode(), which accumulates codes in
+ *               a machine word, and an encoder which stores each code
+ *               a byte at a time.
+ *
+ * Both the previous decoder and the reference encoder are built here from
+ * the code table of RFC 7541, Appendix B.  Before the timing, random inputs
+ * are encoded by both encoders, some of the results are corrupted, and
+ * they are decoded by the previous decoder at once and by the new one
+ * split at random points.  The return codes and the output must be the
+ * same.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+#include "ngx_bench.h"
+
+
+#define NGX_HUFF_BENCH_CHECKS  1000000
+#define NGX_HUFF_BENCH_LOOPS   1000000
+#define NGX_HUFF_BENCH_LEN     256
+
+
+typedef struct {
+    uint32_t  code;
+    uint32_t  len;
+} ngx_huff_bench_code_t;
+
+
+typedef struct {
+    u_char    next;
+    u_char    emit;
+    u_char    sym;
+    u_char    ending;
+} ngx_huff_bench_nibble_t;
+
+
+static ngx_int_t ngx_huff_bench_build(void);
+static ngx_int_t ngx_huff_bench_check(void);
+static void ngx_huff_bench_run(void);
+static ngx_int_t ngx_huff_bench_decode_nibbles(u_char *state, u_char *src,
+    size_t len, u_char **dst, ngx_uint_t last);
+static ngx_inline ngx_int_t ngx_huff_bench_decode_bits(u_char *state,
+    u_char *ending, ngx_uint_t bits, u_char **dst);
+static size_t ngx_huff_bench_encode_bytes(u_char *src, size_t len,
+    u_char *dst, ngx_uint_t lower);
+
+
+static ngx_huff_bench_nibble_t  ngx_huff_bench_nibbles[256][16];
+static volatile size_t          ngx_huff_bench_sink;
+
+
+/* RFC 7541, Appendix B, symbols 0-255 and EOS */
+
+static ngx_huff_bench_code_t  ngx_huff_bench_codes[257] = {
+    {0x00001ff8, 13}, {0x007fffd8, 23}, {0x0fffffe2, 28}, {0x0fffffe3, 28},
+    {0x0fffffe4, 28}, {0x0fffffe5, 28}, {0x0fffffe6, 28}, {0x0fffffe7, 28},
+    {0x0fffffe8, 28}, {0x00ffffea, 24}, {0x3ffffffc, 30}, {0x0fffffe9, 28},
+    {0x0fffffea, 28}, {0x3ffffffd, 30}, {0x0fffffeb, 28}, {0x0fffffec, 28},
+    {0x0fffffed, 28}, {0x0fffffee, 28}, {0x0fffffef, 28}, {0x0ffffff0, 28},
+    {0x0ffffff1, 28}, {0x0ffffff2, 28}, {0x3ffffffe, 30}, {0x0ffffff3, 28},
+    {0x0ffffff4, 28}, {0x0ffffff5, 28}, {0x0ffffff6, 28}, {0x0ffffff7, 28},
+    {0x0ffffff8, 28}, {0x0ffffff9, 28}, {0x0ffffffa, 28}, {0x0ffffffb, 28},
+    {0x00000014,  6}, {0x000003f8, 10}, {0x000003f9, 10}, {0x00000ffa, 12},
+    {0x00001ff9, 13}, {0x00000015,  6}, {0x000000f8,  8}, {0x000007fa, 11},
+    {0x000003fa, 10}, {0x000003fb, 10}, {0x000000f9,  8}, {0x000007fb, 11},
+    {0x000000fa,  8}, {0x00000016,  6}, {0x00000017,  6}, {0x00000018,  6},
+    {0x00000000,  5}, {0x00000001,  5}, {0x00000002,  5}, {0x00000019,  6},
+    {0x0000001a,  6}, {0x0000001b,  6}, {0x0000001c,  6}, {0x0000001d,  6},
+    {0x0000001e,  6}, {0x0000001f,  6}, {0x0000005c,  7}, {0x000000fb,  8},
+    {0x00007ffc, 15}, {0x00000020,  6}, {0x00000ffb, 12}, {0x000003fc, 10},
+    {0x00001ffa, 13}, {0x00000021,  6}, {0x0000005d,  7}, {0x0000005e,  7},
+    {0x0000005f,  7}, {0x00000060,  7}, {0x00000061,  7}, {0x00000062,  7},
+    {0x00000063,  7}, {0x00000064,  7}, {0x00000065,  7}, {0x00000066,  7},
+    {0x00000067,  7}, {0x00000068,  7}, {0x00000069,  7}, {0x0000006a,  7},
+    {0x0000006b,  7}, {0x0000006c,  7}, {0x0000006d,  7}, {0x0000006e,  7},
+    {0x0000006f,  7}, {0x00000070,  7}, {0x00000071,  7}, {0x00000072,  7},
+    {0x000000fc,  8}, {0x00000073,  7}, {0x000000fd,  8}, {0x00001ffb, 13},
+    {0x0007fff0, 19}, {0x00001ffc, 13}, {0x00003ffc, 14}, {0x00000022,  6},
+    {0x00007ffd, 15}, {0x00000003,  5}, {0x00000023,  6}, {0x00000004,  5},
+    {0x00000024,  6}, {0x00000005,  5}, {0x00000025,  6}, {0x00000026,  6},
+    {0x00000027,  6}, {0x00000006,  5}, {0x00000074,  7}, {0x00000075,  7},
+    {0x00000028,  6}, {0x00000029,  6}, {0x0000002a,  6}, {0x00000007,  5},
+    {0x0000002b,  6}, {0x00000076,  7}, {0x0000002c,  6}, {0x00000008,  5},
+    {0x00000009,  5}, {0x0000002d,  6}, {0x00000077,  7}, {0x00000078,  7},
+    {0x00000079,  7}, {0x0000007a,  7}, {0x0000007b,  7}, {0x00007ffe, 15},
+    {0x000007fc, 11}, {0x00003ffd, 14}, {0x00001ffd, 13}, {0x0ffffffc, 28},
+    {0x000fffe6, 20}, {0x003fffd2, 22}, {0x000fffe7, 20}, {0x000fffe8, 20},
+    {0x003fffd3, 22}, {0x003fffd4, 22}, {0x003fffd5, 22}, {0x007fffd9, 23},
+    {0x003fffd6, 22}, {0x007fffda, 23}, {0x007fffdb, 23}, {0x007fffdc, 23},
+    {0x007fffdd, 23}, {0x007fffde, 23}, {0x00ffffeb, 24}, {0x007fffdf, 23},
+    {0x00ffffec, 24}, {0x00ffffed, 24}, {0x003fffd7, 22}, {0x007fffe0, 23},
+    {0x00ffffee, 24}, {0x007fffe1, 23}, {0x007fffe2, 23}, {0x007fffe3, 23},
+    {0x007fffe4, 23}, {0x001fffdc, 21}, {0x003fffd8, 22}, {0x007fffe5, 23},
+    {0x003fffd9, 22}, {0x007fffe6, 23}, {0x007fffe7, 23}, {0x00ffffef, 24},
+    {0x003fffda, 22}, {0x001fffdd, 21}, {0x000fffe9, 20}, {0x003fffdb, 22},
+    {0x003fffdc, 22}, {0x007fffe8, 23}, {0x007fffe9, 23}, {0x001fffde, 21},
+    {0x007fffea, 23}, {0x003fffdd, 22}, {0x003fffde, 22}, {0x00fffff0, 24},
+    {0x001fffdf, 21}, {0x003fffdf, 22}, {0x007fffeb, 23}, {0x007fffec, 23},
+    {0x001fffe0, 21}, {0x001fffe1, 21}, {0x003fffe0, 22}, {0x001fffe2, 21},
+    {0x007fffed, 23}, {0x003fffe1, 22}, {0x007fffee, 23}, {0x007fffef, 23},
+    {0x000fffea, 20}, {0x003fffe2, 22}, {0x003fffe3, 22}, {0x003fffe4, 22},
+    {0x007ffff0, 23}, {0x003fffe5, 22}, {0x003fffe6, 22}, {0x007ffff1, 23},
+    {0x03ffffe0, 26}, {0x03ffffe1, 26}, {0x000fffeb, 20}, {0x0007fff1, 19},
+    {0x003fffe7, 22}, {0x007ffff2, 23}, {0x003fffe8, 22}, {0x01ffffec, 25},
+    {0x03ffffe2, 26}, {0x03ffffe3, 26}, {0x03ffffe4, 26}, {0x07ffffde, 27},
+    {0x07ffffdf, 27}, {0x03ffffe5, 26}, {0x00fffff1, 24}, {0x01ffffed, 25},
+    {0x0007fff2, 19}, {0x001fffe3, 21}, {0x03ffffe6, 26}, {0x07ffffe0, 27},
+    {0x07ffffe1, 27}, {0x03ffffe7, 26}, {0x07ffffe2, 27}, {0x00fffff2, 24},
+    {0x001fffe4, 21}, {0x001fffe5, 21}, {0x03ffffe8, 26}, {0x03ffffe9, 26},
+    {0x0ffffffd, 28}, {0x07ffffe3, 27}, {0x07ffffe4, 27}, {0x07ffffe5, 27},
+    {0x000fffec, 20}, {0x00fffff3, 24}, {0x000fffed, 20}, {0x001fffe6, 21},
+    {0x003fffe9, 22}, {0x001fffe7, 21}, {0x001fffe8, 21}, {0x007ffff3, 23},
+    {0x003fffea, 22}, {0x003fffeb, 22}, {0x01ffffee, 25}, {0x01ffffef, 25},
+    {0x00fffff4, 24}, {0x00fffff5, 24}, {0x03ffffea, 26}, {0x007ffff4, 23},
+    {0x03ffffeb, 26}, {0x07ffffe6, 27}, {0x03ffffec, 26}, {0x03ffffed, 26},
+    {0x07ffffe7, 27}, {0x07ffffe8, 27}, {0x07ffffe9, 27}, {0x07ffffea, 27},
+    {0x07ffffeb, 27}, {0x0ffffffe, 28}, {0x07ffffec, 27}, {0x07ffffed, 27},
+    {0x07ffffee, 27}, {0x07ffffef, 27}, {0x07fffff0, 27}, {0x03ffffee, 26},
+    {0x3fffffff, 30}
+};
+
+
+static char  *ngx_huff_bench_values[] = {
+    "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 "
+        "(KHTML, like Gecko) Chrome/120.0.0.0 Safari/537.36",
+    "text/html,application/xhtml+xml,application/xml;q=0.9,"
+        "image/avif,image/webp,*/*;q=0.8",
+    "gzip, deflate, br",
+    "en-US,en;q=0.9",
+    "www.example.com",
+    "/static/js/main.4f9c2a1b.chunk.js?v=20231114",
+    "https://www.example.com/search?q=nginx+huffman",
+    "session=eyJhbGciOiJIUzI1NiJ9.eyJzdWIiOiIxMjM0NTY3ODkwIn0; "
+        "_ga=GA1.2.1234567890.1699999999; theme=dark",
+    "Mon, 13 Nov 2023 10:22:31 GMT",
+    "\"5f3a2b1c-4d2e\"",
+    "max-age=31536000, immutable",
+    "application/json; charset=utf-8",
+    "same-origin",
+    "?0",
+    NULL
+};
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    ngx_bench_init();
+
+    if (ngx_huff_bench_build() != NGX_OK) {
+        return 1;
+    }
+
+    if (ngx_huff_bench_check() != NGX_OK) {
+        return 1;
+    }
+
+    ngx_huff_bench_run();
+
+    return 0;
+}
+
+
+/*
+ * the nibble transitions are built as in the previous decoder: the states
+ * are the inner nodes of the code tree, an invalid transition keeps the
+ * state, and the ending flag is set where the bits since the last symbol
+ * are all ones, a prefix of EOS
+ */
+
+static ngx_int_t
+ngx_huff_bench_build(void)
+{
+    ngx_int_t                 node, n;
+    ngx_uint_t                sym, i, bit, nodes, depth;
+    ngx_huff_bench_nibble_t  *t;
+
+    static ngx_int_t          tree[256][2];
+    static u_char             padding[256];
+
+    nodes = 1;
+
+    for (sym = 0; sym < 257; sym++) {
+        node = 0;
+
+        for (i = ngx_huff_bench_codes[sym].len; i > 1; i--) {
+            bit = (ngx_huff_bench_codes[sym].code >> (i - 1)) & 1;
+
+            if (tree[node][bit] == 0) {
+                if (nodes == 256) {
+                    printf("too many states\n");
+                    return NGX_ERROR;
+                }
+
+                tree[node][bit] = nodes++;
+            }
+
+            node = tree[node][bit];
+        }
+
+        tree[node][ngx_huff_bench_codes[sym].code & 1] = - (ngx_int_t) sym - 1;
+    }
+
+    for (node = 0; node >= 0; node = tree[node][1]) {
+        padding[node] = 1;
+    }
+
+    for (n = 0; n < 256; n++) {
+        for (i = 0; i < 16; i++) {
+            t = &ngx_huff_bench_nibbles[n][i];
+
+            t->next = (u_char) n;
+            t->emit = 0;
+            t->sym = 0;
+            t->ending = 0;
+
+            node = n;
+
+            for (depth = 4; depth; depth--) {
+                node = tree[node][(i >> (depth - 1)) & 1];
+
+                if (node >= 0) {
+                    continue;
+                }
+
+                if (node == -257) {
+                    break;
+                }
+
+                t->emit = 1;
+                t->sym = (u_char) (- node - 1);
+                node = 0;
+            }
+
+            if (depth) {
+                /* EOS */
+                t->emit = 0;
+                t->sym = 0;
+                continue;
+            }
+
+            if (node == n) {
+                printf("ambiguous transition from state %d\n", (int) n);
+                return NGX_ERROR;
+            }
+
+            t->next = (u_char) node;
+            t->ending = padding[node];
+        }
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_huff_bench_check(void)
+{
+    u_char      *src, *enc, *ref, *out1, *out2, *p1, *p2, st1, st2;
+    size_t       len, elen, rlen, hlen, pos, part;
+    ngx_int_t    rc1, rc2;
+    ngx_uint_t   i, n, lower, rejected;
+
+    src = ngx_alloc(NGX_HUFF_BENCH_LEN, ngx_bench_log);
+    enc = ngx_alloc(NGX_HUFF_BENCH_LEN, ngx_bench_log);
+    ref = ngx_alloc(NGX_HUFF_BENCH_LEN * 4, ngx_bench_log);
+    out1 = ngx_alloc(NGX_HUFF_BENCH_LEN * 8, ngx_bench_log);
+    out2 = ngx_alloc(NGX_HUFF_BENCH_LEN * 8, ngx_bench_log);
+
+    if (src == NULL || enc == NULL || ref == NULL
+        || out1 == NULL || out2 == NULL)
+    {
+        return NGX_ERROR;
+    }
+
+    rejected = 0;
+
+    for (i = 0; i < NGX_HUFF_BENCH_CHECKS; i++) {
+
+        len = ngx_random() % NGX_HUFF_BENCH_LEN;
+
+        for (n = 0; n < len; n++) {
+            src[n] = (i & 1) ? (u_char) (0x20 + ngx_random() % 0x5f)
+                             : (u_char) ngx_random();
+        }
+
+        lower = ngx_random() & 1;
+
+        /* the encoders return 0 if the result is not shorter */
+
+        hlen = ngx_http_huff_encode(src, len, enc, lower);
+        elen = ngx_huff_bench_encode_bytes(src, len, ref, lower);
+
+        rlen = (elen < len) ? elen : 0;
+
+        if (hlen != rlen || ngx_memcmp(enc, ref, hlen) != 0) {
+            printf("encoders differ at iteration %lu\n", (unsigned long) i);
+            return NGX_ERROR;
+        }
+
+        switch (ngx_random() % 4) {
+
+        case 0:
+            for (n = ngx_random() % 3; elen && n < 3; n++) {
+                ref[ngx_random() % elen] ^= (u_char) (1 << ngx_random() % 8);
+            }
+
+            break;
+
+        case 1:
+            elen = ngx_random() % (elen + 1);
+            break;
+
+        case 2:
+            for (n = 0; n < elen; n++) {
+                ref[n] = (u_char) ngx_random();
+            }
+
+            break;
+
+        default:
+            break;
+        }
+
+        st1 = 0;
+        p1 = out1;
+
+        rc1 = ngx_huff_bench_decode_nibbles(&st1, ref, elen, &p1, 1);
+
+        /*
+         * the last part is not empty: an empty last part is accepted
+         * in any state by both decoders
+         */
+
+        st2 = 0;
+        p2 = out2;
+        pos = 0;
+
+        do {
+            part = elen - pos;
+
+            if (part > 1) {
+                part = 1 + ngx_random() % part;
+            }
+
+            rc2 = ngx_http_huff_decode(&st2, ref + pos, part, &p2,
+                                       pos + part == elen, ngx_bench_log);
+            pos += part;
+
+        } while (rc2 == NGX_OK && pos < elen);
+
+        if (rc1 != rc2
+            || p1 - out1 != p2 - out2
+            || ngx_memcmp(out1, out2, p1 - out1) != 0)
+        {
+            printf("decoders differ at iteration %lu\n", (unsigned long) i);
+            return NGX_ERROR;
+        }
+
+        if (rc1 != NGX_OK) {
+            rejected++;
+        }
+    }
+
+    printf("%lu inputs, %lu rejected, no differences\n",
+           (unsigned long) i, (unsigned long) rejected);
+
+    ngx_free(src);
+    ngx_free(enc);
+    ngx_free(ref);
+    ngx_free(out1);
+    ngx_free(out2);
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_huff_bench_run(void)
+{
+    u_char      *src[32], *enc[32], out[NGX_HUFF_BENCH_LEN * 8], *p, st;
+    size_t       len[32], elen[32];
+    uint64_t     start;
+    ngx_uint_t   i, n, nvalues;
+
+    for (n = 0; ngx_huff_bench_values[n]; n++) {
+        src[n] = (u_char *) ngx_huff_bench_values[n];
+        len[n] = ngx_strlen(src[n]);
+
+        enc[n] = ngx_alloc(len[n] * 4, ngx_bench_log);
+        if (enc[n] == NULL) {
+            exit(1);
+        }
+
+        elen[n] = ngx_huff_bench_encode_bytes(src[n], len[n], enc[n], 0);
+    }
+
+    nvalues = n;
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_HUFF_BENCH_LOOPS; i++) {
+        n = i % nvalues;
+
+        st = 0;
+        p = out;
+
+        (void) ngx_huff_bench_decode_nibbles(&st, enc[n], elen[n], &p, 1);
+
+        ngx_huff_bench_sink += p - out;
+    }
+
+    ngx_bench_report("decode, nibble transitions", NGX_HUFF_BENCH_LOOPS,
+                     ngx_bench_nsec() - start);
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_HUFF_BENCH_LOOPS; i++) {
+        n = i % nvalues;
+
+        st = 0;
+        p = out;
+
+        (void) ngx_http_huff_decode(&st, enc[n], elen[n], &p, 1,
+                                    ngx_bench_log);
+
+        ngx_huff_bench_sink += p - out;
+    }
+
+    ngx_bench_report("decode, byte transitions", NGX_HUFF_BENCH_LOOPS,
+                     ngx_bench_nsec() - start);
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_HUFF_BENCH_LOOPS; i++) {
+        n = i % nvalues;
+
+        ngx_huff_bench_sink += ngx_huff_bench_encode_bytes(src[n], len[n],
+                                                           out, 0);
+    }
+
+    ngx_bench_report("encode, a byte at a time", NGX_HUFF_BENCH_LOOPS,
+                     ngx_bench_nsec() - start);
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_HUFF_BENCH_LOOPS; i++) {
+        n = i % nvalues;
+
+        ngx_huff_bench_sink += ngx_http_huff_encode(src[n], len[n], out, 0);
+    }
+
+    ngx_bench_report("encode, a word at a time", NGX_HUFF_BENCH_LOOPS,
+                     ngx_bench_nsec() - start);
+
+    for (n = 0; n < nvalues; n++) {
+        ngx_free(enc[n]);
+    }
+}
+
+
+/* the previous ngx_http_huff_decode() */
+
+static ngx_int_t
+ngx_huff_bench_decode_nibbles(u_char *state, u_char *src, size_t len,
+    u_char **dst, ngx_uint_t last)
+{
+    u_char  *end, ch, ending;
+
+    ch = 0;
+    ending = 1;
+
+    end = src + len;
+
+    while (src != end) {
+        ch = *src++;
+
+        if (ngx_huff_bench_decode_bits(state, &ending, ch >> 4, dst)
+            != NGX_OK)
+        {
+            return NGX_ERROR;
+        }
+
+        if (ngx_huff_bench_decode_bits(state, &ending, ch & 0xf, dst)
+            != NGX_OK)
+        {
+            return NGX_ERROR;
+        }
+    }
+
+    if (last) {
+        if (!ending) {
+            return NGX_ERROR;
+        }
+
+        *state = 0;
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_inline ngx_int_t
+ngx_huff_bench_decode_bits(u_char *state, u_char *ending, ngx_uint_t bits,
+    u_char **dst)
+{
+    ngx_huff_bench_nibble_t  code;
+
+    code = ngx_huff_bench_nibbles[*state][bits];
+
+    if (code.next == *state) {
+        return NGX_ERROR;
+    }
+
+    if (code.emit) {
+        *(*dst)++ = code.sym;
+    }
+
+    *ending = code.ending;
+    *state = code.next;
+
+    return NGX_OK;
+}
+
+
+static size_t
+ngx_huff_bench_encode_bytes(u_char *src, size_t len, u_char *dst,
+    ngx_uint_t lower)
+{
+    u_char                 *end, ch;
+    size_t                  hlen;
+    uint64_t                buf;
+    ngx_uint_t              pending;
+    ngx_huff_bench_code_t  *code;
+
+    hlen = 0;
+    buf = 0;
+    pending = 0;
+
+    end = src + len;
+
+    while (src != end) {
+        ch = *src++;
+
+        if (lower) {
+            ch = ngx_tolower(ch);
+        }
+
+        code = &ngx_huff_bench_codes[ch];
+
+        buf = (buf << code->len) | code->code;
+        pending += code->len;
+
+        while (pending >= 8) {
+            pending -= 8;
+            dst[hlen++] = (u_char) (buf >> pending);
+        }
+    }
+
+    if (pending) {
+        dst[hlen++] = (u_char) ((buf << (8 - pending)) | (0xff >> pending));
+    }
+
+    return hlen;
+}
@@ -0,0 +1,248 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * Measures the memory held by idle keepalive connections of a running
+ * nginx with a single worker process, for example:
+ *
+ *     worker_processes 1;
+ *     worker_memory_accounting on;
+ *     events { worker_connections 20000; }
+ *     http {
+ *         keepalive_timeout 600s;
+ *         keepalive_compact on;
+ *         server {
+ *             listen 127.0.0.1:8080;
+ *             location / { root html; }
+ *             location = /memory { memory_status; }
+ *         }
+ *     }
+ *
+ *     ngx_idle_bench 127.0.0.1 8080 /index.html /memory 10000
+ *
+ * Each connection makes a request and stays idle; the "connection" pools
+ * and the private memory of the worker reported by memory_status before
+ * and after are divided by the number of connections.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include "ngx_bench.h"
+
+
+#define NGX_IDLE_BENCH_BUF  65536
+
+
+typedef struct {
+    unsigned long  pools;
+    size_t         size;
+    size_t         private;
+} ngx_idle_bench_memory_t;
+
+
+static ngx_socket_t ngx_idle_bench_request(struct sockaddr_in *sin,
+    char *uri, char *connection, u_char *buf);
+static ngx_int_t ngx_idle_bench_memory(struct sockaddr_in *sin, char *uri,
+    ngx_idle_bench_memory_t *m);
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    ngx_int_t                 port, n;
+    ngx_uint_t                i;
+    struct sockaddr_in        sin;
+    ngx_idle_bench_memory_t   before, after;
+    static u_char             buf[NGX_IDLE_BENCH_BUF];
+
+    if (argc != 6) {
+        printf("usage: ngx_idle_bench address port uri status_uri number\n");
+        return 1;
+    }
+
+    ngx_bench_init();
+
+    port = ngx_atoi((u_char *) argv[2], ngx_strlen(argv[2]));
+    n = ngx_atoi((u_char *) argv[5], ngx_strlen(argv[5]));
+
+    ngx_memzero(&sin, sizeof(struct sockaddr_in));
+    sin.sin_family = AF_INET;
+    sin.sin_addr.s_addr = ngx_inet_addr((u_char *) argv[1],
+                                        ngx_strlen(argv[1]));
+    sin.sin_port = htons((in_port_t) port);
+
+    if (port == NGX_ERROR || n == NGX_ERROR || n == 0
+        || sin.sin_addr.s_addr == INADDR_NONE)
+    {
+        printf("invalid arguments\n");
+        return 1;
+    }
+
+    if (ngx_idle_bench_memory(&sin, argv[4], &before) != NGX_OK) {
+        return 1;
+    }
+
+    for (i = 0; i < (ngx_uint_t) n; i++) {
+        if (ngx_idle_bench_request(&sin, argv[3], "keep-alive", buf)
+            == (ngx_socket_t) -1)
+        {
+            return 1;
+        }
+    }
+
+    /* let the worker process the last requests */
+
+    ngx_msleep(500);
+
+    if (ngx_idle_bench_memory(&sin, argv[4], &after) != NGX_OK) {
+        return 1;
+    }
+
+    printf("idle connections %10lu\n", (unsigned long) n);
+    printf("connection pools %10lu\n", after.pools - before.pools);
+    printf("pool bytes       %10.1f per connection\n",
+           ((double) after.size - before.size) / n);
+    printf("private memory   %10.1f per connection\n",
+           ((double) after.private - before.private) / n);
+
+    /* the connections are closed on exit */
+
+    return 0;
+}
+
+
+static ngx_socket_t
+ngx_idle_bench_request(struct sockaddr_in *sin, char *uri, char *connection,
+    u_char *buf)
+{
+    u_char        *p, *last, *body;
+    ssize_t        n;
+    ngx_int_t      length;
+    ngx_socket_t   s;
+
+    s = ngx_socket(AF_INET, SOCK_STREAM, 0);
+
+    if (s == (ngx_socket_t) -1) {
+        perror("socket()");
+        return s;
+    }
+
+    if (connect(s, (struct sockaddr *) sin, sizeof(struct sockaddr_in))
+        == -1)
+    {
+        perror("connect()");
+        goto failed;
+    }
+
+    p = ngx_snprintf(buf, NGX_IDLE_BENCH_BUF,
+                     "GET %s HTTP/1.1" CRLF
+                     "Host: localhost" CRLF
+                     "Connection: %s" CRLF CRLF,
+                     uri, connection);
+
+    if (send(s, buf, p - buf, 0) != p - buf) {
+        perror("send()");
+        goto failed;
+    }
+
+    /* the response is read up to its Content-Length */
+
+    last = buf;
+    body = NULL;
+    length = 0;
+
+    for ( ;; ) {
+        n = recv(s, last, buf + NGX_IDLE_BENCH_BUF - 1 - last, 0);
+
+        if (n <= 0) {
+            if (body && ngx_strcmp(connection, "close") == 0) {
+                break;
+            }
+
+            printf("incomplete response\n");
+            goto failed;
+        }
+
+        last += n;
+        *last = '\0';
+
+        if (body == NULL) {
+            p = (u_char *) ngx_strstr(buf, CRLF CRLF);
+
+            if (p == NULL) {
+                continue;
+            }
+
+            body = p + 4;
+
+            p = (u_char *) ngx_strcasestrn(buf, "Content-Length: ",
+                                           sizeof("Content-Length: ") - 2);
+
+            if (p && p < body) {
+                length = atoi((char *) p + sizeof("Content-Length: ") - 1);
+
+            } else {
+                length = -1;
+            }
+        }
+
+        if (length >= 0 && last - body >= length) {
+            break;
+        }
+    }
+
+    return s;
+
+failed:
+
+    (void) ngx_close_socket(s);
+
+    return (ngx_socket_t) -1;
+}
+
+
+static ngx_int_t
+ngx_idle_bench_memory(struct sockaddr_in *sin, char *uri,
+    ngx_idle_bench_memory_t *m)
+{
+    u_char          *p;
+    ngx_socket_t     s;
+    static u_char    buf[NGX_IDLE_BENCH_BUF];
+
+    s = ngx_idle_bench_request(sin, uri, "close", buf);
+
+    if (s == (ngx_socket_t) -1) {
+        return NGX_ERROR;
+    }
+
+    (void) ngx_close_socket(s);
+
+    ngx_memzero(m, sizeof(ngx_idle_bench_memory_t));
+
+    p = (u_char *) ngx_strstr(buf, "\n connection ");
+
+    if (p == NULL) {
+        printf("no \"connection\" pools in memory_status, "
+               "is worker_memory_accounting enabled?\n");
+        return NGX_ERROR;
+    }
+
+    if (sscanf((char *) p, " connection %lu %zu", &m->pools, &m->size) != 2) {
+        printf("invalid memory_status response\n");
+        return NGX_ERROR;
+    }
+
+    p = (u_char *) ngx_strstr(buf, "\nMemory: ");
+
+    if (p && sscanf((char *) p, " Memory: shared %*u private %zu",
+                    &m->private) != 1)
+    {
+        m->private = 0;
+    }
+
+    return NGX_OK;
+}
@@ -0,0 +1,148 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * Compares request pools with the fixed default size of 4096 bytes and
+ * "auto" sizes, with and without the per-process block cache
+ * ("worker_pool_cache"), on a synthetic request workload.
+ *
+ * Each request creates a pool, makes 32 allocations of 16 to 512 bytes,
+ * as used for the request structure, headers and variables, and two
+ * allocations of 1 to 8 kilobytes, as used for buffers, and destroys
+ * the pool.  The cost and the number of memory blocks per request
+ * are reported.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include "ngx_bench.h"
+
+
+#define NGX_POOL_BENCH_REQUESTS  1000000
+#define NGX_POOL_BENCH_SMALL     32
+#define NGX_POOL_BENCH_LARGE     2
+#define NGX_POOL_BENCH_ALLOCS                                                 \
+    (NGX_POOL_BENCH_SMALL + NGX_POOL_BENCH_LARGE)
+#define NGX_POOL_BENCH_PATTERNS  1024
+
+
+static void ngx_pool_bench_run(ngx_uint_t adapt, size_t cache);
+static ngx_uint_t ngx_pool_bench_blocks(ngx_pool_t *pool);
+
+
+static size_t  ngx_pool_bench_sizes[NGX_POOL_BENCH_PATTERNS]
+                                   [NGX_POOL_BENCH_ALLOCS];
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    ngx_uint_t  i, k;
+
+    ngx_bench_init();
+
+    for (i = 0; i < NGX_POOL_BENCH_PATTERNS; i++) {
+        for (k = 0; k < NGX_POOL_BENCH_SMALL; k++) {
+            ngx_pool_bench_sizes[i][k] = 16 + ngx_random() % 497;
+        }
+
+        for ( /* void */ ; k < NGX_POOL_BENCH_ALLOCS; k++) {
+            ngx_pool_bench_sizes[i][k] = 1024 + ngx_random() % 7169;
+        }
+    }
+
+    ngx_pool_bench_run(0, 0);
+    ngx_pool_bench_run(1, 0);
+    ngx_pool_bench_run(0, 1024 * 1024);
+    ngx_pool_bench_run(1, 1024 * 1024);
+
+    return 0;
+}
+
+
+static void
+ngx_pool_bench_run(ngx_uint_t adapt, size_t cache)
+{
+    u_char            name[64];
+    size_t           *sizes;
+    uint64_t          start;
+    ngx_uint_t        i, k, blocks;
+    ngx_pool_t       *pool;
+    ngx_pool_adapt_t  pa;
+
+    /* release the blocks cached by the previous run */
+
+    ngx_pool_cache_trim();
+    ngx_pool_cache_trim();
+
+    ngx_pool_cache_init(cache);
+
+    pa.size = 4096;
+    pa.usage = 0;
+
+    blocks = 0;
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < NGX_POOL_BENCH_REQUESTS; i++) {
+
+        pool = ngx_create_pool(pa.size, ngx_bench_log);
+        if (pool == NULL) {
+            exit(1);
+        }
+
+        sizes = ngx_pool_bench_sizes[i % NGX_POOL_BENCH_PATTERNS];
+
+        for (k = 0; k < NGX_POOL_BENCH_ALLOCS; k++) {
+            if (ngx_palloc(pool, sizes[k]) == NULL) {
+                exit(1);
+            }
+        }
+
+        if ((i & 1023) == 0) {
+            blocks += ngx_pool_bench_blocks(pool);
+        }
+
+        if (adapt) {
+            ngx_pool_adapt(&pa, pool);
+        }
+
+        ngx_destroy_pool(pool);
+    }
+
+    ngx_sprintf(name, "pool %s, %s%Z", adapt ? "auto" : "4096",
+                cache ? "cache" : "no cache");
+    ngx_bench_report((char *) name, NGX_POOL_BENCH_REQUESTS,
+                     ngx_bench_nsec() - start);
+
+    printf("%-40s %10.1f blocks/request, last pool size %lu\n", name,
+           (double) blocks / ((NGX_POOL_BENCH_REQUESTS + 1023) / 1024),
+           (unsigned long) pa.size);
+}
+
+
+static ngx_uint_t
+ngx_pool_bench_blocks(ngx_pool_t *pool)
+{
+    ngx_uint_t         n;
+    ngx_pool_t        *p;
+    ngx_pool_large_t  *l;
+
+    n = 0;
+
+    for (p = pool; p; p = p->d.next) {
+        n++;
+    }
+
+    for (l = pool->large; l; l = l->next) {
+        if (l->alloc) {
+            n++;
+        }
+    }
+
+    return n;
+}
@@ -0,0 +1,237 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * Compares matching of a URI against a set of anchored regexes, like regex
+ * locations, one by one and with combined regexes, as built and run by
+ * ngx_http_regex_set_create() and ngx_http_regex_set_exec(): the patterns
+ * are combined in runs of up to NGX_REGEX_COMBINE_MAX, and the regex which
+ * matched is then run on its own to set captures.
+ *
+ * The sets are of 10, 100 and 300 patterns, a third of them caseless and
+ * some with named captures.  The URIs miss all patterns, match the first
+ * one, and match the last one.  The regexes are run without JIT, as with
+ * the default "pcre_jit off".
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include "ngx_bench.h"
+
+
+#if !(NGX_PCRE2)
+#error the benchmark requires PCRE2
+#endif
+
+
+#define NGX_REGEX_SET_BENCH_LOOPS  200000
+#define NGX_REGEX_SET_BENCH_MAX    300
+
+
+static ngx_int_t ngx_regex_set_bench_build(ngx_pool_t *pool, ngx_uint_t n);
+static ngx_uint_t ngx_regex_set_bench_linear(ngx_uint_t n, ngx_str_t *uri);
+static ngx_uint_t ngx_regex_set_bench_combined(ngx_uint_t n, ngx_str_t *uri);
+
+
+static char  *ngx_regex_set_bench_patterns[] = {
+    "^/api/v%ui/users/(\\d+)/orders/(?<order>\\d+)$",
+    "^/static%ui/.+\\.(css|js|woff2)$",
+    "^/(?:en|de|fr)/catalog%ui/[a-z0-9-]+$"
+};
+
+static char  *ngx_regex_set_bench_uris[] = {
+    "/api/v%ui/users/1/orders/2",
+    "/static%ui/css/site.min.css",
+    "/DE/Catalog%ui/running-shoes"
+};
+
+
+static ngx_regex_compile_t  ngx_regex_set_bench_rcs[NGX_REGEX_SET_BENCH_MAX];
+static ngx_regex_t         *ngx_regex_set_bench_runs[NGX_REGEX_SET_BENCH_MAX];
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    u_char              name[64], buf[128];
+    uint64_t            start;
+    ngx_str_t           uri;
+    ngx_uint_t          i, k, n, t, expect, combined;
+    ngx_cycle_t         cycle;
+    ngx_pool_t         *pool;
+    static ngx_uint_t   sets[] = { 10, 100, NGX_REGEX_SET_BENCH_MAX };
+    static char        *tests[] = { "miss", "first", "last" };
+
+    ngx_bench_init();
+
+    /* pcre2_match() allocates memory with ngx_cycle->log */
+
+    ngx_memzero(&cycle, sizeof(ngx_cycle_t));
+    cycle.log = ngx_bench_log;
+    ngx_cycle = &cycle;
+
+    pool = ngx_create_pool(16384, ngx_bench_log);
+    if (pool == NULL) {
+        return 1;
+    }
+
+    for (i = 0; i < sizeof(sets) / sizeof(sets[0]); i++) {
+        n = sets[i];
+
+        if (ngx_regex_set_bench_build(pool, n) != NGX_OK) {
+            return 1;
+        }
+
+        for (t = 0; t < 3; t++) {
+
+            /* the last pattern is caseless for 10 and 100 patterns */
+
+            expect = (t == 0) ? n : (t == 1) ? 0 : n - 1;
+
+            uri.data = buf;
+
+            if (t == 0) {
+                uri.len = ngx_sprintf(buf, "/blog/2024/05/tuning-the-loop")
+                          - buf;
+
+            } else {
+                uri.len = ngx_sprintf(buf, ngx_regex_set_bench_uris[expect % 3],
+                                      expect)
+                          - buf;
+            }
+
+            for (combined = 0; combined < 2; combined++) {
+
+                start = ngx_bench_nsec();
+
+                for (k = 0; k < NGX_REGEX_SET_BENCH_LOOPS; k++) {
+                    if ((combined ? ngx_regex_set_bench_combined(n, &uri)
+                                  : ngx_regex_set_bench_linear(n, &uri))
+                        != expect)
+                    {
+                        printf("%s: no expected match for \"%.*s\"\n",
+                               combined ? "combined" : "linear",
+                               (int) uri.len, uri.data);
+                        return 1;
+                    }
+                }
+
+                ngx_sprintf(name, "%ui patterns, %s, %s%Z", n, tests[t],
+                            combined ? "combined" : "linear");
+
+                ngx_bench_report((char *) name, NGX_REGEX_SET_BENCH_LOOPS,
+                                 ngx_bench_nsec() - start);
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+static ngx_int_t
+ngx_regex_set_bench_build(ngx_pool_t *pool, ngx_uint_t n)
+{
+    u_char               *p, errstr[NGX_MAX_CONF_ERRSTR];
+    ngx_uint_t            i, k;
+    ngx_regex_compile_t  *rc, combined;
+
+    for (i = 0; i < n; i++) {
+        rc = &ngx_regex_set_bench_rcs[i];
+
+        ngx_memzero(rc, sizeof(ngx_regex_compile_t));
+
+        p = ngx_pnalloc(pool, 128);
+        if (p == NULL) {
+            return NGX_ERROR;
+        }
+
+        rc->pattern.data = p;
+        rc->pattern.len = ngx_sprintf(p, ngx_regex_set_bench_patterns[i % 3],
+                                      i)
+                          - p;
+        rc->options = (i % 3 == 2) ? NGX_REGEX_CASELESS : 0;
+        rc->pool = pool;
+        rc->err.len = NGX_MAX_CONF_ERRSTR;
+        rc->err.data = errstr;
+
+        if (ngx_regex_compile(rc) != NGX_OK || !ngx_regex_combinable(rc)) {
+            printf("%.*s\n", (int) rc->err.len, rc->err.data);
+            return NGX_ERROR;
+        }
+    }
+
+    for (i = 0; i < n; i += NGX_REGEX_COMBINE_MAX) {
+        k = ngx_min(n - i, NGX_REGEX_COMBINE_MAX);
+
+        ngx_memzero(&combined, sizeof(ngx_regex_compile_t));
+
+        combined.pool = pool;
+        combined.err.len = NGX_MAX_CONF_ERRSTR;
+        combined.err.data = errstr;
+
+        if (ngx_regex_combine(&combined, &ngx_regex_set_bench_rcs[i], k)
+            != NGX_OK)
+        {
+            printf("%.*s\n", (int) combined.err.len, combined.err.data);
+            return NGX_ERROR;
+        }
+
+        ngx_regex_set_bench_runs[i / NGX_REGEX_COMBINE_MAX] = combined.regex;
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_uint_t
+ngx_regex_set_bench_linear(ngx_uint_t n, ngx_str_t *uri)
+{
+    int         captures[30];
+    ngx_uint_t  i;
+
+    for (i = 0; i < n; i++) {
+        if (ngx_regex_exec(ngx_regex_set_bench_rcs[i].regex, uri, captures, 30)
+            != NGX_REGEX_NO_MATCHED)
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+
+static ngx_uint_t
+ngx_regex_set_bench_combined(ngx_uint_t n, ngx_str_t *uri)
+{
+    int         captures[30];
+    ngx_int_t   rc;
+    ngx_uint_t  i;
+
+    for (i = 0; i < n; i += NGX_REGEX_COMBINE_MAX) {
+        rc = ngx_regex_exec_combined(
+                          ngx_regex_set_bench_runs[i / NGX_REGEX_COMBINE_MAX],
+                          uri);
+
+        if (rc == NGX_REGEX_NO_MATCHED) {
+            continue;
+        }
+
+        if (rc < 0
+            || ngx_regex_exec(ngx_regex_set_bench_rcs[i + rc].regex, uri,
+                              captures, 30)
+               < 0)
+        {
+            return NGX_ERROR;
+        }
+
+        return i + rc;
+    }
+
+    return n;
+}
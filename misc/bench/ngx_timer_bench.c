@@ -0,0 +1,150 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+/*
+ * Compares the rbtree and the timer wheel ("timer_wheel on") with
+ * 10k, 100k and 1M timers:
+ *
+ *     add      - timers with random timeouts up to 60s are added;
+ *     rearm    - each timer is moved to a new random timeout, as done
+ *                by keepalive and proxy read timers;
+ *     find     - ngx_event_find_timer() with all timers set;
+ *     expire   - the time advances by 1ms steps until all timers expire,
+ *                the cost is reported per expired timer and per step.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_event.h>
+#include "ngx_bench.h"
+
+
+#define NGX_TIMER_BENCH_MAX  60000
+
+
+static void ngx_timer_bench_run(ngx_uint_t wheel, ngx_uint_t n);
+static void ngx_timer_bench_handler(ngx_event_t *ev);
+
+
+static ngx_uint_t  ngx_timer_bench_expired;
+
+
+int ngx_cdecl
+main(int argc, char *const *argv)
+{
+    ngx_uint_t  n;
+
+    ngx_bench_init();
+
+    for (n = 10000; n <= 1000000; n *= 10) {
+        ngx_timer_bench_run(0, n);
+        ngx_timer_bench_run(1, n);
+    }
+
+    return 0;
+}
+
+
+static void
+ngx_timer_bench_run(ngx_uint_t wheel, ngx_uint_t n)
+{
+    u_char             name[64];
+    uint64_t           start, nsec;
+    ngx_uint_t         i, ticks;
+    ngx_msec_t        *timers;
+    ngx_event_t       *ev;
+    ngx_connection_t   c;
+
+    ngx_event_timer_wheel = wheel;
+    ngx_current_msec = 1000;
+
+    if (ngx_event_timer_init(ngx_bench_log) != NGX_OK) {
+        exit(1);
+    }
+
+    ev = ngx_calloc(n * sizeof(ngx_event_t), ngx_bench_log);
+    timers = ngx_alloc(2 * n * sizeof(ngx_msec_t), ngx_bench_log);
+
+    if (ev == NULL || timers == NULL) {
+        exit(1);
+    }
+
+    ngx_memzero(&c, sizeof(ngx_connection_t));
+    c.fd = -1;
+
+    for (i = 0; i < n; i++) {
+        timers[i] = 1 + ngx_random() % NGX_TIMER_BENCH_MAX;
+
+        /* the new timeout is never within the lazy delay of the old one */
+
+        timers[n + i] = timers[i] + NGX_TIMER_LAZY_DELAY
+                        + ngx_random() % NGX_TIMER_BENCH_MAX;
+    }
+
+    for (i = 0; i < n; i++) {
+        ev[i].data = &c;
+        ev[i].log = ngx_bench_log;
+        ev[i].handler = ngx_timer_bench_handler;
+    }
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < n; i++) {
+        ngx_add_timer(&ev[i], timers[i]);
+    }
+
+    ngx_sprintf(name, "%s %ui add%Z", wheel ? "wheel" : "rbtree", n);
+    ngx_bench_report((char *) name, n, ngx_bench_nsec() - start);
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < n; i++) {
+        ngx_add_timer(&ev[i], timers[n + i]);
+    }
+
+    ngx_sprintf(name, "%s %ui rearm%Z", wheel ? "wheel" : "rbtree", n);
+    ngx_bench_report((char *) name, n, ngx_bench_nsec() - start);
+
+    start = ngx_bench_nsec();
+
+    for (i = 0; i < 1000000; i++) {
+        (void) ngx_event_find_timer();
+    }
+
+    ngx_sprintf(name, "%s %ui find%Z", wheel ? "wheel" : "rbtree", n);
+    ngx_bench_report((char *) name, 1000000, ngx_bench_nsec() - start);
+
+    ngx_timer_bench_expired = 0;
+    ticks = 0;
+
+    start = ngx_bench_nsec();
+
+    while (ngx_timer_bench_expired < n) {
+        ngx_current_msec++;
+        ngx_event_expire_timers();
+        ticks++;
+    }
+
+    nsec = ngx_bench_nsec() - start;
+
+    ngx_sprintf(name, "%s %ui expire%Z", wheel ? "wheel" : "rbtree", n);
+    ngx_bench_report((char *) name, n, nsec);
+
+    ngx_sprintf(name, "%s %ui expire, per 1ms tick%Z",
+                wheel ? "wheel" : "rbtree", n);
+    ngx_bench_report((char *) name, ticks, nsec);
+
+    ngx_free(timers);
+    ngx_free(ev);
+}
+
+
+static void
+ngx_timer_bench_handler(ngx_event_t *ev)
+{
+    ngx_timer_bench_expired++;
+}
@@ -24,6 +24,7 @@ static char *ngx_set_env(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
 static char *ngx_set_priority(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
 static char *ngx_set_cpu_affinity(ngx_conf_t *cf, ngx_command_t *cmd,
     void *conf);
+static char *ngx_set_numa(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
 static char *ngx_set_worker_processes(ngx_conf_t *cf, ngx_command_t *cmd,
     void *conf);
 static char *ngx_load_module(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
@@ -125,6 +126,48 @@ static ngx_command_t  ngx_core_commands[] = {
       offsetof(ngx_core_conf_t, rlimit_core),
       NULL },
 
+    { ngx_string("worker_pool_cache"),
+      NGX_MAIN_CONF|NGX_DIRECT_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_size_slot,
+      0,
+      offsetof(ngx_core_conf_t, pool_cache),
+      NULL },
+
+    { ngx_string("worker_hugepages"),
+      NGX_MAIN_CONF|NGX_DIRECT_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      0,
+      offsetof(ngx_core_conf_t, hugepages),
+      NULL },
+
+    { ngx_string("worker_slab_cache"),
+      NGX_MAIN_CONF|NGX_DIRECT_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_num_slot,
+      0,
+      offsetof(ngx_core_conf_t, slab_cache),
+      NULL },
+
+    { ngx_string("worker_memory_accounting"),
+      NGX_MAIN_CONF|NGX_DIRECT_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      0,
+      offsetof(ngx_core_conf_t, memory_accounting),
+      NULL },
+
+    { ngx_string("worker_slab_compaction"),
+      NGX_MAIN_CONF|NGX_DIRECT_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_msec_slot,
+      0,
+      offsetof(ngx_core_conf_t, slab_compaction),
+      NULL },
+
+    { ngx_string("worker_numa"),
+      NGX_MAIN_CONF|NGX_DIRECT_CONF|NGX_CONF_TAKE12,
+      ngx_set_numa,
+      0,
+      0,
+      NULL },
+
     { ngx_string("worker_shutdown_timeout"),
       NGX_MAIN_CONF|NGX_DIRECT_CONF|NGX_CONF_TAKE1,
       ngx_conf_set_msec_slot,
@@ -409,7 +452,8 @@ ngx_show_version_info(void)
             "  -q            : suppress non-error messages "
                                "during configuration testing" NGX_LINEFEED
             "  -s signal     : send signal to a master process: "
-                               "stop, quit, reopen, reload" NGX_LINEFEED
+                               "stop, quit, reopen, reload, memory"
+                               NGX_LINEFEED
 #ifdef NGX_PREFIX
             "  -p prefix     : set prefix path (default: " NGX_PREFIX ")"
                                NGX_LINEFEED
@@ -920,7 +964,8 @@ ngx_get_options(int argc, char *const *argv)
                 if (ngx_strcmp(ngx_signal, "stop") == 0
                     || ngx_strcmp(ngx_signal, "quit") == 0
                     || ngx_strcmp(ngx_signal, "reopen") == 0
-                    || ngx_strcmp(ngx_signal, "reload") == 0)
+                    || ngx_strcmp(ngx_signal, "reload") == 0
+                    || ngx_strcmp(ngx_signal, "memory") == 0)
                 {
                     ngx_process = NGX_PROCESS_SIGNALLER;
                     goto next;
@@ -1109,6 +1154,7 @@ ngx_core_module_create_conf(ngx_cycle_t *cycle)
      *     ccf->cpu_affinity_auto = 0;
      *     ccf->cpu_affinity_n = 0;
      *     ccf->cpu_affinity = NULL;
+     *     ccf->numa_interleave = 0;
      */
 
     ccf->daemon = NGX_CONF_UNSET;
@@ -1122,6 +1168,13 @@ ngx_core_module_create_conf(ngx_cycle_t *cycle)
     ccf->rlimit_nofile = NGX_CONF_UNSET;
     ccf->rlimit_core = NGX_CONF_UNSET;
 
+    ccf->pool_cache = NGX_CONF_UNSET_SIZE;
+    ccf->slab_cache = NGX_CONF_UNSET;
+    ccf->hugepages = NGX_CONF_UNSET;
+    ccf->memory_accounting = NGX_CONF_UNSET;
+    ccf->slab_compaction = NGX_CONF_UNSET_MSEC;
+    ccf->numa = NGX_CONF_UNSET;
+
     ccf->user = (ngx_uid_t) NGX_CONF_UNSET_UINT;
     ccf->group = (ngx_gid_t) NGX_CONF_UNSET_UINT;
 
@@ -1147,6 +1200,12 @@ ngx_core_module_init_conf(ngx_cycle_t *cycle, void *conf)
 
     ngx_conf_init_value(ccf->worker_processes, 1);
     ngx_conf_init_value(ccf->debug_points, 0);
+    ngx_conf_init_size_value(ccf->pool_cache, 0);
+    ngx_conf_init_value(ccf->slab_cache, 0);
+    ngx_conf_init_value(ccf->hugepages, 0);
+    ngx_conf_init_value(ccf->memory_accounting, 0);
+    ngx_conf_init_msec_value(ccf->slab_compaction, 0);
+    ngx_conf_init_value(ccf->numa, 0);
 
 #if (NGX_HAVE_CPU_AFFINITY)
 
@@ -1549,6 +1608,58 @@ ngx_get_cpu_affinity(ngx_uint_t n)
 }
 
 
+static char *
+ngx_set_numa(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    ngx_core_conf_t  *ccf = conf;
+
+    ngx_str_t  *value;
+
+    if (ccf->numa != NGX_CONF_UNSET) {
+        return "is duplicate";
+    }
+
+    value = cf->args->elts;
+
+    if (ngx_strcmp(value[1].data, "on") == 0) {
+        ccf->numa = 1;
+
+    } else if (ngx_strcmp(value[1].data, "off") == 0) {
+        ccf->numa = 0;
+
+    } else {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "invalid value \"%V\" in \"%V\" directive, "
+                           "it must be \"on\" or \"off\"",
+                           &value[1], &cmd->name);
+        return NGX_CONF_ERROR;
+    }
+
+    if (cf->args->nelts == 3) {
+        if (ngx_strcmp(value[2].data, "zones=interleave") != 0) {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "invalid parameter \"%V\"", &value[2]);
+            return NGX_CONF_ERROR;
+        }
+
+        ccf->numa_interleave = 1;
+    }
+
+#if !(NGX_HAVE_NUMA)
+
+    if (ccf->numa) {
+        ngx_conf_log_error(NGX_LOG_WARN, cf, 0,
+                           "\"worker_numa\" is not supported "
+                           "on this platform, ignored");
+        ccf->numa = 0;
+    }
+
+#endif
+
+    return NGX_CONF_OK;
+}
+
+
 static char *
 ngx_set_worker_processes(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 {
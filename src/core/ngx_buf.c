@@ -44,6 +44,36 @@ ngx_create_temp_buf(ngx_pool_t *pool, size_t size)
 }
 
 
+/*
+ * Large I/O buffers, such as proxy and output buffers, are allocated
+ * with ngx_palloc_buffer() to be recycled by the process after the pool
+ * is destroyed.
+ */
+
+ngx_buf_t *
+ngx_create_large_buf(ngx_pool_t *pool, size_t size)
+{
+    ngx_buf_t *b;
+
+    b = ngx_calloc_buf(pool);
+    if (b == NULL) {
+        return NULL;
+    }
+
+    b->start = ngx_palloc_buffer(pool, size);
+    if (b->start == NULL) {
+        return NULL;
+    }
+
+    b->pos = b->start;
+    b->last = b->start;
+    b->end = b->last + size;
+    b->temporary = 1;
+
+    return b;
+}
+
+
 ngx_chain_t *
 ngx_alloc_chain_link(ngx_pool_t *pool)
 {
@@ -87,6 +87,7 @@ struct ngx_output_chain_ctx_s {
     unsigned                     need_in_memory:1;
     unsigned                     need_in_temp:1;
     unsigned                     aio:1;
+    unsigned                     aio_uring:1;
 
 #if (NGX_HAVE_FILE_AIO || NGX_COMPAT)
     ngx_output_chain_aio_pt      aio_handler;
@@ -138,6 +139,7 @@ typedef struct {
                             ((b)->file_last - (b)->file_pos))
 
 ngx_buf_t *ngx_create_temp_buf(ngx_pool_t *pool, size_t size);
+ngx_buf_t *ngx_create_large_buf(ngx_pool_t *pool, size_t size);
 ngx_chain_t *ngx_create_chain_of_bufs(ngx_pool_t *pool, ngx_bufs_t *bufs);
 
 
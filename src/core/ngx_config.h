@@ -70,6 +70,8 @@
 #define NGX_CHANGEBIN_SIGNAL     USR2
 #endif
 
+#define NGX_MEMORY_SIGNAL        TTIN
+
 #define ngx_cdecl
 #define ngx_libc_cdecl
 
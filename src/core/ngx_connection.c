@@ -14,6 +14,13 @@ ngx_os_io_t  ngx_io;
 
 
 static void ngx_drain_connections(ngx_cycle_t *cycle);
+#if (NGX_HAVE_REUSEPORT_EBPF)
+static ngx_int_t *ngx_reuseport_cpu_workers(ngx_cycle_t *cycle);
+static void ngx_reuseport_cpu_attach(ngx_cycle_t *cycle, ngx_listening_t *ls,
+    ngx_int_t *workers);
+static ngx_inline void ngx_reuseport_cpu_close(ngx_log_t *log, int fd,
+    const char *name);
+#endif
 
 
 ngx_listening_t *
@@ -723,6 +730,17 @@ ngx_configure_listening_sockets(ngx_cycle_t *cycle)
     struct accept_filter_arg   af;
 #endif
 
+#if (NGX_HAVE_UDP_GRO)
+    ngx_err_t                  err;
+    ngx_uint_t                 level;
+#endif
+
+#if (NGX_HAVE_REUSEPORT_EBPF)
+    ngx_int_t                 *workers;
+
+    workers = NULL;
+#endif
+
     ls = cycle->listening.elts;
     for (i = 0; i < cycle->listening.nelts; i++) {
 
@@ -853,6 +871,23 @@ ngx_configure_listening_sockets(ngx_cycle_t *cycle)
         }
 #endif
 
+#if (NGX_HAVE_REUSEPORT_EBPF)
+
+        /* the program is shared by all sockets of the reuseport group */
+
+        if (ls[i].reuseport_cpu && ls[i].worker == 0) {
+
+            if (workers == NULL) {
+                workers = ngx_reuseport_cpu_workers(cycle);
+            }
+
+            if (workers) {
+                ngx_reuseport_cpu_attach(cycle, &ls[i], workers);
+            }
+        }
+
+#endif
+
         if (ls[i].listen) {
 
             /* change backlog via listen() */
@@ -1015,6 +1050,28 @@ ngx_configure_listening_sockets(ngx_cycle_t *cycle)
 
 #endif
 
+#if (NGX_HAVE_UDP_GRO)
+
+        if (ls[i].udp_gro) {
+            value = 1;
+
+            if (setsockopt(ls[i].fd, SOL_UDP, UDP_GRO,
+                           (const void *) &value, sizeof(int))
+                == -1)
+            {
+                err = ngx_socket_errno;
+
+                level = (err == NGX_ENOPROTOOPT) ? NGX_LOG_NOTICE
+                                                 : NGX_LOG_ALERT;
+
+                ngx_log_error(level, cycle->log, err,
+                              "setsockopt(UDP_GRO) for %V failed, ignored",
+                              &ls[i].addr_text);
+            }
+        }
+
+#endif
+
 #if (NGX_HAVE_IP_MTU_DISCOVER)
 
         if (ls[i].quic && ls[i].sockaddr->sa_family == AF_INET) {
@@ -1088,10 +1145,250 @@ ngx_configure_listening_sockets(ngx_cycle_t *cycle)
 #endif
     }
 
+#if (NGX_HAVE_REUSEPORT_EBPF)
+    if (workers) {
+        ngx_free(workers);
+    }
+#endif
+
     return;
 }
 
 
+#if (NGX_HAVE_REUSEPORT_EBPF)
+
+/*
+ * The program looks up the socket of the reuseport group by the number
+ * of the CPU which received the packet.  Sockets are stored in a sockmap,
+ * so the selection does not depend on the order of sockets in the group,
+ * which changes as sockets are closed on reloads or binary upgrades.
+ * If no socket is found, the kernel falls back to hashing.
+ */
+
+static struct bpf_insn  ngx_reuseport_cpu_insn[] = {
+    /* opcode                    dst        src        off  imm */
+
+    /* r6 = ctx */
+    { BPF_ALU64|BPF_MOV|BPF_X,   BPF_REG_6, BPF_REG_1, 0,   0 },
+
+    /* key = bpf_get_smp_processor_id() */
+    { BPF_JMP|BPF_CALL,          0,         0,         0,
+      BPF_FUNC_get_smp_processor_id },
+    { BPF_STX|BPF_MEM|BPF_W,     BPF_REG_10, BPF_REG_0, -4, 0 },
+
+    /* bpf_sk_select_reuseport(ctx, map, &key, 0) */
+    { BPF_ALU64|BPF_MOV|BPF_X,   BPF_REG_1, BPF_REG_6, 0,   0 },
+    { BPF_LD|BPF_DW|BPF_IMM,     BPF_REG_2, 0,         0,   0 },
+    { 0,                         0,         0,         0,   0 },
+    { BPF_ALU64|BPF_MOV|BPF_X,   BPF_REG_3, BPF_REG_10, 0,  0 },
+    { BPF_ALU64|BPF_ADD|BPF_K,   BPF_REG_3, 0,         0,   -4 },
+    { BPF_ALU64|BPF_MOV|BPF_K,   BPF_REG_4, 0,         0,   0 },
+    { BPF_JMP|BPF_CALL,          0,         0,         0,
+      BPF_FUNC_sk_select_reuseport },
+
+    /* return SK_PASS */
+    { BPF_ALU64|BPF_MOV|BPF_K,   BPF_REG_0, 0,         0,   SK_PASS },
+    { BPF_JMP|BPF_EXIT,          0,         0,         0,   0 }
+};
+
+
+static ngx_bpf_reloc_t  ngx_reuseport_cpu_relocs[] = {
+    { "ngx_reuseport_cpu_map", 4 }
+};
+
+
+static ngx_bpf_program_t  ngx_reuseport_cpu_program = {
+    "BSD",
+    BPF_PROG_TYPE_SK_REUSEPORT,
+    ngx_reuseport_cpu_insn,
+    sizeof(ngx_reuseport_cpu_insn) / sizeof(struct bpf_insn),
+    ngx_reuseport_cpu_relocs,
+    sizeof(ngx_reuseport_cpu_relocs) / sizeof(ngx_bpf_reloc_t)
+};
+
+
+/*
+ * CPUs are mapped to the worker processes bound to them, as specified
+ * by "worker_cpu_affinity".  Other CPUs are mapped to workers round-robin.
+ */
+
+static ngx_int_t *
+ngx_reuseport_cpu_workers(ngx_cycle_t *cycle)
+{
+    ngx_uint_t        cpu, nworkers;
+    ngx_int_t        *workers;
+    ngx_core_conf_t  *ccf;
+
+#if (NGX_HAVE_CPU_AFFINITY)
+    ngx_uint_t        n, next;
+    ngx_cpuset_t     *mask;
+#endif
+
+    ccf = (ngx_core_conf_t *) ngx_get_conf(cycle->conf_ctx, ngx_core_module);
+
+    nworkers = ccf->worker_processes;
+
+    workers = ngx_alloc(CPU_SETSIZE * sizeof(ngx_int_t), cycle->log);
+    if (workers == NULL) {
+        return NULL;
+    }
+
+    for (cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        workers[cpu] = -1;
+    }
+
+#if (NGX_HAVE_CPU_AFFINITY)
+
+    if (ccf->cpu_affinity_auto) {
+
+        /* workers are bound to CPUs of the mask in turn */
+
+        mask = &ccf->cpu_affinity[ccf->cpu_affinity_n - 1];
+        next = 0;
+
+        for (cpu = 0; cpu < CPU_SETSIZE && next < nworkers; cpu++) {
+            if (CPU_ISSET(cpu, mask)) {
+                workers[cpu] = next++;
+            }
+        }
+
+    } else if (ccf->cpu_affinity) {
+
+        for (n = 0; n < nworkers; n++) {
+            mask = &ccf->cpu_affinity[ngx_min(n, ccf->cpu_affinity_n - 1)];
+
+            for (cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                if (CPU_ISSET(cpu, mask) && workers[cpu] == -1) {
+                    workers[cpu] = n;
+                }
+            }
+        }
+    }
+
+#endif
+
+    for (cpu = 0; cpu < (ngx_uint_t) ngx_ncpu && cpu < CPU_SETSIZE; cpu++) {
+        if (workers[cpu] == -1) {
+            workers[cpu] = cpu % nworkers;
+        }
+    }
+
+    return workers;
+}
+
+
+/*
+ * The sockmap is created for each cycle and is only referenced by
+ * the program, so both are released once the program is replaced
+ * on the next reload.
+ */
+
+static void
+ngx_reuseport_cpu_attach(ngx_cycle_t *cycle, ngx_listening_t *ls,
+    ngx_int_t *workers)
+{
+    int               map, prog, *fds;
+    uint32_t          cpu;
+    ngx_uint_t        i, nworkers;
+    ngx_core_conf_t  *ccf;
+    ngx_listening_t  *gls;
+
+    ccf = (ngx_core_conf_t *) ngx_get_conf(cycle->conf_ctx, ngx_core_module);
+
+    nworkers = ccf->worker_processes;
+
+    fds = ngx_alloc(nworkers * sizeof(int), cycle->log);
+    if (fds == NULL) {
+        return;
+    }
+
+    for (i = 0; i < nworkers; i++) {
+        fds[i] = -1;
+    }
+
+    gls = cycle->listening.elts;
+
+    for (i = 0; i < cycle->listening.nelts; i++) {
+
+        if (!gls[i].reuseport_cpu
+            || gls[i].worker >= nworkers
+            || gls[i].type != ls->type
+            || gls[i].fd == (ngx_socket_t) -1
+            || ngx_cmp_sockaddr(gls[i].sockaddr, gls[i].socklen,
+                                ls->sockaddr, ls->socklen, 1)
+               != NGX_OK)
+        {
+            continue;
+        }
+
+        fds[gls[i].worker] = gls[i].fd;
+    }
+
+    map = ngx_bpf_map_create(cycle->log, BPF_MAP_TYPE_SOCKMAP,
+                             sizeof(uint32_t), sizeof(int), CPU_SETSIZE, 0);
+    if (map == -1) {
+        ngx_free(fds);
+        return;
+    }
+
+    for (cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+
+        if (workers[cpu] == -1 || fds[workers[cpu]] == -1) {
+            continue;
+        }
+
+        if (ngx_bpf_map_update(map, &cpu, &fds[workers[cpu]], BPF_ANY)
+            == -1)
+        {
+            ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_errno,
+                          "reuseport cpu bpf failed to update map for %V",
+                          &ls->addr_text);
+            goto failed;
+        }
+    }
+
+    ngx_bpf_program_link(&ngx_reuseport_cpu_program,
+                         "ngx_reuseport_cpu_map", map);
+
+    prog = ngx_bpf_load_program(cycle->log, &ngx_reuseport_cpu_program);
+    if (prog == -1) {
+        goto failed;
+    }
+
+    if (setsockopt(ls->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_EBPF,
+                   (const void *) &prog, sizeof(int))
+        == -1)
+    {
+        ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_socket_errno,
+                      "setsockopt(SO_ATTACH_REUSEPORT_EBPF) "
+                      "for %V failed, ignored",
+                      &ls->addr_text);
+    }
+
+    ngx_reuseport_cpu_close(cycle->log, prog, "program");
+
+failed:
+
+    ngx_reuseport_cpu_close(cycle->log, map, "map");
+
+    ngx_free(fds);
+}
+
+
+static ngx_inline void
+ngx_reuseport_cpu_close(ngx_log_t *log, int fd, const char *name)
+{
+    if (close(fd) != -1) {
+        return;
+    }
+
+    ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                  "reuseport cpu bpf close %s fd:%d failed", name, fd);
+}
+
+#endif
+
+
 void
 ngx_close_listening_sockets(ngx_cycle_t *cycle)
 {
@@ -15,6 +15,10 @@
 
 typedef struct ngx_listening_s  ngx_listening_t;
 
+#if (NGX_HAVE_MSG_ZEROCOPY)
+typedef struct ngx_zerocopy_s   ngx_zerocopy_t;
+#endif
+
 struct ngx_listening_s {
     ngx_socket_t        fd;
 
@@ -43,6 +47,7 @@ struct ngx_listening_s {
     ngx_log_t          *logp;
 
     size_t              pool_size;
+    ngx_pool_adapt_t   *pool_adapt;
     /* should be here because of the AcceptEx() preread */
     size_t              post_accept_buffer_size;
 
@@ -71,9 +76,11 @@ struct ngx_listening_s {
     unsigned            ipv6only:1;
 #endif
     unsigned            reuseport:1;
+    unsigned            reuseport_cpu:1;
     unsigned            add_reuseport:1;
     unsigned            keepalive:2;
     unsigned            quic:1;
+    unsigned            udp_gro:1;
 
     unsigned            deferred_accept:1;
     unsigned            delete_deferred:1;
@@ -193,6 +200,8 @@ struct ngx_connection_s {
     unsigned            need_last_buf:1;
     unsigned            need_flush_buf:1;
 
+    unsigned            pool_adapted:1;
+
 #if (NGX_HAVE_SENDFILE_NODISKIO || NGX_COMPAT)
     unsigned            busy_count:2;
 #endif
@@ -200,6 +209,10 @@ struct ngx_connection_s {
 #if (NGX_THREADS || NGX_COMPAT)
     ngx_thread_task_t  *sendfile_task;
 #endif
+
+#if (NGX_HAVE_MSG_ZEROCOPY)
+    ngx_zerocopy_t     *zerocopy;
+#endif
 };
 
 
@@ -214,6 +227,10 @@ struct ngx_connection_s {
     }
 
 
+#define ngx_listening_pool_size(ls)                                          \
+    ((ls)->pool_adapt ? (ls)->pool_adapt->size : (ls)->pool_size)
+
+
 ngx_listening_t *ngx_create_listening(ngx_conf_t *cf, struct sockaddr *sockaddr,
     socklen_t socklen);
 ngx_int_t ngx_clone_listening(ngx_cycle_t *cycle, ngx_listening_t *ls);
@@ -9,10 +9,14 @@
 #include <ngx_core.h>
 
 
+ngx_uint_t  ngx_cpu_features;
+
+
 #if (( __i386__ || __amd64__ ) && ( __GNUC__ || __INTEL_COMPILER ))
 
 
 static ngx_inline void ngx_cpuid(uint32_t i, uint32_t *buf);
+static void ngx_cpu_detect_features(uint32_t max, uint32_t *cpu);
 
 
 #if ( __i386__ )
@@ -31,6 +35,7 @@ ngx_cpuid(uint32_t i, uint32_t *buf)
 
     "    mov    %%ebx, %%esi;  "
 
+    "    xor    %%ecx, %%ecx;  "
     "    cpuid;                "
     "    mov    %%eax, (%1);   "
     "    mov    %%ebx, 4(%1);  "
@@ -55,7 +60,7 @@ ngx_cpuid(uint32_t i, uint32_t *buf)
 
         "cpuid"
 
-    : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) : "a" (i) );
+    : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) : "a" (i), "c" (0) );
 
     buf[0] = eax;
     buf[1] = ebx;
@@ -125,6 +130,39 @@ ngx_cpuinfo(void)
     } else if (ngx_strcmp(vendor, "AuthenticAMD") == 0) {
         ngx_cacheline_size = 64;
     }
+
+    ngx_cpu_detect_features(vbuf[0], cpu);
+}
+
+
+/* the instruction set extensions used by the parsers */
+
+static void
+ngx_cpu_detect_features(uint32_t max, uint32_t *cpu)
+{
+    uint32_t  ext[4], xcr0, edx;
+
+    if (cpu[3] & (1 << 20)) {
+        ngx_cpu_features |= NGX_CPU_SSE42;
+    }
+
+    /* AVX2 also requires the OS to save the YMM registers: OSXSAVE and AVX */
+
+    if (max < 7 || (cpu[3] & (3 << 27)) != (3 << 27)) {
+        return;
+    }
+
+    __asm__ ( "xgetbv" : "=a" (xcr0), "=d" (edx) : "c" (0) );
+
+    if ((xcr0 & 6) != 6) {
+        return;
+    }
+
+    ngx_cpuid(7, ext);
+
+    if (ext[1] & (1 << 5)) {
+        ngx_cpu_features |= NGX_CPU_AVX2;
+    }
 }
 
 #else
@@ -11,8 +11,11 @@
 
 
 static void ngx_destroy_cycle_pools(ngx_conf_t *conf);
+static void ngx_destroy_cycle_arena(void *data);
 static ngx_int_t ngx_init_zone_pool(ngx_cycle_t *cycle,
     ngx_shm_zone_t *shm_zone);
+static ngx_int_t ngx_migrate_zone(ngx_cycle_t *cycle, ngx_shm_zone_t *zn,
+    ngx_shm_zone_t *ozn);
 static ngx_int_t ngx_test_lockfile(u_char *file, ngx_log_t *log);
 static void ngx_clean_old_cycles(ngx_event_t *ev);
 static void ngx_shutdown_timer_handler(ngx_event_t *ev);
@@ -30,6 +33,14 @@ ngx_uint_t             ngx_dump_config;
 ngx_uint_t             ngx_quiet_mode;
 
 
+/*
+ * old workers may hold the mutex of a zone being migrated,
+ * the master process waits for it up to 100 times for 10ms
+ */
+
+#define NGX_MIGRATE_ZONE_TRIES  100
+
+
 /* STUB NAME */
 static ngx_connection_t  dumb;
 /* STUB */
@@ -46,7 +57,8 @@ ngx_init_cycle(ngx_cycle_t *old_cycle)
     ngx_conf_t           conf;
     ngx_pool_t          *pool;
     ngx_cycle_t         *cycle, **old;
-    ngx_shm_zone_t      *shm_zone, *oshm_zone;
+    ngx_pool_cleanup_t  *cln;
+    ngx_shm_zone_t      *shm_zone, *oshm_zone, *oshm;
     ngx_list_part_t     *part, *opart;
     ngx_open_file_t     *file;
     ngx_listening_t     *ls, *nls;
@@ -72,6 +84,8 @@ ngx_init_cycle(ngx_cycle_t *old_cycle)
     }
     pool->log = log;
 
+    ngx_pool_set_tag(pool, NGX_POOL_CYCLE);
+
     cycle = ngx_pcalloc(pool, sizeof(ngx_cycle_t));
     if (cycle == NULL) {
         ngx_destroy_pool(pool);
@@ -82,6 +96,24 @@ ngx_init_cycle(ngx_cycle_t *old_cycle)
     cycle->log = log;
     cycle->old_cycle = old_cycle;
 
+    cycle->arena = ngx_create_arena(NGX_CYCLE_POOL_SIZE, log);
+    if (cycle->arena == NULL) {
+        ngx_destroy_pool(pool);
+        return NULL;
+    }
+
+    /* the first cleanup added is run last, after all users of the arena */
+
+    cln = ngx_pool_cleanup_add(pool, 0);
+    if (cln == NULL) {
+        ngx_destroy_pool(cycle->arena);
+        ngx_destroy_pool(pool);
+        return NULL;
+    }
+
+    cln->handler = ngx_destroy_cycle_arena;
+    cln->data = cycle->arena;
+
     cycle->conf_prefix.len = old_cycle->conf_prefix.len;
     cycle->conf_prefix.data = ngx_pstrdup(pool, &old_cycle->conf_prefix);
     if (cycle->conf_prefix.data == NULL) {
@@ -408,6 +440,7 @@ ngx_init_cycle(ngx_cycle_t *old_cycle)
 
     cycle->log = &cycle->new_log;
     pool->log = &cycle->new_log;
+    cycle->arena->log = &cycle->new_log;
 
 
     /* create shared memory */
@@ -435,6 +468,8 @@ ngx_init_cycle(ngx_cycle_t *old_cycle)
 
         shm_zone[i].shm.log = cycle->log;
 
+        oshm = NULL;
+
         opart = &old_cycle->shared_memory.part;
         oshm_zone = opart->elts;
 
@@ -468,6 +503,8 @@ ngx_init_cycle(ngx_cycle_t *old_cycle)
                 shm_zone[i].shm.addr = oshm_zone[n].shm.addr;
 #if (NGX_WIN32)
                 shm_zone[i].shm.handle = oshm_zone[n].shm.handle;
+#else
+                shm_zone[i].shm.mapped = oshm_zone[n].shm.mapped;
 #endif
 
                 if (shm_zone[i].init(&shm_zone[i], oshm_zone[n].data)
@@ -479,9 +516,18 @@ ngx_init_cycle(ngx_cycle_t *old_cycle)
                 goto shm_zone_found;
             }
 
+            if (shm_zone[i].tag == oshm_zone[n].tag
+                && shm_zone[i].migrate
+                && !shm_zone[i].noreuse)
+            {
+                oshm = &oshm_zone[n];
+            }
+
             break;
         }
 
+        shm_zone[i].shm.interleave = ccf->numa_interleave;
+
         if (ngx_shm_alloc(&shm_zone[i].shm) != NGX_OK) {
             goto failed;
         }
@@ -494,6 +540,10 @@ ngx_init_cycle(ngx_cycle_t *old_cycle)
             goto failed;
         }
 
+        if (oshm && ngx_migrate_zone(cycle, &shm_zone[i], oshm) != NGX_OK) {
+            goto failed;
+        }
+
     shm_zone_found:
 
         continue;
@@ -631,12 +681,20 @@ ngx_init_cycle(ngx_cycle_t *old_cycle)
     }
 
     pool->log = cycle->log;
+    cycle->arena->log = cycle->log;
 
     if (ngx_init_modules(cycle) != NGX_OK) {
         /* fatal */
         exit(1);
     }
 
+    /*
+     * configuration lookup structures are not modified from now on,
+     * so worker processes share their pages with the master process
+     */
+
+    ngx_pool_freeze(cycle->arena);
+
 
     /* close and delete stuff that lefts from an old cycle */
 
@@ -948,6 +1006,15 @@ ngx_destroy_cycle_pools(ngx_conf_t *conf)
 }
 
 
+static void
+ngx_destroy_cycle_arena(void *data)
+{
+    ngx_pool_t  *arena = data;
+
+    ngx_destroy_pool(arena);
+}
+
+
 static ngx_int_t
 ngx_init_zone_pool(ngx_cycle_t *cycle, ngx_shm_zone_t *zn)
 {
@@ -1014,6 +1081,56 @@ ngx_init_zone_pool(ngx_cycle_t *cycle, ngx_shm_zone_t *zn)
 }
 
 
+/*
+ * A zone which changed its size is initialized anew and then the module
+ * copies live objects from the old zone.  The old zone is locked as
+ * worker processes of the old cycle may still use it.
+ */
+
+static ngx_int_t
+ngx_migrate_zone(ngx_cycle_t *cycle, ngx_shm_zone_t *zn, ngx_shm_zone_t *ozn)
+{
+    ngx_int_t         rc;
+    ngx_uint_t        n;
+    ngx_slab_pool_t  *osp;
+
+    if (zn->shm.exists) {
+        return NGX_OK;
+    }
+
+    osp = (ngx_slab_pool_t *) ozn->shm.addr;
+
+    for (n = 0; !ngx_shmtx_trylock(&osp->mutex); n++) {
+
+        if (n == NGX_MIGRATE_ZONE_TRIES) {
+
+            /* the new zone is left empty as initialized */
+
+            ngx_log_error(NGX_LOG_WARN, cycle->log, 0,
+                          "shared zone \"%V\" is locked, "
+                          "resized without migration", &zn->shm.name);
+            return NGX_OK;
+        }
+
+        ngx_msleep(10);
+    }
+
+    rc = zn->migrate(zn, ozn->data);
+
+    ngx_shmtx_unlock(&osp->mutex);
+
+    if (rc != NGX_OK) {
+        return rc;
+    }
+
+    ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0,
+                  "shared zone \"%V\" resized from %uz to %uz",
+                  &zn->shm.name, ozn->shm.size, zn->shm.size);
+
+    return NGX_OK;
+}
+
+
 ngx_int_t
 ngx_create_pidfile(ngx_str_t *name, ngx_log_t *log)
 {
@@ -1288,6 +1405,86 @@ ngx_reopen_files(ngx_cycle_t *cycle, ngx_uid_t user)
 }
 
 
+void
+ngx_log_memory_usage(ngx_cycle_t *cycle)
+{
+    ngx_uint_t           i;
+    ngx_shm_zone_t      *zone;
+    ngx_list_part_t     *part;
+    ngx_slab_pool_t     *sp;
+    ngx_pool_account_t  *pa;
+    ngx_slab_account_t  *sa;
+#if (NGX_LINUX)
+    size_t               shared, private;
+#endif
+#if (NGX_HAVE_NUMA)
+    size_t               nodes[NGX_NUMA_NODES];
+    ngx_core_conf_t     *ccf;
+#endif
+
+#if (NGX_LINUX)
+    if (ngx_linux_memory_usage(&shared, &private, cycle->log) == NGX_OK) {
+        ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0,
+                      "memory: shared:%uz private:%uz", shared, private);
+    }
+#endif
+
+#if (NGX_HAVE_NUMA)
+    ccf = (ngx_core_conf_t *) ngx_get_conf(cycle->conf_ctx, ngx_core_module);
+
+    if (ccf->numa && ngx_numa_usage(nodes, cycle->log) == NGX_OK) {
+        for (i = 0; i < NGX_NUMA_NODES; i++) {
+            if (nodes[i]) {
+                ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0,
+                              "memory: numa node %ui size:%uz", i, nodes[i]);
+            }
+        }
+    }
+#endif
+
+    if (!ngx_pool_accounting) {
+        ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0,
+                      "memory accounting is disabled");
+        return;
+    }
+
+    for (i = 0; i < NGX_POOL_TAGS; i++) {
+        pa = &ngx_pool_accounts[i];
+
+        ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0,
+                      "memory: %V pools:%ui size:%uz allocs:%ui requested:%uz",
+                      &ngx_pool_tags[i], pa->pools, pa->size,
+                      pa->allocs, pa->requested);
+    }
+
+    part = &cycle->shared_memory.part;
+    zone = part->elts;
+
+    for (i = 0; /* void */ ; i++) {
+
+        if (i >= part->nelts) {
+            if (part->next == NULL) {
+                break;
+            }
+            part = part->next;
+            zone = part->elts;
+            i = 0;
+        }
+
+        sp = (ngx_slab_pool_t *) zone[i].shm.addr;
+        sa = ngx_slab_get_account(sp);
+
+        ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0,
+                      "memory: zone \"%V\" size:%uz pages:%ui free:%ui "
+                      "allocs:%ui frees:%ui requested:%uz",
+                      &zone[i].shm.name, zone[i].shm.size,
+                      (ngx_uint_t) (sp->last - sp->pages), sp->pfree,
+                      sa ? sa->allocs : 0, sa ? sa->frees : 0,
+                      sa ? sa->requested : 0);
+    }
+}
+
+
 ngx_shm_zone_t *
 ngx_shared_memory_add(ngx_conf_t *cf, ngx_str_t *name, size_t size, void *tag)
 {
@@ -1354,7 +1551,14 @@ ngx_shared_memory_add(ngx_conf_t *cf, ngx_str_t *name, size_t size, void *tag)
     shm_zone->shm.size = size;
     shm_zone->shm.name = *name;
     shm_zone->shm.exists = 0;
+    shm_zone->shm.hugepages = 0;
+    shm_zone->shm.interleave = 0;
+#if !(NGX_WIN32)
+    shm_zone->shm.mapped = 0;
+#endif
     shm_zone->init = NULL;
+    shm_zone->migrate = NULL;
+    shm_zone->move = NULL;
     shm_zone->tag = tag;
     shm_zone->noreuse = 0;
 
@@ -25,11 +25,16 @@
 typedef struct ngx_shm_zone_s  ngx_shm_zone_t;
 
 typedef ngx_int_t (*ngx_shm_zone_init_pt) (ngx_shm_zone_t *zone, void *data);
+typedef ngx_int_t (*ngx_shm_zone_migrate_pt) (ngx_shm_zone_t *zone,
+    void *data);
+typedef void (*ngx_shm_zone_move_pt) (ngx_shm_zone_t *zone, void *p);
 
 struct ngx_shm_zone_s {
     void                     *data;
     ngx_shm_t                 shm;
     ngx_shm_zone_init_pt      init;
+    ngx_shm_zone_migrate_pt   migrate;
+    ngx_shm_zone_move_pt      move;
     void                     *tag;
     void                     *sync;
     ngx_uint_t                noreuse;  /* unsigned  noreuse:1; */
@@ -39,6 +44,7 @@ struct ngx_shm_zone_s {
 struct ngx_cycle_s {
     void                  ****conf_ctx;
     ngx_pool_t               *pool;
+    ngx_pool_t               *arena;   /* read-only configuration data */
 
     ngx_log_t                *log;
     ngx_log_t                 new_log;
@@ -99,6 +105,14 @@ typedef struct {
     ngx_int_t                 rlimit_nofile;
     off_t                     rlimit_core;
 
+    size_t                    pool_cache;
+    ngx_int_t                 slab_cache;
+    ngx_flag_t                hugepages;
+    ngx_flag_t                memory_accounting;
+    ngx_msec_t                slab_compaction;
+    ngx_flag_t                numa;
+    ngx_flag_t                numa_interleave;
+
     int                       priority;
 
     ngx_uint_t                cpu_affinity_auto;
@@ -130,6 +144,7 @@ ngx_int_t ngx_create_pidfile(ngx_str_t *name, ngx_log_t *log);
 void ngx_delete_pidfile(ngx_cycle_t *cycle);
 ngx_int_t ngx_signal_process(ngx_cycle_t *cycle, char *sig);
 void ngx_reopen_files(ngx_cycle_t *cycle, ngx_uid_t user);
+void ngx_log_memory_usage(ngx_cycle_t *cycle);
 char **ngx_set_environment(ngx_cycle_t *cycle, ngx_uint_t *last);
 ngx_pid_t ngx_exec_new_binary(ngx_cycle_t *cycle, char *const *argv);
 ngx_cpuset_t *ngx_get_cpu_affinity(ngx_uint_t n);
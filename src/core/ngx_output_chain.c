@@ -475,7 +475,7 @@ ngx_output_chain_get_buf(ngx_output_chain_ctx_t *ctx, off_t bsize)
         }
 
     } else {
-        b->start = ngx_palloc(ctx->pool, size);
+        b->start = ngx_palloc_buffer(ctx->pool, size);
         if (b->start == NULL) {
             return NGX_ERROR;
         }
@@ -564,8 +564,17 @@ ngx_output_chain_copy_buf(ngx_output_chain_ctx_t *ctx)
 
 #if (NGX_HAVE_FILE_AIO)
         if (ctx->aio_handler) {
-            n = ngx_file_aio_read(src->file, dst->pos, (size_t) size,
-                                  src->file_pos, ctx->pool);
+#if (NGX_HAVE_FILE_URING)
+            if (ctx->aio_uring) {
+                n = ngx_file_uring_read(src->file, dst->pos, (size_t) size,
+                                        src->file_pos, ctx->pool);
+            } else
+#endif
+            {
+                n = ngx_file_aio_read(src->file, dst->pos, (size_t) size,
+                                      src->file_pos, ctx->pool);
+            }
+
             if (n == NGX_AGAIN) {
                 ctx->aio_handler(ctx, src->file);
                 return NGX_AGAIN;
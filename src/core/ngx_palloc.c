@@ -9,18 +9,84 @@
 #include <ngx_core.h>
 
 
+/*
+ * The per-process cache of memory blocks.  Only blocks with sizes that are
+ * powers of two between 128 bytes and 64 kilobytes are cached, so a block
+ * returned to the cache always has the size of its class.
+ *
+ * Page-aligned I/O buffers allocated with ngx_palloc_buffer() are cached
+ * separately, in classes of exact sizes created on demand.
+ */
+
+#define NGX_POOL_CACHE_MIN_SHIFT  7
+#define NGX_POOL_CACHE_MAX_SHIFT  16
+#define NGX_POOL_CACHE_CLASSES                                                \
+    (NGX_POOL_CACHE_MAX_SHIFT - NGX_POOL_CACHE_MIN_SHIFT + 1)
+
+#define NGX_POOL_BUFFER_CLASSES   16
+
+
+typedef struct ngx_pool_cache_block_s  ngx_pool_cache_block_t;
+
+struct ngx_pool_cache_block_s {
+    ngx_pool_cache_block_t  *next;
+};
+
+
+typedef struct {
+    size_t                   size;
+    ngx_pool_cache_block_t  *free;
+    ngx_uint_t               nfree;
+    ngx_uint_t               low;     /* minimum nfree since the last trim */
+} ngx_pool_cache_class_t;
+
+
 static ngx_inline void *ngx_palloc_small(ngx_pool_t *pool, size_t size,
     ngx_uint_t align);
 static void *ngx_palloc_block(ngx_pool_t *pool, size_t size);
 static void *ngx_palloc_large(ngx_pool_t *pool, size_t size);
 
+static ngx_inline ngx_int_t ngx_pool_cache_class(size_t size);
+static void *ngx_pool_cache_alloc(size_t size, ngx_log_t *log);
+static void ngx_pool_cache_free(void *p, size_t size);
+static ngx_pool_cache_class_t *ngx_pool_buffer_class(size_t size);
+static void ngx_pool_free_large(ngx_pool_large_t *l);
+static void *ngx_pool_cache_get(ngx_pool_cache_class_t *cls);
+static ngx_int_t ngx_pool_cache_put(ngx_pool_cache_class_t *cls, void *p);
+static void ngx_pool_cache_trim_class(ngx_pool_cache_class_t *cls);
+static void ngx_pool_protect(ngx_pool_t *pool, ngx_uint_t readonly);
+
+
+static ngx_pool_cache_class_t  ngx_pool_cache[NGX_POOL_CACHE_CLASSES];
+static ngx_pool_cache_class_t  ngx_pool_buffers[NGX_POOL_BUFFER_CLASSES];
+static size_t                  ngx_pool_cache_max;
+static size_t                  ngx_pool_cache_size;
+
+
+/*
+ * Optional accounting of the memory held and requested by pools, grouped
+ * by the owners of pools.  Pools created while accounting is disabled are
+ * not accounted until they are tagged.
+ */
+
+ngx_uint_t          ngx_pool_accounting;
+ngx_pool_account_t  ngx_pool_accounts[NGX_POOL_TAGS];
+
+ngx_str_t  ngx_pool_tags[NGX_POOL_TAGS] = {
+    ngx_string("other"),
+    ngx_string("cycle"),
+    ngx_string("connection"),
+    ngx_string("request"),
+    ngx_string("upstream")
+};
+
 
 ngx_pool_t *
 ngx_create_pool(size_t size, ngx_log_t *log)
 {
     ngx_pool_t  *p;
 
-    p = ngx_memalign(NGX_POOL_ALIGNMENT, size, log);
+    p = ngx_pool_cache_alloc(size, log);
     if (p == NULL) {
         return NULL;
     }
@@ -30,6 +96,15 @@ ngx_create_pool(size_t size, ngx_log_t *log)
     p->d.next = NULL;
     p->d.failed = 0;
 
+    if (ngx_pool_accounting) {
+        p->account = &ngx_pool_accounts[NGX_POOL_OTHER];
+        p->account->pools++;
+        p->account->size += size;
+
+    } else {
+        p->account = NULL;
+    }
+
     size = size - sizeof(ngx_pool_t);
     p->max = (size < NGX_MAX_ALLOC_FROM_POOL) ? size : NGX_MAX_ALLOC_FROM_POOL;
 
@@ -38,17 +113,108 @@ ngx_create_pool(size_t size, ngx_log_t *log)
     p->large = NULL;
     p->cleanup = NULL;
     p->log = log;
+    p->arena = 0;
+    p->frozen = 0;
+
+    return p;
+}
+
+
+/*
+ * An arena is a pool with page-aligned memory, for data which is not
+ * modified once built, such as configuration lookup structures.  After
+ * ngx_pool_freeze() the memory is read-only, and pages inherited by
+ * worker processes stay shared with the master process.  An arena cannot
+ * be allocated from when frozen.
+ */
+
+ngx_pool_t *
+ngx_create_arena(size_t size, ngx_log_t *log)
+{
+    ngx_pool_t  *p;
+
+    size = ngx_align(size, ngx_pagesize);
+
+    p = ngx_memalign(ngx_pagesize, size, log);
+    if (p == NULL) {
+        return NULL;
+    }
+
+    p->d.last = (u_char *) p + sizeof(ngx_pool_t);
+    p->d.end = (u_char *) p + size;
+    p->d.next = NULL;
+    p->d.failed = 0;
+
+    p->max = size - sizeof(ngx_pool_t);
+
+    p->current = p;
+    p->chain = NULL;
+    p->large = NULL;
+    p->cleanup = NULL;
+    p->log = log;
+    p->account = NULL;
+    p->arena = 1;
+    p->frozen = 0;
 
     return p;
 }
 
 
+void
+ngx_pool_freeze(ngx_pool_t *pool)
+{
+    if (!pool->arena || pool->frozen) {
+        return;
+    }
+
+    pool->frozen = 1;
+
+    ngx_pool_protect(pool, 1);
+}
+
+
+static void
+ngx_pool_protect(ngx_pool_t *pool, ngx_uint_t readonly)
+{
+#if (NGX_HAVE_POSIX_MEMALIGN || NGX_HAVE_MEMALIGN)
+
+    int                prot;
+    ngx_pool_t        *p;
+    ngx_pool_large_t  *l;
+
+    prot = readonly ? PROT_READ : PROT_READ|PROT_WRITE;
+
+    for (l = pool->large; l; l = l->next) {
+        if (l->alloc && mprotect(l->alloc, l->size, prot) == -1) {
+            ngx_log_error(NGX_LOG_ALERT, pool->log, ngx_errno,
+                          "mprotect(%p, %uz, %d) failed",
+                          l->alloc, l->size, prot);
+        }
+    }
+
+    for (p = pool; p; p = p->d.next) {
+        if (mprotect(p, p->d.end - (u_char *) p, prot) == -1) {
+            ngx_log_error(NGX_LOG_ALERT, pool->log, ngx_errno,
+                          "mprotect(%p, %uz, %d) failed",
+                          p, p->d.end - (u_char *) p, prot);
+        }
+    }
+
+#endif
+}
+
+
 void
 ngx_destroy_pool(ngx_pool_t *pool)
 {
     ngx_pool_t          *p, *n;
     ngx_pool_large_t    *l;
     ngx_pool_cleanup_t  *c;
+    ngx_pool_account_t  *a;
+
+    if (pool->frozen) {
+        ngx_pool_protect(pool, 0);
+    }
 
     for (c = pool->cleanup; c; c = c->next) {
         if (c->handler) {
@@ -80,14 +246,33 @@ ngx_destroy_pool(ngx_pool_t *pool)
 
 #endif
 
+    a = pool->account;
+
+    if (a) {
+        a->pools--;
+    }
+
     for (l = pool->large; l; l = l->next) {
         if (l->alloc) {
-            ngx_free(l->alloc);
+            if (a) {
+                a->size -= l->size;
+            }
+
+            ngx_pool_free_large(l);
         }
     }
 
     for (p = pool, n = pool->d.next; /* void */; p = n, n = n->d.next) {
-        ngx_free(p);
+        if (a) {
+            a->size -= p->d.end - (u_char *) p;
+        }
+
+        if (pool->arena) {
+            ngx_free(p);
+
+        } else {
+            ngx_pool_cache_free(p, p->d.end - (u_char *) p);
+        }
 
         if (n == NULL) {
             break;
@@ -104,7 +289,11 @@ ngx_reset_pool(ngx_pool_t *pool)
 
     for (l = pool->large; l; l = l->next) {
         if (l->alloc) {
-            ngx_free(l->alloc);
+            if (pool->account) {
+                pool->account->size -= l->size;
+            }
+
+            ngx_pool_free_large(l);
         }
     }
 
@@ -122,6 +311,11 @@ ngx_reset_pool(ngx_pool_t *pool)
 void *
 ngx_palloc(ngx_pool_t *pool, size_t size)
 {
+    if (pool->account) {
+        pool->account->allocs++;
+        pool->account->requested += size;
+    }
+
 #if !(NGX_DEBUG_PALLOC)
     if (size <= pool->max) {
         return ngx_palloc_small(pool, size, 1);
@@ -135,6 +329,11 @@ ngx_palloc(ngx_pool_t *pool, size_t size)
 void *
 ngx_pnalloc(ngx_pool_t *pool, size_t size)
 {
+    if (pool->account) {
+        pool->account->allocs++;
+        pool->account->requested += size;
+    }
+
 #if !(NGX_DEBUG_PALLOC)
     if (size <= pool->max) {
         return ngx_palloc_small(pool, size, 0);
@@ -183,11 +382,21 @@ ngx_palloc_block(ngx_pool_t *pool, size_t size)
 
     psize = (size_t) (pool->d.end - (u_char *) pool);
 
-    m = ngx_memalign(NGX_POOL_ALIGNMENT, psize, pool->log);
+    if (pool->arena) {
+        m = ngx_memalign(ngx_pagesize, psize, pool->log);
+
+    } else {
+        m = ngx_pool_cache_alloc(psize, pool->log);
+    }
+
     if (m == NULL) {
         return NULL;
     }
 
+    if (pool->account) {
+        pool->account->size += psize;
+    }
+
     new = (ngx_pool_t *) m;
 
     new->d.end = m + psize;
@@ -217,16 +426,33 @@ ngx_palloc_large(ngx_pool_t *pool, size_t size)
     ngx_uint_t         n;
     ngx_pool_large_t  *large;
 
-    p = ngx_alloc(size, pool->log);
+    if (pool->arena) {
+        size = ngx_align(size, ngx_pagesize);
+        p = ngx_memalign(ngx_pagesize, size, pool->log);
+
+    } else if (ngx_pool_cache_class(size) != NGX_DECLINED) {
+        p = ngx_pool_cache_alloc(size, pool->log);
+
+    } else {
+        p = ngx_alloc(size, pool->log);
+    }
+
     if (p == NULL) {
         return NULL;
     }
 
+    if (pool->account) {
+        pool->account->size += size;
+    }
+
     n = 0;
 
     for (large = pool->large; large; large = large->next) {
         if (large->alloc == NULL) {
             large->alloc = p;
+            large->size = size;
+            large->buffer = 0;
+            large->nocache = pool->arena;
             return p;
         }
 
@@ -237,11 +463,24 @@ ngx_palloc_large(ngx_pool_t *pool, size_t size)
 
     large = ngx_palloc_small(pool, sizeof(ngx_pool_large_t), 1);
     if (large == NULL) {
-        ngx_free(p);
+        if (pool->account) {
+            pool->account->size -= size;
+        }
+
+        if (pool->arena) {
+            ngx_free(p);
+
+        } else {
+            ngx_pool_cache_free(p, size);
+        }
+
         return NULL;
     }
 
     large->alloc = p;
+    large->size = size;
+    large->buffer = 0;
+    large->nocache = pool->arena;
     large->next = pool->large;
     pool->large = large;
 
@@ -255,6 +494,19 @@ ngx_pmemalign(ngx_pool_t *pool, size_t size, size_t alignment)
     void              *p;
     ngx_pool_large_t  *large;
 
+    if (pool->account) {
+        pool->account->allocs++;
+        pool->account->requested += size;
+    }
+
+    if (pool->arena) {
+
+        /* arena memory is protected by pages */
+
+        size = ngx_align(size, ngx_pagesize);
+        alignment = ngx_max(alignment, ngx_pagesize);
+    }
+
     p = ngx_memalign(alignment, size, pool->log);
     if (p == NULL) {
         return NULL;
@@ -266,7 +518,14 @@ ngx_pmemalign(ngx_pool_t *pool, size_t size, size_t alignment)
         return NULL;
     }
 
+    if (pool->account) {
+        pool->account->size += size;
+    }
+
     large->alloc = p;
+    large->size = size;
+    large->buffer = 0;
+    large->nocache = 1;
     large->next = pool->large;
     pool->large = large;
 
@@ -283,7 +542,12 @@ ngx_pfree(ngx_pool_t *pool, void *p)
         if (p == l->alloc) {
             ngx_log_debug1(NGX_LOG_DEBUG_ALLOC, pool->log, 0,
                            "free: %p", l->alloc);
-            ngx_free(l->alloc);
+
+            if (pool->account) {
+                pool->account->size -= l->size;
+            }
+
+            ngx_pool_free_large(l);
             l->alloc = NULL;
 
             return NGX_OK;
@@ -294,6 +558,348 @@ ngx_pfree(ngx_pool_t *pool, void *p)
 }
 
 
+static ngx_inline ngx_int_t
+ngx_pool_cache_class(size_t size)
+{
+    ngx_uint_t  shift;
+
+    if (size & (size - 1)) {
+        return NGX_DECLINED;
+    }
+
+    for (shift = NGX_POOL_CACHE_MIN_SHIFT;
+         shift <= NGX_POOL_CACHE_MAX_SHIFT;
+         shift++)
+    {
+        if (size == (size_t) 1 << shift) {
+            return shift - NGX_POOL_CACHE_MIN_SHIFT;
+        }
+    }
+
+    return NGX_DECLINED;
+}
+
+
+static void *
+ngx_pool_cache_alloc(size_t size, ngx_log_t *log)
+{
+    void       *p;
+    ngx_int_t   n;
+
+    if (ngx_pool_cache_max) {
+        n = ngx_pool_cache_class(size);
+
+        if (n != NGX_DECLINED) {
+            p = ngx_pool_cache_get(&ngx_pool_cache[n]);
+
+            if (p) {
+                return p;
+            }
+        }
+    }
+
+    return ngx_memalign(NGX_POOL_ALIGNMENT, size, log);
+}
+
+
+static void
+ngx_pool_cache_free(void *p, size_t size)
+{
+    ngx_int_t  n;
+
+    n = ngx_pool_cache_class(size);
+
+    if (n == NGX_DECLINED
+        || ngx_pool_cache_put(&ngx_pool_cache[n], p) != NGX_OK)
+    {
+        ngx_free(p);
+    }
+}
+
+
+void *
+ngx_palloc_buffer(ngx_pool_t *pool, size_t size)
+{
+    void                    *p;
+    ngx_pool_large_t        *large;
+    ngx_pool_cache_class_t  *cls;
+
+    if (ngx_pool_cache_max == 0 || size < ngx_pagesize) {
+        return ngx_palloc(pool, size);
+    }
+
+    if (pool->account) {
+        pool->account->allocs++;
+        pool->account->requested += size;
+    }
+
+    size = ngx_align(size, ngx_pagesize);
+
+    cls = ngx_pool_buffer_class(size);
+
+    p = cls ? ngx_pool_cache_get(cls) : NULL;
+
+    if (p == NULL) {
+        p = ngx_memalign(ngx_pagesize, size, pool->log);
+        if (p == NULL) {
+            return NULL;
+        }
+    }
+
+    large = ngx_palloc_small(pool, sizeof(ngx_pool_large_t), 1);
+    if (large == NULL) {
+        ngx_free(p);
+        return NULL;
+    }
+
+    if (pool->account) {
+        pool->account->size += size;
+    }
+
+    large->alloc = p;
+    large->size = size;
+    large->buffer = 1;
+    large->nocache = 0;
+    large->next = pool->large;
+    pool->large = large;
+
+    return p;
+}
+
+
+static ngx_pool_cache_class_t *
+ngx_pool_buffer_class(size_t size)
+{
+    ngx_uint_t  i;
+
+    for (i = 0; i < NGX_POOL_BUFFER_CLASSES; i++) {
+
+        if (ngx_pool_buffers[i].size == size) {
+            return &ngx_pool_buffers[i];
+        }
+
+        if (ngx_pool_buffers[i].size == 0) {
+            ngx_pool_buffers[i].size = size;
+            return &ngx_pool_buffers[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+static void
+ngx_pool_free_large(ngx_pool_large_t *l)
+{
+    ngx_pool_cache_class_t  *cls;
+
+    if (l->nocache) {
+        ngx_free(l->alloc);
+        return;
+    }
+
+    if (!l->buffer) {
+        ngx_pool_cache_free(l->alloc, l->size);
+        return;
+    }
+
+    cls = ngx_pool_buffer_class(l->size);
+
+    if (cls == NULL || ngx_pool_cache_put(cls, l->alloc) != NGX_OK) {
+        ngx_free(l->alloc);
+    }
+}
+
+
+static void *
+ngx_pool_cache_get(ngx_pool_cache_class_t *cls)
+{
+    ngx_pool_cache_block_t  *b;
+
+    b = cls->free;
+
+    if (b == NULL) {
+        return NULL;
+    }
+
+    cls->free = b->next;
+
+    if (--cls->nfree < cls->low) {
+        cls->low = cls->nfree;
+    }
+
+    ngx_pool_cache_size -= cls->size;
+
+    return b;
+}
+
+
+static ngx_int_t
+ngx_pool_cache_put(ngx_pool_cache_class_t *cls, void *p)
+{
+    ngx_pool_cache_block_t  *b;
+
+    if (ngx_pool_cache_max == 0
+        || ngx_pool_cache_size + cls->size > ngx_pool_cache_max)
+    {
+        return NGX_DECLINED;
+    }
+
+    b = p;
+    b->next = cls->free;
+    cls->free = b;
+    cls->nfree++;
+
+    ngx_pool_cache_size += cls->size;
+
+    return NGX_OK;
+}
+
+
+void
+ngx_pool_cache_init(size_t size)
+{
+    ngx_uint_t  i;
+
+    ngx_pool_cache_max = size;
+
+    for (i = 0; i < NGX_POOL_CACHE_CLASSES; i++) {
+        ngx_pool_cache[i].size = (size_t) 1 << (i + NGX_POOL_CACHE_MIN_SHIFT);
+    }
+}
+
+
+/*
+ * Blocks that stayed in the cache since the previous call are freed,
+ * so the cache follows the working set of the process.
+ */
+
+void
+ngx_pool_cache_trim(void)
+{
+    ngx_uint_t  i;
+
+    for (i = 0; i < NGX_POOL_CACHE_CLASSES; i++) {
+        ngx_pool_cache_trim_class(&ngx_pool_cache[i]);
+    }
+
+    for (i = 0; i < NGX_POOL_BUFFER_CLASSES; i++) {
+        ngx_pool_cache_trim_class(&ngx_pool_buffers[i]);
+    }
+}
+
+
+static void
+ngx_pool_cache_trim_class(ngx_pool_cache_class_t *cls)
+{
+    ngx_pool_cache_block_t  *b;
+
+    while (cls->low) {
+        b = cls->free;
+        cls->free = b->next;
+
+        cls->nfree--;
+        cls->low--;
+
+        ngx_pool_cache_size -= cls->size;
+
+        ngx_free(b);
+    }
+
+    cls->low = cls->nfree;
+}
+
+
+size_t
+ngx_pool_used(ngx_pool_t *pool)
+{
+    size_t       used;
+    ngx_pool_t  *p;
+
+    used = 0;
+
+    for (p = pool; p; p = p->d.next) {
+        used += p->d.last - (u_char *) p;
+    }
+
+    return used;
+}
+
+
+/*
+ * Updates the moving average of the memory used from pools, and sets
+ * the size of new pools to the power of two above it with some headroom.
+ * A power of two no less than NGX_MIN_POOL_SIZE is also a valid pool size
+ * as checked for the configured ones.
+ */
+
+void
+ngx_pool_adapt(ngx_pool_adapt_t *pa, ngx_pool_t *pool)
+{
+    size_t  used, n;
+
+    used = ngx_pool_used(pool);
+
+    if (pa->usage == 0) {
+        pa->usage = used;
+
+    } else {
+        pa->usage = pa->usage - pa->usage / 16 + used / 16;
+    }
+
+    used = pa->usage + pa->usage / 4;
+
+    n = (size_t) 1 << NGX_POOL_CACHE_MIN_SHIFT;
+
+    while ((n < used || n < NGX_MIN_POOL_SIZE)
+           && n < (size_t) 1 << NGX_POOL_CACHE_MAX_SHIFT)
+    {
+        n <<= 1;
+    }
+
+    pa->size = n;
+}
+
+
+/*
+ * Moves the memory held by a pool to the account of its owner.
+ * Pools created before accounting was enabled are accounted here.
+ */
+
+void
+ngx_pool_set_tag(ngx_pool_t *pool, ngx_uint_t tag)
+{
+    size_t             size;
+    ngx_pool_t        *p;
+    ngx_pool_large_t  *l;
+
+    if (!ngx_pool_accounting) {
+        return;
+    }
+
+    size = 0;
+
+    for (p = pool; p; p = p->d.next) {
+        size += p->d.end - (u_char *) p;
+    }
+
+    for (l = pool->large; l; l = l->next) {
+        if (l->alloc) {
+            size += l->size;
+        }
+    }
+
+    if (pool->account) {
+        pool->account->pools--;
+        pool->account->size -= size;
+    }
+
+    pool->account = &ngx_pool_accounts[tag];
+    pool->account->pools++;
+    pool->account->size += size;
+}
+
+
 void *
 ngx_pcalloc(ngx_pool_t *pool, size_t size)
 {
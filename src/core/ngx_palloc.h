@@ -27,6 +27,14 @@
               NGX_POOL_ALIGNMENT)
 
 
+#define NGX_POOL_OTHER           0
+#define NGX_POOL_CYCLE           1
+#define NGX_POOL_CONNECTION      2
+#define NGX_POOL_REQUEST         3
+#define NGX_POOL_UPSTREAM        4
+#define NGX_POOL_TAGS            5
+
+
 typedef void (*ngx_pool_cleanup_pt)(void *data);
 
 typedef struct ngx_pool_cleanup_s  ngx_pool_cleanup_t;
@@ -43,9 +51,26 @@ typedef struct ngx_pool_large_s  ngx_pool_large_t;
 struct ngx_pool_large_s {
     ngx_pool_large_t     *next;
     void                 *alloc;
+    size_t                size;
+    unsigned              buffer:1;
+    unsigned              nocache:1;
 };
 
 
+typedef struct {
+    ngx_uint_t            pools;
+    size_t                size;       /* memory held by pools */
+    ngx_uint_t            allocs;
+    size_t                requested;  /* bytes requested by allocations */
+} ngx_pool_account_t;
+
+
+typedef struct {
+    size_t                size;
+    size_t                usage;      /* moving average of memory used */
+} ngx_pool_adapt_t;
+
+
 typedef struct {
     u_char               *last;
     u_char               *end;
@@ -62,6 +87,9 @@ struct ngx_pool_s {
     ngx_pool_large_t     *large;
     ngx_pool_cleanup_t   *cleanup;
     ngx_log_t            *log;
+    ngx_pool_account_t   *account;
+    unsigned              arena:1;
+    unsigned              frozen:1;
 };
 
 
@@ -73,13 +101,22 @@ typedef struct {
 
 
 ngx_pool_t *ngx_create_pool(size_t size, ngx_log_t *log);
+ngx_pool_t *ngx_create_arena(size_t size, ngx_log_t *log);
+void ngx_pool_freeze(ngx_pool_t *pool);
 void ngx_destroy_pool(ngx_pool_t *pool);
 void ngx_reset_pool(ngx_pool_t *pool);
 
+void ngx_pool_cache_init(size_t size);
+void ngx_pool_cache_trim(void);
+size_t ngx_pool_used(ngx_pool_t *pool);
+void ngx_pool_adapt(ngx_pool_adapt_t *pa, ngx_pool_t *pool);
+void ngx_pool_set_tag(ngx_pool_t *pool, ngx_uint_t tag);
+
 void *ngx_palloc(ngx_pool_t *pool, size_t size);
 void *ngx_pnalloc(ngx_pool_t *pool, size_t size);
 void *ngx_pcalloc(ngx_pool_t *pool, size_t size);
 void *ngx_pmemalign(ngx_pool_t *pool, size_t size, size_t alignment);
+void *ngx_palloc_buffer(ngx_pool_t *pool, size_t size);
 ngx_int_t ngx_pfree(ngx_pool_t *pool, void *p);
 
 
@@ -89,4 +126,9 @@ void ngx_pool_cleanup_file(void *data);
 void ngx_pool_delete_file(void *data);
 
 
+extern ngx_uint_t          ngx_pool_accounting;
+extern ngx_pool_account_t  ngx_pool_accounts[NGX_POOL_TAGS];
+extern ngx_str_t           ngx_pool_tags[NGX_POOL_TAGS];
+
+
 #endif /* _NGX_PALLOC_H_INCLUDED_ */
@@ -55,6 +55,38 @@ ngx_parse_size(ngx_str_t *line)
 }
 
 
+/*
+ * Parses "on", "off", or a huge page size such as "2m" or "1g".
+ * Returns the size of huge pages, or 0 if huge pages are not used.
+ */
+
+ssize_t
+ngx_parse_hugepages(ngx_str_t *line)
+{
+    off_t  size;
+
+    if (line->len == 3 && ngx_strncmp(line->data, "off", 3) == 0) {
+        return 0;
+    }
+
+    if (line->len == 2 && ngx_strncmp(line->data, "on", 2) == 0) {
+        return ngx_hugepage_size;
+    }
+
+    size = ngx_parse_offset(line);
+
+    if (size == NGX_ERROR
+        || size <= (off_t) ngx_pagesize
+        || size > NGX_MAX_SIZE_T_VALUE
+        || (size & (size - 1)))
+    {
+        return NGX_ERROR;
+    }
+
+    return (ssize_t) size;
+}
+
+
 off_t
 ngx_parse_offset(ngx_str_t *line)
 {
@@ -87,6 +87,13 @@ struct ngx_queue_s {
 #endif
 
 
+/* the element was copied to "x", link its neighbours to the copy */
+
+#define ngx_queue_move(x)                                                     \
+    (x)->next->prev = x;                                                      \
+    (x)->prev->next = x
+
+
 #define ngx_queue_split(h, q, n)                                              \
     (n)->prev = (h)->prev;                                                    \
     (n)->prev->next = n;                                                      \
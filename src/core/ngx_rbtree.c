@@ -402,3 +402,36 @@ ngx_rbtree_next(ngx_rbtree_t *tree, ngx_rbtree_node_t *node)
         node = parent;
     }
 }
+
+
+/*
+ * The node was copied from the "old" location, which is not accessed,
+ * so it may be already freed.
+ */
+
+void
+ngx_rbtree_move(ngx_rbtree_t *tree, ngx_rbtree_node_t *old,
+    ngx_rbtree_node_t *node)
+{
+    ngx_rbtree_node_t  *sentinel;
+
+    sentinel = tree->sentinel;
+
+    if (tree->root == old) {
+        tree->root = node;
+
+    } else if (node->parent->left == old) {
+        node->parent->left = node;
+
+    } else {
+        node->parent->right = node;
+    }
+
+    if (node->left != sentinel) {
+        node->left->parent = node;
+    }
+
+    if (node->right != sentinel) {
+        node->right->parent = node;
+    }
+}
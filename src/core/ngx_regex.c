@@ -26,6 +26,9 @@ static void * ngx_libc_cdecl ngx_regex_malloc(size_t size);
 static void ngx_libc_cdecl ngx_regex_free(void *p);
 #endif
 static void ngx_regex_cleanup(void *data);
+#if (NGX_PCRE2)
+static u_char *ngx_regex_copy_groups(u_char *dst, ngx_str_t *pattern);
+#endif
 
 static ngx_int_t ngx_regex_module_init(ngx_cycle_t *cycle);
 
@@ -495,6 +498,326 @@ ngx_regex_exec_array(ngx_array_t *a, ngx_str_t *s, ngx_log_t *log)
 }
 
 
+#if (NGX_PCRE2)
+
+/*
+ * Patterns anchored at the start of a subject, like "^/api/", are combined
+ * into a single regex, which tries them in order and marks the first one
+ * that matched.  Patterns which refer to groups by number, use verbs or
+ * change options in an unusual way are not combined, as well as patterns
+ * with the top level alternation, which are not anchored as a whole.
+ */
+
+ngx_uint_t
+ngx_regex_combinable(ngx_regex_compile_t *rc)
+{
+    u_char      ch, *p, *last;
+    ngx_int_t   depth;
+
+    if (rc->options & ~NGX_REGEX_CASELESS) {
+        return 0;
+    }
+
+    p = rc->pattern.data;
+    last = p + rc->pattern.len;
+
+    if (p == last || *p != '^') {
+        return 0;
+    }
+
+    depth = 0;
+
+    while (p < last) {
+        ch = *p++;
+
+        switch (ch) {
+
+        case '\\':
+            if (p == last) {
+                return 0;
+            }
+
+            ch = *p++;
+
+            if ((ch >= '0' && ch <= '9')
+                || ch == 'g' || ch == 'k' || ch == 'Q' || ch == 'c')
+            {
+                return 0;
+            }
+
+            break;
+
+        case '[':
+            if (p < last && *p == '^') {
+                p++;
+            }
+
+            if (p < last && *p == ']') {
+                p++;
+            }
+
+            while (p < last && *p != ']') {
+
+                if (*p == '\\') {
+                    if (++p == last || *p == 'Q' || *p == 'c') {
+                        return 0;
+                    }
+
+                } else if (*p == '[' && p + 1 < last && p[1] == ':') {
+                    p = ngx_strlchr(p + 2, last, ']');
+                    if (p == NULL) {
+                        return 0;
+                    }
+                }
+
+                p++;
+            }
+
+            if (p == last) {
+                return 0;
+            }
+
+            p++;
+            break;
+
+        case '(':
+            if (p < last && *p == '*') {
+                return 0;
+            }
+
+            if (p < last && *p == '?') {
+                if (++p == last) {
+                    return 0;
+                }
+
+                switch (*p) {
+                case ':':
+                case '=':
+                case '!':
+                case '>':
+                case '<':
+                    break;
+
+                case 'P':
+                    if (p + 1 == last || p[1] != '<') {
+                        return 0;
+                    }
+                    break;
+
+                case 'i':
+                    if (p + 1 == last || (p[1] != ')' && p[1] != ':')) {
+                        return 0;
+                    }
+                    break;
+
+                default:
+                    return 0;
+                }
+            }
+
+            depth++;
+            break;
+
+        case ')':
+            if (--depth < 0) {
+                return 0;
+            }
+
+            break;
+
+        case '|':
+            if (depth == 0) {
+                return 0;
+            }
+
+            break;
+        }
+    }
+
+    return 1;
+}
+
+
+ngx_int_t
+ngx_regex_combine(ngx_regex_compile_t *rc, ngx_regex_compile_t *elts,
+    ngx_uint_t n)
+{
+    u_char      *p;
+    size_t       len;
+    ngx_uint_t   i;
+
+    len = sizeof("\\A(?:)") - 1;
+
+    /* each "(" may become "(?:" */
+
+    for (i = 0; i < n; i++) {
+        len += sizeof("|(?i:)(*MARK:)") - 1 + NGX_INT_T_LEN
+               + 3 * elts[i].pattern.len;
+    }
+
+    p = ngx_pnalloc(rc->pool, len);
+    if (p == NULL) {
+        rc->err.len = ngx_snprintf(rc->err.data, rc->err.len,
+                                   "regex combining failed: no memory")
+                      - rc->err.data;
+        return NGX_ERROR;
+    }
+
+    rc->pattern.data = p;
+
+    p = ngx_cpymem(p, "\\A(?:", sizeof("\\A(?:") - 1);
+
+    for (i = 0; i < n; i++) {
+        if (i) {
+            *p++ = '|';
+        }
+
+        if (elts[i].options & NGX_REGEX_CASELESS) {
+            p = ngx_cpymem(p, "(?i:", sizeof("(?i:") - 1);
+
+        } else {
+            p = ngx_cpymem(p, "(?:", sizeof("(?:") - 1);
+        }
+
+        p = ngx_regex_copy_groups(p, &elts[i].pattern);
+        p = ngx_sprintf(p, ")(*MARK:%ui)", i);
+    }
+
+    *p++ = ')';
+
+    rc->pattern.len = p - rc->pattern.data;
+    rc->options = 0;
+
+    return ngx_regex_compile(rc);
+}
+
+
+/*
+ * copies a combinable pattern with its groups made non-capturing: the
+ * combined regex only tells which pattern matched, and pcre2_match() saves
+ * all captures on each backtracking step, which is slow with hundreds
+ * of them
+ */
+
+static u_char *
+ngx_regex_copy_groups(u_char *dst, ngx_str_t *pattern)
+{
+    u_char  ch, *p, *last;
+
+    p = pattern->data;
+    last = p + pattern->len;
+
+    while (p < last) {
+        ch = *p++;
+
+        switch (ch) {
+
+        case '\\':
+            *dst++ = ch;
+            *dst++ = *p++;
+            break;
+
+        case '[':
+            *dst++ = ch;
+
+            if (*p == '^') {
+                *dst++ = *p++;
+            }
+
+            if (*p == ']') {
+                *dst++ = *p++;
+            }
+
+            while (*p != ']') {
+
+                if (*p == '\\') {
+                    *dst++ = *p++;
+
+                } else if (*p == '[' && p[1] == ':') {
+                    while (*p != ']') {
+                        *dst++ = *p++;
+                    }
+                }
+
+                *dst++ = *p++;
+            }
+
+            *dst++ = *p++;
+            break;
+
+        case '(':
+            if (*p != '?') {
+                dst = ngx_cpymem(dst, "(?:", sizeof("(?:") - 1);
+                break;
+            }
+
+            /* named groups, "(?<name>" and "(?P<name>" */
+
+            if (p[1] == 'P' || (p[1] == '<' && p[2] != '=' && p[2] != '!')) {
+                p = ngx_strlchr(p, last, '>') + 1;
+                dst = ngx_cpymem(dst, "(?:", sizeof("(?:") - 1);
+                break;
+            }
+
+            /* other groups and options are kept */
+
+            *dst++ = ch;
+            break;
+
+        default:
+            *dst++ = ch;
+        }
+    }
+
+    return dst;
+}
+
+
+/* returns the index of the matched pattern of a combined regex */
+
+ngx_int_t
+ngx_regex_exec_combined(ngx_regex_t *re, ngx_str_t *s)
+{
+    ngx_int_t   rc;
+    PCRE2_SPTR  mark;
+
+    ngx_regex_malloc_init(NULL);
+
+    if (ngx_regex_match_data == NULL) {
+        ngx_regex_match_data_size = 0;
+        ngx_regex_match_data = pcre2_match_data_create(0, NULL);
+
+        if (ngx_regex_match_data == NULL) {
+            rc = PCRE2_ERROR_NOMEMORY;
+            goto failed;
+        }
+    }
+
+    rc = pcre2_match(re, s->data, s->len, 0, 0, ngx_regex_match_data, NULL);
+
+    if (rc < 0) {
+        goto failed;
+    }
+
+    mark = pcre2_get_mark(ngx_regex_match_data);
+
+    rc = (mark == NULL) ? NGX_ERROR
+                        : ngx_atoi((u_char *) mark, ngx_strlen(mark));
+
+    if (rc == NGX_ERROR) {
+        rc = PCRE2_ERROR_INTERNAL;
+    }
+
+failed:
+
+    ngx_regex_malloc_done();
+
+    return rc;
+}
+
+#endif
+
+
 #if (NGX_PCRE2)
 
 static void * ngx_libc_cdecl
@@ -20,6 +20,12 @@
 
 #define NGX_REGEX_NO_MATCHED   PCRE2_ERROR_NOMATCH   /* -1 */
 
+/*
+ * pcre2_match() start up cost grows with the size of a regex,
+ * so longer runs of regexes are split
+ */
+#define NGX_REGEX_COMBINE_MAX  32
+
 typedef pcre2_code  ngx_regex_t;
 
 #else
@@ -74,5 +80,12 @@ ngx_int_t ngx_regex_exec(ngx_regex_t *re, ngx_str_t *s, int *captures,
 
 ngx_int_t ngx_regex_exec_array(ngx_array_t *a, ngx_str_t *s, ngx_log_t *log);
 
+#if (NGX_PCRE2)
+ngx_uint_t ngx_regex_combinable(ngx_regex_compile_t *rc);
+ngx_int_t ngx_regex_combine(ngx_regex_compile_t *rc, ngx_regex_compile_t *elts,
+    ngx_uint_t n);
+ngx_int_t ngx_regex_exec_combined(ngx_regex_t *re, ngx_str_t *s);
+#endif
+
 
 #endif /* _NGX_REGEX_H_INCLUDED_ */
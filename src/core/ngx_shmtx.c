@@ -19,6 +19,8 @@ ngx_int_t
 ngx_shmtx_create(ngx_shmtx_t *mtx, ngx_shmtx_sh_t *addr, u_char *name)
 {
     mtx->lock = &addr->lock;
+    mtx->waits = &addr->waits;
+    mtx->spins = &addr->spins;
 
     if (mtx->spin == (ngx_uint_t) -1) {
         return NGX_OK;
@@ -69,14 +71,14 @@ ngx_shmtx_trylock(ngx_shmtx_t *mtx)
 void
 ngx_shmtx_lock(ngx_shmtx_t *mtx)
 {
-    ngx_uint_t         i, n;
+    ngx_uint_t         i, n, spins;
 
     ngx_log_debug0(NGX_LOG_DEBUG_CORE, ngx_cycle->log, 0, "shmtx lock");
 
-    for ( ;; ) {
+    for (spins = 0; /* void */; spins++) {
 
         if (*mtx->lock == 0 && ngx_atomic_cmp_set(mtx->lock, 0, ngx_pid)) {
-            return;
+            goto done;
         }
 
         if (ngx_ncpu > 1) {
@@ -87,10 +89,12 @@ ngx_shmtx_lock(ngx_shmtx_t *mtx)
                     ngx_cpu_pause();
                 }
 
+                spins++;
+
                 if (*mtx->lock == 0
                     && ngx_atomic_cmp_set(mtx->lock, 0, ngx_pid))
                 {
-                    return;
+                    goto done;
                 }
             }
         }
@@ -102,7 +106,7 @@ ngx_shmtx_lock(ngx_shmtx_t *mtx)
 
             if (*mtx->lock == 0 && ngx_atomic_cmp_set(mtx->lock, 0, ngx_pid)) {
                 (void) ngx_atomic_fetch_add(mtx->wait, -1);
-                return;
+                goto done;
             }
 
             ngx_log_debug1(NGX_LOG_DEBUG_CORE, ngx_cycle->log, 0,
@@ -130,6 +134,15 @@ ngx_shmtx_lock(ngx_shmtx_t *mtx)
 
         ngx_sched_yield();
     }
+
+done:
+
+    /* contended acquisitions are counted in the shared part of the mutex */
+
+    if (spins) {
+        (void) ngx_atomic_fetch_add(mtx->waits, 1);
+        (void) ngx_atomic_fetch_add(mtx->spins, spins);
+    }
 }
 
 
@@ -286,6 +299,19 @@ ngx_shmtx_lock(ngx_shmtx_t *mtx)
 }
 
 
+ngx_uint_t
+ngx_shmtx_lock_spins(ngx_shmtx_t *mtx)
+{
+    if (ngx_shmtx_trylock(mtx)) {
+        return 0;
+    }
+
+    ngx_shmtx_lock(mtx);
+
+    return 1;
+}
+
+
 void
 ngx_shmtx_unlock(ngx_shmtx_t *mtx)
 {
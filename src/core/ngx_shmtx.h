@@ -18,12 +18,16 @@ typedef struct {
 #if (NGX_HAVE_POSIX_SEM)
     ngx_atomic_t   wait;
 #endif
+    ngx_atomic_t   waits;    /* contended acquisitions */
+    ngx_atomic_t   spins;    /* failed attempts to acquire */
 } ngx_shmtx_sh_t;
 
 
 typedef struct {
 #if (NGX_HAVE_ATOMIC_OPS)
     ngx_atomic_t  *lock;
+    ngx_atomic_t  *waits;
+    ngx_atomic_t  *spins;
 #if (NGX_HAVE_POSIX_SEM)
     ngx_atomic_t  *wait;
     ngx_uint_t     semaphore;
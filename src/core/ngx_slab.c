@@ -41,6 +41,11 @@
 #endif
 
 
+/* pages of a size class looked at to choose a page to evacuate */
+
+#define NGX_SLAB_COMPACT_PAGES  16
+
+
 #define ngx_slab_slots(pool)                                                  \
     (ngx_slab_page_t *) ((u_char *) (pool) + sizeof(ngx_slab_pool_t))
 
@@ -69,6 +74,43 @@
 
 #endif
 
+/*
+ * Worker processes may keep small numbers of free chunks of each size
+ * in magazines, so most allocations and frees do not need the pool mutex.
+ * Magazines are refilled and flushed in batches.  They are allocated from
+ * the pool and listed there with the pid of the owner, so the master
+ * process returns the chunks cached by a process which exited abnormally.
+ */
+
+typedef struct {
+    ngx_uint_t            n;
+    void                **chunks;
+} ngx_slab_magazine_t;
+
+
+struct ngx_slab_cache_s {
+    ngx_slab_cache_t     *next;
+    ngx_slab_pool_t      *pool;
+    ngx_pid_t             pid;
+    ngx_slab_magazine_t  *magazines;
+};
+
+
+static ngx_slab_account_t *ngx_slab_account(ngx_slab_pool_t *pool);
+static void *ngx_slab_alloc_chunk(ngx_slab_pool_t *pool, size_t size);
+static void ngx_slab_free_chunk(ngx_slab_pool_t *pool, void *p);
+static void *ngx_slab_cache_alloc(ngx_slab_pool_t *pool, size_t size,
+    ngx_uint_t locked);
+static ngx_int_t ngx_slab_cache_free(ngx_slab_pool_t *pool, void *p,
+    ngx_uint_t locked);
+static ngx_slab_cache_t *ngx_slab_get_cache(ngx_slab_pool_t *pool,
+    ngx_uint_t locked);
+static void ngx_slab_cache_drain(ngx_slab_cache_t *cache);
+static ngx_uint_t ngx_slab_chunk_busy(ngx_slab_page_t *page, uintptr_t p,
+    ngx_uint_t shift);
+static ngx_uint_t ngx_slab_chunks(ngx_uint_t shift);
+static ngx_uint_t ngx_slab_page_used(ngx_slab_pool_t *pool,
+    ngx_slab_page_t *page, ngx_uint_t shift);
 static ngx_slab_page_t *ngx_slab_alloc_pages(ngx_slab_pool_t *pool,
     ngx_uint_t pages);
 static void ngx_slab_free_pages(ngx_slab_pool_t *pool, ngx_slab_page_t *page,
@@ -81,6 +123,19 @@ static ngx_uint_t  ngx_slab_max_size;
 static ngx_uint_t  ngx_slab_exact_size;
 static ngx_uint_t  ngx_slab_exact_shift;
 
+static ngx_uint_t  ngx_slab_npools;
+
+static ngx_uint_t   ngx_slab_compact_chunk;
+static uintptr_t   *ngx_slab_compact_cached;
+
+static ngx_uint_t          ngx_slab_cache_size;
+static ngx_slab_cache_t  **ngx_slab_caches;
+static ngx_uint_t          ngx_slab_ncaches;
+
+ngx_uint_t                  ngx_slab_accounting;
+static ngx_slab_account_t  *ngx_slab_accounts;
+static ngx_uint_t           ngx_slab_naccounts;
+
 
 void
 ngx_slab_sizes_init(void)
@@ -159,6 +214,11 @@ ngx_slab_init(ngx_slab_pool_t *pool)
     pool->last = pool->pages + pages;
     pool->pfree = pages;
 
+    pool->compact = NULL;
+    pool->caches = NULL;
+
+    pool->id = ngx_slab_npools++;
+
     pool->log_nomem = 1;
     pool->log_ctx = &pool->zero;
     pool->zero = '\0';
@@ -168,11 +228,25 @@ ngx_slab_init(ngx_slab_pool_t *pool)
 void *
 ngx_slab_alloc(ngx_slab_pool_t *pool, size_t size)
 {
-    void  *p;
+    void                *p;
+    ngx_slab_account_t  *a;
+
+    if (ngx_slab_accounting) {
+        a = ngx_slab_account(pool);
+
+        if (a) {
+            a->allocs++;
+            a->requested += size;
+        }
+    }
+
+    if (ngx_slab_cache_size && size <= ngx_slab_max_size) {
+        return ngx_slab_cache_alloc(pool, size, 0);
+    }
 
     ngx_shmtx_lock(&pool->mutex);
 
-    p = ngx_slab_alloc_locked(pool, size);
+    p = ngx_slab_alloc_chunk(pool, size);
 
     ngx_shmtx_unlock(&pool->mutex);
 
@@ -182,6 +256,28 @@ ngx_slab_alloc(ngx_slab_pool_t *pool, size_t size)
 
 void *
 ngx_slab_alloc_locked(ngx_slab_pool_t *pool, size_t size)
+{
+    ngx_slab_account_t  *a;
+
+    if (ngx_slab_accounting) {
+        a = ngx_slab_account(pool);
+
+        if (a) {
+            a->allocs++;
+            a->requested += size;
+        }
+    }
+
+    if (ngx_slab_cache_size && size <= ngx_slab_max_size) {
+        return ngx_slab_cache_alloc(pool, size, 1);
+    }
+
+    return ngx_slab_alloc_chunk(pool, size);
+}
+
+
+static void *
+ngx_slab_alloc_chunk(ngx_slab_pool_t *pool, size_t size)
 {
     size_t            s;
     uintptr_t         p, m, mask, *bitmap;
@@ -422,11 +518,10 @@ ngx_slab_calloc(ngx_slab_pool_t *pool, size_t size)
 {
     void  *p;
 
-    ngx_shmtx_lock(&pool->mutex);
-
-    p = ngx_slab_calloc_locked(pool, size);
-
-    ngx_shmtx_unlock(&pool->mutex);
+    p = ngx_slab_alloc(pool, size);
+    if (p) {
+        ngx_memzero(p, size);
+    }
 
     return p;
 }
@@ -449,9 +544,23 @@ ngx_slab_calloc_locked(ngx_slab_pool_t *pool, size_t size)
 void
 ngx_slab_free(ngx_slab_pool_t *pool, void *p)
 {
+    ngx_slab_account_t  *a;
+
+    if (ngx_slab_accounting) {
+        a = ngx_slab_account(pool);
+
+        if (a) {
+            a->frees++;
+        }
+    }
+
+    if (ngx_slab_cache_size && ngx_slab_cache_free(pool, p, 0) == NGX_OK) {
+        return;
+    }
+
     ngx_shmtx_lock(&pool->mutex);
 
-    ngx_slab_free_locked(pool, p);
+    ngx_slab_free_chunk(pool, p);
 
     ngx_shmtx_unlock(&pool->mutex);
 }
@@ -459,6 +568,27 @@ ngx_slab_free(ngx_slab_pool_t *pool, void *p)
 
 void
 ngx_slab_free_locked(ngx_slab_pool_t *pool, void *p)
+{
+    ngx_slab_account_t  *a;
+
+    if (ngx_slab_accounting) {
+        a = ngx_slab_account(pool);
+
+        if (a) {
+            a->frees++;
+        }
+    }
+
+    if (ngx_slab_cache_size && ngx_slab_cache_free(pool, p, 1) == NGX_OK) {
+        return;
+    }
+
+    ngx_slab_free_chunk(pool, p);
+}
+
+
+static void
+ngx_slab_free_chunk(ngx_slab_pool_t *pool, void *p)
 {
     size_t            size;
     uintptr_t         slab, m, *bitmap;
@@ -497,7 +627,7 @@ ngx_slab_free_locked(ngx_slab_pool_t *pool, void *p)
         if (bitmap[n] & m) {
             slot = shift - pool->min_shift;
 
-            if (page->next == NULL) {
+            if (page->next == NULL && page != pool->compact) {
                 slots = ngx_slab_slots(pool);
 
                 page->next = slots[slot].next;
@@ -592,7 +722,7 @@ ngx_slab_free_locked(ngx_slab_pool_t *pool, void *p)
         if (slab & m) {
             slot = shift - pool->min_shift;
 
-            if (page->next == NULL) {
+            if (page->next == NULL && page != pool->compact) {
                 slots = ngx_slab_slots(pool);
 
                 page->next = slots[slot].next;
@@ -674,6 +804,774 @@ fail:
 }
 
 
+void
+ngx_slab_cache_init(ngx_uint_t n)
+{
+    ngx_slab_cache_size = n;
+}
+
+
+static void *
+ngx_slab_cache_alloc(ngx_slab_pool_t *pool, size_t size, ngx_uint_t locked)
+{
+    void                 *p;
+    size_t                s;
+    ngx_uint_t            slot, shift;
+    ngx_slab_page_t      *slots;
+    ngx_slab_cache_t     *cache;
+    ngx_slab_magazine_t  *mag;
+
+    cache = ngx_slab_get_cache(pool, locked);
+
+    if (cache == NULL) {
+        goto nocache;
+    }
+
+    if (size > pool->min_size) {
+        shift = 1;
+        for (s = size - 1; s >>= 1; shift++) { /* void */ }
+        slot = shift - pool->min_shift;
+
+    } else {
+        shift = pool->min_shift;
+        slot = 0;
+    }
+
+    mag = &cache->magazines[slot];
+
+    if (mag->n) {
+        return mag->chunks[--mag->n];
+    }
+
+    if (!locked) {
+        ngx_shmtx_lock(&pool->mutex);
+    }
+
+    slots = ngx_slab_slots(pool);
+
+    if (slots[slot].next == &slots[slot] && pool->pfree == 0) {
+
+        /* out of memory, return the cached chunks to the pool */
+
+        ngx_slab_cache_drain(cache);
+    }
+
+    p = ngx_slab_alloc_chunk(pool, (size_t) 1 << shift);
+
+    if (p == NULL) {
+        goto done;
+    }
+
+    /*
+     * refill the magazine up to a half, but only from the pages already
+     * allocated for this size to avoid holding entire pages in workers
+     */
+
+    while (mag->n < (ngx_slab_cache_size + 1) / 2
+           && slots[slot].next != &slots[slot])
+    {
+        mag->chunks[mag->n++] = ngx_slab_alloc_chunk(pool, (size_t) 1 << shift);
+    }
+
+done:
+
+    if (!locked) {
+        ngx_shmtx_unlock(&pool->mutex);
+    }
+
+    return p;
+
+nocache:
+
+    if (locked) {
+        return ngx_slab_alloc_chunk(pool, size);
+    }
+
+    ngx_shmtx_lock(&pool->mutex);
+
+    p = ngx_slab_alloc_chunk(pool, size);
+
+    ngx_shmtx_unlock(&pool->mutex);
+
+    return p;
+}
+
+
+static ngx_int_t
+ngx_slab_cache_free(ngx_slab_pool_t *pool, void *p, ngx_uint_t locked)
+{
+    ngx_uint_t            i, n, shift;
+    ngx_slab_page_t      *page;
+    ngx_slab_cache_t     *cache;
+    ngx_slab_magazine_t  *mag;
+
+    if ((u_char *) p < pool->start || (u_char *) p >= pool->end) {
+        return NGX_DECLINED;
+    }
+
+    /*
+     * the type and the size of chunks of a page cannot change
+     * while the page has allocated chunks, so no lock is needed
+     */
+
+    n = ((u_char *) p - pool->start) >> ngx_pagesize_shift;
+    page = &pool->pages[n];
+
+    switch (ngx_slab_page_type(page)) {
+
+    case NGX_SLAB_SMALL:
+    case NGX_SLAB_BIG:
+        shift = page->slab & NGX_SLAB_SHIFT_MASK;
+        break;
+
+    case NGX_SLAB_EXACT:
+        shift = ngx_slab_exact_shift;
+        break;
+
+    default: /* NGX_SLAB_PAGE */
+        return NGX_DECLINED;
+    }
+
+    /*
+     * misaligned and already free chunks are left to ngx_slab_free_chunk(),
+     * which reports them; a chunk is marked busy while it is cached
+     */
+
+    if (((uintptr_t) p & (((uintptr_t) 1 << shift) - 1))
+        || !ngx_slab_chunk_busy(page, (uintptr_t) p, shift))
+    {
+        return NGX_DECLINED;
+    }
+
+    cache = ngx_slab_get_cache(pool, locked);
+
+    if (cache == NULL) {
+        return NGX_DECLINED;
+    }
+
+    mag = &cache->magazines[shift - pool->min_shift];
+
+    for (i = 0; i < mag->n; i++) {
+        if (mag->chunks[i] == p) {
+            ngx_slab_error(pool, NGX_LOG_ALERT,
+                           "ngx_slab_free(): chunk is already free");
+            return NGX_OK;
+        }
+    }
+
+    if (mag->n == ngx_slab_cache_size) {
+
+        /* flush a half of the magazine */
+
+        if (!locked) {
+            ngx_shmtx_lock(&pool->mutex);
+        }
+
+        while (mag->n > ngx_slab_cache_size / 2) {
+            ngx_slab_free_chunk(pool, mag->chunks[--mag->n]);
+        }
+
+        if (!locked) {
+            ngx_shmtx_unlock(&pool->mutex);
+        }
+    }
+
+    ngx_slab_junk(p, (size_t) 1 << shift);
+
+    mag->chunks[mag->n++] = p;
+
+    return NGX_OK;
+}
+
+
+static ngx_slab_cache_t *
+ngx_slab_get_cache(ngx_slab_pool_t *pool, ngx_uint_t locked)
+{
+    void                **chunks;
+    size_t                size;
+    ngx_uint_t            i, n, pages, nomem;
+    ngx_slab_page_t      *page;
+    ngx_slab_cache_t     *cache, **caches;
+    ngx_slab_magazine_t  *mag;
+
+    if (pool->id < ngx_slab_ncaches && ngx_slab_caches[pool->id]) {
+        return ngx_slab_caches[pool->id];
+    }
+
+    n = ngx_pagesize_shift - pool->min_shift;
+
+    size = sizeof(ngx_slab_cache_t)
+           + n * (sizeof(ngx_slab_magazine_t)
+                  + ngx_slab_cache_size * sizeof(void *));
+
+    pages = (size + ngx_pagesize - 1) >> ngx_pagesize_shift;
+
+    /* magazines would take too much of small zones */
+
+    if (pages * 64 > (ngx_uint_t) (pool->last - pool->pages)) {
+        return NULL;
+    }
+
+    if (pool->id >= ngx_slab_ncaches) {
+        n = ngx_max(pool->id + 1, ngx_slab_ncaches * 2);
+
+        caches = ngx_calloc(n * sizeof(ngx_slab_cache_t *), ngx_cycle->log);
+        if (caches == NULL) {
+            return NULL;
+        }
+
+        if (ngx_slab_caches) {
+            ngx_memcpy(caches, ngx_slab_caches,
+                       ngx_slab_ncaches * sizeof(ngx_slab_cache_t *));
+            ngx_free(ngx_slab_caches);
+        }
+
+        ngx_slab_caches = caches;
+        ngx_slab_ncaches = n;
+    }
+
+    if (!locked) {
+        ngx_shmtx_lock(&pool->mutex);
+    }
+
+    /* whole pages, so compaction never sees magazines as chunks */
+
+    nomem = pool->log_nomem;
+    pool->log_nomem = 0;
+
+    page = ngx_slab_alloc_pages(pool, pages);
+
+    pool->log_nomem = nomem;
+
+    if (page == NULL) {
+        cache = NULL;
+        goto done;
+    }
+
+    cache = (ngx_slab_cache_t *) ngx_slab_page_addr(pool, page);
+
+    n = ngx_pagesize_shift - pool->min_shift;
+
+    mag = (ngx_slab_magazine_t *) &cache[1];
+    chunks = (void **) &mag[n];
+
+    for (i = 0; i < n; i++) {
+        mag[i].n = 0;
+        mag[i].chunks = chunks;
+        chunks += ngx_slab_cache_size;
+    }
+
+    cache->pool = pool;
+    cache->pid = ngx_pid;
+    cache->magazines = mag;
+
+    cache->next = pool->caches;
+    pool->caches = cache;
+
+    ngx_slab_caches[pool->id] = cache;
+
+done:
+
+    if (!locked) {
+        ngx_shmtx_unlock(&pool->mutex);
+    }
+
+    return cache;
+}
+
+
+static void
+ngx_slab_cache_drain(ngx_slab_cache_t *cache)
+{
+    ngx_uint_t            i, n;
+    ngx_slab_magazine_t  *mag;
+
+    n = ngx_pagesize_shift - cache->pool->min_shift;
+
+    for (i = 0; i < n; i++) {
+        mag = &cache->magazines[i];
+
+        while (mag->n) {
+            ngx_slab_free_chunk(cache->pool, mag->chunks[--mag->n]);
+        }
+    }
+}
+
+
+/*
+ * Chunks cached by a process are unavailable to other processes,
+ * so the caches are flushed before the process exits.
+ */
+
+void
+ngx_slab_cache_flush(void)
+{
+    ngx_uint_t         i;
+    ngx_slab_cache_t  *cache;
+
+    for (i = 0; i < ngx_slab_ncaches; i++) {
+        cache = ngx_slab_caches[i];
+
+        if (cache == NULL) {
+            continue;
+        }
+
+        ngx_slab_caches[i] = NULL;
+
+        ngx_slab_cache_reclaim(cache->pool, ngx_pid);
+    }
+}
+
+
+/*
+ * The caches of a process which exited without flushing them
+ * are returned to the pool by the master process.
+ */
+
+void
+ngx_slab_cache_reclaim(ngx_slab_pool_t *pool, ngx_pid_t pid)
+{
+    ngx_slab_cache_t  *cache, **prev;
+
+    if (pool->caches == NULL) {
+        return;
+    }
+
+    ngx_shmtx_lock(&pool->mutex);
+
+    prev = &pool->caches;
+
+    for (cache = pool->caches; cache; cache = *prev) {
+
+        if (cache->pid != pid) {
+            prev = &cache->next;
+            continue;
+        }
+
+        *prev = cache->next;
+
+        ngx_log_debug2(NGX_LOG_DEBUG_ALLOC, ngx_cycle->log, 0,
+                       "slab cache reclaim: %p, pid: %P", cache, pid);
+
+        ngx_slab_cache_drain(cache);
+        ngx_slab_free_chunk(pool, cache);
+    }
+
+    ngx_shmtx_unlock(&pool->mutex);
+}
+
+
+/*
+ * Allocations and frees are accounted per process, in an array indexed
+ * by pool identifiers, like the caches.
+ */
+
+static ngx_slab_account_t *
+ngx_slab_account(ngx_slab_pool_t *pool)
+{
+    ngx_uint_t           n;
+    ngx_slab_account_t  *accounts;
+
+    if (pool->id < ngx_slab_naccounts) {
+        return &ngx_slab_accounts[pool->id];
+    }
+
+    n = ngx_max(pool->id + 1, ngx_slab_naccounts * 2);
+
+    accounts = ngx_calloc(n * sizeof(ngx_slab_account_t), ngx_cycle->log);
+    if (accounts == NULL) {
+        return NULL;
+    }
+
+    if (ngx_slab_accounts) {
+        ngx_memcpy(accounts, ngx_slab_accounts,
+                   ngx_slab_naccounts * sizeof(ngx_slab_account_t));
+        ngx_free(ngx_slab_accounts);
+    }
+
+    ngx_slab_accounts = accounts;
+    ngx_slab_naccounts = n;
+
+    return &ngx_slab_accounts[pool->id];
+}
+
+
+ngx_slab_account_t *
+ngx_slab_get_account(ngx_slab_pool_t *pool)
+{
+    if (pool->id < ngx_slab_naccounts) {
+        return &ngx_slab_accounts[pool->id];
+    }
+
+    return NULL;
+}
+
+
+void
+ngx_slab_fragmentation(ngx_slab_pool_t *pool, ngx_slab_frag_t *frag)
+{
+    ngx_uint_t        i, n, shift;
+    ngx_slab_page_t  *page, *slots;
+
+    frag->runs = 0;
+    frag->largest = 0;
+
+    ngx_shmtx_lock(&pool->mutex);
+
+    for (page = pool->free.next; page != &pool->free; page = page->next) {
+        frag->runs++;
+
+        if (page->slab > frag->largest) {
+            frag->largest = page->slab;
+        }
+    }
+
+    slots = ngx_slab_slots(pool);
+
+    n = ngx_pagesize_shift - pool->min_shift;
+
+    for (i = 0; i < n; i++) {
+        shift = i + pool->min_shift;
+
+        if (frag->pages) {
+            frag->pages[i] = pool->stats[i].total / ngx_slab_chunks(shift);
+        }
+
+        if (frag->partial) {
+            frag->partial[i] = 0;
+
+            for (page = slots[i].next; page != &slots[i]; page = page->next) {
+                frag->partial[i]++;
+            }
+        }
+    }
+
+    ngx_shmtx_unlock(&pool->mutex);
+}
+
+
+/*
+ * Compaction evacuates the least used page of a size class, if the other
+ * pages of the class have room for its chunks.  The page is taken off the
+ * list of the class, and its busy chunks, as found in its bitmap, are
+ * passed one by one to the owner of the zone, which moves the object with
+ * ngx_slab_move() into the other pages.  The page is freed along with its
+ * last chunk.  The pool must be locked during compaction, and the work
+ * done is bounded by the number of chunks in a page.
+ */
+
+ngx_int_t
+ngx_slab_compact_begin(ngx_slab_pool_t *pool)
+{
+    uintptr_t             base, p, m;
+    ngx_uint_t            i, k, n, shift, chunks, used, free, min, best, slot;
+    ngx_slab_page_t      *page, *slots, *victim, *candidate;
+    ngx_slab_cache_t     *cache;
+    ngx_slab_magazine_t  *mag;
+
+    slots = ngx_slab_slots(pool);
+
+    n = ngx_pagesize_shift - pool->min_shift;
+
+    victim = NULL;
+    best = 0;
+    slot = 0;
+
+    for (i = 0; i < n; i++) {
+        shift = i + pool->min_shift;
+        chunks = ngx_slab_chunks(shift);
+
+        /* at least two pages with free chunks */
+
+        page = slots[i].next;
+
+        if (page == &slots[i] || page->next == &slots[i]) {
+            continue;
+        }
+
+        /* only a few pages at the head of the list are considered */
+
+        candidate = NULL;
+        min = chunks;
+
+        for (k = 0;
+             page != &slots[i] && k < NGX_SLAB_COMPACT_PAGES;
+             page = page->next, k++)
+        {
+            used = ngx_slab_page_used(pool, page, shift);
+
+            if (used < min) {
+                min = used;
+                candidate = page;
+            }
+        }
+
+        free = pool->stats[i].total - pool->stats[i].used;
+
+        if (candidate == NULL || free - (chunks - min) < min) {
+            continue;
+        }
+
+        if (victim == NULL || min < best) {
+            victim = candidate;
+            best = min;
+            slot = i;
+        }
+    }
+
+    if (victim == NULL) {
+        return NGX_DECLINED;
+    }
+
+    shift = slot + pool->min_shift;
+
+    /* chunks cached in magazines are busy in the bitmap, but not moved */
+
+    if (ngx_slab_compact_cached == NULL) {
+
+        /* enough for a bit per byte of a page */
+
+        ngx_slab_compact_cached = ngx_alloc(ngx_pagesize / 8, ngx_cycle->log);
+        if (ngx_slab_compact_cached == NULL) {
+            return NGX_DECLINED;
+        }
+    }
+
+    ngx_memzero(ngx_slab_compact_cached, ngx_pagesize / 8);
+
+    base = ngx_slab_page_addr(pool, victim);
+
+    for (cache = pool->caches; cache; cache = cache->next) {
+        mag = &cache->magazines[slot];
+
+        for (i = 0; i < mag->n; i++) {
+            p = (uintptr_t) mag->chunks[i];
+
+            if ((p & ~((uintptr_t) ngx_pagesize - 1)) != base) {
+                continue;
+            }
+
+            k = (p & (ngx_pagesize - 1)) >> shift;
+            m = (uintptr_t) 1 << (k % (8 * sizeof(uintptr_t)));
+
+            ngx_slab_compact_cached[k / (8 * sizeof(uintptr_t))] |= m;
+        }
+    }
+
+    ngx_log_debug2(NGX_LOG_DEBUG_ALLOC, ngx_cycle->log, 0,
+                   "slab compact: page %p, chunks: %ui", (void *) base, best);
+
+    page = ngx_slab_page_prev(victim);
+    page->next = victim->next;
+    victim->next->prev = victim->prev;
+
+    victim->next = NULL;
+    victim->prev = ngx_slab_page_type(victim);
+
+    pool->compact = victim;
+
+    /* the first chunks of small pages hold the bitmap */
+
+    ngx_slab_compact_chunk = (ngx_pagesize >> shift) - ngx_slab_chunks(shift);
+
+    return NGX_OK;
+}
+
+
+void *
+ngx_slab_compact_next(ngx_slab_pool_t *pool)
+{
+    uintptr_t         p, m, base;
+    ngx_uint_t        n, shift;
+    ngx_slab_page_t  *page;
+
+    page = pool->compact;
+
+    if (page == NULL) {
+
+        /* the page was freed */
+
+        return NULL;
+    }
+
+    shift = (ngx_slab_page_type(page) == NGX_SLAB_EXACT)
+            ? ngx_slab_exact_shift : (page->slab & NGX_SLAB_SHIFT_MASK);
+
+    base = ngx_slab_page_addr(pool, page);
+
+    for (n = ngx_slab_compact_chunk; n < (ngx_pagesize >> shift); n++) {
+        p = base + (n << shift);
+
+        m = (uintptr_t) 1 << (n % (8 * sizeof(uintptr_t)));
+
+        if (!ngx_slab_chunk_busy(page, p, shift)
+            || (ngx_slab_compact_cached[n / (8 * sizeof(uintptr_t))] & m))
+        {
+            continue;
+        }
+
+        ngx_slab_compact_chunk = n + 1;
+
+        return (void *) p;
+    }
+
+    ngx_slab_compact_chunk = n;
+
+    return NULL;
+}
+
+
+void *
+ngx_slab_move(ngx_slab_pool_t *pool, void *p, size_t size)
+{
+    void        *chunk;
+    ngx_uint_t   n;
+
+    n = ((u_char *) p - pool->start) >> ngx_pagesize_shift;
+
+    if (pool->compact != &pool->pages[n]) {
+        return p;
+    }
+
+    chunk = ngx_slab_alloc_chunk(pool, size);
+    if (chunk == NULL) {
+        return p;
+    }
+
+    ngx_memcpy(chunk, p, size);
+
+    ngx_slab_free_chunk(pool, p);
+
+    return chunk;
+}
+
+
+void
+ngx_slab_compact_end(ngx_slab_pool_t *pool)
+{
+    ngx_uint_t        type, shift, slot;
+    ngx_slab_page_t  *page, *slots;
+
+    page = pool->compact;
+
+    if (page == NULL) {
+
+        /* the page was freed */
+
+        return;
+    }
+
+    pool->compact = NULL;
+
+    type = ngx_slab_page_type(page);
+
+    shift = (type == NGX_SLAB_EXACT) ? ngx_slab_exact_shift
+                                     : (page->slab & NGX_SLAB_SHIFT_MASK);
+
+    if (ngx_slab_page_used(pool, page, shift) == ngx_slab_chunks(shift)) {
+        return;
+    }
+
+    /* some chunks were not moved, return the page to the list */
+
+    slot = shift - pool->min_shift;
+    slots = ngx_slab_slots(pool);
+
+    page->next = slots[slot].next;
+    slots[slot].next = page;
+
+    page->prev = (uintptr_t) &slots[slot] | type;
+    page->next->prev = (uintptr_t) page | type;
+}
+
+
+static ngx_uint_t
+ngx_slab_chunk_busy(ngx_slab_page_t *page, uintptr_t p, ngx_uint_t shift)
+{
+    uintptr_t   m, *bitmap;
+    ngx_uint_t  n;
+
+    n = (p & (ngx_pagesize - 1)) >> shift;
+
+    switch (ngx_slab_page_type(page)) {
+
+    case NGX_SLAB_SMALL:
+        bitmap = (uintptr_t *) (p & ~((uintptr_t) ngx_pagesize - 1));
+        m = (uintptr_t) 1 << (n % (8 * sizeof(uintptr_t)));
+        return (bitmap[n / (8 * sizeof(uintptr_t))] & m) != 0;
+
+    case NGX_SLAB_EXACT:
+        return (page->slab & ((uintptr_t) 1 << n)) != 0;
+
+    default: /* NGX_SLAB_BIG */
+        return (page->slab & ((uintptr_t) 1 << (n + NGX_SLAB_MAP_SHIFT))) != 0;
+    }
+}
+
+
+static ngx_uint_t
+ngx_slab_chunks(ngx_uint_t shift)
+{
+    ngx_uint_t  n;
+
+    if (shift < ngx_slab_exact_shift) {
+
+        /* the first chunks of a page are occupied by its bitmap */
+
+        n = (ngx_pagesize >> shift) / ((1 << shift) * 8);
+
+        if (n == 0) {
+            n = 1;
+        }
+
+        return (ngx_pagesize >> shift) - n;
+    }
+
+    return ngx_pagesize >> shift;
+}
+
+
+static ngx_uint_t
+ngx_slab_page_used(ngx_slab_pool_t *pool, ngx_slab_page_t *page,
+    ngx_uint_t shift)
+{
+    uintptr_t   m, *bitmap;
+    ngx_uint_t  i, n, map;
+
+    n = 0;
+
+    switch (ngx_slab_page_type(page)) {
+
+    case NGX_SLAB_SMALL:
+
+        bitmap = (uintptr_t *) ngx_slab_page_addr(pool, page);
+        map = (ngx_pagesize >> shift) / (8 * sizeof(uintptr_t));
+
+        for (i = 0; i < map; i++) {
+            for (m = bitmap[i]; m; m &= m - 1) {
+                n++;
+            }
+        }
+
+        return n - ((ngx_pagesize >> shift) - ngx_slab_chunks(shift));
+
+    case NGX_SLAB_EXACT:
+        m = page->slab;
+        break;
+
+    default: /* NGX_SLAB_BIG */
+        m = page->slab & NGX_SLAB_MAP_MASK;
+        break;
+    }
+
+    for ( /* void */ ; m; m &= m - 1) {
+        n++;
+    }
+
+    return n;
+}
+
+
 static ngx_slab_page_t *
 ngx_slab_alloc_pages(ngx_slab_pool_t *pool, ngx_uint_t pages)
 {
@@ -738,6 +1636,10 @@ ngx_slab_free_pages(ngx_slab_pool_t *pool, ngx_slab_page_t *page,
 
     pool->pfree += pages;
 
+    if (page == pool->compact) {
+        pool->compact = NULL;
+    }
+
     page->slab = pages--;
 
     if (pages) {
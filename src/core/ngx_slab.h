@@ -14,6 +14,7 @@
 
 
 typedef struct ngx_slab_page_s  ngx_slab_page_t;
+typedef struct ngx_slab_cache_s  ngx_slab_cache_t;
 
 struct ngx_slab_page_s {
     uintptr_t         slab;
@@ -31,6 +32,24 @@ typedef struct {
 } ngx_slab_stat_t;
 
 
+typedef struct {
+    ngx_uint_t        runs;       /* runs of free pages */
+    ngx_uint_t        largest;    /* pages in the largest run */
+
+    /* arrays with an element per size class, may be NULL */
+
+    ngx_uint_t       *pages;
+    ngx_uint_t       *partial;    /* pages with free chunks */
+} ngx_slab_frag_t;
+
+
+typedef struct {
+    ngx_uint_t        allocs;
+    ngx_uint_t        frees;
+    size_t            requested;
+} ngx_slab_account_t;
+
+
 typedef struct {
     ngx_shmtx_sh_t    lock;
 
@@ -44,11 +63,16 @@ typedef struct {
     ngx_slab_stat_t  *stats;
     ngx_uint_t        pfree;
 
+    ngx_slab_page_t  *compact;
+    ngx_slab_cache_t *caches;
+
     u_char           *start;
     u_char           *end;
 
     ngx_shmtx_t       mutex;
 
+    ngx_uint_t        id;
+
     u_char           *log_ctx;
     u_char            zero;
 
@@ -68,5 +92,19 @@ void *ngx_slab_calloc_locked(ngx_slab_pool_t *pool, size_t size);
 void ngx_slab_free(ngx_slab_pool_t *pool, void *p);
 void ngx_slab_free_locked(ngx_slab_pool_t *pool, void *p);
 
+void ngx_slab_cache_init(ngx_uint_t n);
+void ngx_slab_cache_flush(void);
+void ngx_slab_cache_reclaim(ngx_slab_pool_t *pool, ngx_pid_t pid);
+ngx_slab_account_t *ngx_slab_get_account(ngx_slab_pool_t *pool);
+
+void ngx_slab_fragmentation(ngx_slab_pool_t *pool, ngx_slab_frag_t *frag);
+ngx_int_t ngx_slab_compact_begin(ngx_slab_pool_t *pool);
+void *ngx_slab_compact_next(ngx_slab_pool_t *pool);
+void *ngx_slab_move(ngx_slab_pool_t *pool, void *p, size_t size);
+void ngx_slab_compact_end(ngx_slab_pool_t *pool);
+
+
+extern ngx_uint_t  ngx_slab_accounting;
+
 
 #endif /* _NGX_SLAB_H_INCLUDED_ */
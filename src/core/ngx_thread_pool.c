@@ -16,21 +16,36 @@ typedef struct {
 } ngx_thread_pool_conf_t;
 
 
+/*
+ * Each thread has its own bounded queue of tasks.  Tasks are only posted
+ * by the worker process thread, so a queue has a single producer which
+ * advances the tail.  The queue owner and idle threads, which steal tasks
+ * from other queues, take tasks by advancing the head with compare-and-set.
+ * Thread statistics are updated by the executing thread only.
+ */
+
 typedef struct {
-    ngx_thread_task_t        *first;
-    ngx_thread_task_t       **last;
-} ngx_thread_pool_queue_t;
+    ngx_atomic_t              head;
+    ngx_atomic_t              tail;
+    ngx_uint_t                mask;
+    ngx_thread_task_t       **tasks;
 
-#define ngx_thread_pool_queue_init(q)                                         \
-    (q)->first = NULL;                                                        \
-    (q)->last = &(q)->first
+    ngx_thread_pool_t        *pool;
+    ngx_uint_t                index;
+
+    ngx_uint_t                completed;
+    uint64_t                  wait_time;
+    uint64_t                  service_time;
+} ngx_thread_pool_queue_t;
 
 
 struct ngx_thread_pool_s {
+    ngx_thread_pool_queue_t **queues;
+    ngx_uint_t                next;
+
     ngx_thread_mutex_t        mtx;
-    ngx_thread_pool_queue_t   queue;
-    ngx_int_t                 waiting;
     ngx_thread_cond_t         cond;
+    ngx_atomic_t              sleeping;
 
     ngx_log_t                *log;
 
@@ -48,6 +63,8 @@ static ngx_int_t ngx_thread_pool_init(ngx_thread_pool_t *tp, ngx_log_t *log,
 static void ngx_thread_pool_destroy(ngx_thread_pool_t *tp);
 static void ngx_thread_pool_exit_handler(void *data, ngx_log_t *log);
 
+static ngx_thread_task_t *ngx_thread_pool_take(ngx_thread_pool_t *tp,
+    ngx_uint_t index);
 static void *ngx_thread_pool_cycle(void *data);
 static void ngx_thread_pool_handler(ngx_event_t *ev);
 
@@ -98,18 +115,21 @@ ngx_module_t  ngx_thread_pool_module = {
 
 static ngx_str_t  ngx_thread_pool_default = ngx_string("default");
 
-static ngx_uint_t               ngx_thread_pool_task_id;
-static ngx_atomic_t             ngx_thread_pool_done_lock;
-static ngx_thread_pool_queue_t  ngx_thread_pool_done;
+static ngx_uint_t    ngx_thread_pool_task_id;
+
+/* the stack of completed tasks, pushed by threads and taken as a whole */
+static ngx_atomic_t  ngx_thread_pool_done;
 
 
 static ngx_int_t
 ngx_thread_pool_init(ngx_thread_pool_t *tp, ngx_log_t *log, ngx_pool_t *pool)
 {
-    int             err;
-    pthread_t       tid;
-    ngx_uint_t      n;
-    pthread_attr_t  attr;
+    int                       err;
+    size_t                    size;
+    pthread_t                 tid;
+    ngx_uint_t                n;
+    pthread_attr_t            attr;
+    ngx_thread_pool_queue_t  *q;
 
     if (ngx_notify == NULL) {
         ngx_log_error(NGX_LOG_ALERT, log, 0,
@@ -117,7 +137,47 @@ ngx_thread_pool_init(ngx_thread_pool_t *tp, ngx_log_t *log, ngx_pool_t *pool)
         return NGX_ERROR;
     }
 
-    ngx_thread_pool_queue_init(&tp->queue);
+    tp->queues = ngx_palloc(pool,
+                            tp->threads * sizeof(ngx_thread_pool_queue_t *));
+    if (tp->queues == NULL) {
+        return NGX_ERROR;
+    }
+
+    /* max_queue is split between threads, each queue holds at least one task */
+
+    size = 1;
+
+    while (size * tp->threads < (ngx_uint_t) tp->max_queue) {
+        size <<= 1;
+    }
+
+    for (n = 0; n < tp->threads; n++) {
+
+        /* queues are aligned to avoid false sharing between threads */
+
+        q = ngx_pmemalign(pool, ngx_align(sizeof(ngx_thread_pool_queue_t),
+                                          ngx_cacheline_size),
+                          ngx_cacheline_size);
+        if (q == NULL) {
+            return NGX_ERROR;
+        }
+
+        ngx_memzero(q, sizeof(ngx_thread_pool_queue_t));
+
+        q->tasks = ngx_palloc(pool, size * sizeof(ngx_thread_task_t *));
+        if (q->tasks == NULL) {
+            return NGX_ERROR;
+        }
+
+        q->mask = size - 1;
+        q->pool = tp;
+        q->index = n;
+
+        tp->queues[n] = q;
+    }
+
+    tp->next = 0;
+    tp->sleeping = 0;
 
     if (ngx_thread_mutex_create(&tp->mtx, log) != NGX_OK) {
         return NGX_ERROR;
@@ -154,7 +214,7 @@ ngx_thread_pool_init(ngx_thread_pool_t *tp, ngx_log_t *log, ngx_pool_t *pool)
 #endif
 
     for (n = 0; n < tp->threads; n++) {
-        err = pthread_create(&tid, &attr, ngx_thread_pool_cycle, tp);
+        err = pthread_create(&tid, &attr, ngx_thread_pool_cycle, tp->queues[n]);
         if (err) {
             ngx_log_error(NGX_LOG_ALERT, log, err,
                           "pthread_create() failed");
@@ -230,59 +290,148 @@ ngx_thread_task_alloc(ngx_pool_t *pool, size_t size)
 ngx_int_t
 ngx_thread_task_post(ngx_thread_pool_t *tp, ngx_thread_task_t *task)
 {
+    ngx_uint_t                n;
+    ngx_atomic_uint_t         tail;
+    ngx_thread_pool_stats_t   st;
+    ngx_thread_pool_queue_t  *q;
+
     if (task->event.active) {
         ngx_log_error(NGX_LOG_ALERT, tp->log, 0,
                       "task #%ui already active", task->id);
         return NGX_ERROR;
     }
 
-    if (ngx_thread_mutex_lock(&tp->mtx, tp->log) != NGX_OK) {
-        return NGX_ERROR;
-    }
+    for (n = 0; n < tp->threads; n++) {
+        q = tp->queues[tp->next++ % tp->threads];
 
-    if (tp->waiting >= tp->max_queue) {
-        (void) ngx_thread_mutex_unlock(&tp->mtx, tp->log);
+        tail = q->tail;
 
-        ngx_log_error(NGX_LOG_ERR, tp->log, 0,
-                      "thread pool \"%V\" queue overflow: %i tasks waiting",
-                      &tp->name, tp->waiting);
-        return NGX_ERROR;
+        if (tail - q->head <= q->mask) {
+            goto found;
+        }
     }
 
+    ngx_thread_pool_get_stats(tp, &st);
+
+    ngx_log_error(NGX_LOG_ERR, tp->log, 0,
+                  "thread pool \"%V\" queue overflow: %ui tasks waiting",
+                  &tp->name, st.waiting);
+    return NGX_ERROR;
+
+found:
+
     task->event.active = 1;
 
     task->id = ngx_thread_pool_task_id++;
     task->next = NULL;
+    task->posted = ngx_monotonic_usec();
+
+    q->tasks[tail & q->mask] = task;
+
+    /*
+     * the atomic increment publishes the task and orders it
+     * before the check for sleeping threads
+     */
+
+    (void) ngx_atomic_fetch_add(&q->tail, 1);
+
+    if (tp->sleeping) {
+        if (ngx_thread_mutex_lock(&tp->mtx, tp->log) != NGX_OK) {
+            return NGX_ERROR;
+        }
+
+        if (ngx_thread_cond_signal(&tp->cond, tp->log) != NGX_OK) {
+            (void) ngx_thread_mutex_unlock(&tp->mtx, tp->log);
+            return NGX_ERROR;
+        }
 
-    if (ngx_thread_cond_signal(&tp->cond, tp->log) != NGX_OK) {
         (void) ngx_thread_mutex_unlock(&tp->mtx, tp->log);
-        return NGX_ERROR;
     }
 
-    *tp->queue.last = task;
-    tp->queue.last = &task->next;
+    ngx_log_debug3(NGX_LOG_DEBUG_CORE, tp->log, 0,
+                   "task #%ui added to thread pool \"%V\" queue %ui",
+                   task->id, &tp->name, q->index);
+
+    return NGX_OK;
+}
+
+
+static ngx_thread_task_t *
+ngx_thread_pool_take(ngx_thread_pool_t *tp, ngx_uint_t index)
+{
+    ngx_uint_t                n;
+    ngx_atomic_uint_t         head;
+    ngx_thread_task_t        *task;
+    ngx_thread_pool_queue_t  *q;
+
+    /* the own queue is tried first, then tasks are stolen from others */
+
+    for (n = 0; n < tp->threads; n++) {
+        q = tp->queues[(index + n) % tp->threads];
+
+        for ( ;; ) {
+            head = q->head;
+
+            if (head == q->tail) {
+                break;
+            }
+
+            /*
+             * the slot cannot be reused by the producer
+             * until the head is advanced past it
+             */
+
+            task = q->tasks[head & q->mask];
+
+            if (ngx_atomic_cmp_set(&q->head, head, head + 1)) {
+                return task;
+            }
+
+            ngx_cpu_pause();
+        }
+    }
+
+    return NULL;
+}
 
-    tp->waiting++;
 
-    (void) ngx_thread_mutex_unlock(&tp->mtx, tp->log);
+void
+ngx_thread_pool_get_stats(ngx_thread_pool_t *tp, ngx_thread_pool_stats_t *st)
+{
+    ngx_uint_t                n;
+    ngx_thread_pool_queue_t  *q;
 
-    ngx_log_debug2(NGX_LOG_DEBUG_CORE, tp->log, 0,
-                   "task #%ui added to thread pool \"%V\"",
-                   task->id, &tp->name);
+    ngx_memzero(st, sizeof(ngx_thread_pool_stats_t));
 
-    return NGX_OK;
+    if (tp->queues == NULL) {
+        return;
+    }
+
+    for (n = 0; n < tp->threads; n++) {
+        q = tp->queues[n];
+
+        st->waiting += q->tail - q->head;
+        st->completed += q->completed;
+        st->wait_time += q->wait_time;
+        st->service_time += q->service_time;
+    }
 }
 
 
 static void *
 ngx_thread_pool_cycle(void *data)
 {
-    ngx_thread_pool_t *tp = data;
+    ngx_thread_pool_queue_t *q = data;
 
     int                 err;
     sigset_t            set;
+    ngx_uint_t          start;
+    ngx_atomic_uint_t   done;
+    ngx_thread_pool_t  *tp;
     ngx_thread_task_t  *task;
 
+    tp = q->pool;
+
 #if 0
     ngx_time_update();
 #endif
@@ -304,33 +453,45 @@ ngx_thread_pool_cycle(void *data)
     }
 
     for ( ;; ) {
-        if (ngx_thread_mutex_lock(&tp->mtx, tp->log) != NGX_OK) {
-            return NULL;
-        }
-
-        /* the number may become negative */
-        tp->waiting--;
+        task = ngx_thread_pool_take(tp, q->index);
 
-        while (tp->queue.first == NULL) {
-            if (ngx_thread_cond_wait(&tp->cond, &tp->mtx, tp->log)
-                != NGX_OK)
-            {
-                (void) ngx_thread_mutex_unlock(&tp->mtx, tp->log);
+        if (task == NULL) {
+            if (ngx_thread_mutex_lock(&tp->mtx, tp->log) != NGX_OK) {
                 return NULL;
             }
-        }
 
-        task = tp->queue.first;
-        tp->queue.first = task->next;
+            /*
+             * the atomic increment orders the sleeping counter before
+             * the queues are checked again, so a task posted concurrently
+             * is either found here or followed by a signal
+             */
 
-        if (tp->queue.first == NULL) {
-            tp->queue.last = &tp->queue.first;
-        }
+            (void) ngx_atomic_fetch_add(&tp->sleeping, 1);
+
+            for ( ;; ) {
+                task = ngx_thread_pool_take(tp, q->index);
+
+                if (task) {
+                    break;
+                }
 
-        if (ngx_thread_mutex_unlock(&tp->mtx, tp->log) != NGX_OK) {
-            return NULL;
+                if (ngx_thread_cond_wait(&tp->cond, &tp->mtx, tp->log)
+                    != NGX_OK)
+                {
+                    (void) ngx_thread_mutex_unlock(&tp->mtx, tp->log);
+                    return NULL;
+                }
+            }
+
+            (void) ngx_atomic_fetch_add(&tp->sleeping, -1);
+
+            if (ngx_thread_mutex_unlock(&tp->mtx, tp->log) != NGX_OK) {
+                return NULL;
+            }
         }
 
+        start = ngx_monotonic_usec();
+
 #if 0
         ngx_time_update();
 #endif
@@ -345,18 +506,25 @@ ngx_thread_pool_cycle(void *data)
                        "complete task #%ui in thread pool \"%V\"",
                        task->id, &tp->name);
 
-        task->next = NULL;
+        q->completed++;
+        q->wait_time += start - task->posted;
+        q->service_time += ngx_monotonic_usec() - start;
 
-        ngx_spinlock(&ngx_thread_pool_done_lock, 1, 2048);
+        do {
+            done = ngx_thread_pool_done;
+            task->next = (ngx_thread_task_t *) done;
 
-        *ngx_thread_pool_done.last = task;
-        ngx_thread_pool_done.last = &task->next;
+        } while (!ngx_atomic_cmp_set(&ngx_thread_pool_done, done,
+                                     (ngx_atomic_uint_t) task));
 
-        ngx_memory_barrier();
+        /*
+         * the worker is notified only if the stack was empty,
+         * the following tasks are completed in the same handler call
+         */
 
-        ngx_unlock(&ngx_thread_pool_done_lock);
-
-        (void) ngx_notify(ngx_thread_pool_handler);
+        if (done == 0) {
+            (void) ngx_notify(ngx_thread_pool_handler);
+        }
     }
 }
 
@@ -365,19 +533,27 @@ static void
 ngx_thread_pool_handler(ngx_event_t *ev)
 {
     ngx_event_t        *event;
-    ngx_thread_task_t  *task;
+    ngx_atomic_uint_t   done;
+    ngx_thread_task_t  *task, *next;
 
     ngx_log_debug0(NGX_LOG_DEBUG_CORE, ev->log, 0, "thread pool handler");
 
-    ngx_spinlock(&ngx_thread_pool_done_lock, 1, 2048);
+    do {
+        done = ngx_thread_pool_done;
 
-    task = ngx_thread_pool_done.first;
-    ngx_thread_pool_done.first = NULL;
-    ngx_thread_pool_done.last = &ngx_thread_pool_done.first;
+    } while (!ngx_atomic_cmp_set(&ngx_thread_pool_done, done, 0));
 
-    ngx_memory_barrier();
+    /* restore the completion order */
 
-    ngx_unlock(&ngx_thread_pool_done_lock);
+    task = NULL;
+
+    while (done) {
+        next = (ngx_thread_task_t *) done;
+        done = (ngx_atomic_uint_t) next->next;
+
+        next->next = task;
+        task = next;
+    }
 
     while (task) {
         ngx_log_debug1(NGX_LOG_DEBUG_CORE, ev->log, 0,
@@ -599,7 +775,7 @@ ngx_thread_pool_init_worker(ngx_cycle_t *cycle)
         return NGX_OK;
     }
 
-    ngx_thread_pool_queue_init(&ngx_thread_pool_done);
+    ngx_thread_pool_done = 0;
 
     tpp = tcf->pools.elts;
 
@@ -19,6 +19,7 @@ struct ngx_thread_task_s {
     ngx_uint_t           id;
     void                *ctx;
     void               (*handler)(void *data, ngx_log_t *log);
+    ngx_uint_t           posted;
     ngx_event_t          event;
 };
 
@@ -26,11 +27,22 @@ struct ngx_thread_task_s {
 typedef struct ngx_thread_pool_s  ngx_thread_pool_t;
 
 
+typedef struct {
+    ngx_uint_t           waiting;
+    ngx_uint_t           completed;
+    uint64_t             wait_time;     /* microseconds */
+    uint64_t             service_time;  /* microseconds */
+} ngx_thread_pool_stats_t;
+
+
 ngx_thread_pool_t *ngx_thread_pool_add(ngx_conf_t *cf, ngx_str_t *name);
 ngx_thread_pool_t *ngx_thread_pool_get(ngx_cycle_t *cycle, ngx_str_t *name);
 
 ngx_thread_task_t *ngx_thread_task_alloc(ngx_pool_t *pool, size_t size);
 ngx_int_t ngx_thread_task_post(ngx_thread_pool_t *tp, ngx_thread_task_t *task);
 
+void ngx_thread_pool_get_stats(ngx_thread_pool_t *tp,
+    ngx_thread_pool_stats_t *st);
+
 
 #endif /* _NGX_THREAD_POOL_H_INCLUDED_ */
@@ -213,6 +213,30 @@ ngx_monotonic_time(time_t sec, ngx_uint_t msec)
 }
 
 
+ngx_uint_t
+ngx_monotonic_usec(void)
+{
+#if (NGX_HAVE_CLOCK_MONOTONIC)
+    struct timespec  ts;
+
+#if defined(CLOCK_MONOTONIC_FAST)
+    clock_gettime(CLOCK_MONOTONIC_FAST, &ts);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+
+    return (ngx_uint_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+
+#else
+    struct timeval  tv;
+
+    ngx_gettimeofday(&tv);
+
+    return (ngx_uint_t) tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+
 #if !(NGX_WIN32)
 
 void
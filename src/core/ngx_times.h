@@ -26,6 +26,7 @@ void ngx_time_sigsafe_update(void);
 u_char *ngx_http_time(u_char *buf, time_t t);
 u_char *ngx_http_cookie_time(u_char *buf, time_t t);
 void ngx_gmtime(time_t t, ngx_tm_t *tp);
+ngx_uint_t ngx_monotonic_usec(void);
 
 time_t ngx_next_time(time_t when);
 #define ngx_next_time_n      "mktime()"
@@ -95,9 +95,19 @@ struct io_event {
 #endif /* NGX_TEST_BUILD_EPOLL */
 
 
+#define NGX_EPOLL_EVENTS_MIN   64
+#define NGX_EPOLL_UNDERUSED    64
+
+/* how often the counters of a worker are added to the shared ones */
+#define NGX_EPOLL_STAT_PERIOD  1000
+
+
 typedef struct {
     ngx_uint_t  events;
     ngx_uint_t  aio_requests;
+    ngx_uint_t  busy_poll;
+    ngx_uint_t  busy_poll_budget;
+    ngx_flag_t  events_auto;
 } ngx_epoll_conf_t;
 
 
@@ -127,13 +137,29 @@ static ngx_int_t ngx_epoll_process_events(ngx_cycle_t *cycle, ngx_msec_t timer,
 static void ngx_epoll_eventfd_handler(ngx_event_t *ev);
 #endif
 
+#if (NGX_HAVE_SO_BUSY_POLL)
+static ngx_int_t ngx_epoll_module_init(ngx_cycle_t *cycle);
+#endif
+
+#if (NGX_STAT_STUB)
+static void ngx_epoll_stat_publish(ngx_cycle_t *cycle);
+#endif
+
 static void *ngx_epoll_create_conf(ngx_cycle_t *cycle);
 static char *ngx_epoll_init_conf(ngx_cycle_t *cycle, void *conf);
+static char *ngx_epoll_events(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
+static char *ngx_epoll_busy_poll(ngx_conf_t *cf, ngx_command_t *cmd,
+    void *conf);
 
 static int                  ep = -1;
 static struct epoll_event  *event_list;
 static ngx_uint_t           nevents;
 
+/* the number of events currently requested with "epoll_events auto" */
+static ngx_uint_t           nbatch;
+static ngx_uint_t           nunderused;
+static ngx_flag_t           events_auto;
+
 #if (NGX_HAVE_EVENTFD)
 static int                  notify_fd = -1;
 static ngx_event_t          notify_event;
@@ -154,15 +180,29 @@ static ngx_connection_t     ngx_eventfd_conn;
 ngx_uint_t                  ngx_use_epoll_rdhup;
 #endif
 
+#if (NGX_STAT_STUB)
+static ngx_atomic_uint_t    ngx_epoll_nwakeups;
+static ngx_atomic_uint_t    ngx_epoll_nevents;
+static ngx_atomic_uint_t    ngx_epoll_wait_time;
+static ngx_msec_t           ngx_epoll_published;
+#endif
+
 static ngx_str_t      epoll_name = ngx_string("epoll");
 
 static ngx_command_t  ngx_epoll_commands[] = {
 
     { ngx_string("epoll_events"),
       NGX_EVENT_CONF|NGX_CONF_TAKE1,
-      ngx_conf_set_num_slot,
+      ngx_epoll_events,
+      0,
+      0,
+      NULL },
+
+    { ngx_string("epoll_busy_poll"),
+      NGX_EVENT_CONF|NGX_CONF_TAKE12,
+      ngx_epoll_busy_poll,
+      0,
       0,
-      offsetof(ngx_epoll_conf_t, events),
       NULL },
 
     { ngx_string("worker_aio_requests"),
@@ -205,11 +245,19 @@ ngx_module_t  ngx_epoll_module = {
     ngx_epoll_commands,                  /* module directives */
     NGX_EVENT_MODULE,                    /* module type */
     NULL,                                /* init master */
+#if (NGX_HAVE_SO_BUSY_POLL)
+    ngx_epoll_module_init,               /* init module */
+#else
     NULL,                                /* init module */
+#endif
     NULL,                                /* init process */
     NULL,                                /* init thread */
     NULL,                                /* exit thread */
+#if (NGX_STAT_STUB)
+    ngx_epoll_stat_publish,              /* exit process */
+#else
     NULL,                                /* exit process */
+#endif
     NULL,                                /* exit master */
     NGX_MODULE_V1_PADDING
 };
@@ -322,8 +370,13 @@ failed:
 static ngx_int_t
 ngx_epoll_init(ngx_cycle_t *cycle, ngx_msec_t timer)
 {
+    ngx_uint_t         n;
     ngx_epoll_conf_t  *epcf;
 
+#if (NGX_HAVE_EPOLL_PARAMS)
+    struct epoll_params  params;
+#endif
+
     epcf = ngx_event_get_conf(cycle->conf_ctx, ngx_epoll_module);
 
     if (ep == -1) {
@@ -335,6 +388,21 @@ ngx_epoll_init(ngx_cycle_t *cycle, ngx_msec_t timer)
             return NGX_ERROR;
         }
 
+#if (NGX_HAVE_EPOLL_PARAMS)
+        if (epcf->busy_poll) {
+            ngx_memzero(&params, sizeof(struct epoll_params));
+
+            params.busy_poll_usecs = epcf->busy_poll;
+            params.busy_poll_budget = epcf->busy_poll_budget;
+            params.prefer_busy_poll = 1;
+
+            if (ioctl(ep, EPIOCSPARAMS, &params) == -1) {
+                ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_errno,
+                              "ioctl(EPIOCSPARAMS) failed, ignored");
+            }
+        }
+#endif
+
 #if (NGX_HAVE_EVENTFD)
         if (ngx_epoll_notify_init(cycle->log) != NGX_OK) {
             ngx_epoll_module_ctx.actions.notify = NULL;
@@ -350,19 +418,29 @@ ngx_epoll_init(ngx_cycle_t *cycle, ngx_msec_t timer)
 #endif
     }
 
-    if (nevents < epcf->events) {
+    /*
+     * with "epoll_events auto", the number of events requested
+     * is adjusted between NGX_EPOLL_EVENTS_MIN and worker_connections
+     */
+
+    n = epcf->events_auto ? cycle->connection_n : epcf->events;
+
+    if (nevents < n) {
         if (event_list) {
             ngx_free(event_list);
         }
 
-        event_list = ngx_alloc(sizeof(struct epoll_event) * epcf->events,
-                               cycle->log);
+        event_list = ngx_alloc(sizeof(struct epoll_event) * n, cycle->log);
         if (event_list == NULL) {
             return NGX_ERROR;
         }
     }
 
-    nevents = epcf->events;
+    nevents = n;
+
+    events_auto = epcf->events_auto;
+    nbatch = events_auto ? ngx_min(NGX_EPOLL_EVENTS_MIN, n) : n;
+    nunderused = 0;
 
     ngx_io = ngx_os_io;
 
@@ -791,20 +869,38 @@ ngx_epoll_process_events(ngx_cycle_t *cycle, ngx_msec_t timer, ngx_uint_t flags)
     ngx_event_t       *rev, *wev;
     ngx_queue_t       *queue;
     ngx_connection_t  *c;
+#if (NGX_STAT_STUB)
+    ngx_uint_t         start;
+#endif
 
     /* NGX_TIMER_INFINITE == INFTIM */
 
-    ngx_log_debug1(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
-                   "epoll timer: %M", timer);
+    ngx_log_debug2(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
+                   "epoll timer: %M, events: %ui", timer, nbatch);
+
+#if (NGX_STAT_STUB)
+    start = ngx_monotonic_usec();
+#endif
 
-    events = epoll_wait(ep, event_list, (int) nevents, timer);
+    events = epoll_wait(ep, event_list, (int) nbatch, timer);
 
     err = (events == -1) ? ngx_errno : 0;
 
+#if (NGX_STAT_STUB)
+    ngx_epoll_nwakeups++;
+    ngx_epoll_wait_time += ngx_monotonic_usec() - start;
+#endif
+
     if (flags & NGX_UPDATE_TIME || ngx_event_timer_alarm) {
         ngx_time_update();
     }
 
+#if (NGX_STAT_STUB)
+    if (ngx_current_msec - ngx_epoll_published >= NGX_EPOLL_STAT_PERIOD) {
+        ngx_epoll_stat_publish(cycle);
+    }
+#endif
+
     if (err) {
         if (err == NGX_EINTR) {
 
@@ -833,6 +929,34 @@ ngx_epoll_process_events(ngx_cycle_t *cycle, ngx_msec_t timer, ngx_uint_t flags)
         return NGX_ERROR;
     }
 
+#if (NGX_STAT_STUB)
+    ngx_epoll_nevents += events;
+#endif
+
+    if (events_auto) {
+
+        /*
+         * the number of events is doubled if all of them are used,
+         * and halved if less than a quarter is used for a while
+         */
+
+        if ((ngx_uint_t) events == nbatch) {
+            nbatch = ngx_min(nbatch * 2, nevents);
+            nunderused = 0;
+
+        } else if ((ngx_uint_t) events < nbatch / 4
+                   && nbatch > NGX_EPOLL_EVENTS_MIN)
+        {
+            if (++nunderused == NGX_EPOLL_UNDERUSED) {
+                nbatch /= 2;
+                nunderused = 0;
+            }
+
+        } else {
+            nunderused = 0;
+        }
+    }
+
     for (i = 0; i < events; i++) {
         c = event_list[i].data.ptr;
 
@@ -1022,6 +1146,131 @@ ngx_epoll_eventfd_handler(ngx_event_t *ev)
 #endif
 
 
+#if (NGX_STAT_STUB)
+
+static void
+ngx_epoll_stat_publish(ngx_cycle_t *cycle)
+{
+    /*
+     * the counters are kept per worker and added to the shared ones
+     * once in NGX_EPOLL_STAT_PERIOD, so the event loop does not bounce
+     * their cache line between workers on every wakeup
+     */
+
+    if (ngx_epoll_nwakeups) {
+        (void) ngx_atomic_fetch_add(ngx_stat_event_wakeups, ngx_epoll_nwakeups);
+        ngx_epoll_nwakeups = 0;
+    }
+
+    if (ngx_epoll_nevents) {
+        (void) ngx_atomic_fetch_add(ngx_stat_event_events, ngx_epoll_nevents);
+        ngx_epoll_nevents = 0;
+    }
+
+    if (ngx_epoll_wait_time) {
+        (void) ngx_atomic_fetch_add(ngx_stat_event_wait_time,
+                                    ngx_epoll_wait_time);
+        ngx_epoll_wait_time = 0;
+    }
+
+    ngx_epoll_published = ngx_current_msec;
+}
+
+#endif
+
+
+#if (NGX_HAVE_SO_BUSY_POLL)
+
+static ngx_int_t
+ngx_epoll_module_init(ngx_cycle_t *cycle)
+{
+    int                  value;
+    ngx_uint_t           i;
+    ngx_listening_t     *ls;
+    ngx_epoll_conf_t    *epcf;
+    ngx_event_conf_t    *ecf;
+
+    if (ngx_test_config) {
+        return NGX_OK;
+    }
+
+    ecf = ngx_event_get_conf(cycle->conf_ctx, ngx_event_core_module);
+
+    if (ecf->use != ngx_epoll_module.ctx_index) {
+        return NGX_OK;
+    }
+
+    epcf = ngx_event_get_conf(cycle->conf_ctx, ngx_epoll_module);
+
+    if (epcf->busy_poll == 0) {
+        return NGX_OK;
+    }
+
+    /*
+     * the options are set in the master process, as increasing them
+     * requires CAP_NET_ADMIN; accepted sockets inherit them
+     */
+
+    ls = cycle->listening.elts;
+    for (i = 0; i < cycle->listening.nelts; i++) {
+
+        if (ls[i].fd == (ngx_socket_t) -1
+            || (ls[i].sockaddr->sa_family != AF_INET
+#if (NGX_HAVE_INET6)
+                && ls[i].sockaddr->sa_family != AF_INET6
+#endif
+               ))
+        {
+            continue;
+        }
+
+        value = epcf->busy_poll;
+
+        if (setsockopt(ls[i].fd, SOL_SOCKET, SO_BUSY_POLL,
+                       (const void *) &value, sizeof(int))
+            == -1)
+        {
+            ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_socket_errno,
+                          "setsockopt(SO_BUSY_POLL, %d) %V failed, ignored",
+                          value, &ls[i].addr_text);
+            continue;
+        }
+
+#ifdef SO_PREFER_BUSY_POLL
+        value = 1;
+
+        if (setsockopt(ls[i].fd, SOL_SOCKET, SO_PREFER_BUSY_POLL,
+                       (const void *) &value, sizeof(int))
+            == -1)
+        {
+            ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_socket_errno,
+                          "setsockopt(SO_PREFER_BUSY_POLL) %V failed, ignored",
+                          &ls[i].addr_text);
+        }
+#endif
+
+#ifdef SO_BUSY_POLL_BUDGET
+        if (epcf->busy_poll_budget) {
+            value = epcf->busy_poll_budget;
+
+            if (setsockopt(ls[i].fd, SOL_SOCKET, SO_BUSY_POLL_BUDGET,
+                           (const void *) &value, sizeof(int))
+                == -1)
+            {
+                ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_socket_errno,
+                              "setsockopt(SO_BUSY_POLL_BUDGET, %d) %V failed, "
+                              "ignored", value, &ls[i].addr_text);
+            }
+        }
+#endif
+    }
+
+    return NGX_OK;
+}
+
+#endif
+
+
 static void *
 ngx_epoll_create_conf(ngx_cycle_t *cycle)
 {
@@ -1034,6 +1283,9 @@ ngx_epoll_create_conf(ngx_cycle_t *cycle)
 
     epcf->events = NGX_CONF_UNSET;
     epcf->aio_requests = NGX_CONF_UNSET;
+    epcf->busy_poll = NGX_CONF_UNSET_UINT;
+    epcf->busy_poll_budget = NGX_CONF_UNSET_UINT;
+    epcf->events_auto = NGX_CONF_UNSET;
 
     return epcf;
 }
@@ -1046,6 +1298,112 @@ ngx_epoll_init_conf(ngx_cycle_t *cycle, void *conf)
 
     ngx_conf_init_uint_value(epcf->events, 512);
     ngx_conf_init_uint_value(epcf->aio_requests, 32);
+    ngx_conf_init_uint_value(epcf->busy_poll, 0);
+    ngx_conf_init_uint_value(epcf->busy_poll_budget, 0);
+    ngx_conf_init_value(epcf->events_auto, 0);
+
+    return NGX_CONF_OK;
+}
+
+
+static char *
+ngx_epoll_events(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    ngx_epoll_conf_t *epcf = conf;
+
+    ngx_int_t   n;
+    ngx_str_t  *value;
+
+    if (epcf->events != NGX_CONF_UNSET_UINT
+        || epcf->events_auto != NGX_CONF_UNSET)
+    {
+        return "is duplicate";
+    }
+
+    value = cf->args->elts;
+
+    if (ngx_strcmp(value[1].data, "auto") == 0) {
+        epcf->events_auto = 1;
+        return NGX_CONF_OK;
+    }
+
+    n = ngx_atoi(value[1].data, value[1].len);
+    if (n == NGX_ERROR || n == 0) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "invalid number \"%V\"", &value[1]);
+        return NGX_CONF_ERROR;
+    }
+
+    epcf->events = n;
+
+    return NGX_CONF_OK;
+}
+
+
+static char *
+ngx_epoll_busy_poll(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    ngx_epoll_conf_t *epcf = conf;
+
+    ngx_int_t   n;
+    ngx_str_t  *value;
+
+    if (epcf->busy_poll != NGX_CONF_UNSET_UINT) {
+        return "is duplicate";
+    }
+
+    value = cf->args->elts;
+
+    if (ngx_strcmp(value[1].data, "off") == 0) {
+
+        if (cf->args->nelts > 2) {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "invalid parameter \"%V\"", &value[2]);
+            return NGX_CONF_ERROR;
+        }
+
+        epcf->busy_poll = 0;
+        return NGX_CONF_OK;
+    }
+
+    /* the busy polling time in microseconds */
+
+    n = ngx_atoi(value[1].data, value[1].len);
+    if (n == NGX_ERROR || n == 0 || n > NGX_MAX_INT32_VALUE) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "invalid value \"%V\"", &value[1]);
+        return NGX_CONF_ERROR;
+    }
+
+#if (NGX_HAVE_SO_BUSY_POLL || NGX_HAVE_EPOLL_PARAMS)
+    epcf->busy_poll = n;
+#else
+    ngx_conf_log_error(NGX_LOG_WARN, cf, 0,
+                       "\"epoll_busy_poll\" is not supported "
+                       "on this platform, ignored");
+    epcf->busy_poll = 0;
+#endif
+
+    epcf->busy_poll_budget = 0;
+
+    if (cf->args->nelts == 2) {
+        return NGX_CONF_OK;
+    }
+
+    if (ngx_strncmp(value[2].data, "budget=", 7) != 0) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "invalid parameter \"%V\"", &value[2]);
+        return NGX_CONF_ERROR;
+    }
+
+    n = ngx_atoi(value[2].data + 7, value[2].len - 7);
+    if (n == NGX_ERROR || n == 0 || n > 65535) {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "invalid budget \"%V\"", &value[2]);
+        return NGX_CONF_ERROR;
+    }
+
+    epcf->busy_poll_budget = n;
 
     return NGX_CONF_OK;
 }
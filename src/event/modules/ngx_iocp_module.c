@@ -96,7 +96,8 @@ ngx_os_io_t ngx_iocp_io = {
     NULL,
     NULL,
     ngx_overlapped_wsasend_chain,
-    0
+    0,
+    NULL
 };
 
 
@@ -0,0 +1,919 @@
+
+/*
+ * Copyright (C) Igor Sysoev
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_event.h>
+
+#include <linux/io_uring.h>
+
+
+/*
+ * The module uses io_uring poll requests as a replacement for epoll:
+ * the changes are queued as SQEs and are submitted together with waiting
+ * for completions by a single io_uring_enter() call per loop iteration.
+ *
+ * The readiness model is kept intact, so the ngx_os_io functions and
+ * all the event handlers work unmodified: the events added with
+ * NGX_CLEAR_EVENT use multishot poll requests and behave as EPOLLET,
+ * the level events use oneshot poll requests that are rearmed after
+ * each completion while the event stays active.
+ *
+ * Hence the method is "uring_poll": accept, recv and send are still
+ * the usual syscalls.  They cannot be completions as long as OpenSSL,
+ * MSG_PEEK checks, splice() and shutdown() use the socket directly,
+ * and the callers of send_chain() reuse the buffers once it returns.
+ *
+ * The user_data of a poll request is the connection pointer with
+ * the event instance in the bit 0 and the write flag in the bit 1.
+ *
+ * The ev->index is the number of the poll requests of the event
+ * that have not posted their final completion yet, or NGX_INVALID_INDEX
+ * if there are none.  A request is rearmed only when the last of them
+ * is finished, therefore a removal and a subsequent addition of the event
+ * never leave two armed requests.
+ */
+
+
+#define NGX_URING_WRITE  2
+
+
+typedef struct {
+    ngx_uint_t  entries;
+} ngx_uring_conf_t;
+
+
+static ngx_int_t ngx_uring_init(ngx_cycle_t *cycle, ngx_msec_t timer);
+#if (NGX_HAVE_EVENTFD)
+static ngx_int_t ngx_uring_notify_init(ngx_log_t *log);
+static void ngx_uring_notify_handler(ngx_event_t *ev);
+#endif
+static void ngx_uring_done(ngx_cycle_t *cycle);
+static ngx_int_t ngx_uring_add_event(ngx_event_t *ev, ngx_int_t event,
+    ngx_uint_t flags);
+static ngx_int_t ngx_uring_del_event(ngx_event_t *ev, ngx_int_t event,
+    ngx_uint_t flags);
+static ngx_int_t ngx_uring_add_connection(ngx_connection_t *c);
+static ngx_int_t ngx_uring_del_connection(ngx_connection_t *c,
+    ngx_uint_t flags);
+#if (NGX_HAVE_EVENTFD)
+static ngx_int_t ngx_uring_notify(ngx_event_handler_pt handler);
+#endif
+static ngx_int_t ngx_uring_process_events(ngx_cycle_t *cycle, ngx_msec_t timer,
+    ngx_uint_t flags);
+
+static ngx_int_t ngx_uring_poll_add(ngx_event_t *ev, ngx_uint_t write,
+    ngx_uint_t multishot);
+static ngx_int_t ngx_uring_poll_remove(ngx_event_t *ev, ngx_uint_t write);
+static struct io_uring_sqe *ngx_uring_get_sqe(ngx_log_t *log);
+static int ngx_uring_enter(unsigned to_submit, unsigned min_complete,
+    unsigned flags, void *arg, size_t size);
+
+static void *ngx_uring_create_conf(ngx_cycle_t *cycle);
+static char *ngx_uring_init_conf(ngx_cycle_t *cycle, void *conf);
+
+
+static int                    ring = -1;
+
+static u_char                *sq_ring;
+static size_t                 sq_ring_size;
+static u_char                *cq_ring;
+static size_t                 cq_ring_size;
+static struct io_uring_sqe   *sqes;
+static size_t                 sqes_size;
+
+static uint32_t              *sq_khead;
+static uint32_t              *sq_ktail;
+static uint32_t               sq_mask;
+static uint32_t               sq_entries;
+static uint32_t               sq_tail;
+
+static uint32_t              *cq_khead;
+static uint32_t              *cq_ktail;
+static uint32_t               cq_mask;
+static struct io_uring_cqe   *cqes;
+
+#if (NGX_HAVE_EVENTFD)
+static int                    notify_fd = -1;
+static ngx_uint_t             notify_count;
+static ngx_event_t            notify_event;
+static ngx_connection_t       notify_conn;
+#endif
+
+static ngx_str_t      uring_poll_name = ngx_string("uring_poll");
+
+static ngx_command_t  ngx_uring_poll_commands[] = {
+
+    { ngx_string("uring_poll_entries"),
+      NGX_EVENT_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_num_slot,
+      0,
+      offsetof(ngx_uring_conf_t, entries),
+      NULL },
+
+      ngx_null_command
+};
+
+
+static ngx_event_module_t  ngx_uring_poll_module_ctx = {
+    &uring_poll_name,
+    ngx_uring_create_conf,               /* create configuration */
+    ngx_uring_init_conf,                 /* init configuration */
+
+    {
+        ngx_uring_add_event,             /* add an event */
+        ngx_uring_del_event,             /* delete an event */
+        ngx_uring_add_event,             /* enable an event */
+        ngx_uring_del_event,             /* disable an event */
+        ngx_uring_add_connection,        /* add an connection */
+        ngx_uring_del_connection,        /* delete an connection */
+#if (NGX_HAVE_EVENTFD)
+        ngx_uring_notify,                /* trigger a notify */
+#else
+        NULL,                            /* trigger a notify */
+#endif
+        ngx_uring_process_events,        /* process the events */
+        ngx_uring_init,                  /* init the events */
+        ngx_uring_done,                  /* done the events */
+    }
+};
+
+ngx_module_t  ngx_uring_poll_module = {
+    NGX_MODULE_V1,
+    &ngx_uring_poll_module_ctx,          /* module context */
+    ngx_uring_poll_commands,             /* module directives */
+    NGX_EVENT_MODULE,                    /* module type */
+    NULL,                                /* init master */
+    NULL,                                /* init module */
+    NULL,                                /* init process */
+    NULL,                                /* init thread */
+    NULL,                                /* exit thread */
+    NULL,                                /* exit process */
+    NULL,                                /* exit master */
+    NGX_MODULE_V1_PADDING
+};
+
+
+/*
+ * We call io_uring_setup() and io_uring_enter() directly as syscalls
+ * instead of liburing usage to avoid an external dependency.
+ */
+
+static int
+io_uring_setup(unsigned entries, struct io_uring_params *p)
+{
+    return syscall(SYS_io_uring_setup, entries, p);
+}
+
+
+static int
+ngx_uring_enter(unsigned to_submit, unsigned min_complete, unsigned flags,
+    void *arg, size_t size)
+{
+    return syscall(SYS_io_uring_enter, ring, to_submit, min_complete, flags,
+                   arg, size);
+}
+
+
+static ngx_int_t
+ngx_uring_init(ngx_cycle_t *cycle, ngx_msec_t timer)
+{
+    uint32_t                *array, i;
+    ngx_uring_conf_t        *urcf;
+    struct io_uring_params   p;
+
+    urcf = ngx_event_get_conf(cycle->conf_ctx, ngx_uring_poll_module);
+
+    if (ring == -1) {
+        ngx_memzero(&p, sizeof(struct io_uring_params));
+
+        /*
+         * multishot poll requests may post several completions
+         * for each connection between two iterations
+         */
+
+        p.flags = IORING_SETUP_CQSIZE|IORING_SETUP_CLAMP;
+        p.cq_entries = ngx_max(urcf->entries, cycle->connection_n) * 2;
+
+#ifdef IORING_SETUP_COOP_TASKRUN
+        p.flags |= IORING_SETUP_COOP_TASKRUN;
+#endif
+
+        ring = io_uring_setup(urcf->entries, &p);
+
+#ifdef IORING_SETUP_COOP_TASKRUN
+        if (ring == -1 && ngx_errno == NGX_EINVAL) {
+
+            /* IORING_SETUP_COOP_TASKRUN appeared in Linux 5.19 */
+
+            p.flags &= ~IORING_SETUP_COOP_TASKRUN;
+            ring = io_uring_setup(urcf->entries, &p);
+        }
+#endif
+
+        if (ring == -1) {
+            ngx_log_error(NGX_LOG_EMERG, cycle->log, ngx_errno,
+                          "io_uring_setup() failed");
+            return NGX_ERROR;
+        }
+
+        /*
+         * IORING_FEAT_EXT_ARG appeared in Linux 5.11,
+         * multishot poll requests appeared in Linux 5.13
+         * together with IORING_FEAT_RSRC_TAGS
+         */
+
+        if ((p.features & (IORING_FEAT_SINGLE_MMAP|IORING_FEAT_NODROP
+                           |IORING_FEAT_EXT_ARG|IORING_FEAT_RSRC_TAGS))
+            != (IORING_FEAT_SINGLE_MMAP|IORING_FEAT_NODROP
+                |IORING_FEAT_EXT_ARG|IORING_FEAT_RSRC_TAGS))
+        {
+            ngx_log_error(NGX_LOG_EMERG, cycle->log, 0,
+                          "io_uring features %08XD are not sufficient, "
+                          "at least Linux 5.13 is required", p.features);
+            goto failed;
+        }
+
+        sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+        cq_ring_size = p.cq_off.cqes
+                       + p.cq_entries * sizeof(struct io_uring_cqe);
+
+        sq_ring_size = ngx_max(sq_ring_size, cq_ring_size);
+        cq_ring_size = 0;
+
+        sq_ring = mmap(NULL, sq_ring_size, PROT_READ|PROT_WRITE,
+                       MAP_SHARED|MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+
+        if (sq_ring == MAP_FAILED) {
+            ngx_log_error(NGX_LOG_EMERG, cycle->log, ngx_errno,
+                          "mmap(IORING_OFF_SQ_RING, %uz) failed",
+                          sq_ring_size);
+            sq_ring = NULL;
+            goto failed;
+        }
+
+        cq_ring = sq_ring;
+
+        sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+
+        sqes = mmap(NULL, sqes_size, PROT_READ|PROT_WRITE,
+                    MAP_SHARED|MAP_POPULATE, ring, IORING_OFF_SQES);
+
+        if (sqes == MAP_FAILED) {
+            ngx_log_error(NGX_LOG_EMERG, cycle->log, ngx_errno,
+                          "mmap(IORING_OFF_SQES, %uz) failed", sqes_size);
+            sqes = NULL;
+            goto failed;
+        }
+
+        sq_khead = (uint32_t *) (sq_ring + p.sq_off.head);
+        sq_ktail = (uint32_t *) (sq_ring + p.sq_off.tail);
+        sq_mask = *(uint32_t *) (sq_ring + p.sq_off.ring_mask);
+        sq_entries = p.sq_entries;
+        sq_tail = *sq_ktail;
+
+        /* the SQE indirection array is used as an identity mapping */
+
+        array = (uint32_t *) (sq_ring + p.sq_off.array);
+
+        for (i = 0; i < sq_entries; i++) {
+            array[i] = i;
+        }
+
+        cq_khead = (uint32_t *) (cq_ring + p.cq_off.head);
+        cq_ktail = (uint32_t *) (cq_ring + p.cq_off.tail);
+        cq_mask = *(uint32_t *) (cq_ring + p.cq_off.ring_mask);
+        cqes = (struct io_uring_cqe *) (cq_ring + p.cq_off.cqes);
+
+        ngx_log_debug3(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
+                       "io_uring: fd:%d sq:%uD cq:%uD",
+                       ring, p.sq_entries, p.cq_entries);
+
+#if (NGX_HAVE_EVENTFD)
+        if (ngx_uring_notify_init(cycle->log) != NGX_OK) {
+            ngx_uring_poll_module_ctx.actions.notify = NULL;
+        }
+#endif
+
+#if (NGX_HAVE_FILE_AIO)
+
+        /* Linux native AIO is bound to the epoll eventfd */
+
+        ngx_file_aio = 0;
+
+#endif
+
+#if (NGX_HAVE_EPOLLRDHUP)
+
+        /* poll requests report POLLRDHUP as epoll does */
+
+        ngx_use_epoll_rdhup = 1;
+
+#endif
+    }
+
+    ngx_io = ngx_os_io;
+
+    ngx_event_actions = ngx_uring_poll_module_ctx.actions;
+
+    ngx_event_flags = NGX_USE_CLEAR_EVENT
+                      |NGX_USE_GREEDY_EVENT
+                      |NGX_USE_EPOLL_EVENT;
+
+    return NGX_OK;
+
+failed:
+
+    ngx_uring_done(cycle);
+
+    return NGX_ERROR;
+}
+
+
+#if (NGX_HAVE_EVENTFD)
+
+static ngx_int_t
+ngx_uring_notify_init(ngx_log_t *log)
+{
+#if (NGX_HAVE_SYS_EVENTFD_H)
+    notify_fd = eventfd(0, 0);
+#else
+    notify_fd = syscall(SYS_eventfd, 0);
+#endif
+
+    if (notify_fd == -1) {
+        ngx_log_error(NGX_LOG_EMERG, log, ngx_errno, "eventfd() failed");
+        return NGX_ERROR;
+    }
+
+    ngx_log_debug1(NGX_LOG_DEBUG_EVENT, log, 0,
+                   "notify eventfd: %d", notify_fd);
+
+    notify_event.data = &notify_conn;
+    notify_event.handler = ngx_uring_notify_handler;
+    notify_event.index = NGX_INVALID_INDEX;
+    notify_event.log = log;
+
+    notify_conn.fd = notify_fd;
+    notify_conn.read = &notify_event;
+    notify_conn.log = log;
+
+    if (ngx_uring_poll_add(&notify_event, 0, 1) != NGX_OK) {
+
+        if (close(notify_fd) == -1) {
+            ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                            "eventfd close() failed");
+        }
+
+        notify_fd = -1;
+
+        return NGX_ERROR;
+    }
+
+    notify_event.active = 1;
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_uring_notify_handler(ngx_event_t *ev)
+{
+    ssize_t               n;
+    uint64_t              count;
+    ngx_err_t             err;
+    ngx_event_handler_pt  handler;
+
+    /* the ev->index is used by the module itself */
+
+    if (++notify_count == NGX_MAX_UINT32_VALUE) {
+        notify_count = 0;
+
+        n = read(notify_fd, &count, sizeof(uint64_t));
+
+        err = ngx_errno;
+
+        ngx_log_debug3(NGX_LOG_DEBUG_EVENT, ev->log, 0,
+                       "read() eventfd %d: %z count:%uL", notify_fd, n, count);
+
+        if ((size_t) n != sizeof(uint64_t)) {
+            ngx_log_error(NGX_LOG_ALERT, ev->log, err,
+                          "read() eventfd %d failed", notify_fd);
+        }
+    }
+
+    handler = notify_conn.data;
+    handler(ev);
+}
+
+#endif
+
+
+static void
+ngx_uring_done(ngx_cycle_t *cycle)
+{
+    if (sqes) {
+        if (munmap(sqes, sqes_size) == -1) {
+            ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_errno,
+                          "munmap(IORING_OFF_SQES) failed");
+        }
+
+        sqes = NULL;
+    }
+
+    if (sq_ring) {
+        if (munmap(sq_ring, sq_ring_size) == -1) {
+            ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_errno,
+                          "munmap(IORING_OFF_SQ_RING) failed");
+        }
+
+        sq_ring = NULL;
+        cq_ring = NULL;
+    }
+
+    if (ring != -1 && close(ring) == -1) {
+        ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_errno,
+                      "io_uring close() failed");
+    }
+
+    ring = -1;
+
+#if (NGX_HAVE_EVENTFD)
+
+    if (notify_fd != -1 && close(notify_fd) == -1) {
+        ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_errno,
+                      "eventfd close() failed");
+    }
+
+    notify_fd = -1;
+
+#endif
+}
+
+
+static ngx_int_t
+ngx_uring_add_event(ngx_event_t *ev, ngx_int_t event, ngx_uint_t flags)
+{
+    ngx_uint_t  write;
+
+    write = (event == NGX_READ_EVENT) ? 0 : NGX_URING_WRITE;
+
+    /*
+     * the level events are emulated with oneshot poll requests,
+     * EPOLLEXCLUSIVE is not supported by the multishot ones
+     */
+
+    ev->oneshot = (flags & NGX_CLEAR_EVENT) ? 0 : 1;
+
+    ngx_log_debug4(NGX_LOG_DEBUG_EVENT, ev->log, 0,
+                   "uring add event: fd:%d w:%ui os:%d n:%ui",
+                   ((ngx_connection_t *) ev->data)->fd, write, ev->oneshot,
+                   ev->index);
+
+    /*
+     * the previous request may still be armed if it was removed
+     * in this iteration, its completion is not reaped yet
+     */
+
+    if (ngx_uring_poll_add(ev, write, !ev->oneshot) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    ev->active = 1;
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_uring_del_event(ngx_event_t *ev, ngx_int_t event, ngx_uint_t flags)
+{
+    ngx_uint_t  write;
+
+    /*
+     * unlike epoll, an armed poll request holds a reference to the file,
+     * so the request is removed even if the descriptor is being closed
+     */
+
+    write = (event == NGX_READ_EVENT) ? 0 : NGX_URING_WRITE;
+
+    ngx_log_debug3(NGX_LOG_DEBUG_EVENT, ev->log, 0,
+                   "uring del event: fd:%d w:%ui n:%ui",
+                   ((ngx_connection_t *) ev->data)->fd, write, ev->index);
+
+    ev->active = 0;
+
+    if (ev->index == NGX_INVALID_INDEX) {
+        return NGX_OK;
+    }
+
+    return ngx_uring_poll_remove(ev, write);
+}
+
+
+static ngx_int_t
+ngx_uring_add_connection(ngx_connection_t *c)
+{
+    ngx_log_debug1(NGX_LOG_DEBUG_EVENT, c->log, 0,
+                   "uring add connection: fd:%d", c->fd);
+
+    c->read->oneshot = 0;
+    c->write->oneshot = 0;
+
+    if (ngx_uring_poll_add(c->read, 0, 1) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    c->read->active = 1;
+
+    if (ngx_uring_poll_add(c->write, NGX_URING_WRITE, 1) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    c->write->active = 1;
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_uring_del_connection(ngx_connection_t *c, ngx_uint_t flags)
+{
+    ngx_int_t  rc;
+
+    ngx_log_debug1(NGX_LOG_DEBUG_EVENT, c->log, 0,
+                   "uring del connection: fd:%d", c->fd);
+
+    rc = NGX_OK;
+
+    c->read->active = 0;
+    c->write->active = 0;
+
+    if (c->read->index != NGX_INVALID_INDEX
+        && ngx_uring_poll_remove(c->read, 0) != NGX_OK)
+    {
+        rc = NGX_ERROR;
+    }
+
+    if (c->write->index != NGX_INVALID_INDEX
+        && ngx_uring_poll_remove(c->write, NGX_URING_WRITE) != NGX_OK)
+    {
+        rc = NGX_ERROR;
+    }
+
+    return rc;
+}
+
+
+#if (NGX_HAVE_EVENTFD)
+
+static ngx_int_t
+ngx_uring_notify(ngx_event_handler_pt handler)
+{
+    static uint64_t inc = 1;
+
+    notify_conn.data = handler;
+
+    if ((size_t) write(notify_fd, &inc, sizeof(uint64_t)) != sizeof(uint64_t)) {
+        ngx_log_error(NGX_LOG_ALERT, notify_event.log, ngx_errno,
+                      "write() to eventfd %d failed", notify_fd);
+        return NGX_ERROR;
+    }
+
+    return NGX_OK;
+}
+
+#endif
+
+
+static ngx_int_t
+ngx_uring_process_events(ngx_cycle_t *cycle, ngx_msec_t timer, ngx_uint_t flags)
+{
+    int                             n, res;
+    unsigned                        to_submit, wait;
+    uint32_t                        head, tail, revents;
+    uintptr_t                       data;
+    ngx_int_t                       instance;
+    ngx_uint_t                      level, write;
+    ngx_err_t                       err;
+    ngx_event_t                    *ev;
+    ngx_queue_t                    *queue;
+    ngx_connection_t               *c;
+    struct io_uring_cqe            *cqe;
+    struct __kernel_timespec        ts;
+    struct io_uring_getevents_arg   arg;
+
+    ngx_log_debug1(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
+                   "uring timer: %M", timer);
+
+    to_submit = sq_tail - *(volatile uint32_t *) sq_khead;
+
+    ngx_memzero(&arg, sizeof(struct io_uring_getevents_arg));
+
+    if (timer != NGX_TIMER_INFINITE) {
+        ts.tv_sec = timer / 1000;
+        ts.tv_nsec = (timer % 1000) * 1000000;
+        arg.ts = (uint64_t) (uintptr_t) &ts;
+    }
+
+    /* the completions left from the previous iteration are not waited for */
+
+    wait = (*(volatile uint32_t *) cq_ktail == *cq_khead) ? 1 : 0;
+
+    n = ngx_uring_enter(to_submit, wait,
+                        IORING_ENTER_GETEVENTS|IORING_ENTER_EXT_ARG,
+                        &arg, sizeof(struct io_uring_getevents_arg));
+
+    err = (n == -1) ? ngx_errno : 0;
+
+    if (flags & NGX_UPDATE_TIME || ngx_event_timer_alarm) {
+        ngx_time_update();
+    }
+
+    if (err) {
+        if (err == NGX_EINTR) {
+
+            if (ngx_event_timer_alarm) {
+                ngx_event_timer_alarm = 0;
+                return NGX_OK;
+            }
+
+            level = NGX_LOG_INFO;
+
+        } else if (err == ETIME) {
+            return NGX_OK;
+
+        } else if (err == NGX_EBUSY) {
+
+            /* the overflowed completions are to be reaped first */
+
+            level = 0;
+
+        } else {
+            level = NGX_LOG_ALERT;
+        }
+
+        if (level) {
+            ngx_log_error(level, cycle->log, err, "io_uring_enter() failed");
+            return NGX_ERROR;
+        }
+    }
+
+    ngx_log_debug2(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
+                   "io_uring_enter: submitted:%d of %ud", n, to_submit);
+
+    head = *cq_khead;
+    tail = *(volatile uint32_t *) cq_ktail;
+
+    ngx_memory_barrier();
+
+    for ( /* void */ ; head != tail; head++) {
+        cqe = &cqes[head & cq_mask];
+
+        data = (uintptr_t) cqe->user_data;
+        res = cqe->res;
+
+        if (data == 0) {
+            /* a poll removal */
+            continue;
+        }
+
+        instance = data & 1;
+        write = data & NGX_URING_WRITE;
+        c = (ngx_connection_t *) (data & (uintptr_t) ~3);
+
+        ev = write ? c->write : c->read;
+
+        if (c->fd == -1 || ev->instance != instance) {
+
+            /*
+             * the stale event from a file descriptor
+             * that was just closed in this iteration
+             */
+
+            ngx_log_debug1(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
+                           "uring: stale event %p", c);
+            continue;
+        }
+
+        ngx_log_debug5(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
+                       "uring: fd:%d w:%ui res:%d f:%uD n:%ui",
+                       c->fd, write, res, cqe->flags, ev->index);
+
+        if (!(cqe->flags & IORING_CQE_F_MORE)) {
+
+            /* the final completion of the request */
+
+            if (ev->index != NGX_INVALID_INDEX && --ev->index == 0) {
+                ev->index = NGX_INVALID_INDEX;
+            }
+
+            /* the requests which failed are not rearmed */
+
+            if (ev->index == NGX_INVALID_INDEX && ev->active && res >= 0) {
+                if (ngx_uring_poll_add(ev, write, !ev->oneshot) != NGX_OK) {
+                    ev->active = 0;
+                }
+            }
+        }
+
+        if (res == -ECANCELED || !ev->active) {
+            continue;
+        }
+
+        if (res < 0) {
+            ngx_log_error(NGX_LOG_ALERT, cycle->log, -res,
+                          "poll request failed on fd:%d", c->fd);
+
+            if (ev->index == NGX_INVALID_INDEX) {
+                ev->active = 0;
+            }
+
+            ev->error = 1;
+            revents = EPOLLERR;
+
+        } else {
+            revents = (uint32_t) res;
+        }
+
+        if (revents & (EPOLLERR|EPOLLHUP)) {
+
+            /* handle the error in the active handler */
+
+            revents |= write ? EPOLLOUT : EPOLLIN;
+        }
+
+        if (write) {
+            if (!(revents & EPOLLOUT)) {
+                continue;
+            }
+
+            ev->ready = 1;
+#if (NGX_THREADS)
+            ev->complete = 1;
+#endif
+
+            if (flags & NGX_POST_EVENTS) {
+                ngx_post_event(ev, &ngx_posted_events);
+
+            } else {
+                ev->handler(ev);
+            }
+
+            continue;
+        }
+
+        if (!(revents & EPOLLIN)) {
+            continue;
+        }
+
+#if (NGX_HAVE_EPOLLRDHUP)
+        if (revents & EPOLLRDHUP) {
+            ev->pending_eof = 1;
+        }
+#endif
+
+        ev->ready = 1;
+        ev->available = -1;
+
+        if (flags & NGX_POST_EVENTS) {
+            queue = ev->accept ? &ngx_posted_accept_events
+                               : &ngx_posted_events;
+
+            ngx_post_event(ev, queue);
+
+        } else {
+            ev->handler(ev);
+        }
+    }
+
+    ngx_memory_barrier();
+
+    *(volatile uint32_t *) cq_khead = head;
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_uring_poll_add(ngx_event_t *ev, ngx_uint_t write, ngx_uint_t multishot)
+{
+    ngx_connection_t     *c;
+    struct io_uring_sqe  *sqe;
+
+    c = ev->data;
+
+    sqe = ngx_uring_get_sqe(ev->log);
+    if (sqe == NULL) {
+        return NGX_ERROR;
+    }
+
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = c->fd;
+    sqe->poll32_events = write ? EPOLLOUT : (EPOLLIN|EPOLLRDHUP);
+    sqe->len = multishot ? IORING_POLL_ADD_MULTI : 0;
+    sqe->user_data = (uintptr_t) c | write | ev->instance;
+
+    ev->index = (ev->index == NGX_INVALID_INDEX) ? 1 : ev->index + 1;
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_uring_poll_remove(ngx_event_t *ev, ngx_uint_t write)
+{
+    ngx_connection_t     *c;
+    struct io_uring_sqe  *sqe;
+
+    c = ev->data;
+
+    sqe = ngx_uring_get_sqe(ev->log);
+    if (sqe == NULL) {
+        return NGX_ERROR;
+    }
+
+    /* the removal result is not needed, the request completes anyway */
+
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = (uintptr_t) c | write | ev->instance;
+    sqe->user_data = 0;
+
+    return NGX_OK;
+}
+
+
+static struct io_uring_sqe *
+ngx_uring_get_sqe(ngx_log_t *log)
+{
+    int                   n;
+    uint32_t              head;
+    struct io_uring_sqe  *sqe;
+
+    head = *(volatile uint32_t *) sq_khead;
+
+    if (sq_tail - head == sq_entries) {
+
+        /* the submission queue is full, flush it without waiting */
+
+        n = ngx_uring_enter(sq_entries, 0, 0, NULL, 0);
+
+        if (n == -1) {
+            ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                          "io_uring_enter() failed");
+            return NULL;
+        }
+
+        head = *(volatile uint32_t *) sq_khead;
+
+        if (sq_tail - head == sq_entries) {
+            ngx_log_error(NGX_LOG_ALERT, log, 0,
+                          "io_uring submission queue is full");
+            return NULL;
+        }
+    }
+
+    sqe = &sqes[sq_tail & sq_mask];
+
+    ngx_memzero(sqe, sizeof(struct io_uring_sqe));
+
+    sq_tail++;
+
+    ngx_memory_barrier();
+
+    *(volatile uint32_t *) sq_ktail = sq_tail;
+
+    return sqe;
+}
+
+
+static void *
+ngx_uring_create_conf(ngx_cycle_t *cycle)
+{
+    ngx_uring_conf_t  *urcf;
+
+    urcf = ngx_palloc(cycle->pool, sizeof(ngx_uring_conf_t));
+    if (urcf == NULL) {
+        return NULL;
+    }
+
+    urcf->entries = NGX_CONF_UNSET;
+
+    return urcf;
+}
+
+
+static char *
+ngx_uring_init_conf(ngx_cycle_t *cycle, void *conf)
+{
+    ngx_uring_conf_t *urcf = conf;
+
+    ngx_conf_init_uint_value(urcf->entries, 1024);
+
+    return NGX_CONF_OK;
+}
@@ -31,6 +31,9 @@ static char *ngx_event_use(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
 static char *ngx_event_debug_connection(ngx_conf_t *cf, ngx_command_t *cmd,
     void *conf);
 
+static void ngx_event_pool_cache_handler(ngx_event_t *ev);
+static void ngx_event_slab_compact_handler(ngx_event_t *ev);
+
 static void *ngx_event_core_create_conf(ngx_cycle_t *cycle);
 static char *ngx_event_core_init_conf(ngx_cycle_t *cycle, void *conf);
 
@@ -58,6 +61,12 @@ ngx_int_t             ngx_accept_disabled;
 ngx_uint_t            ngx_use_exclusive_accept;
 
 
+#define NGX_POOL_CACHE_TRIM   10000
+
+static ngx_event_t    ngx_pool_cache_event;
+static ngx_event_t    ngx_slab_compact_event;
+
+
 #if (NGX_STAT_STUB)
 
 static ngx_atomic_t   ngx_stat_accepted0;
@@ -74,6 +83,20 @@ static ngx_atomic_t   ngx_stat_writing0;
 ngx_atomic_t         *ngx_stat_writing = &ngx_stat_writing0;
 static ngx_atomic_t   ngx_stat_waiting0;
 ngx_atomic_t         *ngx_stat_waiting = &ngx_stat_waiting0;
+static ngx_atomic_t   ngx_stat_udp_batches0;
+ngx_atomic_t         *ngx_stat_udp_batches = &ngx_stat_udp_batches0;
+static ngx_atomic_t   ngx_stat_udp_datagrams0;
+ngx_atomic_t         *ngx_stat_udp_datagrams = &ngx_stat_udp_datagrams0;
+static ngx_atomic_t   ngx_stat_event_wakeups0;
+ngx_atomic_t         *ngx_stat_event_wakeups = &ngx_stat_event_wakeups0;
+static ngx_atomic_t   ngx_stat_event_events0;
+ngx_atomic_t         *ngx_stat_event_events = &ngx_stat_event_events0;
+static ngx_atomic_t   ngx_stat_event_wait_time0;
+ngx_atomic_t         *ngx_stat_event_wait_time = &ngx_stat_event_wait_time0;
+static ngx_atomic_t   ngx_stat_event_yields0;
+ngx_atomic_t         *ngx_stat_event_yields = &ngx_stat_event_yields0;
+static ngx_atomic_t   ngx_stat_event_max_stall0;
+ngx_atomic_t         *ngx_stat_event_max_stall = &ngx_stat_event_max_stall0;
 
 #endif
 
@@ -155,6 +178,20 @@ static ngx_command_t  ngx_event_core_commands[] = {
       offsetof(ngx_event_conf_t, accept_mutex_delay),
       NULL },
 
+    { ngx_string("timer_wheel"),
+      NGX_EVENT_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      0,
+      offsetof(ngx_event_conf_t, timer_wheel),
+      NULL },
+
+    { ngx_string("event_loop_budget"),
+      NGX_EVENT_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_msec_slot,
+      0,
+      offsetof(ngx_event_conf_t, loop_budget),
+      NULL },
+
     { ngx_string("debug_connection"),
       NGX_EVENT_CONF|NGX_CONF_TAKE1,
       ngx_event_debug_connection,
@@ -238,11 +275,28 @@ ngx_process_events_and_timers(ngx_cycle_t *cycle)
         }
     }
 
+    if (ngx_event_loop_budget) {
+
+        /*
+         * all events are posted, so accept events are handled first,
+         * and I/O events are handled within the time budget
+         */
+
+        flags |= NGX_POST_EVENTS;
+    }
+
     if (!ngx_queue_empty(&ngx_posted_next_events)) {
         ngx_event_move_posted_next(cycle);
         timer = 0;
     }
 
+    if (!ngx_queue_empty(&ngx_posted_events)
+        || !ngx_queue_empty(&ngx_posted_deferred_events))
+    {
+        /* events left from the previous iteration */
+        timer = 0;
+    }
+
     delta = ngx_current_msec;
 
     (void) ngx_process_events(cycle, timer, flags);
@@ -252,6 +306,8 @@ ngx_process_events_and_timers(ngx_cycle_t *cycle)
     ngx_log_debug1(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
                    "timer delta: %M", delta);
 
+    ngx_event_budget_start();
+
     ngx_event_process_posted(cycle, &ngx_posted_accept_events);
 
     if (ngx_accept_mutex_held) {
@@ -260,7 +316,15 @@ ngx_process_events_and_timers(ngx_cycle_t *cycle)
 
     ngx_event_expire_timers();
 
-    ngx_event_process_posted(cycle, &ngx_posted_events);
+    if (ngx_event_loop_budget) {
+        ngx_event_process_posted_budget(cycle, &ngx_posted_events);
+        ngx_event_process_posted_budget(cycle, &ngx_posted_deferred_events);
+        ngx_event_budget_done();
+
+    } else {
+        ngx_event_process_posted(cycle, &ngx_posted_events);
+        ngx_event_process_posted(cycle, &ngx_posted_deferred_events);
+    }
 }
 
 
@@ -563,13 +627,22 @@ ngx_event_module_init(ngx_cycle_t *cycle)
            + cl          /* ngx_stat_active */
            + cl          /* ngx_stat_reading */
            + cl          /* ngx_stat_writing */
-           + cl;         /* ngx_stat_waiting */
+           + cl          /* ngx_stat_waiting */
+           + cl          /* ngx_stat_udp_batches */
+           + cl          /* ngx_stat_udp_datagrams */
+           + cl          /* ngx_stat_event_wakeups */
+           + cl          /* ngx_stat_event_events */
+           + cl          /* ngx_stat_event_wait_time */
+           + cl          /* ngx_stat_event_yields */
+           + cl;         /* ngx_stat_event_max_stall */
 
 #endif
 
     shm.size = size;
     ngx_str_set(&shm.name, "nginx_shared_zone");
     shm.log = cycle->log;
+    shm.hugepages = 0;
+    shm.interleave = 0;
 
     if (ngx_shm_alloc(&shm) != NGX_OK) {
         return NGX_ERROR;
@@ -610,6 +683,13 @@ ngx_event_module_init(ngx_cycle_t *cycle)
     ngx_stat_reading = (ngx_atomic_t *) (shared + 7 * cl);
     ngx_stat_writing = (ngx_atomic_t *) (shared + 8 * cl);
     ngx_stat_waiting = (ngx_atomic_t *) (shared + 9 * cl);
+    ngx_stat_udp_batches = (ngx_atomic_t *) (shared + 10 * cl);
+    ngx_stat_udp_datagrams = (ngx_atomic_t *) (shared + 11 * cl);
+    ngx_stat_event_wakeups = (ngx_atomic_t *) (shared + 12 * cl);
+    ngx_stat_event_events = (ngx_atomic_t *) (shared + 13 * cl);
+    ngx_stat_event_wait_time = (ngx_atomic_t *) (shared + 14 * cl);
+    ngx_stat_event_yields = (ngx_atomic_t *) (shared + 15 * cl);
+    ngx_stat_event_max_stall = (ngx_atomic_t *) (shared + 16 * cl);
 
 #endif
 
@@ -671,11 +751,41 @@ ngx_event_process_init(ngx_cycle_t *cycle)
     ngx_queue_init(&ngx_posted_accept_events);
     ngx_queue_init(&ngx_posted_next_events);
     ngx_queue_init(&ngx_posted_events);
+    ngx_queue_init(&ngx_posted_deferred_events);
+
+    ngx_event_timer_wheel = ecf->timer_wheel;
+    ngx_event_loop_budget = ecf->loop_budget;
 
     if (ngx_event_timer_init(cycle->log) == NGX_ERROR) {
         return NGX_ERROR;
     }
 
+    if (ccf->pool_cache) {
+        ngx_pool_cache_init(ccf->pool_cache);
+
+        ngx_pool_cache_event.handler = ngx_event_pool_cache_handler;
+        ngx_pool_cache_event.log = cycle->log;
+        ngx_pool_cache_event.data = cycle;
+        ngx_pool_cache_event.cancelable = 1;
+
+        ngx_add_timer(&ngx_pool_cache_event, NGX_POOL_CACHE_TRIM);
+    }
+
+    /* zones are compacted by a single worker */
+
+    if (ccf->slab_compaction
+        && (ngx_process == NGX_PROCESS_WORKER
+            || ngx_process == NGX_PROCESS_SINGLE)
+        && ngx_worker == 0)
+    {
+        ngx_slab_compact_event.handler = ngx_event_slab_compact_handler;
+        ngx_slab_compact_event.log = cycle->log;
+        ngx_slab_compact_event.data = cycle;
+        ngx_slab_compact_event.cancelable = 1;
+
+        ngx_add_timer(&ngx_slab_compact_event, ccf->slab_compaction);
+    }
+
     for (m = 0; cycle->modules[m]; m++) {
         if (cycle->modules[m]->type != NGX_EVENT_MODULE) {
             continue;
@@ -891,6 +1001,10 @@ ngx_event_process_init(ngx_cycle_t *cycle)
 
 #else
 
+        if (c->type == SOCK_DGRAM && ngx_event_udp_init(cycle) != NGX_OK) {
+            return NGX_ERROR;
+        }
+
         if (c->type == SOCK_STREAM) {
             rev->handler = ngx_event_accept;
 
@@ -983,6 +1097,77 @@ ngx_send_lowat(ngx_connection_t *c, size_t lowat)
 }
 
 
+static void
+ngx_event_pool_cache_handler(ngx_event_t *ev)
+{
+    ngx_log_debug0(NGX_LOG_DEBUG_EVENT, ev->log, 0, "pool cache trim");
+
+    ngx_pool_cache_trim();
+
+    ngx_add_timer(ev, NGX_POOL_CACHE_TRIM);
+}
+
+
+static void
+ngx_event_slab_compact_handler(ngx_event_t *ev)
+{
+    void             *p;
+    ngx_uint_t        i;
+    ngx_cycle_t      *cycle;
+    ngx_shm_zone_t   *zone;
+    ngx_list_part_t  *part;
+    ngx_slab_pool_t  *sp;
+    ngx_core_conf_t  *ccf;
+
+    cycle = ev->data;
+
+    part = &cycle->shared_memory.part;
+    zone = part->elts;
+
+    for (i = 0; /* void */ ; i++) {
+
+        if (i >= part->nelts) {
+            if (part->next == NULL) {
+                break;
+            }
+            part = part->next;
+            zone = part->elts;
+            i = 0;
+        }
+
+        if (zone[i].move == NULL) {
+            continue;
+        }
+
+        sp = (ngx_slab_pool_t *) zone[i].shm.addr;
+
+        /* do not wait for the zone, it will be compacted next time */
+
+        if (!ngx_shmtx_trylock(&sp->mutex)) {
+            continue;
+        }
+
+        if (ngx_slab_compact_begin(sp) == NGX_OK) {
+
+            ngx_log_debug1(NGX_LOG_DEBUG_EVENT, ev->log, 0,
+                           "slab compact zone \"%V\"", &zone[i].shm.name);
+
+            while ((p = ngx_slab_compact_next(sp)) != NULL) {
+                zone[i].move(&zone[i], p);
+            }
+
+            ngx_slab_compact_end(sp);
+        }
+
+        ngx_shmtx_unlock(&sp->mutex);
+    }
+
+    ccf = (ngx_core_conf_t *) ngx_get_conf(cycle->conf_ctx, ngx_core_module);
+
+    ngx_add_timer(ev, ccf->slab_compaction);
+}
+
+
 static char *
 ngx_events_block(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 {
@@ -1269,6 +1454,8 @@ ngx_event_core_create_conf(ngx_cycle_t *cycle)
     ecf->multi_accept = NGX_CONF_UNSET;
     ecf->accept_mutex = NGX_CONF_UNSET;
     ecf->accept_mutex_delay = NGX_CONF_UNSET_MSEC;
+    ecf->timer_wheel = NGX_CONF_UNSET;
+    ecf->loop_budget = NGX_CONF_UNSET_MSEC;
     ecf->name = (void *) NGX_CONF_UNSET;
 
 #if (NGX_DEBUG)
@@ -1368,6 +1555,8 @@ ngx_event_core_init_conf(ngx_cycle_t *cycle, void *conf)
     ngx_conf_init_value(ecf->multi_accept, 0);
     ngx_conf_init_value(ecf->accept_mutex, 0);
     ngx_conf_init_msec_value(ecf->accept_mutex_delay, 500);
+    ngx_conf_init_value(ecf->timer_wheel, 0);
+    ngx_conf_init_msec_value(ecf->loop_budget, 0);
 
     return NGX_CONF_OK;
 }
@@ -435,6 +435,10 @@ typedef struct {
 
     ngx_msec_t    accept_mutex_delay;
 
+    ngx_flag_t    timer_wheel;
+
+    ngx_msec_t    loop_budget;
+
     u_char       *name;
 
 #if (NGX_DEBUG)
@@ -474,6 +478,13 @@ extern ngx_atomic_t  *ngx_stat_active;
 extern ngx_atomic_t  *ngx_stat_reading;
 extern ngx_atomic_t  *ngx_stat_writing;
 extern ngx_atomic_t  *ngx_stat_waiting;
+extern ngx_atomic_t  *ngx_stat_udp_batches;
+extern ngx_atomic_t  *ngx_stat_udp_datagrams;
+extern ngx_atomic_t  *ngx_stat_event_wakeups;
+extern ngx_atomic_t  *ngx_stat_event_events;
+extern ngx_atomic_t  *ngx_stat_event_wait_time;
+extern ngx_atomic_t  *ngx_stat_event_yields;
+extern ngx_atomic_t  *ngx_stat_event_max_stall;
 
 #endif
 
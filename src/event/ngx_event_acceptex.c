@@ -122,12 +122,14 @@ ngx_event_post_acceptex(ngx_listening_t *ls, ngx_uint_t n)
             return NGX_ERROR;
         }
 
-        c->pool = ngx_create_pool(ls->pool_size, &ls->log);
+        c->pool = ngx_create_pool(ngx_listening_pool_size(ls), &ls->log);
         if (c->pool == NULL) {
             ngx_close_posted_connection(c);
             return NGX_ERROR;
         }
 
+        ngx_pool_set_tag(c->pool, NGX_POOL_CONNECTION);
+
         log = ngx_palloc(c->pool, sizeof(ngx_log_t));
         if (log == NULL) {
             ngx_close_posted_connection(c);
@@ -55,6 +55,17 @@ ngx_event_pipe(ngx_event_pipe_t *p, ngx_int_t do_write)
         }
 
         do_write = 1;
+
+        if (p->upstream
+            && p->upstream->read->ready
+            && !p->upstream->read->delayed
+            && ngx_event_budget_exhausted())
+        {
+            /* the data read are sent when the event is handled again */
+
+            ngx_event_yield(p->upstream->read);
+            break;
+        }
     }
 
     if (p->upstream
@@ -237,7 +248,7 @@ ngx_event_pipe_read_upstream(ngx_event_pipe_t *p)
 
                 /* allocate a new buf if it's still allowed */
 
-                b = ngx_create_temp_buf(p->pool, p->bufs.size);
+                b = ngx_create_large_buf(p->pool, p->bufs.size);
                 if (b == NULL) {
                     return NGX_ABORT;
                 }
@@ -13,6 +13,11 @@
 ngx_queue_t  ngx_posted_accept_events;
 ngx_queue_t  ngx_posted_next_events;
 ngx_queue_t  ngx_posted_events;
+ngx_queue_t  ngx_posted_deferred_events;
+
+ngx_msec_t   ngx_event_loop_budget;
+
+static ngx_msec_t  ngx_event_budget_started;
 
 
 void
@@ -36,6 +41,104 @@ ngx_event_process_posted(ngx_cycle_t *cycle, ngx_queue_t *posted)
 }
 
 
+/*
+ * With "event_loop_budget", the posted I/O and deferred events are handled
+ * until the time spent since the events were returned by the kernel exceeds
+ * the budget.  At least one event is handled in each queue, the rest are
+ * handled on the next iteration, after new accept events.
+ */
+
+void
+ngx_event_process_posted_budget(ngx_cycle_t *cycle, ngx_queue_t *posted)
+{
+    ngx_queue_t  *q;
+    ngx_event_t  *ev;
+
+    while (!ngx_queue_empty(posted)) {
+
+        q = ngx_queue_head(posted);
+        ev = ngx_queue_data(q, ngx_event_t, queue);
+
+        ngx_log_debug1(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
+                      "posted event %p", ev);
+
+        ngx_delete_posted_event(ev);
+
+        ev->handler(ev);
+
+        if (!ngx_queue_empty(posted) && ngx_event_budget_check()) {
+
+            ngx_log_debug0(NGX_LOG_DEBUG_EVENT, cycle->log, 0,
+                           "event loop budget exhausted");
+
+#if (NGX_STAT_STUB)
+            (void) ngx_atomic_fetch_add(ngx_stat_event_yields, 1);
+#endif
+            return;
+        }
+    }
+}
+
+
+void
+ngx_event_budget_start(void)
+{
+    ngx_event_budget_started = ngx_current_msec;
+}
+
+
+ngx_uint_t
+ngx_event_budget_check(void)
+{
+    ngx_time_update();
+
+    return ngx_current_msec - ngx_event_budget_started
+           >= ngx_event_loop_budget;
+}
+
+
+void
+ngx_event_budget_done(void)
+{
+#if (NGX_STAT_STUB)
+    ngx_msec_t         stall;
+    ngx_atomic_uint_t  max;
+
+    ngx_time_update();
+
+    stall = ngx_current_msec - ngx_event_budget_started;
+
+    for ( ;; ) {
+        max = *ngx_stat_event_max_stall;
+
+        if (stall <= max
+            || ngx_atomic_cmp_set(ngx_stat_event_max_stall, max, stall))
+        {
+            break;
+        }
+    }
+#endif
+}
+
+
+/*
+ * A long running handler may call ngx_event_yield() once the budget is
+ * exhausted, so the event is handled again on the next iteration.
+ */
+
+void
+ngx_event_yield(ngx_event_t *ev)
+{
+    ngx_log_debug1(NGX_LOG_DEBUG_EVENT, ev->log, 0, "yield event %p", ev);
+
+    ngx_post_event(ev, &ngx_posted_deferred_events);
+
+#if (NGX_STAT_STUB)
+    (void) ngx_atomic_fetch_add(ngx_stat_event_yields, 1);
+#endif
+}
+
+
 void
 ngx_event_move_posted_next(ngx_cycle_t *cycle)
 {
@@ -38,13 +38,26 @@
 
 
 
+#define ngx_event_budget_exhausted()                                          \
+    (ngx_event_loop_budget && ngx_event_budget_check())
+
+
 void ngx_event_process_posted(ngx_cycle_t *cycle, ngx_queue_t *posted);
+void ngx_event_process_posted_budget(ngx_cycle_t *cycle, ngx_queue_t *posted);
 void ngx_event_move_posted_next(ngx_cycle_t *cycle);
 
+void ngx_event_budget_start(void);
+ngx_uint_t ngx_event_budget_check(void);
+void ngx_event_budget_done(void);
+void ngx_event_yield(ngx_event_t *ev);
+
 
 extern ngx_queue_t  ngx_posted_accept_events;
 extern ngx_queue_t  ngx_posted_next_events;
 extern ngx_queue_t  ngx_posted_events;
+extern ngx_queue_t  ngx_posted_deferred_events;
+
+extern ngx_msec_t   ngx_event_loop_budget;
 
 
 #endif /* _NGX_EVENT_POSTED_H_INCLUDED_ */
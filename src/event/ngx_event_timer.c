@@ -10,9 +10,52 @@
 #include <ngx_event.h>
 
 
+/*
+ * The timer wheel has NGX_TIMER_WHEEL_LEVELS levels of NGX_TIMER_WHEEL_SIZE
+ * slots each, the level "l" slot granularity is 64^l milliseconds.
+ * A timer is placed into the lowest level able to hold it and is cascaded
+ * to the lower levels when its slot is reached.  Timers beyond the wheel
+ * range are placed into the last slot reachable and cascaded again.
+ *
+ * The wheel reuses the ev->timer rbtree node: node->left and node->right
+ * link the node into a circular list of a slot, and node->parent points
+ * to the list head of the slot.  Timers added with a time already passed
+ * by the wheel are kept in a separate list and expire on the next call.
+ */
+
+#define NGX_TIMER_WHEEL_BITS    6
+#define NGX_TIMER_WHEEL_SIZE    (1 << NGX_TIMER_WHEEL_BITS)
+#define NGX_TIMER_WHEEL_MASK    (NGX_TIMER_WHEEL_SIZE - 1)
+#define NGX_TIMER_WHEEL_LEVELS  5
+#define NGX_TIMER_WHEEL_RANGE                                                 \
+    ((ngx_msec_t) 1 << (NGX_TIMER_WHEEL_BITS * NGX_TIMER_WHEEL_LEVELS))
+
+
+static void ngx_event_timer_wheel_init(void);
+static ngx_msec_t ngx_event_timer_wheel_next(void);
+static void ngx_event_timer_wheel_cascade(ngx_uint_t level, ngx_msec_t tick);
+static ngx_msec_t ngx_event_timer_wheel_find(void);
+static void ngx_event_timer_wheel_expire(void);
+static void ngx_event_timer_wheel_expire_slot(ngx_rbtree_node_t *slot);
+static ngx_int_t ngx_event_timer_wheel_no_timers_left(void);
+static ngx_uint_t ngx_event_timer_wheel_ctz(uint64_t bits);
+
+
 ngx_rbtree_t              ngx_event_timer_rbtree;
 static ngx_rbtree_node_t  ngx_event_timer_sentinel;
 
+ngx_uint_t                ngx_event_timer_wheel;
+
+static ngx_rbtree_node_t  ngx_event_timer_slots[NGX_TIMER_WHEEL_LEVELS]
+                                               [NGX_TIMER_WHEEL_SIZE];
+static ngx_rbtree_node_t  ngx_event_timer_expired;
+static uint64_t           ngx_event_timer_bitmap[NGX_TIMER_WHEEL_LEVELS];
+static ngx_uint_t         ngx_event_timer_count;
+
+/* the first tick not processed yet */
+static ngx_msec_t         ngx_event_timer_tick;
+
+
 /*
  * the event timer rbtree may contain the duplicate keys, however,
  * it should not be a problem, because we use the rbtree to find
@@ -22,6 +65,11 @@ static ngx_rbtree_node_t  ngx_event_timer_sentinel;
 ngx_int_t
 ngx_event_timer_init(ngx_log_t *log)
 {
+    if (ngx_event_timer_wheel) {
+        ngx_event_timer_wheel_init();
+        return NGX_OK;
+    }
+
     ngx_rbtree_init(&ngx_event_timer_rbtree, &ngx_event_timer_sentinel,
                     ngx_rbtree_insert_timer_value);
 
@@ -35,6 +83,10 @@ ngx_event_find_timer(void)
     ngx_msec_int_t      timer;
     ngx_rbtree_node_t  *node, *root, *sentinel;
 
+    if (ngx_event_timer_wheel) {
+        return ngx_event_timer_wheel_find();
+    }
+
     if (ngx_event_timer_rbtree.root == &ngx_event_timer_sentinel) {
         return NGX_TIMER_INFINITE;
     }
@@ -56,6 +108,11 @@ ngx_event_expire_timers(void)
     ngx_event_t        *ev;
     ngx_rbtree_node_t  *node, *root, *sentinel;
 
+    if (ngx_event_timer_wheel) {
+        ngx_event_timer_wheel_expire();
+        return;
+    }
+
     sentinel = ngx_event_timer_rbtree.sentinel;
 
     for ( ;; ) {
@@ -102,6 +159,10 @@ ngx_event_no_timers_left(void)
     ngx_event_t        *ev;
     ngx_rbtree_node_t  *node, *root, *sentinel;
 
+    if (ngx_event_timer_wheel) {
+        return ngx_event_timer_wheel_no_timers_left();
+    }
+
     sentinel = ngx_event_timer_rbtree.sentinel;
     root = ngx_event_timer_rbtree.root;
 
@@ -124,3 +185,337 @@ ngx_event_no_timers_left(void)
 
     return NGX_OK;
 }
+
+
+static void
+ngx_event_timer_wheel_init(void)
+{
+    ngx_uint_t          l, i;
+    ngx_rbtree_node_t  *slot;
+
+    for (l = 0; l < NGX_TIMER_WHEEL_LEVELS; l++) {
+        for (i = 0; i < NGX_TIMER_WHEEL_SIZE; i++) {
+            slot = &ngx_event_timer_slots[l][i];
+            slot->left = slot;
+            slot->right = slot;
+        }
+
+        ngx_event_timer_bitmap[l] = 0;
+    }
+
+    ngx_event_timer_expired.left = &ngx_event_timer_expired;
+    ngx_event_timer_expired.right = &ngx_event_timer_expired;
+
+    ngx_event_timer_count = 0;
+    ngx_event_timer_tick = ngx_current_msec;
+}
+
+
+void
+ngx_event_timer_wheel_insert(ngx_rbtree_node_t *node)
+{
+    ngx_uint_t          l, i;
+    ngx_msec_t          expire;
+    ngx_msec_int_t      delta;
+    ngx_rbtree_node_t  *slot;
+
+    ngx_event_timer_count++;
+
+    delta = (ngx_msec_int_t) (node->key - ngx_event_timer_tick);
+
+    if (delta < 0) {
+        slot = &ngx_event_timer_expired;
+        goto insert;
+    }
+
+    if ((ngx_msec_t) delta >= NGX_TIMER_WHEEL_RANGE) {
+        delta = NGX_TIMER_WHEEL_RANGE - 1;
+    }
+
+    for (l = 0; l < NGX_TIMER_WHEEL_LEVELS - 1; l++) {
+        if ((ngx_msec_t) delta
+            < ((ngx_msec_t) 1 << (NGX_TIMER_WHEEL_BITS * (l + 1))))
+        {
+            break;
+        }
+    }
+
+    expire = ngx_event_timer_tick + delta;
+    i = (expire >> (NGX_TIMER_WHEEL_BITS * l)) & NGX_TIMER_WHEEL_MASK;
+
+    slot = &ngx_event_timer_slots[l][i];
+
+    ngx_event_timer_bitmap[l] |= (uint64_t) 1 << i;
+
+insert:
+
+    node->parent = slot;
+    node->left = slot->left;
+    node->right = slot;
+    slot->left->right = node;
+    slot->left = node;
+}
+
+
+void
+ngx_event_timer_wheel_delete(ngx_rbtree_node_t *node)
+{
+    ngx_uint_t          n;
+    ngx_rbtree_node_t  *slot;
+
+    slot = node->parent;
+
+    node->left->right = node->right;
+    node->right->left = node->left;
+
+    if (slot->right == slot && slot != &ngx_event_timer_expired) {
+        n = slot - &ngx_event_timer_slots[0][0];
+
+        ngx_event_timer_bitmap[n / NGX_TIMER_WHEEL_SIZE] &=
+                              ~((uint64_t) 1 << (n % NGX_TIMER_WHEEL_SIZE));
+    }
+
+    ngx_event_timer_count--;
+}
+
+
+/*
+ * returns the first tick at which a non-empty slot is reached: the exact
+ * expiration time for the level 0, and the cascade time for the others
+ */
+
+static ngx_msec_t
+ngx_event_timer_wheel_next(void)
+{
+    ngx_uint_t  l, s, shift;
+    uint64_t    bits;
+    ngx_msec_t  block, tick, next;
+
+    next = ngx_event_timer_tick + NGX_TIMER_WHEEL_RANGE;
+
+    for (l = 0; l < NGX_TIMER_WHEEL_LEVELS; l++) {
+
+        if (ngx_event_timer_bitmap[l] == 0) {
+            continue;
+        }
+
+        shift = NGX_TIMER_WHEEL_BITS * l;
+        block = ngx_event_timer_tick >> shift;
+
+        /*
+         * the current slot of an upper level is already cascaded,
+         * unless the current tick is its first one
+         */
+
+        if (ngx_event_timer_tick & (((ngx_msec_t) 1 << shift) - 1)) {
+            block++;
+        }
+
+        s = block & NGX_TIMER_WHEEL_MASK;
+        bits = ngx_event_timer_bitmap[l];
+
+        if (s) {
+            bits = (bits >> s) | (bits << (NGX_TIMER_WHEEL_SIZE - s));
+        }
+
+        tick = (block + ngx_event_timer_wheel_ctz(bits)) << shift;
+
+        if ((ngx_msec_int_t) (tick - next) < 0) {
+            next = tick;
+        }
+    }
+
+    return next;
+}
+
+
+static void
+ngx_event_timer_wheel_cascade(ngx_uint_t level, ngx_msec_t tick)
+{
+    ngx_uint_t          i;
+    ngx_rbtree_node_t   list, *slot, *node;
+
+    i = (tick >> (NGX_TIMER_WHEEL_BITS * level)) & NGX_TIMER_WHEEL_MASK;
+    slot = &ngx_event_timer_slots[level][i];
+
+    if (slot->right == slot) {
+        return;
+    }
+
+    list.left = slot->left;
+    list.right = slot->right;
+    list.left->right = &list;
+    list.right->left = &list;
+
+    slot->left = slot;
+    slot->right = slot;
+
+    ngx_event_timer_bitmap[level] &= ~((uint64_t) 1 << i);
+
+    while (list.right != &list) {
+        node = list.right;
+
+        list.right = node->right;
+        node->right->left = &list;
+
+        ngx_event_timer_count--;
+
+        ngx_event_timer_wheel_insert(node);
+    }
+}
+
+
+static ngx_msec_t
+ngx_event_timer_wheel_find(void)
+{
+    ngx_msec_int_t  timer;
+
+    if (ngx_event_timer_count == 0) {
+        return NGX_TIMER_INFINITE;
+    }
+
+    if (ngx_event_timer_expired.right != &ngx_event_timer_expired) {
+        return 0;
+    }
+
+    timer = (ngx_msec_int_t) (ngx_event_timer_wheel_next() - ngx_current_msec);
+
+    return (ngx_msec_t) (timer > 0 ? timer : 0);
+}
+
+
+static void
+ngx_event_timer_wheel_expire(void)
+{
+    ngx_uint_t          l;
+    ngx_msec_t          tick, next;
+    ngx_rbtree_node_t  *slot;
+
+    for ( ;; ) {
+        ngx_event_timer_wheel_expire_slot(&ngx_event_timer_expired);
+
+        if ((ngx_msec_int_t) (ngx_event_timer_tick - ngx_current_msec) > 0) {
+            return;
+        }
+
+        if (ngx_event_timer_count == 0) {
+            ngx_event_timer_tick = ngx_current_msec + 1;
+            return;
+        }
+
+        tick = ngx_event_timer_tick;
+
+        for (l = NGX_TIMER_WHEEL_LEVELS - 1; l > 0; l--) {
+            if ((tick & (((ngx_msec_t) 1 << (NGX_TIMER_WHEEL_BITS * l)) - 1))
+                == 0)
+            {
+                ngx_event_timer_wheel_cascade(l, tick);
+            }
+        }
+
+        /* timers added by handlers for the current tick expire here too */
+
+        slot = &ngx_event_timer_slots[0][tick & NGX_TIMER_WHEEL_MASK];
+
+        ngx_event_timer_wheel_expire_slot(slot);
+
+        ngx_event_timer_tick = tick + 1;
+
+        if (ngx_event_timer_count == 0) {
+            continue;
+        }
+
+        next = ngx_event_timer_wheel_next();
+
+        if ((ngx_msec_int_t) (next - ngx_current_msec) > 0) {
+            next = ngx_current_msec + 1;
+        }
+
+        ngx_event_timer_tick = next;
+    }
+}
+
+
+static void
+ngx_event_timer_wheel_expire_slot(ngx_rbtree_node_t *slot)
+{
+    ngx_event_t        *ev;
+    ngx_rbtree_node_t  *node;
+
+    while (slot->right != slot) {
+        node = slot->right;
+
+        ev = ngx_rbtree_data(node, ngx_event_t, timer);
+
+        ngx_log_debug2(NGX_LOG_DEBUG_EVENT, ev->log, 0,
+                       "event timer del: %d: %M",
+                       ngx_event_ident(ev->data), ev->timer.key);
+
+        ngx_event_timer_wheel_delete(node);
+
+#if (NGX_DEBUG)
+        ev->timer.left = NULL;
+        ev->timer.right = NULL;
+        ev->timer.parent = NULL;
+#endif
+
+        ev->timer_set = 0;
+
+        ev->timedout = 1;
+
+        ev->handler(ev);
+    }
+}
+
+
+static ngx_int_t
+ngx_event_timer_wheel_no_timers_left(void)
+{
+    ngx_uint_t          l, i;
+    ngx_event_t        *ev;
+    ngx_rbtree_node_t  *slot, *node;
+
+    slot = &ngx_event_timer_expired;
+
+    for (node = slot->right; node != slot; node = node->right) {
+        ev = ngx_rbtree_data(node, ngx_event_t, timer);
+
+        if (!ev->cancelable) {
+            return NGX_AGAIN;
+        }
+    }
+
+    for (l = 0; l < NGX_TIMER_WHEEL_LEVELS; l++) {
+        for (i = 0; i < NGX_TIMER_WHEEL_SIZE; i++) {
+            slot = &ngx_event_timer_slots[l][i];
+
+            for (node = slot->right; node != slot; node = node->right) {
+                ev = ngx_rbtree_data(node, ngx_event_t, timer);
+
+                if (!ev->cancelable) {
+                    return NGX_AGAIN;
+                }
+            }
+        }
+    }
+
+    /* only cancelable timers left */
+
+    return NGX_OK;
+}
+
+
+static ngx_uint_t
+ngx_event_timer_wheel_ctz(uint64_t bits)
+{
+    static const u_char  index[64] = {
+         0,  1,  2, 53,  3,  7, 54, 27,  4, 38, 41,  8, 34, 55, 48, 28,
+        62,  5, 39, 46, 44, 42, 22,  9, 24, 35, 59, 56, 49, 18, 29, 11,
+        63, 52,  6, 26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+        51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12
+    };
+
+    /* bits must not be zero */
+
+    return index[((bits & -bits) * 0x022fdd63cc95386dULL) >> 58];
+}
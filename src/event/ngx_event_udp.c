@@ -12,6 +12,45 @@
 
 #if !(NGX_WIN32)
 
+#if (NGX_HAVE_RECVMMSG)
+
+#define NGX_UDP_RECV_BATCH  16
+#define NGX_UDP_RECV_NAME   "recvmmsg"
+
+typedef struct mmsghdr  ngx_udp_mmsghdr_t;
+
+#else
+
+#define NGX_UDP_RECV_BATCH  1
+#define NGX_UDP_RECV_NAME   "recvmsg"
+
+typedef struct {
+    struct msghdr       msg_hdr;
+    unsigned int        msg_len;
+} ngx_udp_mmsghdr_t;
+
+#endif
+
+
+#if (NGX_HAVE_ADDRINFO_CMSG)
+#define NGX_UDP_ADDRINFO_CMSG_SIZE  CMSG_SPACE(sizeof(ngx_addrinfo_t))
+#else
+#define NGX_UDP_ADDRINFO_CMSG_SIZE  0
+#endif
+
+#if (NGX_HAVE_UDP_GRO)
+#define NGX_UDP_GRO_CMSG_SIZE       CMSG_SPACE(sizeof(int))
+#else
+#define NGX_UDP_GRO_CMSG_SIZE       0
+#endif
+
+#define NGX_UDP_CMSG_SIZE                                                     \
+    (NGX_UDP_ADDRINFO_CMSG_SIZE + NGX_UDP_GRO_CMSG_SIZE)
+
+#define NGX_UDP_RECV_SIZE   65535
+
+
+static ngx_int_t ngx_event_udp_handler(ngx_event_t *ev, ngx_udp_dgram_t *dg);
 static void ngx_close_accepted_udp_connection(ngx_connection_t *c);
 static ssize_t ngx_udp_shared_recv(ngx_connection_t *c, u_char *buf,
     size_t size);
@@ -21,26 +60,37 @@ static ngx_connection_t *ngx_lookup_udp_connection(ngx_listening_t *ls,
     struct sockaddr *local_sockaddr, socklen_t local_socklen);
 
 
+static u_char  *ngx_udp_recv_buffer;
+
+
+ngx_int_t
+ngx_event_udp_init(ngx_cycle_t *cycle)
+{
+    /*
+     * the buffer for a batch of datagrams is shared by all UDP listening
+     * sockets of a process and is allocated only if there are any
+     */
+
+    if (ngx_udp_recv_buffer) {
+        return NGX_OK;
+    }
+
+    ngx_udp_recv_buffer = ngx_alloc(NGX_UDP_RECV_BATCH * NGX_UDP_RECV_SIZE,
+                                    cycle->log);
+    if (ngx_udp_recv_buffer == NULL) {
+        return NGX_ERROR;
+    }
+
+    return NGX_OK;
+}
+
+
 void
 ngx_event_recvmsg(ngx_event_t *ev)
 {
-    ssize_t            n;
-    ngx_buf_t          buf;
-    ngx_log_t         *log;
-    ngx_err_t          err;
-    socklen_t          socklen, local_socklen;
-    ngx_event_t       *rev, *wev;
-    struct iovec       iov[1];
-    struct msghdr      msg;
-    ngx_sockaddr_t     sa, lsa;
-    struct sockaddr   *sockaddr, *local_sockaddr;
-    ngx_listening_t   *ls;
     ngx_event_conf_t  *ecf;
-    ngx_connection_t  *c, *lc;
-    static u_char      buffer[65535];
-
-#if (NGX_HAVE_ADDRINFO_CMSG)
-    u_char             msg_control[CMSG_SPACE(sizeof(ngx_addrinfo_t))];
+#if (NGX_DEBUG)
+    ngx_listening_t   *ls;
 #endif
 
     if (ev->timedout) {
@@ -57,294 +107,432 @@ ngx_event_recvmsg(ngx_event_t *ev)
         ev->available = ecf->multi_accept;
     }
 
-    lc = ev->data;
-    ls = lc->listening;
     ev->ready = 0;
 
+#if (NGX_DEBUG)
+    ls = ((ngx_connection_t *) ev->data)->listening;
+
     ngx_log_debug2(NGX_LOG_DEBUG_EVENT, ev->log, 0,
                    "recvmsg on %V, ready: %d", &ls->addr_text, ev->available);
+#endif
 
-    do {
-        ngx_memzero(&msg, sizeof(struct msghdr));
+    ngx_event_udp_recv(ev, ngx_event_udp_handler);
+}
 
-        iov[0].iov_base = (void *) buffer;
-        iov[0].iov_len = sizeof(buffer);
 
-        msg.msg_name = &sa;
-        msg.msg_namelen = sizeof(ngx_sockaddr_t);
-        msg.msg_iov = iov;
-        msg.msg_iovlen = 1;
+void
+ngx_event_udp_recv(ngx_event_t *ev, ngx_udp_handler_pt handler)
+{
+    u_char              *last;
+    size_t               size;
+    ssize_t              n;
+    ngx_int_t            i, nmsg;
+    ngx_err_t            err;
+    ngx_udp_dgram_t      dg;
+    struct msghdr       *msg;
+    ngx_listening_t     *ls;
+    ngx_connection_t    *lc;
+    ngx_udp_mmsghdr_t    msgs[NGX_UDP_RECV_BATCH];
+    struct iovec         iov[NGX_UDP_RECV_BATCH];
+    ngx_sockaddr_t       sa[NGX_UDP_RECV_BATCH];
+
+#if (NGX_STAT_STUB)
+    ngx_atomic_int_t     ndgrams;
+#endif
 
 #if (NGX_HAVE_ADDRINFO_CMSG)
-        if (ls->wildcard) {
-            msg.msg_control = &msg_control;
-            msg.msg_controllen = sizeof(msg_control);
+    ngx_sockaddr_t       lsa;
+#endif
 
-            ngx_memzero(&msg_control, sizeof(msg_control));
-        }
+#if (NGX_HAVE_ADDRINFO_CMSG || NGX_HAVE_UDP_GRO)
+    struct cmsghdr      *cmsg;
+    u_char               msg_control[NGX_UDP_RECV_BATCH][NGX_UDP_CMSG_SIZE];
 #endif
 
-        n = recvmsg(lc->fd, &msg, 0);
+    lc = ev->data;
+    ls = lc->listening;
+
+    do {
+        ngx_memzero(msgs, sizeof(msgs));
+
+        for (i = 0; i < NGX_UDP_RECV_BATCH; i++) {
+            iov[i].iov_base = (void *) (ngx_udp_recv_buffer
+                                        + i * NGX_UDP_RECV_SIZE);
+            iov[i].iov_len = NGX_UDP_RECV_SIZE;
+
+            msg = &msgs[i].msg_hdr;
+
+            msg->msg_name = &sa[i];
+            msg->msg_namelen = sizeof(ngx_sockaddr_t);
+            msg->msg_iov = &iov[i];
+            msg->msg_iovlen = 1;
+
+#if (NGX_HAVE_ADDRINFO_CMSG || NGX_HAVE_UDP_GRO)
+            msg->msg_control = msg_control[i];
+            msg->msg_controllen = sizeof(msg_control[i]);
+#endif
+        }
+
+#if (NGX_HAVE_RECVMMSG)
+
+        nmsg = recvmmsg(lc->fd, msgs, NGX_UDP_RECV_BATCH, 0, NULL);
+
+#else
+
+        n = recvmsg(lc->fd, &msgs[0].msg_hdr, 0);
+
+        if (n != -1) {
+            msgs[0].msg_len = n;
+        }
+
+        nmsg = (n == -1) ? -1 : 1;
+
+#endif
 
-        if (n == -1) {
+        if (nmsg == -1) {
             err = ngx_socket_errno;
 
             if (err == NGX_EAGAIN) {
                 ngx_log_debug0(NGX_LOG_DEBUG_EVENT, ev->log, err,
-                               "recvmsg() not ready");
+                               NGX_UDP_RECV_NAME "() not ready");
                 return;
             }
 
-            ngx_log_error(NGX_LOG_ALERT, ev->log, err, "recvmsg() failed");
+            ngx_log_error(NGX_LOG_ALERT, ev->log, err,
+                          NGX_UDP_RECV_NAME "() failed");
 
             return;
         }
 
-#if (NGX_HAVE_ADDRINFO_CMSG)
-        if (msg.msg_flags & (MSG_TRUNC|MSG_CTRUNC)) {
-            ngx_log_error(NGX_LOG_ALERT, ev->log, 0,
-                          "recvmsg() truncated data");
-            continue;
-        }
+        ngx_log_debug1(NGX_LOG_DEBUG_EVENT, ev->log, 0,
+                       NGX_UDP_RECV_NAME ": %i messages", nmsg);
+
+#if (NGX_STAT_STUB)
+        ndgrams = 0;
 #endif
 
-        sockaddr = msg.msg_name;
-        socklen = msg.msg_namelen;
+        for (i = 0; i < nmsg; i++) {
+            msg = &msgs[i].msg_hdr;
+            n = msgs[i].msg_len;
 
-        if (socklen > (socklen_t) sizeof(ngx_sockaddr_t)) {
-            socklen = sizeof(ngx_sockaddr_t);
-        }
+            if (ngx_event_flags & NGX_USE_KQUEUE_EVENT) {
+                ev->available -= n;
+            }
+
+#if (NGX_HAVE_ADDRINFO_CMSG || NGX_HAVE_UDP_GRO)
+            if (msg->msg_flags & (MSG_TRUNC|MSG_CTRUNC)) {
+                ngx_log_error(NGX_LOG_ALERT, ev->log, 0,
+                              NGX_UDP_RECV_NAME "() truncated data");
+                continue;
+            }
+#endif
 
-        if (socklen == 0) {
+            dg.sockaddr = msg->msg_name;
+            dg.socklen = msg->msg_namelen;
 
-            /*
-             * on Linux recvmsg() returns zero msg_namelen
-             * when receiving packets from unbound AF_UNIX sockets
-             */
+            if (dg.socklen > (socklen_t) sizeof(ngx_sockaddr_t)) {
+                dg.socklen = sizeof(ngx_sockaddr_t);
+            }
 
-            socklen = sizeof(struct sockaddr);
-            ngx_memzero(&sa, sizeof(struct sockaddr));
-            sa.sockaddr.sa_family = ls->sockaddr->sa_family;
-        }
+            if (dg.socklen == 0) {
 
-        local_sockaddr = ls->sockaddr;
-        local_socklen = ls->socklen;
+                /*
+                 * on Linux recvmsg() returns zero msg_namelen
+                 * when receiving packets from unbound AF_UNIX sockets
+                 */
+
+                dg.socklen = sizeof(struct sockaddr);
+                ngx_memzero(&sa[i], sizeof(struct sockaddr));
+                sa[i].sockaddr.sa_family = ls->sockaddr->sa_family;
+            }
+
+            dg.local_sockaddr = ls->sockaddr;
+            dg.local_socklen = ls->socklen;
+
+            /* the size of datagrams coalesced by UDP GRO */
+            size = n;
 
 #if (NGX_HAVE_ADDRINFO_CMSG)
 
-        if (ls->wildcard) {
-            struct cmsghdr  *cmsg;
+            if (ls->wildcard) {
+                ngx_memcpy(&lsa, dg.local_sockaddr, dg.local_socklen);
+                dg.local_sockaddr = &lsa.sockaddr;
+            }
+
+#endif
 
-            ngx_memcpy(&lsa, local_sockaddr, local_socklen);
-            local_sockaddr = &lsa.sockaddr;
+#if (NGX_HAVE_ADDRINFO_CMSG || NGX_HAVE_UDP_GRO)
 
-            for (cmsg = CMSG_FIRSTHDR(&msg);
+            for (cmsg = CMSG_FIRSTHDR(msg);
                  cmsg != NULL;
-                 cmsg = CMSG_NXTHDR(&msg, cmsg))
+                 cmsg = CMSG_NXTHDR(msg, cmsg))
             {
-                if (ngx_get_srcaddr_cmsg(cmsg, local_sockaddr) == NGX_OK) {
-                    break;
+
+#if (NGX_HAVE_UDP_GRO)
+                if (cmsg->cmsg_level == SOL_UDP
+                    && cmsg->cmsg_type == UDP_GRO)
+                {
+                    int  gso_size;
+
+                    ngx_memcpy(&gso_size, CMSG_DATA(cmsg), sizeof(int));
+
+                    if (gso_size > 0) {
+                        size = gso_size;
+                    }
+
+                    continue;
+                }
+#endif
+
+#if (NGX_HAVE_ADDRINFO_CMSG)
+                if (ls->wildcard) {
+                    (void) ngx_get_srcaddr_cmsg(cmsg, dg.local_sockaddr);
                 }
+#endif
             }
+
+#endif
+
+            dg.start = iov[i].iov_base;
+            last = dg.start + n;
+
+            do {
+                dg.n = ngx_min((size_t) (last - dg.start), size);
+
+#if (NGX_STAT_STUB)
+                ndgrams++;
+#endif
+
+                if (handler(ev, &dg) != NGX_OK) {
+                    return;
+                }
+
+                dg.start += dg.n;
+
+            } while (dg.start < last);
         }
 
+#if (NGX_STAT_STUB)
+        (void) ngx_atomic_fetch_add(ngx_stat_udp_batches, 1);
+        (void) ngx_atomic_fetch_add(ngx_stat_udp_datagrams, ndgrams);
 #endif
 
-        c = ngx_lookup_udp_connection(ls, sockaddr, socklen, local_sockaddr,
-                                      local_socklen);
+    } while (ev->available);
+}
+
 
-        if (c) {
+static ngx_int_t
+ngx_event_udp_handler(ngx_event_t *ev, ngx_udp_dgram_t *dg)
+{
+    ngx_buf_t          buf;
+    ngx_log_t         *log;
+    ngx_event_t       *rev, *wev;
+    struct sockaddr   *local_sockaddr;
+    ngx_listening_t   *ls;
+    ngx_connection_t  *c, *lc;
 
 #if (NGX_DEBUG)
-            if (c->log->log_level & NGX_LOG_DEBUG_EVENT) {
-                ngx_log_handler_pt  handler;
+    ngx_event_conf_t  *ecf;
+#endif
 
-                handler = c->log->handler;
-                c->log->handler = NULL;
+    lc = ev->data;
+    ls = lc->listening;
 
-                ngx_log_debug2(NGX_LOG_DEBUG_EVENT, c->log, 0,
-                               "recvmsg: fd:%d n:%z", c->fd, n);
+    c = ngx_lookup_udp_connection(ls, dg->sockaddr, dg->socklen,
+                                  dg->local_sockaddr, dg->local_socklen);
 
-                c->log->handler = handler;
-            }
-#endif
+    if (c) {
 
-            ngx_memzero(&buf, sizeof(ngx_buf_t));
+#if (NGX_DEBUG)
+        if (c->log->log_level & NGX_LOG_DEBUG_EVENT) {
+            ngx_log_handler_pt  handler;
 
-            buf.pos = buffer;
-            buf.last = buffer + n;
+            handler = c->log->handler;
+            c->log->handler = NULL;
 
-            rev = c->read;
+            ngx_log_debug2(NGX_LOG_DEBUG_EVENT, c->log, 0,
+                           "recvmsg: fd:%d n:%z", c->fd, dg->n);
 
-            c->udp->buffer = &buf;
+            c->log->handler = handler;
+        }
+#endif
 
-            rev->ready = 1;
-            rev->active = 0;
+        ngx_memzero(&buf, sizeof(ngx_buf_t));
 
-            rev->handler(rev);
+        buf.pos = dg->start;
+        buf.last = dg->start + dg->n;
 
-            if (c->udp) {
-                c->udp->buffer = NULL;
-            }
+        rev = c->read;
+
+        c->udp->buffer = &buf;
+
+        rev->ready = 1;
+        rev->active = 0;
 
-            rev->ready = 0;
-            rev->active = 1;
+        rev->handler(rev);
 
-            goto next;
+        if (c->udp) {
+            c->udp->buffer = NULL;
         }
 
+        rev->ready = 0;
+        rev->active = 1;
+
+        return NGX_OK;
+    }
+
 #if (NGX_STAT_STUB)
-        (void) ngx_atomic_fetch_add(ngx_stat_accepted, 1);
+    (void) ngx_atomic_fetch_add(ngx_stat_accepted, 1);
 #endif
 
-        ngx_accept_disabled = ngx_cycle->connection_n / 8
-                              - ngx_cycle->free_connection_n;
+    ngx_accept_disabled = ngx_cycle->connection_n / 8
+                          - ngx_cycle->free_connection_n;
 
-        c = ngx_get_connection(lc->fd, ev->log);
-        if (c == NULL) {
-            return;
-        }
+    c = ngx_get_connection(lc->fd, ev->log);
+    if (c == NULL) {
+        return NGX_ERROR;
+    }
 
-        c->shared = 1;
-        c->type = SOCK_DGRAM;
-        c->socklen = socklen;
+    c->shared = 1;
+    c->type = SOCK_DGRAM;
+    c->socklen = dg->socklen;
 
 #if (NGX_STAT_STUB)
-        (void) ngx_atomic_fetch_add(ngx_stat_active, 1);
+    (void) ngx_atomic_fetch_add(ngx_stat_active, 1);
 #endif
 
-        c->pool = ngx_create_pool(ls->pool_size, ev->log);
-        if (c->pool == NULL) {
-            ngx_close_accepted_udp_connection(c);
-            return;
-        }
+    c->pool = ngx_create_pool(ls->pool_size, ev->log);
+    if (c->pool == NULL) {
+        ngx_close_accepted_udp_connection(c);
+        return NGX_ERROR;
+    }
 
-        c->sockaddr = ngx_palloc(c->pool, socklen);
-        if (c->sockaddr == NULL) {
-            ngx_close_accepted_udp_connection(c);
-            return;
-        }
+    ngx_pool_set_tag(c->pool, NGX_POOL_CONNECTION);
 
-        ngx_memcpy(c->sockaddr, sockaddr, socklen);
+    c->sockaddr = ngx_palloc(c->pool, dg->socklen);
+    if (c->sockaddr == NULL) {
+        ngx_close_accepted_udp_connection(c);
+        return NGX_ERROR;
+    }
 
-        log = ngx_palloc(c->pool, sizeof(ngx_log_t));
-        if (log == NULL) {
-            ngx_close_accepted_udp_connection(c);
-            return;
-        }
+    ngx_memcpy(c->sockaddr, dg->sockaddr, dg->socklen);
 
-        *log = ls->log;
+    log = ngx_palloc(c->pool, sizeof(ngx_log_t));
+    if (log == NULL) {
+        ngx_close_accepted_udp_connection(c);
+        return NGX_ERROR;
+    }
 
-        c->recv = ngx_udp_shared_recv;
-        c->send = ngx_udp_send;
-        c->send_chain = ngx_udp_send_chain;
+    *log = ls->log;
 
-        c->need_flush_buf = 1;
+    c->recv = ngx_udp_shared_recv;
+    c->send = ngx_udp_send;
+    c->send_chain = ngx_udp_send_chain;
 
-        c->log = log;
-        c->pool->log = log;
-        c->listening = ls;
+    c->need_flush_buf = 1;
 
-        if (local_sockaddr == &lsa.sockaddr) {
-            local_sockaddr = ngx_palloc(c->pool, local_socklen);
-            if (local_sockaddr == NULL) {
-                ngx_close_accepted_udp_connection(c);
-                return;
-            }
-
-            ngx_memcpy(local_sockaddr, &lsa, local_socklen);
-        }
+    c->log = log;
+    c->pool->log = log;
+    c->listening = ls;
 
-        c->local_sockaddr = local_sockaddr;
-        c->local_socklen = local_socklen;
+    local_sockaddr = dg->local_sockaddr;
 
-        c->buffer = ngx_create_temp_buf(c->pool, n);
-        if (c->buffer == NULL) {
+    if (local_sockaddr != ls->sockaddr) {
+        local_sockaddr = ngx_palloc(c->pool, dg->local_socklen);
+        if (local_sockaddr == NULL) {
             ngx_close_accepted_udp_connection(c);
-            return;
+            return NGX_ERROR;
         }
 
-        c->buffer->last = ngx_cpymem(c->buffer->last, buffer, n);
+        ngx_memcpy(local_sockaddr, dg->local_sockaddr, dg->local_socklen);
+    }
 
-        rev = c->read;
-        wev = c->write;
+    c->local_sockaddr = local_sockaddr;
+    c->local_socklen = dg->local_socklen;
 
-        rev->active = 1;
-        wev->ready = 1;
+    c->buffer = ngx_create_temp_buf(c->pool, dg->n);
+    if (c->buffer == NULL) {
+        ngx_close_accepted_udp_connection(c);
+        return NGX_ERROR;
+    }
+
+    c->buffer->last = ngx_cpymem(c->buffer->last, dg->start, dg->n);
+
+    rev = c->read;
+    wev = c->write;
+
+    rev->active = 1;
+    wev->ready = 1;
 
-        rev->log = log;
-        wev->log = log;
+    rev->log = log;
+    wev->log = log;
 
-        /*
-         * TODO: MT: - ngx_atomic_fetch_add()
-         *             or protection by critical section or light mutex
-         *
-         * TODO: MP: - allocated in a shared memory
-         *           - ngx_atomic_fetch_add()
-         *             or protection by critical section or light mutex
-         */
+    /*
+     * TODO: MT: - ngx_atomic_fetch_add()
+     *             or protection by critical section or light mutex
+     *
+     * TODO: MP: - allocated in a shared memory
+     *           - ngx_atomic_fetch_add()
+     *             or protection by critical section or light mutex
+     */
 
-        c->number = ngx_atomic_fetch_add(ngx_connection_counter, 1);
+    c->number = ngx_atomic_fetch_add(ngx_connection_counter, 1);
 
-        c->start_time = ngx_current_msec;
+    c->start_time = ngx_current_msec;
 
 #if (NGX_STAT_STUB)
-        (void) ngx_atomic_fetch_add(ngx_stat_handled, 1);
+    (void) ngx_atomic_fetch_add(ngx_stat_handled, 1);
 #endif
 
-        if (ls->addr_ntop) {
-            c->addr_text.data = ngx_pnalloc(c->pool, ls->addr_text_max_len);
-            if (c->addr_text.data == NULL) {
-                ngx_close_accepted_udp_connection(c);
-                return;
-            }
+    if (ls->addr_ntop) {
+        c->addr_text.data = ngx_pnalloc(c->pool, ls->addr_text_max_len);
+        if (c->addr_text.data == NULL) {
+            ngx_close_accepted_udp_connection(c);
+            return NGX_ERROR;
+        }
 
-            c->addr_text.len = ngx_sock_ntop(c->sockaddr, c->socklen,
-                                             c->addr_text.data,
-                                             ls->addr_text_max_len, 0);
-            if (c->addr_text.len == 0) {
-                ngx_close_accepted_udp_connection(c);
-                return;
-            }
+        c->addr_text.len = ngx_sock_ntop(c->sockaddr, c->socklen,
+                                         c->addr_text.data,
+                                         ls->addr_text_max_len, 0);
+        if (c->addr_text.len == 0) {
+            ngx_close_accepted_udp_connection(c);
+            return NGX_ERROR;
         }
+    }
 
 #if (NGX_DEBUG)
-        {
-        ngx_str_t  addr;
-        u_char     text[NGX_SOCKADDR_STRLEN];
+    {
+    ngx_str_t  addr;
+    u_char     text[NGX_SOCKADDR_STRLEN];
 
-        ngx_debug_accepted_connection(ecf, c);
+    ecf = ngx_event_get_conf(ngx_cycle->conf_ctx, ngx_event_core_module);
 
-        if (log->log_level & NGX_LOG_DEBUG_EVENT) {
-            addr.data = text;
-            addr.len = ngx_sock_ntop(c->sockaddr, c->socklen, text,
-                                     NGX_SOCKADDR_STRLEN, 1);
+    ngx_debug_accepted_connection(ecf, c);
 
-            ngx_log_debug4(NGX_LOG_DEBUG_EVENT, log, 0,
-                           "*%uA recvmsg: %V fd:%d n:%z",
-                           c->number, &addr, c->fd, n);
-        }
+    if (log->log_level & NGX_LOG_DEBUG_EVENT) {
+        addr.data = text;
+        addr.len = ngx_sock_ntop(c->sockaddr, c->socklen, text,
+                                 NGX_SOCKADDR_STRLEN, 1);
 
-        }
-#endif
-
-        if (ngx_insert_udp_connection(c) != NGX_OK) {
-            ngx_close_accepted_udp_connection(c);
-            return;
-        }
+        ngx_log_debug4(NGX_LOG_DEBUG_EVENT, log, 0,
+                       "*%uA recvmsg: %V fd:%d n:%z",
+                       c->number, &addr, c->fd, dg->n);
+    }
 
-        log->data = NULL;
-        log->handler = NULL;
+    }
+#endif
 
-        ls->handler(c);
+    if (ngx_insert_udp_connection(c) != NGX_OK) {
+        ngx_close_accepted_udp_connection(c);
+        return NGX_ERROR;
+    }
 
-    next:
+    log->data = NULL;
+    log->handler = NULL;
 
-        if (ngx_event_flags & NGX_USE_KQUEUE_EVENT) {
-            ev->available -= n;
-        }
+    ls->handler(c);
 
-    } while (ev->available);
+    return NGX_OK;
 }
 
 
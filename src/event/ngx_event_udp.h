@@ -54,7 +54,22 @@ ngx_int_t ngx_get_srcaddr_cmsg(struct cmsghdr *cmsg,
 
 #endif
 
+typedef struct {
+    u_char             *start;
+    ssize_t             n;
+    struct sockaddr    *sockaddr;
+    socklen_t           socklen;
+    struct sockaddr    *local_sockaddr;
+    socklen_t           local_socklen;
+} ngx_udp_dgram_t;
+
+
+typedef ngx_int_t (*ngx_udp_handler_pt)(ngx_event_t *ev, ngx_udp_dgram_t *dg);
+
+
+ngx_int_t ngx_event_udp_init(ngx_cycle_t *cycle);
 void ngx_event_recvmsg(ngx_event_t *ev);
+void ngx_event_udp_recv(ngx_event_t *ev, ngx_udp_handler_pt handler);
 ssize_t ngx_sendmsg(ngx_connection_t *c, struct msghdr *msg, int flags);
 void ngx_udp_rbtree_insert_value(ngx_rbtree_node_t *temp,
     ngx_rbtree_node_t *node, ngx_rbtree_node_t *sentinel);
@@ -688,6 +688,8 @@ ngx_quic_create_stream(ngx_connection_t *c, uint64_t id)
         return NULL;
     }
 
+    ngx_pool_set_tag(pool, NGX_POOL_CONNECTION);
+
     log = ngx_palloc(pool, sizeof(ngx_log_t));
     if (log == NULL) {
         ngx_destroy_pool(pool);
@@ -11,6 +11,7 @@
 #include <ngx_event_quic_connection.h>
 
 
+static ngx_int_t ngx_quic_udp_handler(ngx_event_t *ev, ngx_udp_dgram_t *dg);
 static void ngx_quic_close_accepted_connection(ngx_connection_t *c);
 static ngx_connection_t *ngx_quic_lookup_connection(ngx_listening_t *ls,
     ngx_str_t *key, struct sockaddr *local_sockaddr, socklen_t local_socklen);
@@ -19,25 +20,9 @@ static ngx_connection_t *ngx_quic_lookup_connection(ngx_listening_t *ls,
 void
 ngx_quic_recvmsg(ngx_event_t *ev)
 {
-    ssize_t             n;
-    ngx_str_t           key;
-    ngx_buf_t           buf;
-    ngx_log_t          *log;
-    ngx_err_t           err;
-    socklen_t           socklen, local_socklen;
-    ngx_event_t        *rev, *wev;
-    struct iovec        iov[1];
-    struct msghdr       msg;
-    ngx_sockaddr_t      sa, lsa;
-    struct sockaddr    *sockaddr, *local_sockaddr;
-    ngx_listening_t    *ls;
-    ngx_event_conf_t   *ecf;
-    ngx_connection_t   *c, *lc;
-    ngx_quic_socket_t  *qsock;
-    static u_char       buffer[NGX_QUIC_MAX_UDP_PAYLOAD_SIZE];
-
-#if (NGX_HAVE_ADDRINFO_CMSG)
-    u_char             msg_control[CMSG_SPACE(sizeof(ngx_addrinfo_t))];
+    ngx_event_conf_t  *ecf;
+#if (NGX_DEBUG)
+    ngx_listening_t   *ls;
 #endif
 
     if (ev->timedout) {
@@ -54,297 +39,249 @@ ngx_quic_recvmsg(ngx_event_t *ev)
         ev->available = ecf->multi_accept;
     }
 
-    lc = ev->data;
-    ls = lc->listening;
     ev->ready = 0;
 
+#if (NGX_DEBUG)
+    ls = ((ngx_connection_t *) ev->data)->listening;
+
     ngx_log_debug2(NGX_LOG_DEBUG_EVENT, ev->log, 0,
                    "quic recvmsg on %V, ready: %d",
                    &ls->addr_text, ev->available);
-
-    do {
-        ngx_memzero(&msg, sizeof(struct msghdr));
-
-        iov[0].iov_base = (void *) buffer;
-        iov[0].iov_len = sizeof(buffer);
-
-        msg.msg_name = &sa;
-        msg.msg_namelen = sizeof(ngx_sockaddr_t);
-        msg.msg_iov = iov;
-        msg.msg_iovlen = 1;
-
-#if (NGX_HAVE_ADDRINFO_CMSG)
-        if (ls->wildcard) {
-            msg.msg_control = &msg_control;
-            msg.msg_controllen = sizeof(msg_control);
-
-            ngx_memzero(&msg_control, sizeof(msg_control));
-        }
 #endif
 
-        n = recvmsg(lc->fd, &msg, 0);
-
-        if (n == -1) {
-            err = ngx_socket_errno;
-
-            if (err == NGX_EAGAIN) {
-                ngx_log_debug0(NGX_LOG_DEBUG_EVENT, ev->log, err,
-                               "quic recvmsg() not ready");
-                return;
-            }
+    ngx_event_udp_recv(ev, ngx_quic_udp_handler);
+}
 
-            ngx_log_error(NGX_LOG_ALERT, ev->log, err, "quic recvmsg() failed");
 
-            return;
-        }
+static ngx_int_t
+ngx_quic_udp_handler(ngx_event_t *ev, ngx_udp_dgram_t *dg)
+{
+    ngx_str_t           key;
+    ngx_buf_t           buf;
+    ngx_log_t          *log;
+    ngx_event_t        *rev, *wev;
+    struct sockaddr    *local_sockaddr;
+    ngx_listening_t    *ls;
+    ngx_connection_t   *c, *lc;
+    ngx_quic_socket_t  *qsock;
 
-#if (NGX_HAVE_ADDRINFO_CMSG)
-        if (msg.msg_flags & (MSG_TRUNC|MSG_CTRUNC)) {
-            ngx_log_error(NGX_LOG_ALERT, ev->log, 0,
-                          "quic recvmsg() truncated data");
-            continue;
-        }
+#if (NGX_DEBUG)
+    ngx_event_conf_t   *ecf;
 #endif
 
-        sockaddr = msg.msg_name;
-        socklen = msg.msg_namelen;
-
-        if (socklen > (socklen_t) sizeof(ngx_sockaddr_t)) {
-            socklen = sizeof(ngx_sockaddr_t);
-        }
+    lc = ev->data;
+    ls = lc->listening;
 
 #if (NGX_HAVE_UNIX_DOMAIN)
 
-        if (sockaddr->sa_family == AF_UNIX) {
-            struct sockaddr_un *saun = (struct sockaddr_un *) sockaddr;
-
-            if (socklen <= (socklen_t) offsetof(struct sockaddr_un, sun_path)
-                || saun->sun_path[0] == '\0')
-            {
-                ngx_log_debug0(NGX_LOG_DEBUG_EVENT, ngx_cycle->log, 0,
-                               "unbound unix socket");
-                goto next;
-            }
-        }
-
-#endif
-
-        local_sockaddr = ls->sockaddr;
-        local_socklen = ls->socklen;
-
-#if (NGX_HAVE_ADDRINFO_CMSG)
+    if (dg->sockaddr->sa_family == AF_UNIX) {
+        struct sockaddr_un *saun = (struct sockaddr_un *) dg->sockaddr;
 
-        if (ls->wildcard) {
-            struct cmsghdr  *cmsg;
-
-            ngx_memcpy(&lsa, local_sockaddr, local_socklen);
-            local_sockaddr = &lsa.sockaddr;
-
-            for (cmsg = CMSG_FIRSTHDR(&msg);
-                 cmsg != NULL;
-                 cmsg = CMSG_NXTHDR(&msg, cmsg))
-            {
-                if (ngx_get_srcaddr_cmsg(cmsg, local_sockaddr) == NGX_OK) {
-                    break;
-                }
-            }
+        if (dg->socklen <= (socklen_t) offsetof(struct sockaddr_un, sun_path)
+            || saun->sun_path[0] == '\0')
+        {
+            ngx_log_debug0(NGX_LOG_DEBUG_EVENT, ngx_cycle->log, 0,
+                           "unbound unix socket");
+            return NGX_OK;
         }
+    }
 
 #endif
 
-        if (ngx_quic_get_packet_dcid(ev->log, buffer, n, &key) != NGX_OK) {
-            goto next;
-        }
+    if (ngx_quic_get_packet_dcid(ev->log, dg->start, dg->n, &key) != NGX_OK) {
+        return NGX_OK;
+    }
 
-        c = ngx_quic_lookup_connection(ls, &key, local_sockaddr, local_socklen);
+    c = ngx_quic_lookup_connection(ls, &key, dg->local_sockaddr,
+                                   dg->local_socklen);
 
-        if (c) {
+    if (c) {
 
 #if (NGX_DEBUG)
-            if (c->log->log_level & NGX_LOG_DEBUG_EVENT) {
-                ngx_log_handler_pt  handler;
+        if (c->log->log_level & NGX_LOG_DEBUG_EVENT) {
+            ngx_log_handler_pt  handler;
 
-                handler = c->log->handler;
-                c->log->handler = NULL;
+            handler = c->log->handler;
+            c->log->handler = NULL;
 
-                ngx_log_debug2(NGX_LOG_DEBUG_EVENT, c->log, 0,
-                               "quic recvmsg: fd:%d n:%z", c->fd, n);
+            ngx_log_debug2(NGX_LOG_DEBUG_EVENT, c->log, 0,
+                           "quic recvmsg: fd:%d n:%z", c->fd, dg->n);
 
-                c->log->handler = handler;
-            }
+            c->log->handler = handler;
+        }
 #endif
 
-            ngx_memzero(&buf, sizeof(ngx_buf_t));
+        ngx_memzero(&buf, sizeof(ngx_buf_t));
 
-            buf.pos = buffer;
-            buf.last = buffer + n;
-            buf.start = buf.pos;
-            buf.end = buffer + sizeof(buffer);
+        buf.pos = dg->start;
+        buf.last = dg->start + dg->n;
+        buf.start = buf.pos;
+        buf.end = buf.last;
 
-            qsock = ngx_quic_get_socket(c);
+        qsock = ngx_quic_get_socket(c);
 
-            ngx_memcpy(&qsock->sockaddr, sockaddr, socklen);
-            qsock->socklen = socklen;
+        ngx_memcpy(&qsock->sockaddr, dg->sockaddr, dg->socklen);
+        qsock->socklen = dg->socklen;
 
-            c->udp->buffer = &buf;
+        c->udp->buffer = &buf;
 
-            rev = c->read;
-            rev->ready = 1;
-            rev->active = 0;
+        rev = c->read;
+        rev->ready = 1;
+        rev->active = 0;
 
-            rev->handler(rev);
+        rev->handler(rev);
 
-            if (c->udp) {
-                c->udp->buffer = NULL;
-            }
+        if (c->udp) {
+            c->udp->buffer = NULL;
+        }
 
-            rev->ready = 0;
-            rev->active = 1;
+        rev->ready = 0;
+        rev->active = 1;
 
-            goto next;
-        }
+        return NGX_OK;
+    }
 
 #if (NGX_STAT_STUB)
-        (void) ngx_atomic_fetch_add(ngx_stat_accepted, 1);
+    (void) ngx_atomic_fetch_add(ngx_stat_accepted, 1);
 #endif
 
-        ngx_accept_disabled = ngx_cycle->connection_n / 8
-                              - ngx_cycle->free_connection_n;
+    ngx_accept_disabled = ngx_cycle->connection_n / 8
+                          - ngx_cycle->free_connection_n;
 
-        c = ngx_get_connection(lc->fd, ev->log);
-        if (c == NULL) {
-            return;
-        }
+    c = ngx_get_connection(lc->fd, ev->log);
+    if (c == NULL) {
+        return NGX_ERROR;
+    }
 
-        c->shared = 1;
-        c->type = SOCK_DGRAM;
-        c->socklen = socklen;
+    c->shared = 1;
+    c->type = SOCK_DGRAM;
+    c->socklen = dg->socklen;
 
 #if (NGX_STAT_STUB)
-        (void) ngx_atomic_fetch_add(ngx_stat_active, 1);
+    (void) ngx_atomic_fetch_add(ngx_stat_active, 1);
 #endif
 
-        c->pool = ngx_create_pool(ls->pool_size, ev->log);
-        if (c->pool == NULL) {
-            ngx_quic_close_accepted_connection(c);
-            return;
-        }
+    c->pool = ngx_create_pool(ngx_listening_pool_size(ls), ev->log);
+    if (c->pool == NULL) {
+        ngx_quic_close_accepted_connection(c);
+        return NGX_ERROR;
+    }
 
-        c->sockaddr = ngx_palloc(c->pool, NGX_SOCKADDRLEN);
-        if (c->sockaddr == NULL) {
-            ngx_quic_close_accepted_connection(c);
-            return;
-        }
+    ngx_pool_set_tag(c->pool, NGX_POOL_CONNECTION);
 
-        ngx_memcpy(c->sockaddr, sockaddr, socklen);
+    c->sockaddr = ngx_palloc(c->pool, NGX_SOCKADDRLEN);
+    if (c->sockaddr == NULL) {
+        ngx_quic_close_accepted_connection(c);
+        return NGX_ERROR;
+    }
 
-        log = ngx_palloc(c->pool, sizeof(ngx_log_t));
-        if (log == NULL) {
-            ngx_quic_close_accepted_connection(c);
-            return;
-        }
+    ngx_memcpy(c->sockaddr, dg->sockaddr, dg->socklen);
 
-        *log = ls->log;
+    log = ngx_palloc(c->pool, sizeof(ngx_log_t));
+    if (log == NULL) {
+        ngx_quic_close_accepted_connection(c);
+        return NGX_ERROR;
+    }
 
-        c->log = log;
-        c->pool->log = log;
-        c->listening = ls;
+    *log = ls->log;
 
-        if (local_sockaddr == &lsa.sockaddr) {
-            local_sockaddr = ngx_palloc(c->pool, local_socklen);
-            if (local_sockaddr == NULL) {
-                ngx_quic_close_accepted_connection(c);
-                return;
-            }
+    c->log = log;
+    c->pool->log = log;
+    c->listening = ls;
 
-            ngx_memcpy(local_sockaddr, &lsa, local_socklen);
-        }
+    local_sockaddr = dg->local_sockaddr;
 
-        c->local_sockaddr = local_sockaddr;
-        c->local_socklen = local_socklen;
-
-        c->buffer = ngx_create_temp_buf(c->pool, n);
-        if (c->buffer == NULL) {
+    if (local_sockaddr != ls->sockaddr) {
+        local_sockaddr = ngx_palloc(c->pool, dg->local_socklen);
+        if (local_sockaddr == NULL) {
             ngx_quic_close_accepted_connection(c);
-            return;
+            return NGX_ERROR;
         }
 
-        c->buffer->last = ngx_cpymem(c->buffer->last, buffer, n);
+        ngx_memcpy(local_sockaddr, dg->local_sockaddr, dg->local_socklen);
+    }
 
-        rev = c->read;
-        wev = c->write;
+    c->local_sockaddr = local_sockaddr;
+    c->local_socklen = dg->local_socklen;
 
-        rev->active = 1;
-        wev->ready = 1;
+    c->buffer = ngx_create_temp_buf(c->pool, dg->n);
+    if (c->buffer == NULL) {
+        ngx_quic_close_accepted_connection(c);
+        return NGX_ERROR;
+    }
 
-        rev->log = log;
-        wev->log = log;
+    c->buffer->last = ngx_cpymem(c->buffer->last, dg->start, dg->n);
 
-        /*
-         * TODO: MT: - ngx_atomic_fetch_add()
-         *             or protection by critical section or light mutex
-         *
-         * TODO: MP: - allocated in a shared memory
-         *           - ngx_atomic_fetch_add()
-         *             or protection by critical section or light mutex
-         */
+    rev = c->read;
+    wev = c->write;
 
-        c->number = ngx_atomic_fetch_add(ngx_connection_counter, 1);
+    rev->active = 1;
+    wev->ready = 1;
 
-        c->start_time = ngx_current_msec;
+    rev->log = log;
+    wev->log = log;
+
+    /*
+     * TODO: MT: - ngx_atomic_fetch_add()
+     *             or protection by critical section or light mutex
+     *
+     * TODO: MP: - allocated in a shared memory
+     *           - ngx_atomic_fetch_add()
+     *             or protection by critical section or light mutex
+     */
+
+    c->number = ngx_atomic_fetch_add(ngx_connection_counter, 1);
+
+    c->start_time = ngx_current_msec;
 
 #if (NGX_STAT_STUB)
-        (void) ngx_atomic_fetch_add(ngx_stat_handled, 1);
+    (void) ngx_atomic_fetch_add(ngx_stat_handled, 1);
 #endif
 
-        if (ls->addr_ntop) {
-            c->addr_text.data = ngx_pnalloc(c->pool, ls->addr_text_max_len);
-            if (c->addr_text.data == NULL) {
-                ngx_quic_close_accepted_connection(c);
-                return;
-            }
-
-            c->addr_text.len = ngx_sock_ntop(c->sockaddr, c->socklen,
-                                             c->addr_text.data,
-                                             ls->addr_text_max_len, 0);
-            if (c->addr_text.len == 0) {
-                ngx_quic_close_accepted_connection(c);
-                return;
-            }
+    if (ls->addr_ntop) {
+        c->addr_text.data = ngx_pnalloc(c->pool, ls->addr_text_max_len);
+        if (c->addr_text.data == NULL) {
+            ngx_quic_close_accepted_connection(c);
+            return NGX_ERROR;
         }
 
-#if (NGX_DEBUG)
-        {
-        ngx_str_t  addr;
-        u_char     text[NGX_SOCKADDR_STRLEN];
+        c->addr_text.len = ngx_sock_ntop(c->sockaddr, c->socklen,
+                                         c->addr_text.data,
+                                         ls->addr_text_max_len, 0);
+        if (c->addr_text.len == 0) {
+            ngx_quic_close_accepted_connection(c);
+            return NGX_ERROR;
+        }
+    }
 
-        ngx_debug_accepted_connection(ecf, c);
+#if (NGX_DEBUG)
+    {
+    ngx_str_t  addr;
+    u_char     text[NGX_SOCKADDR_STRLEN];
 
-        if (log->log_level & NGX_LOG_DEBUG_EVENT) {
-            addr.data = text;
-            addr.len = ngx_sock_ntop(c->sockaddr, c->socklen, text,
-                                     NGX_SOCKADDR_STRLEN, 1);
+    ecf = ngx_event_get_conf(ngx_cycle->conf_ctx, ngx_event_core_module);
 
-            ngx_log_debug4(NGX_LOG_DEBUG_EVENT, log, 0,
-                           "*%uA quic recvmsg: %V fd:%d n:%z",
-                           c->number, &addr, c->fd, n);
-        }
+    ngx_debug_accepted_connection(ecf, c);
 
-        }
-#endif
+    if (log->log_level & NGX_LOG_DEBUG_EVENT) {
+        addr.data = text;
+        addr.len = ngx_sock_ntop(c->sockaddr, c->socklen, text,
+                                 NGX_SOCKADDR_STRLEN, 1);
 
-        log->data = NULL;
-        log->handler = NULL;
+        ngx_log_debug4(NGX_LOG_DEBUG_EVENT, log, 0,
+                       "*%uA quic recvmsg: %V fd:%d n:%z",
+                       c->number, &addr, c->fd, dg->n);
+    }
 
-        ls->handler(c);
+    }
+#endif
 
-    next:
+    log->data = NULL;
+    log->handler = NULL;
 
-        if (ngx_event_flags & NGX_USE_KQUEUE_EVENT) {
-            ev->available -= n;
-        }
+    ls->handler(c);
 
-    } while (ev->available);
+    return NGX_OK;
 }
 
 
@@ -3509,7 +3509,7 @@ ngx_http_fastcgi_init_params(ngx_conf_t *cf, ngx_http_fastcgi_loc_conf_t *conf,
     hash.max_size = 512;
     hash.bucket_size = 64;
     hash.name = "fastcgi_params_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
     hash.temp_pool = NULL;
 
     return ngx_hash_init(&hash, headers_names.elts, headers_names.nelts);
@@ -104,7 +104,7 @@ static ngx_conf_num_bounds_t  ngx_http_limit_req_status_bounds = {
 static ngx_command_t  ngx_http_limit_req_commands[] = {
 
     { ngx_string("limit_req_zone"),
-      NGX_HTTP_MAIN_CONF|NGX_CONF_TAKE3,
+      NGX_HTTP_MAIN_CONF|NGX_CONF_TAKE3|NGX_CONF_TAKE4,
       ngx_http_limit_req_zone,
       0,
       0,
@@ -761,6 +761,103 @@ ngx_http_limit_req_init_zone(ngx_shm_zone_t *shm_zone, void *data)
 }
 
 
+static ngx_int_t
+ngx_http_limit_req_migrate_zone(ngx_shm_zone_t *shm_zone, void *data)
+{
+    ngx_http_limit_req_ctx_t  *octx = data;
+
+    size_t                      size;
+    ngx_queue_t                *q;
+    ngx_rbtree_node_t          *node;
+    ngx_http_limit_req_ctx_t   *ctx;
+    ngx_http_limit_req_node_t  *lr, *olr;
+
+    ctx = shm_zone->data;
+
+    if (ctx->key.value.len != octx->key.value.len
+        || ngx_strncmp(ctx->key.value.data, octx->key.value.data,
+                       ctx->key.value.len)
+           != 0)
+    {
+        return NGX_OK;
+    }
+
+    /* the most recently used states are copied first */
+
+    for (q = ngx_queue_head(&octx->sh->queue);
+         q != ngx_queue_sentinel(&octx->sh->queue);
+         q = ngx_queue_next(q))
+    {
+        olr = ngx_queue_data(q, ngx_http_limit_req_node_t, queue);
+
+        size = offsetof(ngx_rbtree_node_t, color)
+               + offsetof(ngx_http_limit_req_node_t, data)
+               + olr->len;
+
+        node = ngx_slab_alloc_locked(ctx->shpool, size);
+        if (node == NULL) {
+            break;
+        }
+
+        ngx_memcpy(node, (u_char *) olr - offsetof(ngx_rbtree_node_t, color),
+                   size);
+
+        lr = (ngx_http_limit_req_node_t *) &node->color;
+
+        lr->count = 0;
+
+        ngx_rbtree_insert(&ctx->sh->rbtree, node);
+        ngx_queue_insert_tail(&ctx->sh->queue, &lr->queue);
+    }
+
+    return NGX_OK;
+}
+
+
+/*
+ * Besides the shared header and the log context, the zone holds only
+ * nodes.  Nodes referenced by requests are not moved, the zone is locked
+ * by the caller.
+ */
+
+static void
+ngx_http_limit_req_move(ngx_shm_zone_t *shm_zone, void *p)
+{
+    size_t                      size;
+    ngx_rbtree_node_t          *node, *moved;
+    ngx_http_limit_req_ctx_t   *ctx;
+    ngx_http_limit_req_node_t  *lr;
+
+    ctx = shm_zone->data;
+
+    if (p == ctx->sh || p == ctx->shpool->log_ctx) {
+        return;
+    }
+
+    node = p;
+    lr = (ngx_http_limit_req_node_t *) &node->color;
+
+    if (lr->count) {
+        return;
+    }
+
+    size = offsetof(ngx_rbtree_node_t, color)
+           + offsetof(ngx_http_limit_req_node_t, data)
+           + lr->len;
+
+    moved = ngx_slab_move(ctx->shpool, node, size);
+
+    if (moved == node) {
+        return;
+    }
+
+    ngx_rbtree_move(&ctx->sh->rbtree, node, moved);
+
+    lr = (ngx_http_limit_req_node_t *) &moved->color;
+    ngx_queue_move(&lr->queue);
+}
+
+
 static ngx_int_t
 ngx_http_limit_req_status_variable(ngx_http_request_t *r,
     ngx_http_variable_value_t *v, uintptr_t data)
@@ -834,7 +931,7 @@ ngx_http_limit_req_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 {
     u_char                            *p;
     size_t                             len;
-    ssize_t                            size;
+    ssize_t                            size, hugepages;
     ngx_str_t                         *value, name, s;
     ngx_int_t                          rate, scale;
     ngx_uint_t                         i;
@@ -860,6 +957,7 @@ ngx_http_limit_req_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     }
 
     size = 0;
+    hugepages = 0;
     rate = 1;
     scale = 1;
     name.len = 0;
@@ -924,6 +1022,22 @@ ngx_http_limit_req_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
             continue;
         }
 
+        if (ngx_strncmp(value[i].data, "hugepages=", 10) == 0) {
+
+            s.len = value[i].len - 10;
+            s.data = value[i].data + 10;
+
+            hugepages = ngx_parse_hugepages(&s);
+            if (hugepages == NGX_ERROR) {
+                ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                                   "invalid hugepages value \"%V\"",
+                                   &value[i]);
+                return NGX_CONF_ERROR;
+            }
+
+            continue;
+        }
+
         ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
                            "invalid parameter \"%V\"", &value[i]);
         return NGX_CONF_ERROR;
@@ -954,7 +1068,10 @@ ngx_http_limit_req_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     }
 
     shm_zone->init = ngx_http_limit_req_init_zone;
+    shm_zone->migrate = ngx_http_limit_req_migrate_zone;
+    shm_zone->move = ngx_http_limit_req_move;
     shm_zone->data = ctx;
+    shm_zone->shm.hugepages = hugepages;
 
     return NGX_CONF_OK;
 }
@@ -296,7 +296,7 @@ ngx_http_map_block(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     hash.max_size = mcf->hash_max_size;
     hash.bucket_size = mcf->hash_bucket_size;
     hash.name = "map_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
 
     if (ctx.keys.keys.nelts) {
         hash.hash = &map->map.hash.hash;
@@ -353,8 +353,32 @@ ngx_http_map_block(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 #if (NGX_PCRE)
 
     if (ctx.regexes.nelts) {
+        ngx_uint_t             i;
+        ngx_http_regex_t     **regex;
+        ngx_http_map_regex_t  *reg;
+
         map->map.regex = ctx.regexes.elts;
         map->map.nregex = ctx.regexes.nelts;
+
+        regex = ngx_palloc(cf->pool,
+                           map->map.nregex * sizeof(ngx_http_regex_t *));
+        if (regex == NULL) {
+            ngx_destroy_pool(pool);
+            return NGX_CONF_ERROR;
+        }
+
+        reg = map->map.regex;
+
+        for (i = 0; i < map->map.nregex; i++) {
+            regex[i] = reg[i].regex;
+        }
+
+        map->map.regex_set = ngx_http_regex_set_create(cf, regex,
+                                                       map->map.nregex);
+        if (map->map.regex_set == NULL) {
+            ngx_destroy_pool(pool);
+            return NGX_CONF_ERROR;
+        }
     }
 
 #endif
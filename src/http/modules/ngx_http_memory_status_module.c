@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) Igor Sysoev
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+
+
+static ngx_int_t ngx_http_memory_status_handler(ngx_http_request_t *r);
+static char *ngx_http_set_memory_status(ngx_conf_t *cf, ngx_command_t *cmd,
+    void *conf);
+
+
+static ngx_command_t  ngx_http_memory_status_commands[] = {
+
+    { ngx_string("memory_status"),
+      NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_NOARGS,
+      ngx_http_set_memory_status,
+      0,
+      0,
+      NULL },
+
+      ngx_null_command
+};
+
+
+static ngx_http_module_t  ngx_http_memory_status_module_ctx = {
+    NULL,                                  /* preconfiguration */
+    NULL,                                  /* postconfiguration */
+
+    NULL,                                  /* create main configuration */
+    NULL,                                  /* init main configuration */
+
+    NULL,                                  /* create server configuration */
+    NULL,                                  /* merge server configuration */
+
+    NULL,                                  /* create location configuration */
+    NULL                                   /* merge location configuration */
+};
+
+
+ngx_module_t  ngx_http_memory_status_module = {
+    NGX_MODULE_V1,
+    &ngx_http_memory_status_module_ctx,    /* module context */
+    ngx_http_memory_status_commands,       /* module directives */
+    NGX_HTTP_MODULE,                       /* module type */
+    NULL,                                  /* init master */
+    NULL,                                  /* init module */
+    NULL,                                  /* init process */
+    NULL,                                  /* init thread */
+    NULL,                                  /* exit thread */
+    NULL,                                  /* exit process */
+    NULL,                                  /* exit master */
+    NGX_MODULE_V1_PADDING
+};
+
+
+#if (NGX_LINUX)
+
+/*
+ * Reading /proc/self/smaps_rollup walks the page tables of the process,
+ * so the memory of the worker is updated at most once a second.
+ */
+
+static time_t  ngx_http_memory_status_updated;
+static size_t  ngx_http_memory_status_shared;
+static size_t  ngx_http_memory_status_private;
+
+#endif
+
+
+/*
+ * The counters are those of the worker process which handles the request:
+ *
+ * Worker: 12345
+ * Memory: shared 3276800 private 1187840
+ * Pools: pools size allocs requested
+ *  other 1 1024 10 640
+ *  ...
+ * Zones: size pages free allocs frees requested runs largest
+ *  one 10485760 2550 2540 12 3 1536 2 2536
+ *   128 2 1 40 62
+ *
+ * where zone lines are followed by the lines of its size classes in use:
+ * chunk size, pages, pages with free chunks, used and total chunks.
+ * The memory per NUMA node is only logged on "nginx -s memory", as it
+ * is collected from all mappings of the process.
+ */
+
+static ngx_int_t
+ngx_http_memory_status_handler(ngx_http_request_t *r)
+{
+    size_t               size;
+    ngx_int_t            rc;
+    ngx_buf_t           *b;
+    ngx_uint_t           i, n, k;
+    ngx_chain_t          out;
+    ngx_shm_zone_t      *zone;
+    ngx_list_part_t     *part;
+    ngx_slab_pool_t     *sp;
+    ngx_slab_frag_t      frag;
+    ngx_pool_account_t  *pa;
+    ngx_slab_account_t  *sa;
+
+#if (NGX_LINUX)
+    size_t               shared, private;
+#endif
+
+    if (!(r->method & (NGX_HTTP_GET|NGX_HTTP_HEAD))) {
+        return NGX_HTTP_NOT_ALLOWED;
+    }
+
+    rc = ngx_http_discard_request_body(r);
+
+    if (rc != NGX_OK) {
+        return rc;
+    }
+
+    if (!ngx_pool_accounting) {
+        return NGX_HTTP_NOT_FOUND;
+    }
+
+    r->headers_out.content_type_len = sizeof("text/plain") - 1;
+    ngx_str_set(&r->headers_out.content_type, "text/plain");
+    r->headers_out.content_type_lowcase = NULL;
+
+    size = sizeof("Worker: \n") + NGX_INT64_LEN
+           + sizeof("Pools: pools size allocs requested\n") - 1
+           + sizeof("Zones: size pages free allocs frees requested") - 1
+           + sizeof(" runs largest\n") - 1;
+
+    for (i = 0; i < NGX_POOL_TAGS; i++) {
+        size += sizeof("     \n") - 1 + ngx_pool_tags[i].len
+                + 4 * NGX_SIZE_T_LEN;
+    }
+
+    part = &((ngx_cycle_t *) ngx_cycle)->shared_memory.part;
+    zone = part->elts;
+
+    for (i = 0; /* void */ ; i++) {
+
+        if (i >= part->nelts) {
+            if (part->next == NULL) {
+                break;
+            }
+            part = part->next;
+            zone = part->elts;
+            i = 0;
+        }
+
+        size += sizeof("         \n") - 1 + zone[i].shm.name.len
+                + 8 * NGX_SIZE_T_LEN
+                + ngx_pagesize_shift * (sizeof("       \n") - 1
+                                        + 5 * NGX_SIZE_T_LEN);
+    }
+
+#if (NGX_LINUX)
+
+    if (ngx_http_memory_status_updated != ngx_time()) {
+        ngx_http_memory_status_updated = ngx_time();
+
+        if (ngx_linux_memory_usage(&ngx_http_memory_status_shared,
+                                   &ngx_http_memory_status_private,
+                                   r->connection->log)
+            != NGX_OK)
+        {
+            ngx_http_memory_status_shared = 0;
+            ngx_http_memory_status_private = 0;
+        }
+    }
+
+    shared = ngx_http_memory_status_shared;
+    private = ngx_http_memory_status_private;
+
+    if (shared || private) {
+        size += sizeof("Memory: shared  private \n") - 1
+                + 2 * NGX_SIZE_T_LEN;
+    }
+
+#endif
+
+    frag.pages = ngx_palloc(r->pool, 2 * ngx_pagesize_shift
+                                     * sizeof(ngx_uint_t));
+    if (frag.pages == NULL) {
+        return NGX_HTTP_INTERNAL_SERVER_ERROR;
+    }
+
+    frag.partial = frag.pages + ngx_pagesize_shift;
+
+    b = ngx_create_temp_buf(r->pool, size);
+    if (b == NULL) {
+        return NGX_HTTP_INTERNAL_SERVER_ERROR;
+    }
+
+    out.buf = b;
+    out.next = NULL;
+
+    b->last = ngx_sprintf(b->last, "Worker: %P\n", ngx_pid);
+
+#if (NGX_LINUX)
+
+    if (shared || private) {
+        b->last = ngx_sprintf(b->last, "Memory: shared %uz private %uz\n",
+                              shared, private);
+    }
+
+#endif
+
+    b->last = ngx_sprintf(b->last, "Pools: pools size allocs requested\n");
+
+    for (i = 0; i < NGX_POOL_TAGS; i++) {
+        pa = &ngx_pool_accounts[i];
+
+        b->last = ngx_sprintf(b->last, " %V %ui %uz %ui %uz\n",
+                              &ngx_pool_tags[i], pa->pools, pa->size,
+                              pa->allocs, pa->requested);
+    }
+
+    b->last = ngx_sprintf(b->last, "Zones: size pages free allocs frees "
+                                   "requested runs largest\n");
+
+    part = &((ngx_cycle_t *) ngx_cycle)->shared_memory.part;
+    zone = part->elts;
+
+    for (i = 0; /* void */ ; i++) {
+
+        if (i >= part->nelts) {
+            if (part->next == NULL) {
+                break;
+            }
+            part = part->next;
+            zone = part->elts;
+            i = 0;
+        }
+
+        sp = (ngx_slab_pool_t *) zone[i].shm.addr;
+        sa = ngx_slab_get_account(sp);
+
+        ngx_slab_fragmentation(sp, &frag);
+
+        b->last = ngx_sprintf(b->last, " %V %uz %ui %ui %ui %ui %uz %ui %ui\n",
+                              &zone[i].shm.name, zone[i].shm.size,
+                              (ngx_uint_t) (sp->last - sp->pages), sp->pfree,
+                              sa ? sa->allocs : 0, sa ? sa->frees : 0,
+                              sa ? sa->requested : 0,
+                              frag.runs, frag.largest);
+
+        n = ngx_pagesize_shift - sp->min_shift;
+
+        for (k = 0; k < n; k++) {
+            if (frag.pages[k] == 0) {
+                continue;
+            }
+
+            b->last = ngx_sprintf(b->last, "  %uz %ui %ui %ui %ui\n",
+                                  (size_t) 1 << (k + sp->min_shift),
+                                  frag.pages[k], frag.partial[k],
+                                  sp->stats[k].used, sp->stats[k].total);
+        }
+    }
+
+    r->headers_out.status = NGX_HTTP_OK;
+    r->headers_out.content_length_n = b->last - b->pos;
+
+    b->last_buf = (r == r->main) ? 1 : 0;
+    b->last_in_chain = 1;
+
+    rc = ngx_http_send_header(r);
+
+    if (rc == NGX_ERROR || rc > NGX_OK || r->header_only) {
+        return rc;
+    }
+
+    return ngx_http_output_filter(r, &out);
+}
+
+
+static char *
+ngx_http_set_memory_status(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    ngx_http_core_loc_conf_t  *clcf;
+
+    clcf = ngx_http_conf_get_module_loc_conf(cf, ngx_http_core_module);
+    clcf->handler = ngx_http_memory_status_handler;
+
+    return NGX_CONF_OK;
+}
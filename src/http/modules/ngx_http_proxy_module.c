@@ -4103,7 +4103,7 @@ ngx_http_proxy_init_headers(ngx_conf_t *cf, ngx_http_proxy_loc_conf_t *conf,
     hash.max_size = conf->headers_hash_max_size;
     hash.bucket_size = conf->headers_hash_bucket_size;
     hash.name = "proxy_headers_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
     hash.temp_pool = NULL;
 
     return ngx_hash_init(&hash, headers_names.elts, headers_names.nelts);
@@ -395,7 +395,7 @@ ngx_http_referer_merge_conf(ngx_conf_t *cf, void *parent, void *child)
     hash.max_size = conf->referer_hash_max_size;
     hash.bucket_size = conf->referer_hash_bucket_size;
     hash.name = "referer_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
 
     if (conf->keys->keys.nelts) {
         hash.hash = &conf->hash.hash;
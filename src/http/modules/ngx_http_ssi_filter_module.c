@@ -2877,7 +2877,7 @@ ngx_http_ssi_init_main_conf(ngx_conf_t *cf, void *conf)
     hash.max_size = 1024;
     hash.bucket_size = ngx_cacheline_size;
     hash.name = "ssi_command_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
     hash.temp_pool = NULL;
 
     if (ngx_hash_init(&hash, smcf->commands.keys.elts,
@@ -76,6 +76,27 @@ static ngx_http_variable_t  ngx_http_stub_status_vars[] = {
     { ngx_string("connections_waiting"), NULL, ngx_http_stub_status_variable,
       3, NGX_HTTP_VAR_NOCACHEABLE, 0 },
 
+    { ngx_string("udp_recv_batches"), NULL, ngx_http_stub_status_variable,
+      4, NGX_HTTP_VAR_NOCACHEABLE, 0 },
+
+    { ngx_string("udp_recv_datagrams"), NULL, ngx_http_stub_status_variable,
+      5, NGX_HTTP_VAR_NOCACHEABLE, 0 },
+
+    { ngx_string("event_loop_wakeups"), NULL, ngx_http_stub_status_variable,
+      6, NGX_HTTP_VAR_NOCACHEABLE, 0 },
+
+    { ngx_string("event_loop_events"), NULL, ngx_http_stub_status_variable,
+      7, NGX_HTTP_VAR_NOCACHEABLE, 0 },
+
+    { ngx_string("event_loop_wait_time"), NULL, ngx_http_stub_status_variable,
+      8, NGX_HTTP_VAR_NOCACHEABLE, 0 },
+
+    { ngx_string("event_loop_yields"), NULL, ngx_http_stub_status_variable,
+      9, NGX_HTTP_VAR_NOCACHEABLE, 0 },
+
+    { ngx_string("event_loop_max_stall"), NULL, ngx_http_stub_status_variable,
+      10, NGX_HTTP_VAR_NOCACHEABLE, 0 },
+
       ngx_http_null_variable
 };
 
@@ -179,6 +200,34 @@ ngx_http_stub_status_variable(ngx_http_request_t *r,
         value = *ngx_stat_waiting;
         break;
 
+    case 4:
+        value = *ngx_stat_udp_batches;
+        break;
+
+    case 5:
+        value = *ngx_stat_udp_datagrams;
+        break;
+
+    case 6:
+        value = *ngx_stat_event_wakeups;
+        break;
+
+    case 7:
+        value = *ngx_stat_event_events;
+        break;
+
+    case 8:
+        value = *ngx_stat_event_wait_time;
+        break;
+
+    case 9:
+        value = *ngx_stat_event_yields;
+        break;
+
+    case 10:
+        value = *ngx_stat_event_max_stall;
+        break;
+
     /* suppress warning */
     default:
         value = 0;
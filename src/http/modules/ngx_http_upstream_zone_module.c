@@ -23,7 +23,7 @@ static ngx_http_upstream_rr_peer_t *ngx_http_upstream_zone_copy_peer(
 static ngx_command_t  ngx_http_upstream_zone_commands[] = {
 
     { ngx_string("zone"),
-      NGX_HTTP_UPS_CONF|NGX_CONF_TAKE12,
+      NGX_HTTP_UPS_CONF|NGX_CONF_TAKE123,
       ngx_http_upstream_zone,
       0,
       0,
@@ -67,8 +67,9 @@ ngx_module_t  ngx_http_upstream_zone_module = {
 static char *
 ngx_http_upstream_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 {
-    ssize_t                         size;
-    ngx_str_t                      *value;
+    ssize_t                         size, hugepages;
+    ngx_str_t                      *value, s;
+    ngx_uint_t                      i;
     ngx_http_upstream_srv_conf_t   *uscf;
     ngx_http_upstream_main_conf_t  *umcf;
 
@@ -83,12 +84,38 @@ ngx_http_upstream_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
         return NGX_CONF_ERROR;
     }
 
-    if (cf->args->nelts == 3) {
-        size = ngx_parse_size(&value[2]);
+    size = 0;
+    hugepages = NGX_CONF_UNSET;
+
+    for (i = 2; i < cf->args->nelts; i++) {
+
+        if (ngx_strncmp(value[i].data, "hugepages=", 10) == 0) {
+
+            s.len = value[i].len - 10;
+            s.data = value[i].data + 10;
+
+            hugepages = ngx_parse_hugepages(&s);
+            if (hugepages == NGX_ERROR) {
+                ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                                   "invalid hugepages value \"%V\"",
+                                   &value[i]);
+                return NGX_CONF_ERROR;
+            }
+
+            continue;
+        }
+
+        if (i != 2) {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "invalid parameter \"%V\"", &value[i]);
+            return NGX_CONF_ERROR;
+        }
+
+        size = ngx_parse_size(&value[i]);
 
         if (size == NGX_ERROR) {
             ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
-                               "invalid zone size \"%V\"", &value[2]);
+                               "invalid zone size \"%V\"", &value[i]);
             return NGX_CONF_ERROR;
         }
 
@@ -97,9 +124,6 @@ ngx_http_upstream_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
                                "zone \"%V\" is too small", &value[1]);
             return NGX_CONF_ERROR;
         }
-
-    } else {
-        size = 0;
     }
 
     uscf->shm_zone = ngx_shared_memory_add(cf, &value[1], size,
@@ -113,6 +137,10 @@ ngx_http_upstream_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 
     uscf->shm_zone->noreuse = 1;
 
+    if (hugepages != NGX_CONF_UNSET) {
+        uscf->shm_zone->shm.hugepages = hugepages;
+    }
+
     return NGX_CONF_OK;
 }
 
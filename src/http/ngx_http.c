@@ -43,11 +43,11 @@ static ngx_int_t ngx_http_cmp_locations(const ngx_queue_t *one,
     const ngx_queue_t *two);
 static ngx_int_t ngx_http_join_exact_locations(ngx_conf_t *cf,
     ngx_queue_t *locations);
-static void ngx_http_create_locations_list(ngx_queue_t *locations,
-    ngx_queue_t *q);
+static int ngx_libc_cdecl ngx_http_cmp_location_names(const void *one,
+    const void *two);
 static ngx_http_location_tree_node_t *
-    ngx_http_create_locations_tree(ngx_conf_t *cf, ngx_queue_t *locations,
-    size_t prefix);
+    ngx_http_create_locations_tree(ngx_conf_t *cf,
+    ngx_http_location_queue_t **lqs, ngx_uint_t n, size_t prefix);
 
 static ngx_int_t ngx_http_optimize_servers(ngx_conf_t *cf,
     ngx_http_core_main_conf_t *cmcf, ngx_array_t *ports);
@@ -439,7 +439,7 @@ ngx_http_init_headers_in_hash(ngx_conf_t *cf, ngx_http_core_main_conf_t *cmcf)
     hash.max_size = 512;
     hash.bucket_size = ngx_align(64, ngx_cacheline_size);
     hash.name = "headers_in_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
     hash.temp_pool = NULL;
 
     if (ngx_hash_init(&hash, headers_in.elts, headers_in.nelts) != NGX_OK) {
@@ -678,6 +678,7 @@ ngx_http_init_locations(ngx_conf_t *cf, ngx_http_core_srv_conf_t *cscf,
 #if (NGX_PCRE)
     ngx_uint_t                   r;
     ngx_queue_t                 *regex;
+    ngx_http_regex_t           **rep;
 #endif
 
     locations = pclcf->locations;
@@ -775,17 +776,28 @@ ngx_http_init_locations(ngx_conf_t *cf, ngx_http_core_srv_conf_t *cscf,
 
         pclcf->regex_locations = clcfp;
 
+        rep = ngx_palloc(cf->pool, r * sizeof(ngx_http_regex_t *));
+        if (rep == NULL) {
+            return NGX_ERROR;
+        }
+
         for (q = regex;
              q != ngx_queue_sentinel(locations);
              q = ngx_queue_next(q))
         {
             lq = (ngx_http_location_queue_t *) q;
 
+            *(rep++) = lq->exact->regex;
             *(clcfp++) = lq->exact;
         }
 
         *clcfp = NULL;
 
+        pclcf->regex_set = ngx_http_regex_set_create(cf, rep - r, r);
+        if (pclcf->regex_set == NULL) {
+            return NGX_ERROR;
+        }
+
         ngx_queue_split(locations, regex, &tail);
     }
 
@@ -799,9 +811,10 @@ static ngx_int_t
 ngx_http_init_static_location_trees(ngx_conf_t *cf,
     ngx_http_core_loc_conf_t *pclcf)
 {
+    ngx_uint_t                  n;
     ngx_queue_t                *q, *locations;
     ngx_http_core_loc_conf_t   *clcf;
-    ngx_http_location_queue_t  *lq;
+    ngx_http_location_queue_t  *lq, **lqs;
 
     locations = pclcf->locations;
 
@@ -830,9 +843,33 @@ ngx_http_init_static_location_trees(ngx_conf_t *cf,
         return NGX_ERROR;
     }
 
-    ngx_http_create_locations_list(locations, ngx_queue_head(locations));
+    n = 0;
+
+    for (q = ngx_queue_head(locations);
+         q != ngx_queue_sentinel(locations);
+         q = ngx_queue_next(q))
+    {
+        n++;
+    }
+
+    lqs = ngx_palloc(cf->temp_pool, n * sizeof(ngx_http_location_queue_t *));
+    if (lqs == NULL) {
+        return NGX_ERROR;
+    }
+
+    n = 0;
+
+    for (q = ngx_queue_head(locations);
+         q != ngx_queue_sentinel(locations);
+         q = ngx_queue_next(q))
+    {
+        lqs[n++] = (ngx_http_location_queue_t *) q;
+    }
+
+    ngx_qsort(lqs, n, sizeof(ngx_http_location_queue_t *),
+              ngx_http_cmp_location_names);
 
-    pclcf->static_locations = ngx_http_create_locations_tree(cf, locations, 0);
+    pclcf->static_locations = ngx_http_create_locations_tree(cf, lqs, n, 0);
     if (pclcf->static_locations == NULL) {
         return NGX_ERROR;
     }
@@ -880,8 +917,6 @@ ngx_http_add_location(ngx_conf_t *cf, ngx_queue_t **locations,
     lq->file_name = cf->conf_file->file.name.data;
     lq->line = cf->conf_file->line;
 
-    ngx_queue_init(&lq->list);
-
     ngx_queue_insert_tail(*locations, &lq->queue);
 
     if (ngx_http_escape_location_name(cf, clcf) != NGX_OK) {
@@ -1037,139 +1072,164 @@ ngx_http_join_exact_locations(ngx_conf_t *cf, ngx_queue_t *locations)
 }
 
 
-static void
-ngx_http_create_locations_list(ngx_queue_t *locations, ngx_queue_t *q)
+static int ngx_libc_cdecl
+ngx_http_cmp_location_names(const void *one, const void *two)
 {
-    u_char                     *name;
-    size_t                      len;
-    ngx_queue_t                *x, tail;
-    ngx_http_location_queue_t  *lq, *lx;
-
-    if (q == ngx_queue_last(locations)) {
-        return;
-    }
-
-    lq = (ngx_http_location_queue_t *) q;
+    size_t                      i, len;
+    ngx_str_t                  *first, *second;
+    ngx_http_location_queue_t  *lq1, *lq2;
 
-    if (lq->inclusive == NULL) {
-        ngx_http_create_locations_list(locations, ngx_queue_next(q));
-        return;
-    }
+    lq1 = *(ngx_http_location_queue_t **) one;
+    lq2 = *(ngx_http_location_queue_t **) two;
 
-    len = lq->name->len;
-    name = lq->name->data;
+    first = lq1->name;
+    second = lq2->name;
 
-    for (x = ngx_queue_next(q);
-         x != ngx_queue_sentinel(locations);
-         x = ngx_queue_next(x))
-    {
-        lx = (ngx_http_location_queue_t *) x;
+    len = ngx_min(first->len, second->len);
 
-        if (len > lx->name->len
-            || ngx_filename_cmp(name, lx->name->data, len) != 0)
+    for (i = 0; i < len; i++) {
+        if (ngx_http_location_key(first->data[i])
+            != ngx_http_location_key(second->data[i]))
         {
-            break;
+            return (int) ngx_http_location_key(first->data[i])
+                   - (int) ngx_http_location_key(second->data[i]);
         }
     }
 
-    q = ngx_queue_next(q);
-
-    if (q == x) {
-        ngx_http_create_locations_list(locations, x);
-        return;
-    }
-
-    ngx_queue_split(locations, q, &tail);
-    ngx_queue_add(&lq->list, &tail);
-
-    if (x == ngx_queue_sentinel(locations)) {
-        ngx_http_create_locations_list(&lq->list, ngx_queue_head(&lq->list));
-        return;
+    if (first->len == second->len) {
+        return 0;
     }
 
-    ngx_queue_split(&lq->list, x, &tail);
-    ngx_queue_add(locations, &tail);
-
-    ngx_http_create_locations_list(&lq->list, ngx_queue_head(&lq->list));
-
-    ngx_http_create_locations_list(locations, x);
+    return (first->len < second->len) ? -1 : 1;
 }
 
 
 /*
- * to keep cache locality for left leaf nodes, allocate nodes in following
- * order: node, left subtree, right subtree, inclusive subtree
+ * the static locations are kept in a radix tree: a node holds the part
+ * of names common to all locations below it, and its children are found
+ * by the first byte of their parts, either in a short list of keys, or,
+ * for nodes with many children, through an index of all byte values;
+ * nodes are allocated in the depth-first order
  */
 
 static ngx_http_location_tree_node_t *
-ngx_http_create_locations_tree(ngx_conf_t *cf, ngx_queue_t *locations,
-    size_t prefix)
+ngx_http_create_locations_tree(ngx_conf_t *cf, ngx_http_location_queue_t **lqs,
+    ngx_uint_t n, size_t prefix)
 {
+    u_char                         *first, *last, key;
     size_t                          len;
-    ngx_queue_t                    *q, tail;
+    ngx_uint_t                      i, j, k, nchildren;
     ngx_http_location_queue_t      *lq;
-    ngx_http_location_tree_node_t  *node;
+    ngx_http_location_tree_node_t  *node, *child;
+
+    /*
+     * the names are sorted, so the part common to the first and the last
+     * ones is common to all of them
+     */
 
-    q = ngx_queue_middle(locations);
+    first = lqs[0]->name->data;
+    last = lqs[n - 1]->name->data;
 
-    lq = (ngx_http_location_queue_t *) q;
-    len = lq->name->len - prefix;
+    len = ngx_min(lqs[0]->name->len, lqs[n - 1]->name->len);
 
-    node = ngx_palloc(cf->pool,
-                      offsetof(ngx_http_location_tree_node_t, name) + len);
-    if (node == NULL) {
-        return NULL;
+    for (i = prefix; i < len; i++) {
+        if (ngx_http_location_key(first[i]) != ngx_http_location_key(last[i]))
+        {
+            break;
+        }
     }
 
-    node->left = NULL;
-    node->right = NULL;
-    node->tree = NULL;
-    node->exact = lq->exact;
-    node->inclusive = lq->inclusive;
+    len = i - prefix;
 
-    node->auto_redirect = (u_char) ((lq->exact && lq->exact->auto_redirect)
-                           || (lq->inclusive && lq->inclusive->auto_redirect));
+    if (lqs[0]->name->len == i) {
+        lq = lqs[0];
+        j = 1;
 
-    node->len = (u_short) len;
-    ngx_memcpy(node->name, &lq->name->data[prefix], len);
+    } else {
+        lq = NULL;
+        j = 0;
+    }
 
-    ngx_queue_split(locations, q, &tail);
+    nchildren = 0;
 
-    if (ngx_queue_empty(locations)) {
-        /*
-         * ngx_queue_split() insures that if left part is empty,
-         * then right one is empty too
-         */
-        goto inclusive;
+    for (k = j; k < n; nchildren++) {
+        key = ngx_http_location_key(lqs[k]->name->data[i]);
+
+        do {
+            k++;
+        } while (k < n && ngx_http_location_key(lqs[k]->name->data[i]) == key);
     }
 
-    node->left = ngx_http_create_locations_tree(cf, locations, prefix);
-    if (node->left == NULL) {
+    node = ngx_palloc(cf->cycle->arena,
+                      offsetof(ngx_http_location_tree_node_t, name)
+                      + len + nchildren);
+    if (node == NULL) {
         return NULL;
     }
 
-    ngx_queue_remove(q);
+    node->children = NULL;
+    node->index = NULL;
 
-    if (ngx_queue_empty(&tail)) {
-        goto inclusive;
-    }
+    if (lq) {
+        node->exact = lq->exact;
+        node->inclusive = lq->inclusive;
 
-    node->right = ngx_http_create_locations_tree(cf, &tail, prefix);
-    if (node->right == NULL) {
-        return NULL;
+        node->auto_redirect = (u_char)
+                              ((lq->exact && lq->exact->auto_redirect)
+                               || (lq->inclusive
+                                   && lq->inclusive->auto_redirect));
+
+    } else {
+        node->exact = NULL;
+        node->inclusive = NULL;
+        node->auto_redirect = 0;
     }
 
-inclusive:
+    node->len = (u_short) len;
+    node->nchildren = (u_short) nchildren;
+    ngx_memcpy(node->name, &first[prefix], len);
 
-    if (ngx_queue_empty(&lq->list)) {
+    if (nchildren == 0) {
         return node;
     }
 
-    node->tree = ngx_http_create_locations_tree(cf, &lq->list, prefix + len);
-    if (node->tree == NULL) {
+    node->children = ngx_palloc(cf->cycle->arena, nchildren
+                                * sizeof(ngx_http_location_tree_node_t *));
+    if (node->children == NULL) {
         return NULL;
     }
 
+    if (nchildren > NGX_HTTP_LOCATION_TREE_KEYS) {
+        node->index = ngx_pcalloc(cf->cycle->arena, 256);
+        if (node->index == NULL) {
+            return NULL;
+        }
+    }
+
+    for (nchildren = 0; j < n; nchildren++) {
+        key = ngx_http_location_key(lqs[j]->name->data[i]);
+
+        for (k = j + 1; k < n; k++) {
+            if (ngx_http_location_key(lqs[k]->name->data[i]) != key) {
+                break;
+            }
+        }
+
+        child = ngx_http_create_locations_tree(cf, &lqs[j], k - j, i);
+        if (child == NULL) {
+            return NULL;
+        }
+
+        node->name[len + nchildren] = key;
+        node->children[nchildren] = child;
+
+        if (node->index) {
+            node->index[key] = (u_char) nchildren;
+        }
+
+        j = k;
+    }
+
     return node;
 }
 
@@ -1601,7 +1661,7 @@ ngx_http_server_names(ngx_conf_t *cf, ngx_http_core_main_conf_t *cmcf,
     hash.max_size = cmcf->server_names_hash_max_size;
     hash.bucket_size = cmcf->server_names_hash_bucket_size;
     hash.name = "server_names_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
 
     if (ha.keys.nelts) {
         hash.hash = &addr->hash;
@@ -1825,6 +1885,15 @@ ngx_http_add_listening(ngx_conf_t *cf, ngx_http_conf_addr_t *addr)
     cscf = addr->default_server;
     ls->pool_size = cscf->connection_pool_size;
 
+    if (cscf->connection_pool_auto) {
+        ls->pool_adapt = ngx_pcalloc(cf->pool, sizeof(ngx_pool_adapt_t));
+        if (ls->pool_adapt == NULL) {
+            return NULL;
+        }
+
+        ls->pool_adapt->size = ls->pool_size;
+    }
+
     clcf = cscf->ctx->loc_conf[ngx_http_core_module.ctx_index];
 
     ls->logp = clcf->error_log;
@@ -1880,6 +1949,14 @@ ngx_http_add_listening(ngx_conf_t *cf, ngx_http_conf_addr_t *addr)
     ls->reuseport = addr->opt.reuseport;
 #endif
 
+#if (NGX_HAVE_REUSEPORT_EBPF)
+    ls->reuseport_cpu = addr->opt.reuseport_cpu;
+#endif
+
+#if (NGX_HAVE_UDP_GRO)
+    ls->udp_gro = addr->opt.udp_gro;
+#endif
+
     ls->wildcard = addr->opt.wildcard;
 
 #if (NGX_HTTP_V3)
@@ -2121,7 +2198,7 @@ ngx_http_merge_types(ngx_conf_t *cf, ngx_array_t **keys, ngx_hash_t *types_hash,
         hash.max_size = 2048;
         hash.bucket_size = 64;
         hash.name = "test_types_hash";
-        hash.pool = cf->pool;
+        hash.pool = cf->cycle->arena;
         hash.temp_pool = NULL;
 
         if (ngx_hash_init(&hash, (*keys)->elts, (*keys)->nelts) != NGX_OK) {
@@ -2151,7 +2228,7 @@ ngx_http_merge_types(ngx_conf_t *cf, ngx_array_t **keys, ngx_hash_t *types_hash,
         hash.max_size = 2048;
         hash.bucket_size = 64;
         hash.name = "test_types_hash";
-        hash.pool = cf->pool;
+        hash.pool = cf->cycle->arena;
         hash.temp_pool = NULL;
 
         if (ngx_hash_init(&hash, (*prev_keys)->elts, (*prev_keys)->nelts)
@@ -127,6 +127,13 @@ ngx_http_copy_filter(ngx_http_request_t *r, ngx_chain_t *in)
         }
 #endif
 
+#if (NGX_HAVE_FILE_URING)
+        if (ngx_file_uring && clcf->aio == NGX_HTTP_AIO_URING) {
+            ctx->aio_handler = ngx_http_copy_aio_handler;
+            ctx->aio_uring = 1;
+        }
+#endif
+
 #if (NGX_THREADS)
         if (clcf->aio == NGX_HTTP_AIO_THREADS) {
             ctx->thread_handler = ngx_http_copy_thread_handler;
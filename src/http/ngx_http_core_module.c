@@ -89,6 +89,8 @@ static char *ngx_http_disable_symlinks(ngx_conf_t *cf, ngx_command_t *cmd,
 #endif
 
 static char *ngx_http_core_lowat_check(ngx_conf_t *cf, void *post, void *data);
+static char *ngx_http_core_set_pool_size(ngx_conf_t *cf, ngx_command_t *cmd,
+    void *conf);
 static char *ngx_http_core_pool_size(ngx_conf_t *cf, void *post, void *data);
 
 static ngx_conf_post_t  ngx_http_core_lowat_post =
@@ -219,14 +221,14 @@ static ngx_command_t  ngx_http_core_commands[] = {
 
     { ngx_string("connection_pool_size"),
       NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_CONF_TAKE1,
-      ngx_conf_set_size_slot,
+      ngx_http_core_set_pool_size,
       NGX_HTTP_SRV_CONF_OFFSET,
       offsetof(ngx_http_core_srv_conf_t, connection_pool_size),
       &ngx_http_core_pool_size_p },
 
     { ngx_string("request_pool_size"),
       NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_CONF_TAKE1,
-      ngx_conf_set_size_slot,
+      ngx_http_core_set_pool_size,
       NGX_HTTP_SRV_CONF_OFFSET,
       offsetof(ngx_http_core_srv_conf_t, request_pool_size),
       &ngx_http_core_pool_size_p },
@@ -402,6 +404,21 @@ static ngx_command_t  ngx_http_core_commands[] = {
       offsetof(ngx_http_core_loc_conf_t, sendfile_max_chunk),
       NULL },
 
+    { ngx_string("sendzerocopy"),
+      NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_HTTP_LIF_CONF
+                        |NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      NGX_HTTP_LOC_CONF_OFFSET,
+      offsetof(ngx_http_core_loc_conf_t, sendzerocopy),
+      NULL },
+
+    { ngx_string("sendzerocopy_threshold"),
+      NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_TAKE1,
+      ngx_conf_set_size_slot,
+      NGX_HTTP_LOC_CONF_OFFSET,
+      offsetof(ngx_http_core_loc_conf_t, sendzerocopy_threshold),
+      NULL },
+
     { ngx_string("subrequest_output_buffer_size"),
       NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_TAKE1,
       ngx_conf_set_size_slot,
@@ -523,6 +540,13 @@ static ngx_command_t  ngx_http_core_commands[] = {
       offsetof(ngx_http_core_loc_conf_t, keepalive_disable),
       &ngx_http_core_keepalive_disable },
 
+    { ngx_string("keepalive_compact"),
+      NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      NGX_HTTP_LOC_CONF_OFFSET,
+      offsetof(ngx_http_core_loc_conf_t, keepalive_compact),
+      NULL },
+
     { ngx_string("satisfy"),
       NGX_HTTP_MAIN_CONF|NGX_HTTP_SRV_CONF|NGX_HTTP_LOC_CONF|NGX_CONF_TAKE1,
       ngx_conf_set_enum_slot,
@@ -1324,6 +1348,16 @@ ngx_http_update_location_config(ngx_http_request_t *r)
         r->connection->sendfile = 0;
     }
 
+    if (ngx_io.zerocopy && r->connection->send_chain == ngx_io.send_chain) {
+        if (ngx_io.zerocopy(r->connection, r->pool,
+                            clcf->sendzerocopy
+                            ? clcf->sendzerocopy_threshold : 0)
+            != NGX_OK)
+        {
+            r->connection->error = 1;
+        }
+    }
+
     if (clcf->client_body_in_file_only) {
         r->request_body_in_file_only = 1;
         r->request_body_in_persistent_file = 1;
@@ -1400,7 +1434,7 @@ ngx_http_core_find_location(ngx_http_request_t *r)
 #if (NGX_PCRE)
     ngx_int_t                  n;
     ngx_uint_t                 noregex;
-    ngx_http_core_loc_conf_t  *clcf, **clcfp;
+    ngx_http_core_loc_conf_t  *clcf;
 
     noregex = 0;
 #endif
@@ -1432,27 +1466,19 @@ ngx_http_core_find_location(ngx_http_request_t *r)
 
     if (noregex == 0 && pclcf->regex_locations) {
 
-        for (clcfp = pclcf->regex_locations; *clcfp; clcfp++) {
+        n = ngx_http_regex_set_exec(r, pclcf->regex_set, &r->uri);
 
-            ngx_log_debug1(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
-                           "test location: ~ \"%V\"", &(*clcfp)->name);
-
-            n = ngx_http_regex_exec(r, (*clcfp)->regex, &r->uri);
-
-            if (n == NGX_OK) {
-                r->loc_conf = (*clcfp)->loc_conf;
-
-                /* look up nested locations */
+        if (n >= 0) {
+            r->loc_conf = pclcf->regex_locations[n]->loc_conf;
 
-                rc = ngx_http_core_find_location(r);
+            /* look up nested locations */
 
-                return (rc == NGX_ERROR) ? rc : NGX_OK;
-            }
+            rc = ngx_http_core_find_location(r);
 
-            if (n == NGX_DECLINED) {
-                continue;
-            }
+            return (rc == NGX_ERROR) ? rc : NGX_OK;
+        }
 
+        if (n == NGX_ERROR) {
             return NGX_ERROR;
         }
     }
@@ -1473,78 +1499,107 @@ static ngx_int_t
 ngx_http_core_find_static_location(ngx_http_request_t *r,
     ngx_http_location_tree_node_t *node)
 {
-    u_char     *uri;
-    size_t      len, n;
-    ngx_int_t   rc, rv;
+    u_char                         *uri, *keys, key;
+    size_t                          len, n;
+    ngx_int_t                       rv;
+    ngx_uint_t                      i;
+    ngx_http_location_tree_node_t  *child;
 
     len = r->uri.len;
     uri = r->uri.data;
 
     rv = NGX_DECLINED;
 
-    for ( ;; ) {
+    if (node == NULL) {
+        return rv;
+    }
 
-        if (node == NULL) {
-            return rv;
-        }
+    for ( ;; ) {
 
         ngx_log_debug2(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
                        "test location: \"%*s\"",
                        (size_t) node->len, node->name);
 
-        n = (len <= (size_t) node->len) ? len : node->len;
+        n = node->len;
 
-        rc = ngx_filename_cmp(uri, node->name, n);
+        if (len < n) {
 
-        if (rc != 0) {
-            node = (rc < 0) ? node->left : node->right;
+            if (len + 1 == n
+                && node->auto_redirect
+                && ngx_http_location_cmp(uri, node->name, len) == 0)
+            {
+                r->loc_conf = (node->exact) ? node->exact->loc_conf:
+                                              node->inclusive->loc_conf;
+                return NGX_DONE;
+            }
 
-            continue;
+            return rv;
         }
 
-        if (len > (size_t) node->len) {
+        if (ngx_http_location_cmp(uri, node->name, n) != 0) {
+            return rv;
+        }
 
-            if (node->inclusive) {
+        uri += n;
+        len -= n;
+
+        if (len == 0) {
 
+            if (node->exact) {
+                r->loc_conf = node->exact->loc_conf;
+                return NGX_OK;
+            }
+
+            if (node->inclusive) {
                 r->loc_conf = node->inclusive->loc_conf;
-                rv = NGX_AGAIN;
+                return NGX_AGAIN;
+            }
 
-                node = node->tree;
-                uri += n;
-                len -= n;
+            for (i = 0; i < node->nchildren; i++) {
+                child = node->children[i];
 
-                continue;
+                if (child->len == 1 && child->auto_redirect) {
+                    r->loc_conf = (child->exact) ? child->exact->loc_conf:
+                                                   child->inclusive->loc_conf;
+                    return NGX_DONE;
+                }
             }
 
-            /* exact only */
+            return rv;
+        }
 
-            node = node->right;
+        if (node->inclusive) {
+            r->loc_conf = node->inclusive->loc_conf;
+            rv = NGX_AGAIN;
+        }
 
-            continue;
+        if (node->nchildren == 0) {
+            return rv;
         }
 
-        if (len == (size_t) node->len) {
+        keys = node->name + n;
+        key = ngx_http_location_key(*uri);
 
-            if (node->exact) {
-                r->loc_conf = node->exact->loc_conf;
-                return NGX_OK;
+        if (node->index) {
+            i = node->index[key];
 
-            } else {
-                r->loc_conf = node->inclusive->loc_conf;
-                return NGX_AGAIN;
+            if (keys[i] != key) {
+                return rv;
             }
-        }
-
-        /* len < node->len */
 
-        if (len + 1 == (size_t) node->len && node->auto_redirect) {
+        } else {
+            for (i = 0; i < node->nchildren; i++) {
+                if (keys[i] == key) {
+                    break;
+                }
+            }
 
-            r->loc_conf = (node->exact) ? node->exact->loc_conf:
-                                          node->inclusive->loc_conf;
-            rv = NGX_DONE;
+            if (i == node->nchildren) {
+                return rv;
+            }
         }
 
-        node = node->left;
+        node = node->children[i];
     }
 }
 
@@ -3486,6 +3541,25 @@ ngx_http_core_merge_srv_conf(ngx_conf_t *cf, void *parent, void *child)
                               prev->connection_pool_size, 64 * sizeof(void *));
     ngx_conf_merge_size_value(conf->request_pool_size,
                               prev->request_pool_size, 4096);
+
+    /* "auto" is stored as 0, the initial size is the default one */
+
+    if (conf->connection_pool_size == 0) {
+        conf->connection_pool_auto = 1;
+        conf->connection_pool_size = 64 * sizeof(void *);
+    }
+
+    if (conf->request_pool_size == 0) {
+        conf->request_pool_size = 4096;
+
+        conf->request_pool_adapt = ngx_pcalloc(cf->pool,
+                                               sizeof(ngx_pool_adapt_t));
+        if (conf->request_pool_adapt == NULL) {
+            return NGX_CONF_ERROR;
+        }
+
+        conf->request_pool_adapt->size = conf->request_pool_size;
+    }
     ngx_conf_merge_msec_value(conf->client_header_timeout,
                               prev->client_header_timeout, 60000);
     ngx_conf_merge_size_value(conf->client_header_buffer_size,
@@ -3586,6 +3660,8 @@ ngx_http_core_create_loc_conf(ngx_conf_t *cf)
     clcf->internal = NGX_CONF_UNSET;
     clcf->sendfile = NGX_CONF_UNSET;
     clcf->sendfile_max_chunk = NGX_CONF_UNSET_SIZE;
+    clcf->sendzerocopy = NGX_CONF_UNSET;
+    clcf->sendzerocopy_threshold = NGX_CONF_UNSET_SIZE;
     clcf->subrequest_output_buffer_size = NGX_CONF_UNSET_SIZE;
     clcf->aio = NGX_CONF_UNSET;
     clcf->aio_write = NGX_CONF_UNSET;
@@ -3598,6 +3674,7 @@ ngx_http_core_create_loc_conf(ngx_conf_t *cf)
     clcf->directio_alignment = NGX_CONF_UNSET;
     clcf->tcp_nopush = NGX_CONF_UNSET;
     clcf->tcp_nodelay = NGX_CONF_UNSET;
+    clcf->keepalive_compact = NGX_CONF_UNSET;
     clcf->send_timeout = NGX_CONF_UNSET_MSEC;
     clcf->send_lowat = NGX_CONF_UNSET_SIZE;
     clcf->postpone_output = NGX_CONF_UNSET_SIZE;
@@ -3716,7 +3793,7 @@ ngx_http_core_merge_loc_conf(ngx_conf_t *cf, void *parent, void *child)
         types_hash.max_size = conf->types_hash_max_size;
         types_hash.bucket_size = conf->types_hash_bucket_size;
         types_hash.name = "types_hash";
-        types_hash.pool = cf->pool;
+        types_hash.pool = cf->cycle->arena;
         types_hash.temp_pool = NULL;
 
         if (ngx_hash_init(&types_hash, prev->types->elts, prev->types->nelts)
@@ -3758,7 +3835,7 @@ ngx_http_core_merge_loc_conf(ngx_conf_t *cf, void *parent, void *child)
         types_hash.max_size = conf->types_hash_max_size;
         types_hash.bucket_size = conf->types_hash_bucket_size;
         types_hash.name = "types_hash";
-        types_hash.pool = cf->pool;
+        types_hash.pool = cf->cycle->arena;
         types_hash.temp_pool = NULL;
 
         if (ngx_hash_init(&types_hash, conf->types->elts, conf->types->nelts)
@@ -3811,6 +3888,9 @@ ngx_http_core_merge_loc_conf(ngx_conf_t *cf, void *parent, void *child)
     ngx_conf_merge_value(conf->sendfile, prev->sendfile, 0);
     ngx_conf_merge_size_value(conf->sendfile_max_chunk,
                               prev->sendfile_max_chunk, 2 * 1024 * 1024);
+    ngx_conf_merge_value(conf->sendzerocopy, prev->sendzerocopy, 0);
+    ngx_conf_merge_size_value(conf->sendzerocopy_threshold,
+                              prev->sendzerocopy_threshold, 16384);
     ngx_conf_merge_size_value(conf->subrequest_output_buffer_size,
                               prev->subrequest_output_buffer_size,
                               (size_t) ngx_pagesize);
@@ -3828,6 +3908,7 @@ ngx_http_core_merge_loc_conf(ngx_conf_t *cf, void *parent, void *child)
                               512);
     ngx_conf_merge_value(conf->tcp_nopush, prev->tcp_nopush, 0);
     ngx_conf_merge_value(conf->tcp_nodelay, prev->tcp_nodelay, 1);
+    ngx_conf_merge_value(conf->keepalive_compact, prev->keepalive_compact, 0);
 
     ngx_conf_merge_msec_value(conf->send_timeout, prev->send_timeout, 60000);
     ngx_conf_merge_size_value(conf->send_lowat, prev->send_lowat, 0);
@@ -4166,6 +4247,33 @@ ngx_http_core_listen(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
             continue;
         }
 
+        if (ngx_strcmp(value[n].data, "reuseport=cpu") == 0) {
+#if (NGX_HAVE_REUSEPORT_EBPF)
+            lsopt.reuseport = 1;
+            lsopt.reuseport_cpu = 1;
+            lsopt.set = 1;
+            lsopt.bind = 1;
+#else
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "reuseport=cpu is not supported "
+                               "on this platform, ignored");
+#endif
+            continue;
+        }
+
+        if (ngx_strcmp(value[n].data, "udp_gro") == 0) {
+#if (NGX_HAVE_UDP_GRO)
+            lsopt.udp_gro = 1;
+            lsopt.set = 1;
+            lsopt.bind = 1;
+#else
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "udp_gro is not supported "
+                               "on this platform, ignored");
+#endif
+            continue;
+        }
+
         if (ngx_strcmp(value[n].data, "ssl") == 0) {
 #if (NGX_HTTP_SSL)
             lsopt.ssl = 1;
@@ -4351,6 +4459,9 @@ ngx_http_core_listen(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
         if (lsopt.proxy_protocol) {
             return "\"proxy_protocol\" parameter is incompatible with \"quic\"";
         }
+
+    } else if (lsopt.udp_gro) {
+        return "\"udp_gro\" parameter requires \"quic\"";
     }
 
     for (n = 0; n < u.naddrs; n++) {
@@ -4738,6 +4849,18 @@ ngx_http_core_set_aio(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 #endif
     }
 
+    if (ngx_strcmp(value[1].data, "uring") == 0) {
+#if (NGX_HAVE_FILE_URING)
+        clcf->aio = NGX_HTTP_AIO_URING;
+        return NGX_CONF_OK;
+#else
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                           "\"aio uring\" "
+                           "is unsupported on this platform");
+        return NGX_CONF_ERROR;
+#endif
+    }
+
     if (ngx_strncmp(value[1].data, "threads", 7) == 0
         && (value[1].len == 7 || value[1].data[7] == '='))
     {
@@ -5328,6 +5451,37 @@ ngx_http_core_lowat_check(ngx_conf_t *cf, void *post, void *data)
 }
 
 
+static char *
+ngx_http_core_set_pool_size(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    char  *p = conf;
+
+    size_t     *sp;
+    ngx_str_t  *value;
+
+    value = cf->args->elts;
+
+    if (ngx_strcmp(value[1].data, "auto") != 0) {
+        return ngx_conf_set_size_slot(cf, cmd, conf);
+    }
+
+    sp = (size_t *) (p + cmd->offset);
+
+    if (*sp != NGX_CONF_UNSET_SIZE) {
+        return "is duplicate";
+    }
+
+    /*
+     * "auto" is stored as 0, which is not a valid size; the sizes
+     * set by ngx_pool_adapt() pass the ngx_http_core_pool_size() checks
+     */
+
+    *sp = 0;
+
+    return NGX_CONF_OK;
+}
+
+
 static char *
 ngx_http_core_pool_size(ngx_conf_t *cf, void *post, void *data)
 {
@@ -34,6 +34,7 @@ typedef struct ngx_thread_pool_s  ngx_thread_pool_t;
 #define NGX_HTTP_AIO_OFF                0
 #define NGX_HTTP_AIO_ON                 1
 #define NGX_HTTP_AIO_THREADS            2
+#define NGX_HTTP_AIO_URING              3
 
 
 #define NGX_HTTP_SATISFY_ALL            0
@@ -81,8 +82,10 @@ typedef struct {
 #endif
     unsigned                   deferred_accept:1;
     unsigned                   reuseport:1;
+    unsigned                   reuseport_cpu:1;
     unsigned                   so_keepalive:2;
     unsigned                   proxy_protocol:1;
+    unsigned                   udp_gro:1;
 
     int                        backlog;
     int                        rcvbuf;
@@ -196,6 +199,11 @@ typedef struct {
 
     ngx_bufs_t                  large_client_header_buffers;
 
+    ngx_flag_t                  connection_pool_auto;
+
+    /* the sizes of "auto" request pools, updated by each worker */
+    ngx_pool_adapt_t           *request_pool_adapt;
+
     ngx_msec_t                  client_header_timeout;
 
     ngx_flag_t                  ignore_invalid_headers;
@@ -329,6 +337,7 @@ struct ngx_http_core_loc_conf_s {
     ngx_http_location_tree_node_t   *static_locations;
 #if (NGX_PCRE)
     ngx_http_core_loc_conf_t       **regex_locations;
+    ngx_http_regex_set_t            *regex_set;
 #endif
 
     /* pointer to the modules' loc_conf */
@@ -359,6 +368,7 @@ struct ngx_http_core_loc_conf_s {
     size_t        send_lowat;              /* send_lowat */
     size_t        postpone_output;         /* postpone_output */
     size_t        sendfile_max_chunk;      /* sendfile_max_chunk */
+    size_t        sendzerocopy_threshold;  /* sendzerocopy_threshold */
     size_t        read_ahead;              /* read_ahead */
     size_t        subrequest_output_buffer_size;
                                            /* subrequest_output_buffer_size */
@@ -391,10 +401,12 @@ struct ngx_http_core_loc_conf_s {
                                            /* client_body_in_singe_buffer */
     ngx_flag_t    internal;                /* internal */
     ngx_flag_t    sendfile;                /* sendfile */
+    ngx_flag_t    sendzerocopy;            /* sendzerocopy */
     ngx_flag_t    aio;                     /* aio */
     ngx_flag_t    aio_write;               /* aio_write */
     ngx_flag_t    tcp_nopush;              /* tcp_nopush */
     ngx_flag_t    tcp_nodelay;             /* tcp_nodelay */
+    ngx_flag_t    keepalive_compact;       /* keepalive_compact */
     ngx_flag_t    reset_timedout_connection; /* reset_timedout_connection */
     ngx_flag_t    absolute_redirect;       /* absolute_redirect */
     ngx_flag_t    server_name_in_redirect; /* server_name_in_redirect */
@@ -459,20 +471,32 @@ typedef struct {
     ngx_str_t                       *name;
     u_char                          *file_name;
     ngx_uint_t                       line;
-    ngx_queue_t                      list;
 } ngx_http_location_queue_t;
 
 
+#define NGX_HTTP_LOCATION_TREE_KEYS  16
+
+#if (NGX_HAVE_CASELESS_FILESYSTEM)
+#define ngx_http_location_key(c)          (u_char) tolower(c)
+#define ngx_http_location_cmp(s1, s2, n)  ngx_filename_cmp(s1, s2, n)
+#else
+#define ngx_http_location_key(c)          (c)
+#define ngx_http_location_cmp(s1, s2, n)  ngx_memcmp(s1, s2, n)
+#endif
+
+
 struct ngx_http_location_tree_node_s {
-    ngx_http_location_tree_node_t   *left;
-    ngx_http_location_tree_node_t   *right;
-    ngx_http_location_tree_node_t   *tree;
+    ngx_http_location_tree_node_t  **children;
+    u_char                          *index;
 
     ngx_http_core_loc_conf_t        *exact;
     ngx_http_core_loc_conf_t        *inclusive;
 
     u_short                          len;
+    u_short                          nchildren;
     u_char                           auto_redirect;
+
+    /* the name part followed by the first bytes of the children */
     u_char                           name[1];
 };
 
@@ -11,6 +11,9 @@
 #include <ngx_md5.h>
 
 
+static ngx_int_t ngx_http_file_cache_migrate(ngx_shm_zone_t *shm_zone,
+    void *data);
+static void ngx_http_file_cache_move(ngx_shm_zone_t *shm_zone, void *p);
 static ngx_int_t ngx_http_file_cache_lock(ngx_http_request_t *r,
     ngx_http_cache_t *c);
 static void ngx_http_file_cache_lock_wait_handler(ngx_event_t *ev);
@@ -172,6 +175,108 @@ ngx_http_file_cache_init(ngx_shm_zone_t *shm_zone, void *data)
 }
 
 
+/*
+ * Nodes are copied from the most recently used ones, so if a smaller zone
+ * cannot hold all of them, the least recently used are left to the cache
+ * loader.  Nodes still used by the old worker processes are copied unused.
+ * The zone is left cold: old worker processes keep adding files to the old
+ * zone until they exit, and the cache loader picks them up.
+ */
+
+static ngx_int_t
+ngx_http_file_cache_migrate(ngx_shm_zone_t *shm_zone, void *data)
+{
+    ngx_http_file_cache_t  *ocache = data;
+
+    ngx_uint_t                   n;
+    ngx_queue_t                 *q;
+    ngx_http_file_cache_t       *cache;
+    ngx_http_file_cache_node_t  *fcn, *ofcn;
+
+    cache = shm_zone->data;
+
+    if (ngx_strcmp(cache->path->name.data, ocache->path->name.data) != 0) {
+        return NGX_OK;
+    }
+
+    for (n = 0; n < NGX_MAX_PATH_LEVEL; n++) {
+        if (cache->path->level[n] != ocache->path->level[n]) {
+            return NGX_OK;
+        }
+    }
+
+    for (q = ngx_queue_head(&ocache->sh->queue);
+         q != ngx_queue_sentinel(&ocache->sh->queue);
+         q = ngx_queue_next(q))
+    {
+        ofcn = ngx_queue_data(q, ngx_http_file_cache_node_t, queue);
+
+        if (ofcn->deleting) {
+            continue;
+        }
+
+        fcn = ngx_slab_alloc_locked(cache->shpool,
+                                    sizeof(ngx_http_file_cache_node_t));
+        if (fcn == NULL) {
+            ngx_log_error(NGX_LOG_WARN, shm_zone->shm.log, 0,
+                          "%ui of %ui nodes moved to cache keys zone \"%V\"",
+                          cache->sh->count, ocache->sh->count,
+                          &shm_zone->shm.name);
+            return NGX_OK;
+        }
+
+        ngx_memcpy(fcn, ofcn, sizeof(ngx_http_file_cache_node_t));
+
+        fcn->count = 0;
+        fcn->updating = 0;
+
+        ngx_rbtree_insert(&cache->sh->rbtree, &fcn->node);
+        ngx_queue_insert_tail(&cache->sh->queue, &fcn->queue);
+
+        cache->sh->count++;
+        cache->sh->size += fcn->fs_size;
+    }
+
+    return NGX_OK;
+}
+
+
+/*
+ * Besides the shared header and the log context, the keys zone holds
+ * only nodes.  Nodes referenced by requests or being deleted by the cache
+ * manager are not moved, the zone is locked by the caller.
+ */
+
+static void
+ngx_http_file_cache_move(ngx_shm_zone_t *shm_zone, void *p)
+{
+    ngx_http_file_cache_t       *cache;
+    ngx_http_file_cache_node_t  *fcn, *moved;
+
+    cache = shm_zone->data;
+
+    if (p == cache->sh || p == cache->shpool->log_ctx) {
+        return;
+    }
+
+    fcn = p;
+
+    if (fcn->count || fcn->deleting) {
+        return;
+    }
+
+    moved = ngx_slab_move(cache->shpool, fcn,
+                          sizeof(ngx_http_file_cache_node_t));
+
+    if (moved == fcn) {
+        return;
+    }
+
+    ngx_rbtree_move(&cache->sh->rbtree, &fcn->node, &moved->node);
+    ngx_queue_move(&moved->queue);
+}
+
+
 ngx_int_t
 ngx_http_file_cache_new(ngx_http_request_t *r)
 {
@@ -692,8 +797,22 @@ ngx_http_file_cache_aio_read(ngx_http_request_t *r, ngx_http_cache_t *c)
 
 #if (NGX_HAVE_FILE_AIO)
 
-    if (clcf->aio == NGX_HTTP_AIO_ON && ngx_file_aio) {
-        n = ngx_file_aio_read(&c->file, c->buf->pos, c->body_start, 0, r->pool);
+    if ((clcf->aio == NGX_HTTP_AIO_ON && ngx_file_aio)
+#if (NGX_HAVE_FILE_URING)
+        || (clcf->aio == NGX_HTTP_AIO_URING && ngx_file_uring)
+#endif
+       )
+    {
+#if (NGX_HAVE_FILE_URING)
+        if (clcf->aio == NGX_HTTP_AIO_URING) {
+            n = ngx_file_uring_read(&c->file, c->buf->pos, c->body_start, 0,
+                                    r->pool);
+        } else
+#endif
+        {
+            n = ngx_file_aio_read(&c->file, c->buf->pos, c->body_start, 0,
+                                  r->pool);
+        }
 
         if (n != NGX_AGAIN) {
             c->reading = 0;
@@ -2383,7 +2502,7 @@ ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     off_t                   max_size, min_free;
     u_char                 *last, *p;
     time_t                  inactive;
-    ssize_t                 size;
+    ssize_t                 size, hugepages;
     ngx_str_t               s, name, *value;
     ngx_int_t               loader_files, manager_files;
     ngx_msec_t              loader_sleep, manager_sleep, loader_threshold,
@@ -2416,6 +2535,7 @@ ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 
     name.len = 0;
     size = 0;
+    hugepages = 0;
     max_size = NGX_MAX_OFF_T_VALUE;
     min_free = 0;
 
@@ -2523,6 +2643,22 @@ ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
             continue;
         }
 
+        if (ngx_strncmp(value[i].data, "hugepages=", 10) == 0) {
+
+            s.len = value[i].len - 10;
+            s.data = value[i].data + 10;
+
+            hugepages = ngx_parse_hugepages(&s);
+            if (hugepages == NGX_ERROR) {
+                ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                                   "invalid hugepages value \"%V\"",
+                                   &value[i]);
+                return NGX_CONF_ERROR;
+            }
+
+            continue;
+        }
+
         if (ngx_strncmp(value[i].data, "inactive=", 9) == 0) {
 
             s.len = value[i].len - 9;
@@ -2701,7 +2837,10 @@ ngx_http_file_cache_set_slot(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
 
 
     cache->shm_zone->init = ngx_http_file_cache_init;
+    cache->shm_zone->migrate = ngx_http_file_cache_migrate;
+    cache->shm_zone->move = ngx_http_file_cache_move;
     cache->shm_zone->data = cache;
+    cache->shm_zone->shm.hugepages = hugepages;
 
     cache->use_temp_path = use_temp_path;
 
@@ -20,6 +20,21 @@ typedef struct {
 
 static ngx_inline ngx_int_t ngx_http_huff_decode_bits(u_char *state,
     u_char *ending, ngx_uint_t bits, u_char **dst);
+static ngx_int_t ngx_http_huff_decode_nibbles(u_char *state, u_char *ending,
+    u_char ch, u_char **dst, ngx_log_t *log);
+
+
+/*
+ * the byte transitions are generated from the nibble ones below:
+ * the next state, up to two symbols, their number, and the ending flag
+ */
+
+#define NGX_HTTP_HUFF_NEXT(code)     ((code) & 0xff)
+#define NGX_HTTP_HUFF_SYM1(code)     (((code) >> 8) & 0xff)
+#define NGX_HTTP_HUFF_SYM2(code)     (((code) >> 16) & 0xff)
+#define NGX_HTTP_HUFF_EMIT(code)     (((code) >> 24) & 0x3)
+#define NGX_HTTP_HUFF_ENDING         0x04000000
+#define NGX_HTTP_HUFF_ERROR          0x08000000
 
 
 static ngx_http_huff_decode_code_t  ngx_http_huff_decode_codes[256][16] =
@@ -2639,41 +2654,11836 @@ static ngx_http_huff_decode_code_t  ngx_http_huff_decode_codes[256][16] =
 };
 
 
+static const uint32_t  ngx_http_huff_decode_bytes[256][256] =
+{
+    /* 0 */
+    {
+        0x01003003, 0x01003006, 0x0100300a, 0x0100300f, 0x01003018, 0x0100301f,
+        0x01003029, 0x05003038, 0x01003103, 0x01003106, 0x0100310a, 0x0100310f,
+        0x01003118, 0x0100311f, 0x01003129, 0x05003138, 0x01003203, 0x01003206,
+        0x0100320a, 0x0100320f, 0x01003218, 0x0100321f, 0x01003229, 0x05003238,
+        0x01006103, 0x01006106, 0x0100610a, 0x0100610f, 0x01006118, 0x0100611f,
+        0x01006129, 0x05006138, 0x01006303, 0x01006306, 0x0100630a, 0x0100630f,
+        0x01006318, 0x0100631f, 0x01006329, 0x05006338, 0x01006503, 0x01006506,
+        0x0100650a, 0x0100650f, 0x01006518, 0x0100651f, 0x01006529, 0x05006538,
+        0x01006903, 0x01006906, 0x0100690a, 0x0100690f, 0x01006918, 0x0100691f,
+        0x01006929, 0x05006938, 0x01006f03, 0x01006f06, 0x01006f0a, 0x01006f0f,
+        0x01006f18, 0x01006f1f, 0x01006f29, 0x05006f38, 0x01007303, 0x01007306,
+        0x0100730a, 0x0100730f, 0x01007318, 0x0100731f, 0x01007329, 0x05007338,
+        0x01007403, 0x01007406, 0x0100740a, 0x0100740f, 0x01007418, 0x0100741f,
+        0x01007429, 0x05007438, 0x01002002, 0x01002009, 0x01002017, 0x05002028,
+        0x01002502, 0x01002509, 0x01002517, 0x05002528, 0x01002d02, 0x01002d09,
+        0x01002d17, 0x05002d28, 0x01002e02, 0x01002e09, 0x01002e17, 0x05002e28,
+        0x01002f02, 0x01002f09, 0x01002f17, 0x05002f28, 0x01003302, 0x01003309,
+        0x01003317, 0x05003328, 0x01003402, 0x01003409, 0x01003417, 0x05003428,
+        0x01003502, 0x01003509, 0x01003517, 0x05003528, 0x01003602, 0x01003609,
+        0x01003617, 0x05003628, 0x01003702, 0x01003709, 0x01003717, 0x05003728,
+        0x01003802, 0x01003809, 0x01003817, 0x05003828, 0x01003902, 0x01003909,
+        0x01003917, 0x05003928, 0x01003d02, 0x01003d09, 0x01003d17, 0x05003d28,
+        0x01004102, 0x01004109, 0x01004117, 0x05004128, 0x01005f02, 0x01005f09,
+        0x01005f17, 0x05005f28, 0x01006202, 0x01006209, 0x01006217, 0x05006228,
+        0x01006402, 0x01006409, 0x01006417, 0x05006428, 0x01006602, 0x01006609,
+        0x01006617, 0x05006628, 0x01006702, 0x01006709, 0x01006717, 0x05006728,
+        0x01006802, 0x01006809, 0x01006817, 0x05006828, 0x01006c02, 0x01006c09,
+        0x01006c17, 0x05006c28, 0x01006d02, 0x01006d09, 0x01006d17, 0x05006d28,
+        0x01006e02, 0x01006e09, 0x01006e17, 0x05006e28, 0x01007002, 0x01007009,
+        0x01007017, 0x05007028, 0x01007202, 0x01007209, 0x01007217, 0x05007228,
+        0x01007502, 0x01007509, 0x01007517, 0x05007528, 0x01003a01, 0x05003a16,
+        0x01004201, 0x05004216, 0x01004301, 0x05004316, 0x01004401, 0x05004416,
+        0x01004501, 0x05004516, 0x01004601, 0x05004616, 0x01004701, 0x05004716,
+        0x01004801, 0x05004816, 0x01004901, 0x05004916, 0x01004a01, 0x05004a16,
+        0x01004b01, 0x05004b16, 0x01004c01, 0x05004c16, 0x01004d01, 0x05004d16,
+        0x01004e01, 0x05004e16, 0x01004f01, 0x05004f16, 0x01005001, 0x05005016,
+        0x01005101, 0x05005116, 0x01005201, 0x05005216, 0x01005301, 0x05005316,
+        0x01005401, 0x05005416, 0x01005501, 0x05005516, 0x01005601, 0x05005616,
+        0x01005701, 0x05005716, 0x01005901, 0x05005916, 0x01006a01, 0x05006a16,
+        0x01006b01, 0x05006b16, 0x01007101, 0x05007116, 0x01007601, 0x05007616,
+        0x01007701, 0x05007716, 0x01007801, 0x05007816, 0x01007901, 0x05007916,
+        0x01007a01, 0x05007a16, 0x05002600, 0x05002a00, 0x05002c00, 0x05003b00,
+        0x05005800, 0x05005a00, 0x0000004b, 0x0400004e
+    },
+    /* 1 */
+    {
+        0x01003004, 0x01003005, 0x01003007, 0x01003008, 0x0100300b, 0x0100300c,
+        0x01003010, 0x01003013, 0x01003019, 0x0100301c, 0x01003020, 0x01003023,
+        0x0100302a, 0x01003031, 0x01003039, 0x05003040, 0x01003104, 0x01003105,
+        0x01003107, 0x01003108, 0x0100310b, 0x0100310c, 0x01003110, 0x01003113,
+        0x01003119, 0x0100311c, 0x01003120, 0x01003123, 0x0100312a, 0x01003131,
+        0x01003139, 0x05003140, 0x01003204, 0x01003205, 0x01003207, 0x01003208,
+        0x0100320b, 0x0100320c, 0x01003210, 0x01003213, 0x01003219, 0x0100321c,
+        0x01003220, 0x01003223, 0x0100322a, 0x01003231, 0x01003239, 0x05003240,
+        0x01006104, 0x01006105, 0x01006107, 0x01006108, 0x0100610b, 0x0100610c,
+        0x01006110, 0x01006113, 0x01006119, 0x0100611c, 0x01006120, 0x01006123,
+        0x0100612a, 0x01006131, 0x01006139, 0x05006140, 0x01006304, 0x01006305,
+        0x01006307, 0x01006308, 0x0100630b, 0x0100630c, 0x01006310, 0x01006313,
+        0x01006319, 0x0100631c, 0x01006320, 0x01006323, 0x0100632a, 0x01006331,
+        0x01006339, 0x05006340, 0x01006504, 0x01006505, 0x01006507, 0x01006508,
+        0x0100650b, 0x0100650c, 0x01006510, 0x01006513, 0x01006519, 0x0100651c,
+        0x01006520, 0x01006523, 0x0100652a, 0x01006531, 0x01006539, 0x05006540,
+        0x01006904, 0x01006905, 0x01006907, 0x01006908, 0x0100690b, 0x0100690c,
+        0x01006910, 0x01006913, 0x01006919, 0x0100691c, 0x01006920, 0x01006923,
+        0x0100692a, 0x01006931, 0x01006939, 0x05006940, 0x01006f04, 0x01006f05,
+        0x01006f07, 0x01006f08, 0x01006f0b, 0x01006f0c, 0x01006f10, 0x01006f13,
+        0x01006f19, 0x01006f1c, 0x01006f20, 0x01006f23, 0x01006f2a, 0x01006f31,
+        0x01006f39, 0x05006f40, 0x01007304, 0x01007305, 0x01007307, 0x01007308,
+        0x0100730b, 0x0100730c, 0x01007310, 0x01007313, 0x01007319, 0x0100731c,
+        0x01007320, 0x01007323, 0x0100732a, 0x01007331, 0x01007339, 0x05007340,
+        0x01007404, 0x01007405, 0x01007407, 0x01007408, 0x0100740b, 0x0100740c,
+        0x01007410, 0x01007413, 0x01007419, 0x0100741c, 0x01007420, 0x01007423,
+        0x0100742a, 0x01007431, 0x01007439, 0x05007440, 0x01002003, 0x01002006,
+        0x0100200a, 0x0100200f, 0x01002018, 0x0100201f, 0x01002029, 0x05002038,
+        0x01002503, 0x01002506, 0x0100250a, 0x0100250f, 0x01002518, 0x0100251f,
+        0x01002529, 0x05002538, 0x01002d03, 0x01002d06, 0x01002d0a, 0x01002d0f,
+        0x01002d18, 0x01002d1f, 0x01002d29, 0x05002d38, 0x01002e03, 0x01002e06,
+        0x01002e0a, 0x01002e0f, 0x01002e18, 0x01002e1f, 0x01002e29, 0x05002e38,
+        0x01002f03, 0x01002f06, 0x01002f0a, 0x01002f0f, 0x01002f18, 0x01002f1f,
+        0x01002f29, 0x05002f38, 0x01003303, 0x01003306, 0x0100330a, 0x0100330f,
+        0x01003318, 0x0100331f, 0x01003329, 0x05003338, 0x01003403, 0x01003406,
+        0x0100340a, 0x0100340f, 0x01003418, 0x0100341f, 0x01003429, 0x05003438,
+        0x01003503, 0x01003506, 0x0100350a, 0x0100350f, 0x01003518, 0x0100351f,
+        0x01003529, 0x05003538, 0x01003603, 0x01003606, 0x0100360a, 0x0100360f,
+        0x01003618, 0x0100361f, 0x01003629, 0x05003638, 0x01003703, 0x01003706,
+        0x0100370a, 0x0100370f, 0x01003718, 0x0100371f, 0x01003729, 0x05003738,
+        0x01003803, 0x01003806, 0x0100380a, 0x0100380f, 0x01003818, 0x0100381f,
+        0x01003829, 0x05003838, 0x01003903, 0x01003906, 0x0100390a, 0x0100390f,
+        0x01003918, 0x0100391f, 0x01003929, 0x05003938
+    },
+    /* 2 */
+    {
+        0x06303000, 0x06313000, 0x06323000, 0x06613000, 0x06633000, 0x06653000,
+        0x06693000, 0x066f3000, 0x06733000, 0x06743000, 0x0100300d, 0x0100300e,
+        0x01003011, 0x01003012, 0x01003014, 0x01003015, 0x0100301a, 0x0100301b,
+        0x0100301d, 0x0100301e, 0x01003021, 0x01003022, 0x01003024, 0x01003025,
+        0x0100302b, 0x0100302e, 0x01003032, 0x01003035, 0x0100303a, 0x0100303d,
+        0x01003041, 0x05003044, 0x06303100, 0x06313100, 0x06323100, 0x06613100,
+        0x06633100, 0x06653100, 0x06693100, 0x066f3100, 0x06733100, 0x06743100,
+        0x0100310d, 0x0100310e, 0x01003111, 0x01003112, 0x01003114, 0x01003115,
+        0x0100311a, 0x0100311b, 0x0100311d, 0x0100311e, 0x01003121, 0x01003122,
+        0x01003124, 0x01003125, 0x0100312b, 0x0100312e, 0x01003132, 0x01003135,
+        0x0100313a, 0x0100313d, 0x01003141, 0x05003144, 0x06303200, 0x06313200,
+        0x06323200, 0x06613200, 0x06633200, 0x06653200, 0x06693200, 0x066f3200,
+        0x06733200, 0x06743200, 0x0100320d, 0x0100320e, 0x01003211, 0x01003212,
+        0x01003214, 0x01003215, 0x0100321a, 0x0100321b, 0x0100321d, 0x0100321e,
+        0x01003221, 0x01003222, 0x01003224, 0x01003225, 0x0100322b, 0x0100322e,
+        0x01003232, 0x01003235, 0x0100323a, 0x0100323d, 0x01003241, 0x05003244,
+        0x06306100, 0x06316100, 0x06326100, 0x06616100, 0x06636100, 0x06656100,
+        0x06696100, 0x066f6100, 0x06736100, 0x06746100, 0x0100610d, 0x0100610e,
+        0x01006111, 0x01006112, 0x01006114, 0x01006115, 0x0100611a, 0x0100611b,
+        0x0100611d, 0x0100611e, 0x01006121, 0x01006122, 0x01006124, 0x01006125,
+        0x0100612b, 0x0100612e, 0x01006132, 0x01006135, 0x0100613a, 0x0100613d,
+        0x01006141, 0x05006144, 0x06306300, 0x06316300, 0x06326300, 0x06616300,
+        0x06636300, 0x06656300, 0x06696300, 0x066f6300, 0x06736300, 0x06746300,
+        0x0100630d, 0x0100630e, 0x01006311, 0x01006312, 0x01006314, 0x01006315,
+        0x0100631a, 0x0100631b, 0x0100631d, 0x0100631e, 0x01006321, 0x01006322,
+        0x01006324, 0x01006325, 0x0100632b, 0x0100632e, 0x01006332, 0x01006335,
+        0x0100633a, 0x0100633d, 0x01006341, 0x05006344, 0x06306500, 0x06316500,
+        0x06326500, 0x06616500, 0x06636500, 0x06656500, 0x06696500, 0x066f6500,
+        0x06736500, 0x06746500, 0x0100650d, 0x0100650e, 0x01006511, 0x01006512,
+        0x01006514, 0x01006515, 0x0100651a, 0x0100651b, 0x0100651d, 0x0100651e,
+        0x01006521, 0x01006522, 0x01006524, 0x01006525, 0x0100652b, 0x0100652e,
+        0x01006532, 0x01006535, 0x0100653a, 0x0100653d, 0x01006541, 0x05006544,
+        0x06306900, 0x06316900, 0x06326900, 0x06616900, 0x06636900, 0x06656900,
+        0x06696900, 0x066f6900, 0x06736900, 0x06746900, 0x0100690d, 0x0100690e,
+        0x01006911, 0x01006912, 0x01006914, 0x01006915, 0x0100691a, 0x0100691b,
+        0x0100691d, 0x0100691e, 0x01006921, 0x01006922, 0x01006924, 0x01006925,
+        0x0100692b, 0x0100692e, 0x01006932, 0x01006935, 0x0100693a, 0x0100693d,
+        0x01006941, 0x05006944, 0x06306f00, 0x06316f00, 0x06326f00, 0x06616f00,
+        0x06636f00, 0x06656f00, 0x06696f00, 0x066f6f00, 0x06736f00, 0x06746f00,
+        0x01006f0d, 0x01006f0e, 0x01006f11, 0x01006f12, 0x01006f14, 0x01006f15,
+        0x01006f1a, 0x01006f1b, 0x01006f1d, 0x01006f1e, 0x01006f21, 0x01006f22,
+        0x01006f24, 0x01006f25, 0x01006f2b, 0x01006f2e, 0x01006f32, 0x01006f35,
+        0x01006f3a, 0x01006f3d, 0x01006f41, 0x05006f44
+    },
+    /* 3 */
+    {
+        0x02303001, 0x06303016, 0x02313001, 0x06313016, 0x02323001, 0x06323016,
+        0x02613001, 0x06613016, 0x02633001, 0x06633016, 0x02653001, 0x06653016,
+        0x02693001, 0x06693016, 0x026f3001, 0x066f3016, 0x02733001, 0x06733016,
+        0x02743001, 0x06743016, 0x06203000, 0x06253000, 0x062d3000, 0x062e3000,
+        0x062f3000, 0x06333000, 0x06343000, 0x06353000, 0x06363000, 0x06373000,
+        0x06383000, 0x06393000, 0x063d3000, 0x06413000, 0x065f3000, 0x06623000,
+        0x06643000, 0x06663000, 0x06673000, 0x06683000, 0x066c3000, 0x066d3000,
+        0x066e3000, 0x06703000, 0x06723000, 0x06753000, 0x01003026, 0x01003027,
+        0x0100302c, 0x0100302d, 0x0100302f, 0x01003030, 0x01003033, 0x01003034,
+        0x01003036, 0x01003037, 0x0100303b, 0x0100303c, 0x0100303e, 0x0100303f,
+        0x01003042, 0x01003043, 0x01003045, 0x05003048, 0x02303101, 0x06303116,
+        0x02313101, 0x06313116, 0x02323101, 0x06323116, 0x02613101, 0x06613116,
+        0x02633101, 0x06633116, 0x02653101, 0x06653116, 0x02693101, 0x06693116,
+        0x026f3101, 0x066f3116, 0x02733101, 0x06733116, 0x02743101, 0x06743116,
+        0x06203100, 0x06253100, 0x062d3100, 0x062e3100, 0x062f3100, 0x06333100,
+        0x06343100, 0x06353100, 0x06363100, 0x06373100, 0x06383100, 0x06393100,
+        0x063d3100, 0x06413100, 0x065f3100, 0x06623100, 0x06643100, 0x06663100,
+        0x06673100, 0x06683100, 0x066c3100, 0x066d3100, 0x066e3100, 0x06703100,
+        0x06723100, 0x06753100, 0x01003126, 0x01003127, 0x0100312c, 0x0100312d,
+        0x0100312f, 0x01003130, 0x01003133, 0x01003134, 0x01003136, 0x01003137,
+        0x0100313b, 0x0100313c, 0x0100313e, 0x0100313f, 0x01003142, 0x01003143,
+        0x01003145, 0x05003148, 0x02303201, 0x06303216, 0x02313201, 0x06313216,
+        0x02323201, 0x06323216, 0x02613201, 0x06613216, 0x02633201, 0x06633216,
+        0x02653201, 0x06653216, 0x02693201, 0x06693216, 0x026f3201, 0x066f3216,
+        0x02733201, 0x06733216, 0x02743201, 0x06743216, 0x06203200, 0x06253200,
+        0x062d3200, 0x062e3200, 0x062f3200, 0x06333200, 0x06343200, 0x06353200,
+        0x06363200, 0x06373200, 0x06383200, 0x06393200, 0x063d3200, 0x06413200,
+        0x065f3200, 0x06623200, 0x06643200, 0x06663200, 0x06673200, 0x06683200,
+        0x066c3200, 0x066d3200, 0x066e3200, 0x06703200, 0x06723200, 0x06753200,
+        0x01003226, 0x01003227, 0x0100322c, 0x0100322d, 0x0100322f, 0x01003230,
+        0x01003233, 0x01003234, 0x01003236, 0x01003237, 0x0100323b, 0x0100323c,
+        0x0100323e, 0x0100323f, 0x01003242, 0x01003243, 0x01003245, 0x05003248,
+        0x02306101, 0x06306116, 0x02316101, 0x06316116, 0x02326101, 0x06326116,
+        0x02616101, 0x06616116, 0x02636101, 0x06636116, 0x02656101, 0x06656116,
+        0x02696101, 0x06696116, 0x026f6101, 0x066f6116, 0x02736101, 0x06736116,
+        0x02746101, 0x06746116, 0x06206100, 0x06256100, 0x062d6100, 0x062e6100,
+        0x062f6100, 0x06336100, 0x06346100, 0x06356100, 0x06366100, 0x06376100,
+        0x06386100, 0x06396100, 0x063d6100, 0x06416100, 0x065f6100, 0x06626100,
+        0x06646100, 0x06666100, 0x06676100, 0x06686100, 0x066c6100, 0x066d6100,
+        0x066e6100, 0x06706100, 0x06726100, 0x06756100, 0x01006126, 0x01006127,
+        0x0100612c, 0x0100612d, 0x0100612f, 0x01006130, 0x01006133, 0x01006134,
+        0x01006136, 0x01006137, 0x0100613b, 0x0100613c, 0x0100613e, 0x0100613f,
+        0x01006142, 0x01006143, 0x01006145, 0x05006148
+    },
+    /* 4 */
+    {
+        0x02303002, 0x02303009, 0x02303017, 0x06303028, 0x02313002, 0x02313009,
+        0x02313017, 0x06313028, 0x02323002, 0x02323009, 0x02323017, 0x06323028,
+        0x02613002, 0x02613009, 0x02613017, 0x06613028, 0x02633002, 0x02633009,
+        0x02633017, 0x06633028, 0x02653002, 0x02653009, 0x02653017, 0x06653028,
+        0x02693002, 0x02693009, 0x02693017, 0x06693028, 0x026f3002, 0x026f3009,
+        0x026f3017, 0x066f3028, 0x02733002, 0x02733009, 0x02733017, 0x06733028,
+        0x02743002, 0x02743009, 0x02743017, 0x06743028, 0x02203001, 0x06203016,
+        0x02253001, 0x06253016, 0x022d3001, 0x062d3016, 0x022e3001, 0x062e3016,
+        0x022f3001, 0x062f3016, 0x02333001, 0x06333016, 0x02343001, 0x06343016,
+        0x02353001, 0x06353016, 0x02363001, 0x06363016, 0x02373001, 0x06373016,
+        0x02383001, 0x06383016, 0x02393001, 0x06393016, 0x023d3001, 0x063d3016,
+        0x02413001, 0x06413016, 0x025f3001, 0x065f3016, 0x02623001, 0x06623016,
+        0x02643001, 0x06643016, 0x02663001, 0x06663016, 0x02673001, 0x06673016,
+        0x02683001, 0x06683016, 0x026c3001, 0x066c3016, 0x026d3001, 0x066d3016,
+        0x026e3001, 0x066e3016, 0x02703001, 0x06703016, 0x02723001, 0x06723016,
+        0x02753001, 0x06753016, 0x063a3000, 0x06423000, 0x06433000, 0x06443000,
+        0x06453000, 0x06463000, 0x06473000, 0x06483000, 0x06493000, 0x064a3000,
+        0x064b3000, 0x064c3000, 0x064d3000, 0x064e3000, 0x064f3000, 0x06503000,
+        0x06513000, 0x06523000, 0x06533000, 0x06543000, 0x06553000, 0x06563000,
+        0x06573000, 0x06593000, 0x066a3000, 0x066b3000, 0x06713000, 0x06763000,
+        0x06773000, 0x06783000, 0x06793000, 0x067a3000, 0x01003046, 0x01003047,
+        0x01003049, 0x0500304a, 0x02303102, 0x02303109, 0x02303117, 0x06303128,
+        0x02313102, 0x02313109, 0x02313117, 0x06313128, 0x02323102, 0x02323109,
+        0x02323117, 0x06323128, 0x02613102, 0x02613109, 0x02613117, 0x06613128,
+        0x02633102, 0x02633109, 0x02633117, 0x06633128, 0x02653102, 0x02653109,
+        0x02653117, 0x06653128, 0x02693102, 0x02693109, 0x02693117, 0x06693128,
+        0x026f3102, 0x026f3109, 0x026f3117, 0x066f3128, 0x02733102, 0x02733109,
+        0x02733117, 0x06733128, 0x02743102, 0x02743109, 0x02743117, 0x06743128,
+        0x02203101, 0x06203116, 0x02253101, 0x06253116, 0x022d3101, 0x062d3116,
+        0x022e3101, 0x062e3116, 0x022f3101, 0x062f3116, 0x02333101, 0x06333116,
+        0x02343101, 0x06343116, 0x02353101, 0x06353116, 0x02363101, 0x06363116,
+        0x02373101, 0x06373116, 0x02383101, 0x06383116, 0x02393101, 0x06393116,
+        0x023d3101, 0x063d3116, 0x02413101, 0x06413116, 0x025f3101, 0x065f3116,
+        0x02623101, 0x06623116, 0x02643101, 0x06643116, 0x02663101, 0x06663116,
+        0x02673101, 0x06673116, 0x02683101, 0x06683116, 0x026c3101, 0x066c3116,
+        0x026d3101, 0x066d3116, 0x026e3101, 0x066e3116, 0x02703101, 0x06703116,
+        0x02723101, 0x06723116, 0x02753101, 0x06753116, 0x063a3100, 0x06423100,
+        0x06433100, 0x06443100, 0x06453100, 0x06463100, 0x06473100, 0x06483100,
+        0x06493100, 0x064a3100, 0x064b3100, 0x064c3100, 0x064d3100, 0x064e3100,
+        0x064f3100, 0x06503100, 0x06513100, 0x06523100, 0x06533100, 0x06543100,
+        0x06553100, 0x06563100, 0x06573100, 0x06593100, 0x066a3100, 0x066b3100,
+        0x06713100, 0x06763100, 0x06773100, 0x06783100, 0x06793100, 0x067a3100,
+        0x01003146, 0x01003147, 0x01003149, 0x0500314a
+    },
+    /* 5 */
+    {
+        0x02303202, 0x02303209, 0x02303217, 0x06303228, 0x02313202, 0x02313209,
+        0x02313217, 0x06313228, 0x02323202, 0x02323209, 0x02323217, 0x06323228,
+        0x02613202, 0x02613209, 0x02613217, 0x06613228, 0x02633202, 0x02633209,
+        0x02633217, 0x06633228, 0x02653202, 0x02653209, 0x02653217, 0x06653228,
+        0x02693202, 0x02693209, 0x02693217, 0x06693228, 0x026f3202, 0x026f3209,
+        0x026f3217, 0x066f3228, 0x02733202, 0x02733209, 0x02733217, 0x06733228,
+        0x02743202, 0x02743209, 0x02743217, 0x06743228, 0x02203201, 0x06203216,
+        0x02253201, 0x06253216, 0x022d3201, 0x062d3216, 0x022e3201, 0x062e3216,
+        0x022f3201, 0x062f3216, 0x02333201, 0x06333216, 0x02343201, 0x06343216,
+        0x02353201, 0x06353216, 0x02363201, 0x06363216, 0x02373201, 0x06373216,
+        0x02383201, 0x06383216, 0x02393201, 0x06393216, 0x023d3201, 0x063d3216,
+        0x02413201, 0x06413216, 0x025f3201, 0x065f3216, 0x02623201, 0x06623216,
+        0x02643201, 0x06643216, 0x02663201, 0x06663216, 0x02673201, 0x06673216,
+        0x02683201, 0x06683216, 0x026c3201, 0x066c3216, 0x026d3201, 0x066d3216,
+        0x026e3201, 0x066e3216, 0x02703201, 0x06703216, 0x02723201, 0x06723216,
+        0x02753201, 0x06753216, 0x063a3200, 0x06423200, 0x06433200, 0x06443200,
+        0x06453200, 0x06463200, 0x06473200, 0x06483200, 0x06493200, 0x064a3200,
+        0x064b3200, 0x064c3200, 0x064d3200, 0x064e3200, 0x064f3200, 0x06503200,
+        0x06513200, 0x06523200, 0x06533200, 0x06543200, 0x06553200, 0x06563200,
+        0x06573200, 0x06593200, 0x066a3200, 0x066b3200, 0x06713200, 0x06763200,
+        0x06773200, 0x06783200, 0x06793200, 0x067a3200, 0x01003246, 0x01003247,
+        0x01003249, 0x0500324a, 0x02306102, 0x02306109, 0x02306117, 0x06306128,
+        0x02316102, 0x02316109, 0x02316117, 0x06316128, 0x02326102, 0x02326109,
+        0x02326117, 0x06326128, 0x02616102, 0x02616109, 0x02616117, 0x06616128,
+        0x02636102, 0x02636109, 0x02636117, 0x06636128, 0x02656102, 0x02656109,
+        0x02656117, 0x06656128, 0x02696102, 0x02696109, 0x02696117, 0x06696128,
+        0x026f6102, 0x026f6109, 0x026f6117, 0x066f6128, 0x02736102, 0x02736109,
+        0x02736117, 0x06736128, 0x02746102, 0x02746109, 0x02746117, 0x06746128,
+        0x02206101, 0x06206116, 0x02256101, 0x06256116, 0x022d6101, 0x062d6116,
+        0x022e6101, 0x062e6116, 0x022f6101, 0x062f6116, 0x02336101, 0x06336116,
+        0x02346101, 0x06346116, 0x02356101, 0x06356116, 0x02366101, 0x06366116,
+        0x02376101, 0x06376116, 0x02386101, 0x06386116, 0x02396101, 0x06396116,
+        0x023d6101, 0x063d6116, 0x02416101, 0x06416116, 0x025f6101, 0x065f6116,
+        0x02626101, 0x06626116, 0x02646101, 0x06646116, 0x02666101, 0x06666116,
+        0x02676101, 0x06676116, 0x02686101, 0x06686116, 0x026c6101, 0x066c6116,
+        0x026d6101, 0x066d6116, 0x026e6101, 0x066e6116, 0x02706101, 0x06706116,
+        0x02726101, 0x06726116, 0x02756101, 0x06756116, 0x063a6100, 0x06426100,
+        0x06436100, 0x06446100, 0x06456100, 0x06466100, 0x06476100, 0x06486100,
+        0x06496100, 0x064a6100, 0x064b6100, 0x064c6100, 0x064d6100, 0x064e6100,
+        0x064f6100, 0x06506100, 0x06516100, 0x06526100, 0x06536100, 0x06546100,
+        0x06556100, 0x06566100, 0x06576100, 0x06596100, 0x066a6100, 0x066b6100,
+        0x06716100, 0x06766100, 0x06776100, 0x06786100, 0x06796100, 0x067a6100,
+        0x01006146, 0x01006147, 0x01006149, 0x0500614a
+    },
+    /* 6 */
+    {
+        0x02306301, 0x06306316, 0x02316301, 0x06316316, 0x02326301, 0x06326316,
+        0x02616301, 0x06616316, 0x02636301, 0x06636316, 0x02656301, 0x06656316,
+        0x02696301, 0x06696316, 0x026f6301, 0x066f6316, 0x02736301, 0x06736316,
+        0x02746301, 0x06746316, 0x06206300, 0x06256300, 0x062d6300, 0x062e6300,
+        0x062f6300, 0x06336300, 0x06346300, 0x06356300, 0x06366300, 0x06376300,
+        0x06386300, 0x06396300, 0x063d6300, 0x06416300, 0x065f6300, 0x06626300,
+        0x06646300, 0x06666300, 0x06676300, 0x06686300, 0x066c6300, 0x066d6300,
+        0x066e6300, 0x06706300, 0x06726300, 0x06756300, 0x01006326, 0x01006327,
+        0x0100632c, 0x0100632d, 0x0100632f, 0x01006330, 0x01006333, 0x01006334,
+        0x01006336, 0x01006337, 0x0100633b, 0x0100633c, 0x0100633e, 0x0100633f,
+        0x01006342, 0x01006343, 0x01006345, 0x05006348, 0x02306501, 0x06306516,
+        0x02316501, 0x06316516, 0x02326501, 0x06326516, 0x02616501, 0x06616516,
+        0x02636501, 0x06636516, 0x02656501, 0x06656516, 0x02696501, 0x06696516,
+        0x026f6501, 0x066f6516, 0x02736501, 0x06736516, 0x02746501, 0x06746516,
+        0x06206500, 0x06256500, 0x062d6500, 0x062e6500, 0x062f6500, 0x06336500,
+        0x06346500, 0x06356500, 0x06366500, 0x06376500, 0x06386500, 0x06396500,
+        0x063d6500, 0x06416500, 0x065f6500, 0x06626500, 0x06646500, 0x06666500,
+        0x06676500, 0x06686500, 0x066c6500, 0x066d6500, 0x066e6500, 0x06706500,
+        0x06726500, 0x06756500, 0x01006526, 0x01006527, 0x0100652c, 0x0100652d,
+        0x0100652f, 0x01006530, 0x01006533, 0x01006534, 0x01006536, 0x01006537,
+        0x0100653b, 0x0100653c, 0x0100653e, 0x0100653f, 0x01006542, 0x01006543,
+        0x01006545, 0x05006548, 0x02306901, 0x06306916, 0x02316901, 0x06316916,
+        0x02326901, 0x06326916, 0x02616901, 0x06616916, 0x02636901, 0x06636916,
+        0x02656901, 0x06656916, 0x02696901, 0x06696916, 0x026f6901, 0x066f6916,
+        0x02736901, 0x06736916, 0x02746901, 0x06746916, 0x06206900, 0x06256900,
+        0x062d6900, 0x062e6900, 0x062f6900, 0x06336900, 0x06346900, 0x06356900,
+        0x06366900, 0x06376900, 0x06386900, 0x06396900, 0x063d6900, 0x06416900,
+        0x065f6900, 0x06626900, 0x06646900, 0x06666900, 0x06676900, 0x06686900,
+        0x066c6900, 0x066d6900, 0x066e6900, 0x06706900, 0x06726900, 0x06756900,
+        0x01006926, 0x01006927, 0x0100692c, 0x0100692d, 0x0100692f, 0x01006930,
+        0x01006933, 0x01006934, 0x01006936, 0x01006937, 0x0100693b, 0x0100693c,
+        0x0100693e, 0x0100693f, 0x01006942, 0x01006943, 0x01006945, 0x05006948,
+        0x02306f01, 0x06306f16, 0x02316f01, 0x06316f16, 0x02326f01, 0x06326f16,
+        0x02616f01, 0x06616f16, 0x02636f01, 0x06636f16, 0x02656f01, 0x06656f16,
+        0x02696f01, 0x06696f16, 0x026f6f01, 0x066f6f16, 0x02736f01, 0x06736f16,
+        0x02746f01, 0x06746f16, 0x06206f00, 0x06256f00, 0x062d6f00, 0x062e6f00,
+        0x062f6f00, 0x06336f00, 0x06346f00, 0x06356f00, 0x06366f00, 0x06376f00,
+        0x06386f00, 0x06396f00, 0x063d6f00, 0x06416f00, 0x065f6f00, 0x06626f00,
+        0x06646f00, 0x06666f00, 0x06676f00, 0x06686f00, 0x066c6f00, 0x066d6f00,
+        0x066e6f00, 0x06706f00, 0x06726f00, 0x06756f00, 0x01006f26, 0x01006f27,
+        0x01006f2c, 0x01006f2d, 0x01006f2f, 0x01006f30, 0x01006f33, 0x01006f34,
+        0x01006f36, 0x01006f37, 0x01006f3b, 0x01006f3c, 0x01006f3e, 0x01006f3f,
+        0x01006f42, 0x01006f43, 0x01006f45, 0x05006f48
+    },
+    /* 7 */
+    {
+        0x02306302, 0x02306309, 0x02306317, 0x06306328, 0x02316302, 0x02316309,
+        0x02316317, 0x06316328, 0x02326302, 0x02326309, 0x02326317, 0x06326328,
+        0x02616302, 0x02616309, 0x02616317, 0x06616328, 0x02636302, 0x02636309,
+        0x02636317, 0x06636328, 0x02656302, 0x02656309, 0x02656317, 0x06656328,
+        0x02696302, 0x02696309, 0x02696317, 0x06696328, 0x026f6302, 0x026f6309,
+        0x026f6317, 0x066f6328, 0x02736302, 0x02736309, 0x02736317, 0x06736328,
+        0x02746302, 0x02746309, 0x02746317, 0x06746328, 0x02206301, 0x06206316,
+        0x02256301, 0x06256316, 0x022d6301, 0x062d6316, 0x022e6301, 0x062e6316,
+        0x022f6301, 0x062f6316, 0x02336301, 0x06336316, 0x02346301, 0x06346316,
+        0x02356301, 0x06356316, 0x02366301, 0x06366316, 0x02376301, 0x06376316,
+        0x02386301, 0x06386316, 0x02396301, 0x06396316, 0x023d6301, 0x063d6316,
+        0x02416301, 0x06416316, 0x025f6301, 0x065f6316, 0x02626301, 0x06626316,
+        0x02646301, 0x06646316, 0x02666301, 0x06666316, 0x02676301, 0x06676316,
+        0x02686301, 0x06686316, 0x026c6301, 0x066c6316, 0x026d6301, 0x066d6316,
+        0x026e6301, 0x066e6316, 0x02706301, 0x06706316, 0x02726301, 0x06726316,
+        0x02756301, 0x06756316, 0x063a6300, 0x06426300, 0x06436300, 0x06446300,
+        0x06456300, 0x06466300, 0x06476300, 0x06486300, 0x06496300, 0x064a6300,
+        0x064b6300, 0x064c6300, 0x064d6300, 0x064e6300, 0x064f6300, 0x06506300,
+        0x06516300, 0x06526300, 0x06536300, 0x06546300, 0x06556300, 0x06566300,
+        0x06576300, 0x06596300, 0x066a6300, 0x066b6300, 0x06716300, 0x06766300,
+        0x06776300, 0x06786300, 0x06796300, 0x067a6300, 0x01006346, 0x01006347,
+        0x01006349, 0x0500634a, 0x02306502, 0x02306509, 0x02306517, 0x06306528,
+        0x02316502, 0x02316509, 0x02316517, 0x06316528, 0x02326502, 0x02326509,
+        0x02326517, 0x06326528, 0x02616502, 0x02616509, 0x02616517, 0x06616528,
+        0x02636502, 0x02636509, 0x02636517, 0x06636528, 0x02656502, 0x02656509,
+        0x02656517, 0x06656528, 0x02696502, 0x02696509, 0x02696517, 0x06696528,
+        0x026f6502, 0x026f6509, 0x026f6517, 0x066f6528, 0x02736502, 0x02736509,
+        0x02736517, 0x06736528, 0x02746502, 0x02746509, 0x02746517, 0x06746528,
+        0x02206501, 0x06206516, 0x02256501, 0x06256516, 0x022d6501, 0x062d6516,
+        0x022e6501, 0x062e6516, 0x022f6501, 0x062f6516, 0x02336501, 0x06336516,
+        0x02346501, 0x06346516, 0x02356501, 0x06356516, 0x02366501, 0x06366516,
+        0x02376501, 0x06376516, 0x02386501, 0x06386516, 0x02396501, 0x06396516,
+        0x023d6501, 0x063d6516, 0x02416501, 0x06416516, 0x025f6501, 0x065f6516,
+        0x02626501, 0x06626516, 0x02646501, 0x06646516, 0x02666501, 0x06666516,
+        0x02676501, 0x06676516, 0x02686501, 0x06686516, 0x026c6501, 0x066c6516,
+        0x026d6501, 0x066d6516, 0x026e6501, 0x066e6516, 0x02706501, 0x06706516,
+        0x02726501, 0x06726516, 0x02756501, 0x06756516, 0x063a6500, 0x06426500,
+        0x06436500, 0x06446500, 0x06456500, 0x06466500, 0x06476500, 0x06486500,
+        0x06496500, 0x064a6500, 0x064b6500, 0x064c6500, 0x064d6500, 0x064e6500,
+        0x064f6500, 0x06506500, 0x06516500, 0x06526500, 0x06536500, 0x06546500,
+        0x06556500, 0x06566500, 0x06576500, 0x06596500, 0x066a6500, 0x066b6500,
+        0x06716500, 0x06766500, 0x06776500, 0x06786500, 0x06796500, 0x067a6500,
+        0x01006546, 0x01006547, 0x01006549, 0x0500654a
+    },
+    /* 8 */
+    {
+        0x02306902, 0x02306909, 0x02306917, 0x06306928, 0x02316902, 0x02316909,
+        0x02316917, 0x06316928, 0x02326902, 0x02326909, 0x02326917, 0x06326928,
+        0x02616902, 0x02616909, 0x02616917, 0x06616928, 0x02636902, 0x02636909,
+        0x02636917, 0x06636928, 0x02656902, 0x02656909, 0x02656917, 0x06656928,
+        0x02696902, 0x02696909, 0x02696917, 0x06696928, 0x026f6902, 0x026f6909,
+        0x026f6917, 0x066f6928, 0x02736902, 0x02736909, 0x02736917, 0x06736928,
+        0x02746902, 0x02746909, 0x02746917, 0x06746928, 0x02206901, 0x06206916,
+        0x02256901, 0x06256916, 0x022d6901, 0x062d6916, 0x022e6901, 0x062e6916,
+        0x022f6901, 0x062f6916, 0x02336901, 0x06336916, 0x02346901, 0x06346916,
+        0x02356901, 0x06356916, 0x02366901, 0x06366916, 0x02376901, 0x06376916,
+        0x02386901, 0x06386916, 0x02396901, 0x06396916, 0x023d6901, 0x063d6916,
+        0x02416901, 0x06416916, 0x025f6901, 0x065f6916, 0x02626901, 0x06626916,
+        0x02646901, 0x06646916, 0x02666901, 0x06666916, 0x02676901, 0x06676916,
+        0x02686901, 0x06686916, 0x026c6901, 0x066c6916, 0x026d6901, 0x066d6916,
+        0x026e6901, 0x066e6916, 0x02706901, 0x06706916, 0x02726901, 0x06726916,
+        0x02756901, 0x06756916, 0x063a6900, 0x06426900, 0x06436900, 0x06446900,
+        0x06456900, 0x06466900, 0x06476900, 0x06486900, 0x06496900, 0x064a6900,
+        0x064b6900, 0x064c6900, 0x064d6900, 0x064e6900, 0x064f6900, 0x06506900,
+        0x06516900, 0x06526900, 0x06536900, 0x06546900, 0x06556900, 0x06566900,
+        0x06576900, 0x06596900, 0x066a6900, 0x066b6900, 0x06716900, 0x06766900,
+        0x06776900, 0x06786900, 0x06796900, 0x067a6900, 0x01006946, 0x01006947,
+        0x01006949, 0x0500694a, 0x02306f02, 0x02306f09, 0x02306f17, 0x06306f28,
+        0x02316f02, 0x02316f09, 0x02316f17, 0x06316f28, 0x02326f02, 0x02326f09,
+        0x02326f17, 0x06326f28, 0x02616f02, 0x02616f09, 0x02616f17, 0x06616f28,
+        0x02636f02, 0x02636f09, 0x02636f17, 0x06636f28, 0x02656f02, 0x02656f09,
+        0x02656f17, 0x06656f28, 0x02696f02, 0x02696f09, 0x02696f17, 0x06696f28,
+        0x026f6f02, 0x026f6f09, 0x026f6f17, 0x066f6f28, 0x02736f02, 0x02736f09,
+        0x02736f17, 0x06736f28, 0x02746f02, 0x02746f09, 0x02746f17, 0x06746f28,
+        0x02206f01, 0x06206f16, 0x02256f01, 0x06256f16, 0x022d6f01, 0x062d6f16,
+        0x022e6f01, 0x062e6f16, 0x022f6f01, 0x062f6f16, 0x02336f01, 0x06336f16,
+        0x02346f01, 0x06346f16, 0x02356f01, 0x06356f16, 0x02366f01, 0x06366f16,
+        0x02376f01, 0x06376f16, 0x02386f01, 0x06386f16, 0x02396f01, 0x06396f16,
+        0x023d6f01, 0x063d6f16, 0x02416f01, 0x06416f16, 0x025f6f01, 0x065f6f16,
+        0x02626f01, 0x06626f16, 0x02646f01, 0x06646f16, 0x02666f01, 0x06666f16,
+        0x02676f01, 0x06676f16, 0x02686f01, 0x06686f16, 0x026c6f01, 0x066c6f16,
+        0x026d6f01, 0x066d6f16, 0x026e6f01, 0x066e6f16, 0x02706f01, 0x06706f16,
+        0x02726f01, 0x06726f16, 0x02756f01, 0x06756f16, 0x063a6f00, 0x06426f00,
+        0x06436f00, 0x06446f00, 0x06456f00, 0x06466f00, 0x06476f00, 0x06486f00,
+        0x06496f00, 0x064a6f00, 0x064b6f00, 0x064c6f00, 0x064d6f00, 0x064e6f00,
+        0x064f6f00, 0x06506f00, 0x06516f00, 0x06526f00, 0x06536f00, 0x06546f00,
+        0x06556f00, 0x06566f00, 0x06576f00, 0x06596f00, 0x066a6f00, 0x066b6f00,
+        0x06716f00, 0x06766f00, 0x06776f00, 0x06786f00, 0x06796f00, 0x067a6f00,
+        0x01006f46, 0x01006f47, 0x01006f49, 0x05006f4a
+    },
+    /* 9 */
+    {
+        0x06307300, 0x06317300, 0x06327300, 0x06617300, 0x06637300, 0x06657300,
+        0x06697300, 0x066f7300, 0x06737300, 0x06747300, 0x0100730d, 0x0100730e,
+        0x01007311, 0x01007312, 0x01007314, 0x01007315, 0x0100731a, 0x0100731b,
+        0x0100731d, 0x0100731e, 0x01007321, 0x01007322, 0x01007324, 0x01007325,
+        0x0100732b, 0x0100732e, 0x01007332, 0x01007335, 0x0100733a, 0x0100733d,
+        0x01007341, 0x05007344, 0x06307400, 0x06317400, 0x06327400, 0x06617400,
+        0x06637400, 0x06657400, 0x06697400, 0x066f7400, 0x06737400, 0x06747400,
+        0x0100740d, 0x0100740e, 0x01007411, 0x01007412, 0x01007414, 0x01007415,
+        0x0100741a, 0x0100741b, 0x0100741d, 0x0100741e, 0x01007421, 0x01007422,
+        0x01007424, 0x01007425, 0x0100742b, 0x0100742e, 0x01007432, 0x01007435,
+        0x0100743a, 0x0100743d, 0x01007441, 0x05007444, 0x01002004, 0x01002005,
+        0x01002007, 0x01002008, 0x0100200b, 0x0100200c, 0x01002010, 0x01002013,
+        0x01002019, 0x0100201c, 0x01002020, 0x01002023, 0x0100202a, 0x01002031,
+        0x01002039, 0x05002040, 0x01002504, 0x01002505, 0x01002507, 0x01002508,
+        0x0100250b, 0x0100250c, 0x01002510, 0x01002513, 0x01002519, 0x0100251c,
+        0x01002520, 0x01002523, 0x0100252a, 0x01002531, 0x01002539, 0x05002540,
+        0x01002d04, 0x01002d05, 0x01002d07, 0x01002d08, 0x01002d0b, 0x01002d0c,
+        0x01002d10, 0x01002d13, 0x01002d19, 0x01002d1c, 0x01002d20, 0x01002d23,
+        0x01002d2a, 0x01002d31, 0x01002d39, 0x05002d40, 0x01002e04, 0x01002e05,
+        0x01002e07, 0x01002e08, 0x01002e0b, 0x01002e0c, 0x01002e10, 0x01002e13,
+        0x01002e19, 0x01002e1c, 0x01002e20, 0x01002e23, 0x01002e2a, 0x01002e31,
+        0x01002e39, 0x05002e40, 0x01002f04, 0x01002f05, 0x01002f07, 0x01002f08,
+        0x01002f0b, 0x01002f0c, 0x01002f10, 0x01002f13, 0x01002f19, 0x01002f1c,
+        0x01002f20, 0x01002f23, 0x01002f2a, 0x01002f31, 0x01002f39, 0x05002f40,
+        0x01003304, 0x01003305, 0x01003307, 0x01003308, 0x0100330b, 0x0100330c,
+        0x01003310, 0x01003313, 0x01003319, 0x0100331c, 0x01003320, 0x01003323,
+        0x0100332a, 0x01003331, 0x01003339, 0x05003340, 0x01003404, 0x01003405,
+        0x01003407, 0x01003408, 0x0100340b, 0x0100340c, 0x01003410, 0x01003413,
+        0x01003419, 0x0100341c, 0x01003420, 0x01003423, 0x0100342a, 0x01003431,
+        0x01003439, 0x05003440, 0x01003504, 0x01003505, 0x01003507, 0x01003508,
+        0x0100350b, 0x0100350c, 0x01003510, 0x01003513, 0x01003519, 0x0100351c,
+        0x01003520, 0x01003523, 0x0100352a, 0x01003531, 0x01003539, 0x05003540,
+        0x01003604, 0x01003605, 0x01003607, 0x01003608, 0x0100360b, 0x0100360c,
+        0x01003610, 0x01003613, 0x01003619, 0x0100361c, 0x01003620, 0x01003623,
+        0x0100362a, 0x01003631, 0x01003639, 0x05003640, 0x01003704, 0x01003705,
+        0x01003707, 0x01003708, 0x0100370b, 0x0100370c, 0x01003710, 0x01003713,
+        0x01003719, 0x0100371c, 0x01003720, 0x01003723, 0x0100372a, 0x01003731,
+        0x01003739, 0x05003740, 0x01003804, 0x01003805, 0x01003807, 0x01003808,
+        0x0100380b, 0x0100380c, 0x01003810, 0x01003813, 0x01003819, 0x0100381c,
+        0x01003820, 0x01003823, 0x0100382a, 0x01003831, 0x01003839, 0x05003840,
+        0x01003904, 0x01003905, 0x01003907, 0x01003908, 0x0100390b, 0x0100390c,
+        0x01003910, 0x01003913, 0x01003919, 0x0100391c, 0x01003920, 0x01003923,
+        0x0100392a, 0x01003931, 0x01003939, 0x05003940
+    },
+    /* 10 */
+    {
+        0x02307301, 0x06307316, 0x02317301, 0x06317316, 0x02327301, 0x06327316,
+        0x02617301, 0x06617316, 0x02637301, 0x06637316, 0x02657301, 0x06657316,
+        0x02697301, 0x06697316, 0x026f7301, 0x066f7316, 0x02737301, 0x06737316,
+        0x02747301, 0x06747316, 0x06207300, 0x06257300, 0x062d7300, 0x062e7300,
+        0x062f7300, 0x06337300, 0x06347300, 0x06357300, 0x06367300, 0x06377300,
+        0x06387300, 0x06397300, 0x063d7300, 0x06417300, 0x065f7300, 0x06627300,
+        0x06647300, 0x06667300, 0x06677300, 0x06687300, 0x066c7300, 0x066d7300,
+        0x066e7300, 0x06707300, 0x06727300, 0x06757300, 0x01007326, 0x01007327,
+        0x0100732c, 0x0100732d, 0x0100732f, 0x01007330, 0x01007333, 0x01007334,
+        0x01007336, 0x01007337, 0x0100733b, 0x0100733c, 0x0100733e, 0x0100733f,
+        0x01007342, 0x01007343, 0x01007345, 0x05007348, 0x02307401, 0x06307416,
+        0x02317401, 0x06317416, 0x02327401, 0x06327416, 0x02617401, 0x06617416,
+        0x02637401, 0x06637416, 0x02657401, 0x06657416, 0x02697401, 0x06697416,
+        0x026f7401, 0x066f7416, 0x02737401, 0x06737416, 0x02747401, 0x06747416,
+        0x06207400, 0x06257400, 0x062d7400, 0x062e7400, 0x062f7400, 0x06337400,
+        0x06347400, 0x06357400, 0x06367400, 0x06377400, 0x06387400, 0x06397400,
+        0x063d7400, 0x06417400, 0x065f7400, 0x06627400, 0x06647400, 0x06667400,
+        0x06677400, 0x06687400, 0x066c7400, 0x066d7400, 0x066e7400, 0x06707400,
+        0x06727400, 0x06757400, 0x01007426, 0x01007427, 0x0100742c, 0x0100742d,
+        0x0100742f, 0x01007430, 0x01007433, 0x01007434, 0x01007436, 0x01007437,
+        0x0100743b, 0x0100743c, 0x0100743e, 0x0100743f, 0x01007442, 0x01007443,
+        0x01007445, 0x05007448, 0x06302000, 0x06312000, 0x06322000, 0x06612000,
+        0x06632000, 0x06652000, 0x06692000, 0x066f2000, 0x06732000, 0x06742000,
+        0x0100200d, 0x0100200e, 0x01002011, 0x01002012, 0x01002014, 0x01002015,
+        0x0100201a, 0x0100201b, 0x0100201d, 0x0100201e, 0x01002021, 0x01002022,
+        0x01002024, 0x01002025, 0x0100202b, 0x0100202e, 0x01002032, 0x01002035,
+        0x0100203a, 0x0100203d, 0x01002041, 0x05002044, 0x06302500, 0x06312500,
+        0x06322500, 0x06612500, 0x06632500, 0x06652500, 0x06692500, 0x066f2500,
+        0x06732500, 0x06742500, 0x0100250d, 0x0100250e, 0x01002511, 0x01002512,
+        0x01002514, 0x01002515, 0x0100251a, 0x0100251b, 0x0100251d, 0x0100251e,
+        0x01002521, 0x01002522, 0x01002524, 0x01002525, 0x0100252b, 0x0100252e,
+        0x01002532, 0x01002535, 0x0100253a, 0x0100253d, 0x01002541, 0x05002544,
+        0x06302d00, 0x06312d00, 0x06322d00, 0x06612d00, 0x06632d00, 0x06652d00,
+        0x06692d00, 0x066f2d00, 0x06732d00, 0x06742d00, 0x01002d0d, 0x01002d0e,
+        0x01002d11, 0x01002d12, 0x01002d14, 0x01002d15, 0x01002d1a, 0x01002d1b,
+        0x01002d1d, 0x01002d1e, 0x01002d21, 0x01002d22, 0x01002d24, 0x01002d25,
+        0x01002d2b, 0x01002d2e, 0x01002d32, 0x01002d35, 0x01002d3a, 0x01002d3d,
+        0x01002d41, 0x05002d44, 0x06302e00, 0x06312e00, 0x06322e00, 0x06612e00,
+        0x06632e00, 0x06652e00, 0x06692e00, 0x066f2e00, 0x06732e00, 0x06742e00,
+        0x01002e0d, 0x01002e0e, 0x01002e11, 0x01002e12, 0x01002e14, 0x01002e15,
+        0x01002e1a, 0x01002e1b, 0x01002e1d, 0x01002e1e, 0x01002e21, 0x01002e22,
+        0x01002e24, 0x01002e25, 0x01002e2b, 0x01002e2e, 0x01002e32, 0x01002e35,
+        0x01002e3a, 0x01002e3d, 0x01002e41, 0x05002e44
+    },
+    /* 11 */
+    {
+        0x02307302, 0x02307309, 0x02307317, 0x06307328, 0x02317302, 0x02317309,
+        0x02317317, 0x06317328, 0x02327302, 0x02327309, 0x02327317, 0x06327328,
+        0x02617302, 0x02617309, 0x02617317, 0x06617328, 0x02637302, 0x02637309,
+        0x02637317, 0x06637328, 0x02657302, 0x02657309, 0x02657317, 0x06657328,
+        0x02697302, 0x02697309, 0x02697317, 0x06697328, 0x026f7302, 0x026f7309,
+        0x026f7317, 0x066f7328, 0x02737302, 0x02737309, 0x02737317, 0x06737328,
+        0x02747302, 0x02747309, 0x02747317, 0x06747328, 0x02207301, 0x06207316,
+        0x02257301, 0x06257316, 0x022d7301, 0x062d7316, 0x022e7301, 0x062e7316,
+        0x022f7301, 0x062f7316, 0x02337301, 0x06337316, 0x02347301, 0x06347316,
+        0x02357301, 0x06357316, 0x02367301, 0x06367316, 0x02377301, 0x06377316,
+        0x02387301, 0x06387316, 0x02397301, 0x06397316, 0x023d7301, 0x063d7316,
+        0x02417301, 0x06417316, 0x025f7301, 0x065f7316, 0x02627301, 0x06627316,
+        0x02647301, 0x06647316, 0x02667301, 0x06667316, 0x02677301, 0x06677316,
+        0x02687301, 0x06687316, 0x026c7301, 0x066c7316, 0x026d7301, 0x066d7316,
+        0x026e7301, 0x066e7316, 0x02707301, 0x06707316, 0x02727301, 0x06727316,
+        0x02757301, 0x06757316, 0x063a7300, 0x06427300, 0x06437300, 0x06447300,
+        0x06457300, 0x06467300, 0x06477300, 0x06487300, 0x06497300, 0x064a7300,
+        0x064b7300, 0x064c7300, 0x064d7300, 0x064e7300, 0x064f7300, 0x06507300,
+        0x06517300, 0x06527300, 0x06537300, 0x06547300, 0x06557300, 0x06567300,
+        0x06577300, 0x06597300, 0x066a7300, 0x066b7300, 0x06717300, 0x06767300,
+        0x06777300, 0x06787300, 0x06797300, 0x067a7300, 0x01007346, 0x01007347,
+        0x01007349, 0x0500734a, 0x02307402, 0x02307409, 0x02307417, 0x06307428,
+        0x02317402, 0x02317409, 0x02317417, 0x06317428, 0x02327402, 0x02327409,
+        0x02327417, 0x06327428, 0x02617402, 0x02617409, 0x02617417, 0x06617428,
+        0x02637402, 0x02637409, 0x02637417, 0x06637428, 0x02657402, 0x02657409,
+        0x02657417, 0x06657428, 0x02697402, 0x02697409, 0x02697417, 0x06697428,
+        0x026f7402, 0x026f7409, 0x026f7417, 0x066f7428, 0x02737402, 0x02737409,
+        0x02737417, 0x06737428, 0x02747402, 0x02747409, 0x02747417, 0x06747428,
+        0x02207401, 0x06207416, 0x02257401, 0x06257416, 0x022d7401, 0x062d7416,
+        0x022e7401, 0x062e7416, 0x022f7401, 0x062f7416, 0x02337401, 0x06337416,
+        0x02347401, 0x06347416, 0x02357401, 0x06357416, 0x02367401, 0x06367416,
+        0x02377401, 0x06377416, 0x02387401, 0x06387416, 0x02397401, 0x06397416,
+        0x023d7401, 0x063d7416, 0x02417401, 0x06417416, 0x025f7401, 0x065f7416,
+        0x02627401, 0x06627416, 0x02647401, 0x06647416, 0x02667401, 0x06667416,
+        0x02677401, 0x06677416, 0x02687401, 0x06687416, 0x026c7401, 0x066c7416,
+        0x026d7401, 0x066d7416, 0x026e7401, 0x066e7416, 0x02707401, 0x06707416,
+        0x02727401, 0x06727416, 0x02757401, 0x06757416, 0x063a7400, 0x06427400,
+        0x06437400, 0x06447400, 0x06457400, 0x06467400, 0x06477400, 0x06487400,
+        0x06497400, 0x064a7400, 0x064b7400, 0x064c7400, 0x064d7400, 0x064e7400,
+        0x064f7400, 0x06507400, 0x06517400, 0x06527400, 0x06537400, 0x06547400,
+        0x06557400, 0x06567400, 0x06577400, 0x06597400, 0x066a7400, 0x066b7400,
+        0x06717400, 0x06767400, 0x06777400, 0x06787400, 0x06797400, 0x067a7400,
+        0x01007446, 0x01007447, 0x01007449, 0x0500744a
+    },
+    /* 12 */
+    {
+        0x02302001, 0x06302016, 0x02312001, 0x06312016, 0x02322001, 0x06322016,
+        0x02612001, 0x06612016, 0x02632001, 0x06632016, 0x02652001, 0x06652016,
+        0x02692001, 0x06692016, 0x026f2001, 0x066f2016, 0x02732001, 0x06732016,
+        0x02742001, 0x06742016, 0x06202000, 0x06252000, 0x062d2000, 0x062e2000,
+        0x062f2000, 0x06332000, 0x06342000, 0x06352000, 0x06362000, 0x06372000,
+        0x06382000, 0x06392000, 0x063d2000, 0x06412000, 0x065f2000, 0x06622000,
+        0x06642000, 0x06662000, 0x06672000, 0x06682000, 0x066c2000, 0x066d2000,
+        0x066e2000, 0x06702000, 0x06722000, 0x06752000, 0x01002026, 0x01002027,
+        0x0100202c, 0x0100202d, 0x0100202f, 0x01002030, 0x01002033, 0x01002034,
+        0x01002036, 0x01002037, 0x0100203b, 0x0100203c, 0x0100203e, 0x0100203f,
+        0x01002042, 0x01002043, 0x01002045, 0x05002048, 0x02302501, 0x06302516,
+        0x02312501, 0x06312516, 0x02322501, 0x06322516, 0x02612501, 0x06612516,
+        0x02632501, 0x06632516, 0x02652501, 0x06652516, 0x02692501, 0x06692516,
+        0x026f2501, 0x066f2516, 0x02732501, 0x06732516, 0x02742501, 0x06742516,
+        0x06202500, 0x06252500, 0x062d2500, 0x062e2500, 0x062f2500, 0x06332500,
+        0x06342500, 0x06352500, 0x06362500, 0x06372500, 0x06382500, 0x06392500,
+        0x063d2500, 0x06412500, 0x065f2500, 0x06622500, 0x06642500, 0x06662500,
+        0x06672500, 0x06682500, 0x066c2500, 0x066d2500, 0x066e2500, 0x06702500,
+        0x06722500, 0x06752500, 0x01002526, 0x01002527, 0x0100252c, 0x0100252d,
+        0x0100252f, 0x01002530, 0x01002533, 0x01002534, 0x01002536, 0x01002537,
+        0x0100253b, 0x0100253c, 0x0100253e, 0x0100253f, 0x01002542, 0x01002543,
+        0x01002545, 0x05002548, 0x02302d01, 0x06302d16, 0x02312d01, 0x06312d16,
+        0x02322d01, 0x06322d16, 0x02612d01, 0x06612d16, 0x02632d01, 0x06632d16,
+        0x02652d01, 0x06652d16, 0x02692d01, 0x06692d16, 0x026f2d01, 0x066f2d16,
+        0x02732d01, 0x06732d16, 0x02742d01, 0x06742d16, 0x06202d00, 0x06252d00,
+        0x062d2d00, 0x062e2d00, 0x062f2d00, 0x06332d00, 0x06342d00, 0x06352d00,
+        0x06362d00, 0x06372d00, 0x06382d00, 0x06392d00, 0x063d2d00, 0x06412d00,
+        0x065f2d00, 0x06622d00, 0x06642d00, 0x06662d00, 0x06672d00, 0x06682d00,
+        0x066c2d00, 0x066d2d00, 0x066e2d00, 0x06702d00, 0x06722d00, 0x06752d00,
+        0x01002d26, 0x01002d27, 0x01002d2c, 0x01002d2d, 0x01002d2f, 0x01002d30,
+        0x01002d33, 0x01002d34, 0x01002d36, 0x01002d37, 0x01002d3b, 0x01002d3c,
+        0x01002d3e, 0x01002d3f, 0x01002d42, 0x01002d43, 0x01002d45, 0x05002d48,
+        0x02302e01, 0x06302e16, 0x02312e01, 0x06312e16, 0x02322e01, 0x06322e16,
+        0x02612e01, 0x06612e16, 0x02632e01, 0x06632e16, 0x02652e01, 0x06652e16,
+        0x02692e01, 0x06692e16, 0x026f2e01, 0x066f2e16, 0x02732e01, 0x06732e16,
+        0x02742e01, 0x06742e16, 0x06202e00, 0x06252e00, 0x062d2e00, 0x062e2e00,
+        0x062f2e00, 0x06332e00, 0x06342e00, 0x06352e00, 0x06362e00, 0x06372e00,
+        0x06382e00, 0x06392e00, 0x063d2e00, 0x06412e00, 0x065f2e00, 0x06622e00,
+        0x06642e00, 0x06662e00, 0x06672e00, 0x06682e00, 0x066c2e00, 0x066d2e00,
+        0x066e2e00, 0x06702e00, 0x06722e00, 0x06752e00, 0x01002e26, 0x01002e27,
+        0x01002e2c, 0x01002e2d, 0x01002e2f, 0x01002e30, 0x01002e33, 0x01002e34,
+        0x01002e36, 0x01002e37, 0x01002e3b, 0x01002e3c, 0x01002e3e, 0x01002e3f,
+        0x01002e42, 0x01002e43, 0x01002e45, 0x05002e48
+    },
+    /* 13 */
+    {
+        0x02302002, 0x02302009, 0x02302017, 0x06302028, 0x02312002, 0x02312009,
+        0x02312017, 0x06312028, 0x02322002, 0x02322009, 0x02322017, 0x06322028,
+        0x02612002, 0x02612009, 0x02612017, 0x06612028, 0x02632002, 0x02632009,
+        0x02632017, 0x06632028, 0x02652002, 0x02652009, 0x02652017, 0x06652028,
+        0x02692002, 0x02692009, 0x02692017, 0x06692028, 0x026f2002, 0x026f2009,
+        0x026f2017, 0x066f2028, 0x02732002, 0x02732009, 0x02732017, 0x06732028,
+        0x02742002, 0x02742009, 0x02742017, 0x06742028, 0x02202001, 0x06202016,
+        0x02252001, 0x06252016, 0x022d2001, 0x062d2016, 0x022e2001, 0x062e2016,
+        0x022f2001, 0x062f2016, 0x02332001, 0x06332016, 0x02342001, 0x06342016,
+        0x02352001, 0x06352016, 0x02362001, 0x06362016, 0x02372001, 0x06372016,
+        0x02382001, 0x06382016, 0x02392001, 0x06392016, 0x023d2001, 0x063d2016,
+        0x02412001, 0x06412016, 0x025f2001, 0x065f2016, 0x02622001, 0x06622016,
+        0x02642001, 0x06642016, 0x02662001, 0x06662016, 0x02672001, 0x06672016,
+        0x02682001, 0x06682016, 0x026c2001, 0x066c2016, 0x026d2001, 0x066d2016,
+        0x026e2001, 0x066e2016, 0x02702001, 0x06702016, 0x02722001, 0x06722016,
+        0x02752001, 0x06752016, 0x063a2000, 0x06422000, 0x06432000, 0x06442000,
+        0x06452000, 0x06462000, 0x06472000, 0x06482000, 0x06492000, 0x064a2000,
+        0x064b2000, 0x064c2000, 0x064d2000, 0x064e2000, 0x064f2000, 0x06502000,
+        0x06512000, 0x06522000, 0x06532000, 0x06542000, 0x06552000, 0x06562000,
+        0x06572000, 0x06592000, 0x066a2000, 0x066b2000, 0x06712000, 0x06762000,
+        0x06772000, 0x06782000, 0x06792000, 0x067a2000, 0x01002046, 0x01002047,
+        0x01002049, 0x0500204a, 0x02302502, 0x02302509, 0x02302517, 0x06302528,
+        0x02312502, 0x02312509, 0x02312517, 0x06312528, 0x02322502, 0x02322509,
+        0x02322517, 0x06322528, 0x02612502, 0x02612509, 0x02612517, 0x06612528,
+        0x02632502, 0x02632509, 0x02632517, 0x06632528, 0x02652502, 0x02652509,
+        0x02652517, 0x06652528, 0x02692502, 0x02692509, 0x02692517, 0x06692528,
+        0x026f2502, 0x026f2509, 0x026f2517, 0x066f2528, 0x02732502, 0x02732509,
+        0x02732517, 0x06732528, 0x02742502, 0x02742509, 0x02742517, 0x06742528,
+        0x02202501, 0x06202516, 0x02252501, 0x06252516, 0x022d2501, 0x062d2516,
+        0x022e2501, 0x062e2516, 0x022f2501, 0x062f2516, 0x02332501, 0x06332516,
+        0x02342501, 0x06342516, 0x02352501, 0x06352516, 0x02362501, 0x06362516,
+        0x02372501, 0x06372516, 0x02382501, 0x06382516, 0x02392501, 0x06392516,
+        0x023d2501, 0x063d2516, 0x02412501, 0x06412516, 0x025f2501, 0x065f2516,
+        0x02622501, 0x06622516, 0x02642501, 0x06642516, 0x02662501, 0x06662516,
+        0x02672501, 0x06672516, 0x02682501, 0x06682516, 0x026c2501, 0x066c2516,
+        0x026d2501, 0x066d2516, 0x026e2501, 0x066e2516, 0x02702501, 0x06702516,
+        0x02722501, 0x06722516, 0x02752501, 0x06752516, 0x063a2500, 0x06422500,
+        0x06432500, 0x06442500, 0x06452500, 0x06462500, 0x06472500, 0x06482500,
+        0x06492500, 0x064a2500, 0x064b2500, 0x064c2500, 0x064d2500, 0x064e2500,
+        0x064f2500, 0x06502500, 0x06512500, 0x06522500, 0x06532500, 0x06542500,
+        0x06552500, 0x06562500, 0x06572500, 0x06592500, 0x066a2500, 0x066b2500,
+        0x06712500, 0x06762500, 0x06772500, 0x06782500, 0x06792500, 0x067a2500,
+        0x01002546, 0x01002547, 0x01002549, 0x0500254a
+    },
+    /* 14 */
+    {
+        0x02302d02, 0x02302d09, 0x02302d17, 0x06302d28, 0x02312d02, 0x02312d09,
+        0x02312d17, 0x06312d28, 0x02322d02, 0x02322d09, 0x02322d17, 0x06322d28,
+        0x02612d02, 0x02612d09, 0x02612d17, 0x06612d28, 0x02632d02, 0x02632d09,
+        0x02632d17, 0x06632d28, 0x02652d02, 0x02652d09, 0x02652d17, 0x06652d28,
+        0x02692d02, 0x02692d09, 0x02692d17, 0x06692d28, 0x026f2d02, 0x026f2d09,
+        0x026f2d17, 0x066f2d28, 0x02732d02, 0x02732d09, 0x02732d17, 0x06732d28,
+        0x02742d02, 0x02742d09, 0x02742d17, 0x06742d28, 0x02202d01, 0x06202d16,
+        0x02252d01, 0x06252d16, 0x022d2d01, 0x062d2d16, 0x022e2d01, 0x062e2d16,
+        0x022f2d01, 0x062f2d16, 0x02332d01, 0x06332d16, 0x02342d01, 0x06342d16,
+        0x02352d01, 0x06352d16, 0x02362d01, 0x06362d16, 0x02372d01, 0x06372d16,
+        0x02382d01, 0x06382d16, 0x02392d01, 0x06392d16, 0x023d2d01, 0x063d2d16,
+        0x02412d01, 0x06412d16, 0x025f2d01, 0x065f2d16, 0x02622d01, 0x06622d16,
+        0x02642d01, 0x06642d16, 0x02662d01, 0x06662d16, 0x02672d01, 0x06672d16,
+        0x02682d01, 0x06682d16, 0x026c2d01, 0x066c2d16, 0x026d2d01, 0x066d2d16,
+        0x026e2d01, 0x066e2d16, 0x02702d01, 0x06702d16, 0x02722d01, 0x06722d16,
+        0x02752d01, 0x06752d16, 0x063a2d00, 0x06422d00, 0x06432d00, 0x06442d00,
+        0x06452d00, 0x06462d00, 0x06472d00, 0x06482d00, 0x06492d00, 0x064a2d00,
+        0x064b2d00, 0x064c2d00, 0x064d2d00, 0x064e2d00, 0x064f2d00, 0x06502d00,
+        0x06512d00, 0x06522d00, 0x06532d00, 0x06542d00, 0x06552d00, 0x06562d00,
+        0x06572d00, 0x06592d00, 0x066a2d00, 0x066b2d00, 0x06712d00, 0x06762d00,
+        0x06772d00, 0x06782d00, 0x06792d00, 0x067a2d00, 0x01002d46, 0x01002d47,
+        0x01002d49, 0x05002d4a, 0x02302e02, 0x02302e09, 0x02302e17, 0x06302e28,
+        0x02312e02, 0x02312e09, 0x02312e17, 0x06312e28, 0x02322e02, 0x02322e09,
+        0x02322e17, 0x06322e28, 0x02612e02, 0x02612e09, 0x02612e17, 0x06612e28,
+        0x02632e02, 0x02632e09, 0x02632e17, 0x06632e28, 0x02652e02, 0x02652e09,
+        0x02652e17, 0x06652e28, 0x02692e02, 0x02692e09, 0x02692e17, 0x06692e28,
+        0x026f2e02, 0x026f2e09, 0x026f2e17, 0x066f2e28, 0x02732e02, 0x02732e09,
+        0x02732e17, 0x06732e28, 0x02742e02, 0x02742e09, 0x02742e17, 0x06742e28,
+        0x02202e01, 0x06202e16, 0x02252e01, 0x06252e16, 0x022d2e01, 0x062d2e16,
+        0x022e2e01, 0x062e2e16, 0x022f2e01, 0x062f2e16, 0x02332e01, 0x06332e16,
+        0x02342e01, 0x06342e16, 0x02352e01, 0x06352e16, 0x02362e01, 0x06362e16,
+        0x02372e01, 0x06372e16, 0x02382e01, 0x06382e16, 0x02392e01, 0x06392e16,
+        0x023d2e01, 0x063d2e16, 0x02412e01, 0x06412e16, 0x025f2e01, 0x065f2e16,
+        0x02622e01, 0x06622e16, 0x02642e01, 0x06642e16, 0x02662e01, 0x06662e16,
+        0x02672e01, 0x06672e16, 0x02682e01, 0x06682e16, 0x026c2e01, 0x066c2e16,
+        0x026d2e01, 0x066d2e16, 0x026e2e01, 0x066e2e16, 0x02702e01, 0x06702e16,
+        0x02722e01, 0x06722e16, 0x02752e01, 0x06752e16, 0x063a2e00, 0x06422e00,
+        0x06432e00, 0x06442e00, 0x06452e00, 0x06462e00, 0x06472e00, 0x06482e00,
+        0x06492e00, 0x064a2e00, 0x064b2e00, 0x064c2e00, 0x064d2e00, 0x064e2e00,
+        0x064f2e00, 0x06502e00, 0x06512e00, 0x06522e00, 0x06532e00, 0x06542e00,
+        0x06552e00, 0x06562e00, 0x06572e00, 0x06592e00, 0x066a2e00, 0x066b2e00,
+        0x06712e00, 0x06762e00, 0x06772e00, 0x06782e00, 0x06792e00, 0x067a2e00,
+        0x01002e46, 0x01002e47, 0x01002e49, 0x05002e4a
+    },
+    /* 15 */
+    {
+        0x06302f00, 0x06312f00, 0x06322f00, 0x06612f00, 0x06632f00, 0x06652f00,
+        0x06692f00, 0x066f2f00, 0x06732f00, 0x06742f00, 0x01002f0d, 0x01002f0e,
+        0x01002f11, 0x01002f12, 0x01002f14, 0x01002f15, 0x01002f1a, 0x01002f1b,
+        0x01002f1d, 0x01002f1e, 0x01002f21, 0x01002f22, 0x01002f24, 0x01002f25,
+        0x01002f2b, 0x01002f2e, 0x01002f32, 0x01002f35, 0x01002f3a, 0x01002f3d,
+        0x01002f41, 0x05002f44, 0x06303300, 0x06313300, 0x06323300, 0x06613300,
+        0x06633300, 0x06653300, 0x06693300, 0x066f3300, 0x06733300, 0x06743300,
+        0x0100330d, 0x0100330e, 0x01003311, 0x01003312, 0x01003314, 0x01003315,
+        0x0100331a, 0x0100331b, 0x0100331d, 0x0100331e, 0x01003321, 0x01003322,
+        0x01003324, 0x01003325, 0x0100332b, 0x0100332e, 0x01003332, 0x01003335,
+        0x0100333a, 0x0100333d, 0x01003341, 0x05003344, 0x06303400, 0x06313400,
+        0x06323400, 0x06613400, 0x06633400, 0x06653400, 0x06693400, 0x066f3400,
+        0x06733400, 0x06743400, 0x0100340d, 0x0100340e, 0x01003411, 0x01003412,
+        0x01003414, 0x01003415, 0x0100341a, 0x0100341b, 0x0100341d, 0x0100341e,
+        0x01003421, 0x01003422, 0x01003424, 0x01003425, 0x0100342b, 0x0100342e,
+        0x01003432, 0x01003435, 0x0100343a, 0x0100343d, 0x01003441, 0x05003444,
+        0x06303500, 0x06313500, 0x06323500, 0x06613500, 0x06633500, 0x06653500,
+        0x06693500, 0x066f3500, 0x06733500, 0x06743500, 0x0100350d, 0x0100350e,
+        0x01003511, 0x01003512, 0x01003514, 0x01003515, 0x0100351a, 0x0100351b,
+        0x0100351d, 0x0100351e, 0x01003521, 0x01003522, 0x01003524, 0x01003525,
+        0x0100352b, 0x0100352e, 0x01003532, 0x01003535, 0x0100353a, 0x0100353d,
+        0x01003541, 0x05003544, 0x06303600, 0x06313600, 0x06323600, 0x06613600,
+        0x06633600, 0x06653600, 0x06693600, 0x066f3600, 0x06733600, 0x06743600,
+        0x0100360d, 0x0100360e, 0x01003611, 0x01003612, 0x01003614, 0x01003615,
+        0x0100361a, 0x0100361b, 0x0100361d, 0x0100361e, 0x01003621, 0x01003622,
+        0x01003624, 0x01003625, 0x0100362b, 0x0100362e, 0x01003632, 0x01003635,
+        0x0100363a, 0x0100363d, 0x01003641, 0x05003644, 0x06303700, 0x06313700,
+        0x06323700, 0x06613700, 0x06633700, 0x06653700, 0x06693700, 0x066f3700,
+        0x06733700, 0x06743700, 0x0100370d, 0x0100370e, 0x01003711, 0x01003712,
+        0x01003714, 0x01003715, 0x0100371a, 0x0100371b, 0x0100371d, 0x0100371e,
+        0x01003721, 0x01003722, 0x01003724, 0x01003725, 0x0100372b, 0x0100372e,
+        0x01003732, 0x01003735, 0x0100373a, 0x0100373d, 0x01003741, 0x05003744,
+        0x06303800, 0x06313800, 0x06323800, 0x06613800, 0x06633800, 0x06653800,
+        0x06693800, 0x066f3800, 0x06733800, 0x06743800, 0x0100380d, 0x0100380e,
+        0x01003811, 0x01003812, 0x01003814, 0x01003815, 0x0100381a, 0x0100381b,
+        0x0100381d, 0x0100381e, 0x01003821, 0x01003822, 0x01003824, 0x01003825,
+        0x0100382b, 0x0100382e, 0x01003832, 0x01003835, 0x0100383a, 0x0100383d,
+        0x01003841, 0x05003844, 0x06303900, 0x06313900, 0x06323900, 0x06613900,
+        0x06633900, 0x06653900, 0x06693900, 0x066f3900, 0x06733900, 0x06743900,
+        0x0100390d, 0x0100390e, 0x01003911, 0x01003912, 0x01003914, 0x01003915,
+        0x0100391a, 0x0100391b, 0x0100391d, 0x0100391e, 0x01003921, 0x01003922,
+        0x01003924, 0x01003925, 0x0100392b, 0x0100392e, 0x01003932, 0x01003935,
+        0x0100393a, 0x0100393d, 0x01003941, 0x05003944
+    },
+    /* 16 */
+    {
+        0x02302f01, 0x06302f16, 0x02312f01, 0x06312f16, 0x02322f01, 0x06322f16,
+        0x02612f01, 0x06612f16, 0x02632f01, 0x06632f16, 0x02652f01, 0x06652f16,
+        0x02692f01, 0x06692f16, 0x026f2f01, 0x066f2f16, 0x02732f01, 0x06732f16,
+        0x02742f01, 0x06742f16, 0x06202f00, 0x06252f00, 0x062d2f00, 0x062e2f00,
+        0x062f2f00, 0x06332f00, 0x06342f00, 0x06352f00, 0x06362f00, 0x06372f00,
+        0x06382f00, 0x06392f00, 0x063d2f00, 0x06412f00, 0x065f2f00, 0x06622f00,
+        0x06642f00, 0x06662f00, 0x06672f00, 0x06682f00, 0x066c2f00, 0x066d2f00,
+        0x066e2f00, 0x06702f00, 0x06722f00, 0x06752f00, 0x01002f26, 0x01002f27,
+        0x01002f2c, 0x01002f2d, 0x01002f2f, 0x01002f30, 0x01002f33, 0x01002f34,
+        0x01002f36, 0x01002f37, 0x01002f3b, 0x01002f3c, 0x01002f3e, 0x01002f3f,
+        0x01002f42, 0x01002f43, 0x01002f45, 0x05002f48, 0x02303301, 0x06303316,
+        0x02313301, 0x06313316, 0x02323301, 0x06323316, 0x02613301, 0x06613316,
+        0x02633301, 0x06633316, 0x02653301, 0x06653316, 0x02693301, 0x06693316,
+        0x026f3301, 0x066f3316, 0x02733301, 0x06733316, 0x02743301, 0x06743316,
+        0x06203300, 0x06253300, 0x062d3300, 0x062e3300, 0x062f3300, 0x06333300,
+        0x06343300, 0x06353300, 0x06363300, 0x06373300, 0x06383300, 0x06393300,
+        0x063d3300, 0x06413300, 0x065f3300, 0x06623300, 0x06643300, 0x06663300,
+        0x06673300, 0x06683300, 0x066c3300, 0x066d3300, 0x066e3300, 0x06703300,
+        0x06723300, 0x06753300, 0x01003326, 0x01003327, 0x0100332c, 0x0100332d,
+        0x0100332f, 0x01003330, 0x01003333, 0x01003334, 0x01003336, 0x01003337,
+        0x0100333b, 0x0100333c, 0x0100333e, 0x0100333f, 0x01003342, 0x01003343,
+        0x01003345, 0x05003348, 0x02303401, 0x06303416, 0x02313401, 0x06313416,
+        0x02323401, 0x06323416, 0x02613401, 0x06613416, 0x02633401, 0x06633416,
+        0x02653401, 0x06653416, 0x02693401, 0x06693416, 0x026f3401, 0x066f3416,
+        0x02733401, 0x06733416, 0x02743401, 0x06743416, 0x06203400, 0x06253400,
+        0x062d3400, 0x062e3400, 0x062f3400, 0x06333400, 0x06343400, 0x06353400,
+        0x06363400, 0x06373400, 0x06383400, 0x06393400, 0x063d3400, 0x06413400,
+        0x065f3400, 0x06623400, 0x06643400, 0x06663400, 0x06673400, 0x06683400,
+        0x066c3400, 0x066d3400, 0x066e3400, 0x06703400, 0x06723400, 0x06753400,
+        0x01003426, 0x01003427, 0x0100342c, 0x0100342d, 0x0100342f, 0x01003430,
+        0x01003433, 0x01003434, 0x01003436, 0x01003437, 0x0100343b, 0x0100343c,
+        0x0100343e, 0x0100343f, 0x01003442, 0x01003443, 0x01003445, 0x05003448,
+        0x02303501, 0x06303516, 0x02313501, 0x06313516, 0x02323501, 0x06323516,
+        0x02613501, 0x06613516, 0x02633501, 0x06633516, 0x02653501, 0x06653516,
+        0x02693501, 0x06693516, 0x026f3501, 0x066f3516, 0x02733501, 0x06733516,
+        0x02743501, 0x06743516, 0x06203500, 0x06253500, 0x062d3500, 0x062e3500,
+        0x062f3500, 0x06333500, 0x06343500, 0x06353500, 0x06363500, 0x06373500,
+        0x06383500, 0x06393500, 0x063d3500, 0x06413500, 0x065f3500, 0x06623500,
+        0x06643500, 0x06663500, 0x06673500, 0x06683500, 0x066c3500, 0x066d3500,
+        0x066e3500, 0x06703500, 0x06723500, 0x06753500, 0x01003526, 0x01003527,
+        0x0100352c, 0x0100352d, 0x0100352f, 0x01003530, 0x01003533, 0x01003534,
+        0x01003536, 0x01003537, 0x0100353b, 0x0100353c, 0x0100353e, 0x0100353f,
+        0x01003542, 0x01003543, 0x01003545, 0x05003548
+    },
+    /* 17 */
+    {
+        0x02302f02, 0x02302f09, 0x02302f17, 0x06302f28, 0x02312f02, 0x02312f09,
+        0x02312f17, 0x06312f28, 0x02322f02, 0x02322f09, 0x02322f17, 0x06322f28,
+        0x02612f02, 0x02612f09, 0x02612f17, 0x06612f28, 0x02632f02, 0x02632f09,
+        0x02632f17, 0x06632f28, 0x02652f02, 0x02652f09, 0x02652f17, 0x06652f28,
+        0x02692f02, 0x02692f09, 0x02692f17, 0x06692f28, 0x026f2f02, 0x026f2f09,
+        0x026f2f17, 0x066f2f28, 0x02732f02, 0x02732f09, 0x02732f17, 0x06732f28,
+        0x02742f02, 0x02742f09, 0x02742f17, 0x06742f28, 0x02202f01, 0x06202f16,
+        0x02252f01, 0x06252f16, 0x022d2f01, 0x062d2f16, 0x022e2f01, 0x062e2f16,
+        0x022f2f01, 0x062f2f16, 0x02332f01, 0x06332f16, 0x02342f01, 0x06342f16,
+        0x02352f01, 0x06352f16, 0x02362f01, 0x06362f16, 0x02372f01, 0x06372f16,
+        0x02382f01, 0x06382f16, 0x02392f01, 0x06392f16, 0x023d2f01, 0x063d2f16,
+        0x02412f01, 0x06412f16, 0x025f2f01, 0x065f2f16, 0x02622f01, 0x06622f16,
+        0x02642f01, 0x06642f16, 0x02662f01, 0x06662f16, 0x02672f01, 0x06672f16,
+        0x02682f01, 0x06682f16, 0x026c2f01, 0x066c2f16, 0x026d2f01, 0x066d2f16,
+        0x026e2f01, 0x066e2f16, 0x02702f01, 0x06702f16, 0x02722f01, 0x06722f16,
+        0x02752f01, 0x06752f16, 0x063a2f00, 0x06422f00, 0x06432f00, 0x06442f00,
+        0x06452f00, 0x06462f00, 0x06472f00, 0x06482f00, 0x06492f00, 0x064a2f00,
+        0x064b2f00, 0x064c2f00, 0x064d2f00, 0x064e2f00, 0x064f2f00, 0x06502f00,
+        0x06512f00, 0x06522f00, 0x06532f00, 0x06542f00, 0x06552f00, 0x06562f00,
+        0x06572f00, 0x06592f00, 0x066a2f00, 0x066b2f00, 0x06712f00, 0x06762f00,
+        0x06772f00, 0x06782f00, 0x06792f00, 0x067a2f00, 0x01002f46, 0x01002f47,
+        0x01002f49, 0x05002f4a, 0x02303302, 0x02303309, 0x02303317, 0x06303328,
+        0x02313302, 0x02313309, 0x02313317, 0x06313328, 0x02323302, 0x02323309,
+        0x02323317, 0x06323328, 0x02613302, 0x02613309, 0x02613317, 0x06613328,
+        0x02633302, 0x02633309, 0x02633317, 0x06633328, 0x02653302, 0x02653309,
+        0x02653317, 0x06653328, 0x02693302, 0x02693309, 0x02693317, 0x06693328,
+        0x026f3302, 0x026f3309, 0x026f3317, 0x066f3328, 0x02733302, 0x02733309,
+        0x02733317, 0x06733328, 0x02743302, 0x02743309, 0x02743317, 0x06743328,
+        0x02203301, 0x06203316, 0x02253301, 0x06253316, 0x022d3301, 0x062d3316,
+        0x022e3301, 0x062e3316, 0x022f3301, 0x062f3316, 0x02333301, 0x06333316,
+        0x02343301, 0x06343316, 0x02353301, 0x06353316, 0x02363301, 0x06363316,
+        0x02373301, 0x06373316, 0x02383301, 0x06383316, 0x02393301, 0x06393316,
+        0x023d3301, 0x063d3316, 0x02413301, 0x06413316, 0x025f3301, 0x065f3316,
+        0x02623301, 0x06623316, 0x02643301, 0x06643316, 0x02663301, 0x06663316,
+        0x02673301, 0x06673316, 0x02683301, 0x06683316, 0x026c3301, 0x066c3316,
+        0x026d3301, 0x066d3316, 0x026e3301, 0x066e3316, 0x02703301, 0x06703316,
+        0x02723301, 0x06723316, 0x02753301, 0x06753316, 0x063a3300, 0x06423300,
+        0x06433300, 0x06443300, 0x06453300, 0x06463300, 0x06473300, 0x06483300,
+        0x06493300, 0x064a3300, 0x064b3300, 0x064c3300, 0x064d3300, 0x064e3300,
+        0x064f3300, 0x06503300, 0x06513300, 0x06523300, 0x06533300, 0x06543300,
+        0x06553300, 0x06563300, 0x06573300, 0x06593300, 0x066a3300, 0x066b3300,
+        0x06713300, 0x06763300, 0x06773300, 0x06783300, 0x06793300, 0x067a3300,
+        0x01003346, 0x01003347, 0x01003349, 0x0500334a
+    },
+    /* 18 */
+    {
+        0x02303402, 0x02303409, 0x02303417, 0x06303428, 0x02313402, 0x02313409,
+        0x02313417, 0x06313428, 0x02323402, 0x02323409, 0x02323417, 0x06323428,
+        0x02613402, 0x02613409, 0x02613417, 0x06613428, 0x02633402, 0x02633409,
+        0x02633417, 0x06633428, 0x02653402, 0x02653409, 0x02653417, 0x06653428,
+        0x02693402, 0x02693409, 0x02693417, 0x06693428, 0x026f3402, 0x026f3409,
+        0x026f3417, 0x066f3428, 0x02733402, 0x02733409, 0x02733417, 0x06733428,
+        0x02743402, 0x02743409, 0x02743417, 0x06743428, 0x02203401, 0x06203416,
+        0x02253401, 0x06253416, 0x022d3401, 0x062d3416, 0x022e3401, 0x062e3416,
+        0x022f3401, 0x062f3416, 0x02333401, 0x06333416, 0x02343401, 0x06343416,
+        0x02353401, 0x06353416, 0x02363401, 0x06363416, 0x02373401, 0x06373416,
+        0x02383401, 0x06383416, 0x02393401, 0x06393416, 0x023d3401, 0x063d3416,
+        0x02413401, 0x06413416, 0x025f3401, 0x065f3416, 0x02623401, 0x06623416,
+        0x02643401, 0x06643416, 0x02663401, 0x06663416, 0x02673401, 0x06673416,
+        0x02683401, 0x06683416, 0x026c3401, 0x066c3416, 0x026d3401, 0x066d3416,
+        0x026e3401, 0x066e3416, 0x02703401, 0x06703416, 0x02723401, 0x06723416,
+        0x02753401, 0x06753416, 0x063a3400, 0x06423400, 0x06433400, 0x06443400,
+        0x06453400, 0x06463400, 0x06473400, 0x06483400, 0x06493400, 0x064a3400,
+        0x064b3400, 0x064c3400, 0x064d3400, 0x064e3400, 0x064f3400, 0x06503400,
+        0x06513400, 0x06523400, 0x06533400, 0x06543400, 0x06553400, 0x06563400,
+        0x06573400, 0x06593400, 0x066a3400, 0x066b3400, 0x06713400, 0x06763400,
+        0x06773400, 0x06783400, 0x06793400, 0x067a3400, 0x01003446, 0x01003447,
+        0x01003449, 0x0500344a, 0x02303502, 0x02303509, 0x02303517, 0x06303528,
+        0x02313502, 0x02313509, 0x02313517, 0x06313528, 0x02323502, 0x02323509,
+        0x02323517, 0x06323528, 0x02613502, 0x02613509, 0x02613517, 0x06613528,
+        0x02633502, 0x02633509, 0x02633517, 0x06633528, 0x02653502, 0x02653509,
+        0x02653517, 0x06653528, 0x02693502, 0x02693509, 0x02693517, 0x06693528,
+        0x026f3502, 0x026f3509, 0x026f3517, 0x066f3528, 0x02733502, 0x02733509,
+        0x02733517, 0x06733528, 0x02743502, 0x02743509, 0x02743517, 0x06743528,
+        0x02203501, 0x06203516, 0x02253501, 0x06253516, 0x022d3501, 0x062d3516,
+        0x022e3501, 0x062e3516, 0x022f3501, 0x062f3516, 0x02333501, 0x06333516,
+        0x02343501, 0x06343516, 0x02353501, 0x06353516, 0x02363501, 0x06363516,
+        0x02373501, 0x06373516, 0x02383501, 0x06383516, 0x02393501, 0x06393516,
+        0x023d3501, 0x063d3516, 0x02413501, 0x06413516, 0x025f3501, 0x065f3516,
+        0x02623501, 0x06623516, 0x02643501, 0x06643516, 0x02663501, 0x06663516,
+        0x02673501, 0x06673516, 0x02683501, 0x06683516, 0x026c3501, 0x066c3516,
+        0x026d3501, 0x066d3516, 0x026e3501, 0x066e3516, 0x02703501, 0x06703516,
+        0x02723501, 0x06723516, 0x02753501, 0x06753516, 0x063a3500, 0x06423500,
+        0x06433500, 0x06443500, 0x06453500, 0x06463500, 0x06473500, 0x06483500,
+        0x06493500, 0x064a3500, 0x064b3500, 0x064c3500, 0x064d3500, 0x064e3500,
+        0x064f3500, 0x06503500, 0x06513500, 0x06523500, 0x06533500, 0x06543500,
+        0x06553500, 0x06563500, 0x06573500, 0x06593500, 0x066a3500, 0x066b3500,
+        0x06713500, 0x06763500, 0x06773500, 0x06783500, 0x06793500, 0x067a3500,
+        0x01003546, 0x01003547, 0x01003549, 0x0500354a
+    },
+    /* 19 */
+    {
+        0x02303601, 0x06303616, 0x02313601, 0x06313616, 0x02323601, 0x06323616,
+        0x02613601, 0x06613616, 0x02633601, 0x06633616, 0x02653601, 0x06653616,
+        0x02693601, 0x06693616, 0x026f3601, 0x066f3616, 0x02733601, 0x06733616,
+        0x02743601, 0x06743616, 0x06203600, 0x06253600, 0x062d3600, 0x062e3600,
+        0x062f3600, 0x06333600, 0x06343600, 0x06353600, 0x06363600, 0x06373600,
+        0x06383600, 0x06393600, 0x063d3600, 0x06413600, 0x065f3600, 0x06623600,
+        0x06643600, 0x06663600, 0x06673600, 0x06683600, 0x066c3600, 0x066d3600,
+        0x066e3600, 0x06703600, 0x06723600, 0x06753600, 0x01003626, 0x01003627,
+        0x0100362c, 0x0100362d, 0x0100362f, 0x01003630, 0x01003633, 0x01003634,
+        0x01003636, 0x01003637, 0x0100363b, 0x0100363c, 0x0100363e, 0x0100363f,
+        0x01003642, 0x01003643, 0x01003645, 0x05003648, 0x02303701, 0x06303716,
+        0x02313701, 0x06313716, 0x02323701, 0x06323716, 0x02613701, 0x06613716,
+        0x02633701, 0x06633716, 0x02653701, 0x06653716, 0x02693701, 0x06693716,
+        0x026f3701, 0x066f3716, 0x02733701, 0x06733716, 0x02743701, 0x06743716,
+        0x06203700, 0x06253700, 0x062d3700, 0x062e3700, 0x062f3700, 0x06333700,
+        0x06343700, 0x06353700, 0x06363700, 0x06373700, 0x06383700, 0x06393700,
+        0x063d3700, 0x06413700, 0x065f3700, 0x06623700, 0x06643700, 0x06663700,
+        0x06673700, 0x06683700, 0x066c3700, 0x066d3700, 0x066e3700, 0x06703700,
+        0x06723700, 0x06753700, 0x01003726, 0x01003727, 0x0100372c, 0x0100372d,
+        0x0100372f, 0x01003730, 0x01003733, 0x01003734, 0x01003736, 0x01003737,
+        0x0100373b, 0x0100373c, 0x0100373e, 0x0100373f, 0x01003742, 0x01003743,
+        0x01003745, 0x05003748, 0x02303801, 0x06303816, 0x02313801, 0x06313816,
+        0x02323801, 0x06323816, 0x02613801, 0x06613816, 0x02633801, 0x06633816,
+        0x02653801, 0x06653816, 0x02693801, 0x06693816, 0x026f3801, 0x066f3816,
+        0x02733801, 0x06733816, 0x02743801, 0x06743816, 0x06203800, 0x06253800,
+        0x062d3800, 0x062e3800, 0x062f3800, 0x06333800, 0x06343800, 0x06353800,
+        0x06363800, 0x06373800, 0x06383800, 0x06393800, 0x063d3800, 0x06413800,
+        0x065f3800, 0x06623800, 0x06643800, 0x06663800, 0x06673800, 0x06683800,
+        0x066c3800, 0x066d3800, 0x066e3800, 0x06703800, 0x06723800, 0x06753800,
+        0x01003826, 0x01003827, 0x0100382c, 0x0100382d, 0x0100382f, 0x01003830,
+        0x01003833, 0x01003834, 0x01003836, 0x01003837, 0x0100383b, 0x0100383c,
+        0x0100383e, 0x0100383f, 0x01003842, 0x01003843, 0x01003845, 0x05003848,
+        0x02303901, 0x06303916, 0x02313901, 0x06313916, 0x02323901, 0x06323916,
+        0x02613901, 0x06613916, 0x02633901, 0x06633916, 0x02653901, 0x06653916,
+        0x02693901, 0x06693916, 0x026f3901, 0x066f3916, 0x02733901, 0x06733916,
+        0x02743901, 0x06743916, 0x06203900, 0x06253900, 0x062d3900, 0x062e3900,
+        0x062f3900, 0x06333900, 0x06343900, 0x06353900, 0x06363900, 0x06373900,
+        0x06383900, 0x06393900, 0x063d3900, 0x06413900, 0x065f3900, 0x06623900,
+        0x06643900, 0x06663900, 0x06673900, 0x06683900, 0x066c3900, 0x066d3900,
+        0x066e3900, 0x06703900, 0x06723900, 0x06753900, 0x01003926, 0x01003927,
+        0x0100392c, 0x0100392d, 0x0100392f, 0x01003930, 0x01003933, 0x01003934,
+        0x01003936, 0x01003937, 0x0100393b, 0x0100393c, 0x0100393e, 0x0100393f,
+        0x01003942, 0x01003943, 0x01003945, 0x05003948
+    },
+    /* 20 */
+    {
+        0x02303602, 0x02303609, 0x02303617, 0x06303628, 0x02313602, 0x02313609,
+        0x02313617, 0x06313628, 0x02323602, 0x02323609, 0x02323617, 0x06323628,
+        0x02613602, 0x02613609, 0x02613617, 0x06613628, 0x02633602, 0x02633609,
+        0x02633617, 0x06633628, 0x02653602, 0x02653609, 0x02653617, 0x06653628,
+        0x02693602, 0x02693609, 0x02693617, 0x06693628, 0x026f3602, 0x026f3609,
+        0x026f3617, 0x066f3628, 0x02733602, 0x02733609, 0x02733617, 0x06733628,
+        0x02743602, 0x02743609, 0x02743617, 0x06743628, 0x02203601, 0x06203616,
+        0x02253601, 0x06253616, 0x022d3601, 0x062d3616, 0x022e3601, 0x062e3616,
+        0x022f3601, 0x062f3616, 0x02333601, 0x06333616, 0x02343601, 0x06343616,
+        0x02353601, 0x06353616, 0x02363601, 0x06363616, 0x02373601, 0x06373616,
+        0x02383601, 0x06383616, 0x02393601, 0x06393616, 0x023d3601, 0x063d3616,
+        0x02413601, 0x06413616, 0x025f3601, 0x065f3616, 0x02623601, 0x06623616,
+        0x02643601, 0x06643616, 0x02663601, 0x06663616, 0x02673601, 0x06673616,
+        0x02683601, 0x06683616, 0x026c3601, 0x066c3616, 0x026d3601, 0x066d3616,
+        0x026e3601, 0x066e3616, 0x02703601, 0x06703616, 0x02723601, 0x06723616,
+        0x02753601, 0x06753616, 0x063a3600, 0x06423600, 0x06433600, 0x06443600,
+        0x06453600, 0x06463600, 0x06473600, 0x06483600, 0x06493600, 0x064a3600,
+        0x064b3600, 0x064c3600, 0x064d3600, 0x064e3600, 0x064f3600, 0x06503600,
+        0x06513600, 0x06523600, 0x06533600, 0x06543600, 0x06553600, 0x06563600,
+        0x06573600, 0x06593600, 0x066a3600, 0x066b3600, 0x06713600, 0x06763600,
+        0x06773600, 0x06783600, 0x06793600, 0x067a3600, 0x01003646, 0x01003647,
+        0x01003649, 0x0500364a, 0x02303702, 0x02303709, 0x02303717, 0x06303728,
+        0x02313702, 0x02313709, 0x02313717, 0x06313728, 0x02323702, 0x02323709,
+        0x02323717, 0x06323728, 0x02613702, 0x02613709, 0x02613717, 0x06613728,
+        0x02633702, 0x02633709, 0x02633717, 0x06633728, 0x02653702, 0x02653709,
+        0x02653717, 0x06653728, 0x02693702, 0x02693709, 0x02693717, 0x06693728,
+        0x026f3702, 0x026f3709, 0x026f3717, 0x066f3728, 0x02733702, 0x02733709,
+        0x02733717, 0x06733728, 0x02743702, 0x02743709, 0x02743717, 0x06743728,
+        0x02203701, 0x06203716, 0x02253701, 0x06253716, 0x022d3701, 0x062d3716,
+        0x022e3701, 0x062e3716, 0x022f3701, 0x062f3716, 0x02333701, 0x06333716,
+        0x02343701, 0x06343716, 0x02353701, 0x06353716, 0x02363701, 0x06363716,
+        0x02373701, 0x06373716, 0x02383701, 0x06383716, 0x02393701, 0x06393716,
+        0x023d3701, 0x063d3716, 0x02413701, 0x06413716, 0x025f3701, 0x065f3716,
+        0x02623701, 0x06623716, 0x02643701, 0x06643716, 0x02663701, 0x06663716,
+        0x02673701, 0x06673716, 0x02683701, 0x06683716, 0x026c3701, 0x066c3716,
+        0x026d3701, 0x066d3716, 0x026e3701, 0x066e3716, 0x02703701, 0x06703716,
+        0x02723701, 0x06723716, 0x02753701, 0x06753716, 0x063a3700, 0x06423700,
+        0x06433700, 0x06443700, 0x06453700, 0x06463700, 0x06473700, 0x06483700,
+        0x06493700, 0x064a3700, 0x064b3700, 0x064c3700, 0x064d3700, 0x064e3700,
+        0x064f3700, 0x06503700, 0x06513700, 0x06523700, 0x06533700, 0x06543700,
+        0x06553700, 0x06563700, 0x06573700, 0x06593700, 0x066a3700, 0x066b3700,
+        0x06713700, 0x06763700, 0x06773700, 0x06783700, 0x06793700, 0x067a3700,
+        0x01003746, 0x01003747, 0x01003749, 0x0500374a
+    },
+    /* 21 */
+    {
+        0x02303802, 0x02303809, 0x02303817, 0x06303828, 0x02313802, 0x02313809,
+        0x02313817, 0x06313828, 0x02323802, 0x02323809, 0x02323817, 0x06323828,
+        0x02613802, 0x02613809, 0x02613817, 0x06613828, 0x02633802, 0x02633809,
+        0x02633817, 0x06633828, 0x02653802, 0x02653809, 0x02653817, 0x06653828,
+        0x02693802, 0x02693809, 0x02693817, 0x06693828, 0x026f3802, 0x026f3809,
+        0x026f3817, 0x066f3828, 0x02733802, 0x02733809, 0x02733817, 0x06733828,
+        0x02743802, 0x02743809, 0x02743817, 0x06743828, 0x02203801, 0x06203816,
+        0x02253801, 0x06253816, 0x022d3801, 0x062d3816, 0x022e3801, 0x062e3816,
+        0x022f3801, 0x062f3816, 0x02333801, 0x06333816, 0x02343801, 0x06343816,
+        0x02353801, 0x06353816, 0x02363801, 0x06363816, 0x02373801, 0x06373816,
+        0x02383801, 0x06383816, 0x02393801, 0x06393816, 0x023d3801, 0x063d3816,
+        0x02413801, 0x06413816, 0x025f3801, 0x065f3816, 0x02623801, 0x06623816,
+        0x02643801, 0x06643816, 0x02663801, 0x06663816, 0x02673801, 0x06673816,
+        0x02683801, 0x06683816, 0x026c3801, 0x066c3816, 0x026d3801, 0x066d3816,
+        0x026e3801, 0x066e3816, 0x02703801, 0x06703816, 0x02723801, 0x06723816,
+        0x02753801, 0x06753816, 0x063a3800, 0x06423800, 0x06433800, 0x06443800,
+        0x06453800, 0x06463800, 0x06473800, 0x06483800, 0x06493800, 0x064a3800,
+        0x064b3800, 0x064c3800, 0x064d3800, 0x064e3800, 0x064f3800, 0x06503800,
+        0x06513800, 0x06523800, 0x06533800, 0x06543800, 0x06553800, 0x06563800,
+        0x06573800, 0x06593800, 0x066a3800, 0x066b3800, 0x06713800, 0x06763800,
+        0x06773800, 0x06783800, 0x06793800, 0x067a3800, 0x01003846, 0x01003847,
+        0x01003849, 0x0500384a, 0x02303902, 0x02303909, 0x02303917, 0x06303928,
+        0x02313902, 0x02313909, 0x02313917, 0x06313928, 0x02323902, 0x02323909,
+        0x02323917, 0x06323928, 0x02613902, 0x02613909, 0x02613917, 0x06613928,
+        0x02633902, 0x02633909, 0x02633917, 0x06633928, 0x02653902, 0x02653909,
+        0x02653917, 0x06653928, 0x02693902, 0x02693909, 0x02693917, 0x06693928,
+        0x026f3902, 0x026f3909, 0x026f3917, 0x066f3928, 0x02733902, 0x02733909,
+        0x02733917, 0x06733928, 0x02743902, 0x02743909, 0x02743917, 0x06743928,
+        0x02203901, 0x06203916, 0x02253901, 0x06253916, 0x022d3901, 0x062d3916,
+        0x022e3901, 0x062e3916, 0x022f3901, 0x062f3916, 0x02333901, 0x06333916,
+        0x02343901, 0x06343916, 0x02353901, 0x06353916, 0x02363901, 0x06363916,
+        0x02373901, 0x06373916, 0x02383901, 0x06383916, 0x02393901, 0x06393916,
+        0x023d3901, 0x063d3916, 0x02413901, 0x06413916, 0x025f3901, 0x065f3916,
+        0x02623901, 0x06623916, 0x02643901, 0x06643916, 0x02663901, 0x06663916,
+        0x02673901, 0x06673916, 0x02683901, 0x06683916, 0x026c3901, 0x066c3916,
+        0x026d3901, 0x066d3916, 0x026e3901, 0x066e3916, 0x02703901, 0x06703916,
+        0x02723901, 0x06723916, 0x02753901, 0x06753916, 0x063a3900, 0x06423900,
+        0x06433900, 0x06443900, 0x06453900, 0x06463900, 0x06473900, 0x06483900,
+        0x06493900, 0x064a3900, 0x064b3900, 0x064c3900, 0x064d3900, 0x064e3900,
+        0x064f3900, 0x06503900, 0x06513900, 0x06523900, 0x06533900, 0x06543900,
+        0x06553900, 0x06563900, 0x06573900, 0x06593900, 0x066a3900, 0x066b3900,
+        0x06713900, 0x06763900, 0x06773900, 0x06783900, 0x06793900, 0x067a3900,
+        0x01003946, 0x01003947, 0x01003949, 0x0500394a
+    },
+    /* 22 */
+    {
+        0x01003d03, 0x01003d06, 0x01003d0a, 0x01003d0f, 0x01003d18, 0x01003d1f,
+        0x01003d29, 0x05003d38, 0x01004103, 0x01004106, 0x0100410a, 0x0100410f,
+        0x01004118, 0x0100411f, 0x01004129, 0x05004138, 0x01005f03, 0x01005f06,
+        0x01005f0a, 0x01005f0f, 0x01005f18, 0x01005f1f, 0x01005f29, 0x05005f38,
+        0x01006203, 0x01006206, 0x0100620a, 0x0100620f, 0x01006218, 0x0100621f,
+        0x01006229, 0x05006238, 0x01006403, 0x01006406, 0x0100640a, 0x0100640f,
+        0x01006418, 0x0100641f, 0x01006429, 0x05006438, 0x01006603, 0x01006606,
+        0x0100660a, 0x0100660f, 0x01006618, 0x0100661f, 0x01006629, 0x05006638,
+        0x01006703, 0x01006706, 0x0100670a, 0x0100670f, 0x01006718, 0x0100671f,
+        0x01006729, 0x05006738, 0x01006803, 0x01006806, 0x0100680a, 0x0100680f,
+        0x01006818, 0x0100681f, 0x01006829, 0x05006838, 0x01006c03, 0x01006c06,
+        0x01006c0a, 0x01006c0f, 0x01006c18, 0x01006c1f, 0x01006c29, 0x05006c38,
+        0x01006d03, 0x01006d06, 0x01006d0a, 0x01006d0f, 0x01006d18, 0x01006d1f,
+        0x01006d29, 0x05006d38, 0x01006e03, 0x01006e06, 0x01006e0a, 0x01006e0f,
+        0x01006e18, 0x01006e1f, 0x01006e29, 0x05006e38, 0x01007003, 0x01007006,
+        0x0100700a, 0x0100700f, 0x01007018, 0x0100701f, 0x01007029, 0x05007038,
+        0x01007203, 0x01007206, 0x0100720a, 0x0100720f, 0x01007218, 0x0100721f,
+        0x01007229, 0x05007238, 0x01007503, 0x01007506, 0x0100750a, 0x0100750f,
+        0x01007518, 0x0100751f, 0x01007529, 0x05007538, 0x01003a02, 0x01003a09,
+        0x01003a17, 0x05003a28, 0x01004202, 0x01004209, 0x01004217, 0x05004228,
+        0x01004302, 0x01004309, 0x01004317, 0x05004328, 0x01004402, 0x01004409,
+        0x01004417, 0x05004428, 0x01004502, 0x01004509, 0x01004517, 0x05004528,
+        0x01004602, 0x01004609, 0x01004617, 0x05004628, 0x01004702, 0x01004709,
+        0x01004717, 0x05004728, 0x01004802, 0x01004809, 0x01004817, 0x05004828,
+        0x01004902, 0x01004909, 0x01004917, 0x05004928, 0x01004a02, 0x01004a09,
+        0x01004a17, 0x05004a28, 0x01004b02, 0x01004b09, 0x01004b17, 0x05004b28,
+        0x01004c02, 0x01004c09, 0x01004c17, 0x05004c28, 0x01004d02, 0x01004d09,
+        0x01004d17, 0x05004d28, 0x01004e02, 0x01004e09, 0x01004e17, 0x05004e28,
+        0x01004f02, 0x01004f09, 0x01004f17, 0x05004f28, 0x01005002, 0x01005009,
+        0x01005017, 0x05005028, 0x01005102, 0x01005109, 0x01005117, 0x05005128,
+        0x01005202, 0x01005209, 0x01005217, 0x05005228, 0x01005302, 0x01005309,
+        0x01005317, 0x05005328, 0x01005402, 0x01005409, 0x01005417, 0x05005428,
+        0x01005502, 0x01005509, 0x01005517, 0x05005528, 0x01005602, 0x01005609,
+        0x01005617, 0x05005628, 0x01005702, 0x01005709, 0x01005717, 0x05005728,
+        0x01005902, 0x01005909, 0x01005917, 0x05005928, 0x01006a02, 0x01006a09,
+        0x01006a17, 0x05006a28, 0x01006b02, 0x01006b09, 0x01006b17, 0x05006b28,
+        0x01007102, 0x01007109, 0x01007117, 0x05007128, 0x01007602, 0x01007609,
+        0x01007617, 0x05007628, 0x01007702, 0x01007709, 0x01007717, 0x05007728,
+        0x01007802, 0x01007809, 0x01007817, 0x05007828, 0x01007902, 0x01007909,
+        0x01007917, 0x05007928, 0x01007a02, 0x01007a09, 0x01007a17, 0x05007a28,
+        0x01002601, 0x05002616, 0x01002a01, 0x05002a16, 0x01002c01, 0x05002c16,
+        0x01003b01, 0x05003b16, 0x01005801, 0x05005816, 0x01005a01, 0x05005a16,
+        0x0000004c, 0x0000004d, 0x0000004f, 0x04000051
+    },
+    /* 23 */
+    {
+        0x01003d04, 0x01003d05, 0x01003d07, 0x01003d08, 0x01003d0b, 0x01003d0c,
+        0x01003d10, 0x01003d13, 0x01003d19, 0x01003d1c, 0x01003d20, 0x01003d23,
+        0x01003d2a, 0x01003d31, 0x01003d39, 0x05003d40, 0x01004104, 0x01004105,
+        0x01004107, 0x01004108, 0x0100410b, 0x0100410c, 0x01004110, 0x01004113,
+        0x01004119, 0x0100411c, 0x01004120, 0x01004123, 0x0100412a, 0x01004131,
+        0x01004139, 0x05004140, 0x01005f04, 0x01005f05, 0x01005f07, 0x01005f08,
+        0x01005f0b, 0x01005f0c, 0x01005f10, 0x01005f13, 0x01005f19, 0x01005f1c,
+        0x01005f20, 0x01005f23, 0x01005f2a, 0x01005f31, 0x01005f39, 0x05005f40,
+        0x01006204, 0x01006205, 0x01006207, 0x01006208, 0x0100620b, 0x0100620c,
+        0x01006210, 0x01006213, 0x01006219, 0x0100621c, 0x01006220, 0x01006223,
+        0x0100622a, 0x01006231, 0x01006239, 0x05006240, 0x01006404, 0x01006405,
+        0x01006407, 0x01006408, 0x0100640b, 0x0100640c, 0x01006410, 0x01006413,
+        0x01006419, 0x0100641c, 0x01006420, 0x01006423, 0x0100642a, 0x01006431,
+        0x01006439, 0x05006440, 0x01006604, 0x01006605, 0x01006607, 0x01006608,
+        0x0100660b, 0x0100660c, 0x01006610, 0x01006613, 0x01006619, 0x0100661c,
+        0x01006620, 0x01006623, 0x0100662a, 0x01006631, 0x01006639, 0x05006640,
+        0x01006704, 0x01006705, 0x01006707, 0x01006708, 0x0100670b, 0x0100670c,
+        0x01006710, 0x01006713, 0x01006719, 0x0100671c, 0x01006720, 0x01006723,
+        0x0100672a, 0x01006731, 0x01006739, 0x05006740, 0x01006804, 0x01006805,
+        0x01006807, 0x01006808, 0x0100680b, 0x0100680c, 0x01006810, 0x01006813,
+        0x01006819, 0x0100681c, 0x01006820, 0x01006823, 0x0100682a, 0x01006831,
+        0x01006839, 0x05006840, 0x01006c04, 0x01006c05, 0x01006c07, 0x01006c08,
+        0x01006c0b, 0x01006c0c, 0x01006c10, 0x01006c13, 0x01006c19, 0x01006c1c,
+        0x01006c20, 0x01006c23, 0x01006c2a, 0x01006c31, 0x01006c39, 0x05006c40,
+        0x01006d04, 0x01006d05, 0x01006d07, 0x01006d08, 0x01006d0b, 0x01006d0c,
+        0x01006d10, 0x01006d13, 0x01006d19, 0x01006d1c, 0x01006d20, 0x01006d23,
+        0x01006d2a, 0x01006d31, 0x01006d39, 0x05006d40, 0x01006e04, 0x01006e05,
+        0x01006e07, 0x01006e08, 0x01006e0b, 0x01006e0c, 0x01006e10, 0x01006e13,
+        0x01006e19, 0x01006e1c, 0x01006e20, 0x01006e23, 0x01006e2a, 0x01006e31,
+        0x01006e39, 0x05006e40, 0x01007004, 0x01007005, 0x01007007, 0x01007008,
+        0x0100700b, 0x0100700c, 0x01007010, 0x01007013, 0x01007019, 0x0100701c,
+        0x01007020, 0x01007023, 0x0100702a, 0x01007031, 0x01007039, 0x05007040,
+        0x01007204, 0x01007205, 0x01007207, 0x01007208, 0x0100720b, 0x0100720c,
+        0x01007210, 0x01007213, 0x01007219, 0x0100721c, 0x01007220, 0x01007223,
+        0x0100722a, 0x01007231, 0x01007239, 0x05007240, 0x01007504, 0x01007505,
+        0x01007507, 0x01007508, 0x0100750b, 0x0100750c, 0x01007510, 0x01007513,
+        0x01007519, 0x0100751c, 0x01007520, 0x01007523, 0x0100752a, 0x01007531,
+        0x01007539, 0x05007540, 0x01003a03, 0x01003a06, 0x01003a0a, 0x01003a0f,
+        0x01003a18, 0x01003a1f, 0x01003a29, 0x05003a38, 0x01004203, 0x01004206,
+        0x0100420a, 0x0100420f, 0x01004218, 0x0100421f, 0x01004229, 0x05004238,
+        0x01004303, 0x01004306, 0x0100430a, 0x0100430f, 0x01004318, 0x0100431f,
+        0x01004329, 0x05004338, 0x01004403, 0x01004406, 0x0100440a, 0x0100440f,
+        0x01004418, 0x0100441f, 0x01004429, 0x05004438
+    },
+    /* 24 */
+    {
+        0x06303d00, 0x06313d00, 0x06323d00, 0x06613d00, 0x06633d00, 0x06653d00,
+        0x06693d00, 0x066f3d00, 0x06733d00, 0x06743d00, 0x01003d0d, 0x01003d0e,
+        0x01003d11, 0x01003d12, 0x01003d14, 0x01003d15, 0x01003d1a, 0x01003d1b,
+        0x01003d1d, 0x01003d1e, 0x01003d21, 0x01003d22, 0x01003d24, 0x01003d25,
+        0x01003d2b, 0x01003d2e, 0x01003d32, 0x01003d35, 0x01003d3a, 0x01003d3d,
+        0x01003d41, 0x05003d44, 0x06304100, 0x06314100, 0x06324100, 0x06614100,
+        0x06634100, 0x06654100, 0x06694100, 0x066f4100, 0x06734100, 0x06744100,
+        0x0100410d, 0x0100410e, 0x01004111, 0x01004112, 0x01004114, 0x01004115,
+        0x0100411a, 0x0100411b, 0x0100411d, 0x0100411e, 0x01004121, 0x01004122,
+        0x01004124, 0x01004125, 0x0100412b, 0x0100412e, 0x01004132, 0x01004135,
+        0x0100413a, 0x0100413d, 0x01004141, 0x05004144, 0x06305f00, 0x06315f00,
+        0x06325f00, 0x06615f00, 0x06635f00, 0x06655f00, 0x06695f00, 0x066f5f00,
+        0x06735f00, 0x06745f00, 0x01005f0d, 0x01005f0e, 0x01005f11, 0x01005f12,
+        0x01005f14, 0x01005f15, 0x01005f1a, 0x01005f1b, 0x01005f1d, 0x01005f1e,
+        0x01005f21, 0x01005f22, 0x01005f24, 0x01005f25, 0x01005f2b, 0x01005f2e,
+        0x01005f32, 0x01005f35, 0x01005f3a, 0x01005f3d, 0x01005f41, 0x05005f44,
+        0x06306200, 0x06316200, 0x06326200, 0x06616200, 0x06636200, 0x06656200,
+        0x06696200, 0x066f6200, 0x06736200, 0x06746200, 0x0100620d, 0x0100620e,
+        0x01006211, 0x01006212, 0x01006214, 0x01006215, 0x0100621a, 0x0100621b,
+        0x0100621d, 0x0100621e, 0x01006221, 0x01006222, 0x01006224, 0x01006225,
+        0x0100622b, 0x0100622e, 0x01006232, 0x01006235, 0x0100623a, 0x0100623d,
+        0x01006241, 0x05006244, 0x06306400, 0x06316400, 0x06326400, 0x06616400,
+        0x06636400, 0x06656400, 0x06696400, 0x066f6400, 0x06736400, 0x06746400,
+        0x0100640d, 0x0100640e, 0x01006411, 0x01006412, 0x01006414, 0x01006415,
+        0x0100641a, 0x0100641b, 0x0100641d, 0x0100641e, 0x01006421, 0x01006422,
+        0x01006424, 0x01006425, 0x0100642b, 0x0100642e, 0x01006432, 0x01006435,
+        0x0100643a, 0x0100643d, 0x01006441, 0x05006444, 0x06306600, 0x06316600,
+        0x06326600, 0x06616600, 0x06636600, 0x06656600, 0x06696600, 0x066f6600,
+        0x06736600, 0x06746600, 0x0100660d, 0x0100660e, 0x01006611, 0x01006612,
+        0x01006614, 0x01006615, 0x0100661a, 0x0100661b, 0x0100661d, 0x0100661e,
+        0x01006621, 0x01006622, 0x01006624, 0x01006625, 0x0100662b, 0x0100662e,
+        0x01006632, 0x01006635, 0x0100663a, 0x0100663d, 0x01006641, 0x05006644,
+        0x06306700, 0x06316700, 0x06326700, 0x06616700, 0x06636700, 0x06656700,
+        0x06696700, 0x066f6700, 0x06736700, 0x06746700, 0x0100670d, 0x0100670e,
+        0x01006711, 0x01006712, 0x01006714, 0x01006715, 0x0100671a, 0x0100671b,
+        0x0100671d, 0x0100671e, 0x01006721, 0x01006722, 0x01006724, 0x01006725,
+        0x0100672b, 0x0100672e, 0x01006732, 0x01006735, 0x0100673a, 0x0100673d,
+        0x01006741, 0x05006744, 0x06306800, 0x06316800, 0x06326800, 0x06616800,
+        0x06636800, 0x06656800, 0x06696800, 0x066f6800, 0x06736800, 0x06746800,
+        0x0100680d, 0x0100680e, 0x01006811, 0x01006812, 0x01006814, 0x01006815,
+        0x0100681a, 0x0100681b, 0x0100681d, 0x0100681e, 0x01006821, 0x01006822,
+        0x01006824, 0x01006825, 0x0100682b, 0x0100682e, 0x01006832, 0x01006835,
+        0x0100683a, 0x0100683d, 0x01006841, 0x05006844
+    },
+    /* 25 */
+    {
+        0x02303d01, 0x06303d16, 0x02313d01, 0x06313d16, 0x02323d01, 0x06323d16,
+        0x02613d01, 0x06613d16, 0x02633d01, 0x06633d16, 0x02653d01, 0x06653d16,
+        0x02693d01, 0x06693d16, 0x026f3d01, 0x066f3d16, 0x02733d01, 0x06733d16,
+        0x02743d01, 0x06743d16, 0x06203d00, 0x06253d00, 0x062d3d00, 0x062e3d00,
+        0x062f3d00, 0x06333d00, 0x06343d00, 0x06353d00, 0x06363d00, 0x06373d00,
+        0x06383d00, 0x06393d00, 0x063d3d00, 0x06413d00, 0x065f3d00, 0x06623d00,
+        0x06643d00, 0x06663d00, 0x06673d00, 0x06683d00, 0x066c3d00, 0x066d3d00,
+        0x066e3d00, 0x06703d00, 0x06723d00, 0x06753d00, 0x01003d26, 0x01003d27,
+        0x01003d2c, 0x01003d2d, 0x01003d2f, 0x01003d30, 0x01003d33, 0x01003d34,
+        0x01003d36, 0x01003d37, 0x01003d3b, 0x01003d3c, 0x01003d3e, 0x01003d3f,
+        0x01003d42, 0x01003d43, 0x01003d45, 0x05003d48, 0x02304101, 0x06304116,
+        0x02314101, 0x06314116, 0x02324101, 0x06324116, 0x02614101, 0x06614116,
+        0x02634101, 0x06634116, 0x02654101, 0x06654116, 0x02694101, 0x06694116,
+        0x026f4101, 0x066f4116, 0x02734101, 0x06734116, 0x02744101, 0x06744116,
+        0x06204100, 0x06254100, 0x062d4100, 0x062e4100, 0x062f4100, 0x06334100,
+        0x06344100, 0x06354100, 0x06364100, 0x06374100, 0x06384100, 0x06394100,
+        0x063d4100, 0x06414100, 0x065f4100, 0x06624100, 0x06644100, 0x06664100,
+        0x06674100, 0x06684100, 0x066c4100, 0x066d4100, 0x066e4100, 0x06704100,
+        0x06724100, 0x06754100, 0x01004126, 0x01004127, 0x0100412c, 0x0100412d,
+        0x0100412f, 0x01004130, 0x01004133, 0x01004134, 0x01004136, 0x01004137,
+        0x0100413b, 0x0100413c, 0x0100413e, 0x0100413f, 0x01004142, 0x01004143,
+        0x01004145, 0x05004148, 0x02305f01, 0x06305f16, 0x02315f01, 0x06315f16,
+        0x02325f01, 0x06325f16, 0x02615f01, 0x06615f16, 0x02635f01, 0x06635f16,
+        0x02655f01, 0x06655f16, 0x02695f01, 0x06695f16, 0x026f5f01, 0x066f5f16,
+        0x02735f01, 0x06735f16, 0x02745f01, 0x06745f16, 0x06205f00, 0x06255f00,
+        0x062d5f00, 0x062e5f00, 0x062f5f00, 0x06335f00, 0x06345f00, 0x06355f00,
+        0x06365f00, 0x06375f00, 0x06385f00, 0x06395f00, 0x063d5f00, 0x06415f00,
+        0x065f5f00, 0x06625f00, 0x06645f00, 0x06665f00, 0x06675f00, 0x06685f00,
+        0x066c5f00, 0x066d5f00, 0x066e5f00, 0x06705f00, 0x06725f00, 0x06755f00,
+        0x01005f26, 0x01005f27, 0x01005f2c, 0x01005f2d, 0x01005f2f, 0x01005f30,
+        0x01005f33, 0x01005f34, 0x01005f36, 0x01005f37, 0x01005f3b, 0x01005f3c,
+        0x01005f3e, 0x01005f3f, 0x01005f42, 0x01005f43, 0x01005f45, 0x05005f48,
+        0x02306201, 0x06306216, 0x02316201, 0x06316216, 0x02326201, 0x06326216,
+        0x02616201, 0x06616216, 0x02636201, 0x06636216, 0x02656201, 0x06656216,
+        0x02696201, 0x06696216, 0x026f6201, 0x066f6216, 0x02736201, 0x06736216,
+        0x02746201, 0x06746216, 0x06206200, 0x06256200, 0x062d6200, 0x062e6200,
+        0x062f6200, 0x06336200, 0x06346200, 0x06356200, 0x06366200, 0x06376200,
+        0x06386200, 0x06396200, 0x063d6200, 0x06416200, 0x065f6200, 0x06626200,
+        0x06646200, 0x06666200, 0x06676200, 0x06686200, 0x066c6200, 0x066d6200,
+        0x066e6200, 0x06706200, 0x06726200, 0x06756200, 0x01006226, 0x01006227,
+        0x0100622c, 0x0100622d, 0x0100622f, 0x01006230, 0x01006233, 0x01006234,
+        0x01006236, 0x01006237, 0x0100623b, 0x0100623c, 0x0100623e, 0x0100623f,
+        0x01006242, 0x01006243, 0x01006245, 0x05006248
+    },
+    /* 26 */
+    {
+        0x02303d02, 0x02303d09, 0x02303d17, 0x06303d28, 0x02313d02, 0x02313d09,
+        0x02313d17, 0x06313d28, 0x02323d02, 0x02323d09, 0x02323d17, 0x06323d28,
+        0x02613d02, 0x02613d09, 0x02613d17, 0x06613d28, 0x02633d02, 0x02633d09,
+        0x02633d17, 0x06633d28, 0x02653d02, 0x02653d09, 0x02653d17, 0x06653d28,
+        0x02693d02, 0x02693d09, 0x02693d17, 0x06693d28, 0x026f3d02, 0x026f3d09,
+        0x026f3d17, 0x066f3d28, 0x02733d02, 0x02733d09, 0x02733d17, 0x06733d28,
+        0x02743d02, 0x02743d09, 0x02743d17, 0x06743d28, 0x02203d01, 0x06203d16,
+        0x02253d01, 0x06253d16, 0x022d3d01, 0x062d3d16, 0x022e3d01, 0x062e3d16,
+        0x022f3d01, 0x062f3d16, 0x02333d01, 0x06333d16, 0x02343d01, 0x06343d16,
+        0x02353d01, 0x06353d16, 0x02363d01, 0x06363d16, 0x02373d01, 0x06373d16,
+        0x02383d01, 0x06383d16, 0x02393d01, 0x06393d16, 0x023d3d01, 0x063d3d16,
+        0x02413d01, 0x06413d16, 0x025f3d01, 0x065f3d16, 0x02623d01, 0x06623d16,
+        0x02643d01, 0x06643d16, 0x02663d01, 0x06663d16, 0x02673d01, 0x06673d16,
+        0x02683d01, 0x06683d16, 0x026c3d01, 0x066c3d16, 0x026d3d01, 0x066d3d16,
+        0x026e3d01, 0x066e3d16, 0x02703d01, 0x06703d16, 0x02723d01, 0x06723d16,
+        0x02753d01, 0x06753d16, 0x063a3d00, 0x06423d00, 0x06433d00, 0x06443d00,
+        0x06453d00, 0x06463d00, 0x06473d00, 0x06483d00, 0x06493d00, 0x064a3d00,
+        0x064b3d00, 0x064c3d00, 0x064d3d00, 0x064e3d00, 0x064f3d00, 0x06503d00,
+        0x06513d00, 0x06523d00, 0x06533d00, 0x06543d00, 0x06553d00, 0x06563d00,
+        0x06573d00, 0x06593d00, 0x066a3d00, 0x066b3d00, 0x06713d00, 0x06763d00,
+        0x06773d00, 0x06783d00, 0x06793d00, 0x067a3d00, 0x01003d46, 0x01003d47,
+        0x01003d49, 0x05003d4a, 0x02304102, 0x02304109, 0x02304117, 0x06304128,
+        0x02314102, 0x02314109, 0x02314117, 0x06314128, 0x02324102, 0x02324109,
+        0x02324117, 0x06324128, 0x02614102, 0x02614109, 0x02614117, 0x06614128,
+        0x02634102, 0x02634109, 0x02634117, 0x06634128, 0x02654102, 0x02654109,
+        0x02654117, 0x06654128, 0x02694102, 0x02694109, 0x02694117, 0x06694128,
+        0x026f4102, 0x026f4109, 0x026f4117, 0x066f4128, 0x02734102, 0x02734109,
+        0x02734117, 0x06734128, 0x02744102, 0x02744109, 0x02744117, 0x06744128,
+        0x02204101, 0x06204116, 0x02254101, 0x06254116, 0x022d4101, 0x062d4116,
+        0x022e4101, 0x062e4116, 0x022f4101, 0x062f4116, 0x02334101, 0x06334116,
+        0x02344101, 0x06344116, 0x02354101, 0x06354116, 0x02364101, 0x06364116,
+        0x02374101, 0x06374116, 0x02384101, 0x06384116, 0x02394101, 0x06394116,
+        0x023d4101, 0x063d4116, 0x02414101, 0x06414116, 0x025f4101, 0x065f4116,
+        0x02624101, 0x06624116, 0x02644101, 0x06644116, 0x02664101, 0x06664116,
+        0x02674101, 0x06674116, 0x02684101, 0x06684116, 0x026c4101, 0x066c4116,
+        0x026d4101, 0x066d4116, 0x026e4101, 0x066e4116, 0x02704101, 0x06704116,
+        0x02724101, 0x06724116, 0x02754101, 0x06754116, 0x063a4100, 0x06424100,
+        0x06434100, 0x06444100, 0x06454100, 0x06464100, 0x06474100, 0x06484100,
+        0x06494100, 0x064a4100, 0x064b4100, 0x064c4100, 0x064d4100, 0x064e4100,
+        0x064f4100, 0x06504100, 0x06514100, 0x06524100, 0x06534100, 0x06544100,
+        0x06554100, 0x06564100, 0x06574100, 0x06594100, 0x066a4100, 0x066b4100,
+        0x06714100, 0x06764100, 0x06774100, 0x06784100, 0x06794100, 0x067a4100,
+        0x01004146, 0x01004147, 0x01004149, 0x0500414a
+    },
+    /* 27 */
+    {
+        0x02305f02, 0x02305f09, 0x02305f17, 0x06305f28, 0x02315f02, 0x02315f09,
+        0x02315f17, 0x06315f28, 0x02325f02, 0x02325f09, 0x02325f17, 0x06325f28,
+        0x02615f02, 0x02615f09, 0x02615f17, 0x06615f28, 0x02635f02, 0x02635f09,
+        0x02635f17, 0x06635f28, 0x02655f02, 0x02655f09, 0x02655f17, 0x06655f28,
+        0x02695f02, 0x02695f09, 0x02695f17, 0x06695f28, 0x026f5f02, 0x026f5f09,
+        0x026f5f17, 0x066f5f28, 0x02735f02, 0x02735f09, 0x02735f17, 0x06735f28,
+        0x02745f02, 0x02745f09, 0x02745f17, 0x06745f28, 0x02205f01, 0x06205f16,
+        0x02255f01, 0x06255f16, 0x022d5f01, 0x062d5f16, 0x022e5f01, 0x062e5f16,
+        0x022f5f01, 0x062f5f16, 0x02335f01, 0x06335f16, 0x02345f01, 0x06345f16,
+        0x02355f01, 0x06355f16, 0x02365f01, 0x06365f16, 0x02375f01, 0x06375f16,
+        0x02385f01, 0x06385f16, 0x02395f01, 0x06395f16, 0x023d5f01, 0x063d5f16,
+        0x02415f01, 0x06415f16, 0x025f5f01, 0x065f5f16, 0x02625f01, 0x06625f16,
+        0x02645f01, 0x06645f16, 0x02665f01, 0x06665f16, 0x02675f01, 0x06675f16,
+        0x02685f01, 0x06685f16, 0x026c5f01, 0x066c5f16, 0x026d5f01, 0x066d5f16,
+        0x026e5f01, 0x066e5f16, 0x02705f01, 0x06705f16, 0x02725f01, 0x06725f16,
+        0x02755f01, 0x06755f16, 0x063a5f00, 0x06425f00, 0x06435f00, 0x06445f00,
+        0x06455f00, 0x06465f00, 0x06475f00, 0x06485f00, 0x06495f00, 0x064a5f00,
+        0x064b5f00, 0x064c5f00, 0x064d5f00, 0x064e5f00, 0x064f5f00, 0x06505f00,
+        0x06515f00, 0x06525f00, 0x06535f00, 0x06545f00, 0x06555f00, 0x06565f00,
+        0x06575f00, 0x06595f00, 0x066a5f00, 0x066b5f00, 0x06715f00, 0x06765f00,
+        0x06775f00, 0x06785f00, 0x06795f00, 0x067a5f00, 0x01005f46, 0x01005f47,
+        0x01005f49, 0x05005f4a, 0x02306202, 0x02306209, 0x02306217, 0x06306228,
+        0x02316202, 0x02316209, 0x02316217, 0x06316228, 0x02326202, 0x02326209,
+        0x02326217, 0x06326228, 0x02616202, 0x02616209, 0x02616217, 0x06616228,
+        0x02636202, 0x02636209, 0x02636217, 0x06636228, 0x02656202, 0x02656209,
+        0x02656217, 0x06656228, 0x02696202, 0x02696209, 0x02696217, 0x06696228,
+        0x026f6202, 0x026f6209, 0x026f6217, 0x066f6228, 0x02736202, 0x02736209,
+        0x02736217, 0x06736228, 0x02746202, 0x02746209, 0x02746217, 0x06746228,
+        0x02206201, 0x06206216, 0x02256201, 0x06256216, 0x022d6201, 0x062d6216,
+        0x022e6201, 0x062e6216, 0x022f6201, 0x062f6216, 0x02336201, 0x06336216,
+        0x02346201, 0x06346216, 0x02356201, 0x06356216, 0x02366201, 0x06366216,
+        0x02376201, 0x06376216, 0x02386201, 0x06386216, 0x02396201, 0x06396216,
+        0x023d6201, 0x063d6216, 0x02416201, 0x06416216, 0x025f6201, 0x065f6216,
+        0x02626201, 0x06626216, 0x02646201, 0x06646216, 0x02666201, 0x06666216,
+        0x02676201, 0x06676216, 0x02686201, 0x06686216, 0x026c6201, 0x066c6216,
+        0x026d6201, 0x066d6216, 0x026e6201, 0x066e6216, 0x02706201, 0x06706216,
+        0x02726201, 0x06726216, 0x02756201, 0x06756216, 0x063a6200, 0x06426200,
+        0x06436200, 0x06446200, 0x06456200, 0x06466200, 0x06476200, 0x06486200,
+        0x06496200, 0x064a6200, 0x064b6200, 0x064c6200, 0x064d6200, 0x064e6200,
+        0x064f6200, 0x06506200, 0x06516200, 0x06526200, 0x06536200, 0x06546200,
+        0x06556200, 0x06566200, 0x06576200, 0x06596200, 0x066a6200, 0x066b6200,
+        0x06716200, 0x06766200, 0x06776200, 0x06786200, 0x06796200, 0x067a6200,
+        0x01006246, 0x01006247, 0x01006249, 0x0500624a
+    },
+    /* 28 */
+    {
+        0x02306401, 0x06306416, 0x02316401, 0x06316416, 0x02326401, 0x06326416,
+        0x02616401, 0x06616416, 0x02636401, 0x06636416, 0x02656401, 0x06656416,
+        0x02696401, 0x06696416, 0x026f6401, 0x066f6416, 0x02736401, 0x06736416,
+        0x02746401, 0x06746416, 0x06206400, 0x06256400, 0x062d6400, 0x062e6400,
+        0x062f6400, 0x06336400, 0x06346400, 0x06356400, 0x06366400, 0x06376400,
+        0x06386400, 0x06396400, 0x063d6400, 0x06416400, 0x065f6400, 0x06626400,
+        0x06646400, 0x06666400, 0x06676400, 0x06686400, 0x066c6400, 0x066d6400,
+        0x066e6400, 0x06706400, 0x06726400, 0x06756400, 0x01006426, 0x01006427,
+        0x0100642c, 0x0100642d, 0x0100642f, 0x01006430, 0x01006433, 0x01006434,
+        0x01006436, 0x01006437, 0x0100643b, 0x0100643c, 0x0100643e, 0x0100643f,
+        0x01006442, 0x01006443, 0x01006445, 0x05006448, 0x02306601, 0x06306616,
+        0x02316601, 0x06316616, 0x02326601, 0x06326616, 0x02616601, 0x06616616,
+        0x02636601, 0x06636616, 0x02656601, 0x06656616, 0x02696601, 0x06696616,
+        0x026f6601, 0x066f6616, 0x02736601, 0x06736616, 0x02746601, 0x06746616,
+        0x06206600, 0x06256600, 0x062d6600, 0x062e6600, 0x062f6600, 0x06336600,
+        0x06346600, 0x06356600, 0x06366600, 0x06376600, 0x06386600, 0x06396600,
+        0x063d6600, 0x06416600, 0x065f6600, 0x06626600, 0x06646600, 0x06666600,
+        0x06676600, 0x06686600, 0x066c6600, 0x066d6600, 0x066e6600, 0x06706600,
+        0x06726600, 0x06756600, 0x01006626, 0x01006627, 0x0100662c, 0x0100662d,
+        0x0100662f, 0x01006630, 0x01006633, 0x01006634, 0x01006636, 0x01006637,
+        0x0100663b, 0x0100663c, 0x0100663e, 0x0100663f, 0x01006642, 0x01006643,
+        0x01006645, 0x05006648, 0x02306701, 0x06306716, 0x02316701, 0x06316716,
+        0x02326701, 0x06326716, 0x02616701, 0x06616716, 0x02636701, 0x06636716,
+        0x02656701, 0x06656716, 0x02696701, 0x06696716, 0x026f6701, 0x066f6716,
+        0x02736701, 0x06736716, 0x02746701, 0x06746716, 0x06206700, 0x06256700,
+        0x062d6700, 0x062e6700, 0x062f6700, 0x06336700, 0x06346700, 0x06356700,
+        0x06366700, 0x06376700, 0x06386700, 0x06396700, 0x063d6700, 0x06416700,
+        0x065f6700, 0x06626700, 0x06646700, 0x06666700, 0x06676700, 0x06686700,
+        0x066c6700, 0x066d6700, 0x066e6700, 0x06706700, 0x06726700, 0x06756700,
+        0x01006726, 0x01006727, 0x0100672c, 0x0100672d, 0x0100672f, 0x01006730,
+        0x01006733, 0x01006734, 0x01006736, 0x01006737, 0x0100673b, 0x0100673c,
+        0x0100673e, 0x0100673f, 0x01006742, 0x01006743, 0x01006745, 0x05006748,
+        0x02306801, 0x06306816, 0x02316801, 0x06316816, 0x02326801, 0x06326816,
+        0x02616801, 0x06616816, 0x02636801, 0x06636816, 0x02656801, 0x06656816,
+        0x02696801, 0x06696816, 0x026f6801, 0x066f6816, 0x02736801, 0x06736816,
+        0x02746801, 0x06746816, 0x06206800, 0x06256800, 0x062d6800, 0x062e6800,
+        0x062f6800, 0x06336800, 0x06346800, 0x06356800, 0x06366800, 0x06376800,
+        0x06386800, 0x06396800, 0x063d6800, 0x06416800, 0x065f6800, 0x06626800,
+        0x06646800, 0x06666800, 0x06676800, 0x06686800, 0x066c6800, 0x066d6800,
+        0x066e6800, 0x06706800, 0x06726800, 0x06756800, 0x01006826, 0x01006827,
+        0x0100682c, 0x0100682d, 0x0100682f, 0x01006830, 0x01006833, 0x01006834,
+        0x01006836, 0x01006837, 0x0100683b, 0x0100683c, 0x0100683e, 0x0100683f,
+        0x01006842, 0x01006843, 0x01006845, 0x05006848
+    },
+    /* 29 */
+    {
+        0x02306402, 0x02306409, 0x02306417, 0x06306428, 0x02316402, 0x02316409,
+        0x02316417, 0x06316428, 0x02326402, 0x02326409, 0x02326417, 0x06326428,
+        0x02616402, 0x02616409, 0x02616417, 0x06616428, 0x02636402, 0x02636409,
+        0x02636417, 0x06636428, 0x02656402, 0x02656409, 0x02656417, 0x06656428,
+        0x02696402, 0x02696409, 0x02696417, 0x06696428, 0x026f6402, 0x026f6409,
+        0x026f6417, 0x066f6428, 0x02736402, 0x02736409, 0x02736417, 0x06736428,
+        0x02746402, 0x02746409, 0x02746417, 0x06746428, 0x02206401, 0x06206416,
+        0x02256401, 0x06256416, 0x022d6401, 0x062d6416, 0x022e6401, 0x062e6416,
+        0x022f6401, 0x062f6416, 0x02336401, 0x06336416, 0x02346401, 0x06346416,
+        0x02356401, 0x06356416, 0x02366401, 0x06366416, 0x02376401, 0x06376416,
+        0x02386401, 0x06386416, 0x02396401, 0x06396416, 0x023d6401, 0x063d6416,
+        0x02416401, 0x06416416, 0x025f6401, 0x065f6416, 0x02626401, 0x06626416,
+        0x02646401, 0x06646416, 0x02666401, 0x06666416, 0x02676401, 0x06676416,
+        0x02686401, 0x06686416, 0x026c6401, 0x066c6416, 0x026d6401, 0x066d6416,
+        0x026e6401, 0x066e6416, 0x02706401, 0x06706416, 0x02726401, 0x06726416,
+        0x02756401, 0x06756416, 0x063a6400, 0x06426400, 0x06436400, 0x06446400,
+        0x06456400, 0x06466400, 0x06476400, 0x06486400, 0x06496400, 0x064a6400,
+        0x064b6400, 0x064c6400, 0x064d6400, 0x064e6400, 0x064f6400, 0x06506400,
+        0x06516400, 0x06526400, 0x06536400, 0x06546400, 0x06556400, 0x06566400,
+        0x06576400, 0x06596400, 0x066a6400, 0x066b6400, 0x06716400, 0x06766400,
+        0x06776400, 0x06786400, 0x06796400, 0x067a6400, 0x01006446, 0x01006447,
+        0x01006449, 0x0500644a, 0x02306602, 0x02306609, 0x02306617, 0x06306628,
+        0x02316602, 0x02316609, 0x02316617, 0x06316628, 0x02326602, 0x02326609,
+        0x02326617, 0x06326628, 0x02616602, 0x02616609, 0x02616617, 0x06616628,
+        0x02636602, 0x02636609, 0x02636617, 0x06636628, 0x02656602, 0x02656609,
+        0x02656617, 0x06656628, 0x02696602, 0x02696609, 0x02696617, 0x06696628,
+        0x026f6602, 0x026f6609, 0x026f6617, 0x066f6628, 0x02736602, 0x02736609,
+        0x02736617, 0x06736628, 0x02746602, 0x02746609, 0x02746617, 0x06746628,
+        0x02206601, 0x06206616, 0x02256601, 0x06256616, 0x022d6601, 0x062d6616,
+        0x022e6601, 0x062e6616, 0x022f6601, 0x062f6616, 0x02336601, 0x06336616,
+        0x02346601, 0x06346616, 0x02356601, 0x06356616, 0x02366601, 0x06366616,
+        0x02376601, 0x06376616, 0x02386601, 0x06386616, 0x02396601, 0x06396616,
+        0x023d6601, 0x063d6616, 0x02416601, 0x06416616, 0x025f6601, 0x065f6616,
+        0x02626601, 0x06626616, 0x02646601, 0x06646616, 0x02666601, 0x06666616,
+        0x02676601, 0x06676616, 0x02686601, 0x06686616, 0x026c6601, 0x066c6616,
+        0x026d6601, 0x066d6616, 0x026e6601, 0x066e6616, 0x02706601, 0x06706616,
+        0x02726601, 0x06726616, 0x02756601, 0x06756616, 0x063a6600, 0x06426600,
+        0x06436600, 0x06446600, 0x06456600, 0x06466600, 0x06476600, 0x06486600,
+        0x06496600, 0x064a6600, 0x064b6600, 0x064c6600, 0x064d6600, 0x064e6600,
+        0x064f6600, 0x06506600, 0x06516600, 0x06526600, 0x06536600, 0x06546600,
+        0x06556600, 0x06566600, 0x06576600, 0x06596600, 0x066a6600, 0x066b6600,
+        0x06716600, 0x06766600, 0x06776600, 0x06786600, 0x06796600, 0x067a6600,
+        0x01006646, 0x01006647, 0x01006649, 0x0500664a
+    },
+    /* 30 */
+    {
+        0x02306702, 0x02306709, 0x02306717, 0x06306728, 0x02316702, 0x02316709,
+        0x02316717, 0x06316728, 0x02326702, 0x02326709, 0x02326717, 0x06326728,
+        0x02616702, 0x02616709, 0x02616717, 0x06616728, 0x02636702, 0x02636709,
+        0x02636717, 0x06636728, 0x02656702, 0x02656709, 0x02656717, 0x06656728,
+        0x02696702, 0x02696709, 0x02696717, 0x06696728, 0x026f6702, 0x026f6709,
+        0x026f6717, 0x066f6728, 0x02736702, 0x02736709, 0x02736717, 0x06736728,
+        0x02746702, 0x02746709, 0x02746717, 0x06746728, 0x02206701, 0x06206716,
+        0x02256701, 0x06256716, 0x022d6701, 0x062d6716, 0x022e6701, 0x062e6716,
+        0x022f6701, 0x062f6716, 0x02336701, 0x06336716, 0x02346701, 0x06346716,
+        0x02356701, 0x06356716, 0x02366701, 0x06366716, 0x02376701, 0x06376716,
+        0x02386701, 0x06386716, 0x02396701, 0x06396716, 0x023d6701, 0x063d6716,
+        0x02416701, 0x06416716, 0x025f6701, 0x065f6716, 0x02626701, 0x06626716,
+        0x02646701, 0x06646716, 0x02666701, 0x06666716, 0x02676701, 0x06676716,
+        0x02686701, 0x06686716, 0x026c6701, 0x066c6716, 0x026d6701, 0x066d6716,
+        0x026e6701, 0x066e6716, 0x02706701, 0x06706716, 0x02726701, 0x06726716,
+        0x02756701, 0x06756716, 0x063a6700, 0x06426700, 0x06436700, 0x06446700,
+        0x06456700, 0x06466700, 0x06476700, 0x06486700, 0x06496700, 0x064a6700,
+        0x064b6700, 0x064c6700, 0x064d6700, 0x064e6700, 0x064f6700, 0x06506700,
+        0x06516700, 0x06526700, 0x06536700, 0x06546700, 0x06556700, 0x06566700,
+        0x06576700, 0x06596700, 0x066a6700, 0x066b6700, 0x06716700, 0x06766700,
+        0x06776700, 0x06786700, 0x06796700, 0x067a6700, 0x01006746, 0x01006747,
+        0x01006749, 0x0500674a, 0x02306802, 0x02306809, 0x02306817, 0x06306828,
+        0x02316802, 0x02316809, 0x02316817, 0x06316828, 0x02326802, 0x02326809,
+        0x02326817, 0x06326828, 0x02616802, 0x02616809, 0x02616817, 0x06616828,
+        0x02636802, 0x02636809, 0x02636817, 0x06636828, 0x02656802, 0x02656809,
+        0x02656817, 0x06656828, 0x02696802, 0x02696809, 0x02696817, 0x06696828,
+        0x026f6802, 0x026f6809, 0x026f6817, 0x066f6828, 0x02736802, 0x02736809,
+        0x02736817, 0x06736828, 0x02746802, 0x02746809, 0x02746817, 0x06746828,
+        0x02206801, 0x06206816, 0x02256801, 0x06256816, 0x022d6801, 0x062d6816,
+        0x022e6801, 0x062e6816, 0x022f6801, 0x062f6816, 0x02336801, 0x06336816,
+        0x02346801, 0x06346816, 0x02356801, 0x06356816, 0x02366801, 0x06366816,
+        0x02376801, 0x06376816, 0x02386801, 0x06386816, 0x02396801, 0x06396816,
+        0x023d6801, 0x063d6816, 0x02416801, 0x06416816, 0x025f6801, 0x065f6816,
+        0x02626801, 0x06626816, 0x02646801, 0x06646816, 0x02666801, 0x06666816,
+        0x02676801, 0x06676816, 0x02686801, 0x06686816, 0x026c6801, 0x066c6816,
+        0x026d6801, 0x066d6816, 0x026e6801, 0x066e6816, 0x02706801, 0x06706816,
+        0x02726801, 0x06726816, 0x02756801, 0x06756816, 0x063a6800, 0x06426800,
+        0x06436800, 0x06446800, 0x06456800, 0x06466800, 0x06476800, 0x06486800,
+        0x06496800, 0x064a6800, 0x064b6800, 0x064c6800, 0x064d6800, 0x064e6800,
+        0x064f6800, 0x06506800, 0x06516800, 0x06526800, 0x06536800, 0x06546800,
+        0x06556800, 0x06566800, 0x06576800, 0x06596800, 0x066a6800, 0x066b6800,
+        0x06716800, 0x06766800, 0x06776800, 0x06786800, 0x06796800, 0x067a6800,
+        0x01006846, 0x01006847, 0x01006849, 0x0500684a
+    },
+    /* 31 */
+    {
+        0x06306c00, 0x06316c00, 0x06326c00, 0x06616c00, 0x06636c00, 0x06656c00,
+        0x06696c00, 0x066f6c00, 0x06736c00, 0x06746c00, 0x01006c0d, 0x01006c0e,
+        0x01006c11, 0x01006c12, 0x01006c14, 0x01006c15, 0x01006c1a, 0x01006c1b,
+        0x01006c1d, 0x01006c1e, 0x01006c21, 0x01006c22, 0x01006c24, 0x01006c25,
+        0x01006c2b, 0x01006c2e, 0x01006c32, 0x01006c35, 0x01006c3a, 0x01006c3d,
+        0x01006c41, 0x05006c44, 0x06306d00, 0x06316d00, 0x06326d00, 0x06616d00,
+        0x06636d00, 0x06656d00, 0x06696d00, 0x066f6d00, 0x06736d00, 0x06746d00,
+        0x01006d0d, 0x01006d0e, 0x01006d11, 0x01006d12, 0x01006d14, 0x01006d15,
+        0x01006d1a, 0x01006d1b, 0x01006d1d, 0x01006d1e, 0x01006d21, 0x01006d22,
+        0x01006d24, 0x01006d25, 0x01006d2b, 0x01006d2e, 0x01006d32, 0x01006d35,
+        0x01006d3a, 0x01006d3d, 0x01006d41, 0x05006d44, 0x06306e00, 0x06316e00,
+        0x06326e00, 0x06616e00, 0x06636e00, 0x06656e00, 0x06696e00, 0x066f6e00,
+        0x06736e00, 0x06746e00, 0x01006e0d, 0x01006e0e, 0x01006e11, 0x01006e12,
+        0x01006e14, 0x01006e15, 0x01006e1a, 0x01006e1b, 0x01006e1d, 0x01006e1e,
+        0x01006e21, 0x01006e22, 0x01006e24, 0x01006e25, 0x01006e2b, 0x01006e2e,
+        0x01006e32, 0x01006e35, 0x01006e3a, 0x01006e3d, 0x01006e41, 0x05006e44,
+        0x06307000, 0x06317000, 0x06327000, 0x06617000, 0x06637000, 0x06657000,
+        0x06697000, 0x066f7000, 0x06737000, 0x06747000, 0x0100700d, 0x0100700e,
+        0x01007011, 0x01007012, 0x01007014, 0x01007015, 0x0100701a, 0x0100701b,
+        0x0100701d, 0x0100701e, 0x01007021, 0x01007022, 0x01007024, 0x01007025,
+        0x0100702b, 0x0100702e, 0x01007032, 0x01007035, 0x0100703a, 0x0100703d,
+        0x01007041, 0x05007044, 0x06307200, 0x06317200, 0x06327200, 0x06617200,
+        0x06637200, 0x06657200, 0x06697200, 0x066f7200, 0x06737200, 0x06747200,
+        0x0100720d, 0x0100720e, 0x01007211, 0x01007212, 0x01007214, 0x01007215,
+        0x0100721a, 0x0100721b, 0x0100721d, 0x0100721e, 0x01007221, 0x01007222,
+        0x01007224, 0x01007225, 0x0100722b, 0x0100722e, 0x01007232, 0x01007235,
+        0x0100723a, 0x0100723d, 0x01007241, 0x05007244, 0x06307500, 0x06317500,
+        0x06327500, 0x06617500, 0x06637500, 0x06657500, 0x06697500, 0x066f7500,
+        0x06737500, 0x06747500, 0x0100750d, 0x0100750e, 0x01007511, 0x01007512,
+        0x01007514, 0x01007515, 0x0100751a, 0x0100751b, 0x0100751d, 0x0100751e,
+        0x01007521, 0x01007522, 0x01007524, 0x01007525, 0x0100752b, 0x0100752e,
+        0x01007532, 0x01007535, 0x0100753a, 0x0100753d, 0x01007541, 0x05007544,
+        0x01003a04, 0x01003a05, 0x01003a07, 0x01003a08, 0x01003a0b, 0x01003a0c,
+        0x01003a10, 0x01003a13, 0x01003a19, 0x01003a1c, 0x01003a20, 0x01003a23,
+        0x01003a2a, 0x01003a31, 0x01003a39, 0x05003a40, 0x01004204, 0x01004205,
+        0x01004207, 0x01004208, 0x0100420b, 0x0100420c, 0x01004210, 0x01004213,
+        0x01004219, 0x0100421c, 0x01004220, 0x01004223, 0x0100422a, 0x01004231,
+        0x01004239, 0x05004240, 0x01004304, 0x01004305, 0x01004307, 0x01004308,
+        0x0100430b, 0x0100430c, 0x01004310, 0x01004313, 0x01004319, 0x0100431c,
+        0x01004320, 0x01004323, 0x0100432a, 0x01004331, 0x01004339, 0x05004340,
+        0x01004404, 0x01004405, 0x01004407, 0x01004408, 0x0100440b, 0x0100440c,
+        0x01004410, 0x01004413, 0x01004419, 0x0100441c, 0x01004420, 0x01004423,
+        0x0100442a, 0x01004431, 0x01004439, 0x05004440
+    },
+    /* 32 */
+    {
+        0x02306c01, 0x06306c16, 0x02316c01, 0x06316c16, 0x02326c01, 0x06326c16,
+        0x02616c01, 0x06616c16, 0x02636c01, 0x06636c16, 0x02656c01, 0x06656c16,
+        0x02696c01, 0x06696c16, 0x026f6c01, 0x066f6c16, 0x02736c01, 0x06736c16,
+        0x02746c01, 0x06746c16, 0x06206c00, 0x06256c00, 0x062d6c00, 0x062e6c00,
+        0x062f6c00, 0x06336c00, 0x06346c00, 0x06356c00, 0x06366c00, 0x06376c00,
+        0x06386c00, 0x06396c00, 0x063d6c00, 0x06416c00, 0x065f6c00, 0x06626c00,
+        0x06646c00, 0x06666c00, 0x06676c00, 0x06686c00, 0x066c6c00, 0x066d6c00,
+        0x066e6c00, 0x06706c00, 0x06726c00, 0x06756c00, 0x01006c26, 0x01006c27,
+        0x01006c2c, 0x01006c2d, 0x01006c2f, 0x01006c30, 0x01006c33, 0x01006c34,
+        0x01006c36, 0x01006c37, 0x01006c3b, 0x01006c3c, 0x01006c3e, 0x01006c3f,
+        0x01006c42, 0x01006c43, 0x01006c45, 0x05006c48, 0x02306d01, 0x06306d16,
+        0x02316d01, 0x06316d16, 0x02326d01, 0x06326d16, 0x02616d01, 0x06616d16,
+        0x02636d01, 0x06636d16, 0x02656d01, 0x06656d16, 0x02696d01, 0x06696d16,
+        0x026f6d01, 0x066f6d16, 0x02736d01, 0x06736d16, 0x02746d01, 0x06746d16,
+        0x06206d00, 0x06256d00, 0x062d6d00, 0x062e6d00, 0x062f6d00, 0x06336d00,
+        0x06346d00, 0x06356d00, 0x06366d00, 0x06376d00, 0x06386d00, 0x06396d00,
+        0x063d6d00, 0x06416d00, 0x065f6d00, 0x06626d00, 0x06646d00, 0x06666d00,
+        0x06676d00, 0x06686d00, 0x066c6d00, 0x066d6d00, 0x066e6d00, 0x06706d00,
+        0x06726d00, 0x06756d00, 0x01006d26, 0x01006d27, 0x01006d2c, 0x01006d2d,
+        0x01006d2f, 0x01006d30, 0x01006d33, 0x01006d34, 0x01006d36, 0x01006d37,
+        0x01006d3b, 0x01006d3c, 0x01006d3e, 0x01006d3f, 0x01006d42, 0x01006d43,
+        0x01006d45, 0x05006d48, 0x02306e01, 0x06306e16, 0x02316e01, 0x06316e16,
+        0x02326e01, 0x06326e16, 0x02616e01, 0x06616e16, 0x02636e01, 0x06636e16,
+        0x02656e01, 0x06656e16, 0x02696e01, 0x06696e16, 0x026f6e01, 0x066f6e16,
+        0x02736e01, 0x06736e16, 0x02746e01, 0x06746e16, 0x06206e00, 0x06256e00,
+        0x062d6e00, 0x062e6e00, 0x062f6e00, 0x06336e00, 0x06346e00, 0x06356e00,
+        0x06366e00, 0x06376e00, 0x06386e00, 0x06396e00, 0x063d6e00, 0x06416e00,
+        0x065f6e00, 0x06626e00, 0x06646e00, 0x06666e00, 0x06676e00, 0x06686e00,
+        0x066c6e00, 0x066d6e00, 0x066e6e00, 0x06706e00, 0x06726e00, 0x06756e00,
+        0x01006e26, 0x01006e27, 0x01006e2c, 0x01006e2d, 0x01006e2f, 0x01006e30,
+        0x01006e33, 0x01006e34, 0x01006e36, 0x01006e37, 0x01006e3b, 0x01006e3c,
+        0x01006e3e, 0x01006e3f, 0x01006e42, 0x01006e43, 0x01006e45, 0x05006e48,
+        0x02307001, 0x06307016, 0x02317001, 0x06317016, 0x02327001, 0x06327016,
+        0x02617001, 0x06617016, 0x02637001, 0x06637016, 0x02657001, 0x06657016,
+        0x02697001, 0x06697016, 0x026f7001, 0x066f7016, 0x02737001, 0x06737016,
+        0x02747001, 0x06747016, 0x06207000, 0x06257000, 0x062d7000, 0x062e7000,
+        0x062f7000, 0x06337000, 0x06347000, 0x06357000, 0x06367000, 0x06377000,
+        0x06387000, 0x06397000, 0x063d7000, 0x06417000, 0x065f7000, 0x06627000,
+        0x06647000, 0x06667000, 0x06677000, 0x06687000, 0x066c7000, 0x066d7000,
+        0x066e7000, 0x06707000, 0x06727000, 0x06757000, 0x01007026, 0x01007027,
+        0x0100702c, 0x0100702d, 0x0100702f, 0x01007030, 0x01007033, 0x01007034,
+        0x01007036, 0x01007037, 0x0100703b, 0x0100703c, 0x0100703e, 0x0100703f,
+        0x01007042, 0x01007043, 0x01007045, 0x05007048
+    },
+    /* 33 */
+    {
+        0x02306c02, 0x02306c09, 0x02306c17, 0x06306c28, 0x02316c02, 0x02316c09,
+        0x02316c17, 0x06316c28, 0x02326c02, 0x02326c09, 0x02326c17, 0x06326c28,
+        0x02616c02, 0x02616c09, 0x02616c17, 0x06616c28, 0x02636c02, 0x02636c09,
+        0x02636c17, 0x06636c28, 0x02656c02, 0x02656c09, 0x02656c17, 0x06656c28,
+        0x02696c02, 0x02696c09, 0x02696c17, 0x06696c28, 0x026f6c02, 0x026f6c09,
+        0x026f6c17, 0x066f6c28, 0x02736c02, 0x02736c09, 0x02736c17, 0x06736c28,
+        0x02746c02, 0x02746c09, 0x02746c17, 0x06746c28, 0x02206c01, 0x06206c16,
+        0x02256c01, 0x06256c16, 0x022d6c01, 0x062d6c16, 0x022e6c01, 0x062e6c16,
+        0x022f6c01, 0x062f6c16, 0x02336c01, 0x06336c16, 0x02346c01, 0x06346c16,
+        0x02356c01, 0x06356c16, 0x02366c01, 0x06366c16, 0x02376c01, 0x06376c16,
+        0x02386c01, 0x06386c16, 0x02396c01, 0x06396c16, 0x023d6c01, 0x063d6c16,
+        0x02416c01, 0x06416c16, 0x025f6c01, 0x065f6c16, 0x02626c01, 0x06626c16,
+        0x02646c01, 0x06646c16, 0x02666c01, 0x06666c16, 0x02676c01, 0x06676c16,
+        0x02686c01, 0x06686c16, 0x026c6c01, 0x066c6c16, 0x026d6c01, 0x066d6c16,
+        0x026e6c01, 0x066e6c16, 0x02706c01, 0x06706c16, 0x02726c01, 0x06726c16,
+        0x02756c01, 0x06756c16, 0x063a6c00, 0x06426c00, 0x06436c00, 0x06446c00,
+        0x06456c00, 0x06466c00, 0x06476c00, 0x06486c00, 0x06496c00, 0x064a6c00,
+        0x064b6c00, 0x064c6c00, 0x064d6c00, 0x064e6c00, 0x064f6c00, 0x06506c00,
+        0x06516c00, 0x06526c00, 0x06536c00, 0x06546c00, 0x06556c00, 0x06566c00,
+        0x06576c00, 0x06596c00, 0x066a6c00, 0x066b6c00, 0x06716c00, 0x06766c00,
+        0x06776c00, 0x06786c00, 0x06796c00, 0x067a6c00, 0x01006c46, 0x01006c47,
+        0x01006c49, 0x05006c4a, 0x02306d02, 0x02306d09, 0x02306d17, 0x06306d28,
+        0x02316d02, 0x02316d09, 0x02316d17, 0x06316d28, 0x02326d02, 0x02326d09,
+        0x02326d17, 0x06326d28, 0x02616d02, 0x02616d09, 0x02616d17, 0x06616d28,
+        0x02636d02, 0x02636d09, 0x02636d17, 0x06636d28, 0x02656d02, 0x02656d09,
+        0x02656d17, 0x06656d28, 0x02696d02, 0x02696d09, 0x02696d17, 0x06696d28,
+        0x026f6d02, 0x026f6d09, 0x026f6d17, 0x066f6d28, 0x02736d02, 0x02736d09,
+        0x02736d17, 0x06736d28, 0x02746d02, 0x02746d09, 0x02746d17, 0x06746d28,
+        0x02206d01, 0x06206d16, 0x02256d01, 0x06256d16, 0x022d6d01, 0x062d6d16,
+        0x022e6d01, 0x062e6d16, 0x022f6d01, 0x062f6d16, 0x02336d01, 0x06336d16,
+        0x02346d01, 0x06346d16, 0x02356d01, 0x06356d16, 0x02366d01, 0x06366d16,
+        0x02376d01, 0x06376d16, 0x02386d01, 0x06386d16, 0x02396d01, 0x06396d16,
+        0x023d6d01, 0x063d6d16, 0x02416d01, 0x06416d16, 0x025f6d01, 0x065f6d16,
+        0x02626d01, 0x06626d16, 0x02646d01, 0x06646d16, 0x02666d01, 0x06666d16,
+        0x02676d01, 0x06676d16, 0x02686d01, 0x06686d16, 0x026c6d01, 0x066c6d16,
+        0x026d6d01, 0x066d6d16, 0x026e6d01, 0x066e6d16, 0x02706d01, 0x06706d16,
+        0x02726d01, 0x06726d16, 0x02756d01, 0x06756d16, 0x063a6d00, 0x06426d00,
+        0x06436d00, 0x06446d00, 0x06456d00, 0x06466d00, 0x06476d00, 0x06486d00,
+        0x06496d00, 0x064a6d00, 0x064b6d00, 0x064c6d00, 0x064d6d00, 0x064e6d00,
+        0x064f6d00, 0x06506d00, 0x06516d00, 0x06526d00, 0x06536d00, 0x06546d00,
+        0x06556d00, 0x06566d00, 0x06576d00, 0x06596d00, 0x066a6d00, 0x066b6d00,
+        0x06716d00, 0x06766d00, 0x06776d00, 0x06786d00, 0x06796d00, 0x067a6d00,
+        0x01006d46, 0x01006d47, 0x01006d49, 0x05006d4a
+    },
+    /* 34 */
+    {
+        0x02306e02, 0x02306e09, 0x02306e17, 0x06306e28, 0x02316e02, 0x02316e09,
+        0x02316e17, 0x06316e28, 0x02326e02, 0x02326e09, 0x02326e17, 0x06326e28,
+        0x02616e02, 0x02616e09, 0x02616e17, 0x06616e28, 0x02636e02, 0x02636e09,
+        0x02636e17, 0x06636e28, 0x02656e02, 0x02656e09, 0x02656e17, 0x06656e28,
+        0x02696e02, 0x02696e09, 0x02696e17, 0x06696e28, 0x026f6e02, 0x026f6e09,
+        0x026f6e17, 0x066f6e28, 0x02736e02, 0x02736e09, 0x02736e17, 0x06736e28,
+        0x02746e02, 0x02746e09, 0x02746e17, 0x06746e28, 0x02206e01, 0x06206e16,
+        0x02256e01, 0x06256e16, 0x022d6e01, 0x062d6e16, 0x022e6e01, 0x062e6e16,
+        0x022f6e01, 0x062f6e16, 0x02336e01, 0x06336e16, 0x02346e01, 0x06346e16,
+        0x02356e01, 0x06356e16, 0x02366e01, 0x06366e16, 0x02376e01, 0x06376e16,
+        0x02386e01, 0x06386e16, 0x02396e01, 0x06396e16, 0x023d6e01, 0x063d6e16,
+        0x02416e01, 0x06416e16, 0x025f6e01, 0x065f6e16, 0x02626e01, 0x06626e16,
+        0x02646e01, 0x06646e16, 0x02666e01, 0x06666e16, 0x02676e01, 0x06676e16,
+        0x02686e01, 0x06686e16, 0x026c6e01, 0x066c6e16, 0x026d6e01, 0x066d6e16,
+        0x026e6e01, 0x066e6e16, 0x02706e01, 0x06706e16, 0x02726e01, 0x06726e16,
+        0x02756e01, 0x06756e16, 0x063a6e00, 0x06426e00, 0x06436e00, 0x06446e00,
+        0x06456e00, 0x06466e00, 0x06476e00, 0x06486e00, 0x06496e00, 0x064a6e00,
+        0x064b6e00, 0x064c6e00, 0x064d6e00, 0x064e6e00, 0x064f6e00, 0x06506e00,
+        0x06516e00, 0x06526e00, 0x06536e00, 0x06546e00, 0x06556e00, 0x06566e00,
+        0x06576e00, 0x06596e00, 0x066a6e00, 0x066b6e00, 0x06716e00, 0x06766e00,
+        0x06776e00, 0x06786e00, 0x06796e00, 0x067a6e00, 0x01006e46, 0x01006e47,
+        0x01006e49, 0x05006e4a, 0x02307002, 0x02307009, 0x02307017, 0x06307028,
+        0x02317002, 0x02317009, 0x02317017, 0x06317028, 0x02327002, 0x02327009,
+        0x02327017, 0x06327028, 0x02617002, 0x02617009, 0x02617017, 0x06617028,
+        0x02637002, 0x02637009, 0x02637017, 0x06637028, 0x02657002, 0x02657009,
+        0x02657017, 0x06657028, 0x02697002, 0x02697009, 0x02697017, 0x06697028,
+        0x026f7002, 0x026f7009, 0x026f7017, 0x066f7028, 0x02737002, 0x02737009,
+        0x02737017, 0x06737028, 0x02747002, 0x02747009, 0x02747017, 0x06747028,
+        0x02207001, 0x06207016, 0x02257001, 0x06257016, 0x022d7001, 0x062d7016,
+        0x022e7001, 0x062e7016, 0x022f7001, 0x062f7016, 0x02337001, 0x06337016,
+        0x02347001, 0x06347016, 0x02357001, 0x06357016, 0x02367001, 0x06367016,
+        0x02377001, 0x06377016, 0x02387001, 0x06387016, 0x02397001, 0x06397016,
+        0x023d7001, 0x063d7016, 0x02417001, 0x06417016, 0x025f7001, 0x065f7016,
+        0x02627001, 0x06627016, 0x02647001, 0x06647016, 0x02667001, 0x06667016,
+        0x02677001, 0x06677016, 0x02687001, 0x06687016, 0x026c7001, 0x066c7016,
+        0x026d7001, 0x066d7016, 0x026e7001, 0x066e7016, 0x02707001, 0x06707016,
+        0x02727001, 0x06727016, 0x02757001, 0x06757016, 0x063a7000, 0x06427000,
+        0x06437000, 0x06447000, 0x06457000, 0x06467000, 0x06477000, 0x06487000,
+        0x06497000, 0x064a7000, 0x064b7000, 0x064c7000, 0x064d7000, 0x064e7000,
+        0x064f7000, 0x06507000, 0x06517000, 0x06527000, 0x06537000, 0x06547000,
+        0x06557000, 0x06567000, 0x06577000, 0x06597000, 0x066a7000, 0x066b7000,
+        0x06717000, 0x06767000, 0x06777000, 0x06787000, 0x06797000, 0x067a7000,
+        0x01007046, 0x01007047, 0x01007049, 0x0500704a
+    },
+    /* 35 */
+    {
+        0x02307201, 0x06307216, 0x02317201, 0x06317216, 0x02327201, 0x06327216,
+        0x02617201, 0x06617216, 0x02637201, 0x06637216, 0x02657201, 0x06657216,
+        0x02697201, 0x06697216, 0x026f7201, 0x066f7216, 0x02737201, 0x06737216,
+        0x02747201, 0x06747216, 0x06207200, 0x06257200, 0x062d7200, 0x062e7200,
+        0x062f7200, 0x06337200, 0x06347200, 0x06357200, 0x06367200, 0x06377200,
+        0x06387200, 0x06397200, 0x063d7200, 0x06417200, 0x065f7200, 0x06627200,
+        0x06647200, 0x06667200, 0x06677200, 0x06687200, 0x066c7200, 0x066d7200,
+        0x066e7200, 0x06707200, 0x06727200, 0x06757200, 0x01007226, 0x01007227,
+        0x0100722c, 0x0100722d, 0x0100722f, 0x01007230, 0x01007233, 0x01007234,
+        0x01007236, 0x01007237, 0x0100723b, 0x0100723c, 0x0100723e, 0x0100723f,
+        0x01007242, 0x01007243, 0x01007245, 0x05007248, 0x02307501, 0x06307516,
+        0x02317501, 0x06317516, 0x02327501, 0x06327516, 0x02617501, 0x06617516,
+        0x02637501, 0x06637516, 0x02657501, 0x06657516, 0x02697501, 0x06697516,
+        0x026f7501, 0x066f7516, 0x02737501, 0x06737516, 0x02747501, 0x06747516,
+        0x06207500, 0x06257500, 0x062d7500, 0x062e7500, 0x062f7500, 0x06337500,
+        0x06347500, 0x06357500, 0x06367500, 0x06377500, 0x06387500, 0x06397500,
+        0x063d7500, 0x06417500, 0x065f7500, 0x06627500, 0x06647500, 0x06667500,
+        0x06677500, 0x06687500, 0x066c7500, 0x066d7500, 0x066e7500, 0x06707500,
+        0x06727500, 0x06757500, 0x01007526, 0x01007527, 0x0100752c, 0x0100752d,
+        0x0100752f, 0x01007530, 0x01007533, 0x01007534, 0x01007536, 0x01007537,
+        0x0100753b, 0x0100753c, 0x0100753e, 0x0100753f, 0x01007542, 0x01007543,
+        0x01007545, 0x05007548, 0x06303a00, 0x06313a00, 0x06323a00, 0x06613a00,
+        0x06633a00, 0x06653a00, 0x06693a00, 0x066f3a00, 0x06733a00, 0x06743a00,
+        0x01003a0d, 0x01003a0e, 0x01003a11, 0x01003a12, 0x01003a14, 0x01003a15,
+        0x01003a1a, 0x01003a1b, 0x01003a1d, 0x01003a1e, 0x01003a21, 0x01003a22,
+        0x01003a24, 0x01003a25, 0x01003a2b, 0x01003a2e, 0x01003a32, 0x01003a35,
+        0x01003a3a, 0x01003a3d, 0x01003a41, 0x05003a44, 0x06304200, 0x06314200,
+        0x06324200, 0x06614200, 0x06634200, 0x06654200, 0x06694200, 0x066f4200,
+        0x06734200, 0x06744200, 0x0100420d, 0x0100420e, 0x01004211, 0x01004212,
+        0x01004214, 0x01004215, 0x0100421a, 0x0100421b, 0x0100421d, 0x0100421e,
+        0x01004221, 0x01004222, 0x01004224, 0x01004225, 0x0100422b, 0x0100422e,
+        0x01004232, 0x01004235, 0x0100423a, 0x0100423d, 0x01004241, 0x05004244,
+        0x06304300, 0x06314300, 0x06324300, 0x06614300, 0x06634300, 0x06654300,
+        0x06694300, 0x066f4300, 0x06734300, 0x06744300, 0x0100430d, 0x0100430e,
+        0x01004311, 0x01004312, 0x01004314, 0x01004315, 0x0100431a, 0x0100431b,
+        0x0100431d, 0x0100431e, 0x01004321, 0x01004322, 0x01004324, 0x01004325,
+        0x0100432b, 0x0100432e, 0x01004332, 0x01004335, 0x0100433a, 0x0100433d,
+        0x01004341, 0x05004344, 0x06304400, 0x06314400, 0x06324400, 0x06614400,
+        0x06634400, 0x06654400, 0x06694400, 0x066f4400, 0x06734400, 0x06744400,
+        0x0100440d, 0x0100440e, 0x01004411, 0x01004412, 0x01004414, 0x01004415,
+        0x0100441a, 0x0100441b, 0x0100441d, 0x0100441e, 0x01004421, 0x01004422,
+        0x01004424, 0x01004425, 0x0100442b, 0x0100442e, 0x01004432, 0x01004435,
+        0x0100443a, 0x0100443d, 0x01004441, 0x05004444
+    },
+    /* 36 */
+    {
+        0x02307202, 0x02307209, 0x02307217, 0x06307228, 0x02317202, 0x02317209,
+        0x02317217, 0x06317228, 0x02327202, 0x02327209, 0x02327217, 0x06327228,
+        0x02617202, 0x02617209, 0x02617217, 0x06617228, 0x02637202, 0x02637209,
+        0x02637217, 0x06637228, 0x02657202, 0x02657209, 0x02657217, 0x06657228,
+        0x02697202, 0x02697209, 0x02697217, 0x06697228, 0x026f7202, 0x026f7209,
+        0x026f7217, 0x066f7228, 0x02737202, 0x02737209, 0x02737217, 0x06737228,
+        0x02747202, 0x02747209, 0x02747217, 0x06747228, 0x02207201, 0x06207216,
+        0x02257201, 0x06257216, 0x022d7201, 0x062d7216, 0x022e7201, 0x062e7216,
+        0x022f7201, 0x062f7216, 0x02337201, 0x06337216, 0x02347201, 0x06347216,
+        0x02357201, 0x06357216, 0x02367201, 0x06367216, 0x02377201, 0x06377216,
+        0x02387201, 0x06387216, 0x02397201, 0x06397216, 0x023d7201, 0x063d7216,
+        0x02417201, 0x06417216, 0x025f7201, 0x065f7216, 0x02627201, 0x06627216,
+        0x02647201, 0x06647216, 0x02667201, 0x06667216, 0x02677201, 0x06677216,
+        0x02687201, 0x06687216, 0x026c7201, 0x066c7216, 0x026d7201, 0x066d7216,
+        0x026e7201, 0x066e7216, 0x02707201, 0x06707216, 0x02727201, 0x06727216,
+        0x02757201, 0x06757216, 0x063a7200, 0x06427200, 0x06437200, 0x06447200,
+        0x06457200, 0x06467200, 0x06477200, 0x06487200, 0x06497200, 0x064a7200,
+        0x064b7200, 0x064c7200, 0x064d7200, 0x064e7200, 0x064f7200, 0x06507200,
+        0x06517200, 0x06527200, 0x06537200, 0x06547200, 0x06557200, 0x06567200,
+        0x06577200, 0x06597200, 0x066a7200, 0x066b7200, 0x06717200, 0x06767200,
+        0x06777200, 0x06787200, 0x06797200, 0x067a7200, 0x01007246, 0x01007247,
+        0x01007249, 0x0500724a, 0x02307502, 0x02307509, 0x02307517, 0x06307528,
+        0x02317502, 0x02317509, 0x02317517, 0x06317528, 0x02327502, 0x02327509,
+        0x02327517, 0x06327528, 0x02617502, 0x02617509, 0x02617517, 0x06617528,
+        0x02637502, 0x02637509, 0x02637517, 0x06637528, 0x02657502, 0x02657509,
+        0x02657517, 0x06657528, 0x02697502, 0x02697509, 0x02697517, 0x06697528,
+        0x026f7502, 0x026f7509, 0x026f7517, 0x066f7528, 0x02737502, 0x02737509,
+        0x02737517, 0x06737528, 0x02747502, 0x02747509, 0x02747517, 0x06747528,
+        0x02207501, 0x06207516, 0x02257501, 0x06257516, 0x022d7501, 0x062d7516,
+        0x022e7501, 0x062e7516, 0x022f7501, 0x062f7516, 0x02337501, 0x06337516,
+        0x02347501, 0x06347516, 0x02357501, 0x06357516, 0x02367501, 0x06367516,
+        0x02377501, 0x06377516, 0x02387501, 0x06387516, 0x02397501, 0x06397516,
+        0x023d7501, 0x063d7516, 0x02417501, 0x06417516, 0x025f7501, 0x065f7516,
+        0x02627501, 0x06627516, 0x02647501, 0x06647516, 0x02667501, 0x06667516,
+        0x02677501, 0x06677516, 0x02687501, 0x06687516, 0x026c7501, 0x066c7516,
+        0x026d7501, 0x066d7516, 0x026e7501, 0x066e7516, 0x02707501, 0x06707516,
+        0x02727501, 0x06727516, 0x02757501, 0x06757516, 0x063a7500, 0x06427500,
+        0x06437500, 0x06447500, 0x06457500, 0x06467500, 0x06477500, 0x06487500,
+        0x06497500, 0x064a7500, 0x064b7500, 0x064c7500, 0x064d7500, 0x064e7500,
+        0x064f7500, 0x06507500, 0x06517500, 0x06527500, 0x06537500, 0x06547500,
+        0x06557500, 0x06567500, 0x06577500, 0x06597500, 0x066a7500, 0x066b7500,
+        0x06717500, 0x06767500, 0x06777500, 0x06787500, 0x06797500, 0x067a7500,
+        0x01007546, 0x01007547, 0x01007549, 0x0500754a
+    },
+    /* 37 */
+    {
+        0x02303a01, 0x06303a16, 0x02313a01, 0x06313a16, 0x02323a01, 0x06323a16,
+        0x02613a01, 0x06613a16, 0x02633a01, 0x06633a16, 0x02653a01, 0x06653a16,
+        0x02693a01, 0x06693a16, 0x026f3a01, 0x066f3a16, 0x02733a01, 0x06733a16,
+        0x02743a01, 0x06743a16, 0x06203a00, 0x06253a00, 0x062d3a00, 0x062e3a00,
+        0x062f3a00, 0x06333a00, 0x06343a00, 0x06353a00, 0x06363a00, 0x06373a00,
+        0x06383a00, 0x06393a00, 0x063d3a00, 0x06413a00, 0x065f3a00, 0x06623a00,
+        0x06643a00, 0x06663a00, 0x06673a00, 0x06683a00, 0x066c3a00, 0x066d3a00,
+        0x066e3a00, 0x06703a00, 0x06723a00, 0x06753a00, 0x01003a26, 0x01003a27,
+        0x01003a2c, 0x01003a2d, 0x01003a2f, 0x01003a30, 0x01003a33, 0x01003a34,
+        0x01003a36, 0x01003a37, 0x01003a3b, 0x01003a3c, 0x01003a3e, 0x01003a3f,
+        0x01003a42, 0x01003a43, 0x01003a45, 0x05003a48, 0x02304201, 0x06304216,
+        0x02314201, 0x06314216, 0x02324201, 0x06324216, 0x02614201, 0x06614216,
+        0x02634201, 0x06634216, 0x02654201, 0x06654216, 0x02694201, 0x06694216,
+        0x026f4201, 0x066f4216, 0x02734201, 0x06734216, 0x02744201, 0x06744216,
+        0x06204200, 0x06254200, 0x062d4200, 0x062e4200, 0x062f4200, 0x06334200,
+        0x06344200, 0x06354200, 0x06364200, 0x06374200, 0x06384200, 0x06394200,
+        0x063d4200, 0x06414200, 0x065f4200, 0x06624200, 0x06644200, 0x06664200,
+        0x06674200, 0x06684200, 0x066c4200, 0x066d4200, 0x066e4200, 0x06704200,
+        0x06724200, 0x06754200, 0x01004226, 0x01004227, 0x0100422c, 0x0100422d,
+        0x0100422f, 0x01004230, 0x01004233, 0x01004234, 0x01004236, 0x01004237,
+        0x0100423b, 0x0100423c, 0x0100423e, 0x0100423f, 0x01004242, 0x01004243,
+        0x01004245, 0x05004248, 0x02304301, 0x06304316, 0x02314301, 0x06314316,
+        0x02324301, 0x06324316, 0x02614301, 0x06614316, 0x02634301, 0x06634316,
+        0x02654301, 0x06654316, 0x02694301, 0x06694316, 0x026f4301, 0x066f4316,
+        0x02734301, 0x06734316, 0x02744301, 0x06744316, 0x06204300, 0x06254300,
+        0x062d4300, 0x062e4300, 0x062f4300, 0x06334300, 0x06344300, 0x06354300,
+        0x06364300, 0x06374300, 0x06384300, 0x06394300, 0x063d4300, 0x06414300,
+        0x065f4300, 0x06624300, 0x06644300, 0x06664300, 0x06674300, 0x06684300,
+        0x066c4300, 0x066d4300, 0x066e4300, 0x06704300, 0x06724300, 0x06754300,
+        0x01004326, 0x01004327, 0x0100432c, 0x0100432d, 0x0100432f, 0x01004330,
+        0x01004333, 0x01004334, 0x01004336, 0x01004337, 0x0100433b, 0x0100433c,
+        0x0100433e, 0x0100433f, 0x01004342, 0x01004343, 0x01004345, 0x05004348,
+        0x02304401, 0x06304416, 0x02314401, 0x06314416, 0x02324401, 0x06324416,
+        0x02614401, 0x06614416, 0x02634401, 0x06634416, 0x02654401, 0x06654416,
+        0x02694401, 0x06694416, 0x026f4401, 0x066f4416, 0x02734401, 0x06734416,
+        0x02744401, 0x06744416, 0x06204400, 0x06254400, 0x062d4400, 0x062e4400,
+        0x062f4400, 0x06334400, 0x06344400, 0x06354400, 0x06364400, 0x06374400,
+        0x06384400, 0x06394400, 0x063d4400, 0x06414400, 0x065f4400, 0x06624400,
+        0x06644400, 0x06664400, 0x06674400, 0x06684400, 0x066c4400, 0x066d4400,
+        0x066e4400, 0x06704400, 0x06724400, 0x06754400, 0x01004426, 0x01004427,
+        0x0100442c, 0x0100442d, 0x0100442f, 0x01004430, 0x01004433, 0x01004434,
+        0x01004436, 0x01004437, 0x0100443b, 0x0100443c, 0x0100443e, 0x0100443f,
+        0x01004442, 0x01004443, 0x01004445, 0x05004448
+    },
+    /* 38 */
+    {
+        0x02303a02, 0x02303a09, 0x02303a17, 0x06303a28, 0x02313a02, 0x02313a09,
+        0x02313a17, 0x06313a28, 0x02323a02, 0x02323a09, 0x02323a17, 0x06323a28,
+        0x02613a02, 0x02613a09, 0x02613a17, 0x06613a28, 0x02633a02, 0x02633a09,
+        0x02633a17, 0x06633a28, 0x02653a02, 0x02653a09, 0x02653a17, 0x06653a28,
+        0x02693a02, 0x02693a09, 0x02693a17, 0x06693a28, 0x026f3a02, 0x026f3a09,
+        0x026f3a17, 0x066f3a28, 0x02733a02, 0x02733a09, 0x02733a17, 0x06733a28,
+        0x02743a02, 0x02743a09, 0x02743a17, 0x06743a28, 0x02203a01, 0x06203a16,
+        0x02253a01, 0x06253a16, 0x022d3a01, 0x062d3a16, 0x022e3a01, 0x062e3a16,
+        0x022f3a01, 0x062f3a16, 0x02333a01, 0x06333a16, 0x02343a01, 0x06343a16,
+        0x02353a01, 0x06353a16, 0x02363a01, 0x06363a16, 0x02373a01, 0x06373a16,
+        0x02383a01, 0x06383a16, 0x02393a01, 0x06393a16, 0x023d3a01, 0x063d3a16,
+        0x02413a01, 0x06413a16, 0x025f3a01, 0x065f3a16, 0x02623a01, 0x06623a16,
+        0x02643a01, 0x06643a16, 0x02663a01, 0x06663a16, 0x02673a01, 0x06673a16,
+        0x02683a01, 0x06683a16, 0x026c3a01, 0x066c3a16, 0x026d3a01, 0x066d3a16,
+        0x026e3a01, 0x066e3a16, 0x02703a01, 0x06703a16, 0x02723a01, 0x06723a16,
+        0x02753a01, 0x06753a16, 0x063a3a00, 0x06423a00, 0x06433a00, 0x06443a00,
+        0x06453a00, 0x06463a00, 0x06473a00, 0x06483a00, 0x06493a00, 0x064a3a00,
+        0x064b3a00, 0x064c3a00, 0x064d3a00, 0x064e3a00, 0x064f3a00, 0x06503a00,
+        0x06513a00, 0x06523a00, 0x06533a00, 0x06543a00, 0x06553a00, 0x06563a00,
+        0x06573a00, 0x06593a00, 0x066a3a00, 0x066b3a00, 0x06713a00, 0x06763a00,
+        0x06773a00, 0x06783a00, 0x06793a00, 0x067a3a00, 0x01003a46, 0x01003a47,
+        0x01003a49, 0x05003a4a, 0x02304202, 0x02304209, 0x02304217, 0x06304228,
+        0x02314202, 0x02314209, 0x02314217, 0x06314228, 0x02324202, 0x02324209,
+        0x02324217, 0x06324228, 0x02614202, 0x02614209, 0x02614217, 0x06614228,
+        0x02634202, 0x02634209, 0x02634217, 0x06634228, 0x02654202, 0x02654209,
+        0x02654217, 0x06654228, 0x02694202, 0x02694209, 0x02694217, 0x06694228,
+        0x026f4202, 0x026f4209, 0x026f4217, 0x066f4228, 0x02734202, 0x02734209,
+        0x02734217, 0x06734228, 0x02744202, 0x02744209, 0x02744217, 0x06744228,
+        0x02204201, 0x06204216, 0x02254201, 0x06254216, 0x022d4201, 0x062d4216,
+        0x022e4201, 0x062e4216, 0x022f4201, 0x062f4216, 0x02334201, 0x06334216,
+        0x02344201, 0x06344216, 0x02354201, 0x06354216, 0x02364201, 0x06364216,
+        0x02374201, 0x06374216, 0x02384201, 0x06384216, 0x02394201, 0x06394216,
+        0x023d4201, 0x063d4216, 0x02414201, 0x06414216, 0x025f4201, 0x065f4216,
+        0x02624201, 0x06624216, 0x02644201, 0x06644216, 0x02664201, 0x06664216,
+        0x02674201, 0x06674216, 0x02684201, 0x06684216, 0x026c4201, 0x066c4216,
+        0x026d4201, 0x066d4216, 0x026e4201, 0x066e4216, 0x02704201, 0x06704216,
+        0x02724201, 0x06724216, 0x02754201, 0x06754216, 0x063a4200, 0x06424200,
+        0x06434200, 0x06444200, 0x06454200, 0x06464200, 0x06474200, 0x06484200,
+        0x06494200, 0x064a4200, 0x064b4200, 0x064c4200, 0x064d4200, 0x064e4200,
+        0x064f4200, 0x06504200, 0x06514200, 0x06524200, 0x06534200, 0x06544200,
+        0x06554200, 0x06564200, 0x06574200, 0x06594200, 0x066a4200, 0x066b4200,
+        0x06714200, 0x06764200, 0x06774200, 0x06784200, 0x06794200, 0x067a4200,
+        0x01004246, 0x01004247, 0x01004249, 0x0500424a
+    },
+    /* 39 */
+    {
+        0x02304302, 0x02304309, 0x02304317, 0x06304328, 0x02314302, 0x02314309,
+        0x02314317, 0x06314328, 0x02324302, 0x02324309, 0x02324317, 0x06324328,
+        0x02614302, 0x02614309, 0x02614317, 0x06614328, 0x02634302, 0x02634309,
+        0x02634317, 0x06634328, 0x02654302, 0x02654309, 0x02654317, 0x06654328,
+        0x02694302, 0x02694309, 0x02694317, 0x06694328, 0x026f4302, 0x026f4309,
+        0x026f4317, 0x066f4328, 0x02734302, 0x02734309, 0x02734317, 0x06734328,
+        0x02744302, 0x02744309, 0x02744317, 0x06744328, 0x02204301, 0x06204316,
+        0x02254301, 0x06254316, 0x022d4301, 0x062d4316, 0x022e4301, 0x062e4316,
+        0x022f4301, 0x062f4316, 0x02334301, 0x06334316, 0x02344301, 0x06344316,
+        0x02354301, 0x06354316, 0x02364301, 0x06364316, 0x02374301, 0x06374316,
+        0x02384301, 0x06384316, 0x02394301, 0x06394316, 0x023d4301, 0x063d4316,
+        0x02414301, 0x06414316, 0x025f4301, 0x065f4316, 0x02624301, 0x06624316,
+        0x02644301, 0x06644316, 0x02664301, 0x06664316, 0x02674301, 0x06674316,
+        0x02684301, 0x06684316, 0x026c4301, 0x066c4316, 0x026d4301, 0x066d4316,
+        0x026e4301, 0x066e4316, 0x02704301, 0x06704316, 0x02724301, 0x06724316,
+        0x02754301, 0x06754316, 0x063a4300, 0x06424300, 0x06434300, 0x06444300,
+        0x06454300, 0x06464300, 0x06474300, 0x06484300, 0x06494300, 0x064a4300,
+        0x064b4300, 0x064c4300, 0x064d4300, 0x064e4300, 0x064f4300, 0x06504300,
+        0x06514300, 0x06524300, 0x06534300, 0x06544300, 0x06554300, 0x06564300,
+        0x06574300, 0x06594300, 0x066a4300, 0x066b4300, 0x06714300, 0x06764300,
+        0x06774300, 0x06784300, 0x06794300, 0x067a4300, 0x01004346, 0x01004347,
+        0x01004349, 0x0500434a, 0x02304402, 0x02304409, 0x02304417, 0x06304428,
+        0x02314402, 0x02314409, 0x02314417, 0x06314428, 0x02324402, 0x02324409,
+        0x02324417, 0x06324428, 0x02614402, 0x02614409, 0x02614417, 0x06614428,
+        0x02634402, 0x02634409, 0x02634417, 0x06634428, 0x02654402, 0x02654409,
+        0x02654417, 0x06654428, 0x02694402, 0x02694409, 0x02694417, 0x06694428,
+        0x026f4402, 0x026f4409, 0x026f4417, 0x066f4428, 0x02734402, 0x02734409,
+        0x02734417, 0x06734428, 0x02744402, 0x02744409, 0x02744417, 0x06744428,
+        0x02204401, 0x06204416, 0x02254401, 0x06254416, 0x022d4401, 0x062d4416,
+        0x022e4401, 0x062e4416, 0x022f4401, 0x062f4416, 0x02334401, 0x06334416,
+        0x02344401, 0x06344416, 0x02354401, 0x06354416, 0x02364401, 0x06364416,
+        0x02374401, 0x06374416, 0x02384401, 0x06384416, 0x02394401, 0x06394416,
+        0x023d4401, 0x063d4416, 0x02414401, 0x06414416, 0x025f4401, 0x065f4416,
+        0x02624401, 0x06624416, 0x02644401, 0x06644416, 0x02664401, 0x06664416,
+        0x02674401, 0x06674416, 0x02684401, 0x06684416, 0x026c4401, 0x066c4416,
+        0x026d4401, 0x066d4416, 0x026e4401, 0x066e4416, 0x02704401, 0x06704416,
+        0x02724401, 0x06724416, 0x02754401, 0x06754416, 0x063a4400, 0x06424400,
+        0x06434400, 0x06444400, 0x06454400, 0x06464400, 0x06474400, 0x06484400,
+        0x06494400, 0x064a4400, 0x064b4400, 0x064c4400, 0x064d4400, 0x064e4400,
+        0x064f4400, 0x06504400, 0x06514400, 0x06524400, 0x06534400, 0x06544400,
+        0x06554400, 0x06564400, 0x06574400, 0x06594400, 0x066a4400, 0x066b4400,
+        0x06714400, 0x06764400, 0x06774400, 0x06784400, 0x06794400, 0x067a4400,
+        0x01004446, 0x01004447, 0x01004449, 0x0500444a
+    },
+    /* 40 */
+    {
+        0x01004503, 0x01004506, 0x0100450a, 0x0100450f, 0x01004518, 0x0100451f,
+        0x01004529, 0x05004538, 0x01004603, 0x01004606, 0x0100460a, 0x0100460f,
+        0x01004618, 0x0100461f, 0x01004629, 0x05004638, 0x01004703, 0x01004706,
+        0x0100470a, 0x0100470f, 0x01004718, 0x0100471f, 0x01004729, 0x05004738,
+        0x01004803, 0x01004806, 0x0100480a, 0x0100480f, 0x01004818, 0x0100481f,
+        0x01004829, 0x05004838, 0x01004903, 0x01004906, 0x0100490a, 0x0100490f,
+        0x01004918, 0x0100491f, 0x01004929, 0x05004938, 0x01004a03, 0x01004a06,
+        0x01004a0a, 0x01004a0f, 0x01004a18, 0x01004a1f, 0x01004a29, 0x05004a38,
+        0x01004b03, 0x01004b06, 0x01004b0a, 0x01004b0f, 0x01004b18, 0x01004b1f,
+        0x01004b29, 0x05004b38, 0x01004c03, 0x01004c06, 0x01004c0a, 0x01004c0f,
+        0x01004c18, 0x01004c1f, 0x01004c29, 0x05004c38, 0x01004d03, 0x01004d06,
+        0x01004d0a, 0x01004d0f, 0x01004d18, 0x01004d1f, 0x01004d29, 0x05004d38,
+        0x01004e03, 0x01004e06, 0x01004e0a, 0x01004e0f, 0x01004e18, 0x01004e1f,
+        0x01004e29, 0x05004e38, 0x01004f03, 0x01004f06, 0x01004f0a, 0x01004f0f,
+        0x01004f18, 0x01004f1f, 0x01004f29, 0x05004f38, 0x01005003, 0x01005006,
+        0x0100500a, 0x0100500f, 0x01005018, 0x0100501f, 0x01005029, 0x05005038,
+        0x01005103, 0x01005106, 0x0100510a, 0x0100510f, 0x01005118, 0x0100511f,
+        0x01005129, 0x05005138, 0x01005203, 0x01005206, 0x0100520a, 0x0100520f,
+        0x01005218, 0x0100521f, 0x01005229, 0x05005238, 0x01005303, 0x01005306,
+        0x0100530a, 0x0100530f, 0x01005318, 0x0100531f, 0x01005329, 0x05005338,
+        0x01005403, 0x01005406, 0x0100540a, 0x0100540f, 0x01005418, 0x0100541f,
+        0x01005429, 0x05005438, 0x01005503, 0x01005506, 0x0100550a, 0x0100550f,
+        0x01005518, 0x0100551f, 0x01005529, 0x05005538, 0x01005603, 0x01005606,
+        0x0100560a, 0x0100560f, 0x01005618, 0x0100561f, 0x01005629, 0x05005638,
+        0x01005703, 0x01005706, 0x0100570a, 0x0100570f, 0x01005718, 0x0100571f,
+        0x01005729, 0x05005738, 0x01005903, 0x01005906, 0x0100590a, 0x0100590f,
+        0x01005918, 0x0100591f, 0x01005929, 0x05005938, 0x01006a03, 0x01006a06,
+        0x01006a0a, 0x01006a0f, 0x01006a18, 0x01006a1f, 0x01006a29, 0x05006a38,
+        0x01006b03, 0x01006b06, 0x01006b0a, 0x01006b0f, 0x01006b18, 0x01006b1f,
+        0x01006b29, 0x05006b38, 0x01007103, 0x01007106, 0x0100710a, 0x0100710f,
+        0x01007118, 0x0100711f, 0x01007129, 0x05007138, 0x01007603, 0x01007606,
+        0x0100760a, 0x0100760f, 0x01007618, 0x0100761f, 0x01007629, 0x05007638,
+        0x01007703, 0x01007706, 0x0100770a, 0x0100770f, 0x01007718, 0x0100771f,
+        0x01007729, 0x05007738, 0x01007803, 0x01007806, 0x0100780a, 0x0100780f,
+        0x01007818, 0x0100781f, 0x01007829, 0x05007838, 0x01007903, 0x01007906,
+        0x0100790a, 0x0100790f, 0x01007918, 0x0100791f, 0x01007929, 0x05007938,
+        0x01007a03, 0x01007a06, 0x01007a0a, 0x01007a0f, 0x01007a18, 0x01007a1f,
+        0x01007a29, 0x05007a38, 0x01002602, 0x01002609, 0x01002617, 0x05002628,
+        0x01002a02, 0x01002a09, 0x01002a17, 0x05002a28, 0x01002c02, 0x01002c09,
+        0x01002c17, 0x05002c28, 0x01003b02, 0x01003b09, 0x01003b17, 0x05003b28,
+        0x01005802, 0x01005809, 0x01005817, 0x05005828, 0x01005a02, 0x01005a09,
+        0x01005a17, 0x05005a28, 0x05002100, 0x05002200, 0x05002800, 0x05002900,
+        0x05003f00, 0x00000050, 0x00000052, 0x04000054
+    },
+    /* 41 */
+    {
+        0x01004504, 0x01004505, 0x01004507, 0x01004508, 0x0100450b, 0x0100450c,
+        0x01004510, 0x01004513, 0x01004519, 0x0100451c, 0x01004520, 0x01004523,
+        0x0100452a, 0x01004531, 0x01004539, 0x05004540, 0x01004604, 0x01004605,
+        0x01004607, 0x01004608, 0x0100460b, 0x0100460c, 0x01004610, 0x01004613,
+        0x01004619, 0x0100461c, 0x01004620, 0x01004623, 0x0100462a, 0x01004631,
+        0x01004639, 0x05004640, 0x01004704, 0x01004705, 0x01004707, 0x01004708,
+        0x0100470b, 0x0100470c, 0x01004710, 0x01004713, 0x01004719, 0x0100471c,
+        0x01004720, 0x01004723, 0x0100472a, 0x01004731, 0x01004739, 0x05004740,
+        0x01004804, 0x01004805, 0x01004807, 0x01004808, 0x0100480b, 0x0100480c,
+        0x01004810, 0x01004813, 0x01004819, 0x0100481c, 0x01004820, 0x01004823,
+        0x0100482a, 0x01004831, 0x01004839, 0x05004840, 0x01004904, 0x01004905,
+        0x01004907, 0x01004908, 0x0100490b, 0x0100490c, 0x01004910, 0x01004913,
+        0x01004919, 0x0100491c, 0x01004920, 0x01004923, 0x0100492a, 0x01004931,
+        0x01004939, 0x05004940, 0x01004a04, 0x01004a05, 0x01004a07, 0x01004a08,
+        0x01004a0b, 0x01004a0c, 0x01004a10, 0x01004a13, 0x01004a19, 0x01004a1c,
+        0x01004a20, 0x01004a23, 0x01004a2a, 0x01004a31, 0x01004a39, 0x05004a40,
+        0x01004b04, 0x01004b05, 0x01004b07, 0x01004b08, 0x01004b0b, 0x01004b0c,
+        0x01004b10, 0x01004b13, 0x01004b19, 0x01004b1c, 0x01004b20, 0x01004b23,
+        0x01004b2a, 0x01004b31, 0x01004b39, 0x05004b40, 0x01004c04, 0x01004c05,
+        0x01004c07, 0x01004c08, 0x01004c0b, 0x01004c0c, 0x01004c10, 0x01004c13,
+        0x01004c19, 0x01004c1c, 0x01004c20, 0x01004c23, 0x01004c2a, 0x01004c31,
+        0x01004c39, 0x05004c40, 0x01004d04, 0x01004d05, 0x01004d07, 0x01004d08,
+        0x01004d0b, 0x01004d0c, 0x01004d10, 0x01004d13, 0x01004d19, 0x01004d1c,
+        0x01004d20, 0x01004d23, 0x01004d2a, 0x01004d31, 0x01004d39, 0x05004d40,
+        0x01004e04, 0x01004e05, 0x01004e07, 0x01004e08, 0x01004e0b, 0x01004e0c,
+        0x01004e10, 0x01004e13, 0x01004e19, 0x01004e1c, 0x01004e20, 0x01004e23,
+        0x01004e2a, 0x01004e31, 0x01004e39, 0x05004e40, 0x01004f04, 0x01004f05,
+        0x01004f07, 0x01004f08, 0x01004f0b, 0x01004f0c, 0x01004f10, 0x01004f13,
+        0x01004f19, 0x01004f1c, 0x01004f20, 0x01004f23, 0x01004f2a, 0x01004f31,
+        0x01004f39, 0x05004f40, 0x01005004, 0x01005005, 0x01005007, 0x01005008,
+        0x0100500b, 0x0100500c, 0x01005010, 0x01005013, 0x01005019, 0x0100501c,
+        0x01005020, 0x01005023, 0x0100502a, 0x01005031, 0x01005039, 0x05005040,
+        0x01005104, 0x01005105, 0x01005107, 0x01005108, 0x0100510b, 0x0100510c,
+        0x01005110, 0x01005113, 0x01005119, 0x0100511c, 0x01005120, 0x01005123,
+        0x0100512a, 0x01005131, 0x01005139, 0x05005140, 0x01005204, 0x01005205,
+        0x01005207, 0x01005208, 0x0100520b, 0x0100520c, 0x01005210, 0x01005213,
+        0x01005219, 0x0100521c, 0x01005220, 0x01005223, 0x0100522a, 0x01005231,
+        0x01005239, 0x05005240, 0x01005304, 0x01005305, 0x01005307, 0x01005308,
+        0x0100530b, 0x0100530c, 0x01005310, 0x01005313, 0x01005319, 0x0100531c,
+        0x01005320, 0x01005323, 0x0100532a, 0x01005331, 0x01005339, 0x05005340,
+        0x01005404, 0x01005405, 0x01005407, 0x01005408, 0x0100540b, 0x0100540c,
+        0x01005410, 0x01005413, 0x01005419, 0x0100541c, 0x01005420, 0x01005423,
+        0x0100542a, 0x01005431, 0x01005439, 0x05005440
+    },
+    /* 42 */
+    {
+        0x06304500, 0x06314500, 0x06324500, 0x06614500, 0x06634500, 0x06654500,
+        0x06694500, 0x066f4500, 0x06734500, 0x06744500, 0x0100450d, 0x0100450e,
+        0x01004511, 0x01004512, 0x01004514, 0x01004515, 0x0100451a, 0x0100451b,
+        0x0100451d, 0x0100451e, 0x01004521, 0x01004522, 0x01004524, 0x01004525,
+        0x0100452b, 0x0100452e, 0x01004532, 0x01004535, 0x0100453a, 0x0100453d,
+        0x01004541, 0x05004544, 0x06304600, 0x06314600, 0x06324600, 0x06614600,
+        0x06634600, 0x06654600, 0x06694600, 0x066f4600, 0x06734600, 0x06744600,
+        0x0100460d, 0x0100460e, 0x01004611, 0x01004612, 0x01004614, 0x01004615,
+        0x0100461a, 0x0100461b, 0x0100461d, 0x0100461e, 0x01004621, 0x01004622,
+        0x01004624, 0x01004625, 0x0100462b, 0x0100462e, 0x01004632, 0x01004635,
+        0x0100463a, 0x0100463d, 0x01004641, 0x05004644, 0x06304700, 0x06314700,
+        0x06324700, 0x06614700, 0x06634700, 0x06654700, 0x06694700, 0x066f4700,
+        0x06734700, 0x06744700, 0x0100470d, 0x0100470e, 0x01004711, 0x01004712,
+        0x01004714, 0x01004715, 0x0100471a, 0x0100471b, 0x0100471d, 0x0100471e,
+        0x01004721, 0x01004722, 0x01004724, 0x01004725, 0x0100472b, 0x0100472e,
+        0x01004732, 0x01004735, 0x0100473a, 0x0100473d, 0x01004741, 0x05004744,
+        0x06304800, 0x06314800, 0x06324800, 0x06614800, 0x06634800, 0x06654800,
+        0x06694800, 0x066f4800, 0x06734800, 0x06744800, 0x0100480d, 0x0100480e,
+        0x01004811, 0x01004812, 0x01004814, 0x01004815, 0x0100481a, 0x0100481b,
+        0x0100481d, 0x0100481e, 0x01004821, 0x01004822, 0x01004824, 0x01004825,
+        0x0100482b, 0x0100482e, 0x01004832, 0x01004835, 0x0100483a, 0x0100483d,
+        0x01004841, 0x05004844, 0x06304900, 0x06314900, 0x06324900, 0x06614900,
+        0x06634900, 0x06654900, 0x06694900, 0x066f4900, 0x06734900, 0x06744900,
+        0x0100490d, 0x0100490e, 0x01004911, 0x01004912, 0x01004914, 0x01004915,
+        0x0100491a, 0x0100491b, 0x0100491d, 0x0100491e, 0x01004921, 0x01004922,
+        0x01004924, 0x01004925, 0x0100492b, 0x0100492e, 0x01004932, 0x01004935,
+        0x0100493a, 0x0100493d, 0x01004941, 0x05004944, 0x06304a00, 0x06314a00,
+        0x06324a00, 0x06614a00, 0x06634a00, 0x06654a00, 0x06694a00, 0x066f4a00,
+        0x06734a00, 0x06744a00, 0x01004a0d, 0x01004a0e, 0x01004a11, 0x01004a12,
+        0x01004a14, 0x01004a15, 0x01004a1a, 0x01004a1b, 0x01004a1d, 0x01004a1e,
+        0x01004a21, 0x01004a22, 0x01004a24, 0x01004a25, 0x01004a2b, 0x01004a2e,
+        0x01004a32, 0x01004a35, 0x01004a3a, 0x01004a3d, 0x01004a41, 0x05004a44,
+        0x06304b00, 0x06314b00, 0x06324b00, 0x06614b00, 0x06634b00, 0x06654b00,
+        0x06694b00, 0x066f4b00, 0x06734b00, 0x06744b00, 0x01004b0d, 0x01004b0e,
+        0x01004b11, 0x01004b12, 0x01004b14, 0x01004b15, 0x01004b1a, 0x01004b1b,
+        0x01004b1d, 0x01004b1e, 0x01004b21, 0x01004b22, 0x01004b24, 0x01004b25,
+        0x01004b2b, 0x01004b2e, 0x01004b32, 0x01004b35, 0x01004b3a, 0x01004b3d,
+        0x01004b41, 0x05004b44, 0x06304c00, 0x06314c00, 0x06324c00, 0x06614c00,
+        0x06634c00, 0x06654c00, 0x06694c00, 0x066f4c00, 0x06734c00, 0x06744c00,
+        0x01004c0d, 0x01004c0e, 0x01004c11, 0x01004c12, 0x01004c14, 0x01004c15,
+        0x01004c1a, 0x01004c1b, 0x01004c1d, 0x01004c1e, 0x01004c21, 0x01004c22,
+        0x01004c24, 0x01004c25, 0x01004c2b, 0x01004c2e, 0x01004c32, 0x01004c35,
+        0x01004c3a, 0x01004c3d, 0x01004c41, 0x05004c44
+    },
+    /* 43 */
+    {
+        0x02304501, 0x06304516, 0x02314501, 0x06314516, 0x02324501, 0x06324516,
+        0x02614501, 0x06614516, 0x02634501, 0x06634516, 0x02654501, 0x06654516,
+        0x02694501, 0x06694516, 0x026f4501, 0x066f4516, 0x02734501, 0x06734516,
+        0x02744501, 0x06744516, 0x06204500, 0x06254500, 0x062d4500, 0x062e4500,
+        0x062f4500, 0x06334500, 0x06344500, 0x06354500, 0x06364500, 0x06374500,
+        0x06384500, 0x06394500, 0x063d4500, 0x06414500, 0x065f4500, 0x06624500,
+        0x06644500, 0x06664500, 0x06674500, 0x06684500, 0x066c4500, 0x066d4500,
+        0x066e4500, 0x06704500, 0x06724500, 0x06754500, 0x01004526, 0x01004527,
+        0x0100452c, 0x0100452d, 0x0100452f, 0x01004530, 0x01004533, 0x01004534,
+        0x01004536, 0x01004537, 0x0100453b, 0x0100453c, 0x0100453e, 0x0100453f,
+        0x01004542, 0x01004543, 0x01004545, 0x05004548, 0x02304601, 0x06304616,
+        0x02314601, 0x06314616, 0x02324601, 0x06324616, 0x02614601, 0x06614616,
+        0x02634601, 0x06634616, 0x02654601, 0x06654616, 0x02694601, 0x06694616,
+        0x026f4601, 0x066f4616, 0x02734601, 0x06734616, 0x02744601, 0x06744616,
+        0x06204600, 0x06254600, 0x062d4600, 0x062e4600, 0x062f4600, 0x06334600,
+        0x06344600, 0x06354600, 0x06364600, 0x06374600, 0x06384600, 0x06394600,
+        0x063d4600, 0x06414600, 0x065f4600, 0x06624600, 0x06644600, 0x06664600,
+        0x06674600, 0x06684600, 0x066c4600, 0x066d4600, 0x066e4600, 0x06704600,
+        0x06724600, 0x06754600, 0x01004626, 0x01004627, 0x0100462c, 0x0100462d,
+        0x0100462f, 0x01004630, 0x01004633, 0x01004634, 0x01004636, 0x01004637,
+        0x0100463b, 0x0100463c, 0x0100463e, 0x0100463f, 0x01004642, 0x01004643,
+        0x01004645, 0x05004648, 0x02304701, 0x06304716, 0x02314701, 0x06314716,
+        0x02324701, 0x06324716, 0x02614701, 0x06614716, 0x02634701, 0x06634716,
+        0x02654701, 0x06654716, 0x02694701, 0x06694716, 0x026f4701, 0x066f4716,
+        0x02734701, 0x06734716, 0x02744701, 0x06744716, 0x06204700, 0x06254700,
+        0x062d4700, 0x062e4700, 0x062f4700, 0x06334700, 0x06344700, 0x06354700,
+        0x06364700, 0x06374700, 0x06384700, 0x06394700, 0x063d4700, 0x06414700,
+        0x065f4700, 0x06624700, 0x06644700, 0x06664700, 0x06674700, 0x06684700,
+        0x066c4700, 0x066d4700, 0x066e4700, 0x06704700, 0x06724700, 0x06754700,
+        0x01004726, 0x01004727, 0x0100472c, 0x0100472d, 0x0100472f, 0x01004730,
+        0x01004733, 0x01004734, 0x01004736, 0x01004737, 0x0100473b, 0x0100473c,
+        0x0100473e, 0x0100473f, 0x01004742, 0x01004743, 0x01004745, 0x05004748,
+        0x02304801, 0x06304816, 0x02314801, 0x06314816, 0x02324801, 0x06324816,
+        0x02614801, 0x06614816, 0x02634801, 0x06634816, 0x02654801, 0x06654816,
+        0x02694801, 0x06694816, 0x026f4801, 0x066f4816, 0x02734801, 0x06734816,
+        0x02744801, 0x06744816, 0x06204800, 0x06254800, 0x062d4800, 0x062e4800,
+        0x062f4800, 0x06334800, 0x06344800, 0x06354800, 0x06364800, 0x06374800,
+        0x06384800, 0x06394800, 0x063d4800, 0x06414800, 0x065f4800, 0x06624800,
+        0x06644800, 0x06664800, 0x06674800, 0x06684800, 0x066c4800, 0x066d4800,
+        0x066e4800, 0x06704800, 0x06724800, 0x06754800, 0x01004826, 0x01004827,
+        0x0100482c, 0x0100482d, 0x0100482f, 0x01004830, 0x01004833, 0x01004834,
+        0x01004836, 0x01004837, 0x0100483b, 0x0100483c, 0x0100483e, 0x0100483f,
+        0x01004842, 0x01004843, 0x01004845, 0x05004848
+    },
+    /* 44 */
+    {
+        0x02304502, 0x02304509, 0x02304517, 0x06304528, 0x02314502, 0x02314509,
+        0x02314517, 0x06314528, 0x02324502, 0x02324509, 0x02324517, 0x06324528,
+        0x02614502, 0x02614509, 0x02614517, 0x06614528, 0x02634502, 0x02634509,
+        0x02634517, 0x06634528, 0x02654502, 0x02654509, 0x02654517, 0x06654528,
+        0x02694502, 0x02694509, 0x02694517, 0x06694528, 0x026f4502, 0x026f4509,
+        0x026f4517, 0x066f4528, 0x02734502, 0x02734509, 0x02734517, 0x06734528,
+        0x02744502, 0x02744509, 0x02744517, 0x06744528, 0x02204501, 0x06204516,
+        0x02254501, 0x06254516, 0x022d4501, 0x062d4516, 0x022e4501, 0x062e4516,
+        0x022f4501, 0x062f4516, 0x02334501, 0x06334516, 0x02344501, 0x06344516,
+        0x02354501, 0x06354516, 0x02364501, 0x06364516, 0x02374501, 0x06374516,
+        0x02384501, 0x06384516, 0x02394501, 0x06394516, 0x023d4501, 0x063d4516,
+        0x02414501, 0x06414516, 0x025f4501, 0x065f4516, 0x02624501, 0x06624516,
+        0x02644501, 0x06644516, 0x02664501, 0x06664516, 0x02674501, 0x06674516,
+        0x02684501, 0x06684516, 0x026c4501, 0x066c4516, 0x026d4501, 0x066d4516,
+        0x026e4501, 0x066e4516, 0x02704501, 0x06704516, 0x02724501, 0x06724516,
+        0x02754501, 0x06754516, 0x063a4500, 0x06424500, 0x06434500, 0x06444500,
+        0x06454500, 0x06464500, 0x06474500, 0x06484500, 0x06494500, 0x064a4500,
+        0x064b4500, 0x064c4500, 0x064d4500, 0x064e4500, 0x064f4500, 0x06504500,
+        0x06514500, 0x06524500, 0x06534500, 0x06544500, 0x06554500, 0x06564500,
+        0x06574500, 0x06594500, 0x066a4500, 0x066b4500, 0x06714500, 0x06764500,
+        0x06774500, 0x06784500, 0x06794500, 0x067a4500, 0x01004546, 0x01004547,
+        0x01004549, 0x0500454a, 0x02304602, 0x02304609, 0x02304617, 0x06304628,
+        0x02314602, 0x02314609, 0x02314617, 0x06314628, 0x02324602, 0x02324609,
+        0x02324617, 0x06324628, 0x02614602, 0x02614609, 0x02614617, 0x06614628,
+        0x02634602, 0x02634609, 0x02634617, 0x06634628, 0x02654602, 0x02654609,
+        0x02654617, 0x06654628, 0x02694602, 0x02694609, 0x02694617, 0x06694628,
+        0x026f4602, 0x026f4609, 0x026f4617, 0x066f4628, 0x02734602, 0x02734609,
+        0x02734617, 0x06734628, 0x02744602, 0x02744609, 0x02744617, 0x06744628,
+        0x02204601, 0x06204616, 0x02254601, 0x06254616, 0x022d4601, 0x062d4616,
+        0x022e4601, 0x062e4616, 0x022f4601, 0x062f4616, 0x02334601, 0x06334616,
+        0x02344601, 0x06344616, 0x02354601, 0x06354616, 0x02364601, 0x06364616,
+        0x02374601, 0x06374616, 0x02384601, 0x06384616, 0x02394601, 0x06394616,
+        0x023d4601, 0x063d4616, 0x02414601, 0x06414616, 0x025f4601, 0x065f4616,
+        0x02624601, 0x06624616, 0x02644601, 0x06644616, 0x02664601, 0x06664616,
+        0x02674601, 0x06674616, 0x02684601, 0x06684616, 0x026c4601, 0x066c4616,
+        0x026d4601, 0x066d4616, 0x026e4601, 0x066e4616, 0x02704601, 0x06704616,
+        0x02724601, 0x06724616, 0x02754601, 0x06754616, 0x063a4600, 0x06424600,
+        0x06434600, 0x06444600, 0x06454600, 0x06464600, 0x06474600, 0x06484600,
+        0x06494600, 0x064a4600, 0x064b4600, 0x064c4600, 0x064d4600, 0x064e4600,
+        0x064f4600, 0x06504600, 0x06514600, 0x06524600, 0x06534600, 0x06544600,
+        0x06554600, 0x06564600, 0x06574600, 0x06594600, 0x066a4600, 0x066b4600,
+        0x06714600, 0x06764600, 0x06774600, 0x06784600, 0x06794600, 0x067a4600,
+        0x01004646, 0x01004647, 0x01004649, 0x0500464a
+    },
+    /* 45 */
+    {
+        0x02304702, 0x02304709, 0x02304717, 0x06304728, 0x02314702, 0x02314709,
+        0x02314717, 0x06314728, 0x02324702, 0x02324709, 0x02324717, 0x06324728,
+        0x02614702, 0x02614709, 0x02614717, 0x06614728, 0x02634702, 0x02634709,
+        0x02634717, 0x06634728, 0x02654702, 0x02654709, 0x02654717, 0x06654728,
+        0x02694702, 0x02694709, 0x02694717, 0x06694728, 0x026f4702, 0x026f4709,
+        0x026f4717, 0x066f4728, 0x02734702, 0x02734709, 0x02734717, 0x06734728,
+        0x02744702, 0x02744709, 0x02744717, 0x06744728, 0x02204701, 0x06204716,
+        0x02254701, 0x06254716, 0x022d4701, 0x062d4716, 0x022e4701, 0x062e4716,
+        0x022f4701, 0x062f4716, 0x02334701, 0x06334716, 0x02344701, 0x06344716,
+        0x02354701, 0x06354716, 0x02364701, 0x06364716, 0x02374701, 0x06374716,
+        0x02384701, 0x06384716, 0x02394701, 0x06394716, 0x023d4701, 0x063d4716,
+        0x02414701, 0x06414716, 0x025f4701, 0x065f4716, 0x02624701, 0x06624716,
+        0x02644701, 0x06644716, 0x02664701, 0x06664716, 0x02674701, 0x06674716,
+        0x02684701, 0x06684716, 0x026c4701, 0x066c4716, 0x026d4701, 0x066d4716,
+        0x026e4701, 0x066e4716, 0x02704701, 0x06704716, 0x02724701, 0x06724716,
+        0x02754701, 0x06754716, 0x063a4700, 0x06424700, 0x06434700, 0x06444700,
+        0x06454700, 0x06464700, 0x06474700, 0x06484700, 0x06494700, 0x064a4700,
+        0x064b4700, 0x064c4700, 0x064d4700, 0x064e4700, 0x064f4700, 0x06504700,
+        0x06514700, 0x06524700, 0x06534700, 0x06544700, 0x06554700, 0x06564700,
+        0x06574700, 0x06594700, 0x066a4700, 0x066b4700, 0x06714700, 0x06764700,
+        0x06774700, 0x06784700, 0x06794700, 0x067a4700, 0x01004746, 0x01004747,
+        0x01004749, 0x0500474a, 0x02304802, 0x02304809, 0x02304817, 0x06304828,
+        0x02314802, 0x02314809, 0x02314817, 0x06314828, 0x02324802, 0x02324809,
+        0x02324817, 0x06324828, 0x02614802, 0x02614809, 0x02614817, 0x06614828,
+        0x02634802, 0x02634809, 0x02634817, 0x06634828, 0x02654802, 0x02654809,
+        0x02654817, 0x06654828, 0x02694802, 0x02694809, 0x02694817, 0x06694828,
+        0x026f4802, 0x026f4809, 0x026f4817, 0x066f4828, 0x02734802, 0x02734809,
+        0x02734817, 0x06734828, 0x02744802, 0x02744809, 0x02744817, 0x06744828,
+        0x02204801, 0x06204816, 0x02254801, 0x06254816, 0x022d4801, 0x062d4816,
+        0x022e4801, 0x062e4816, 0x022f4801, 0x062f4816, 0x02334801, 0x06334816,
+        0x02344801, 0x06344816, 0x02354801, 0x06354816, 0x02364801, 0x06364816,
+        0x02374801, 0x06374816, 0x02384801, 0x06384816, 0x02394801, 0x06394816,
+        0x023d4801, 0x063d4816, 0x02414801, 0x06414816, 0x025f4801, 0x065f4816,
+        0x02624801, 0x06624816, 0x02644801, 0x06644816, 0x02664801, 0x06664816,
+        0x02674801, 0x06674816, 0x02684801, 0x06684816, 0x026c4801, 0x066c4816,
+        0x026d4801, 0x066d4816, 0x026e4801, 0x066e4816, 0x02704801, 0x06704816,
+        0x02724801, 0x06724816, 0x02754801, 0x06754816, 0x063a4800, 0x06424800,
+        0x06434800, 0x06444800, 0x06454800, 0x06464800, 0x06474800, 0x06484800,
+        0x06494800, 0x064a4800, 0x064b4800, 0x064c4800, 0x064d4800, 0x064e4800,
+        0x064f4800, 0x06504800, 0x06514800, 0x06524800, 0x06534800, 0x06544800,
+        0x06554800, 0x06564800, 0x06574800, 0x06594800, 0x066a4800, 0x066b4800,
+        0x06714800, 0x06764800, 0x06774800, 0x06784800, 0x06794800, 0x067a4800,
+        0x01004846, 0x01004847, 0x01004849, 0x0500484a
+    },
+    /* 46 */
+    {
+        0x02304901, 0x06304916, 0x02314901, 0x06314916, 0x02324901, 0x06324916,
+        0x02614901, 0x06614916, 0x02634901, 0x06634916, 0x02654901, 0x06654916,
+        0x02694901, 0x06694916, 0x026f4901, 0x066f4916, 0x02734901, 0x06734916,
+        0x02744901, 0x06744916, 0x06204900, 0x06254900, 0x062d4900, 0x062e4900,
+        0x062f4900, 0x06334900, 0x06344900, 0x06354900, 0x06364900, 0x06374900,
+        0x06384900, 0x06394900, 0x063d4900, 0x06414900, 0x065f4900, 0x06624900,
+        0x06644900, 0x06664900, 0x06674900, 0x06684900, 0x066c4900, 0x066d4900,
+        0x066e4900, 0x06704900, 0x06724900, 0x06754900, 0x01004926, 0x01004927,
+        0x0100492c, 0x0100492d, 0x0100492f, 0x01004930, 0x01004933, 0x01004934,
+        0x01004936, 0x01004937, 0x0100493b, 0x0100493c, 0x0100493e, 0x0100493f,
+        0x01004942, 0x01004943, 0x01004945, 0x05004948, 0x02304a01, 0x06304a16,
+        0x02314a01, 0x06314a16, 0x02324a01, 0x06324a16, 0x02614a01, 0x06614a16,
+        0x02634a01, 0x06634a16, 0x02654a01, 0x06654a16, 0x02694a01, 0x06694a16,
+        0x026f4a01, 0x066f4a16, 0x02734a01, 0x06734a16, 0x02744a01, 0x06744a16,
+        0x06204a00, 0x06254a00, 0x062d4a00, 0x062e4a00, 0x062f4a00, 0x06334a00,
+        0x06344a00, 0x06354a00, 0x06364a00, 0x06374a00, 0x06384a00, 0x06394a00,
+        0x063d4a00, 0x06414a00, 0x065f4a00, 0x06624a00, 0x06644a00, 0x06664a00,
+        0x06674a00, 0x06684a00, 0x066c4a00, 0x066d4a00, 0x066e4a00, 0x06704a00,
+        0x06724a00, 0x06754a00, 0x01004a26, 0x01004a27, 0x01004a2c, 0x01004a2d,
+        0x01004a2f, 0x01004a30, 0x01004a33, 0x01004a34, 0x01004a36, 0x01004a37,
+        0x01004a3b, 0x01004a3c, 0x01004a3e, 0x01004a3f, 0x01004a42, 0x01004a43,
+        0x01004a45, 0x05004a48, 0x02304b01, 0x06304b16, 0x02314b01, 0x06314b16,
+        0x02324b01, 0x06324b16, 0x02614b01, 0x06614b16, 0x02634b01, 0x06634b16,
+        0x02654b01, 0x06654b16, 0x02694b01, 0x06694b16, 0x026f4b01, 0x066f4b16,
+        0x02734b01, 0x06734b16, 0x02744b01, 0x06744b16, 0x06204b00, 0x06254b00,
+        0x062d4b00, 0x062e4b00, 0x062f4b00, 0x06334b00, 0x06344b00, 0x06354b00,
+        0x06364b00, 0x06374b00, 0x06384b00, 0x06394b00, 0x063d4b00, 0x06414b00,
+        0x065f4b00, 0x06624b00, 0x06644b00, 0x06664b00, 0x06674b00, 0x06684b00,
+        0x066c4b00, 0x066d4b00, 0x066e4b00, 0x06704b00, 0x06724b00, 0x06754b00,
+        0x01004b26, 0x01004b27, 0x01004b2c, 0x01004b2d, 0x01004b2f, 0x01004b30,
+        0x01004b33, 0x01004b34, 0x01004b36, 0x01004b37, 0x01004b3b, 0x01004b3c,
+        0x01004b3e, 0x01004b3f, 0x01004b42, 0x01004b43, 0x01004b45, 0x05004b48,
+        0x02304c01, 0x06304c16, 0x02314c01, 0x06314c16, 0x02324c01, 0x06324c16,
+        0x02614c01, 0x06614c16, 0x02634c01, 0x06634c16, 0x02654c01, 0x06654c16,
+        0x02694c01, 0x06694c16, 0x026f4c01, 0x066f4c16, 0x02734c01, 0x06734c16,
+        0x02744c01, 0x06744c16, 0x06204c00, 0x06254c00, 0x062d4c00, 0x062e4c00,
+        0x062f4c00, 0x06334c00, 0x06344c00, 0x06354c00, 0x06364c00, 0x06374c00,
+        0x06384c00, 0x06394c00, 0x063d4c00, 0x06414c00, 0x065f4c00, 0x06624c00,
+        0x06644c00, 0x06664c00, 0x06674c00, 0x06684c00, 0x066c4c00, 0x066d4c00,
+        0x066e4c00, 0x06704c00, 0x06724c00, 0x06754c00, 0x01004c26, 0x01004c27,
+        0x01004c2c, 0x01004c2d, 0x01004c2f, 0x01004c30, 0x01004c33, 0x01004c34,
+        0x01004c36, 0x01004c37, 0x01004c3b, 0x01004c3c, 0x01004c3e, 0x01004c3f,
+        0x01004c42, 0x01004c43, 0x01004c45, 0x05004c48
+    },
+    /* 47 */
+    {
+        0x02304902, 0x02304909, 0x02304917, 0x06304928, 0x02314902, 0x02314909,
+        0x02314917, 0x06314928, 0x02324902, 0x02324909, 0x02324917, 0x06324928,
+        0x02614902, 0x02614909, 0x02614917, 0x06614928, 0x02634902, 0x02634909,
+        0x02634917, 0x06634928, 0x02654902, 0x02654909, 0x02654917, 0x06654928,
+        0x02694902, 0x02694909, 0x02694917, 0x06694928, 0x026f4902, 0x026f4909,
+        0x026f4917, 0x066f4928, 0x02734902, 0x02734909, 0x02734917, 0x06734928,
+        0x02744902, 0x02744909, 0x02744917, 0x06744928, 0x02204901, 0x06204916,
+        0x02254901, 0x06254916, 0x022d4901, 0x062d4916, 0x022e4901, 0x062e4916,
+        0x022f4901, 0x062f4916, 0x02334901, 0x06334916, 0x02344901, 0x06344916,
+        0x02354901, 0x06354916, 0x02364901, 0x06364916, 0x02374901, 0x06374916,
+        0x02384901, 0x06384916, 0x02394901, 0x06394916, 0x023d4901, 0x063d4916,
+        0x02414901, 0x06414916, 0x025f4901, 0x065f4916, 0x02624901, 0x06624916,
+        0x02644901, 0x06644916, 0x02664901, 0x06664916, 0x02674901, 0x06674916,
+        0x02684901, 0x06684916, 0x026c4901, 0x066c4916, 0x026d4901, 0x066d4916,
+        0x026e4901, 0x066e4916, 0x02704901, 0x06704916, 0x02724901, 0x06724916,
+        0x02754901, 0x06754916, 0x063a4900, 0x06424900, 0x06434900, 0x06444900,
+        0x06454900, 0x06464900, 0x06474900, 0x06484900, 0x06494900, 0x064a4900,
+        0x064b4900, 0x064c4900, 0x064d4900, 0x064e4900, 0x064f4900, 0x06504900,
+        0x06514900, 0x06524900, 0x06534900, 0x06544900, 0x06554900, 0x06564900,
+        0x06574900, 0x06594900, 0x066a4900, 0x066b4900, 0x06714900, 0x06764900,
+        0x06774900, 0x06784900, 0x06794900, 0x067a4900, 0x01004946, 0x01004947,
+        0x01004949, 0x0500494a, 0x02304a02, 0x02304a09, 0x02304a17, 0x06304a28,
+        0x02314a02, 0x02314a09, 0x02314a17, 0x06314a28, 0x02324a02, 0x02324a09,
+        0x02324a17, 0x06324a28, 0x02614a02, 0x02614a09, 0x02614a17, 0x06614a28,
+        0x02634a02, 0x02634a09, 0x02634a17, 0x06634a28, 0x02654a02, 0x02654a09,
+        0x02654a17, 0x06654a28, 0x02694a02, 0x02694a09, 0x02694a17, 0x06694a28,
+        0x026f4a02, 0x026f4a09, 0x026f4a17, 0x066f4a28, 0x02734a02, 0x02734a09,
+        0x02734a17, 0x06734a28, 0x02744a02, 0x02744a09, 0x02744a17, 0x06744a28,
+        0x02204a01, 0x06204a16, 0x02254a01, 0x06254a16, 0x022d4a01, 0x062d4a16,
+        0x022e4a01, 0x062e4a16, 0x022f4a01, 0x062f4a16, 0x02334a01, 0x06334a16,
+        0x02344a01, 0x06344a16, 0x02354a01, 0x06354a16, 0x02364a01, 0x06364a16,
+        0x02374a01, 0x06374a16, 0x02384a01, 0x06384a16, 0x02394a01, 0x06394a16,
+        0x023d4a01, 0x063d4a16, 0x02414a01, 0x06414a16, 0x025f4a01, 0x065f4a16,
+        0x02624a01, 0x06624a16, 0x02644a01, 0x06644a16, 0x02664a01, 0x06664a16,
+        0x02674a01, 0x06674a16, 0x02684a01, 0x06684a16, 0x026c4a01, 0x066c4a16,
+        0x026d4a01, 0x066d4a16, 0x026e4a01, 0x066e4a16, 0x02704a01, 0x06704a16,
+        0x02724a01, 0x06724a16, 0x02754a01, 0x06754a16, 0x063a4a00, 0x06424a00,
+        0x06434a00, 0x06444a00, 0x06454a00, 0x06464a00, 0x06474a00, 0x06484a00,
+        0x06494a00, 0x064a4a00, 0x064b4a00, 0x064c4a00, 0x064d4a00, 0x064e4a00,
+        0x064f4a00, 0x06504a00, 0x06514a00, 0x06524a00, 0x06534a00, 0x06544a00,
+        0x06554a00, 0x06564a00, 0x06574a00, 0x06594a00, 0x066a4a00, 0x066b4a00,
+        0x06714a00, 0x06764a00, 0x06774a00, 0x06784a00, 0x06794a00, 0x067a4a00,
+        0x01004a46, 0x01004a47, 0x01004a49, 0x05004a4a
+    },
+    /* 48 */
+    {
+        0x02304b02, 0x02304b09, 0x02304b17, 0x06304b28, 0x02314b02, 0x02314b09,
+        0x02314b17, 0x06314b28, 0x02324b02, 0x02324b09, 0x02324b17, 0x06324b28,
+        0x02614b02, 0x02614b09, 0x02614b17, 0x06614b28, 0x02634b02, 0x02634b09,
+        0x02634b17, 0x06634b28, 0x02654b02, 0x02654b09, 0x02654b17, 0x06654b28,
+        0x02694b02, 0x02694b09, 0x02694b17, 0x06694b28, 0x026f4b02, 0x026f4b09,
+        0x026f4b17, 0x066f4b28, 0x02734b02, 0x02734b09, 0x02734b17, 0x06734b28,
+        0x02744b02, 0x02744b09, 0x02744b17, 0x06744b28, 0x02204b01, 0x06204b16,
+        0x02254b01, 0x06254b16, 0x022d4b01, 0x062d4b16, 0x022e4b01, 0x062e4b16,
+        0x022f4b01, 0x062f4b16, 0x02334b01, 0x06334b16, 0x02344b01, 0x06344b16,
+        0x02354b01, 0x06354b16, 0x02364b01, 0x06364b16, 0x02374b01, 0x06374b16,
+        0x02384b01, 0x06384b16, 0x02394b01, 0x06394b16, 0x023d4b01, 0x063d4b16,
+        0x02414b01, 0x06414b16, 0x025f4b01, 0x065f4b16, 0x02624b01, 0x06624b16,
+        0x02644b01, 0x06644b16, 0x02664b01, 0x06664b16, 0x02674b01, 0x06674b16,
+        0x02684b01, 0x06684b16, 0x026c4b01, 0x066c4b16, 0x026d4b01, 0x066d4b16,
+        0x026e4b01, 0x066e4b16, 0x02704b01, 0x06704b16, 0x02724b01, 0x06724b16,
+        0x02754b01, 0x06754b16, 0x063a4b00, 0x06424b00, 0x06434b00, 0x06444b00,
+        0x06454b00, 0x06464b00, 0x06474b00, 0x06484b00, 0x06494b00, 0x064a4b00,
+        0x064b4b00, 0x064c4b00, 0x064d4b00, 0x064e4b00, 0x064f4b00, 0x06504b00,
+        0x06514b00, 0x06524b00, 0x06534b00, 0x06544b00, 0x06554b00, 0x06564b00,
+        0x06574b00, 0x06594b00, 0x066a4b00, 0x066b4b00, 0x06714b00, 0x06764b00,
+        0x06774b00, 0x06784b00, 0x06794b00, 0x067a4b00, 0x01004b46, 0x01004b47,
+        0x01004b49, 0x05004b4a, 0x02304c02, 0x02304c09, 0x02304c17, 0x06304c28,
+        0x02314c02, 0x02314c09, 0x02314c17, 0x06314c28, 0x02324c02, 0x02324c09,
+        0x02324c17, 0x06324c28, 0x02614c02, 0x02614c09, 0x02614c17, 0x06614c28,
+        0x02634c02, 0x02634c09, 0x02634c17, 0x06634c28, 0x02654c02, 0x02654c09,
+        0x02654c17, 0x06654c28, 0x02694c02, 0x02694c09, 0x02694c17, 0x06694c28,
+        0x026f4c02, 0x026f4c09, 0x026f4c17, 0x066f4c28, 0x02734c02, 0x02734c09,
+        0x02734c17, 0x06734c28, 0x02744c02, 0x02744c09, 0x02744c17, 0x06744c28,
+        0x02204c01, 0x06204c16, 0x02254c01, 0x06254c16, 0x022d4c01, 0x062d4c16,
+        0x022e4c01, 0x062e4c16, 0x022f4c01, 0x062f4c16, 0x02334c01, 0x06334c16,
+        0x02344c01, 0x06344c16, 0x02354c01, 0x06354c16, 0x02364c01, 0x06364c16,
+        0x02374c01, 0x06374c16, 0x02384c01, 0x06384c16, 0x02394c01, 0x06394c16,
+        0x023d4c01, 0x063d4c16, 0x02414c01, 0x06414c16, 0x025f4c01, 0x065f4c16,
+        0x02624c01, 0x06624c16, 0x02644c01, 0x06644c16, 0x02664c01, 0x06664c16,
+        0x02674c01, 0x06674c16, 0x02684c01, 0x06684c16, 0x026c4c01, 0x066c4c16,
+        0x026d4c01, 0x066d4c16, 0x026e4c01, 0x066e4c16, 0x02704c01, 0x06704c16,
+        0x02724c01, 0x06724c16, 0x02754c01, 0x06754c16, 0x063a4c00, 0x06424c00,
+        0x06434c00, 0x06444c00, 0x06454c00, 0x06464c00, 0x06474c00, 0x06484c00,
+        0x06494c00, 0x064a4c00, 0x064b4c00, 0x064c4c00, 0x064d4c00, 0x064e4c00,
+        0x064f4c00, 0x06504c00, 0x06514c00, 0x06524c00, 0x06534c00, 0x06544c00,
+        0x06554c00, 0x06564c00, 0x06574c00, 0x06594c00, 0x066a4c00, 0x066b4c00,
+        0x06714c00, 0x06764c00, 0x06774c00, 0x06784c00, 0x06794c00, 0x067a4c00,
+        0x01004c46, 0x01004c47, 0x01004c49, 0x05004c4a
+    },
+    /* 49 */
+    {
+        0x06304d00, 0x06314d00, 0x06324d00, 0x06614d00, 0x06634d00, 0x06654d00,
+        0x06694d00, 0x066f4d00, 0x06734d00, 0x06744d00, 0x01004d0d, 0x01004d0e,
+        0x01004d11, 0x01004d12, 0x01004d14, 0x01004d15, 0x01004d1a, 0x01004d1b,
+        0x01004d1d, 0x01004d1e, 0x01004d21, 0x01004d22, 0x01004d24, 0x01004d25,
+        0x01004d2b, 0x01004d2e, 0x01004d32, 0x01004d35, 0x01004d3a, 0x01004d3d,
+        0x01004d41, 0x05004d44, 0x06304e00, 0x06314e00, 0x06324e00, 0x06614e00,
+        0x06634e00, 0x06654e00, 0x06694e00, 0x066f4e00, 0x06734e00, 0x06744e00,
+        0x01004e0d, 0x01004e0e, 0x01004e11, 0x01004e12, 0x01004e14, 0x01004e15,
+        0x01004e1a, 0x01004e1b, 0x01004e1d, 0x01004e1e, 0x01004e21, 0x01004e22,
+        0x01004e24, 0x01004e25, 0x01004e2b, 0x01004e2e, 0x01004e32, 0x01004e35,
+        0x01004e3a, 0x01004e3d, 0x01004e41, 0x05004e44, 0x06304f00, 0x06314f00,
+        0x06324f00, 0x06614f00, 0x06634f00, 0x06654f00, 0x06694f00, 0x066f4f00,
+        0x06734f00, 0x06744f00, 0x01004f0d, 0x01004f0e, 0x01004f11, 0x01004f12,
+        0x01004f14, 0x01004f15, 0x01004f1a, 0x01004f1b, 0x01004f1d, 0x01004f1e,
+        0x01004f21, 0x01004f22, 0x01004f24, 0x01004f25, 0x01004f2b, 0x01004f2e,
+        0x01004f32, 0x01004f35, 0x01004f3a, 0x01004f3d, 0x01004f41, 0x05004f44,
+        0x06305000, 0x06315000, 0x06325000, 0x06615000, 0x06635000, 0x06655000,
+        0x06695000, 0x066f5000, 0x06735000, 0x06745000, 0x0100500d, 0x0100500e,
+        0x01005011, 0x01005012, 0x01005014, 0x01005015, 0x0100501a, 0x0100501b,
+        0x0100501d, 0x0100501e, 0x01005021, 0x01005022, 0x01005024, 0x01005025,
+        0x0100502b, 0x0100502e, 0x01005032, 0x01005035, 0x0100503a, 0x0100503d,
+        0x01005041, 0x05005044, 0x06305100, 0x06315100, 0x06325100, 0x06615100,
+        0x06635100, 0x06655100, 0x06695100, 0x066f5100, 0x06735100, 0x06745100,
+        0x0100510d, 0x0100510e, 0x01005111, 0x01005112, 0x01005114, 0x01005115,
+        0x0100511a, 0x0100511b, 0x0100511d, 0x0100511e, 0x01005121, 0x01005122,
+        0x01005124, 0x01005125, 0x0100512b, 0x0100512e, 0x01005132, 0x01005135,
+        0x0100513a, 0x0100513d, 0x01005141, 0x05005144, 0x06305200, 0x06315200,
+        0x06325200, 0x06615200, 0x06635200, 0x06655200, 0x06695200, 0x066f5200,
+        0x06735200, 0x06745200, 0x0100520d, 0x0100520e, 0x01005211, 0x01005212,
+        0x01005214, 0x01005215, 0x0100521a, 0x0100521b, 0x0100521d, 0x0100521e,
+        0x01005221, 0x01005222, 0x01005224, 0x01005225, 0x0100522b, 0x0100522e,
+        0x01005232, 0x01005235, 0x0100523a, 0x0100523d, 0x01005241, 0x05005244,
+        0x06305300, 0x06315300, 0x06325300, 0x06615300, 0x06635300, 0x06655300,
+        0x06695300, 0x066f5300, 0x06735300, 0x06745300, 0x0100530d, 0x0100530e,
+        0x01005311, 0x01005312, 0x01005314, 0x01005315, 0x0100531a, 0x0100531b,
+        0x0100531d, 0x0100531e, 0x01005321, 0x01005322, 0x01005324, 0x01005325,
+        0x0100532b, 0x0100532e, 0x01005332, 0x01005335, 0x0100533a, 0x0100533d,
+        0x01005341, 0x05005344, 0x06305400, 0x06315400, 0x06325400, 0x06615400,
+        0x06635400, 0x06655400, 0x06695400, 0x066f5400, 0x06735400, 0x06745400,
+        0x0100540d, 0x0100540e, 0x01005411, 0x01005412, 0x01005414, 0x01005415,
+        0x0100541a, 0x0100541b, 0x0100541d, 0x0100541e, 0x01005421, 0x01005422,
+        0x01005424, 0x01005425, 0x0100542b, 0x0100542e, 0x01005432, 0x01005435,
+        0x0100543a, 0x0100543d, 0x01005441, 0x05005444
+    },
+    /* 50 */
+    {
+        0x02304d01, 0x06304d16, 0x02314d01, 0x06314d16, 0x02324d01, 0x06324d16,
+        0x02614d01, 0x06614d16, 0x02634d01, 0x06634d16, 0x02654d01, 0x06654d16,
+        0x02694d01, 0x06694d16, 0x026f4d01, 0x066f4d16, 0x02734d01, 0x06734d16,
+        0x02744d01, 0x06744d16, 0x06204d00, 0x06254d00, 0x062d4d00, 0x062e4d00,
+        0x062f4d00, 0x06334d00, 0x06344d00, 0x06354d00, 0x06364d00, 0x06374d00,
+        0x06384d00, 0x06394d00, 0x063d4d00, 0x06414d00, 0x065f4d00, 0x06624d00,
+        0x06644d00, 0x06664d00, 0x06674d00, 0x06684d00, 0x066c4d00, 0x066d4d00,
+        0x066e4d00, 0x06704d00, 0x06724d00, 0x06754d00, 0x01004d26, 0x01004d27,
+        0x01004d2c, 0x01004d2d, 0x01004d2f, 0x01004d30, 0x01004d33, 0x01004d34,
+        0x01004d36, 0x01004d37, 0x01004d3b, 0x01004d3c, 0x01004d3e, 0x01004d3f,
+        0x01004d42, 0x01004d43, 0x01004d45, 0x05004d48, 0x02304e01, 0x06304e16,
+        0x02314e01, 0x06314e16, 0x02324e01, 0x06324e16, 0x02614e01, 0x06614e16,
+        0x02634e01, 0x06634e16, 0x02654e01, 0x06654e16, 0x02694e01, 0x06694e16,
+        0x026f4e01, 0x066f4e16, 0x02734e01, 0x06734e16, 0x02744e01, 0x06744e16,
+        0x06204e00, 0x06254e00, 0x062d4e00, 0x062e4e00, 0x062f4e00, 0x06334e00,
+        0x06344e00, 0x06354e00, 0x06364e00, 0x06374e00, 0x06384e00, 0x06394e00,
+        0x063d4e00, 0x06414e00, 0x065f4e00, 0x06624e00, 0x06644e00, 0x06664e00,
+        0x06674e00, 0x06684e00, 0x066c4e00, 0x066d4e00, 0x066e4e00, 0x06704e00,
+        0x06724e00, 0x06754e00, 0x01004e26, 0x01004e27, 0x01004e2c, 0x01004e2d,
+        0x01004e2f, 0x01004e30, 0x01004e33, 0x01004e34, 0x01004e36, 0x01004e37,
+        0x01004e3b, 0x01004e3c, 0x01004e3e, 0x01004e3f, 0x01004e42, 0x01004e43,
+        0x01004e45, 0x05004e48, 0x02304f01, 0x06304f16, 0x02314f01, 0x06314f16,
+        0x02324f01, 0x06324f16, 0x02614f01, 0x06614f16, 0x02634f01, 0x06634f16,
+        0x02654f01, 0x06654f16, 0x02694f01, 0x06694f16, 0x026f4f01, 0x066f4f16,
+        0x02734f01, 0x06734f16, 0x02744f01, 0x06744f16, 0x06204f00, 0x06254f00,
+        0x062d4f00, 0x062e4f00, 0x062f4f00, 0x06334f00, 0x06344f00, 0x06354f00,
+        0x06364f00, 0x06374f00, 0x06384f00, 0x06394f00, 0x063d4f00, 0x06414f00,
+        0x065f4f00, 0x06624f00, 0x06644f00, 0x06664f00, 0x06674f00, 0x06684f00,
+        0x066c4f00, 0x066d4f00, 0x066e4f00, 0x06704f00, 0x06724f00, 0x06754f00,
+        0x01004f26, 0x01004f27, 0x01004f2c, 0x01004f2d, 0x01004f2f, 0x01004f30,
+        0x01004f33, 0x01004f34, 0x01004f36, 0x01004f37, 0x01004f3b, 0x01004f3c,
+        0x01004f3e, 0x01004f3f, 0x01004f42, 0x01004f43, 0x01004f45, 0x05004f48,
+        0x02305001, 0x06305016, 0x02315001, 0x06315016, 0x02325001, 0x06325016,
+        0x02615001, 0x06615016, 0x02635001, 0x06635016, 0x02655001, 0x06655016,
+        0x02695001, 0x06695016, 0x026f5001, 0x066f5016, 0x02735001, 0x06735016,
+        0x02745001, 0x06745016, 0x06205000, 0x06255000, 0x062d5000, 0x062e5000,
+        0x062f5000, 0x06335000, 0x06345000, 0x06355000, 0x06365000, 0x06375000,
+        0x06385000, 0x06395000, 0x063d5000, 0x06415000, 0x065f5000, 0x06625000,
+        0x06645000, 0x06665000, 0x06675000, 0x06685000, 0x066c5000, 0x066d5000,
+        0x066e5000, 0x06705000, 0x06725000, 0x06755000, 0x01005026, 0x01005027,
+        0x0100502c, 0x0100502d, 0x0100502f, 0x01005030, 0x01005033, 0x01005034,
+        0x01005036, 0x01005037, 0x0100503b, 0x0100503c, 0x0100503e, 0x0100503f,
+        0x01005042, 0x01005043, 0x01005045, 0x05005048
+    },
+    /* 51 */
+    {
+        0x02304d02, 0x02304d09, 0x02304d17, 0x06304d28, 0x02314d02, 0x02314d09,
+        0x02314d17, 0x06314d28, 0x02324d02, 0x02324d09, 0x02324d17, 0x06324d28,
+        0x02614d02, 0x02614d09, 0x02614d17, 0x06614d28, 0x02634d02, 0x02634d09,
+        0x02634d17, 0x06634d28, 0x02654d02, 0x02654d09, 0x02654d17, 0x06654d28,
+        0x02694d02, 0x02694d09, 0x02694d17, 0x06694d28, 0x026f4d02, 0x026f4d09,
+        0x026f4d17, 0x066f4d28, 0x02734d02, 0x02734d09, 0x02734d17, 0x06734d28,
+        0x02744d02, 0x02744d09, 0x02744d17, 0x06744d28, 0x02204d01, 0x06204d16,
+        0x02254d01, 0x06254d16, 0x022d4d01, 0x062d4d16, 0x022e4d01, 0x062e4d16,
+        0x022f4d01, 0x062f4d16, 0x02334d01, 0x06334d16, 0x02344d01, 0x06344d16,
+        0x02354d01, 0x06354d16, 0x02364d01, 0x06364d16, 0x02374d01, 0x06374d16,
+        0x02384d01, 0x06384d16, 0x02394d01, 0x06394d16, 0x023d4d01, 0x063d4d16,
+        0x02414d01, 0x06414d16, 0x025f4d01, 0x065f4d16, 0x02624d01, 0x06624d16,
+        0x02644d01, 0x06644d16, 0x02664d01, 0x06664d16, 0x02674d01, 0x06674d16,
+        0x02684d01, 0x06684d16, 0x026c4d01, 0x066c4d16, 0x026d4d01, 0x066d4d16,
+        0x026e4d01, 0x066e4d16, 0x02704d01, 0x06704d16, 0x02724d01, 0x06724d16,
+        0x02754d01, 0x06754d16, 0x063a4d00, 0x06424d00, 0x06434d00, 0x06444d00,
+        0x06454d00, 0x06464d00, 0x06474d00, 0x06484d00, 0x06494d00, 0x064a4d00,
+        0x064b4d00, 0x064c4d00, 0x064d4d00, 0x064e4d00, 0x064f4d00, 0x06504d00,
+        0x06514d00, 0x06524d00, 0x06534d00, 0x06544d00, 0x06554d00, 0x06564d00,
+        0x06574d00, 0x06594d00, 0x066a4d00, 0x066b4d00, 0x06714d00, 0x06764d00,
+        0x06774d00, 0x06784d00, 0x06794d00, 0x067a4d00, 0x01004d46, 0x01004d47,
+        0x01004d49, 0x05004d4a, 0x02304e02, 0x02304e09, 0x02304e17, 0x06304e28,
+        0x02314e02, 0x02314e09, 0x02314e17, 0x06314e28, 0x02324e02, 0x02324e09,
+        0x02324e17, 0x06324e28, 0x02614e02, 0x02614e09, 0x02614e17, 0x06614e28,
+        0x02634e02, 0x02634e09, 0x02634e17, 0x06634e28, 0x02654e02, 0x02654e09,
+        0x02654e17, 0x06654e28, 0x02694e02, 0x02694e09, 0x02694e17, 0x06694e28,
+        0x026f4e02, 0x026f4e09, 0x026f4e17, 0x066f4e28, 0x02734e02, 0x02734e09,
+        0x02734e17, 0x06734e28, 0x02744e02, 0x02744e09, 0x02744e17, 0x06744e28,
+        0x02204e01, 0x06204e16, 0x02254e01, 0x06254e16, 0x022d4e01, 0x062d4e16,
+        0x022e4e01, 0x062e4e16, 0x022f4e01, 0x062f4e16, 0x02334e01, 0x06334e16,
+        0x02344e01, 0x06344e16, 0x02354e01, 0x06354e16, 0x02364e01, 0x06364e16,
+        0x02374e01, 0x06374e16, 0x02384e01, 0x06384e16, 0x02394e01, 0x06394e16,
+        0x023d4e01, 0x063d4e16, 0x02414e01, 0x06414e16, 0x025f4e01, 0x065f4e16,
+        0x02624e01, 0x06624e16, 0x02644e01, 0x06644e16, 0x02664e01, 0x06664e16,
+        0x02674e01, 0x06674e16, 0x02684e01, 0x06684e16, 0x026c4e01, 0x066c4e16,
+        0x026d4e01, 0x066d4e16, 0x026e4e01, 0x066e4e16, 0x02704e01, 0x06704e16,
+        0x02724e01, 0x06724e16, 0x02754e01, 0x06754e16, 0x063a4e00, 0x06424e00,
+        0x06434e00, 0x06444e00, 0x06454e00, 0x06464e00, 0x06474e00, 0x06484e00,
+        0x06494e00, 0x064a4e00, 0x064b4e00, 0x064c4e00, 0x064d4e00, 0x064e4e00,
+        0x064f4e00, 0x06504e00, 0x06514e00, 0x06524e00, 0x06534e00, 0x06544e00,
+        0x06554e00, 0x06564e00, 0x06574e00, 0x06594e00, 0x066a4e00, 0x066b4e00,
+        0x06714e00, 0x06764e00, 0x06774e00, 0x06784e00, 0x06794e00, 0x067a4e00,
+        0x01004e46, 0x01004e47, 0x01004e49, 0x05004e4a
+    },
+    /* 52 */
+    {
+        0x02304f02, 0x02304f09, 0x02304f17, 0x06304f28, 0x02314f02, 0x02314f09,
+        0x02314f17, 0x06314f28, 0x02324f02, 0x02324f09, 0x02324f17, 0x06324f28,
+        0x02614f02, 0x02614f09, 0x02614f17, 0x06614f28, 0x02634f02, 0x02634f09,
+        0x02634f17, 0x06634f28, 0x02654f02, 0x02654f09, 0x02654f17, 0x06654f28,
+        0x02694f02, 0x02694f09, 0x02694f17, 0x06694f28, 0x026f4f02, 0x026f4f09,
+        0x026f4f17, 0x066f4f28, 0x02734f02, 0x02734f09, 0x02734f17, 0x06734f28,
+        0x02744f02, 0x02744f09, 0x02744f17, 0x06744f28, 0x02204f01, 0x06204f16,
+        0x02254f01, 0x06254f16, 0x022d4f01, 0x062d4f16, 0x022e4f01, 0x062e4f16,
+        0x022f4f01, 0x062f4f16, 0x02334f01, 0x06334f16, 0x02344f01, 0x06344f16,
+        0x02354f01, 0x06354f16, 0x02364f01, 0x06364f16, 0x02374f01, 0x06374f16,
+        0x02384f01, 0x06384f16, 0x02394f01, 0x06394f16, 0x023d4f01, 0x063d4f16,
+        0x02414f01, 0x06414f16, 0x025f4f01, 0x065f4f16, 0x02624f01, 0x06624f16,
+        0x02644f01, 0x06644f16, 0x02664f01, 0x06664f16, 0x02674f01, 0x06674f16,
+        0x02684f01, 0x06684f16, 0x026c4f01, 0x066c4f16, 0x026d4f01, 0x066d4f16,
+        0x026e4f01, 0x066e4f16, 0x02704f01, 0x06704f16, 0x02724f01, 0x06724f16,
+        0x02754f01, 0x06754f16, 0x063a4f00, 0x06424f00, 0x06434f00, 0x06444f00,
+        0x06454f00, 0x06464f00, 0x06474f00, 0x06484f00, 0x06494f00, 0x064a4f00,
+        0x064b4f00, 0x064c4f00, 0x064d4f00, 0x064e4f00, 0x064f4f00, 0x06504f00,
+        0x06514f00, 0x06524f00, 0x06534f00, 0x06544f00, 0x06554f00, 0x06564f00,
+        0x06574f00, 0x06594f00, 0x066a4f00, 0x066b4f00, 0x06714f00, 0x06764f00,
+        0x06774f00, 0x06784f00, 0x06794f00, 0x067a4f00, 0x01004f46, 0x01004f47,
+        0x01004f49, 0x05004f4a, 0x02305002, 0x02305009, 0x02305017, 0x06305028,
+        0x02315002, 0x02315009, 0x02315017, 0x06315028, 0x02325002, 0x02325009,
+        0x02325017, 0x06325028, 0x02615002, 0x02615009, 0x02615017, 0x06615028,
+        0x02635002, 0x02635009, 0x02635017, 0x06635028, 0x02655002, 0x02655009,
+        0x02655017, 0x06655028, 0x02695002, 0x02695009, 0x02695017, 0x06695028,
+        0x026f5002, 0x026f5009, 0x026f5017, 0x066f5028, 0x02735002, 0x02735009,
+        0x02735017, 0x06735028, 0x02745002, 0x02745009, 0x02745017, 0x06745028,
+        0x02205001, 0x06205016, 0x02255001, 0x06255016, 0x022d5001, 0x062d5016,
+        0x022e5001, 0x062e5016, 0x022f5001, 0x062f5016, 0x02335001, 0x06335016,
+        0x02345001, 0x06345016, 0x02355001, 0x06355016, 0x02365001, 0x06365016,
+        0x02375001, 0x06375016, 0x02385001, 0x06385016, 0x02395001, 0x06395016,
+        0x023d5001, 0x063d5016, 0x02415001, 0x06415016, 0x025f5001, 0x065f5016,
+        0x02625001, 0x06625016, 0x02645001, 0x06645016, 0x02665001, 0x06665016,
+        0x02675001, 0x06675016, 0x02685001, 0x06685016, 0x026c5001, 0x066c5016,
+        0x026d5001, 0x066d5016, 0x026e5001, 0x066e5016, 0x02705001, 0x06705016,
+        0x02725001, 0x06725016, 0x02755001, 0x06755016, 0x063a5000, 0x06425000,
+        0x06435000, 0x06445000, 0x06455000, 0x06465000, 0x06475000, 0x06485000,
+        0x06495000, 0x064a5000, 0x064b5000, 0x064c5000, 0x064d5000, 0x064e5000,
+        0x064f5000, 0x06505000, 0x06515000, 0x06525000, 0x06535000, 0x06545000,
+        0x06555000, 0x06565000, 0x06575000, 0x06595000, 0x066a5000, 0x066b5000,
+        0x06715000, 0x06765000, 0x06775000, 0x06785000, 0x06795000, 0x067a5000,
+        0x01005046, 0x01005047, 0x01005049, 0x0500504a
+    },
+    /* 53 */
+    {
+        0x02305101, 0x06305116, 0x02315101, 0x06315116, 0x02325101, 0x06325116,
+        0x02615101, 0x06615116, 0x02635101, 0x06635116, 0x02655101, 0x06655116,
+        0x02695101, 0x06695116, 0x026f5101, 0x066f5116, 0x02735101, 0x06735116,
+        0x02745101, 0x06745116, 0x06205100, 0x06255100, 0x062d5100, 0x062e5100,
+        0x062f5100, 0x06335100, 0x06345100, 0x06355100, 0x06365100, 0x06375100,
+        0x06385100, 0x06395100, 0x063d5100, 0x06415100, 0x065f5100, 0x06625100,
+        0x06645100, 0x06665100, 0x06675100, 0x06685100, 0x066c5100, 0x066d5100,
+        0x066e5100, 0x06705100, 0x06725100, 0x06755100, 0x01005126, 0x01005127,
+        0x0100512c, 0x0100512d, 0x0100512f, 0x01005130, 0x01005133, 0x01005134,
+        0x01005136, 0x01005137, 0x0100513b, 0x0100513c, 0x0100513e, 0x0100513f,
+        0x01005142, 0x01005143, 0x01005145, 0x05005148, 0x02305201, 0x06305216,
+        0x02315201, 0x06315216, 0x02325201, 0x06325216, 0x02615201, 0x06615216,
+        0x02635201, 0x06635216, 0x02655201, 0x06655216, 0x02695201, 0x06695216,
+        0x026f5201, 0x066f5216, 0x02735201, 0x06735216, 0x02745201, 0x06745216,
+        0x06205200, 0x06255200, 0x062d5200, 0x062e5200, 0x062f5200, 0x06335200,
+        0x06345200, 0x06355200, 0x06365200, 0x06375200, 0x06385200, 0x06395200,
+        0x063d5200, 0x06415200, 0x065f5200, 0x06625200, 0x06645200, 0x06665200,
+        0x06675200, 0x06685200, 0x066c5200, 0x066d5200, 0x066e5200, 0x06705200,
+        0x06725200, 0x06755200, 0x01005226, 0x01005227, 0x0100522c, 0x0100522d,
+        0x0100522f, 0x01005230, 0x01005233, 0x01005234, 0x01005236, 0x01005237,
+        0x0100523b, 0x0100523c, 0x0100523e, 0x0100523f, 0x01005242, 0x01005243,
+        0x01005245, 0x05005248, 0x02305301, 0x06305316, 0x02315301, 0x06315316,
+        0x02325301, 0x06325316, 0x02615301, 0x06615316, 0x02635301, 0x06635316,
+        0x02655301, 0x06655316, 0x02695301, 0x06695316, 0x026f5301, 0x066f5316,
+        0x02735301, 0x06735316, 0x02745301, 0x06745316, 0x06205300, 0x06255300,
+        0x062d5300, 0x062e5300, 0x062f5300, 0x06335300, 0x06345300, 0x06355300,
+        0x06365300, 0x06375300, 0x06385300, 0x06395300, 0x063d5300, 0x06415300,
+        0x065f5300, 0x06625300, 0x06645300, 0x06665300, 0x06675300, 0x06685300,
+        0x066c5300, 0x066d5300, 0x066e5300, 0x06705300, 0x06725300, 0x06755300,
+        0x01005326, 0x01005327, 0x0100532c, 0x0100532d, 0x0100532f, 0x01005330,
+        0x01005333, 0x01005334, 0x01005336, 0x01005337, 0x0100533b, 0x0100533c,
+        0x0100533e, 0x0100533f, 0x01005342, 0x01005343, 0x01005345, 0x05005348,
+        0x02305401, 0x06305416, 0x02315401, 0x06315416, 0x02325401, 0x06325416,
+        0x02615401, 0x06615416, 0x02635401, 0x06635416, 0x02655401, 0x06655416,
+        0x02695401, 0x06695416, 0x026f5401, 0x066f5416, 0x02735401, 0x06735416,
+        0x02745401, 0x06745416, 0x06205400, 0x06255400, 0x062d5400, 0x062e5400,
+        0x062f5400, 0x06335400, 0x06345400, 0x06355400, 0x06365400, 0x06375400,
+        0x06385400, 0x06395400, 0x063d5400, 0x06415400, 0x065f5400, 0x06625400,
+        0x06645400, 0x06665400, 0x06675400, 0x06685400, 0x066c5400, 0x066d5400,
+        0x066e5400, 0x06705400, 0x06725400, 0x06755400, 0x01005426, 0x01005427,
+        0x0100542c, 0x0100542d, 0x0100542f, 0x01005430, 0x01005433, 0x01005434,
+        0x01005436, 0x01005437, 0x0100543b, 0x0100543c, 0x0100543e, 0x0100543f,
+        0x01005442, 0x01005443, 0x01005445, 0x05005448
+    },
+    /* 54 */
+    {
+        0x02305102, 0x02305109, 0x02305117, 0x06305128, 0x02315102, 0x02315109,
+        0x02315117, 0x06315128, 0x02325102, 0x02325109, 0x02325117, 0x06325128,
+        0x02615102, 0x02615109, 0x02615117, 0x06615128, 0x02635102, 0x02635109,
+        0x02635117, 0x06635128, 0x02655102, 0x02655109, 0x02655117, 0x06655128,
+        0x02695102, 0x02695109, 0x02695117, 0x06695128, 0x026f5102, 0x026f5109,
+        0x026f5117, 0x066f5128, 0x02735102, 0x02735109, 0x02735117, 0x06735128,
+        0x02745102, 0x02745109, 0x02745117, 0x06745128, 0x02205101, 0x06205116,
+        0x02255101, 0x06255116, 0x022d5101, 0x062d5116, 0x022e5101, 0x062e5116,
+        0x022f5101, 0x062f5116, 0x02335101, 0x06335116, 0x02345101, 0x06345116,
+        0x02355101, 0x06355116, 0x02365101, 0x06365116, 0x02375101, 0x06375116,
+        0x02385101, 0x06385116, 0x02395101, 0x06395116, 0x023d5101, 0x063d5116,
+        0x02415101, 0x06415116, 0x025f5101, 0x065f5116, 0x02625101, 0x06625116,
+        0x02645101, 0x06645116, 0x02665101, 0x06665116, 0x02675101, 0x06675116,
+        0x02685101, 0x06685116, 0x026c5101, 0x066c5116, 0x026d5101, 0x066d5116,
+        0x026e5101, 0x066e5116, 0x02705101, 0x06705116, 0x02725101, 0x06725116,
+        0x02755101, 0x06755116, 0x063a5100, 0x06425100, 0x06435100, 0x06445100,
+        0x06455100, 0x06465100, 0x06475100, 0x06485100, 0x06495100, 0x064a5100,
+        0x064b5100, 0x064c5100, 0x064d5100, 0x064e5100, 0x064f5100, 0x06505100,
+        0x06515100, 0x06525100, 0x06535100, 0x06545100, 0x06555100, 0x06565100,
+        0x06575100, 0x06595100, 0x066a5100, 0x066b5100, 0x06715100, 0x06765100,
+        0x06775100, 0x06785100, 0x06795100, 0x067a5100, 0x01005146, 0x01005147,
+        0x01005149, 0x0500514a, 0x02305202, 0x02305209, 0x02305217, 0x06305228,
+        0x02315202, 0x02315209, 0x02315217, 0x06315228, 0x02325202, 0x02325209,
+        0x02325217, 0x06325228, 0x02615202, 0x02615209, 0x02615217, 0x06615228,
+        0x02635202, 0x02635209, 0x02635217, 0x06635228, 0x02655202, 0x02655209,
+        0x02655217, 0x06655228, 0x02695202, 0x02695209, 0x02695217, 0x06695228,
+        0x026f5202, 0x026f5209, 0x026f5217, 0x066f5228, 0x02735202, 0x02735209,
+        0x02735217, 0x06735228, 0x02745202, 0x02745209, 0x02745217, 0x06745228,
+        0x02205201, 0x06205216, 0x02255201, 0x06255216, 0x022d5201, 0x062d5216,
+        0x022e5201, 0x062e5216, 0x022f5201, 0x062f5216, 0x02335201, 0x06335216,
+        0x02345201, 0x06345216, 0x02355201, 0x06355216, 0x02365201, 0x06365216,
+        0x02375201, 0x06375216, 0x02385201, 0x06385216, 0x02395201, 0x06395216,
+        0x023d5201, 0x063d5216, 0x02415201, 0x06415216, 0x025f5201, 0x065f5216,
+        0x02625201, 0x06625216, 0x02645201, 0x06645216, 0x02665201, 0x06665216,
+        0x02675201, 0x06675216, 0x02685201, 0x06685216, 0x026c5201, 0x066c5216,
+        0x026d5201, 0x066d5216, 0x026e5201, 0x066e5216, 0x02705201, 0x06705216,
+        0x02725201, 0x06725216, 0x02755201, 0x06755216, 0x063a5200, 0x06425200,
+        0x06435200, 0x06445200, 0x06455200, 0x06465200, 0x06475200, 0x06485200,
+        0x06495200, 0x064a5200, 0x064b5200, 0x064c5200, 0x064d5200, 0x064e5200,
+        0x064f5200, 0x06505200, 0x06515200, 0x06525200, 0x06535200, 0x06545200,
+        0x06555200, 0x06565200, 0x06575200, 0x06595200, 0x066a5200, 0x066b5200,
+        0x06715200, 0x06765200, 0x06775200, 0x06785200, 0x06795200, 0x067a5200,
+        0x01005246, 0x01005247, 0x01005249, 0x0500524a
+    },
+    /* 55 */
+    {
+        0x02305302, 0x02305309, 0x02305317, 0x06305328, 0x02315302, 0x02315309,
+        0x02315317, 0x06315328, 0x02325302, 0x02325309, 0x02325317, 0x06325328,
+        0x02615302, 0x02615309, 0x02615317, 0x06615328, 0x02635302, 0x02635309,
+        0x02635317, 0x06635328, 0x02655302, 0x02655309, 0x02655317, 0x06655328,
+        0x02695302, 0x02695309, 0x02695317, 0x06695328, 0x026f5302, 0x026f5309,
+        0x026f5317, 0x066f5328, 0x02735302, 0x02735309, 0x02735317, 0x06735328,
+        0x02745302, 0x02745309, 0x02745317, 0x06745328, 0x02205301, 0x06205316,
+        0x02255301, 0x06255316, 0x022d5301, 0x062d5316, 0x022e5301, 0x062e5316,
+        0x022f5301, 0x062f5316, 0x02335301, 0x06335316, 0x02345301, 0x06345316,
+        0x02355301, 0x06355316, 0x02365301, 0x06365316, 0x02375301, 0x06375316,
+        0x02385301, 0x06385316, 0x02395301, 0x06395316, 0x023d5301, 0x063d5316,
+        0x02415301, 0x06415316, 0x025f5301, 0x065f5316, 0x02625301, 0x06625316,
+        0x02645301, 0x06645316, 0x02665301, 0x06665316, 0x02675301, 0x06675316,
+        0x02685301, 0x06685316, 0x026c5301, 0x066c5316, 0x026d5301, 0x066d5316,
+        0x026e5301, 0x066e5316, 0x02705301, 0x06705316, 0x02725301, 0x06725316,
+        0x02755301, 0x06755316, 0x063a5300, 0x06425300, 0x06435300, 0x06445300,
+        0x06455300, 0x06465300, 0x06475300, 0x06485300, 0x06495300, 0x064a5300,
+        0x064b5300, 0x064c5300, 0x064d5300, 0x064e5300, 0x064f5300, 0x06505300,
+        0x06515300, 0x06525300, 0x06535300, 0x06545300, 0x06555300, 0x06565300,
+        0x06575300, 0x06595300, 0x066a5300, 0x066b5300, 0x06715300, 0x06765300,
+        0x06775300, 0x06785300, 0x06795300, 0x067a5300, 0x01005346, 0x01005347,
+        0x01005349, 0x0500534a, 0x02305402, 0x02305409, 0x02305417, 0x06305428,
+        0x02315402, 0x02315409, 0x02315417, 0x06315428, 0x02325402, 0x02325409,
+        0x02325417, 0x06325428, 0x02615402, 0x02615409, 0x02615417, 0x06615428,
+        0x02635402, 0x02635409, 0x02635417, 0x06635428, 0x02655402, 0x02655409,
+        0x02655417, 0x06655428, 0x02695402, 0x02695409, 0x02695417, 0x06695428,
+        0x026f5402, 0x026f5409, 0x026f5417, 0x066f5428, 0x02735402, 0x02735409,
+        0x02735417, 0x06735428, 0x02745402, 0x02745409, 0x02745417, 0x06745428,
+        0x02205401, 0x06205416, 0x02255401, 0x06255416, 0x022d5401, 0x062d5416,
+        0x022e5401, 0x062e5416, 0x022f5401, 0x062f5416, 0x02335401, 0x06335416,
+        0x02345401, 0x06345416, 0x02355401, 0x06355416, 0x02365401, 0x06365416,
+        0x02375401, 0x06375416, 0x02385401, 0x06385416, 0x02395401, 0x06395416,
+        0x023d5401, 0x063d5416, 0x02415401, 0x06415416, 0x025f5401, 0x065f5416,
+        0x02625401, 0x06625416, 0x02645401, 0x06645416, 0x02665401, 0x06665416,
+        0x02675401, 0x06675416, 0x02685401, 0x06685416, 0x026c5401, 0x066c5416,
+        0x026d5401, 0x066d5416, 0x026e5401, 0x066e5416, 0x02705401, 0x06705416,
+        0x02725401, 0x06725416, 0x02755401, 0x06755416, 0x063a5400, 0x06425400,
+        0x06435400, 0x06445400, 0x06455400, 0x06465400, 0x06475400, 0x06485400,
+        0x06495400, 0x064a5400, 0x064b5400, 0x064c5400, 0x064d5400, 0x064e5400,
+        0x064f5400, 0x06505400, 0x06515400, 0x06525400, 0x06535400, 0x06545400,
+        0x06555400, 0x06565400, 0x06575400, 0x06595400, 0x066a5400, 0x066b5400,
+        0x06715400, 0x06765400, 0x06775400, 0x06785400, 0x06795400, 0x067a5400,
+        0x01005446, 0x01005447, 0x01005449, 0x0500544a
+    },
+    /* 56 */
+    {
+        0x01005504, 0x01005505, 0x01005507, 0x01005508, 0x0100550b, 0x0100550c,
+        0x01005510, 0x01005513, 0x01005519, 0x0100551c, 0x01005520, 0x01005523,
+        0x0100552a, 0x01005531, 0x01005539, 0x05005540, 0x01005604, 0x01005605,
+        0x01005607, 0x01005608, 0x0100560b, 0x0100560c, 0x01005610, 0x01005613,
+        0x01005619, 0x0100561c, 0x01005620, 0x01005623, 0x0100562a, 0x01005631,
+        0x01005639, 0x05005640, 0x01005704, 0x01005705, 0x01005707, 0x01005708,
+        0x0100570b, 0x0100570c, 0x01005710, 0x01005713, 0x01005719, 0x0100571c,
+        0x01005720, 0x01005723, 0x0100572a, 0x01005731, 0x01005739, 0x05005740,
+        0x01005904, 0x01005905, 0x01005907, 0x01005908, 0x0100590b, 0x0100590c,
+        0x01005910, 0x01005913, 0x01005919, 0x0100591c, 0x01005920, 0x01005923,
+        0x0100592a, 0x01005931, 0x01005939, 0x05005940, 0x01006a04, 0x01006a05,
+        0x01006a07, 0x01006a08, 0x01006a0b, 0x01006a0c, 0x01006a10, 0x01006a13,
+        0x01006a19, 0x01006a1c, 0x01006a20, 0x01006a23, 0x01006a2a, 0x01006a31,
+        0x01006a39, 0x05006a40, 0x01006b04, 0x01006b05, 0x01006b07, 0x01006b08,
+        0x01006b0b, 0x01006b0c, 0x01006b10, 0x01006b13, 0x01006b19, 0x01006b1c,
+        0x01006b20, 0x01006b23, 0x01006b2a, 0x01006b31, 0x01006b39, 0x05006b40,
+        0x01007104, 0x01007105, 0x01007107, 0x01007108, 0x0100710b, 0x0100710c,
+        0x01007110, 0x01007113, 0x01007119, 0x0100711c, 0x01007120, 0x01007123,
+        0x0100712a, 0x01007131, 0x01007139, 0x05007140, 0x01007604, 0x01007605,
+        0x01007607, 0x01007608, 0x0100760b, 0x0100760c, 0x01007610, 0x01007613,
+        0x01007619, 0x0100761c, 0x01007620, 0x01007623, 0x0100762a, 0x01007631,
+        0x01007639, 0x05007640, 0x01007704, 0x01007705, 0x01007707, 0x01007708,
+        0x0100770b, 0x0100770c, 0x01007710, 0x01007713, 0x01007719, 0x0100771c,
+        0x01007720, 0x01007723, 0x0100772a, 0x01007731, 0x01007739, 0x05007740,
+        0x01007804, 0x01007805, 0x01007807, 0x01007808, 0x0100780b, 0x0100780c,
+        0x01007810, 0x01007813, 0x01007819, 0x0100781c, 0x01007820, 0x01007823,
+        0x0100782a, 0x01007831, 0x01007839, 0x05007840, 0x01007904, 0x01007905,
+        0x01007907, 0x01007908, 0x0100790b, 0x0100790c, 0x01007910, 0x01007913,
+        0x01007919, 0x0100791c, 0x01007920, 0x01007923, 0x0100792a, 0x01007931,
+        0x01007939, 0x05007940, 0x01007a04, 0x01007a05, 0x01007a07, 0x01007a08,
+        0x01007a0b, 0x01007a0c, 0x01007a10, 0x01007a13, 0x01007a19, 0x01007a1c,
+        0x01007a20, 0x01007a23, 0x01007a2a, 0x01007a31, 0x01007a39, 0x05007a40,
+        0x01002603, 0x01002606, 0x0100260a, 0x0100260f, 0x01002618, 0x0100261f,
+        0x01002629, 0x05002638, 0x01002a03, 0x01002a06, 0x01002a0a, 0x01002a0f,
+        0x01002a18, 0x01002a1f, 0x01002a29, 0x05002a38, 0x01002c03, 0x01002c06,
+        0x01002c0a, 0x01002c0f, 0x01002c18, 0x01002c1f, 0x01002c29, 0x05002c38,
+        0x01003b03, 0x01003b06, 0x01003b0a, 0x01003b0f, 0x01003b18, 0x01003b1f,
+        0x01003b29, 0x05003b38, 0x01005803, 0x01005806, 0x0100580a, 0x0100580f,
+        0x01005818, 0x0100581f, 0x01005829, 0x05005838, 0x01005a03, 0x01005a06,
+        0x01005a0a, 0x01005a0f, 0x01005a18, 0x01005a1f, 0x01005a29, 0x05005a38,
+        0x01002101, 0x05002116, 0x01002201, 0x05002216, 0x01002801, 0x05002816,
+        0x01002901, 0x05002916, 0x01003f01, 0x05003f16, 0x05002700, 0x05002b00,
+        0x05007c00, 0x00000053, 0x00000055, 0x04000058
+    },
+    /* 57 */
+    {
+        0x06305500, 0x06315500, 0x06325500, 0x06615500, 0x06635500, 0x06655500,
+        0x06695500, 0x066f5500, 0x06735500, 0x06745500, 0x0100550d, 0x0100550e,
+        0x01005511, 0x01005512, 0x01005514, 0x01005515, 0x0100551a, 0x0100551b,
+        0x0100551d, 0x0100551e, 0x01005521, 0x01005522, 0x01005524, 0x01005525,
+        0x0100552b, 0x0100552e, 0x01005532, 0x01005535, 0x0100553a, 0x0100553d,
+        0x01005541, 0x05005544, 0x06305600, 0x06315600, 0x06325600, 0x06615600,
+        0x06635600, 0x06655600, 0x06695600, 0x066f5600, 0x06735600, 0x06745600,
+        0x0100560d, 0x0100560e, 0x01005611, 0x01005612, 0x01005614, 0x01005615,
+        0x0100561a, 0x0100561b, 0x0100561d, 0x0100561e, 0x01005621, 0x01005622,
+        0x01005624, 0x01005625, 0x0100562b, 0x0100562e, 0x01005632, 0x01005635,
+        0x0100563a, 0x0100563d, 0x01005641, 0x05005644, 0x06305700, 0x06315700,
+        0x06325700, 0x06615700, 0x06635700, 0x06655700, 0x06695700, 0x066f5700,
+        0x06735700, 0x06745700, 0x0100570d, 0x0100570e, 0x01005711, 0x01005712,
+        0x01005714, 0x01005715, 0x0100571a, 0x0100571b, 0x0100571d, 0x0100571e,
+        0x01005721, 0x01005722, 0x01005724, 0x01005725, 0x0100572b, 0x0100572e,
+        0x01005732, 0x01005735, 0x0100573a, 0x0100573d, 0x01005741, 0x05005744,
+        0x06305900, 0x06315900, 0x06325900, 0x06615900, 0x06635900, 0x06655900,
+        0x06695900, 0x066f5900, 0x06735900, 0x06745900, 0x0100590d, 0x0100590e,
+        0x01005911, 0x01005912, 0x01005914, 0x01005915, 0x0100591a, 0x0100591b,
+        0x0100591d, 0x0100591e, 0x01005921, 0x01005922, 0x01005924, 0x01005925,
+        0x0100592b, 0x0100592e, 0x01005932, 0x01005935, 0x0100593a, 0x0100593d,
+        0x01005941, 0x05005944, 0x06306a00, 0x06316a00, 0x06326a00, 0x06616a00,
+        0x06636a00, 0x06656a00, 0x06696a00, 0x066f6a00, 0x06736a00, 0x06746a00,
+        0x01006a0d, 0x01006a0e, 0x01006a11, 0x01006a12, 0x01006a14, 0x01006a15,
+        0x01006a1a, 0x01006a1b, 0x01006a1d, 0x01006a1e, 0x01006a21, 0x01006a22,
+        0x01006a24, 0x01006a25, 0x01006a2b, 0x01006a2e, 0x01006a32, 0x01006a35,
+        0x01006a3a, 0x01006a3d, 0x01006a41, 0x05006a44, 0x06306b00, 0x06316b00,
+        0x06326b00, 0x06616b00, 0x06636b00, 0x06656b00, 0x06696b00, 0x066f6b00,
+        0x06736b00, 0x06746b00, 0x01006b0d, 0x01006b0e, 0x01006b11, 0x01006b12,
+        0x01006b14, 0x01006b15, 0x01006b1a, 0x01006b1b, 0x01006b1d, 0x01006b1e,
+        0x01006b21, 0x01006b22, 0x01006b24, 0x01006b25, 0x01006b2b, 0x01006b2e,
+        0x01006b32, 0x01006b35, 0x01006b3a, 0x01006b3d, 0x01006b41, 0x05006b44,
+        0x06307100, 0x06317100, 0x06327100, 0x06617100, 0x06637100, 0x06657100,
+        0x06697100, 0x066f7100, 0x06737100, 0x06747100, 0x0100710d, 0x0100710e,
+        0x01007111, 0x01007112, 0x01007114, 0x01007115, 0x0100711a, 0x0100711b,
+        0x0100711d, 0x0100711e, 0x01007121, 0x01007122, 0x01007124, 0x01007125,
+        0x0100712b, 0x0100712e, 0x01007132, 0x01007135, 0x0100713a, 0x0100713d,
+        0x01007141, 0x05007144, 0x06307600, 0x06317600, 0x06327600, 0x06617600,
+        0x06637600, 0x06657600, 0x06697600, 0x066f7600, 0x06737600, 0x06747600,
+        0x0100760d, 0x0100760e, 0x01007611, 0x01007612, 0x01007614, 0x01007615,
+        0x0100761a, 0x0100761b, 0x0100761d, 0x0100761e, 0x01007621, 0x01007622,
+        0x01007624, 0x01007625, 0x0100762b, 0x0100762e, 0x01007632, 0x01007635,
+        0x0100763a, 0x0100763d, 0x01007641, 0x05007644
+    },
+    /* 58 */
+    {
+        0x02305501, 0x06305516, 0x02315501, 0x06315516, 0x02325501, 0x06325516,
+        0x02615501, 0x06615516, 0x02635501, 0x06635516, 0x02655501, 0x06655516,
+        0x02695501, 0x06695516, 0x026f5501, 0x066f5516, 0x02735501, 0x06735516,
+        0x02745501, 0x06745516, 0x06205500, 0x06255500, 0x062d5500, 0x062e5500,
+        0x062f5500, 0x06335500, 0x06345500, 0x06355500, 0x06365500, 0x06375500,
+        0x06385500, 0x06395500, 0x063d5500, 0x06415500, 0x065f5500, 0x06625500,
+        0x06645500, 0x06665500, 0x06675500, 0x06685500, 0x066c5500, 0x066d5500,
+        0x066e5500, 0x06705500, 0x06725500, 0x06755500, 0x01005526, 0x01005527,
+        0x0100552c, 0x0100552d, 0x0100552f, 0x01005530, 0x01005533, 0x01005534,
+        0x01005536, 0x01005537, 0x0100553b, 0x0100553c, 0x0100553e, 0x0100553f,
+        0x01005542, 0x01005543, 0x01005545, 0x05005548, 0x02305601, 0x06305616,
+        0x02315601, 0x06315616, 0x02325601, 0x06325616, 0x02615601, 0x06615616,
+        0x02635601, 0x06635616, 0x02655601, 0x06655616, 0x02695601, 0x06695616,
+        0x026f5601, 0x066f5616, 0x02735601, 0x06735616, 0x02745601, 0x06745616,
+        0x06205600, 0x06255600, 0x062d5600, 0x062e5600, 0x062f5600, 0x06335600,
+        0x06345600, 0x06355600, 0x06365600, 0x06375600, 0x06385600, 0x06395600,
+        0x063d5600, 0x06415600, 0x065f5600, 0x06625600, 0x06645600, 0x06665600,
+        0x06675600, 0x06685600, 0x066c5600, 0x066d5600, 0x066e5600, 0x06705600,
+        0x06725600, 0x06755600, 0x01005626, 0x01005627, 0x0100562c, 0x0100562d,
+        0x0100562f, 0x01005630, 0x01005633, 0x01005634, 0x01005636, 0x01005637,
+        0x0100563b, 0x0100563c, 0x0100563e, 0x0100563f, 0x01005642, 0x01005643,
+        0x01005645, 0x05005648, 0x02305701, 0x06305716, 0x02315701, 0x06315716,
+        0x02325701, 0x06325716, 0x02615701, 0x06615716, 0x02635701, 0x06635716,
+        0x02655701, 0x06655716, 0x02695701, 0x06695716, 0x026f5701, 0x066f5716,
+        0x02735701, 0x06735716, 0x02745701, 0x06745716, 0x06205700, 0x06255700,
+        0x062d5700, 0x062e5700, 0x062f5700, 0x06335700, 0x06345700, 0x06355700,
+        0x06365700, 0x06375700, 0x06385700, 0x06395700, 0x063d5700, 0x06415700,
+        0x065f5700, 0x06625700, 0x06645700, 0x06665700, 0x06675700, 0x06685700,
+        0x066c5700, 0x066d5700, 0x066e5700, 0x06705700, 0x06725700, 0x06755700,
+        0x01005726, 0x01005727, 0x0100572c, 0x0100572d, 0x0100572f, 0x01005730,
+        0x01005733, 0x01005734, 0x01005736, 0x01005737, 0x0100573b, 0x0100573c,
+        0x0100573e, 0x0100573f, 0x01005742, 0x01005743, 0x01005745, 0x05005748,
+        0x02305901, 0x06305916, 0x02315901, 0x06315916, 0x02325901, 0x06325916,
+        0x02615901, 0x06615916, 0x02635901, 0x06635916, 0x02655901, 0x06655916,
+        0x02695901, 0x06695916, 0x026f5901, 0x066f5916, 0x02735901, 0x06735916,
+        0x02745901, 0x06745916, 0x06205900, 0x06255900, 0x062d5900, 0x062e5900,
+        0x062f5900, 0x06335900, 0x06345900, 0x06355900, 0x06365900, 0x06375900,
+        0x06385900, 0x06395900, 0x063d5900, 0x06415900, 0x065f5900, 0x06625900,
+        0x06645900, 0x06665900, 0x06675900, 0x06685900, 0x066c5900, 0x066d5900,
+        0x066e5900, 0x06705900, 0x06725900, 0x06755900, 0x01005926, 0x01005927,
+        0x0100592c, 0x0100592d, 0x0100592f, 0x01005930, 0x01005933, 0x01005934,
+        0x01005936, 0x01005937, 0x0100593b, 0x0100593c, 0x0100593e, 0x0100593f,
+        0x01005942, 0x01005943, 0x01005945, 0x05005948
+    },
+    /* 59 */
+    {
+        0x02305502, 0x02305509, 0x02305517, 0x06305528, 0x02315502, 0x02315509,
+        0x02315517, 0x06315528, 0x02325502, 0x02325509, 0x02325517, 0x06325528,
+        0x02615502, 0x02615509, 0x02615517, 0x06615528, 0x02635502, 0x02635509,
+        0x02635517, 0x06635528, 0x02655502, 0x02655509, 0x02655517, 0x06655528,
+        0x02695502, 0x02695509, 0x02695517, 0x06695528, 0x026f5502, 0x026f5509,
+        0x026f5517, 0x066f5528, 0x02735502, 0x02735509, 0x02735517, 0x06735528,
+        0x02745502, 0x02745509, 0x02745517, 0x06745528, 0x02205501, 0x06205516,
+        0x02255501, 0x06255516, 0x022d5501, 0x062d5516, 0x022e5501, 0x062e5516,
+        0x022f5501, 0x062f5516, 0x02335501, 0x06335516, 0x02345501, 0x06345516,
+        0x02355501, 0x06355516, 0x02365501, 0x06365516, 0x02375501, 0x06375516,
+        0x02385501, 0x06385516, 0x02395501, 0x06395516, 0x023d5501, 0x063d5516,
+        0x02415501, 0x06415516, 0x025f5501, 0x065f5516, 0x02625501, 0x06625516,
+        0x02645501, 0x06645516, 0x02665501, 0x06665516, 0x02675501, 0x06675516,
+        0x02685501, 0x06685516, 0x026c5501, 0x066c5516, 0x026d5501, 0x066d5516,
+        0x026e5501, 0x066e5516, 0x02705501, 0x06705516, 0x02725501, 0x06725516,
+        0x02755501, 0x06755516, 0x063a5500, 0x06425500, 0x06435500, 0x06445500,
+        0x06455500, 0x06465500, 0x06475500, 0x06485500, 0x06495500, 0x064a5500,
+        0x064b5500, 0x064c5500, 0x064d5500, 0x064e5500, 0x064f5500, 0x06505500,
+        0x06515500, 0x06525500, 0x06535500, 0x06545500, 0x06555500, 0x06565500,
+        0x06575500, 0x06595500, 0x066a5500, 0x066b5500, 0x06715500, 0x06765500,
+        0x06775500, 0x06785500, 0x06795500, 0x067a5500, 0x01005546, 0x01005547,
+        0x01005549, 0x0500554a, 0x02305602, 0x02305609, 0x02305617, 0x06305628,
+        0x02315602, 0x02315609, 0x02315617, 0x06315628, 0x02325602, 0x02325609,
+        0x02325617, 0x06325628, 0x02615602, 0x02615609, 0x02615617, 0x06615628,
+        0x02635602, 0x02635609, 0x02635617, 0x06635628, 0x02655602, 0x02655609,
+        0x02655617, 0x06655628, 0x02695602, 0x02695609, 0x02695617, 0x06695628,
+        0x026f5602, 0x026f5609, 0x026f5617, 0x066f5628, 0x02735602, 0x02735609,
+        0x02735617, 0x06735628, 0x02745602, 0x02745609, 0x02745617, 0x06745628,
+        0x02205601, 0x06205616, 0x02255601, 0x06255616, 0x022d5601, 0x062d5616,
+        0x022e5601, 0x062e5616, 0x022f5601, 0x062f5616, 0x02335601, 0x06335616,
+        0x02345601, 0x06345616, 0x02355601, 0x06355616, 0x02365601, 0x06365616,
+        0x02375601, 0x06375616, 0x02385601, 0x06385616, 0x02395601, 0x06395616,
+        0x023d5601, 0x063d5616, 0x02415601, 0x06415616, 0x025f5601, 0x065f5616,
+        0x02625601, 0x06625616, 0x02645601, 0x06645616, 0x02665601, 0x06665616,
+        0x02675601, 0x06675616, 0x02685601, 0x06685616, 0x026c5601, 0x066c5616,
+        0x026d5601, 0x066d5616, 0x026e5601, 0x066e5616, 0x02705601, 0x06705616,
+        0x02725601, 0x06725616, 0x02755601, 0x06755616, 0x063a5600, 0x06425600,
+        0x06435600, 0x06445600, 0x06455600, 0x06465600, 0x06475600, 0x06485600,
+        0x06495600, 0x064a5600, 0x064b5600, 0x064c5600, 0x064d5600, 0x064e5600,
+        0x064f5600, 0x06505600, 0x06515600, 0x06525600, 0x06535600, 0x06545600,
+        0x06555600, 0x06565600, 0x06575600, 0x06595600, 0x066a5600, 0x066b5600,
+        0x06715600, 0x06765600, 0x06775600, 0x06785600, 0x06795600, 0x067a5600,
+        0x01005646, 0x01005647, 0x01005649, 0x0500564a
+    },
+    /* 60 */
+    {
+        0x02305702, 0x02305709, 0x02305717, 0x06305728, 0x02315702, 0x02315709,
+        0x02315717, 0x06315728, 0x02325702, 0x02325709, 0x02325717, 0x06325728,
+        0x02615702, 0x02615709, 0x02615717, 0x06615728, 0x02635702, 0x02635709,
+        0x02635717, 0x06635728, 0x02655702, 0x02655709, 0x02655717, 0x06655728,
+        0x02695702, 0x02695709, 0x02695717, 0x06695728, 0x026f5702, 0x026f5709,
+        0x026f5717, 0x066f5728, 0x02735702, 0x02735709, 0x02735717, 0x06735728,
+        0x02745702, 0x02745709, 0x02745717, 0x06745728, 0x02205701, 0x06205716,
+        0x02255701, 0x06255716, 0x022d5701, 0x062d5716, 0x022e5701, 0x062e5716,
+        0x022f5701, 0x062f5716, 0x02335701, 0x06335716, 0x02345701, 0x06345716,
+        0x02355701, 0x06355716, 0x02365701, 0x06365716, 0x02375701, 0x06375716,
+        0x02385701, 0x06385716, 0x02395701, 0x06395716, 0x023d5701, 0x063d5716,
+        0x02415701, 0x06415716, 0x025f5701, 0x065f5716, 0x02625701, 0x06625716,
+        0x02645701, 0x06645716, 0x02665701, 0x06665716, 0x02675701, 0x06675716,
+        0x02685701, 0x06685716, 0x026c5701, 0x066c5716, 0x026d5701, 0x066d5716,
+        0x026e5701, 0x066e5716, 0x02705701, 0x06705716, 0x02725701, 0x06725716,
+        0x02755701, 0x06755716, 0x063a5700, 0x06425700, 0x06435700, 0x06445700,
+        0x06455700, 0x06465700, 0x06475700, 0x06485700, 0x06495700, 0x064a5700,
+        0x064b5700, 0x064c5700, 0x064d5700, 0x064e5700, 0x064f5700, 0x06505700,
+        0x06515700, 0x06525700, 0x06535700, 0x06545700, 0x06555700, 0x06565700,
+        0x06575700, 0x06595700, 0x066a5700, 0x066b5700, 0x06715700, 0x06765700,
+        0x06775700, 0x06785700, 0x06795700, 0x067a5700, 0x01005746, 0x01005747,
+        0x01005749, 0x0500574a, 0x02305902, 0x02305909, 0x02305917, 0x06305928,
+        0x02315902, 0x02315909, 0x02315917, 0x06315928, 0x02325902, 0x02325909,
+        0x02325917, 0x06325928, 0x02615902, 0x02615909, 0x02615917, 0x06615928,
+        0x02635902, 0x02635909, 0x02635917, 0x06635928, 0x02655902, 0x02655909,
+        0x02655917, 0x06655928, 0x02695902, 0x02695909, 0x02695917, 0x06695928,
+        0x026f5902, 0x026f5909, 0x026f5917, 0x066f5928, 0x02735902, 0x02735909,
+        0x02735917, 0x06735928, 0x02745902, 0x02745909, 0x02745917, 0x06745928,
+        0x02205901, 0x06205916, 0x02255901, 0x06255916, 0x022d5901, 0x062d5916,
+        0x022e5901, 0x062e5916, 0x022f5901, 0x062f5916, 0x02335901, 0x06335916,
+        0x02345901, 0x06345916, 0x02355901, 0x06355916, 0x02365901, 0x06365916,
+        0x02375901, 0x06375916, 0x02385901, 0x06385916, 0x02395901, 0x06395916,
+        0x023d5901, 0x063d5916, 0x02415901, 0x06415916, 0x025f5901, 0x065f5916,
+        0x02625901, 0x06625916, 0x02645901, 0x06645916, 0x02665901, 0x06665916,
+        0x02675901, 0x06675916, 0x02685901, 0x06685916, 0x026c5901, 0x066c5916,
+        0x026d5901, 0x066d5916, 0x026e5901, 0x066e5916, 0x02705901, 0x06705916,
+        0x02725901, 0x06725916, 0x02755901, 0x06755916, 0x063a5900, 0x06425900,
+        0x06435900, 0x06445900, 0x06455900, 0x06465900, 0x06475900, 0x06485900,
+        0x06495900, 0x064a5900, 0x064b5900, 0x064c5900, 0x064d5900, 0x064e5900,
+        0x064f5900, 0x06505900, 0x06515900, 0x06525900, 0x06535900, 0x06545900,
+        0x06555900, 0x06565900, 0x06575900, 0x06595900, 0x066a5900, 0x066b5900,
+        0x06715900, 0x06765900, 0x06775900, 0x06785900, 0x06795900, 0x067a5900,
+        0x01005946, 0x01005947, 0x01005949, 0x0500594a
+    },
+    /* 61 */
+    {
+        0x02306a01, 0x06306a16, 0x02316a01, 0x06316a16, 0x02326a01, 0x06326a16,
+        0x02616a01, 0x06616a16, 0x02636a01, 0x06636a16, 0x02656a01, 0x06656a16,
+        0x02696a01, 0x06696a16, 0x026f6a01, 0x066f6a16, 0x02736a01, 0x06736a16,
+        0x02746a01, 0x06746a16, 0x06206a00, 0x06256a00, 0x062d6a00, 0x062e6a00,
+        0x062f6a00, 0x06336a00, 0x06346a00, 0x06356a00, 0x06366a00, 0x06376a00,
+        0x06386a00, 0x06396a00, 0x063d6a00, 0x06416a00, 0x065f6a00, 0x06626a00,
+        0x06646a00, 0x06666a00, 0x06676a00, 0x06686a00, 0x066c6a00, 0x066d6a00,
+        0x066e6a00, 0x06706a00, 0x06726a00, 0x06756a00, 0x01006a26, 0x01006a27,
+        0x01006a2c, 0x01006a2d, 0x01006a2f, 0x01006a30, 0x01006a33, 0x01006a34,
+        0x01006a36, 0x01006a37, 0x01006a3b, 0x01006a3c, 0x01006a3e, 0x01006a3f,
+        0x01006a42, 0x01006a43, 0x01006a45, 0x05006a48, 0x02306b01, 0x06306b16,
+        0x02316b01, 0x06316b16, 0x02326b01, 0x06326b16, 0x02616b01, 0x06616b16,
+        0x02636b01, 0x06636b16, 0x02656b01, 0x06656b16, 0x02696b01, 0x06696b16,
+        0x026f6b01, 0x066f6b16, 0x02736b01, 0x06736b16, 0x02746b01, 0x06746b16,
+        0x06206b00, 0x06256b00, 0x062d6b00, 0x062e6b00, 0x062f6b00, 0x06336b00,
+        0x06346b00, 0x06356b00, 0x06366b00, 0x06376b00, 0x06386b00, 0x06396b00,
+        0x063d6b00, 0x06416b00, 0x065f6b00, 0x06626b00, 0x06646b00, 0x06666b00,
+        0x06676b00, 0x06686b00, 0x066c6b00, 0x066d6b00, 0x066e6b00, 0x06706b00,
+        0x06726b00, 0x06756b00, 0x01006b26, 0x01006b27, 0x01006b2c, 0x01006b2d,
+        0x01006b2f, 0x01006b30, 0x01006b33, 0x01006b34, 0x01006b36, 0x01006b37,
+        0x01006b3b, 0x01006b3c, 0x01006b3e, 0x01006b3f, 0x01006b42, 0x01006b43,
+        0x01006b45, 0x05006b48, 0x02307101, 0x06307116, 0x02317101, 0x06317116,
+        0x02327101, 0x06327116, 0x02617101, 0x06617116, 0x02637101, 0x06637116,
+        0x02657101, 0x06657116, 0x02697101, 0x06697116, 0x026f7101, 0x066f7116,
+        0x02737101, 0x06737116, 0x02747101, 0x06747116, 0x06207100, 0x06257100,
+        0x062d7100, 0x062e7100, 0x062f7100, 0x06337100, 0x06347100, 0x06357100,
+        0x06367100, 0x06377100, 0x06387100, 0x06397100, 0x063d7100, 0x06417100,
+        0x065f7100, 0x06627100, 0x06647100, 0x06667100, 0x06677100, 0x06687100,
+        0x066c7100, 0x066d7100, 0x066e7100, 0x06707100, 0x06727100, 0x06757100,
+        0x01007126, 0x01007127, 0x0100712c, 0x0100712d, 0x0100712f, 0x01007130,
+        0x01007133, 0x01007134, 0x01007136, 0x01007137, 0x0100713b, 0x0100713c,
+        0x0100713e, 0x0100713f, 0x01007142, 0x01007143, 0x01007145, 0x05007148,
+        0x02307601, 0x06307616, 0x02317601, 0x06317616, 0x02327601, 0x06327616,
+        0x02617601, 0x06617616, 0x02637601, 0x06637616, 0x02657601, 0x06657616,
+        0x02697601, 0x06697616, 0x026f7601, 0x066f7616, 0x02737601, 0x06737616,
+        0x02747601, 0x06747616, 0x06207600, 0x06257600, 0x062d7600, 0x062e7600,
+        0x062f7600, 0x06337600, 0x06347600, 0x06357600, 0x06367600, 0x06377600,
+        0x06387600, 0x06397600, 0x063d7600, 0x06417600, 0x065f7600, 0x06627600,
+        0x06647600, 0x06667600, 0x06677600, 0x06687600, 0x066c7600, 0x066d7600,
+        0x066e7600, 0x06707600, 0x06727600, 0x06757600, 0x01007626, 0x01007627,
+        0x0100762c, 0x0100762d, 0x0100762f, 0x01007630, 0x01007633, 0x01007634,
+        0x01007636, 0x01007637, 0x0100763b, 0x0100763c, 0x0100763e, 0x0100763f,
+        0x01007642, 0x01007643, 0x01007645, 0x05007648
+    },
+    /* 62 */
+    {
+        0x02306a02, 0x02306a09, 0x02306a17, 0x06306a28, 0x02316a02, 0x02316a09,
+        0x02316a17, 0x06316a28, 0x02326a02, 0x02326a09, 0x02326a17, 0x06326a28,
+        0x02616a02, 0x02616a09, 0x02616a17, 0x06616a28, 0x02636a02, 0x02636a09,
+        0x02636a17, 0x06636a28, 0x02656a02, 0x02656a09, 0x02656a17, 0x06656a28,
+        0x02696a02, 0x02696a09, 0x02696a17, 0x06696a28, 0x026f6a02, 0x026f6a09,
+        0x026f6a17, 0x066f6a28, 0x02736a02, 0x02736a09, 0x02736a17, 0x06736a28,
+        0x02746a02, 0x02746a09, 0x02746a17, 0x06746a28, 0x02206a01, 0x06206a16,
+        0x02256a01, 0x06256a16, 0x022d6a01, 0x062d6a16, 0x022e6a01, 0x062e6a16,
+        0x022f6a01, 0x062f6a16, 0x02336a01, 0x06336a16, 0x02346a01, 0x06346a16,
+        0x02356a01, 0x06356a16, 0x02366a01, 0x06366a16, 0x02376a01, 0x06376a16,
+        0x02386a01, 0x06386a16, 0x02396a01, 0x06396a16, 0x023d6a01, 0x063d6a16,
+        0x02416a01, 0x06416a16, 0x025f6a01, 0x065f6a16, 0x02626a01, 0x06626a16,
+        0x02646a01, 0x06646a16, 0x02666a01, 0x06666a16, 0x02676a01, 0x06676a16,
+        0x02686a01, 0x06686a16, 0x026c6a01, 0x066c6a16, 0x026d6a01, 0x066d6a16,
+        0x026e6a01, 0x066e6a16, 0x02706a01, 0x06706a16, 0x02726a01, 0x06726a16,
+        0x02756a01, 0x06756a16, 0x063a6a00, 0x06426a00, 0x06436a00, 0x06446a00,
+        0x06456a00, 0x06466a00, 0x06476a00, 0x06486a00, 0x06496a00, 0x064a6a00,
+        0x064b6a00, 0x064c6a00, 0x064d6a00, 0x064e6a00, 0x064f6a00, 0x06506a00,
+        0x06516a00, 0x06526a00, 0x06536a00, 0x06546a00, 0x06556a00, 0x06566a00,
+        0x06576a00, 0x06596a00, 0x066a6a00, 0x066b6a00, 0x06716a00, 0x06766a00,
+        0x06776a00, 0x06786a00, 0x06796a00, 0x067a6a00, 0x01006a46, 0x01006a47,
+        0x01006a49, 0x05006a4a, 0x02306b02, 0x02306b09, 0x02306b17, 0x06306b28,
+        0x02316b02, 0x02316b09, 0x02316b17, 0x06316b28, 0x02326b02, 0x02326b09,
+        0x02326b17, 0x06326b28, 0x02616b02, 0x02616b09, 0x02616b17, 0x06616b28,
+        0x02636b02, 0x02636b09, 0x02636b17, 0x06636b28, 0x02656b02, 0x02656b09,
+        0x02656b17, 0x06656b28, 0x02696b02, 0x02696b09, 0x02696b17, 0x06696b28,
+        0x026f6b02, 0x026f6b09, 0x026f6b17, 0x066f6b28, 0x02736b02, 0x02736b09,
+        0x02736b17, 0x06736b28, 0x02746b02, 0x02746b09, 0x02746b17, 0x06746b28,
+        0x02206b01, 0x06206b16, 0x02256b01, 0x06256b16, 0x022d6b01, 0x062d6b16,
+        0x022e6b01, 0x062e6b16, 0x022f6b01, 0x062f6b16, 0x02336b01, 0x06336b16,
+        0x02346b01, 0x06346b16, 0x02356b01, 0x06356b16, 0x02366b01, 0x06366b16,
+        0x02376b01, 0x06376b16, 0x02386b01, 0x06386b16, 0x02396b01, 0x06396b16,
+        0x023d6b01, 0x063d6b16, 0x02416b01, 0x06416b16, 0x025f6b01, 0x065f6b16,
+        0x02626b01, 0x06626b16, 0x02646b01, 0x06646b16, 0x02666b01, 0x06666b16,
+        0x02676b01, 0x06676b16, 0x02686b01, 0x06686b16, 0x026c6b01, 0x066c6b16,
+        0x026d6b01, 0x066d6b16, 0x026e6b01, 0x066e6b16, 0x02706b01, 0x06706b16,
+        0x02726b01, 0x06726b16, 0x02756b01, 0x06756b16, 0x063a6b00, 0x06426b00,
+        0x06436b00, 0x06446b00, 0x06456b00, 0x06466b00, 0x06476b00, 0x06486b00,
+        0x06496b00, 0x064a6b00, 0x064b6b00, 0x064c6b00, 0x064d6b00, 0x064e6b00,
+        0x064f6b00, 0x06506b00, 0x06516b00, 0x06526b00, 0x06536b00, 0x06546b00,
+        0x06556b00, 0x06566b00, 0x06576b00, 0x06596b00, 0x066a6b00, 0x066b6b00,
+        0x06716b00, 0x06766b00, 0x06776b00, 0x06786b00, 0x06796b00, 0x067a6b00,
+        0x01006b46, 0x01006b47, 0x01006b49, 0x05006b4a
+    },
+    /* 63 */
+    {
+        0x02307102, 0x02307109, 0x02307117, 0x06307128, 0x02317102, 0x02317109,
+        0x02317117, 0x06317128, 0x02327102, 0x02327109, 0x02327117, 0x06327128,
+        0x02617102, 0x02617109, 0x02617117, 0x06617128, 0x02637102, 0x02637109,
+        0x02637117, 0x06637128, 0x02657102, 0x02657109, 0x02657117, 0x06657128,
+        0x02697102, 0x02697109, 0x02697117, 0x06697128, 0x026f7102, 0x026f7109,
+        0x026f7117, 0x066f7128, 0x02737102, 0x02737109, 0x02737117, 0x06737128,
+        0x02747102, 0x02747109, 0x02747117, 0x06747128, 0x02207101, 0x06207116,
+        0x02257101, 0x06257116, 0x022d7101, 0x062d7116, 0x022e7101, 0x062e7116,
+        0x022f7101, 0x062f7116, 0x02337101, 0x06337116, 0x02347101, 0x06347116,
+        0x02357101, 0x06357116, 0x02367101, 0x06367116, 0x02377101, 0x06377116,
+        0x02387101, 0x06387116, 0x02397101, 0x06397116, 0x023d7101, 0x063d7116,
+        0x02417101, 0x06417116, 0x025f7101, 0x065f7116, 0x02627101, 0x06627116,
+        0x02647101, 0x06647116, 0x02667101, 0x06667116, 0x02677101, 0x06677116,
+        0x02687101, 0x06687116, 0x026c7101, 0x066c7116, 0x026d7101, 0x066d7116,
+        0x026e7101, 0x066e7116, 0x02707101, 0x06707116, 0x02727101, 0x06727116,
+        0x02757101, 0x06757116, 0x063a7100, 0x06427100, 0x06437100, 0x06447100,
+        0x06457100, 0x06467100, 0x06477100, 0x06487100, 0x06497100, 0x064a7100,
+        0x064b7100, 0x064c7100, 0x064d7100, 0x064e7100, 0x064f7100, 0x06507100,
+        0x06517100, 0x06527100, 0x06537100, 0x06547100, 0x06557100, 0x06567100,
+        0x06577100, 0x06597100, 0x066a7100, 0x066b7100, 0x06717100, 0x06767100,
+        0x06777100, 0x06787100, 0x06797100, 0x067a7100, 0x01007146, 0x01007147,
+        0x01007149, 0x0500714a, 0x02307602, 0x02307609, 0x02307617, 0x06307628,
+        0x02317602, 0x02317609, 0x02317617, 0x06317628, 0x02327602, 0x02327609,
+        0x02327617, 0x06327628, 0x02617602, 0x02617609, 0x02617617, 0x06617628,
+        0x02637602, 0x02637609, 0x02637617, 0x06637628, 0x02657602, 0x02657609,
+        0x02657617, 0x06657628, 0x02697602, 0x02697609, 0x02697617, 0x06697628,
+        0x026f7602, 0x026f7609, 0x026f7617, 0x066f7628, 0x02737602, 0x02737609,
+        0x02737617, 0x06737628, 0x02747602, 0x02747609, 0x02747617, 0x06747628,
+        0x02207601, 0x06207616, 0x02257601, 0x06257616, 0x022d7601, 0x062d7616,
+        0x022e7601, 0x062e7616, 0x022f7601, 0x062f7616, 0x02337601, 0x06337616,
+        0x02347601, 0x06347616, 0x02357601, 0x06357616, 0x02367601, 0x06367616,
+        0x02377601, 0x06377616, 0x02387601, 0x06387616, 0x02397601, 0x06397616,
+        0x023d7601, 0x063d7616, 0x02417601, 0x06417616, 0x025f7601, 0x065f7616,
+        0x02627601, 0x06627616, 0x02647601, 0x06647616, 0x02667601, 0x06667616,
+        0x02677601, 0x06677616, 0x02687601, 0x06687616, 0x026c7601, 0x066c7616,
+        0x026d7601, 0x066d7616, 0x026e7601, 0x066e7616, 0x02707601, 0x06707616,
+        0x02727601, 0x06727616, 0x02757601, 0x06757616, 0x063a7600, 0x06427600,
+        0x06437600, 0x06447600, 0x06457600, 0x06467600, 0x06477600, 0x06487600,
+        0x06497600, 0x064a7600, 0x064b7600, 0x064c7600, 0x064d7600, 0x064e7600,
+        0x064f7600, 0x06507600, 0x06517600, 0x06527600, 0x06537600, 0x06547600,
+        0x06557600, 0x06567600, 0x06577600, 0x06597600, 0x066a7600, 0x066b7600,
+        0x06717600, 0x06767600, 0x06777600, 0x06787600, 0x06797600, 0x067a7600,
+        0x01007646, 0x01007647, 0x01007649, 0x0500764a
+    },
+    /* 64 */
+    {
+        0x06307700, 0x06317700, 0x06327700, 0x06617700, 0x06637700, 0x06657700,
+        0x06697700, 0x066f7700, 0x06737700, 0x06747700, 0x0100770d, 0x0100770e,
+        0x01007711, 0x01007712, 0x01007714, 0x01007715, 0x0100771a, 0x0100771b,
+        0x0100771d, 0x0100771e, 0x01007721, 0x01007722, 0x01007724, 0x01007725,
+        0x0100772b, 0x0100772e, 0x01007732, 0x01007735, 0x0100773a, 0x0100773d,
+        0x01007741, 0x05007744, 0x06307800, 0x06317800, 0x06327800, 0x06617800,
+        0x06637800, 0x06657800, 0x06697800, 0x066f7800, 0x06737800, 0x06747800,
+        0x0100780d, 0x0100780e, 0x01007811, 0x01007812, 0x01007814, 0x01007815,
+        0x0100781a, 0x0100781b, 0x0100781d, 0x0100781e, 0x01007821, 0x01007822,
+        0x01007824, 0x01007825, 0x0100782b, 0x0100782e, 0x01007832, 0x01007835,
+        0x0100783a, 0x0100783d, 0x01007841, 0x05007844, 0x06307900, 0x06317900,
+        0x06327900, 0x06617900, 0x06637900, 0x06657900, 0x06697900, 0x066f7900,
+        0x06737900, 0x06747900, 0x0100790d, 0x0100790e, 0x01007911, 0x01007912,
+        0x01007914, 0x01007915, 0x0100791a, 0x0100791b, 0x0100791d, 0x0100791e,
+        0x01007921, 0x01007922, 0x01007924, 0x01007925, 0x0100792b, 0x0100792e,
+        0x01007932, 0x01007935, 0x0100793a, 0x0100793d, 0x01007941, 0x05007944,
+        0x06307a00, 0x06317a00, 0x06327a00, 0x06617a00, 0x06637a00, 0x06657a00,
+        0x06697a00, 0x066f7a00, 0x06737a00, 0x06747a00, 0x01007a0d, 0x01007a0e,
+        0x01007a11, 0x01007a12, 0x01007a14, 0x01007a15, 0x01007a1a, 0x01007a1b,
+        0x01007a1d, 0x01007a1e, 0x01007a21, 0x01007a22, 0x01007a24, 0x01007a25,
+        0x01007a2b, 0x01007a2e, 0x01007a32, 0x01007a35, 0x01007a3a, 0x01007a3d,
+        0x01007a41, 0x05007a44, 0x01002604, 0x01002605, 0x01002607, 0x01002608,
+        0x0100260b, 0x0100260c, 0x01002610, 0x01002613, 0x01002619, 0x0100261c,
+        0x01002620, 0x01002623, 0x0100262a, 0x01002631, 0x01002639, 0x05002640,
+        0x01002a04, 0x01002a05, 0x01002a07, 0x01002a08, 0x01002a0b, 0x01002a0c,
+        0x01002a10, 0x01002a13, 0x01002a19, 0x01002a1c, 0x01002a20, 0x01002a23,
+        0x01002a2a, 0x01002a31, 0x01002a39, 0x05002a40, 0x01002c04, 0x01002c05,
+        0x01002c07, 0x01002c08, 0x01002c0b, 0x01002c0c, 0x01002c10, 0x01002c13,
+        0x01002c19, 0x01002c1c, 0x01002c20, 0x01002c23, 0x01002c2a, 0x01002c31,
+        0x01002c39, 0x05002c40, 0x01003b04, 0x01003b05, 0x01003b07, 0x01003b08,
+        0x01003b0b, 0x01003b0c, 0x01003b10, 0x01003b13, 0x01003b19, 0x01003b1c,
+        0x01003b20, 0x01003b23, 0x01003b2a, 0x01003b31, 0x01003b39, 0x05003b40,
+        0x01005804, 0x01005805, 0x01005807, 0x01005808, 0x0100580b, 0x0100580c,
+        0x01005810, 0x01005813, 0x01005819, 0x0100581c, 0x01005820, 0x01005823,
+        0x0100582a, 0x01005831, 0x01005839, 0x05005840, 0x01005a04, 0x01005a05,
+        0x01005a07, 0x01005a08, 0x01005a0b, 0x01005a0c, 0x01005a10, 0x01005a13,
+        0x01005a19, 0x01005a1c, 0x01005a20, 0x01005a23, 0x01005a2a, 0x01005a31,
+        0x01005a39, 0x05005a40, 0x01002102, 0x01002109, 0x01002117, 0x05002128,
+        0x01002202, 0x01002209, 0x01002217, 0x05002228, 0x01002802, 0x01002809,
+        0x01002817, 0x05002828, 0x01002902, 0x01002909, 0x01002917, 0x05002928,
+        0x01003f02, 0x01003f09, 0x01003f17, 0x05003f28, 0x01002701, 0x05002716,
+        0x01002b01, 0x05002b16, 0x01007c01, 0x05007c16, 0x05002300, 0x05003e00,
+        0x00000056, 0x00000057, 0x00000059, 0x0400005a
+    },
+    /* 65 */
+    {
+        0x02307701, 0x06307716, 0x02317701, 0x06317716, 0x02327701, 0x06327716,
+        0x02617701, 0x06617716, 0x02637701, 0x06637716, 0x02657701, 0x06657716,
+        0x02697701, 0x06697716, 0x026f7701, 0x066f7716, 0x02737701, 0x06737716,
+        0x02747701, 0x06747716, 0x06207700, 0x06257700, 0x062d7700, 0x062e7700,
+        0x062f7700, 0x06337700, 0x06347700, 0x06357700, 0x06367700, 0x06377700,
+        0x06387700, 0x06397700, 0x063d7700, 0x06417700, 0x065f7700, 0x06627700,
+        0x06647700, 0x06667700, 0x06677700, 0x06687700, 0x066c7700, 0x066d7700,
+        0x066e7700, 0x06707700, 0x06727700, 0x06757700, 0x01007726, 0x01007727,
+        0x0100772c, 0x0100772d, 0x0100772f, 0x01007730, 0x01007733, 0x01007734,
+        0x01007736, 0x01007737, 0x0100773b, 0x0100773c, 0x0100773e, 0x0100773f,
+        0x01007742, 0x01007743, 0x01007745, 0x05007748, 0x02307801, 0x06307816,
+        0x02317801, 0x06317816, 0x02327801, 0x06327816, 0x02617801, 0x06617816,
+        0x02637801, 0x06637816, 0x02657801, 0x06657816, 0x02697801, 0x06697816,
+        0x026f7801, 0x066f7816, 0x02737801, 0x06737816, 0x02747801, 0x06747816,
+        0x06207800, 0x06257800, 0x062d7800, 0x062e7800, 0x062f7800, 0x06337800,
+        0x06347800, 0x06357800, 0x06367800, 0x06377800, 0x06387800, 0x06397800,
+        0x063d7800, 0x06417800, 0x065f7800, 0x06627800, 0x06647800, 0x06667800,
+        0x06677800, 0x06687800, 0x066c7800, 0x066d7800, 0x066e7800, 0x06707800,
+        0x06727800, 0x06757800, 0x01007826, 0x01007827, 0x0100782c, 0x0100782d,
+        0x0100782f, 0x01007830, 0x01007833, 0x01007834, 0x01007836, 0x01007837,
+        0x0100783b, 0x0100783c, 0x0100783e, 0x0100783f, 0x01007842, 0x01007843,
+        0x01007845, 0x05007848, 0x02307901, 0x06307916, 0x02317901, 0x06317916,
+        0x02327901, 0x06327916, 0x02617901, 0x06617916, 0x02637901, 0x06637916,
+        0x02657901, 0x06657916, 0x02697901, 0x06697916, 0x026f7901, 0x066f7916,
+        0x02737901, 0x06737916, 0x02747901, 0x06747916, 0x06207900, 0x06257900,
+        0x062d7900, 0x062e7900, 0x062f7900, 0x06337900, 0x06347900, 0x06357900,
+        0x06367900, 0x06377900, 0x06387900, 0x06397900, 0x063d7900, 0x06417900,
+        0x065f7900, 0x06627900, 0x06647900, 0x06667900, 0x06677900, 0x06687900,
+        0x066c7900, 0x066d7900, 0x066e7900, 0x06707900, 0x06727900, 0x06757900,
+        0x01007926, 0x01007927, 0x0100792c, 0x0100792d, 0x0100792f, 0x01007930,
+        0x01007933, 0x01007934, 0x01007936, 0x01007937, 0x0100793b, 0x0100793c,
+        0x0100793e, 0x0100793f, 0x01007942, 0x01007943, 0x01007945, 0x05007948,
+        0x02307a01, 0x06307a16, 0x02317a01, 0x06317a16, 0x02327a01, 0x06327a16,
+        0x02617a01, 0x06617a16, 0x02637a01, 0x06637a16, 0x02657a01, 0x06657a16,
+        0x02697a01, 0x06697a16, 0x026f7a01, 0x066f7a16, 0x02737a01, 0x06737a16,
+        0x02747a01, 0x06747a16, 0x06207a00, 0x06257a00, 0x062d7a00, 0x062e7a00,
+        0x062f7a00, 0x06337a00, 0x06347a00, 0x06357a00, 0x06367a00, 0x06377a00,
+        0x06387a00, 0x06397a00, 0x063d7a00, 0x06417a00, 0x065f7a00, 0x06627a00,
+        0x06647a00, 0x06667a00, 0x06677a00, 0x06687a00, 0x066c7a00, 0x066d7a00,
+        0x066e7a00, 0x06707a00, 0x06727a00, 0x06757a00, 0x01007a26, 0x01007a27,
+        0x01007a2c, 0x01007a2d, 0x01007a2f, 0x01007a30, 0x01007a33, 0x01007a34,
+        0x01007a36, 0x01007a37, 0x01007a3b, 0x01007a3c, 0x01007a3e, 0x01007a3f,
+        0x01007a42, 0x01007a43, 0x01007a45, 0x05007a48
+    },
+    /* 66 */
+    {
+        0x02307702, 0x02307709, 0x02307717, 0x06307728, 0x02317702, 0x02317709,
+        0x02317717, 0x06317728, 0x02327702, 0x02327709, 0x02327717, 0x06327728,
+        0x02617702, 0x02617709, 0x02617717, 0x06617728, 0x02637702, 0x02637709,
+        0x02637717, 0x06637728, 0x02657702, 0x02657709, 0x02657717, 0x06657728,
+        0x02697702, 0x02697709, 0x02697717, 0x06697728, 0x026f7702, 0x026f7709,
+        0x026f7717, 0x066f7728, 0x02737702, 0x02737709, 0x02737717, 0x06737728,
+        0x02747702, 0x02747709, 0x02747717, 0x06747728, 0x02207701, 0x06207716,
+        0x02257701, 0x06257716, 0x022d7701, 0x062d7716, 0x022e7701, 0x062e7716,
+        0x022f7701, 0x062f7716, 0x02337701, 0x06337716, 0x02347701, 0x06347716,
+        0x02357701, 0x06357716, 0x02367701, 0x06367716, 0x02377701, 0x06377716,
+        0x02387701, 0x06387716, 0x02397701, 0x06397716, 0x023d7701, 0x063d7716,
+        0x02417701, 0x06417716, 0x025f7701, 0x065f7716, 0x02627701, 0x06627716,
+        0x02647701, 0x06647716, 0x02667701, 0x06667716, 0x02677701, 0x06677716,
+        0x02687701, 0x06687716, 0x026c7701, 0x066c7716, 0x026d7701, 0x066d7716,
+        0x026e7701, 0x066e7716, 0x02707701, 0x06707716, 0x02727701, 0x06727716,
+        0x02757701, 0x06757716, 0x063a7700, 0x06427700, 0x06437700, 0x06447700,
+        0x06457700, 0x06467700, 0x06477700, 0x06487700, 0x06497700, 0x064a7700,
+        0x064b7700, 0x064c7700, 0x064d7700, 0x064e7700, 0x064f7700, 0x06507700,
+        0x06517700, 0x06527700, 0x06537700, 0x06547700, 0x06557700, 0x06567700,
+        0x06577700, 0x06597700, 0x066a7700, 0x066b7700, 0x06717700, 0x06767700,
+        0x06777700, 0x06787700, 0x06797700, 0x067a7700, 0x01007746, 0x01007747,
+        0x01007749, 0x0500774a, 0x02307802, 0x02307809, 0x02307817, 0x06307828,
+        0x02317802, 0x02317809, 0x02317817, 0x06317828, 0x02327802, 0x02327809,
+        0x02327817, 0x06327828, 0x02617802, 0x02617809, 0x02617817, 0x06617828,
+        0x02637802, 0x02637809, 0x02637817, 0x06637828, 0x02657802, 0x02657809,
+        0x02657817, 0x06657828, 0x02697802, 0x02697809, 0x02697817, 0x06697828,
+        0x026f7802, 0x026f7809, 0x026f7817, 0x066f7828, 0x02737802, 0x02737809,
+        0x02737817, 0x06737828, 0x02747802, 0x02747809, 0x02747817, 0x06747828,
+        0x02207801, 0x06207816, 0x02257801, 0x06257816, 0x022d7801, 0x062d7816,
+        0x022e7801, 0x062e7816, 0x022f7801, 0x062f7816, 0x02337801, 0x06337816,
+        0x02347801, 0x06347816, 0x02357801, 0x06357816, 0x02367801, 0x06367816,
+        0x02377801, 0x06377816, 0x02387801, 0x06387816, 0x02397801, 0x06397816,
+        0x023d7801, 0x063d7816, 0x02417801, 0x06417816, 0x025f7801, 0x065f7816,
+        0x02627801, 0x06627816, 0x02647801, 0x06647816, 0x02667801, 0x06667816,
+        0x02677801, 0x06677816, 0x02687801, 0x06687816, 0x026c7801, 0x066c7816,
+        0x026d7801, 0x066d7816, 0x026e7801, 0x066e7816, 0x02707801, 0x06707816,
+        0x02727801, 0x06727816, 0x02757801, 0x06757816, 0x063a7800, 0x06427800,
+        0x06437800, 0x06447800, 0x06457800, 0x06467800, 0x06477800, 0x06487800,
+        0x06497800, 0x064a7800, 0x064b7800, 0x064c7800, 0x064d7800, 0x064e7800,
+        0x064f7800, 0x06507800, 0x06517800, 0x06527800, 0x06537800, 0x06547800,
+        0x06557800, 0x06567800, 0x06577800, 0x06597800, 0x066a7800, 0x066b7800,
+        0x06717800, 0x06767800, 0x06777800, 0x06787800, 0x06797800, 0x067a7800,
+        0x01007846, 0x01007847, 0x01007849, 0x0500784a
+    },
+    /* 67 */
+    {
+        0x02307902, 0x02307909, 0x02307917, 0x06307928, 0x02317902, 0x02317909,
+        0x02317917, 0x06317928, 0x02327902, 0x02327909, 0x02327917, 0x06327928,
+        0x02617902, 0x02617909, 0x02617917, 0x06617928, 0x02637902, 0x02637909,
+        0x02637917, 0x06637928, 0x02657902, 0x02657909, 0x02657917, 0x06657928,
+        0x02697902, 0x02697909, 0x02697917, 0x06697928, 0x026f7902, 0x026f7909,
+        0x026f7917, 0x066f7928, 0x02737902, 0x02737909, 0x02737917, 0x06737928,
+        0x02747902, 0x02747909, 0x02747917, 0x06747928, 0x02207901, 0x06207916,
+        0x02257901, 0x06257916, 0x022d7901, 0x062d7916, 0x022e7901, 0x062e7916,
+        0x022f7901, 0x062f7916, 0x02337901, 0x06337916, 0x02347901, 0x06347916,
+        0x02357901, 0x06357916, 0x02367901, 0x06367916, 0x02377901, 0x06377916,
+        0x02387901, 0x06387916, 0x02397901, 0x06397916, 0x023d7901, 0x063d7916,
+        0x02417901, 0x06417916, 0x025f7901, 0x065f7916, 0x02627901, 0x06627916,
+        0x02647901, 0x06647916, 0x02667901, 0x06667916, 0x02677901, 0x06677916,
+        0x02687901, 0x06687916, 0x026c7901, 0x066c7916, 0x026d7901, 0x066d7916,
+        0x026e7901, 0x066e7916, 0x02707901, 0x06707916, 0x02727901, 0x06727916,
+        0x02757901, 0x06757916, 0x063a7900, 0x06427900, 0x06437900, 0x06447900,
+        0x06457900, 0x06467900, 0x06477900, 0x06487900, 0x06497900, 0x064a7900,
+        0x064b7900, 0x064c7900, 0x064d7900, 0x064e7900, 0x064f7900, 0x06507900,
+        0x06517900, 0x06527900, 0x06537900, 0x06547900, 0x06557900, 0x06567900,
+        0x06577900, 0x06597900, 0x066a7900, 0x066b7900, 0x06717900, 0x06767900,
+        0x06777900, 0x06787900, 0x06797900, 0x067a7900, 0x01007946, 0x01007947,
+        0x01007949, 0x0500794a, 0x02307a02, 0x02307a09, 0x02307a17, 0x06307a28,
+        0x02317a02, 0x02317a09, 0x02317a17, 0x06317a28, 0x02327a02, 0x02327a09,
+        0x02327a17, 0x06327a28, 0x02617a02, 0x02617a09, 0x02617a17, 0x06617a28,
+        0x02637a02, 0x02637a09, 0x02637a17, 0x06637a28, 0x02657a02, 0x02657a09,
+        0x02657a17, 0x06657a28, 0x02697a02, 0x02697a09, 0x02697a17, 0x06697a28,
+        0x026f7a02, 0x026f7a09, 0x026f7a17, 0x066f7a28, 0x02737a02, 0x02737a09,
+        0x02737a17, 0x06737a28, 0x02747a02, 0x02747a09, 0x02747a17, 0x06747a28,
+        0x02207a01, 0x06207a16, 0x02257a01, 0x06257a16, 0x022d7a01, 0x062d7a16,
+        0x022e7a01, 0x062e7a16, 0x022f7a01, 0x062f7a16, 0x02337a01, 0x06337a16,
+        0x02347a01, 0x06347a16, 0x02357a01, 0x06357a16, 0x02367a01, 0x06367a16,
+        0x02377a01, 0x06377a16, 0x02387a01, 0x06387a16, 0x02397a01, 0x06397a16,
+        0x023d7a01, 0x063d7a16, 0x02417a01, 0x06417a16, 0x025f7a01, 0x065f7a16,
+        0x02627a01, 0x06627a16, 0x02647a01, 0x06647a16, 0x02667a01, 0x06667a16,
+        0x02677a01, 0x06677a16, 0x02687a01, 0x06687a16, 0x026c7a01, 0x066c7a16,
+        0x026d7a01, 0x066d7a16, 0x026e7a01, 0x066e7a16, 0x02707a01, 0x06707a16,
+        0x02727a01, 0x06727a16, 0x02757a01, 0x06757a16, 0x063a7a00, 0x06427a00,
+        0x06437a00, 0x06447a00, 0x06457a00, 0x06467a00, 0x06477a00, 0x06487a00,
+        0x06497a00, 0x064a7a00, 0x064b7a00, 0x064c7a00, 0x064d7a00, 0x064e7a00,
+        0x064f7a00, 0x06507a00, 0x06517a00, 0x06527a00, 0x06537a00, 0x06547a00,
+        0x06557a00, 0x06567a00, 0x06577a00, 0x06597a00, 0x066a7a00, 0x066b7a00,
+        0x06717a00, 0x06767a00, 0x06777a00, 0x06787a00, 0x06797a00, 0x067a7a00,
+        0x01007a46, 0x01007a47, 0x01007a49, 0x05007a4a
+    },
+    /* 68 */
+    {
+        0x06302600, 0x06312600, 0x06322600, 0x06612600, 0x06632600, 0x06652600,
+        0x06692600, 0x066f2600, 0x06732600, 0x06742600, 0x0100260d, 0x0100260e,
+        0x01002611, 0x01002612, 0x01002614, 0x01002615, 0x0100261a, 0x0100261b,
+        0x0100261d, 0x0100261e, 0x01002621, 0x01002622, 0x01002624, 0x01002625,
+        0x0100262b, 0x0100262e, 0x01002632, 0x01002635, 0x0100263a, 0x0100263d,
+        0x01002641, 0x05002644, 0x06302a00, 0x06312a00, 0x06322a00, 0x06612a00,
+        0x06632a00, 0x06652a00, 0x06692a00, 0x066f2a00, 0x06732a00, 0x06742a00,
+        0x01002a0d, 0x01002a0e, 0x01002a11, 0x01002a12, 0x01002a14, 0x01002a15,
+        0x01002a1a, 0x01002a1b, 0x01002a1d, 0x01002a1e, 0x01002a21, 0x01002a22,
+        0x01002a24, 0x01002a25, 0x01002a2b, 0x01002a2e, 0x01002a32, 0x01002a35,
+        0x01002a3a, 0x01002a3d, 0x01002a41, 0x05002a44, 0x06302c00, 0x06312c00,
+        0x06322c00, 0x06612c00, 0x06632c00, 0x06652c00, 0x06692c00, 0x066f2c00,
+        0x06732c00, 0x06742c00, 0x01002c0d, 0x01002c0e, 0x01002c11, 0x01002c12,
+        0x01002c14, 0x01002c15, 0x01002c1a, 0x01002c1b, 0x01002c1d, 0x01002c1e,
+        0x01002c21, 0x01002c22, 0x01002c24, 0x01002c25, 0x01002c2b, 0x01002c2e,
+        0x01002c32, 0x01002c35, 0x01002c3a, 0x01002c3d, 0x01002c41, 0x05002c44,
+        0x06303b00, 0x06313b00, 0x06323b00, 0x06613b00, 0x06633b00, 0x06653b00,
+        0x06693b00, 0x066f3b00, 0x06733b00, 0x06743b00, 0x01003b0d, 0x01003b0e,
+        0x01003b11, 0x01003b12, 0x01003b14, 0x01003b15, 0x01003b1a, 0x01003b1b,
+        0x01003b1d, 0x01003b1e, 0x01003b21, 0x01003b22, 0x01003b24, 0x01003b25,
+        0x01003b2b, 0x01003b2e, 0x01003b32, 0x01003b35, 0x01003b3a, 0x01003b3d,
+        0x01003b41, 0x05003b44, 0x06305800, 0x06315800, 0x06325800, 0x06615800,
+        0x06635800, 0x06655800, 0x06695800, 0x066f5800, 0x06735800, 0x06745800,
+        0x0100580d, 0x0100580e, 0x01005811, 0x01005812, 0x01005814, 0x01005815,
+        0x0100581a, 0x0100581b, 0x0100581d, 0x0100581e, 0x01005821, 0x01005822,
+        0x01005824, 0x01005825, 0x0100582b, 0x0100582e, 0x01005832, 0x01005835,
+        0x0100583a, 0x0100583d, 0x01005841, 0x05005844, 0x06305a00, 0x06315a00,
+        0x06325a00, 0x06615a00, 0x06635a00, 0x06655a00, 0x06695a00, 0x066f5a00,
+        0x06735a00, 0x06745a00, 0x01005a0d, 0x01005a0e, 0x01005a11, 0x01005a12,
+        0x01005a14, 0x01005a15, 0x01005a1a, 0x01005a1b, 0x01005a1d, 0x01005a1e,
+        0x01005a21, 0x01005a22, 0x01005a24, 0x01005a25, 0x01005a2b, 0x01005a2e,
+        0x01005a32, 0x01005a35, 0x01005a3a, 0x01005a3d, 0x01005a41, 0x05005a44,
+        0x01002103, 0x01002106, 0x0100210a, 0x0100210f, 0x01002118, 0x0100211f,
+        0x01002129, 0x05002138, 0x01002203, 0x01002206, 0x0100220a, 0x0100220f,
+        0x01002218, 0x0100221f, 0x01002229, 0x05002238, 0x01002803, 0x01002806,
+        0x0100280a, 0x0100280f, 0x01002818, 0x0100281f, 0x01002829, 0x05002838,
+        0x01002903, 0x01002906, 0x0100290a, 0x0100290f, 0x01002918, 0x0100291f,
+        0x01002929, 0x05002938, 0x01003f03, 0x01003f06, 0x01003f0a, 0x01003f0f,
+        0x01003f18, 0x01003f1f, 0x01003f29, 0x05003f38, 0x01002702, 0x01002709,
+        0x01002717, 0x05002728, 0x01002b02, 0x01002b09, 0x01002b17, 0x05002b28,
+        0x01007c02, 0x01007c09, 0x01007c17, 0x05007c28, 0x01002301, 0x05002316,
+        0x01003e01, 0x05003e16, 0x05000000, 0x05002400, 0x05004000, 0x05005b00,
+        0x05005d00, 0x05007e00, 0x0000005b, 0x0400005c
+    },
+    /* 69 */
+    {
+        0x02302601, 0x06302616, 0x02312601, 0x06312616, 0x02322601, 0x06322616,
+        0x02612601, 0x06612616, 0x02632601, 0x06632616, 0x02652601, 0x06652616,
+        0x02692601, 0x06692616, 0x026f2601, 0x066f2616, 0x02732601, 0x06732616,
+        0x02742601, 0x06742616, 0x06202600, 0x06252600, 0x062d2600, 0x062e2600,
+        0x062f2600, 0x06332600, 0x06342600, 0x06352600, 0x06362600, 0x06372600,
+        0x06382600, 0x06392600, 0x063d2600, 0x06412600, 0x065f2600, 0x06622600,
+        0x06642600, 0x06662600, 0x06672600, 0x06682600, 0x066c2600, 0x066d2600,
+        0x066e2600, 0x06702600, 0x06722600, 0x06752600, 0x01002626, 0x01002627,
+        0x0100262c, 0x0100262d, 0x0100262f, 0x01002630, 0x01002633, 0x01002634,
+        0x01002636, 0x01002637, 0x0100263b, 0x0100263c, 0x0100263e, 0x0100263f,
+        0x01002642, 0x01002643, 0x01002645, 0x05002648, 0x02302a01, 0x06302a16,
+        0x02312a01, 0x06312a16, 0x02322a01, 0x06322a16, 0x02612a01, 0x06612a16,
+        0x02632a01, 0x06632a16, 0x02652a01, 0x06652a16, 0x02692a01, 0x06692a16,
+        0x026f2a01, 0x066f2a16, 0x02732a01, 0x06732a16, 0x02742a01, 0x06742a16,
+        0x06202a00, 0x06252a00, 0x062d2a00, 0x062e2a00, 0x062f2a00, 0x06332a00,
+        0x06342a00, 0x06352a00, 0x06362a00, 0x06372a00, 0x06382a00, 0x06392a00,
+        0x063d2a00, 0x06412a00, 0x065f2a00, 0x06622a00, 0x06642a00, 0x06662a00,
+        0x06672a00, 0x06682a00, 0x066c2a00, 0x066d2a00, 0x066e2a00, 0x06702a00,
+        0x06722a00, 0x06752a00, 0x01002a26, 0x01002a27, 0x01002a2c, 0x01002a2d,
+        0x01002a2f, 0x01002a30, 0x01002a33, 0x01002a34, 0x01002a36, 0x01002a37,
+        0x01002a3b, 0x01002a3c, 0x01002a3e, 0x01002a3f, 0x01002a42, 0x01002a43,
+        0x01002a45, 0x05002a48, 0x02302c01, 0x06302c16, 0x02312c01, 0x06312c16,
+        0x02322c01, 0x06322c16, 0x02612c01, 0x06612c16, 0x02632c01, 0x06632c16,
+        0x02652c01, 0x06652c16, 0x02692c01, 0x06692c16, 0x026f2c01, 0x066f2c16,
+        0x02732c01, 0x06732c16, 0x02742c01, 0x06742c16, 0x06202c00, 0x06252c00,
+        0x062d2c00, 0x062e2c00, 0x062f2c00, 0x06332c00, 0x06342c00, 0x06352c00,
+        0x06362c00, 0x06372c00, 0x06382c00, 0x06392c00, 0x063d2c00, 0x06412c00,
+        0x065f2c00, 0x06622c00, 0x06642c00, 0x06662c00, 0x06672c00, 0x06682c00,
+        0x066c2c00, 0x066d2c00, 0x066e2c00, 0x06702c00, 0x06722c00, 0x06752c00,
+        0x01002c26, 0x01002c27, 0x01002c2c, 0x01002c2d, 0x01002c2f, 0x01002c30,
+        0x01002c33, 0x01002c34, 0x01002c36, 0x01002c37, 0x01002c3b, 0x01002c3c,
+        0x01002c3e, 0x01002c3f, 0x01002c42, 0x01002c43, 0x01002c45, 0x05002c48,
+        0x02303b01, 0x06303b16, 0x02313b01, 0x06313b16, 0x02323b01, 0x06323b16,
+        0x02613b01, 0x06613b16, 0x02633b01, 0x06633b16, 0x02653b01, 0x06653b16,
+        0x02693b01, 0x06693b16, 0x026f3b01, 0x066f3b16, 0x02733b01, 0x06733b16,
+        0x02743b01, 0x06743b16, 0x06203b00, 0x06253b00, 0x062d3b00, 0x062e3b00,
+        0x062f3b00, 0x06333b00, 0x06343b00, 0x06353b00, 0x06363b00, 0x06373b00,
+        0x06383b00, 0x06393b00, 0x063d3b00, 0x06413b00, 0x065f3b00, 0x06623b00,
+        0x06643b00, 0x06663b00, 0x06673b00, 0x06683b00, 0x066c3b00, 0x066d3b00,
+        0x066e3b00, 0x06703b00, 0x06723b00, 0x06753b00, 0x01003b26, 0x01003b27,
+        0x01003b2c, 0x01003b2d, 0x01003b2f, 0x01003b30, 0x01003b33, 0x01003b34,
+        0x01003b36, 0x01003b37, 0x01003b3b, 0x01003b3c, 0x01003b3e, 0x01003b3f,
+        0x01003b42, 0x01003b43, 0x01003b45, 0x05003b48
+    },
+    /* 70 */
+    {
+        0x02302602, 0x02302609, 0x02302617, 0x06302628, 0x02312602, 0x02312609,
+        0x02312617, 0x06312628, 0x02322602, 0x02322609, 0x02322617, 0x06322628,
+        0x02612602, 0x02612609, 0x02612617, 0x06612628, 0x02632602, 0x02632609,
+        0x02632617, 0x06632628, 0x02652602, 0x02652609, 0x02652617, 0x06652628,
+        0x02692602, 0x02692609, 0x02692617, 0x06692628, 0x026f2602, 0x026f2609,
+        0x026f2617, 0x066f2628, 0x02732602, 0x02732609, 0x02732617, 0x06732628,
+        0x02742602, 0x02742609, 0x02742617, 0x06742628, 0x02202601, 0x06202616,
+        0x02252601, 0x06252616, 0x022d2601, 0x062d2616, 0x022e2601, 0x062e2616,
+        0x022f2601, 0x062f2616, 0x02332601, 0x06332616, 0x02342601, 0x06342616,
+        0x02352601, 0x06352616, 0x02362601, 0x06362616, 0x02372601, 0x06372616,
+        0x02382601, 0x06382616, 0x02392601, 0x06392616, 0x023d2601, 0x063d2616,
+        0x02412601, 0x06412616, 0x025f2601, 0x065f2616, 0x02622601, 0x06622616,
+        0x02642601, 0x06642616, 0x02662601, 0x06662616, 0x02672601, 0x06672616,
+        0x02682601, 0x06682616, 0x026c2601, 0x066c2616, 0x026d2601, 0x066d2616,
+        0x026e2601, 0x066e2616, 0x02702601, 0x06702616, 0x02722601, 0x06722616,
+        0x02752601, 0x06752616, 0x063a2600, 0x06422600, 0x06432600, 0x06442600,
+        0x06452600, 0x06462600, 0x06472600, 0x06482600, 0x06492600, 0x064a2600,
+        0x064b2600, 0x064c2600, 0x064d2600, 0x064e2600, 0x064f2600, 0x06502600,
+        0x06512600, 0x06522600, 0x06532600, 0x06542600, 0x06552600, 0x06562600,
+        0x06572600, 0x06592600, 0x066a2600, 0x066b2600, 0x06712600, 0x06762600,
+        0x06772600, 0x06782600, 0x06792600, 0x067a2600, 0x01002646, 0x01002647,
+        0x01002649, 0x0500264a, 0x02302a02, 0x02302a09, 0x02302a17, 0x06302a28,
+        0x02312a02, 0x02312a09, 0x02312a17, 0x06312a28, 0x02322a02, 0x02322a09,
+        0x02322a17, 0x06322a28, 0x02612a02, 0x02612a09, 0x02612a17, 0x06612a28,
+        0x02632a02, 0x02632a09, 0x02632a17, 0x06632a28, 0x02652a02, 0x02652a09,
+        0x02652a17, 0x06652a28, 0x02692a02, 0x02692a09, 0x02692a17, 0x06692a28,
+        0x026f2a02, 0x026f2a09, 0x026f2a17, 0x066f2a28, 0x02732a02, 0x02732a09,
+        0x02732a17, 0x06732a28, 0x02742a02, 0x02742a09, 0x02742a17, 0x06742a28,
+        0x02202a01, 0x06202a16, 0x02252a01, 0x06252a16, 0x022d2a01, 0x062d2a16,
+        0x022e2a01, 0x062e2a16, 0x022f2a01, 0x062f2a16, 0x02332a01, 0x06332a16,
+        0x02342a01, 0x06342a16, 0x02352a01, 0x06352a16, 0x02362a01, 0x06362a16,
+        0x02372a01, 0x06372a16, 0x02382a01, 0x06382a16, 0x02392a01, 0x06392a16,
+        0x023d2a01, 0x063d2a16, 0x02412a01, 0x06412a16, 0x025f2a01, 0x065f2a16,
+        0x02622a01, 0x06622a16, 0x02642a01, 0x06642a16, 0x02662a01, 0x06662a16,
+        0x02672a01, 0x06672a16, 0x02682a01, 0x06682a16, 0x026c2a01, 0x066c2a16,
+        0x026d2a01, 0x066d2a16, 0x026e2a01, 0x066e2a16, 0x02702a01, 0x06702a16,
+        0x02722a01, 0x06722a16, 0x02752a01, 0x06752a16, 0x063a2a00, 0x06422a00,
+        0x06432a00, 0x06442a00, 0x06452a00, 0x06462a00, 0x06472a00, 0x06482a00,
+        0x06492a00, 0x064a2a00, 0x064b2a00, 0x064c2a00, 0x064d2a00, 0x064e2a00,
+        0x064f2a00, 0x06502a00, 0x06512a00, 0x06522a00, 0x06532a00, 0x06542a00,
+        0x06552a00, 0x06562a00, 0x06572a00, 0x06592a00, 0x066a2a00, 0x066b2a00,
+        0x06712a00, 0x06762a00, 0x06772a00, 0x06782a00, 0x06792a00, 0x067a2a00,
+        0x01002a46, 0x01002a47, 0x01002a49, 0x05002a4a
+    },
+    /* 71 */
+    {
+        0x02302c02, 0x02302c09, 0x02302c17, 0x06302c28, 0x02312c02, 0x02312c09,
+        0x02312c17, 0x06312c28, 0x02322c02, 0x02322c09, 0x02322c17, 0x06322c28,
+        0x02612c02, 0x02612c09, 0x02612c17, 0x06612c28, 0x02632c02, 0x02632c09,
+        0x02632c17, 0x06632c28, 0x02652c02, 0x02652c09, 0x02652c17, 0x06652c28,
+        0x02692c02, 0x02692c09, 0x02692c17, 0x06692c28, 0x026f2c02, 0x026f2c09,
+        0x026f2c17, 0x066f2c28, 0x02732c02, 0x02732c09, 0x02732c17, 0x06732c28,
+        0x02742c02, 0x02742c09, 0x02742c17, 0x06742c28, 0x02202c01, 0x06202c16,
+        0x02252c01, 0x06252c16, 0x022d2c01, 0x062d2c16, 0x022e2c01, 0x062e2c16,
+        0x022f2c01, 0x062f2c16, 0x02332c01, 0x06332c16, 0x02342c01, 0x06342c16,
+        0x02352c01, 0x06352c16, 0x02362c01, 0x06362c16, 0x02372c01, 0x06372c16,
+        0x02382c01, 0x06382c16, 0x02392c01, 0x06392c16, 0x023d2c01, 0x063d2c16,
+        0x02412c01, 0x06412c16, 0x025f2c01, 0x065f2c16, 0x02622c01, 0x06622c16,
+        0x02642c01, 0x06642c16, 0x02662c01, 0x06662c16, 0x02672c01, 0x06672c16,
+        0x02682c01, 0x06682c16, 0x026c2c01, 0x066c2c16, 0x026d2c01, 0x066d2c16,
+        0x026e2c01, 0x066e2c16, 0x02702c01, 0x06702c16, 0x02722c01, 0x06722c16,
+        0x02752c01, 0x06752c16, 0x063a2c00, 0x06422c00, 0x06432c00, 0x06442c00,
+        0x06452c00, 0x06462c00, 0x06472c00, 0x06482c00, 0x06492c00, 0x064a2c00,
+        0x064b2c00, 0x064c2c00, 0x064d2c00, 0x064e2c00, 0x064f2c00, 0x06502c00,
+        0x06512c00, 0x06522c00, 0x06532c00, 0x06542c00, 0x06552c00, 0x06562c00,
+        0x06572c00, 0x06592c00, 0x066a2c00, 0x066b2c00, 0x06712c00, 0x06762c00,
+        0x06772c00, 0x06782c00, 0x06792c00, 0x067a2c00, 0x01002c46, 0x01002c47,
+        0x01002c49, 0x05002c4a, 0x02303b02, 0x02303b09, 0x02303b17, 0x06303b28,
+        0x02313b02, 0x02313b09, 0x02313b17, 0x06313b28, 0x02323b02, 0x02323b09,
+        0x02323b17, 0x06323b28, 0x02613b02, 0x02613b09, 0x02613b17, 0x06613b28,
+        0x02633b02, 0x02633b09, 0x02633b17, 0x06633b28, 0x02653b02, 0x02653b09,
+        0x02653b17, 0x06653b28, 0x02693b02, 0x02693b09, 0x02693b17, 0x06693b28,
+        0x026f3b02, 0x026f3b09, 0x026f3b17, 0x066f3b28, 0x02733b02, 0x02733b09,
+        0x02733b17, 0x06733b28, 0x02743b02, 0x02743b09, 0x02743b17, 0x06743b28,
+        0x02203b01, 0x06203b16, 0x02253b01, 0x06253b16, 0x022d3b01, 0x062d3b16,
+        0x022e3b01, 0x062e3b16, 0x022f3b01, 0x062f3b16, 0x02333b01, 0x06333b16,
+        0x02343b01, 0x06343b16, 0x02353b01, 0x06353b16, 0x02363b01, 0x06363b16,
+        0x02373b01, 0x06373b16, 0x02383b01, 0x06383b16, 0x02393b01, 0x06393b16,
+        0x023d3b01, 0x063d3b16, 0x02413b01, 0x06413b16, 0x025f3b01, 0x065f3b16,
+        0x02623b01, 0x06623b16, 0x02643b01, 0x06643b16, 0x02663b01, 0x06663b16,
+        0x02673b01, 0x06673b16, 0x02683b01, 0x06683b16, 0x026c3b01, 0x066c3b16,
+        0x026d3b01, 0x066d3b16, 0x026e3b01, 0x066e3b16, 0x02703b01, 0x06703b16,
+        0x02723b01, 0x06723b16, 0x02753b01, 0x06753b16, 0x063a3b00, 0x06423b00,
+        0x06433b00, 0x06443b00, 0x06453b00, 0x06463b00, 0x06473b00, 0x06483b00,
+        0x06493b00, 0x064a3b00, 0x064b3b00, 0x064c3b00, 0x064d3b00, 0x064e3b00,
+        0x064f3b00, 0x06503b00, 0x06513b00, 0x06523b00, 0x06533b00, 0x06543b00,
+        0x06553b00, 0x06563b00, 0x06573b00, 0x06593b00, 0x066a3b00, 0x066b3b00,
+        0x06713b00, 0x06763b00, 0x06773b00, 0x06783b00, 0x06793b00, 0x067a3b00,
+        0x01003b46, 0x01003b47, 0x01003b49, 0x05003b4a
+    },
+    /* 72 */
+    {
+        0x02305801, 0x06305816, 0x02315801, 0x06315816, 0x02325801, 0x06325816,
+        0x02615801, 0x06615816, 0x02635801, 0x06635816, 0x02655801, 0x06655816,
+        0x02695801, 0x06695816, 0x026f5801, 0x066f5816, 0x02735801, 0x06735816,
+        0x02745801, 0x06745816, 0x06205800, 0x06255800, 0x062d5800, 0x062e5800,
+        0x062f5800, 0x06335800, 0x06345800, 0x06355800, 0x06365800, 0x06375800,
+        0x06385800, 0x06395800, 0x063d5800, 0x06415800, 0x065f5800, 0x06625800,
+        0x06645800, 0x06665800, 0x06675800, 0x06685800, 0x066c5800, 0x066d5800,
+        0x066e5800, 0x06705800, 0x06725800, 0x06755800, 0x01005826, 0x01005827,
+        0x0100582c, 0x0100582d, 0x0100582f, 0x01005830, 0x01005833, 0x01005834,
+        0x01005836, 0x01005837, 0x0100583b, 0x0100583c, 0x0100583e, 0x0100583f,
+        0x01005842, 0x01005843, 0x01005845, 0x05005848, 0x02305a01, 0x06305a16,
+        0x02315a01, 0x06315a16, 0x02325a01, 0x06325a16, 0x02615a01, 0x06615a16,
+        0x02635a01, 0x06635a16, 0x02655a01, 0x06655a16, 0x02695a01, 0x06695a16,
+        0x026f5a01, 0x066f5a16, 0x02735a01, 0x06735a16, 0x02745a01, 0x06745a16,
+        0x06205a00, 0x06255a00, 0x062d5a00, 0x062e5a00, 0x062f5a00, 0x06335a00,
+        0x06345a00, 0x06355a00, 0x06365a00, 0x06375a00, 0x06385a00, 0x06395a00,
+        0x063d5a00, 0x06415a00, 0x065f5a00, 0x06625a00, 0x06645a00, 0x06665a00,
+        0x06675a00, 0x06685a00, 0x066c5a00, 0x066d5a00, 0x066e5a00, 0x06705a00,
+        0x06725a00, 0x06755a00, 0x01005a26, 0x01005a27, 0x01005a2c, 0x01005a2d,
+        0x01005a2f, 0x01005a30, 0x01005a33, 0x01005a34, 0x01005a36, 0x01005a37,
+        0x01005a3b, 0x01005a3c, 0x01005a3e, 0x01005a3f, 0x01005a42, 0x01005a43,
+        0x01005a45, 0x05005a48, 0x01002104, 0x01002105, 0x01002107, 0x01002108,
+        0x0100210b, 0x0100210c, 0x01002110, 0x01002113, 0x01002119, 0x0100211c,
+        0x01002120, 0x01002123, 0x0100212a, 0x01002131, 0x01002139, 0x05002140,
+        0x01002204, 0x01002205, 0x01002207, 0x01002208, 0x0100220b, 0x0100220c,
+        0x01002210, 0x01002213, 0x01002219, 0x0100221c, 0x01002220, 0x01002223,
+        0x0100222a, 0x01002231, 0x01002239, 0x05002240, 0x01002804, 0x01002805,
+        0x01002807, 0x01002808, 0x0100280b, 0x0100280c, 0x01002810, 0x01002813,
+        0x01002819, 0x0100281c, 0x01002820, 0x01002823, 0x0100282a, 0x01002831,
+        0x01002839, 0x05002840, 0x01002904, 0x01002905, 0x01002907, 0x01002908,
+        0x0100290b, 0x0100290c, 0x01002910, 0x01002913, 0x01002919, 0x0100291c,
+        0x01002920, 0x01002923, 0x0100292a, 0x01002931, 0x01002939, 0x05002940,
+        0x01003f04, 0x01003f05, 0x01003f07, 0x01003f08, 0x01003f0b, 0x01003f0c,
+        0x01003f10, 0x01003f13, 0x01003f19, 0x01003f1c, 0x01003f20, 0x01003f23,
+        0x01003f2a, 0x01003f31, 0x01003f39, 0x05003f40, 0x01002703, 0x01002706,
+        0x0100270a, 0x0100270f, 0x01002718, 0x0100271f, 0x01002729, 0x05002738,
+        0x01002b03, 0x01002b06, 0x01002b0a, 0x01002b0f, 0x01002b18, 0x01002b1f,
+        0x01002b29, 0x05002b38, 0x01007c03, 0x01007c06, 0x01007c0a, 0x01007c0f,
+        0x01007c18, 0x01007c1f, 0x01007c29, 0x05007c38, 0x01002302, 0x01002309,
+        0x01002317, 0x05002328, 0x01003e02, 0x01003e09, 0x01003e17, 0x05003e28,
+        0x01000001, 0x05000016, 0x01002401, 0x05002416, 0x01004001, 0x05004016,
+        0x01005b01, 0x05005b16, 0x01005d01, 0x05005d16, 0x01007e01, 0x05007e16,
+        0x05005e00, 0x05007d00, 0x0000005d, 0x0400005e
+    },
+    /* 73 */
+    {
+        0x02305802, 0x02305809, 0x02305817, 0x06305828, 0x02315802, 0x02315809,
+        0x02315817, 0x06315828, 0x02325802, 0x02325809, 0x02325817, 0x06325828,
+        0x02615802, 0x02615809, 0x02615817, 0x06615828, 0x02635802, 0x02635809,
+        0x02635817, 0x06635828, 0x02655802, 0x02655809, 0x02655817, 0x06655828,
+        0x02695802, 0x02695809, 0x02695817, 0x06695828, 0x026f5802, 0x026f5809,
+        0x026f5817, 0x066f5828, 0x02735802, 0x02735809, 0x02735817, 0x06735828,
+        0x02745802, 0x02745809, 0x02745817, 0x06745828, 0x02205801, 0x06205816,
+        0x02255801, 0x06255816, 0x022d5801, 0x062d5816, 0x022e5801, 0x062e5816,
+        0x022f5801, 0x062f5816, 0x02335801, 0x06335816, 0x02345801, 0x06345816,
+        0x02355801, 0x06355816, 0x02365801, 0x06365816, 0x02375801, 0x06375816,
+        0x02385801, 0x06385816, 0x02395801, 0x06395816, 0x023d5801, 0x063d5816,
+        0x02415801, 0x06415816, 0x025f5801, 0x065f5816, 0x02625801, 0x06625816,
+        0x02645801, 0x06645816, 0x02665801, 0x06665816, 0x02675801, 0x06675816,
+        0x02685801, 0x06685816, 0x026c5801, 0x066c5816, 0x026d5801, 0x066d5816,
+        0x026e5801, 0x066e5816, 0x02705801, 0x06705816, 0x02725801, 0x06725816,
+        0x02755801, 0x06755816, 0x063a5800, 0x06425800, 0x06435800, 0x06445800,
+        0x06455800, 0x06465800, 0x06475800, 0x06485800, 0x06495800, 0x064a5800,
+        0x064b5800, 0x064c5800, 0x064d5800, 0x064e5800, 0x064f5800, 0x06505800,
+        0x06515800, 0x06525800, 0x06535800, 0x06545800, 0x06555800, 0x06565800,
+        0x06575800, 0x06595800, 0x066a5800, 0x066b5800, 0x06715800, 0x06765800,
+        0x06775800, 0x06785800, 0x06795800, 0x067a5800, 0x01005846, 0x01005847,
+        0x01005849, 0x0500584a, 0x02305a02, 0x02305a09, 0x02305a17, 0x06305a28,
+        0x02315a02, 0x02315a09, 0x02315a17, 0x06315a28, 0x02325a02, 0x02325a09,
+        0x02325a17, 0x06325a28, 0x02615a02, 0x02615a09, 0x02615a17, 0x06615a28,
+        0x02635a02, 0x02635a09, 0x02635a17, 0x06635a28, 0x02655a02, 0x02655a09,
+        0x02655a17, 0x06655a28, 0x02695a02, 0x02695a09, 0x02695a17, 0x06695a28,
+        0x026f5a02, 0x026f5a09, 0x026f5a17, 0x066f5a28, 0x02735a02, 0x02735a09,
+        0x02735a17, 0x06735a28, 0x02745a02, 0x02745a09, 0x02745a17, 0x06745a28,
+        0x02205a01, 0x06205a16, 0x02255a01, 0x06255a16, 0x022d5a01, 0x062d5a16,
+        0x022e5a01, 0x062e5a16, 0x022f5a01, 0x062f5a16, 0x02335a01, 0x06335a16,
+        0x02345a01, 0x06345a16, 0x02355a01, 0x06355a16, 0x02365a01, 0x06365a16,
+        0x02375a01, 0x06375a16, 0x02385a01, 0x06385a16, 0x02395a01, 0x06395a16,
+        0x023d5a01, 0x063d5a16, 0x02415a01, 0x06415a16, 0x025f5a01, 0x065f5a16,
+        0x02625a01, 0x06625a16, 0x02645a01, 0x06645a16, 0x02665a01, 0x06665a16,
+        0x02675a01, 0x06675a16, 0x02685a01, 0x06685a16, 0x026c5a01, 0x066c5a16,
+        0x026d5a01, 0x066d5a16, 0x026e5a01, 0x066e5a16, 0x02705a01, 0x06705a16,
+        0x02725a01, 0x06725a16, 0x02755a01, 0x06755a16, 0x063a5a00, 0x06425a00,
+        0x06435a00, 0x06445a00, 0x06455a00, 0x06465a00, 0x06475a00, 0x06485a00,
+        0x06495a00, 0x064a5a00, 0x064b5a00, 0x064c5a00, 0x064d5a00, 0x064e5a00,
+        0x064f5a00, 0x06505a00, 0x06515a00, 0x06525a00, 0x06535a00, 0x06545a00,
+        0x06555a00, 0x06565a00, 0x06575a00, 0x06595a00, 0x066a5a00, 0x066b5a00,
+        0x06715a00, 0x06765a00, 0x06775a00, 0x06785a00, 0x06795a00, 0x067a5a00,
+        0x01005a46, 0x01005a47, 0x01005a49, 0x05005a4a
+    },
+    /* 74 */
+    {
+        0x06302100, 0x06312100, 0x06322100, 0x06612100, 0x06632100, 0x06652100,
+        0x06692100, 0x066f2100, 0x06732100, 0x06742100, 0x0100210d, 0x0100210e,
+        0x01002111, 0x01002112, 0x01002114, 0x01002115, 0x0100211a, 0x0100211b,
+        0x0100211d, 0x0100211e, 0x01002121, 0x01002122, 0x01002124, 0x01002125,
+        0x0100212b, 0x0100212e, 0x01002132, 0x01002135, 0x0100213a, 0x0100213d,
+        0x01002141, 0x05002144, 0x06302200, 0x06312200, 0x06322200, 0x06612200,
+        0x06632200, 0x06652200, 0x06692200, 0x066f2200, 0x06732200, 0x06742200,
+        0x0100220d, 0x0100220e, 0x01002211, 0x01002212, 0x01002214, 0x01002215,
+        0x0100221a, 0x0100221b, 0x0100221d, 0x0100221e, 0x01002221, 0x01002222,
+        0x01002224, 0x01002225, 0x0100222b, 0x0100222e, 0x01002232, 0x01002235,
+        0x0100223a, 0x0100223d, 0x01002241, 0x05002244, 0x06302800, 0x06312800,
+        0x06322800, 0x06612800, 0x06632800, 0x06652800, 0x06692800, 0x066f2800,
+        0x06732800, 0x06742800, 0x0100280d, 0x0100280e, 0x01002811, 0x01002812,
+        0x01002814, 0x01002815, 0x0100281a, 0x0100281b, 0x0100281d, 0x0100281e,
+        0x01002821, 0x01002822, 0x01002824, 0x01002825, 0x0100282b, 0x0100282e,
+        0x01002832, 0x01002835, 0x0100283a, 0x0100283d, 0x01002841, 0x05002844,
+        0x06302900, 0x06312900, 0x06322900, 0x06612900, 0x06632900, 0x06652900,
+        0x06692900, 0x066f2900, 0x06732900, 0x06742900, 0x0100290d, 0x0100290e,
+        0x01002911, 0x01002912, 0x01002914, 0x01002915, 0x0100291a, 0x0100291b,
+        0x0100291d, 0x0100291e, 0x01002921, 0x01002922, 0x01002924, 0x01002925,
+        0x0100292b, 0x0100292e, 0x01002932, 0x01002935, 0x0100293a, 0x0100293d,
+        0x01002941, 0x05002944, 0x06303f00, 0x06313f00, 0x06323f00, 0x06613f00,
+        0x06633f00, 0x06653f00, 0x06693f00, 0x066f3f00, 0x06733f00, 0x06743f00,
+        0x01003f0d, 0x01003f0e, 0x01003f11, 0x01003f12, 0x01003f14, 0x01003f15,
+        0x01003f1a, 0x01003f1b, 0x01003f1d, 0x01003f1e, 0x01003f21, 0x01003f22,
+        0x01003f24, 0x01003f25, 0x01003f2b, 0x01003f2e, 0x01003f32, 0x01003f35,
+        0x01003f3a, 0x01003f3d, 0x01003f41, 0x05003f44, 0x01002704, 0x01002705,
+        0x01002707, 0x01002708, 0x0100270b, 0x0100270c, 0x01002710, 0x01002713,
+        0x01002719, 0x0100271c, 0x01002720, 0x01002723, 0x0100272a, 0x01002731,
+        0x01002739, 0x05002740, 0x01002b04, 0x01002b05, 0x01002b07, 0x01002b08,
+        0x01002b0b, 0x01002b0c, 0x01002b10, 0x01002b13, 0x01002b19, 0x01002b1c,
+        0x01002b20, 0x01002b23, 0x01002b2a, 0x01002b31, 0x01002b39, 0x05002b40,
+        0x01007c04, 0x01007c05, 0x01007c07, 0x01007c08, 0x01007c0b, 0x01007c0c,
+        0x01007c10, 0x01007c13, 0x01007c19, 0x01007c1c, 0x01007c20, 0x01007c23,
+        0x01007c2a, 0x01007c31, 0x01007c39, 0x05007c40, 0x01002303, 0x01002306,
+        0x0100230a, 0x0100230f, 0x01002318, 0x0100231f, 0x01002329, 0x05002338,
+        0x01003e03, 0x01003e06, 0x01003e0a, 0x01003e0f, 0x01003e18, 0x01003e1f,
+        0x01003e29, 0x05003e38, 0x01000002, 0x01000009, 0x01000017, 0x05000028,
+        0x01002402, 0x01002409, 0x01002417, 0x05002428, 0x01004002, 0x01004009,
+        0x01004017, 0x05004028, 0x01005b02, 0x01005b09, 0x01005b17, 0x05005b28,
+        0x01005d02, 0x01005d09, 0x01005d17, 0x05005d28, 0x01007e02, 0x01007e09,
+        0x01007e17, 0x05007e28, 0x01005e01, 0x05005e16, 0x01007d01, 0x05007d16,
+        0x05003c00, 0x05006000, 0x05007b00, 0x0400005f
+    },
+    /* 75 */
+    {
+        0x02302101, 0x06302116, 0x02312101, 0x06312116, 0x02322101, 0x06322116,
+        0x02612101, 0x06612116, 0x02632101, 0x06632116, 0x02652101, 0x06652116,
+        0x02692101, 0x06692116, 0x026f2101, 0x066f2116, 0x02732101, 0x06732116,
+        0x02742101, 0x06742116, 0x06202100, 0x06252100, 0x062d2100, 0x062e2100,
+        0x062f2100, 0x06332100, 0x06342100, 0x06352100, 0x06362100, 0x06372100,
+        0x06382100, 0x06392100, 0x063d2100, 0x06412100, 0x065f2100, 0x06622100,
+        0x06642100, 0x06662100, 0x06672100, 0x06682100, 0x066c2100, 0x066d2100,
+        0x066e2100, 0x06702100, 0x06722100, 0x06752100, 0x01002126, 0x01002127,
+        0x0100212c, 0x0100212d, 0x0100212f, 0x01002130, 0x01002133, 0x01002134,
+        0x01002136, 0x01002137, 0x0100213b, 0x0100213c, 0x0100213e, 0x0100213f,
+        0x01002142, 0x01002143, 0x01002145, 0x05002148, 0x02302201, 0x06302216,
+        0x02312201, 0x06312216, 0x02322201, 0x06322216, 0x02612201, 0x06612216,
+        0x02632201, 0x06632216, 0x02652201, 0x06652216, 0x02692201, 0x06692216,
+        0x026f2201, 0x066f2216, 0x02732201, 0x06732216, 0x02742201, 0x06742216,
+        0x06202200, 0x06252200, 0x062d2200, 0x062e2200, 0x062f2200, 0x06332200,
+        0x06342200, 0x06352200, 0x06362200, 0x06372200, 0x06382200, 0x06392200,
+        0x063d2200, 0x06412200, 0x065f2200, 0x06622200, 0x06642200, 0x06662200,
+        0x06672200, 0x06682200, 0x066c2200, 0x066d2200, 0x066e2200, 0x06702200,
+        0x06722200, 0x06752200, 0x01002226, 0x01002227, 0x0100222c, 0x0100222d,
+        0x0100222f, 0x01002230, 0x01002233, 0x01002234, 0x01002236, 0x01002237,
+        0x0100223b, 0x0100223c, 0x0100223e, 0x0100223f, 0x01002242, 0x01002243,
+        0x01002245, 0x05002248, 0x02302801, 0x06302816, 0x02312801, 0x06312816,
+        0x02322801, 0x06322816, 0x02612801, 0x06612816, 0x02632801, 0x06632816,
+        0x02652801, 0x06652816, 0x02692801, 0x06692816, 0x026f2801, 0x066f2816,
+        0x02732801, 0x06732816, 0x02742801, 0x06742816, 0x06202800, 0x06252800,
+        0x062d2800, 0x062e2800, 0x062f2800, 0x06332800, 0x06342800, 0x06352800,
+        0x06362800, 0x06372800, 0x06382800, 0x06392800, 0x063d2800, 0x06412800,
+        0x065f2800, 0x06622800, 0x06642800, 0x06662800, 0x06672800, 0x06682800,
+        0x066c2800, 0x066d2800, 0x066e2800, 0x06702800, 0x06722800, 0x06752800,
+        0x01002826, 0x01002827, 0x0100282c, 0x0100282d, 0x0100282f, 0x01002830,
+        0x01002833, 0x01002834, 0x01002836, 0x01002837, 0x0100283b, 0x0100283c,
+        0x0100283e, 0x0100283f, 0x01002842, 0x01002843, 0x01002845, 0x05002848,
+        0x02302901, 0x06302916, 0x02312901, 0x06312916, 0x02322901, 0x06322916,
+        0x02612901, 0x06612916, 0x02632901, 0x06632916, 0x02652901, 0x06652916,
+        0x02692901, 0x06692916, 0x026f2901, 0x066f2916, 0x02732901, 0x06732916,
+        0x02742901, 0x06742916, 0x06202900, 0x06252900, 0x062d2900, 0x062e2900,
+        0x062f2900, 0x06332900, 0x06342900, 0x06352900, 0x06362900, 0x06372900,
+        0x06382900, 0x06392900, 0x063d2900, 0x06412900, 0x065f2900, 0x06622900,
+        0x06642900, 0x06662900, 0x06672900, 0x06682900, 0x066c2900, 0x066d2900,
+        0x066e2900, 0x06702900, 0x06722900, 0x06752900, 0x01002926, 0x01002927,
+        0x0100292c, 0x0100292d, 0x0100292f, 0x01002930, 0x01002933, 0x01002934,
+        0x01002936, 0x01002937, 0x0100293b, 0x0100293c, 0x0100293e, 0x0100293f,
+        0x01002942, 0x01002943, 0x01002945, 0x05002948
+    },
+    /* 76 */
+    {
+        0x02302102, 0x02302109, 0x02302117, 0x06302128, 0x02312102, 0x02312109,
+        0x02312117, 0x06312128, 0x02322102, 0x02322109, 0x02322117, 0x06322128,
+        0x02612102, 0x02612109, 0x02612117, 0x06612128, 0x02632102, 0x02632109,
+        0x02632117, 0x06632128, 0x02652102, 0x02652109, 0x02652117, 0x06652128,
+        0x02692102, 0x02692109, 0x02692117, 0x06692128, 0x026f2102, 0x026f2109,
+        0x026f2117, 0x066f2128, 0x02732102, 0x02732109, 0x02732117, 0x06732128,
+        0x02742102, 0x02742109, 0x02742117, 0x06742128, 0x02202101, 0x06202116,
+        0x02252101, 0x06252116, 0x022d2101, 0x062d2116, 0x022e2101, 0x062e2116,
+        0x022f2101, 0x062f2116, 0x02332101, 0x06332116, 0x02342101, 0x06342116,
+        0x02352101, 0x06352116, 0x02362101, 0x06362116, 0x02372101, 0x06372116,
+        0x02382101, 0x06382116, 0x02392101, 0x06392116, 0x023d2101, 0x063d2116,
+        0x02412101, 0x06412116, 0x025f2101, 0x065f2116, 0x02622101, 0x06622116,
+        0x02642101, 0x06642116, 0x02662101, 0x06662116, 0x02672101, 0x06672116,
+        0x02682101, 0x06682116, 0x026c2101, 0x066c2116, 0x026d2101, 0x066d2116,
+        0x026e2101, 0x066e2116, 0x02702101, 0x06702116, 0x02722101, 0x06722116,
+        0x02752101, 0x06752116, 0x063a2100, 0x06422100, 0x06432100, 0x06442100,
+        0x06452100, 0x06462100, 0x06472100, 0x06482100, 0x06492100, 0x064a2100,
+        0x064b2100, 0x064c2100, 0x064d2100, 0x064e2100, 0x064f2100, 0x06502100,
+        0x06512100, 0x06522100, 0x06532100, 0x06542100, 0x06552100, 0x06562100,
+        0x06572100, 0x06592100, 0x066a2100, 0x066b2100, 0x06712100, 0x06762100,
+        0x06772100, 0x06782100, 0x06792100, 0x067a2100, 0x01002146, 0x01002147,
+        0x01002149, 0x0500214a, 0x02302202, 0x02302209, 0x02302217, 0x06302228,
+        0x02312202, 0x02312209, 0x02312217, 0x06312228, 0x02322202, 0x02322209,
+        0x02322217, 0x06322228, 0x02612202, 0x02612209, 0x02612217, 0x06612228,
+        0x02632202, 0x02632209, 0x02632217, 0x06632228, 0x02652202, 0x02652209,
+        0x02652217, 0x06652228, 0x02692202, 0x02692209, 0x02692217, 0x06692228,
+        0x026f2202, 0x026f2209, 0x026f2217, 0x066f2228, 0x02732202, 0x02732209,
+        0x02732217, 0x06732228, 0x02742202, 0x02742209, 0x02742217, 0x06742228,
+        0x02202201, 0x06202216, 0x02252201, 0x06252216, 0x022d2201, 0x062d2216,
+        0x022e2201, 0x062e2216, 0x022f2201, 0x062f2216, 0x02332201, 0x06332216,
+        0x02342201, 0x06342216, 0x02352201, 0x06352216, 0x02362201, 0x06362216,
+        0x02372201, 0x06372216, 0x02382201, 0x06382216, 0x02392201, 0x06392216,
+        0x023d2201, 0x063d2216, 0x02412201, 0x06412216, 0x025f2201, 0x065f2216,
+        0x02622201, 0x06622216, 0x02642201, 0x06642216, 0x02662201, 0x06662216,
+        0x02672201, 0x06672216, 0x02682201, 0x06682216, 0x026c2201, 0x066c2216,
+        0x026d2201, 0x066d2216, 0x026e2201, 0x066e2216, 0x02702201, 0x06702216,
+        0x02722201, 0x06722216, 0x02752201, 0x06752216, 0x063a2200, 0x06422200,
+        0x06432200, 0x06442200, 0x06452200, 0x06462200, 0x06472200, 0x06482200,
+        0x06492200, 0x064a2200, 0x064b2200, 0x064c2200, 0x064d2200, 0x064e2200,
+        0x064f2200, 0x06502200, 0x06512200, 0x06522200, 0x06532200, 0x06542200,
+        0x06552200, 0x06562200, 0x06572200, 0x06592200, 0x066a2200, 0x066b2200,
+        0x06712200, 0x06762200, 0x06772200, 0x06782200, 0x06792200, 0x067a2200,
+        0x01002246, 0x01002247, 0x01002249, 0x0500224a
+    },
+    /* 77 */
+    {
+        0x02302802, 0x02302809, 0x02302817, 0x06302828, 0x02312802, 0x02312809,
+        0x02312817, 0x06312828, 0x02322802, 0x02322809, 0x02322817, 0x06322828,
+        0x02612802, 0x02612809, 0x02612817, 0x06612828, 0x02632802, 0x02632809,
+        0x02632817, 0x06632828, 0x02652802, 0x02652809, 0x02652817, 0x06652828,
+        0x02692802, 0x02692809, 0x02692817, 0x06692828, 0x026f2802, 0x026f2809,
+        0x026f2817, 0x066f2828, 0x02732802, 0x02732809, 0x02732817, 0x06732828,
+        0x02742802, 0x02742809, 0x02742817, 0x06742828, 0x02202801, 0x06202816,
+        0x02252801, 0x06252816, 0x022d2801, 0x062d2816, 0x022e2801, 0x062e2816,
+        0x022f2801, 0x062f2816, 0x02332801, 0x06332816, 0x02342801, 0x06342816,
+        0x02352801, 0x06352816, 0x02362801, 0x06362816, 0x02372801, 0x06372816,
+        0x02382801, 0x06382816, 0x02392801, 0x06392816, 0x023d2801, 0x063d2816,
+        0x02412801, 0x06412816, 0x025f2801, 0x065f2816, 0x02622801, 0x06622816,
+        0x02642801, 0x06642816, 0x02662801, 0x06662816, 0x02672801, 0x06672816,
+        0x02682801, 0x06682816, 0x026c2801, 0x066c2816, 0x026d2801, 0x066d2816,
+        0x026e2801, 0x066e2816, 0x02702801, 0x06702816, 0x02722801, 0x06722816,
+        0x02752801, 0x06752816, 0x063a2800, 0x06422800, 0x06432800, 0x06442800,
+        0x06452800, 0x06462800, 0x06472800, 0x06482800, 0x06492800, 0x064a2800,
+        0x064b2800, 0x064c2800, 0x064d2800, 0x064e2800, 0x064f2800, 0x06502800,
+        0x06512800, 0x06522800, 0x06532800, 0x06542800, 0x06552800, 0x06562800,
+        0x06572800, 0x06592800, 0x066a2800, 0x066b2800, 0x06712800, 0x06762800,
+        0x06772800, 0x06782800, 0x06792800, 0x067a2800, 0x01002846, 0x01002847,
+        0x01002849, 0x0500284a, 0x02302902, 0x02302909, 0x02302917, 0x06302928,
+        0x02312902, 0x02312909, 0x02312917, 0x06312928, 0x02322902, 0x02322909,
+        0x02322917, 0x06322928, 0x02612902, 0x02612909, 0x02612917, 0x06612928,
+        0x02632902, 0x02632909, 0x02632917, 0x06632928, 0x02652902, 0x02652909,
+        0x02652917, 0x06652928, 0x02692902, 0x02692909, 0x02692917, 0x06692928,
+        0x026f2902, 0x026f2909, 0x026f2917, 0x066f2928, 0x02732902, 0x02732909,
+        0x02732917, 0x06732928, 0x02742902, 0x02742909, 0x02742917, 0x06742928,
+        0x02202901, 0x06202916, 0x02252901, 0x06252916, 0x022d2901, 0x062d2916,
+        0x022e2901, 0x062e2916, 0x022f2901, 0x062f2916, 0x02332901, 0x06332916,
+        0x02342901, 0x06342916, 0x02352901, 0x06352916, 0x02362901, 0x06362916,
+        0x02372901, 0x06372916, 0x02382901, 0x06382916, 0x02392901, 0x06392916,
+        0x023d2901, 0x063d2916, 0x02412901, 0x06412916, 0x025f2901, 0x065f2916,
+        0x02622901, 0x06622916, 0x02642901, 0x06642916, 0x02662901, 0x06662916,
+        0x02672901, 0x06672916, 0x02682901, 0x06682916, 0x026c2901, 0x066c2916,
+        0x026d2901, 0x066d2916, 0x026e2901, 0x066e2916, 0x02702901, 0x06702916,
+        0x02722901, 0x06722916, 0x02752901, 0x06752916, 0x063a2900, 0x06422900,
+        0x06432900, 0x06442900, 0x06452900, 0x06462900, 0x06472900, 0x06482900,
+        0x06492900, 0x064a2900, 0x064b2900, 0x064c2900, 0x064d2900, 0x064e2900,
+        0x064f2900, 0x06502900, 0x06512900, 0x06522900, 0x06532900, 0x06542900,
+        0x06552900, 0x06562900, 0x06572900, 0x06592900, 0x066a2900, 0x066b2900,
+        0x06712900, 0x06762900, 0x06772900, 0x06782900, 0x06792900, 0x067a2900,
+        0x01002946, 0x01002947, 0x01002949, 0x0500294a
+    },
+    /* 78 */
+    {
+        0x02303f01, 0x06303f16, 0x02313f01, 0x06313f16, 0x02323f01, 0x06323f16,
+        0x02613f01, 0x06613f16, 0x02633f01, 0x06633f16, 0x02653f01, 0x06653f16,
+        0x02693f01, 0x06693f16, 0x026f3f01, 0x066f3f16, 0x02733f01, 0x06733f16,
+        0x02743f01, 0x06743f16, 0x06203f00, 0x06253f00, 0x062d3f00, 0x062e3f00,
+        0x062f3f00, 0x06333f00, 0x06343f00, 0x06353f00, 0x06363f00, 0x06373f00,
+        0x06383f00, 0x06393f00, 0x063d3f00, 0x06413f00, 0x065f3f00, 0x06623f00,
+        0x06643f00, 0x06663f00, 0x06673f00, 0x06683f00, 0x066c3f00, 0x066d3f00,
+        0x066e3f00, 0x06703f00, 0x06723f00, 0x06753f00, 0x01003f26, 0x01003f27,
+        0x01003f2c, 0x01003f2d, 0x01003f2f, 0x01003f30, 0x01003f33, 0x01003f34,
+        0x01003f36, 0x01003f37, 0x01003f3b, 0x01003f3c, 0x01003f3e, 0x01003f3f,
+        0x01003f42, 0x01003f43, 0x01003f45, 0x05003f48, 0x06302700, 0x06312700,
+        0x06322700, 0x06612700, 0x06632700, 0x06652700, 0x06692700, 0x066f2700,
+        0x06732700, 0x06742700, 0x0100270d, 0x0100270e, 0x01002711, 0x01002712,
+        0x01002714, 0x01002715, 0x0100271a, 0x0100271b, 0x0100271d, 0x0100271e,
+        0x01002721, 0x01002722, 0x01002724, 0x01002725, 0x0100272b, 0x0100272e,
+        0x01002732, 0x01002735, 0x0100273a, 0x0100273d, 0x01002741, 0x05002744,
+        0x06302b00, 0x06312b00, 0x06322b00, 0x06612b00, 0x06632b00, 0x06652b00,
+        0x06692b00, 0x066f2b00, 0x06732b00, 0x06742b00, 0x01002b0d, 0x01002b0e,
+        0x01002b11, 0x01002b12, 0x01002b14, 0x01002b15, 0x01002b1a, 0x01002b1b,
+        0x01002b1d, 0x01002b1e, 0x01002b21, 0x01002b22, 0x01002b24, 0x01002b25,
+        0x01002b2b, 0x01002b2e, 0x01002b32, 0x01002b35, 0x01002b3a, 0x01002b3d,
+        0x01002b41, 0x05002b44, 0x06307c00, 0x06317c00, 0x06327c00, 0x06617c00,
+        0x06637c00, 0x06657c00, 0x06697c00, 0x066f7c00, 0x06737c00, 0x06747c00,
+        0x01007c0d, 0x01007c0e, 0x01007c11, 0x01007c12, 0x01007c14, 0x01007c15,
+        0x01007c1a, 0x01007c1b, 0x01007c1d, 0x01007c1e, 0x01007c21, 0x01007c22,
+        0x01007c24, 0x01007c25, 0x01007c2b, 0x01007c2e, 0x01007c32, 0x01007c35,
+        0x01007c3a, 0x01007c3d, 0x01007c41, 0x05007c44, 0x01002304, 0x01002305,
+        0x01002307, 0x01002308, 0x0100230b, 0x0100230c, 0x01002310, 0x01002313,
+        0x01002319, 0x0100231c, 0x01002320, 0x01002323, 0x0100232a, 0x01002331,
+        0x01002339, 0x05002340, 0x01003e04, 0x01003e05, 0x01003e07, 0x01003e08,
+        0x01003e0b, 0x01003e0c, 0x01003e10, 0x01003e13, 0x01003e19, 0x01003e1c,
+        0x01003e20, 0x01003e23, 0x01003e2a, 0x01003e31, 0x01003e39, 0x05003e40,
+        0x01000003, 0x01000006, 0x0100000a, 0x0100000f, 0x01000018, 0x0100001f,
+        0x01000029, 0x05000038, 0x01002403, 0x01002406, 0x0100240a, 0x0100240f,
+        0x01002418, 0x0100241f, 0x01002429, 0x05002438, 0x01004003, 0x01004006,
+        0x0100400a, 0x0100400f, 0x01004018, 0x0100401f, 0x01004029, 0x05004038,
+        0x01005b03, 0x01005b06, 0x01005b0a, 0x01005b0f, 0x01005b18, 0x01005b1f,
+        0x01005b29, 0x05005b38, 0x01005d03, 0x01005d06, 0x01005d0a, 0x01005d0f,
+        0x01005d18, 0x01005d1f, 0x01005d29, 0x05005d38, 0x01007e03, 0x01007e06,
+        0x01007e0a, 0x01007e0f, 0x01007e18, 0x01007e1f, 0x01007e29, 0x05007e38,
+        0x01005e02, 0x01005e09, 0x01005e17, 0x05005e28, 0x01007d02, 0x01007d09,
+        0x01007d17, 0x05007d28, 0x01003c01, 0x05003c16, 0x01006001, 0x05006016,
+        0x01007b01, 0x05007b16, 0x00000060, 0x0400006e
+    },
+    /* 79 */
+    {
+        0x02303f02, 0x02303f09, 0x02303f17, 0x06303f28, 0x02313f02, 0x02313f09,
+        0x02313f17, 0x06313f28, 0x02323f02, 0x02323f09, 0x02323f17, 0x06323f28,
+        0x02613f02, 0x02613f09, 0x02613f17, 0x06613f28, 0x02633f02, 0x02633f09,
+        0x02633f17, 0x06633f28, 0x02653f02, 0x02653f09, 0x02653f17, 0x06653f28,
+        0x02693f02, 0x02693f09, 0x02693f17, 0x06693f28, 0x026f3f02, 0x026f3f09,
+        0x026f3f17, 0x066f3f28, 0x02733f02, 0x02733f09, 0x02733f17, 0x06733f28,
+        0x02743f02, 0x02743f09, 0x02743f17, 0x06743f28, 0x02203f01, 0x06203f16,
+        0x02253f01, 0x06253f16, 0x022d3f01, 0x062d3f16, 0x022e3f01, 0x062e3f16,
+        0x022f3f01, 0x062f3f16, 0x02333f01, 0x06333f16, 0x02343f01, 0x06343f16,
+        0x02353f01, 0x06353f16, 0x02363f01, 0x06363f16, 0x02373f01, 0x06373f16,
+        0x02383f01, 0x06383f16, 0x02393f01, 0x06393f16, 0x023d3f01, 0x063d3f16,
+        0x02413f01, 0x06413f16, 0x025f3f01, 0x065f3f16, 0x02623f01, 0x06623f16,
+        0x02643f01, 0x06643f16, 0x02663f01, 0x06663f16, 0x02673f01, 0x06673f16,
+        0x02683f01, 0x06683f16, 0x026c3f01, 0x066c3f16, 0x026d3f01, 0x066d3f16,
+        0x026e3f01, 0x066e3f16, 0x02703f01, 0x06703f16, 0x02723f01, 0x06723f16,
+        0x02753f01, 0x06753f16, 0x063a3f00, 0x06423f00, 0x06433f00, 0x06443f00,
+        0x06453f00, 0x06463f00, 0x06473f00, 0x06483f00, 0x06493f00, 0x064a3f00,
+        0x064b3f00, 0x064c3f00, 0x064d3f00, 0x064e3f00, 0x064f3f00, 0x06503f00,
+        0x06513f00, 0x06523f00, 0x06533f00, 0x06543f00, 0x06553f00, 0x06563f00,
+        0x06573f00, 0x06593f00, 0x066a3f00, 0x066b3f00, 0x06713f00, 0x06763f00,
+        0x06773f00, 0x06783f00, 0x06793f00, 0x067a3f00, 0x01003f46, 0x01003f47,
+        0x01003f49, 0x05003f4a, 0x02302701, 0x06302716, 0x02312701, 0x06312716,
+        0x02322701, 0x06322716, 0x02612701, 0x06612716, 0x02632701, 0x06632716,
+        0x02652701, 0x06652716, 0x02692701, 0x06692716, 0x026f2701, 0x066f2716,
+        0x02732701, 0x06732716, 0x02742701, 0x06742716, 0x06202700, 0x06252700,
+        0x062d2700, 0x062e2700, 0x062f2700, 0x06332700, 0x06342700, 0x06352700,
+        0x06362700, 0x06372700, 0x06382700, 0x06392700, 0x063d2700, 0x06412700,
+        0x065f2700, 0x06622700, 0x06642700, 0x06662700, 0x06672700, 0x06682700,
+        0x066c2700, 0x066d2700, 0x066e2700, 0x06702700, 0x06722700, 0x06752700,
+        0x01002726, 0x01002727, 0x0100272c, 0x0100272d, 0x0100272f, 0x01002730,
+        0x01002733, 0x01002734, 0x01002736, 0x01002737, 0x0100273b, 0x0100273c,
+        0x0100273e, 0x0100273f, 0x01002742, 0x01002743, 0x01002745, 0x05002748,
+        0x02302b01, 0x06302b16, 0x02312b01, 0x06312b16, 0x02322b01, 0x06322b16,
+        0x02612b01, 0x06612b16, 0x02632b01, 0x06632b16, 0x02652b01, 0x06652b16,
+        0x02692b01, 0x06692b16, 0x026f2b01, 0x066f2b16, 0x02732b01, 0x06732b16,
+        0x02742b01, 0x06742b16, 0x06202b00, 0x06252b00, 0x062d2b00, 0x062e2b00,
+        0x062f2b00, 0x06332b00, 0x06342b00, 0x06352b00, 0x06362b00, 0x06372b00,
+        0x06382b00, 0x06392b00, 0x063d2b00, 0x06412b00, 0x065f2b00, 0x06622b00,
+        0x06642b00, 0x06662b00, 0x06672b00, 0x06682b00, 0x066c2b00, 0x066d2b00,
+        0x066e2b00, 0x06702b00, 0x06722b00, 0x06752b00, 0x01002b26, 0x01002b27,
+        0x01002b2c, 0x01002b2d, 0x01002b2f, 0x01002b30, 0x01002b33, 0x01002b34,
+        0x01002b36, 0x01002b37, 0x01002b3b, 0x01002b3c, 0x01002b3e, 0x01002b3f,
+        0x01002b42, 0x01002b43, 0x01002b45, 0x05002b48
+    },
+    /* 80 */
+    {
+        0x02302702, 0x02302709, 0x02302717, 0x06302728, 0x02312702, 0x02312709,
+        0x02312717, 0x06312728, 0x02322702, 0x02322709, 0x02322717, 0x06322728,
+        0x02612702, 0x02612709, 0x02612717, 0x06612728, 0x02632702, 0x02632709,
+        0x02632717, 0x06632728, 0x02652702, 0x02652709, 0x02652717, 0x06652728,
+        0x02692702, 0x02692709, 0x02692717, 0x06692728, 0x026f2702, 0x026f2709,
+        0x026f2717, 0x066f2728, 0x02732702, 0x02732709, 0x02732717, 0x06732728,
+        0x02742702, 0x02742709, 0x02742717, 0x06742728, 0x02202701, 0x06202716,
+        0x02252701, 0x06252716, 0x022d2701, 0x062d2716, 0x022e2701, 0x062e2716,
+        0x022f2701, 0x062f2716, 0x02332701, 0x06332716, 0x02342701, 0x06342716,
+        0x02352701, 0x06352716, 0x02362701, 0x06362716, 0x02372701, 0x06372716,
+        0x02382701, 0x06382716, 0x02392701, 0x06392716, 0x023d2701, 0x063d2716,
+        0x02412701, 0x06412716, 0x025f2701, 0x065f2716, 0x02622701, 0x06622716,
+        0x02642701, 0x06642716, 0x02662701, 0x06662716, 0x02672701, 0x06672716,
+        0x02682701, 0x06682716, 0x026c2701, 0x066c2716, 0x026d2701, 0x066d2716,
+        0x026e2701, 0x066e2716, 0x02702701, 0x06702716, 0x02722701, 0x06722716,
+        0x02752701, 0x06752716, 0x063a2700, 0x06422700, 0x06432700, 0x06442700,
+        0x06452700, 0x06462700, 0x06472700, 0x06482700, 0x06492700, 0x064a2700,
+        0x064b2700, 0x064c2700, 0x064d2700, 0x064e2700, 0x064f2700, 0x06502700,
+        0x06512700, 0x06522700, 0x06532700, 0x06542700, 0x06552700, 0x06562700,
+        0x06572700, 0x06592700, 0x066a2700, 0x066b2700, 0x06712700, 0x06762700,
+        0x06772700, 0x06782700, 0x06792700, 0x067a2700, 0x01002746, 0x01002747,
+        0x01002749, 0x0500274a, 0x02302b02, 0x02302b09, 0x02302b17, 0x06302b28,
+        0x02312b02, 0x02312b09, 0x02312b17, 0x06312b28, 0x02322b02, 0x02322b09,
+        0x02322b17, 0x06322b28, 0x02612b02, 0x02612b09, 0x02612b17, 0x06612b28,
+        0x02632b02, 0x02632b09, 0x02632b17, 0x06632b28, 0x02652b02, 0x02652b09,
+        0x02652b17, 0x06652b28, 0x02692b02, 0x02692b09, 0x02692b17, 0x06692b28,
+        0x026f2b02, 0x026f2b09, 0x026f2b17, 0x066f2b28, 0x02732b02, 0x02732b09,
+        0x02732b17, 0x06732b28, 0x02742b02, 0x02742b09, 0x02742b17, 0x06742b28,
+        0x02202b01, 0x06202b16, 0x02252b01, 0x06252b16, 0x022d2b01, 0x062d2b16,
+        0x022e2b01, 0x062e2b16, 0x022f2b01, 0x062f2b16, 0x02332b01, 0x06332b16,
+        0x02342b01, 0x06342b16, 0x02352b01, 0x06352b16, 0x02362b01, 0x06362b16,
+        0x02372b01, 0x06372b16, 0x02382b01, 0x06382b16, 0x02392b01, 0x06392b16,
+        0x023d2b01, 0x063d2b16, 0x02412b01, 0x06412b16, 0x025f2b01, 0x065f2b16,
+        0x02622b01, 0x06622b16, 0x02642b01, 0x06642b16, 0x02662b01, 0x06662b16,
+        0x02672b01, 0x06672b16, 0x02682b01, 0x06682b16, 0x026c2b01, 0x066c2b16,
+        0x026d2b01, 0x066d2b16, 0x026e2b01, 0x066e2b16, 0x02702b01, 0x06702b16,
+        0x02722b01, 0x06722b16, 0x02752b01, 0x06752b16, 0x063a2b00, 0x06422b00,
+        0x06432b00, 0x06442b00, 0x06452b00, 0x06462b00, 0x06472b00, 0x06482b00,
+        0x06492b00, 0x064a2b00, 0x064b2b00, 0x064c2b00, 0x064d2b00, 0x064e2b00,
+        0x064f2b00, 0x06502b00, 0x06512b00, 0x06522b00, 0x06532b00, 0x06542b00,
+        0x06552b00, 0x06562b00, 0x06572b00, 0x06592b00, 0x066a2b00, 0x066b2b00,
+        0x06712b00, 0x06762b00, 0x06772b00, 0x06782b00, 0x06792b00, 0x067a2b00,
+        0x01002b46, 0x01002b47, 0x01002b49, 0x05002b4a
+    },
+    /* 81 */
+    {
+        0x02307c01, 0x06307c16, 0x02317c01, 0x06317c16, 0x02327c01, 0x06327c16,
+        0x02617c01, 0x06617c16, 0x02637c01, 0x06637c16, 0x02657c01, 0x06657c16,
+        0x02697c01, 0x06697c16, 0x026f7c01, 0x066f7c16, 0x02737c01, 0x06737c16,
+        0x02747c01, 0x06747c16, 0x06207c00, 0x06257c00, 0x062d7c00, 0x062e7c00,
+        0x062f7c00, 0x06337c00, 0x06347c00, 0x06357c00, 0x06367c00, 0x06377c00,
+        0x06387c00, 0x06397c00, 0x063d7c00, 0x06417c00, 0x065f7c00, 0x06627c00,
+        0x06647c00, 0x06667c00, 0x06677c00, 0x06687c00, 0x066c7c00, 0x066d7c00,
+        0x066e7c00, 0x06707c00, 0x06727c00, 0x06757c00, 0x01007c26, 0x01007c27,
+        0x01007c2c, 0x01007c2d, 0x01007c2f, 0x01007c30, 0x01007c33, 0x01007c34,
+        0x01007c36, 0x01007c37, 0x01007c3b, 0x01007c3c, 0x01007c3e, 0x01007c3f,
+        0x01007c42, 0x01007c43, 0x01007c45, 0x05007c48, 0x06302300, 0x06312300,
+        0x06322300, 0x06612300, 0x06632300, 0x06652300, 0x06692300, 0x066f2300,
+        0x06732300, 0x06742300, 0x0100230d, 0x0100230e, 0x01002311, 0x01002312,
+        0x01002314, 0x01002315, 0x0100231a, 0x0100231b, 0x0100231d, 0x0100231e,
+        0x01002321, 0x01002322, 0x01002324, 0x01002325, 0x0100232b, 0x0100232e,
+        0x01002332, 0x01002335, 0x0100233a, 0x0100233d, 0x01002341, 0x05002344,
+        0x06303e00, 0x06313e00, 0x06323e00, 0x06613e00, 0x06633e00, 0x06653e00,
+        0x06693e00, 0x066f3e00, 0x06733e00, 0x06743e00, 0x01003e0d, 0x01003e0e,
+        0x01003e11, 0x01003e12, 0x01003e14, 0x01003e15, 0x01003e1a, 0x01003e1b,
+        0x01003e1d, 0x01003e1e, 0x01003e21, 0x01003e22, 0x01003e24, 0x01003e25,
+        0x01003e2b, 0x01003e2e, 0x01003e32, 0x01003e35, 0x01003e3a, 0x01003e3d,
+        0x01003e41, 0x05003e44, 0x01000004, 0x01000005, 0x01000007, 0x01000008,
+        0x0100000b, 0x0100000c, 0x01000010, 0x01000013, 0x01000019, 0x0100001c,
+        0x01000020, 0x01000023, 0x0100002a, 0x01000031, 0x01000039, 0x05000040,
+        0x01002404, 0x01002405, 0x01002407, 0x01002408, 0x0100240b, 0x0100240c,
+        0x01002410, 0x01002413, 0x01002419, 0x0100241c, 0x01002420, 0x01002423,
+        0x0100242a, 0x01002431, 0x01002439, 0x05002440, 0x01004004, 0x01004005,
+        0x01004007, 0x01004008, 0x0100400b, 0x0100400c, 0x01004010, 0x01004013,
+        0x01004019, 0x0100401c, 0x01004020, 0x01004023, 0x0100402a, 0x01004031,
+        0x01004039, 0x05004040, 0x01005b04, 0x01005b05, 0x01005b07, 0x01005b08,
+        0x01005b0b, 0x01005b0c, 0x01005b10, 0x01005b13, 0x01005b19, 0x01005b1c,
+        0x01005b20, 0x01005b23, 0x01005b2a, 0x01005b31, 0x01005b39, 0x05005b40,
+        0x01005d04, 0x01005d05, 0x01005d07, 0x01005d08, 0x01005d0b, 0x01005d0c,
+        0x01005d10, 0x01005d13, 0x01005d19, 0x01005d1c, 0x01005d20, 0x01005d23,
+        0x01005d2a, 0x01005d31, 0x01005d39, 0x05005d40, 0x01007e04, 0x01007e05,
+        0x01007e07, 0x01007e08, 0x01007e0b, 0x01007e0c, 0x01007e10, 0x01007e13,
+        0x01007e19, 0x01007e1c, 0x01007e20, 0x01007e23, 0x01007e2a, 0x01007e31,
+        0x01007e39, 0x05007e40, 0x01005e03, 0x01005e06, 0x01005e0a, 0x01005e0f,
+        0x01005e18, 0x01005e1f, 0x01005e29, 0x05005e38, 0x01007d03, 0x01007d06,
+        0x01007d0a, 0x01007d0f, 0x01007d18, 0x01007d1f, 0x01007d29, 0x05007d38,
+        0x01003c02, 0x01003c09, 0x01003c17, 0x05003c28, 0x01006002, 0x01006009,
+        0x01006017, 0x05006028, 0x01007b02, 0x01007b09, 0x01007b17, 0x05007b28,
+        0x00000061, 0x00000065, 0x0000006f, 0x04000085
+    },
+    /* 82 */
+    {
+        0x02307c02, 0x02307c09, 0x02307c17, 0x06307c28, 0x02317c02, 0x02317c09,
+        0x02317c17, 0x06317c28, 0x02327c02, 0x02327c09, 0x02327c17, 0x06327c28,
+        0x02617c02, 0x02617c09, 0x02617c17, 0x06617c28, 0x02637c02, 0x02637c09,
+        0x02637c17, 0x06637c28, 0x02657c02, 0x02657c09, 0x02657c17, 0x06657c28,
+        0x02697c02, 0x02697c09, 0x02697c17, 0x06697c28, 0x026f7c02, 0x026f7c09,
+        0x026f7c17, 0x066f7c28, 0x02737c02, 0x02737c09, 0x02737c17, 0x06737c28,
+        0x02747c02, 0x02747c09, 0x02747c17, 0x06747c28, 0x02207c01, 0x06207c16,
+        0x02257c01, 0x06257c16, 0x022d7c01, 0x062d7c16, 0x022e7c01, 0x062e7c16,
+        0x022f7c01, 0x062f7c16, 0x02337c01, 0x06337c16, 0x02347c01, 0x06347c16,
+        0x02357c01, 0x06357c16, 0x02367c01, 0x06367c16, 0x02377c01, 0x06377c16,
+        0x02387c01, 0x06387c16, 0x02397c01, 0x06397c16, 0x023d7c01, 0x063d7c16,
+        0x02417c01, 0x06417c16, 0x025f7c01, 0x065f7c16, 0x02627c01, 0x06627c16,
+        0x02647c01, 0x06647c16, 0x02667c01, 0x06667c16, 0x02677c01, 0x06677c16,
+        0x02687c01, 0x06687c16, 0x026c7c01, 0x066c7c16, 0x026d7c01, 0x066d7c16,
+        0x026e7c01, 0x066e7c16, 0x02707c01, 0x06707c16, 0x02727c01, 0x06727c16,
+        0x02757c01, 0x06757c16, 0x063a7c00, 0x06427c00, 0x06437c00, 0x06447c00,
+        0x06457c00, 0x06467c00, 0x06477c00, 0x06487c00, 0x06497c00, 0x064a7c00,
+        0x064b7c00, 0x064c7c00, 0x064d7c00, 0x064e7c00, 0x064f7c00, 0x06507c00,
+        0x06517c00, 0x06527c00, 0x06537c00, 0x06547c00, 0x06557c00, 0x06567c00,
+        0x06577c00, 0x06597c00, 0x066a7c00, 0x066b7c00, 0x06717c00, 0x06767c00,
+        0x06777c00, 0x06787c00, 0x06797c00, 0x067a7c00, 0x01007c46, 0x01007c47,
+        0x01007c49, 0x05007c4a, 0x02302301, 0x06302316, 0x02312301, 0x06312316,
+        0x02322301, 0x06322316, 0x02612301, 0x06612316, 0x02632301, 0x06632316,
+        0x02652301, 0x06652316, 0x02692301, 0x06692316, 0x026f2301, 0x066f2316,
+        0x02732301, 0x06732316, 0x02742301, 0x06742316, 0x06202300, 0x06252300,
+        0x062d2300, 0x062e2300, 0x062f2300, 0x06332300, 0x06342300, 0x06352300,
+        0x06362300, 0x06372300, 0x06382300, 0x06392300, 0x063d2300, 0x06412300,
+        0x065f2300, 0x06622300, 0x06642300, 0x06662300, 0x06672300, 0x06682300,
+        0x066c2300, 0x066d2300, 0x066e2300, 0x06702300, 0x06722300, 0x06752300,
+        0x01002326, 0x01002327, 0x0100232c, 0x0100232d, 0x0100232f, 0x01002330,
+        0x01002333, 0x01002334, 0x01002336, 0x01002337, 0x0100233b, 0x0100233c,
+        0x0100233e, 0x0100233f, 0x01002342, 0x01002343, 0x01002345, 0x05002348,
+        0x02303e01, 0x06303e16, 0x02313e01, 0x06313e16, 0x02323e01, 0x06323e16,
+        0x02613e01, 0x06613e16, 0x02633e01, 0x06633e16, 0x02653e01, 0x06653e16,
+        0x02693e01, 0x06693e16, 0x026f3e01, 0x066f3e16, 0x02733e01, 0x06733e16,
+        0x02743e01, 0x06743e16, 0x06203e00, 0x06253e00, 0x062d3e00, 0x062e3e00,
+        0x062f3e00, 0x06333e00, 0x06343e00, 0x06353e00, 0x06363e00, 0x06373e00,
+        0x06383e00, 0x06393e00, 0x063d3e00, 0x06413e00, 0x065f3e00, 0x06623e00,
+        0x06643e00, 0x06663e00, 0x06673e00, 0x06683e00, 0x066c3e00, 0x066d3e00,
+        0x066e3e00, 0x06703e00, 0x06723e00, 0x06753e00, 0x01003e26, 0x01003e27,
+        0x01003e2c, 0x01003e2d, 0x01003e2f, 0x01003e30, 0x01003e33, 0x01003e34,
+        0x01003e36, 0x01003e37, 0x01003e3b, 0x01003e3c, 0x01003e3e, 0x01003e3f,
+        0x01003e42, 0x01003e43, 0x01003e45, 0x05003e48
+    },
+    /* 83 */
+    {
+        0x02302302, 0x02302309, 0x02302317, 0x06302328, 0x02312302, 0x02312309,
+        0x02312317, 0x06312328, 0x02322302, 0x02322309, 0x02322317, 0x06322328,
+        0x02612302, 0x02612309, 0x02612317, 0x06612328, 0x02632302, 0x02632309,
+        0x02632317, 0x06632328, 0x02652302, 0x02652309, 0x02652317, 0x06652328,
+        0x02692302, 0x02692309, 0x02692317, 0x06692328, 0x026f2302, 0x026f2309,
+        0x026f2317, 0x066f2328, 0x02732302, 0x02732309, 0x02732317, 0x06732328,
+        0x02742302, 0x02742309, 0x02742317, 0x06742328, 0x02202301, 0x06202316,
+        0x02252301, 0x06252316, 0x022d2301, 0x062d2316, 0x022e2301, 0x062e2316,
+        0x022f2301, 0x062f2316, 0x02332301, 0x06332316, 0x02342301, 0x06342316,
+        0x02352301, 0x06352316, 0x02362301, 0x06362316, 0x02372301, 0x06372316,
+        0x02382301, 0x06382316, 0x02392301, 0x06392316, 0x023d2301, 0x063d2316,
+        0x02412301, 0x06412316, 0x025f2301, 0x065f2316, 0x02622301, 0x06622316,
+        0x02642301, 0x06642316, 0x02662301, 0x06662316, 0x02672301, 0x06672316,
+        0x02682301, 0x06682316, 0x026c2301, 0x066c2316, 0x026d2301, 0x066d2316,
+        0x026e2301, 0x066e2316, 0x02702301, 0x06702316, 0x02722301, 0x06722316,
+        0x02752301, 0x06752316, 0x063a2300, 0x06422300, 0x06432300, 0x06442300,
+        0x06452300, 0x06462300, 0x06472300, 0x06482300, 0x06492300, 0x064a2300,
+        0x064b2300, 0x064c2300, 0x064d2300, 0x064e2300, 0x064f2300, 0x06502300,
+        0x06512300, 0x06522300, 0x06532300, 0x06542300, 0x06552300, 0x06562300,
+        0x06572300, 0x06592300, 0x066a2300, 0x066b2300, 0x06712300, 0x06762300,
+        0x06772300, 0x06782300, 0x06792300, 0x067a2300, 0x01002346, 0x01002347,
+        0x01002349, 0x0500234a, 0x02303e02, 0x02303e09, 0x02303e17, 0x06303e28,
+        0x02313e02, 0x02313e09, 0x02313e17, 0x06313e28, 0x02323e02, 0x02323e09,
+        0x02323e17, 0x06323e28, 0x02613e02, 0x02613e09, 0x02613e17, 0x06613e28,
+        0x02633e02, 0x02633e09, 0x02633e17, 0x06633e28, 0x02653e02, 0x02653e09,
+        0x02653e17, 0x06653e28, 0x02693e02, 0x02693e09, 0x02693e17, 0x06693e28,
+        0x026f3e02, 0x026f3e09, 0x026f3e17, 0x066f3e28, 0x02733e02, 0x02733e09,
+        0x02733e17, 0x06733e28, 0x02743e02, 0x02743e09, 0x02743e17, 0x06743e28,
+        0x02203e01, 0x06203e16, 0x02253e01, 0x06253e16, 0x022d3e01, 0x062d3e16,
+        0x022e3e01, 0x062e3e16, 0x022f3e01, 0x062f3e16, 0x02333e01, 0x06333e16,
+        0x02343e01, 0x06343e16, 0x02353e01, 0x06353e16, 0x02363e01, 0x06363e16,
+        0x02373e01, 0x06373e16, 0x02383e01, 0x06383e16, 0x02393e01, 0x06393e16,
+        0x023d3e01, 0x063d3e16, 0x02413e01, 0x06413e16, 0x025f3e01, 0x065f3e16,
+        0x02623e01, 0x06623e16, 0x02643e01, 0x06643e16, 0x02663e01, 0x06663e16,
+        0x02673e01, 0x06673e16, 0x02683e01, 0x06683e16, 0x026c3e01, 0x066c3e16,
+        0x026d3e01, 0x066d3e16, 0x026e3e01, 0x066e3e16, 0x02703e01, 0x06703e16,
+        0x02723e01, 0x06723e16, 0x02753e01, 0x06753e16, 0x063a3e00, 0x06423e00,
+        0x06433e00, 0x06443e00, 0x06453e00, 0x06463e00, 0x06473e00, 0x06483e00,
+        0x06493e00, 0x064a3e00, 0x064b3e00, 0x064c3e00, 0x064d3e00, 0x064e3e00,
+        0x064f3e00, 0x06503e00, 0x06513e00, 0x06523e00, 0x06533e00, 0x06543e00,
+        0x06553e00, 0x06563e00, 0x06573e00, 0x06593e00, 0x066a3e00, 0x066b3e00,
+        0x06713e00, 0x06763e00, 0x06773e00, 0x06783e00, 0x06793e00, 0x067a3e00,
+        0x01003e46, 0x01003e47, 0x01003e49, 0x05003e4a
+    },
+    /* 84 */
+    {
+        0x06300000, 0x06310000, 0x06320000, 0x06610000, 0x06630000, 0x06650000,
+        0x06690000, 0x066f0000, 0x06730000, 0x06740000, 0x0100000d, 0x0100000e,
+        0x01000011, 0x01000012, 0x01000014, 0x01000015, 0x0100001a, 0x0100001b,
+        0x0100001d, 0x0100001e, 0x01000021, 0x01000022, 0x01000024, 0x01000025,
+        0x0100002b, 0x0100002e, 0x01000032, 0x01000035, 0x0100003a, 0x0100003d,
+        0x01000041, 0x05000044, 0x06302400, 0x06312400, 0x06322400, 0x06612400,
+        0x06632400, 0x06652400, 0x06692400, 0x066f2400, 0x06732400, 0x06742400,
+        0x0100240d, 0x0100240e, 0x01002411, 0x01002412, 0x01002414, 0x01002415,
+        0x0100241a, 0x0100241b, 0x0100241d, 0x0100241e, 0x01002421, 0x01002422,
+        0x01002424, 0x01002425, 0x0100242b, 0x0100242e, 0x01002432, 0x01002435,
+        0x0100243a, 0x0100243d, 0x01002441, 0x05002444, 0x06304000, 0x06314000,
+        0x06324000, 0x06614000, 0x06634000, 0x06654000, 0x06694000, 0x066f4000,
+        0x06734000, 0x06744000, 0x0100400d, 0x0100400e, 0x01004011, 0x01004012,
+        0x01004014, 0x01004015, 0x0100401a, 0x0100401b, 0x0100401d, 0x0100401e,
+        0x01004021, 0x01004022, 0x01004024, 0x01004025, 0x0100402b, 0x0100402e,
+        0x01004032, 0x01004035, 0x0100403a, 0x0100403d, 0x01004041, 0x05004044,
+        0x06305b00, 0x06315b00, 0x06325b00, 0x06615b00, 0x06635b00, 0x06655b00,
+        0x06695b00, 0x066f5b00, 0x06735b00, 0x06745b00, 0x01005b0d, 0x01005b0e,
+        0x01005b11, 0x01005b12, 0x01005b14, 0x01005b15, 0x01005b1a, 0x01005b1b,
+        0x01005b1d, 0x01005b1e, 0x01005b21, 0x01005b22, 0x01005b24, 0x01005b25,
+        0x01005b2b, 0x01005b2e, 0x01005b32, 0x01005b35, 0x01005b3a, 0x01005b3d,
+        0x01005b41, 0x05005b44, 0x06305d00, 0x06315d00, 0x06325d00, 0x06615d00,
+        0x06635d00, 0x06655d00, 0x06695d00, 0x066f5d00, 0x06735d00, 0x06745d00,
+        0x01005d0d, 0x01005d0e, 0x01005d11, 0x01005d12, 0x01005d14, 0x01005d15,
+        0x01005d1a, 0x01005d1b, 0x01005d1d, 0x01005d1e, 0x01005d21, 0x01005d22,
+        0x01005d24, 0x01005d25, 0x01005d2b, 0x01005d2e, 0x01005d32, 0x01005d35,
+        0x01005d3a, 0x01005d3d, 0x01005d41, 0x05005d44, 0x06307e00, 0x06317e00,
+        0x06327e00, 0x06617e00, 0x06637e00, 0x06657e00, 0x06697e00, 0x066f7e00,
+        0x06737e00, 0x06747e00, 0x01007e0d, 0x01007e0e, 0x01007e11, 0x01007e12,
+        0x01007e14, 0x01007e15, 0x01007e1a, 0x01007e1b, 0x01007e1d, 0x01007e1e,
+        0x01007e21, 0x01007e22, 0x01007e24, 0x01007e25, 0x01007e2b, 0x01007e2e,
+        0x01007e32, 0x01007e35, 0x01007e3a, 0x01007e3d, 0x01007e41, 0x05007e44,
+        0x01005e04, 0x01005e05, 0x01005e07, 0x01005e08, 0x01005e0b, 0x01005e0c,
+        0x01005e10, 0x01005e13, 0x01005e19, 0x01005e1c, 0x01005e20, 0x01005e23,
+        0x01005e2a, 0x01005e31, 0x01005e39, 0x05005e40, 0x01007d04, 0x01007d05,
+        0x01007d07, 0x01007d08, 0x01007d0b, 0x01007d0c, 0x01007d10, 0x01007d13,
+        0x01007d19, 0x01007d1c, 0x01007d20, 0x01007d23, 0x01007d2a, 0x01007d31,
+        0x01007d39, 0x05007d40, 0x01003c03, 0x01003c06, 0x01003c0a, 0x01003c0f,
+        0x01003c18, 0x01003c1f, 0x01003c29, 0x05003c38, 0x01006003, 0x01006006,
+        0x0100600a, 0x0100600f, 0x01006018, 0x0100601f, 0x01006029, 0x05006038,
+        0x01007b03, 0x01007b06, 0x01007b0a, 0x01007b0f, 0x01007b18, 0x01007b1f,
+        0x01007b29, 0x05007b38, 0x00000062, 0x00000063, 0x00000066, 0x00000069,
+        0x00000070, 0x00000077, 0x00000086, 0x04000099
+    },
+    /* 85 */
+    {
+        0x02300001, 0x06300016, 0x02310001, 0x06310016, 0x02320001, 0x06320016,
+        0x02610001, 0x06610016, 0x02630001, 0x06630016, 0x02650001, 0x06650016,
+        0x02690001, 0x06690016, 0x026f0001, 0x066f0016, 0x02730001, 0x06730016,
+        0x02740001, 0x06740016, 0x06200000, 0x06250000, 0x062d0000, 0x062e0000,
+        0x062f0000, 0x06330000, 0x06340000, 0x06350000, 0x06360000, 0x06370000,
+        0x06380000, 0x06390000, 0x063d0000, 0x06410000, 0x065f0000, 0x06620000,
+        0x06640000, 0x06660000, 0x06670000, 0x06680000, 0x066c0000, 0x066d0000,
+        0x066e0000, 0x06700000, 0x06720000, 0x06750000, 0x01000026, 0x01000027,
+        0x0100002c, 0x0100002d, 0x0100002f, 0x01000030, 0x01000033, 0x01000034,
+        0x01000036, 0x01000037, 0x0100003b, 0x0100003c, 0x0100003e, 0x0100003f,
+        0x01000042, 0x01000043, 0x01000045, 0x05000048, 0x02302401, 0x06302416,
+        0x02312401, 0x06312416, 0x02322401, 0x06322416, 0x02612401, 0x06612416,
+        0x02632401, 0x06632416, 0x02652401, 0x06652416, 0x02692401, 0x06692416,
+        0x026f2401, 0x066f2416, 0x02732401, 0x06732416, 0x02742401, 0x06742416,
+        0x06202400, 0x06252400, 0x062d2400, 0x062e2400, 0x062f2400, 0x06332400,
+        0x06342400, 0x06352400, 0x06362400, 0x06372400, 0x06382400, 0x06392400,
+        0x063d2400, 0x06412400, 0x065f2400, 0x06622400, 0x06642400, 0x06662400,
+        0x06672400, 0x06682400, 0x066c2400, 0x066d2400, 0x066e2400, 0x06702400,
+        0x06722400, 0x06752400, 0x01002426, 0x01002427, 0x0100242c, 0x0100242d,
+        0x0100242f, 0x01002430, 0x01002433, 0x01002434, 0x01002436, 0x01002437,
+        0x0100243b, 0x0100243c, 0x0100243e, 0x0100243f, 0x01002442, 0x01002443,
+        0x01002445, 0x05002448, 0x02304001, 0x06304016, 0x02314001, 0x06314016,
+        0x02324001, 0x06324016, 0x02614001, 0x06614016, 0x02634001, 0x06634016,
+        0x02654001, 0x06654016, 0x02694001, 0x06694016, 0x026f4001, 0x066f4016,
+        0x02734001, 0x06734016, 0x02744001, 0x06744016, 0x06204000, 0x06254000,
+        0x062d4000, 0x062e4000, 0x062f4000, 0x06334000, 0x06344000, 0x06354000,
+        0x06364000, 0x06374000, 0x06384000, 0x06394000, 0x063d4000, 0x06414000,
+        0x065f4000, 0x06624000, 0x06644000, 0x06664000, 0x06674000, 0x06684000,
+        0x066c4000, 0x066d4000, 0x066e4000, 0x06704000, 0x06724000, 0x06754000,
+        0x01004026, 0x01004027, 0x0100402c, 0x0100402d, 0x0100402f, 0x01004030,
+        0x01004033, 0x01004034, 0x01004036, 0x01004037, 0x0100403b, 0x0100403c,
+        0x0100403e, 0x0100403f, 0x01004042, 0x01004043, 0x01004045, 0x05004048,
+        0x02305b01, 0x06305b16, 0x02315b01, 0x06315b16, 0x02325b01, 0x06325b16,
+        0x02615b01, 0x06615b16, 0x02635b01, 0x06635b16, 0x02655b01, 0x06655b16,
+        0x02695b01, 0x06695b16, 0x026f5b01, 0x066f5b16, 0x02735b01, 0x06735b16,
+        0x02745b01, 0x06745b16, 0x06205b00, 0x06255b00, 0x062d5b00, 0x062e5b00,
+        0x062f5b00, 0x06335b00, 0x06345b00, 0x06355b00, 0x06365b00, 0x06375b00,
+        0x06385b00, 0x06395b00, 0x063d5b00, 0x06415b00, 0x065f5b00, 0x06625b00,
+        0x06645b00, 0x06665b00, 0x06675b00, 0x06685b00, 0x066c5b00, 0x066d5b00,
+        0x066e5b00, 0x06705b00, 0x06725b00, 0x06755b00, 0x01005b26, 0x01005b27,
+        0x01005b2c, 0x01005b2d, 0x01005b2f, 0x01005b30, 0x01005b33, 0x01005b34,
+        0x01005b36, 0x01005b37, 0x01005b3b, 0x01005b3c, 0x01005b3e, 0x01005b3f,
+        0x01005b42, 0x01005b43, 0x01005b45, 0x05005b48
+    },
+    /* 86 */
+    {
+        0x02300002, 0x02300009, 0x02300017, 0x06300028, 0x02310002, 0x02310009,
+        0x02310017, 0x06310028, 0x02320002, 0x02320009, 0x02320017, 0x06320028,
+        0x02610002, 0x02610009, 0x02610017, 0x06610028, 0x02630002, 0x02630009,
+        0x02630017, 0x06630028, 0x02650002, 0x02650009, 0x02650017, 0x06650028,
+        0x02690002, 0x02690009, 0x02690017, 0x06690028, 0x026f0002, 0x026f0009,
+        0x026f0017, 0x066f0028, 0x02730002, 0x02730009, 0x02730017, 0x06730028,
+        0x02740002, 0x02740009, 0x02740017, 0x06740028, 0x02200001, 0x06200016,
+        0x02250001, 0x06250016, 0x022d0001, 0x062d0016, 0x022e0001, 0x062e0016,
+        0x022f0001, 0x062f0016, 0x02330001, 0x06330016, 0x02340001, 0x06340016,
+        0x02350001, 0x06350016, 0x02360001, 0x06360016, 0x02370001, 0x06370016,
+        0x02380001, 0x06380016, 0x02390001, 0x06390016, 0x023d0001, 0x063d0016,
+        0x02410001, 0x06410016, 0x025f0001, 0x065f0016, 0x02620001, 0x06620016,
+        0x02640001, 0x06640016, 0x02660001, 0x06660016, 0x02670001, 0x06670016,
+        0x02680001, 0x06680016, 0x026c0001, 0x066c0016, 0x026d0001, 0x066d0016,
+        0x026e0001, 0x066e0016, 0x02700001, 0x06700016, 0x02720001, 0x06720016,
+        0x02750001, 0x06750016, 0x063a0000, 0x06420000, 0x06430000, 0x06440000,
+        0x06450000, 0x06460000, 0x06470000, 0x06480000, 0x06490000, 0x064a0000,
+        0x064b0000, 0x064c0000, 0x064d0000, 0x064e0000, 0x064f0000, 0x06500000,
+        0x06510000, 0x06520000, 0x06530000, 0x06540000, 0x06550000, 0x06560000,
+        0x06570000, 0x06590000, 0x066a0000, 0x066b0000, 0x06710000, 0x06760000,
+        0x06770000, 0x06780000, 0x06790000, 0x067a0000, 0x01000046, 0x01000047,
+        0x01000049, 0x0500004a, 0x02302402, 0x02302409, 0x02302417, 0x06302428,
+        0x02312402, 0x02312409, 0x02312417, 0x06312428, 0x02322402, 0x02322409,
+        0x02322417, 0x06322428, 0x02612402, 0x02612409, 0x02612417, 0x06612428,
+        0x02632402, 0x02632409, 0x02632417, 0x06632428, 0x02652402, 0x02652409,
+        0x02652417, 0x06652428, 0x02692402, 0x02692409, 0x02692417, 0x06692428,
+        0x026f2402, 0x026f2409, 0x026f2417, 0x066f2428, 0x02732402, 0x02732409,
+        0x02732417, 0x06732428, 0x02742402, 0x02742409, 0x02742417, 0x06742428,
+        0x02202401, 0x06202416, 0x02252401, 0x06252416, 0x022d2401, 0x062d2416,
+        0x022e2401, 0x062e2416, 0x022f2401, 0x062f2416, 0x02332401, 0x06332416,
+        0x02342401, 0x06342416, 0x02352401, 0x06352416, 0x02362401, 0x06362416,
+        0x02372401, 0x06372416, 0x02382401, 0x06382416, 0x02392401, 0x06392416,
+        0x023d2401, 0x063d2416, 0x02412401, 0x06412416, 0x025f2401, 0x065f2416,
+        0x02622401, 0x06622416, 0x02642401, 0x06642416, 0x02662401, 0x06662416,
+        0x02672401, 0x06672416, 0x02682401, 0x06682416, 0x026c2401, 0x066c2416,
+        0x026d2401, 0x066d2416, 0x026e2401, 0x066e2416, 0x02702401, 0x06702416,
+        0x02722401, 0x06722416, 0x02752401, 0x06752416, 0x063a2400, 0x06422400,
+        0x06432400, 0x06442400, 0x06452400, 0x06462400, 0x06472400, 0x06482400,
+        0x06492400, 0x064a2400, 0x064b2400, 0x064c2400, 0x064d2400, 0x064e2400,
+        0x064f2400, 0x06502400, 0x06512400, 0x06522400, 0x06532400, 0x06542400,
+        0x06552400, 0x06562400, 0x06572400, 0x06592400, 0x066a2400, 0x066b2400,
+        0x06712400, 0x06762400, 0x06772400, 0x06782400, 0x06792400, 0x067a2400,
+        0x01002446, 0x01002447, 0x01002449, 0x0500244a
+    },
+    /* 87 */
+    {
+        0x02304002, 0x02304009, 0x02304017, 0x06304028, 0x02314002, 0x02314009,
+        0x02314017, 0x06314028, 0x02324002, 0x02324009, 0x02324017, 0x06324028,
+        0x02614002, 0x02614009, 0x02614017, 0x06614028, 0x02634002, 0x02634009,
+        0x02634017, 0x06634028, 0x02654002, 0x02654009, 0x02654017, 0x06654028,
+        0x02694002, 0x02694009, 0x02694017, 0x06694028, 0x026f4002, 0x026f4009,
+        0x026f4017, 0x066f4028, 0x02734002, 0x02734009, 0x02734017, 0x06734028,
+        0x02744002, 0x02744009, 0x02744017, 0x06744028, 0x02204001, 0x06204016,
+        0x02254001, 0x06254016, 0x022d4001, 0x062d4016, 0x022e4001, 0x062e4016,
+        0x022f4001, 0x062f4016, 0x02334001, 0x06334016, 0x02344001, 0x06344016,
+        0x02354001, 0x06354016, 0x02364001, 0x06364016, 0x02374001, 0x06374016,
+        0x02384001, 0x06384016, 0x02394001, 0x06394016, 0x023d4001, 0x063d4016,
+        0x02414001, 0x06414016, 0x025f4001, 0x065f4016, 0x02624001, 0x06624016,
+        0x02644001, 0x06644016, 0x02664001, 0x06664016, 0x02674001, 0x06674016,
+        0x02684001, 0x06684016, 0x026c4001, 0x066c4016, 0x026d4001, 0x066d4016,
+        0x026e4001, 0x066e4016, 0x02704001, 0x06704016, 0x02724001, 0x06724016,
+        0x02754001, 0x06754016, 0x063a4000, 0x06424000, 0x06434000, 0x06444000,
+        0x06454000, 0x06464000, 0x06474000, 0x06484000, 0x06494000, 0x064a4000,
+        0x064b4000, 0x064c4000, 0x064d4000, 0x064e4000, 0x064f4000, 0x06504000,
+        0x06514000, 0x06524000, 0x06534000, 0x06544000, 0x06554000, 0x06564000,
+        0x06574000, 0x06594000, 0x066a4000, 0x066b4000, 0x06714000, 0x06764000,
+        0x06774000, 0x06784000, 0x06794000, 0x067a4000, 0x01004046, 0x01004047,
+        0x01004049, 0x0500404a, 0x02305b02, 0x02305b09, 0x02305b17, 0x06305b28,
+        0x02315b02, 0x02315b09, 0x02315b17, 0x06315b28, 0x02325b02, 0x02325b09,
+        0x02325b17, 0x06325b28, 0x02615b02, 0x02615b09, 0x02615b17, 0x06615b28,
+        0x02635b02, 0x02635b09, 0x02635b17, 0x06635b28, 0x02655b02, 0x02655b09,
+        0x02655b17, 0x06655b28, 0x02695b02, 0x02695b09, 0x02695b17, 0x06695b28,
+        0x026f5b02, 0x026f5b09, 0x026f5b17, 0x066f5b28, 0x02735b02, 0x02735b09,
+        0x02735b17, 0x06735b28, 0x02745b02, 0x02745b09, 0x02745b17, 0x06745b28,
+        0x02205b01, 0x06205b16, 0x02255b01, 0x06255b16, 0x022d5b01, 0x062d5b16,
+        0x022e5b01, 0x062e5b16, 0x022f5b01, 0x062f5b16, 0x02335b01, 0x06335b16,
+        0x02345b01, 0x06345b16, 0x02355b01, 0x06355b16, 0x02365b01, 0x06365b16,
+        0x02375b01, 0x06375b16, 0x02385b01, 0x06385b16, 0x02395b01, 0x06395b16,
+        0x023d5b01, 0x063d5b16, 0x02415b01, 0x06415b16, 0x025f5b01, 0x065f5b16,
+        0x02625b01, 0x06625b16, 0x02645b01, 0x06645b16, 0x02665b01, 0x06665b16,
+        0x02675b01, 0x06675b16, 0x02685b01, 0x06685b16, 0x026c5b01, 0x066c5b16,
+        0x026d5b01, 0x066d5b16, 0x026e5b01, 0x066e5b16, 0x02705b01, 0x06705b16,
+        0x02725b01, 0x06725b16, 0x02755b01, 0x06755b16, 0x063a5b00, 0x06425b00,
+        0x06435b00, 0x06445b00, 0x06455b00, 0x06465b00, 0x06475b00, 0x06485b00,
+        0x06495b00, 0x064a5b00, 0x064b5b00, 0x064c5b00, 0x064d5b00, 0x064e5b00,
+        0x064f5b00, 0x06505b00, 0x06515b00, 0x06525b00, 0x06535b00, 0x06545b00,
+        0x06555b00, 0x06565b00, 0x06575b00, 0x06595b00, 0x066a5b00, 0x066b5b00,
+        0x06715b00, 0x06765b00, 0x06775b00, 0x06785b00, 0x06795b00, 0x067a5b00,
+        0x01005b46, 0x01005b47, 0x01005b49, 0x05005b4a
+    },
+    /* 88 */
+    {
+        0x02305d01, 0x06305d16, 0x02315d01, 0x06315d16, 0x02325d01, 0x06325d16,
+        0x02615d01, 0x06615d16, 0x02635d01, 0x06635d16, 0x02655d01, 0x06655d16,
+        0x02695d01, 0x06695d16, 0x026f5d01, 0x066f5d16, 0x02735d01, 0x06735d16,
+        0x02745d01, 0x06745d16, 0x06205d00, 0x06255d00, 0x062d5d00, 0x062e5d00,
+        0x062f5d00, 0x06335d00, 0x06345d00, 0x06355d00, 0x06365d00, 0x06375d00,
+        0x06385d00, 0x06395d00, 0x063d5d00, 0x06415d00, 0x065f5d00, 0x06625d00,
+        0x06645d00, 0x06665d00, 0x06675d00, 0x06685d00, 0x066c5d00, 0x066d5d00,
+        0x066e5d00, 0x06705d00, 0x06725d00, 0x06755d00, 0x01005d26, 0x01005d27,
+        0x01005d2c, 0x01005d2d, 0x01005d2f, 0x01005d30, 0x01005d33, 0x01005d34,
+        0x01005d36, 0x01005d37, 0x01005d3b, 0x01005d3c, 0x01005d3e, 0x01005d3f,
+        0x01005d42, 0x01005d43, 0x01005d45, 0x05005d48, 0x02307e01, 0x06307e16,
+        0x02317e01, 0x06317e16, 0x02327e01, 0x06327e16, 0x02617e01, 0x06617e16,
+        0x02637e01, 0x06637e16, 0x02657e01, 0x06657e16, 0x02697e01, 0x06697e16,
+        0x026f7e01, 0x066f7e16, 0x02737e01, 0x06737e16, 0x02747e01, 0x06747e16,
+        0x06207e00, 0x06257e00, 0x062d7e00, 0x062e7e00, 0x062f7e00, 0x06337e00,
+        0x06347e00, 0x06357e00, 0x06367e00, 0x06377e00, 0x06387e00, 0x06397e00,
+        0x063d7e00, 0x06417e00, 0x065f7e00, 0x06627e00, 0x06647e00, 0x06667e00,
+        0x06677e00, 0x06687e00, 0x066c7e00, 0x066d7e00, 0x066e7e00, 0x06707e00,
+        0x06727e00, 0x06757e00, 0x01007e26, 0x01007e27, 0x01007e2c, 0x01007e2d,
+        0x01007e2f, 0x01007e30, 0x01007e33, 0x01007e34, 0x01007e36, 0x01007e37,
+        0x01007e3b, 0x01007e3c, 0x01007e3e, 0x01007e3f, 0x01007e42, 0x01007e43,
+        0x01007e45, 0x05007e48, 0x06305e00, 0x06315e00, 0x06325e00, 0x06615e00,
+        0x06635e00, 0x06655e00, 0x06695e00, 0x066f5e00, 0x06735e00, 0x06745e00,
+        0x01005e0d, 0x01005e0e, 0x01005e11, 0x01005e12, 0x01005e14, 0x01005e15,
+        0x01005e1a, 0x01005e1b, 0x01005e1d, 0x01005e1e, 0x01005e21, 0x01005e22,
+        0x01005e24, 0x01005e25, 0x01005e2b, 0x01005e2e, 0x01005e32, 0x01005e35,
+        0x01005e3a, 0x01005e3d, 0x01005e41, 0x05005e44, 0x06307d00, 0x06317d00,
+        0x06327d00, 0x06617d00, 0x06637d00, 0x06657d00, 0x06697d00, 0x066f7d00,
+        0x06737d00, 0x06747d00, 0x01007d0d, 0x01007d0e, 0x01007d11, 0x01007d12,
+        0x01007d14, 0x01007d15, 0x01007d1a, 0x01007d1b, 0x01007d1d, 0x01007d1e,
+        0x01007d21, 0x01007d22, 0x01007d24, 0x01007d25, 0x01007d2b, 0x01007d2e,
+        0x01007d32, 0x01007d35, 0x01007d3a, 0x01007d3d, 0x01007d41, 0x05007d44,
+        0x01003c04, 0x01003c05, 0x01003c07, 0x01003c08, 0x01003c0b, 0x01003c0c,
+        0x01003c10, 0x01003c13, 0x01003c19, 0x01003c1c, 0x01003c20, 0x01003c23,
+        0x01003c2a, 0x01003c31, 0x01003c39, 0x05003c40, 0x01006004, 0x01006005,
+        0x01006007, 0x01006008, 0x0100600b, 0x0100600c, 0x01006010, 0x01006013,
+        0x01006019, 0x0100601c, 0x01006020, 0x01006023, 0x0100602a, 0x01006031,
+        0x01006039, 0x05006040, 0x01007b04, 0x01007b05, 0x01007b07, 0x01007b08,
+        0x01007b0b, 0x01007b0c, 0x01007b10, 0x01007b13, 0x01007b19, 0x01007b1c,
+        0x01007b20, 0x01007b23, 0x01007b2a, 0x01007b31, 0x01007b39, 0x05007b40,
+        0x05005c00, 0x0500c300, 0x0500d000, 0x00000064, 0x00000067, 0x00000068,
+        0x0000006a, 0x0000006b, 0x00000071, 0x00000074, 0x00000078, 0x0000007e,
+        0x00000087, 0x0000008e, 0x0000009a, 0x040000a9
+    },
+    /* 89 */
+    {
+        0x02305d02, 0x02305d09, 0x02305d17, 0x06305d28, 0x02315d02, 0x02315d09,
+        0x02315d17, 0x06315d28, 0x02325d02, 0x02325d09, 0x02325d17, 0x06325d28,
+        0x02615d02, 0x02615d09, 0x02615d17, 0x06615d28, 0x02635d02, 0x02635d09,
+        0x02635d17, 0x06635d28, 0x02655d02, 0x02655d09, 0x02655d17, 0x06655d28,
+        0x02695d02, 0x02695d09, 0x02695d17, 0x06695d28, 0x026f5d02, 0x026f5d09,
+        0x026f5d17, 0x066f5d28, 0x02735d02, 0x02735d09, 0x02735d17, 0x06735d28,
+        0x02745d02, 0x02745d09, 0x02745d17, 0x06745d28, 0x02205d01, 0x06205d16,
+        0x02255d01, 0x06255d16, 0x022d5d01, 0x062d5d16, 0x022e5d01, 0x062e5d16,
+        0x022f5d01, 0x062f5d16, 0x02335d01, 0x06335d16, 0x02345d01, 0x06345d16,
+        0x02355d01, 0x06355d16, 0x02365d01, 0x06365d16, 0x02375d01, 0x06375d16,
+        0x02385d01, 0x06385d16, 0x02395d01, 0x06395d16, 0x023d5d01, 0x063d5d16,
+        0x02415d01, 0x06415d16, 0x025f5d01, 0x065f5d16, 0x02625d01, 0x06625d16,
+        0x02645d01, 0x06645d16, 0x02665d01, 0x06665d16, 0x02675d01, 0x06675d16,
+        0x02685d01, 0x06685d16, 0x026c5d01, 0x066c5d16, 0x026d5d01, 0x066d5d16,
+        0x026e5d01, 0x066e5d16, 0x02705d01, 0x06705d16, 0x02725d01, 0x06725d16,
+        0x02755d01, 0x06755d16, 0x063a5d00, 0x06425d00, 0x06435d00, 0x06445d00,
+        0x06455d00, 0x06465d00, 0x06475d00, 0x06485d00, 0x06495d00, 0x064a5d00,
+        0x064b5d00, 0x064c5d00, 0x064d5d00, 0x064e5d00, 0x064f5d00, 0x06505d00,
+        0x06515d00, 0x06525d00, 0x06535d00, 0x06545d00, 0x06555d00, 0x06565d00,
+        0x06575d00, 0x06595d00, 0x066a5d00, 0x066b5d00, 0x06715d00, 0x06765d00,
+        0x06775d00, 0x06785d00, 0x06795d00, 0x067a5d00, 0x01005d46, 0x01005d47,
+        0x01005d49, 0x05005d4a, 0x02307e02, 0x02307e09, 0x02307e17, 0x06307e28,
+        0x02317e02, 0x02317e09, 0x02317e17, 0x06317e28, 0x02327e02, 0x02327e09,
+        0x02327e17, 0x06327e28, 0x02617e02, 0x02617e09, 0x02617e17, 0x06617e28,
+        0x02637e02, 0x02637e09, 0x02637e17, 0x06637e28, 0x02657e02, 0x02657e09,
+        0x02657e17, 0x06657e28, 0x02697e02, 0x02697e09, 0x02697e17, 0x06697e28,
+        0x026f7e02, 0x026f7e09, 0x026f7e17, 0x066f7e28, 0x02737e02, 0x02737e09,
+        0x02737e17, 0x06737e28, 0x02747e02, 0x02747e09, 0x02747e17, 0x06747e28,
+        0x02207e01, 0x06207e16, 0x02257e01, 0x06257e16, 0x022d7e01, 0x062d7e16,
+        0x022e7e01, 0x062e7e16, 0x022f7e01, 0x062f7e16, 0x02337e01, 0x06337e16,
+        0x02347e01, 0x06347e16, 0x02357e01, 0x06357e16, 0x02367e01, 0x06367e16,
+        0x02377e01, 0x06377e16, 0x02387e01, 0x06387e16, 0x02397e01, 0x06397e16,
+        0x023d7e01, 0x063d7e16, 0x02417e01, 0x06417e16, 0x025f7e01, 0x065f7e16,
+        0x02627e01, 0x06627e16, 0x02647e01, 0x06647e16, 0x02667e01, 0x06667e16,
+        0x02677e01, 0x06677e16, 0x02687e01, 0x06687e16, 0x026c7e01, 0x066c7e16,
+        0x026d7e01, 0x066d7e16, 0x026e7e01, 0x066e7e16, 0x02707e01, 0x06707e16,
+        0x02727e01, 0x06727e16, 0x02757e01, 0x06757e16, 0x063a7e00, 0x06427e00,
+        0x06437e00, 0x06447e00, 0x06457e00, 0x06467e00, 0x06477e00, 0x06487e00,
+        0x06497e00, 0x064a7e00, 0x064b7e00, 0x064c7e00, 0x064d7e00, 0x064e7e00,
+        0x064f7e00, 0x06507e00, 0x06517e00, 0x06527e00, 0x06537e00, 0x06547e00,
+        0x06557e00, 0x06567e00, 0x06577e00, 0x06597e00, 0x066a7e00, 0x066b7e00,
+        0x06717e00, 0x06767e00, 0x06777e00, 0x06787e00, 0x06797e00, 0x067a7e00,
+        0x01007e46, 0x01007e47, 0x01007e49, 0x05007e4a
+    },
+    /* 90 */
+    {
+        0x02305e01, 0x06305e16, 0x02315e01, 0x06315e16, 0x02325e01, 0x06325e16,
+        0x02615e01, 0x06615e16, 0x02635e01, 0x06635e16, 0x02655e01, 0x06655e16,
+        0x02695e01, 0x06695e16, 0x026f5e01, 0x066f5e16, 0x02735e01, 0x06735e16,
+        0x02745e01, 0x06745e16, 0x06205e00, 0x06255e00, 0x062d5e00, 0x062e5e00,
+        0x062f5e00, 0x06335e00, 0x06345e00, 0x06355e00, 0x06365e00, 0x06375e00,
+        0x06385e00, 0x06395e00, 0x063d5e00, 0x06415e00, 0x065f5e00, 0x06625e00,
+        0x06645e00, 0x06665e00, 0x06675e00, 0x06685e00, 0x066c5e00, 0x066d5e00,
+        0x066e5e00, 0x06705e00, 0x06725e00, 0x06755e00, 0x01005e26, 0x01005e27,
+        0x01005e2c, 0x01005e2d, 0x01005e2f, 0x01005e30, 0x01005e33, 0x01005e34,
+        0x01005e36, 0x01005e37, 0x01005e3b, 0x01005e3c, 0x01005e3e, 0x01005e3f,
+        0x01005e42, 0x01005e43, 0x01005e45, 0x05005e48, 0x02307d01, 0x06307d16,
+        0x02317d01, 0x06317d16, 0x02327d01, 0x06327d16, 0x02617d01, 0x06617d16,
+        0x02637d01, 0x06637d16, 0x02657d01, 0x06657d16, 0x02697d01, 0x06697d16,
+        0x026f7d01, 0x066f7d16, 0x02737d01, 0x06737d16, 0x02747d01, 0x06747d16,
+        0x06207d00, 0x06257d00, 0x062d7d00, 0x062e7d00, 0x062f7d00, 0x06337d00,
+        0x06347d00, 0x06357d00, 0x06367d00, 0x06377d00, 0x06387d00, 0x06397d00,
+        0x063d7d00, 0x06417d00, 0x065f7d00, 0x06627d00, 0x06647d00, 0x06667d00,
+        0x06677d00, 0x06687d00, 0x066c7d00, 0x066d7d00, 0x066e7d00, 0x06707d00,
+        0x06727d00, 0x06757d00, 0x01007d26, 0x01007d27, 0x01007d2c, 0x01007d2d,
+        0x01007d2f, 0x01007d30, 0x01007d33, 0x01007d34, 0x01007d36, 0x01007d37,
+        0x01007d3b, 0x01007d3c, 0x01007d3e, 0x01007d3f, 0x01007d42, 0x01007d43,
+        0x01007d45, 0x05007d48, 0x06303c00, 0x06313c00, 0x06323c00, 0x06613c00,
+        0x06633c00, 0x06653c00, 0x06693c00, 0x066f3c00, 0x06733c00, 0x06743c00,
+        0x01003c0d, 0x01003c0e, 0x01003c11, 0x01003c12, 0x01003c14, 0x01003c15,
+        0x01003c1a, 0x01003c1b, 0x01003c1d, 0x01003c1e, 0x01003c21, 0x01003c22,
+        0x01003c24, 0x01003c25, 0x01003c2b, 0x01003c2e, 0x01003c32, 0x01003c35,
+        0x01003c3a, 0x01003c3d, 0x01003c41, 0x05003c44, 0x06306000, 0x06316000,
+        0x06326000, 0x06616000, 0x06636000, 0x06656000, 0x06696000, 0x066f6000,
+        0x06736000, 0x06746000, 0x0100600d, 0x0100600e, 0x01006011, 0x01006012,
+        0x01006014, 0x01006015, 0x0100601a, 0x0100601b, 0x0100601d, 0x0100601e,
+        0x01006021, 0x01006022, 0x01006024, 0x01006025, 0x0100602b, 0x0100602e,
+        0x01006032, 0x01006035, 0x0100603a, 0x0100603d, 0x01006041, 0x05006044,
+        0x06307b00, 0x06317b00, 0x06327b00, 0x06617b00, 0x06637b00, 0x06657b00,
+        0x06697b00, 0x066f7b00, 0x06737b00, 0x06747b00, 0x01007b0d, 0x01007b0e,
+        0x01007b11, 0x01007b12, 0x01007b14, 0x01007b15, 0x01007b1a, 0x01007b1b,
+        0x01007b1d, 0x01007b1e, 0x01007b21, 0x01007b22, 0x01007b24, 0x01007b25,
+        0x01007b2b, 0x01007b2e, 0x01007b32, 0x01007b35, 0x01007b3a, 0x01007b3d,
+        0x01007b41, 0x05007b44, 0x01005c01, 0x05005c16, 0x0100c301, 0x0500c316,
+        0x0100d001, 0x0500d016, 0x05008000, 0x05008200, 0x05008300, 0x0500a200,
+        0x0500b800, 0x0500c200, 0x0500e000, 0x0500e200, 0x0000006c, 0x0000006d,
+        0x00000072, 0x00000073, 0x00000075, 0x00000076, 0x00000079, 0x0000007b,
+        0x0000007f, 0x00000082, 0x00000088, 0x0000008b, 0x0000008f, 0x00000092,
+        0x0000009b, 0x000000a2, 0x000000aa, 0x040000b4
+    },
+    /* 91 */
+    {
+        0x02305e02, 0x02305e09, 0x02305e17, 0x06305e28, 0x02315e02, 0x02315e09,
+        0x02315e17, 0x06315e28, 0x02325e02, 0x02325e09, 0x02325e17, 0x06325e28,
+        0x02615e02, 0x02615e09, 0x02615e17, 0x06615e28, 0x02635e02, 0x02635e09,
+        0x02635e17, 0x06635e28, 0x02655e02, 0x02655e09, 0x02655e17, 0x06655e28,
+        0x02695e02, 0x02695e09, 0x02695e17, 0x06695e28, 0x026f5e02, 0x026f5e09,
+        0x026f5e17, 0x066f5e28, 0x02735e02, 0x02735e09, 0x02735e17, 0x06735e28,
+        0x02745e02, 0x02745e09, 0x02745e17, 0x06745e28, 0x02205e01, 0x06205e16,
+        0x02255e01, 0x06255e16, 0x022d5e01, 0x062d5e16, 0x022e5e01, 0x062e5e16,
+        0x022f5e01, 0x062f5e16, 0x02335e01, 0x06335e16, 0x02345e01, 0x06345e16,
+        0x02355e01, 0x06355e16, 0x02365e01, 0x06365e16, 0x02375e01, 0x06375e16,
+        0x02385e01, 0x06385e16, 0x02395e01, 0x06395e16, 0x023d5e01, 0x063d5e16,
+        0x02415e01, 0x06415e16, 0x025f5e01, 0x065f5e16, 0x02625e01, 0x06625e16,
+        0x02645e01, 0x06645e16, 0x02665e01, 0x06665e16, 0x02675e01, 0x06675e16,
+        0x02685e01, 0x06685e16, 0x026c5e01, 0x066c5e16, 0x026d5e01, 0x066d5e16,
+        0x026e5e01, 0x066e5e16, 0x02705e01, 0x06705e16, 0x02725e01, 0x06725e16,
+        0x02755e01, 0x06755e16, 0x063a5e00, 0x06425e00, 0x06435e00, 0x06445e00,
+        0x06455e00, 0x06465e00, 0x06475e00, 0x06485e00, 0x06495e00, 0x064a5e00,
+        0x064b5e00, 0x064c5e00, 0x064d5e00, 0x064e5e00, 0x064f5e00, 0x06505e00,
+        0x06515e00, 0x06525e00, 0x06535e00, 0x06545e00, 0x06555e00, 0x06565e00,
+        0x06575e00, 0x06595e00, 0x066a5e00, 0x066b5e00, 0x06715e00, 0x06765e00,
+        0x06775e00, 0x06785e00, 0x06795e00, 0x067a5e00, 0x01005e46, 0x01005e47,
+        0x01005e49, 0x05005e4a, 0x02307d02, 0x02307d09, 0x02307d17, 0x06307d28,
+        0x02317d02, 0x02317d09, 0x02317d17, 0x06317d28, 0x02327d02, 0x02327d09,
+        0x02327d17, 0x06327d28, 0x02617d02, 0x02617d09, 0x02617d17, 0x06617d28,
+        0x02637d02, 0x02637d09, 0x02637d17, 0x06637d28, 0x02657d02, 0x02657d09,
+        0x02657d17, 0x06657d28, 0x02697d02, 0x02697d09, 0x02697d17, 0x06697d28,
+        0x026f7d02, 0x026f7d09, 0x026f7d17, 0x066f7d28, 0x02737d02, 0x02737d09,
+        0x02737d17, 0x06737d28, 0x02747d02, 0x02747d09, 0x02747d17, 0x06747d28,
+        0x02207d01, 0x06207d16, 0x02257d01, 0x06257d16, 0x022d7d01, 0x062d7d16,
+        0x022e7d01, 0x062e7d16, 0x022f7d01, 0x062f7d16, 0x02337d01, 0x06337d16,
+        0x02347d01, 0x06347d16, 0x02357d01, 0x06357d16, 0x02367d01, 0x06367d16,
+        0x02377d01, 0x06377d16, 0x02387d01, 0x06387d16, 0x02397d01, 0x06397d16,
+        0x023d7d01, 0x063d7d16, 0x02417d01, 0x06417d16, 0x025f7d01, 0x065f7d16,
+        0x02627d01, 0x06627d16, 0x02647d01, 0x06647d16, 0x02667d01, 0x06667d16,
+        0x02677d01, 0x06677d16, 0x02687d01, 0x06687d16, 0x026c7d01, 0x066c7d16,
+        0x026d7d01, 0x066d7d16, 0x026e7d01, 0x066e7d16, 0x02707d01, 0x06707d16,
+        0x02727d01, 0x06727d16, 0x02757d01, 0x06757d16, 0x063a7d00, 0x06427d00,
+        0x06437d00, 0x06447d00, 0x06457d00, 0x06467d00, 0x06477d00, 0x06487d00,
+        0x06497d00, 0x064a7d00, 0x064b7d00, 0x064c7d00, 0x064d7d00, 0x064e7d00,
+        0x064f7d00, 0x06507d00, 0x06517d00, 0x06527d00, 0x06537d00, 0x06547d00,
+        0x06557d00, 0x06567d00, 0x06577d00, 0x06597d00, 0x066a7d00, 0x066b7d00,
+        0x06717d00, 0x06767d00, 0x06777d00, 0x06787d00, 0x06797d00, 0x067a7d00,
+        0x01007d46, 0x01007d47, 0x01007d49, 0x05007d4a
+    },
+    /* 92 */
+    {
+        0x02303c01, 0x06303c16, 0x02313c01, 0x06313c16, 0x02323c01, 0x06323c16,
+        0x02613c01, 0x06613c16, 0x02633c01, 0x06633c16, 0x02653c01, 0x06653c16,
+        0x02693c01, 0x06693c16, 0x026f3c01, 0x066f3c16, 0x02733c01, 0x06733c16,
+        0x02743c01, 0x06743c16, 0x06203c00, 0x06253c00, 0x062d3c00, 0x062e3c00,
+        0x062f3c00, 0x06333c00, 0x06343c00, 0x06353c00, 0x06363c00, 0x06373c00,
+        0x06383c00, 0x06393c00, 0x063d3c00, 0x06413c00, 0x065f3c00, 0x06623c00,
+        0x06643c00, 0x06663c00, 0x06673c00, 0x06683c00, 0x066c3c00, 0x066d3c00,
+        0x066e3c00, 0x06703c00, 0x06723c00, 0x06753c00, 0x01003c26, 0x01003c27,
+        0x01003c2c, 0x01003c2d, 0x01003c2f, 0x01003c30, 0x01003c33, 0x01003c34,
+        0x01003c36, 0x01003c37, 0x01003c3b, 0x01003c3c, 0x01003c3e, 0x01003c3f,
+        0x01003c42, 0x01003c43, 0x01003c45, 0x05003c48, 0x02306001, 0x06306016,
+        0x02316001, 0x06316016, 0x02326001, 0x06326016, 0x02616001, 0x06616016,
+        0x02636001, 0x06636016, 0x02656001, 0x06656016, 0x02696001, 0x06696016,
+        0x026f6001, 0x066f6016, 0x02736001, 0x06736016, 0x02746001, 0x06746016,
+        0x06206000, 0x06256000, 0x062d6000, 0x062e6000, 0x062f6000, 0x06336000,
+        0x06346000, 0x06356000, 0x06366000, 0x06376000, 0x06386000, 0x06396000,
+        0x063d6000, 0x06416000, 0x065f6000, 0x06626000, 0x06646000, 0x06666000,
+        0x06676000, 0x06686000, 0x066c6000, 0x066d6000, 0x066e6000, 0x06706000,
+        0x06726000, 0x06756000, 0x01006026, 0x01006027, 0x0100602c, 0x0100602d,
+        0x0100602f, 0x01006030, 0x01006033, 0x01006034, 0x01006036, 0x01006037,
+        0x0100603b, 0x0100603c, 0x0100603e, 0x0100603f, 0x01006042, 0x01006043,
+        0x01006045, 0x05006048, 0x02307b01, 0x06307b16, 0x02317b01, 0x06317b16,
+        0x02327b01, 0x06327b16, 0x02617b01, 0x06617b16, 0x02637b01, 0x06637b16,
+        0x02657b01, 0x06657b16, 0x02697b01, 0x06697b16, 0x026f7b01, 0x066f7b16,
+        0x02737b01, 0x06737b16, 0x02747b01, 0x06747b16, 0x06207b00, 0x06257b00,
+        0x062d7b00, 0x062e7b00, 0x062f7b00, 0x06337b00, 0x06347b00, 0x06357b00,
+        0x06367b00, 0x06377b00, 0x06387b00, 0x06397b00, 0x063d7b00, 0x06417b00,
+        0x065f7b00, 0x06627b00, 0x06647b00, 0x06667b00, 0x06677b00, 0x06687b00,
+        0x066c7b00, 0x066d7b00, 0x066e7b00, 0x06707b00, 0x06727b00, 0x06757b00,
+        0x01007b26, 0x01007b27, 0x01007b2c, 0x01007b2d, 0x01007b2f, 0x01007b30,
+        0x01007b33, 0x01007b34, 0x01007b36, 0x01007b37, 0x01007b3b, 0x01007b3c,
+        0x01007b3e, 0x01007b3f, 0x01007b42, 0x01007b43, 0x01007b45, 0x05007b48,
+        0x01005c02, 0x01005c09, 0x01005c17, 0x05005c28, 0x0100c302, 0x0100c309,
+        0x0100c317, 0x0500c328, 0x0100d002, 0x0100d009, 0x0100d017, 0x0500d028,
+        0x01008001, 0x05008016, 0x01008201, 0x05008216, 0x01008301, 0x05008316,
+        0x0100a201, 0x0500a216, 0x0100b801, 0x0500b816, 0x0100c201, 0x0500c216,
+        0x0100e001, 0x0500e016, 0x0100e201, 0x0500e216, 0x05009900, 0x0500a100,
+        0x0500a700, 0x0500ac00, 0x0500b000, 0x0500b100, 0x0500b300, 0x0500d100,
+        0x0500d800, 0x0500d900, 0x0500e300, 0x0500e500, 0x0500e600, 0x0000007a,
+        0x0000007c, 0x0000007d, 0x00000080, 0x00000081, 0x00000083, 0x00000084,
+        0x00000089, 0x0000008a, 0x0000008c, 0x0000008d, 0x00000090, 0x00000091,
+        0x00000093, 0x00000096, 0x0000009c, 0x0000009f, 0x000000a3, 0x000000a6,
+        0x000000ab, 0x000000ae, 0x000000b5, 0x040000be
+    },
+    /* 93 */
+    {
+        0x02303c02, 0x02303c09, 0x02303c17, 0x06303c28, 0x02313c02, 0x02313c09,
+        0x02313c17, 0x06313c28, 0x02323c02, 0x02323c09, 0x02323c17, 0x06323c28,
+        0x02613c02, 0x02613c09, 0x02613c17, 0x06613c28, 0x02633c02, 0x02633c09,
+        0x02633c17, 0x06633c28, 0x02653c02, 0x02653c09, 0x02653c17, 0x06653c28,
+        0x02693c02, 0x02693c09, 0x02693c17, 0x06693c28, 0x026f3c02, 0x026f3c09,
+        0x026f3c17, 0x066f3c28, 0x02733c02, 0x02733c09, 0x02733c17, 0x06733c28,
+        0x02743c02, 0x02743c09, 0x02743c17, 0x06743c28, 0x02203c01, 0x06203c16,
+        0x02253c01, 0x06253c16, 0x022d3c01, 0x062d3c16, 0x022e3c01, 0x062e3c16,
+        0x022f3c01, 0x062f3c16, 0x02333c01, 0x06333c16, 0x02343c01, 0x06343c16,
+        0x02353c01, 0x06353c16, 0x02363c01, 0x06363c16, 0x02373c01, 0x06373c16,
+        0x02383c01, 0x06383c16, 0x02393c01, 0x06393c16, 0x023d3c01, 0x063d3c16,
+        0x02413c01, 0x06413c16, 0x025f3c01, 0x065f3c16, 0x02623c01, 0x06623c16,
+        0x02643c01, 0x06643c16, 0x02663c01, 0x06663c16, 0x02673c01, 0x06673c16,
+        0x02683c01, 0x06683c16, 0x026c3c01, 0x066c3c16, 0x026d3c01, 0x066d3c16,
+        0x026e3c01, 0x066e3c16, 0x02703c01, 0x06703c16, 0x02723c01, 0x06723c16,
+        0x02753c01, 0x06753c16, 0x063a3c00, 0x06423c00, 0x06433c00, 0x06443c00,
+        0x06453c00, 0x06463c00, 0x06473c00, 0x06483c00, 0x06493c00, 0x064a3c00,
+        0x064b3c00, 0x064c3c00, 0x064d3c00, 0x064e3c00, 0x064f3c00, 0x06503c00,
+        0x06513c00, 0x06523c00, 0x06533c00, 0x06543c00, 0x06553c00, 0x06563c00,
+        0x06573c00, 0x06593c00, 0x066a3c00, 0x066b3c00, 0x06713c00, 0x06763c00,
+        0x06773c00, 0x06783c00, 0x06793c00, 0x067a3c00, 0x01003c46, 0x01003c47,
+        0x01003c49, 0x05003c4a, 0x02306002, 0x02306009, 0x02306017, 0x06306028,
+        0x02316002, 0x02316009, 0x02316017, 0x06316028, 0x02326002, 0x02326009,
+        0x02326017, 0x06326028, 0x02616002, 0x02616009, 0x02616017, 0x06616028,
+        0x02636002, 0x02636009, 0x02636017, 0x06636028, 0x02656002, 0x02656009,
+        0x02656017, 0x06656028, 0x02696002, 0x02696009, 0x02696017, 0x06696028,
+        0x026f6002, 0x026f6009, 0x026f6017, 0x066f6028, 0x02736002, 0x02736009,
+        0x02736017, 0x06736028, 0x02746002, 0x02746009, 0x02746017, 0x06746028,
+        0x02206001, 0x06206016, 0x02256001, 0x06256016, 0x022d6001, 0x062d6016,
+        0x022e6001, 0x062e6016, 0x022f6001, 0x062f6016, 0x02336001, 0x06336016,
+        0x02346001, 0x06346016, 0x02356001, 0x06356016, 0x02366001, 0x06366016,
+        0x02376001, 0x06376016, 0x02386001, 0x06386016, 0x02396001, 0x06396016,
+        0x023d6001, 0x063d6016, 0x02416001, 0x06416016, 0x025f6001, 0x065f6016,
+        0x02626001, 0x06626016, 0x02646001, 0x06646016, 0x02666001, 0x06666016,
+        0x02676001, 0x06676016, 0x02686001, 0x06686016, 0x026c6001, 0x066c6016,
+        0x026d6001, 0x066d6016, 0x026e6001, 0x066e6016, 0x02706001, 0x06706016,
+        0x02726001, 0x06726016, 0x02756001, 0x06756016, 0x063a6000, 0x06426000,
+        0x06436000, 0x06446000, 0x06456000, 0x06466000, 0x06476000, 0x06486000,
+        0x06496000, 0x064a6000, 0x064b6000, 0x064c6000, 0x064d6000, 0x064e6000,
+        0x064f6000, 0x06506000, 0x06516000, 0x06526000, 0x06536000, 0x06546000,
+        0x06556000, 0x06566000, 0x06576000, 0x06596000, 0x066a6000, 0x066b6000,
+        0x06716000, 0x06766000, 0x06776000, 0x06786000, 0x06796000, 0x067a6000,
+        0x01006046, 0x01006047, 0x01006049, 0x0500604a
+    },
+    /* 94 */
+    {
+        0x02307b02, 0x02307b09, 0x02307b17, 0x06307b28, 0x02317b02, 0x02317b09,
+        0x02317b17, 0x06317b28, 0x02327b02, 0x02327b09, 0x02327b17, 0x06327b28,
+        0x02617b02, 0x02617b09, 0x02617b17, 0x06617b28, 0x02637b02, 0x02637b09,
+        0x02637b17, 0x06637b28, 0x02657b02, 0x02657b09, 0x02657b17, 0x06657b28,
+        0x02697b02, 0x02697b09, 0x02697b17, 0x06697b28, 0x026f7b02, 0x026f7b09,
+        0x026f7b17, 0x066f7b28, 0x02737b02, 0x02737b09, 0x02737b17, 0x06737b28,
+        0x02747b02, 0x02747b09, 0x02747b17, 0x06747b28, 0x02207b01, 0x06207b16,
+        0x02257b01, 0x06257b16, 0x022d7b01, 0x062d7b16, 0x022e7b01, 0x062e7b16,
+        0x022f7b01, 0x062f7b16, 0x02337b01, 0x06337b16, 0x02347b01, 0x06347b16,
+        0x02357b01, 0x06357b16, 0x02367b01, 0x06367b16, 0x02377b01, 0x06377b16,
+        0x02387b01, 0x06387b16, 0x02397b01, 0x06397b16, 0x023d7b01, 0x063d7b16,
+        0x02417b01, 0x06417b16, 0x025f7b01, 0x065f7b16, 0x02627b01, 0x06627b16,
+        0x02647b01, 0x06647b16, 0x02667b01, 0x06667b16, 0x02677b01, 0x06677b16,
+        0x02687b01, 0x06687b16, 0x026c7b01, 0x066c7b16, 0x026d7b01, 0x066d7b16,
+        0x026e7b01, 0x066e7b16, 0x02707b01, 0x06707b16, 0x02727b01, 0x06727b16,
+        0x02757b01, 0x06757b16, 0x063a7b00, 0x06427b00, 0x06437b00, 0x06447b00,
+        0x06457b00, 0x06467b00, 0x06477b00, 0x06487b00, 0x06497b00, 0x064a7b00,
+        0x064b7b00, 0x064c7b00, 0x064d7b00, 0x064e7b00, 0x064f7b00, 0x06507b00,
+        0x06517b00, 0x06527b00, 0x06537b00, 0x06547b00, 0x06557b00, 0x06567b00,
+        0x06577b00, 0x06597b00, 0x066a7b00, 0x066b7b00, 0x06717b00, 0x06767b00,
+        0x06777b00, 0x06787b00, 0x06797b00, 0x067a7b00, 0x01007b46, 0x01007b47,
+        0x01007b49, 0x05007b4a, 0x01005c03, 0x01005c06, 0x01005c0a, 0x01005c0f,
+        0x01005c18, 0x01005c1f, 0x01005c29, 0x05005c38, 0x0100c303, 0x0100c306,
+        0x0100c30a, 0x0100c30f, 0x0100c318, 0x0100c31f, 0x0100c329, 0x0500c338,
+        0x0100d003, 0x0100d006, 0x0100d00a, 0x0100d00f, 0x0100d018, 0x0100d01f,
+        0x0100d029, 0x0500d038, 0x01008002, 0x01008009, 0x01008017, 0x05008028,
+        0x01008202, 0x01008209, 0x01008217, 0x05008228, 0x01008302, 0x01008309,
+        0x01008317, 0x05008328, 0x0100a202, 0x0100a209, 0x0100a217, 0x0500a228,
+        0x0100b802, 0x0100b809, 0x0100b817, 0x0500b828, 0x0100c202, 0x0100c209,
+        0x0100c217, 0x0500c228, 0x0100e002, 0x0100e009, 0x0100e017, 0x0500e028,
+        0x0100e202, 0x0100e209, 0x0100e217, 0x0500e228, 0x01009901, 0x05009916,
+        0x0100a101, 0x0500a116, 0x0100a701, 0x0500a716, 0x0100ac01, 0x0500ac16,
+        0x0100b001, 0x0500b016, 0x0100b101, 0x0500b116, 0x0100b301, 0x0500b316,
+        0x0100d101, 0x0500d116, 0x0100d801, 0x0500d816, 0x0100d901, 0x0500d916,
+        0x0100e301, 0x0500e316, 0x0100e501, 0x0500e516, 0x0100e601, 0x0500e616,
+        0x05008100, 0x05008400, 0x05008500, 0x05008600, 0x05008800, 0x05009200,
+        0x05009a00, 0x05009c00, 0x0500a000, 0x0500a300, 0x0500a400, 0x0500a900,
+        0x0500aa00, 0x0500ad00, 0x0500b200, 0x0500b500, 0x0500b900, 0x0500ba00,
+        0x0500bb00, 0x0500bd00, 0x0500be00, 0x0500c400, 0x0500c600, 0x0500e400,
+        0x0500e800, 0x0500e900, 0x00000094, 0x00000095, 0x00000097, 0x00000098,
+        0x0000009d, 0x0000009e, 0x000000a0, 0x000000a1, 0x000000a4, 0x000000a5,
+        0x000000a7, 0x000000a8, 0x000000ac, 0x000000ad, 0x000000af, 0x000000b1,
+        0x000000b6, 0x000000b9, 0x000000bf, 0x040000cf
+    },
+    /* 95 */
+    {
+        0x01005c04, 0x01005c05, 0x01005c07, 0x01005c08, 0x01005c0b, 0x01005c0c,
+        0x01005c10, 0x01005c13, 0x01005c19, 0x01005c1c, 0x01005c20, 0x01005c23,
+        0x01005c2a, 0x01005c31, 0x01005c39, 0x05005c40, 0x0100c304, 0x0100c305,
+        0x0100c307, 0x0100c308, 0x0100c30b, 0x0100c30c, 0x0100c310, 0x0100c313,
+        0x0100c319, 0x0100c31c, 0x0100c320, 0x0100c323, 0x0100c32a, 0x0100c331,
+        0x0100c339, 0x0500c340, 0x0100d004, 0x0100d005, 0x0100d007, 0x0100d008,
+        0x0100d00b, 0x0100d00c, 0x0100d010, 0x0100d013, 0x0100d019, 0x0100d01c,
+        0x0100d020, 0x0100d023, 0x0100d02a, 0x0100d031, 0x0100d039, 0x0500d040,
+        0x01008003, 0x01008006, 0x0100800a, 0x0100800f, 0x01008018, 0x0100801f,
+        0x01008029, 0x05008038, 0x01008203, 0x01008206, 0x0100820a, 0x0100820f,
+        0x01008218, 0x0100821f, 0x01008229, 0x05008238, 0x01008303, 0x01008306,
+        0x0100830a, 0x0100830f, 0x01008318, 0x0100831f, 0x01008329, 0x05008338,
+        0x0100a203, 0x0100a206, 0x0100a20a, 0x0100a20f, 0x0100a218, 0x0100a21f,
+        0x0100a229, 0x0500a238, 0x0100b803, 0x0100b806, 0x0100b80a, 0x0100b80f,
+        0x0100b818, 0x0100b81f, 0x0100b829, 0x0500b838, 0x0100c203, 0x0100c206,
+        0x0100c20a, 0x0100c20f, 0x0100c218, 0x0100c21f, 0x0100c229, 0x0500c238,
+        0x0100e003, 0x0100e006, 0x0100e00a, 0x0100e00f, 0x0100e018, 0x0100e01f,
+        0x0100e029, 0x0500e038, 0x0100e203, 0x0100e206, 0x0100e20a, 0x0100e20f,
+        0x0100e218, 0x0100e21f, 0x0100e229, 0x0500e238, 0x01009902, 0x01009909,
+        0x01009917, 0x05009928, 0x0100a102, 0x0100a109, 0x0100a117, 0x0500a128,
+        0x0100a702, 0x0100a709, 0x0100a717, 0x0500a728, 0x0100ac02, 0x0100ac09,
+        0x0100ac17, 0x0500ac28, 0x0100b002, 0x0100b009, 0x0100b017, 0x0500b028,
+        0x0100b102, 0x0100b109, 0x0100b117, 0x0500b128, 0x0100b302, 0x0100b309,
+        0x0100b317, 0x0500b328, 0x0100d102, 0x0100d109, 0x0100d117, 0x0500d128,
+        0x0100d802, 0x0100d809, 0x0100d817, 0x0500d828, 0x0100d902, 0x0100d909,
+        0x0100d917, 0x0500d928, 0x0100e302, 0x0100e309, 0x0100e317, 0x0500e328,
+        0x0100e502, 0x0100e509, 0x0100e517, 0x0500e528, 0x0100e602, 0x0100e609,
+        0x0100e617, 0x0500e628, 0x01008101, 0x05008116, 0x01008401, 0x05008416,
+        0x01008501, 0x05008516, 0x01008601, 0x05008616, 0x01008801, 0x05008816,
+        0x01009201, 0x05009216, 0x01009a01, 0x05009a16, 0x01009c01, 0x05009c16,
+        0x0100a001, 0x0500a016, 0x0100a301, 0x0500a316, 0x0100a401, 0x0500a416,
+        0x0100a901, 0x0500a916, 0x0100aa01, 0x0500aa16, 0x0100ad01, 0x0500ad16,
+        0x0100b201, 0x0500b216, 0x0100b501, 0x0500b516, 0x0100b901, 0x0500b916,
+        0x0100ba01, 0x0500ba16, 0x0100bb01, 0x0500bb16, 0x0100bd01, 0x0500bd16,
+        0x0100be01, 0x0500be16, 0x0100c401, 0x0500c416, 0x0100c601, 0x0500c616,
+        0x0100e401, 0x0500e416, 0x0100e801, 0x0500e816, 0x0100e901, 0x0500e916,
+        0x05000100, 0x05008700, 0x05008900, 0x05008a00, 0x05008b00, 0x05008c00,
+        0x05008d00, 0x05008f00, 0x05009300, 0x05009500, 0x05009600, 0x05009700,
+        0x05009800, 0x05009b00, 0x05009d00, 0x05009e00, 0x0500a500, 0x0500a600,
+        0x0500a800, 0x0500ae00, 0x0500af00, 0x0500b400, 0x0500b600, 0x0500b700,
+        0x0500bc00, 0x0500bf00, 0x0500c500, 0x0500e700, 0x0500ef00, 0x000000b0,
+        0x000000b2, 0x000000b3, 0x000000b7, 0x000000b8, 0x000000ba, 0x000000bb,
+        0x000000c0, 0x000000c7, 0x000000d0, 0x040000df
+    },
+    /* 96 */
+    {
+        0x06305c00, 0x06315c00, 0x06325c00, 0x06615c00, 0x06635c00, 0x06655c00,
+        0x06695c00, 0x066f5c00, 0x06735c00, 0x06745c00, 0x01005c0d, 0x01005c0e,
+        0x01005c11, 0x01005c12, 0x01005c14, 0x01005c15, 0x01005c1a, 0x01005c1b,
+        0x01005c1d, 0x01005c1e, 0x01005c21, 0x01005c22, 0x01005c24, 0x01005c25,
+        0x01005c2b, 0x01005c2e, 0x01005c32, 0x01005c35, 0x01005c3a, 0x01005c3d,
+        0x01005c41, 0x05005c44, 0x0630c300, 0x0631c300, 0x0632c300, 0x0661c300,
+        0x0663c300, 0x0665c300, 0x0669c300, 0x066fc300, 0x0673c300, 0x0674c300,
+        0x0100c30d, 0x0100c30e, 0x0100c311, 0x0100c312, 0x0100c314, 0x0100c315,
+        0x0100c31a, 0x0100c31b, 0x0100c31d, 0x0100c31e, 0x0100c321, 0x0100c322,
+        0x0100c324, 0x0100c325, 0x0100c32b, 0x0100c32e, 0x0100c332, 0x0100c335,
+        0x0100c33a, 0x0100c33d, 0x0100c341, 0x0500c344, 0x0630d000, 0x0631d000,
+        0x0632d000, 0x0661d000, 0x0663d000, 0x0665d000, 0x0669d000, 0x066fd000,
+        0x0673d000, 0x0674d000, 0x0100d00d, 0x0100d00e, 0x0100d011, 0x0100d012,
+        0x0100d014, 0x0100d015, 0x0100d01a, 0x0100d01b, 0x0100d01d, 0x0100d01e,
+        0x0100d021, 0x0100d022, 0x0100d024, 0x0100d025, 0x0100d02b, 0x0100d02e,
+        0x0100d032, 0x0100d035, 0x0100d03a, 0x0100d03d, 0x0100d041, 0x0500d044,
+        0x01008004, 0x01008005, 0x01008007, 0x01008008, 0x0100800b, 0x0100800c,
+        0x01008010, 0x01008013, 0x01008019, 0x0100801c, 0x01008020, 0x01008023,
+        0x0100802a, 0x01008031, 0x01008039, 0x05008040, 0x01008204, 0x01008205,
+        0x01008207, 0x01008208, 0x0100820b, 0x0100820c, 0x01008210, 0x01008213,
+        0x01008219, 0x0100821c, 0x01008220, 0x01008223, 0x0100822a, 0x01008231,
+        0x01008239, 0x05008240, 0x01008304, 0x01008305, 0x01008307, 0x01008308,
+        0x0100830b, 0x0100830c, 0x01008310, 0x01008313, 0x01008319, 0x0100831c,
+        0x01008320, 0x01008323, 0x0100832a, 0x01008331, 0x01008339, 0x05008340,
+        0x0100a204, 0x0100a205, 0x0100a207, 0x0100a208, 0x0100a20b, 0x0100a20c,
+        0x0100a210, 0x0100a213, 0x0100a219, 0x0100a21c, 0x0100a220, 0x0100a223,
+        0x0100a22a, 0x0100a231, 0x0100a239, 0x0500a240, 0x0100b804, 0x0100b805,
+        0x0100b807, 0x0100b808, 0x0100b80b, 0x0100b80c, 0x0100b810, 0x0100b813,
+        0x0100b819, 0x0100b81c, 0x0100b820, 0x0100b823, 0x0100b82a, 0x0100b831,
+        0x0100b839, 0x0500b840, 0x0100c204, 0x0100c205, 0x0100c207, 0x0100c208,
+        0x0100c20b, 0x0100c20c, 0x0100c210, 0x0100c213, 0x0100c219, 0x0100c21c,
+        0x0100c220, 0x0100c223, 0x0100c22a, 0x0100c231, 0x0100c239, 0x0500c240,
+        0x0100e004, 0x0100e005, 0x0100e007, 0x0100e008, 0x0100e00b, 0x0100e00c,
+        0x0100e010, 0x0100e013, 0x0100e019, 0x0100e01c, 0x0100e020, 0x0100e023,
+        0x0100e02a, 0x0100e031, 0x0100e039, 0x0500e040, 0x0100e204, 0x0100e205,
+        0x0100e207, 0x0100e208, 0x0100e20b, 0x0100e20c, 0x0100e210, 0x0100e213,
+        0x0100e219, 0x0100e21c, 0x0100e220, 0x0100e223, 0x0100e22a, 0x0100e231,
+        0x0100e239, 0x0500e240, 0x01009903, 0x01009906, 0x0100990a, 0x0100990f,
+        0x01009918, 0x0100991f, 0x01009929, 0x05009938, 0x0100a103, 0x0100a106,
+        0x0100a10a, 0x0100a10f, 0x0100a118, 0x0100a11f, 0x0100a129, 0x0500a138,
+        0x0100a703, 0x0100a706, 0x0100a70a, 0x0100a70f, 0x0100a718, 0x0100a71f,
+        0x0100a729, 0x0500a738, 0x0100ac03, 0x0100ac06, 0x0100ac0a, 0x0100ac0f,
+        0x0100ac18, 0x0100ac1f, 0x0100ac29, 0x0500ac38
+    },
+    /* 97 */
+    {
+        0x02305c01, 0x06305c16, 0x02315c01, 0x06315c16, 0x02325c01, 0x06325c16,
+        0x02615c01, 0x06615c16, 0x02635c01, 0x06635c16, 0x02655c01, 0x06655c16,
+        0x02695c01, 0x06695c16, 0x026f5c01, 0x066f5c16, 0x02735c01, 0x06735c16,
+        0x02745c01, 0x06745c16, 0x06205c00, 0x06255c00, 0x062d5c00, 0x062e5c00,
+        0x062f5c00, 0x06335c00, 0x06345c00, 0x06355c00, 0x06365c00, 0x06375c00,
+        0x06385c00, 0x06395c00, 0x063d5c00, 0x06415c00, 0x065f5c00, 0x06625c00,
+        0x06645c00, 0x06665c00, 0x06675c00, 0x06685c00, 0x066c5c00, 0x066d5c00,
+        0x066e5c00, 0x06705c00, 0x06725c00, 0x06755c00, 0x01005c26, 0x01005c27,
+        0x01005c2c, 0x01005c2d, 0x01005c2f, 0x01005c30, 0x01005c33, 0x01005c34,
+        0x01005c36, 0x01005c37, 0x01005c3b, 0x01005c3c, 0x01005c3e, 0x01005c3f,
+        0x01005c42, 0x01005c43, 0x01005c45, 0x05005c48, 0x0230c301, 0x0630c316,
+        0x0231c301, 0x0631c316, 0x0232c301, 0x0632c316, 0x0261c301, 0x0661c316,
+        0x0263c301, 0x0663c316, 0x0265c301, 0x0665c316, 0x0269c301, 0x0669c316,
+        0x026fc301, 0x066fc316, 0x0273c301, 0x0673c316, 0x0274c301, 0x0674c316,
+        0x0620c300, 0x0625c300, 0x062dc300, 0x062ec300, 0x062fc300, 0x0633c300,
+        0x0634c300, 0x0635c300, 0x0636c300, 0x0637c300, 0x0638c300, 0x0639c300,
+        0x063dc300, 0x0641c300, 0x065fc300, 0x0662c300, 0x0664c300, 0x0666c300,
+        0x0667c300, 0x0668c300, 0x066cc300, 0x066dc300, 0x066ec300, 0x0670c300,
+        0x0672c300, 0x0675c300, 0x0100c326, 0x0100c327, 0x0100c32c, 0x0100c32d,
+        0x0100c32f, 0x0100c330, 0x0100c333, 0x0100c334, 0x0100c336, 0x0100c337,
+        0x0100c33b, 0x0100c33c, 0x0100c33e, 0x0100c33f, 0x0100c342, 0x0100c343,
+        0x0100c345, 0x0500c348, 0x0230d001, 0x0630d016, 0x0231d001, 0x0631d016,
+        0x0232d001, 0x0632d016, 0x0261d001, 0x0661d016, 0x0263d001, 0x0663d016,
+        0x0265d001, 0x0665d016, 0x0269d001, 0x0669d016, 0x026fd001, 0x066fd016,
+        0x0273d001, 0x0673d016, 0x0274d001, 0x0674d016, 0x0620d000, 0x0625d000,
+        0x062dd000, 0x062ed000, 0x062fd000, 0x0633d000, 0x0634d000, 0x0635d000,
+        0x0636d000, 0x0637d000, 0x0638d000, 0x0639d000, 0x063dd000, 0x0641d000,
+        0x065fd000, 0x0662d000, 0x0664d000, 0x0666d000, 0x0667d000, 0x0668d000,
+        0x066cd000, 0x066dd000, 0x066ed000, 0x0670d000, 0x0672d000, 0x0675d000,
+        0x0100d026, 0x0100d027, 0x0100d02c, 0x0100d02d, 0x0100d02f, 0x0100d030,
+        0x0100d033, 0x0100d034, 0x0100d036, 0x0100d037, 0x0100d03b, 0x0100d03c,
+        0x0100d03e, 0x0100d03f, 0x0100d042, 0x0100d043, 0x0100d045, 0x0500d048,
+        0x06308000, 0x06318000, 0x06328000, 0x06618000, 0x06638000, 0x06658000,
+        0x06698000, 0x066f8000, 0x06738000, 0x06748000, 0x0100800d, 0x0100800e,
+        0x01008011, 0x01008012, 0x01008014, 0x01008015, 0x0100801a, 0x0100801b,
+        0x0100801d, 0x0100801e, 0x01008021, 0x01008022, 0x01008024, 0x01008025,
+        0x0100802b, 0x0100802e, 0x01008032, 0x01008035, 0x0100803a, 0x0100803d,
+        0x01008041, 0x05008044, 0x06308200, 0x06318200, 0x06328200, 0x06618200,
+        0x06638200, 0x06658200, 0x06698200, 0x066f8200, 0x06738200, 0x06748200,
+        0x0100820d, 0x0100820e, 0x01008211, 0x01008212, 0x01008214, 0x01008215,
+        0x0100821a, 0x0100821b, 0x0100821d, 0x0100821e, 0x01008221, 0x01008222,
+        0x01008224, 0x01008225, 0x0100822b, 0x0100822e, 0x01008232, 0x01008235,
+        0x0100823a, 0x0100823d, 0x01008241, 0x05008244
+    },
+    /* 98 */
+    {
+        0x02305c02, 0x02305c09, 0x02305c17, 0x06305c28, 0x02315c02, 0x02315c09,
+        0x02315c17, 0x06315c28, 0x02325c02, 0x02325c09, 0x02325c17, 0x06325c28,
+        0x02615c02, 0x02615c09, 0x02615c17, 0x06615c28, 0x02635c02, 0x02635c09,
+        0x02635c17, 0x06635c28, 0x02655c02, 0x02655c09, 0x02655c17, 0x06655c28,
+        0x02695c02, 0x02695c09, 0x02695c17, 0x06695c28, 0x026f5c02, 0x026f5c09,
+        0x026f5c17, 0x066f5c28, 0x02735c02, 0x02735c09, 0x02735c17, 0x06735c28,
+        0x02745c02, 0x02745c09, 0x02745c17, 0x06745c28, 0x02205c01, 0x06205c16,
+        0x02255c01, 0x06255c16, 0x022d5c01, 0x062d5c16, 0x022e5c01, 0x062e5c16,
+        0x022f5c01, 0x062f5c16, 0x02335c01, 0x06335c16, 0x02345c01, 0x06345c16,
+        0x02355c01, 0x06355c16, 0x02365c01, 0x06365c16, 0x02375c01, 0x06375c16,
+        0x02385c01, 0x06385c16, 0x02395c01, 0x06395c16, 0x023d5c01, 0x063d5c16,
+        0x02415c01, 0x06415c16, 0x025f5c01, 0x065f5c16, 0x02625c01, 0x06625c16,
+        0x02645c01, 0x06645c16, 0x02665c01, 0x06665c16, 0x02675c01, 0x06675c16,
+        0x02685c01, 0x06685c16, 0x026c5c01, 0x066c5c16, 0x026d5c01, 0x066d5c16,
+        0x026e5c01, 0x066e5c16, 0x02705c01, 0x06705c16, 0x02725c01, 0x06725c16,
+        0x02755c01, 0x06755c16, 0x063a5c00, 0x06425c00, 0x06435c00, 0x06445c00,
+        0x06455c00, 0x06465c00, 0x06475c00, 0x06485c00, 0x06495c00, 0x064a5c00,
+        0x064b5c00, 0x064c5c00, 0x064d5c00, 0x064e5c00, 0x064f5c00, 0x06505c00,
+        0x06515c00, 0x06525c00, 0x06535c00, 0x06545c00, 0x06555c00, 0x06565c00,
+        0x06575c00, 0x06595c00, 0x066a5c00, 0x066b5c00, 0x06715c00, 0x06765c00,
+        0x06775c00, 0x06785c00, 0x06795c00, 0x067a5c00, 0x01005c46, 0x01005c47,
+        0x01005c49, 0x05005c4a, 0x0230c302, 0x0230c309, 0x0230c317, 0x0630c328,
+        0x0231c302, 0x0231c309, 0x0231c317, 0x0631c328, 0x0232c302, 0x0232c309,
+        0x0232c317, 0x0632c328, 0x0261c302, 0x0261c309, 0x0261c317, 0x0661c328,
+        0x0263c302, 0x0263c309, 0x0263c317, 0x0663c328, 0x0265c302, 0x0265c309,
+        0x0265c317, 0x0665c328, 0x0269c302, 0x0269c309, 0x0269c317, 0x0669c328,
+        0x026fc302, 0x026fc309, 0x026fc317, 0x066fc328, 0x0273c302, 0x0273c309,
+        0x0273c317, 0x0673c328, 0x0274c302, 0x0274c309, 0x0274c317, 0x0674c328,
+        0x0220c301, 0x0620c316, 0x0225c301, 0x0625c316, 0x022dc301, 0x062dc316,
+        0x022ec301, 0x062ec316, 0x022fc301, 0x062fc316, 0x0233c301, 0x0633c316,
+        0x0234c301, 0x0634c316, 0x0235c301, 0x0635c316, 0x0236c301, 0x0636c316,
+        0x0237c301, 0x0637c316, 0x0238c301, 0x0638c316, 0x0239c301, 0x0639c316,
+        0x023dc301, 0x063dc316, 0x0241c301, 0x0641c316, 0x025fc301, 0x065fc316,
+        0x0262c301, 0x0662c316, 0x0264c301, 0x0664c316, 0x0266c301, 0x0666c316,
+        0x0267c301, 0x0667c316, 0x0268c301, 0x0668c316, 0x026cc301, 0x066cc316,
+        0x026dc301, 0x066dc316, 0x026ec301, 0x066ec316, 0x0270c301, 0x0670c316,
+        0x0272c301, 0x0672c316, 0x0275c301, 0x0675c316, 0x063ac300, 0x0642c300,
+        0x0643c300, 0x0644c300, 0x0645c300, 0x0646c300, 0x0647c300, 0x0648c300,
+        0x0649c300, 0x064ac300, 0x064bc300, 0x064cc300, 0x064dc300, 0x064ec300,
+        0x064fc300, 0x0650c300, 0x0651c300, 0x0652c300, 0x0653c300, 0x0654c300,
+        0x0655c300, 0x0656c300, 0x0657c300, 0x0659c300, 0x066ac300, 0x066bc300,
+        0x0671c300, 0x0676c300, 0x0677c300, 0x0678c300, 0x0679c300, 0x067ac300,
+        0x0100c346, 0x0100c347, 0x0100c349, 0x0500c34a
+    },
+    /* 99 */
+    {
+        0x0230d002, 0x0230d009, 0x0230d017, 0x0630d028, 0x0231d002, 0x0231d009,
+        0x0231d017, 0x0631d028, 0x0232d002, 0x0232d009, 0x0232d017, 0x0632d028,
+        0x0261d002, 0x0261d009, 0x0261d017, 0x0661d028, 0x0263d002, 0x0263d009,
+        0x0263d017, 0x0663d028, 0x0265d002, 0x0265d009, 0x0265d017, 0x0665d028,
+        0x0269d002, 0x0269d009, 0x0269d017, 0x0669d028, 0x026fd002, 0x026fd009,
+        0x026fd017, 0x066fd028, 0x0273d002, 0x0273d009, 0x0273d017, 0x0673d028,
+        0x0274d002, 0x0274d009, 0x0274d017, 0x0674d028, 0x0220d001, 0x0620d016,
+        0x0225d001, 0x0625d016, 0x022dd001, 0x062dd016, 0x022ed001, 0x062ed016,
+        0x022fd001, 0x062fd016, 0x0233d001, 0x0633d016, 0x0234d001, 0x0634d016,
+        0x0235d001, 0x0635d016, 0x0236d001, 0x0636d016, 0x0237d001, 0x0637d016,
+        0x0238d001, 0x0638d016, 0x0239d001, 0x0639d016, 0x023dd001, 0x063dd016,
+        0x0241d001, 0x0641d016, 0x025fd001, 0x065fd016, 0x0262d001, 0x0662d016,
+        0x0264d001, 0x0664d016, 0x0266d001, 0x0666d016, 0x0267d001, 0x0667d016,
+        0x0268d001, 0x0668d016, 0x026cd001, 0x066cd016, 0x026dd001, 0x066dd016,
+        0x026ed001, 0x066ed016, 0x0270d001, 0x0670d016, 0x0272d001, 0x0672d016,
+        0x0275d001, 0x0675d016, 0x063ad000, 0x0642d000, 0x0643d000, 0x0644d000,
+        0x0645d000, 0x0646d000, 0x0647d000, 0x0648d000, 0x0649d000, 0x064ad000,
+        0x064bd000, 0x064cd000, 0x064dd000, 0x064ed000, 0x064fd000, 0x0650d000,
+        0x0651d000, 0x0652d000, 0x0653d000, 0x0654d000, 0x0655d000, 0x0656d000,
+        0x0657d000, 0x0659d000, 0x066ad000, 0x066bd000, 0x0671d000, 0x0676d000,
+        0x0677d000, 0x0678d000, 0x0679d000, 0x067ad000, 0x0100d046, 0x0100d047,
+        0x0100d049, 0x0500d04a, 0x02308001, 0x06308016, 0x02318001, 0x06318016,
+        0x02328001, 0x06328016, 0x02618001, 0x06618016, 0x02638001, 0x06638016,
+        0x02658001, 0x06658016, 0x02698001, 0x06698016, 0x026f8001, 0x066f8016,
+        0x02738001, 0x06738016, 0x02748001, 0x06748016, 0x06208000, 0x06258000,
+        0x062d8000, 0x062e8000, 0x062f8000, 0x06338000, 0x06348000, 0x06358000,
+        0x06368000, 0x06378000, 0x06388000, 0x06398000, 0x063d8000, 0x06418000,
+        0x065f8000, 0x06628000, 0x06648000, 0x06668000, 0x06678000, 0x06688000,
+        0x066c8000, 0x066d8000, 0x066e8000, 0x06708000, 0x06728000, 0x06758000,
+        0x01008026, 0x01008027, 0x0100802c, 0x0100802d, 0x0100802f, 0x01008030,
+        0x01008033, 0x01008034, 0x01008036, 0x01008037, 0x0100803b, 0x0100803c,
+        0x0100803e, 0x0100803f, 0x01008042, 0x01008043, 0x01008045, 0x05008048,
+        0x02308201, 0x06308216, 0x02318201, 0x06318216, 0x02328201, 0x06328216,
+        0x02618201, 0x06618216, 0x02638201, 0x06638216, 0x02658201, 0x06658216,
+        0x02698201, 0x06698216, 0x026f8201, 0x066f8216, 0x02738201, 0x06738216,
+        0x02748201, 0x06748216, 0x06208200, 0x06258200, 0x062d8200, 0x062e8200,
+        0x062f8200, 0x06338200, 0x06348200, 0x06358200, 0x06368200, 0x06378200,
+        0x06388200, 0x06398200, 0x063d8200, 0x06418200, 0x065f8200, 0x06628200,
+        0x06648200, 0x06668200, 0x06678200, 0x06688200, 0x066c8200, 0x066d8200,
+        0x066e8200, 0x06708200, 0x06728200, 0x06758200, 0x01008226, 0x01008227,
+        0x0100822c, 0x0100822d, 0x0100822f, 0x01008230, 0x01008233, 0x01008234,
+        0x01008236, 0x01008237, 0x0100823b, 0x0100823c, 0x0100823e, 0x0100823f,
+        0x01008242, 0x01008243, 0x01008245, 0x05008248
+    },
+    /* 100 */
+    {
+        0x02308002, 0x02308009, 0x02308017, 0x06308028, 0x02318002, 0x02318009,
+        0x02318017, 0x06318028, 0x02328002, 0x02328009, 0x02328017, 0x06328028,
+        0x02618002, 0x02618009, 0x02618017, 0x06618028, 0x02638002, 0x02638009,
+        0x02638017, 0x06638028, 0x02658002, 0x02658009, 0x02658017, 0x06658028,
+        0x02698002, 0x02698009, 0x02698017, 0x06698028, 0x026f8002, 0x026f8009,
+        0x026f8017, 0x066f8028, 0x02738002, 0x02738009, 0x02738017, 0x06738028,
+        0x02748002, 0x02748009, 0x02748017, 0x06748028, 0x02208001, 0x06208016,
+        0x02258001, 0x06258016, 0x022d8001, 0x062d8016, 0x022e8001, 0x062e8016,
+        0x022f8001, 0x062f8016, 0x02338001, 0x06338016, 0x02348001, 0x06348016,
+        0x02358001, 0x06358016, 0x02368001, 0x06368016, 0x02378001, 0x06378016,
+        0x02388001, 0x06388016, 0x02398001, 0x06398016, 0x023d8001, 0x063d8016,
+        0x02418001, 0x06418016, 0x025f8001, 0x065f8016, 0x02628001, 0x06628016,
+        0x02648001, 0x06648016, 0x02668001, 0x06668016, 0x02678001, 0x06678016,
+        0x02688001, 0x06688016, 0x026c8001, 0x066c8016, 0x026d8001, 0x066d8016,
+        0x026e8001, 0x066e8016, 0x02708001, 0x06708016, 0x02728001, 0x06728016,
+        0x02758001, 0x06758016, 0x063a8000, 0x06428000, 0x06438000, 0x06448000,
+        0x06458000, 0x06468000, 0x06478000, 0x06488000, 0x06498000, 0x064a8000,
+        0x064b8000, 0x064c8000, 0x064d8000, 0x064e8000, 0x064f8000, 0x06508000,
+        0x06518000, 0x06528000, 0x06538000, 0x06548000, 0x06558000, 0x06568000,
+        0x06578000, 0x06598000, 0x066a8000, 0x066b8000, 0x06718000, 0x06768000,
+        0x06778000, 0x06788000, 0x06798000, 0x067a8000, 0x01008046, 0x01008047,
+        0x01008049, 0x0500804a, 0x02308202, 0x02308209, 0x02308217, 0x06308228,
+        0x02318202, 0x02318209, 0x02318217, 0x06318228, 0x02328202, 0x02328209,
+        0x02328217, 0x06328228, 0x02618202, 0x02618209, 0x02618217, 0x06618228,
+        0x02638202, 0x02638209, 0x02638217, 0x06638228, 0x02658202, 0x02658209,
+        0x02658217, 0x06658228, 0x02698202, 0x02698209, 0x02698217, 0x06698228,
+        0x026f8202, 0x026f8209, 0x026f8217, 0x066f8228, 0x02738202, 0x02738209,
+        0x02738217, 0x06738228, 0x02748202, 0x02748209, 0x02748217, 0x06748228,
+        0x02208201, 0x06208216, 0x02258201, 0x06258216, 0x022d8201, 0x062d8216,
+        0x022e8201, 0x062e8216, 0x022f8201, 0x062f8216, 0x02338201, 0x06338216,
+        0x02348201, 0x06348216, 0x02358201, 0x06358216, 0x02368201, 0x06368216,
+        0x02378201, 0x06378216, 0x02388201, 0x06388216, 0x02398201, 0x06398216,
+        0x023d8201, 0x063d8216, 0x02418201, 0x06418216, 0x025f8201, 0x065f8216,
+        0x02628201, 0x06628216, 0x02648201, 0x06648216, 0x02668201, 0x06668216,
+        0x02678201, 0x06678216, 0x02688201, 0x06688216, 0x026c8201, 0x066c8216,
+        0x026d8201, 0x066d8216, 0x026e8201, 0x066e8216, 0x02708201, 0x06708216,
+        0x02728201, 0x06728216, 0x02758201, 0x06758216, 0x063a8200, 0x06428200,
+        0x06438200, 0x06448200, 0x06458200, 0x06468200, 0x06478200, 0x06488200,
+        0x06498200, 0x064a8200, 0x064b8200, 0x064c8200, 0x064d8200, 0x064e8200,
+        0x064f8200, 0x06508200, 0x06518200, 0x06528200, 0x06538200, 0x06548200,
+        0x06558200, 0x06568200, 0x06578200, 0x06598200, 0x066a8200, 0x066b8200,
+        0x06718200, 0x06768200, 0x06778200, 0x06788200, 0x06798200, 0x067a8200,
+        0x01008246, 0x01008247, 0x01008249, 0x0500824a
+    },
+    /* 101 */
+    {
+        0x06308300, 0x06318300, 0x06328300, 0x06618300, 0x06638300, 0x06658300,
+        0x06698300, 0x066f8300, 0x06738300, 0x06748300, 0x0100830d, 0x0100830e,
+        0x01008311, 0x01008312, 0x01008314, 0x01008315, 0x0100831a, 0x0100831b,
+        0x0100831d, 0x0100831e, 0x01008321, 0x01008322, 0x01008324, 0x01008325,
+        0x0100832b, 0x0100832e, 0x01008332, 0x01008335, 0x0100833a, 0x0100833d,
+        0x01008341, 0x05008344, 0x0630a200, 0x0631a200, 0x0632a200, 0x0661a200,
+        0x0663a200, 0x0665a200, 0x0669a200, 0x066fa200, 0x0673a200, 0x0674a200,
+        0x0100a20d, 0x0100a20e, 0x0100a211, 0x0100a212, 0x0100a214, 0x0100a215,
+        0x0100a21a, 0x0100a21b, 0x0100a21d, 0x0100a21e, 0x0100a221, 0x0100a222,
+        0x0100a224, 0x0100a225, 0x0100a22b, 0x0100a22e, 0x0100a232, 0x0100a235,
+        0x0100a23a, 0x0100a23d, 0x0100a241, 0x0500a244, 0x0630b800, 0x0631b800,
+        0x0632b800, 0x0661b800, 0x0663b800, 0x0665b800, 0x0669b800, 0x066fb800,
+        0x0673b800, 0x0674b800, 0x0100b80d, 0x0100b80e, 0x0100b811, 0x0100b812,
+        0x0100b814, 0x0100b815, 0x0100b81a, 0x0100b81b, 0x0100b81d, 0x0100b81e,
+        0x0100b821, 0x0100b822, 0x0100b824, 0x0100b825, 0x0100b82b, 0x0100b82e,
+        0x0100b832, 0x0100b835, 0x0100b83a, 0x0100b83d, 0x0100b841, 0x0500b844,
+        0x0630c200, 0x0631c200, 0x0632c200, 0x0661c200, 0x0663c200, 0x0665c200,
+        0x0669c200, 0x066fc200, 0x0673c200, 0x0674c200, 0x0100c20d, 0x0100c20e,
+        0x0100c211, 0x0100c212, 0x0100c214, 0x0100c215, 0x0100c21a, 0x0100c21b,
+        0x0100c21d, 0x0100c21e, 0x0100c221, 0x0100c222, 0x0100c224, 0x0100c225,
+        0x0100c22b, 0x0100c22e, 0x0100c232, 0x0100c235, 0x0100c23a, 0x0100c23d,
+        0x0100c241, 0x0500c244, 0x0630e000, 0x0631e000, 0x0632e000, 0x0661e000,
+        0x0663e000, 0x0665e000, 0x0669e000, 0x066fe000, 0x0673e000, 0x0674e000,
+        0x0100e00d, 0x0100e00e, 0x0100e011, 0x0100e012, 0x0100e014, 0x0100e015,
+        0x0100e01a, 0x0100e01b, 0x0100e01d, 0x0100e01e, 0x0100e021, 0x0100e022,
+        0x0100e024, 0x0100e025, 0x0100e02b, 0x0100e02e, 0x0100e032, 0x0100e035,
+        0x0100e03a, 0x0100e03d, 0x0100e041, 0x0500e044, 0x0630e200, 0x0631e200,
+        0x0632e200, 0x0661e200, 0x0663e200, 0x0665e200, 0x0669e200, 0x066fe200,
+        0x0673e200, 0x0674e200, 0x0100e20d, 0x0100e20e, 0x0100e211, 0x0100e212,
+        0x0100e214, 0x0100e215, 0x0100e21a, 0x0100e21b, 0x0100e21d, 0x0100e21e,
+        0x0100e221, 0x0100e222, 0x0100e224, 0x0100e225, 0x0100e22b, 0x0100e22e,
+        0x0100e232, 0x0100e235, 0x0100e23a, 0x0100e23d, 0x0100e241, 0x0500e244,
+        0x01009904, 0x01009905, 0x01009907, 0x01009908, 0x0100990b, 0x0100990c,
+        0x01009910, 0x01009913, 0x01009919, 0x0100991c, 0x01009920, 0x01009923,
+        0x0100992a, 0x01009931, 0x01009939, 0x05009940, 0x0100a104, 0x0100a105,
+        0x0100a107, 0x0100a108, 0x0100a10b, 0x0100a10c, 0x0100a110, 0x0100a113,
+        0x0100a119, 0x0100a11c, 0x0100a120, 0x0100a123, 0x0100a12a, 0x0100a131,
+        0x0100a139, 0x0500a140, 0x0100a704, 0x0100a705, 0x0100a707, 0x0100a708,
+        0x0100a70b, 0x0100a70c, 0x0100a710, 0x0100a713, 0x0100a719, 0x0100a71c,
+        0x0100a720, 0x0100a723, 0x0100a72a, 0x0100a731, 0x0100a739, 0x0500a740,
+        0x0100ac04, 0x0100ac05, 0x0100ac07, 0x0100ac08, 0x0100ac0b, 0x0100ac0c,
+        0x0100ac10, 0x0100ac13, 0x0100ac19, 0x0100ac1c, 0x0100ac20, 0x0100ac23,
+        0x0100ac2a, 0x0100ac31, 0x0100ac39, 0x0500ac40
+    },
+    /* 102 */
+    {
+        0x02308301, 0x06308316, 0x02318301, 0x06318316, 0x02328301, 0x06328316,
+        0x02618301, 0x06618316, 0x02638301, 0x06638316, 0x02658301, 0x06658316,
+        0x02698301, 0x06698316, 0x026f8301, 0x066f8316, 0x02738301, 0x06738316,
+        0x02748301, 0x06748316, 0x06208300, 0x06258300, 0x062d8300, 0x062e8300,
+        0x062f8300, 0x06338300, 0x06348300, 0x06358300, 0x06368300, 0x06378300,
+        0x06388300, 0x06398300, 0x063d8300, 0x06418300, 0x065f8300, 0x06628300,
+        0x06648300, 0x06668300, 0x06678300, 0x06688300, 0x066c8300, 0x066d8300,
+        0x066e8300, 0x06708300, 0x06728300, 0x06758300, 0x01008326, 0x01008327,
+        0x0100832c, 0x0100832d, 0x0100832f, 0x01008330, 0x01008333, 0x01008334,
+        0x01008336, 0x01008337, 0x0100833b, 0x0100833c, 0x0100833e, 0x0100833f,
+        0x01008342, 0x01008343, 0x01008345, 0x05008348, 0x0230a201, 0x0630a216,
+        0x0231a201, 0x0631a216, 0x0232a201, 0x0632a216, 0x0261a201, 0x0661a216,
+        0x0263a201, 0x0663a216, 0x0265a201, 0x0665a216, 0x0269a201, 0x0669a216,
+        0x026fa201, 0x066fa216, 0x0273a201, 0x0673a216, 0x0274a201, 0x0674a216,
+        0x0620a200, 0x0625a200, 0x062da200, 0x062ea200, 0x062fa200, 0x0633a200,
+        0x0634a200, 0x0635a200, 0x0636a200, 0x0637a200, 0x0638a200, 0x0639a200,
+        0x063da200, 0x0641a200, 0x065fa200, 0x0662a200, 0x0664a200, 0x0666a200,
+        0x0667a200, 0x0668a200, 0x066ca200, 0x066da200, 0x066ea200, 0x0670a200,
+        0x0672a200, 0x0675a200, 0x0100a226, 0x0100a227, 0x0100a22c, 0x0100a22d,
+        0x0100a22f, 0x0100a230, 0x0100a233, 0x0100a234, 0x0100a236, 0x0100a237,
+        0x0100a23b, 0x0100a23c, 0x0100a23e, 0x0100a23f, 0x0100a242, 0x0100a243,
+        0x0100a245, 0x0500a248, 0x0230b801, 0x0630b816, 0x0231b801, 0x0631b816,
+        0x0232b801, 0x0632b816, 0x0261b801, 0x0661b816, 0x0263b801, 0x0663b816,
+        0x0265b801, 0x0665b816, 0x0269b801, 0x0669b816, 0x026fb801, 0x066fb816,
+        0x0273b801, 0x0673b816, 0x0274b801, 0x0674b816, 0x0620b800, 0x0625b800,
+        0x062db800, 0x062eb800, 0x062fb800, 0x0633b800, 0x0634b800, 0x0635b800,
+        0x0636b800, 0x0637b800, 0x0638b800, 0x0639b800, 0x063db800, 0x0641b800,
+        0x065fb800, 0x0662b800, 0x0664b800, 0x0666b800, 0x0667b800, 0x0668b800,
+        0x066cb800, 0x066db800, 0x066eb800, 0x0670b800, 0x0672b800, 0x0675b800,
+        0x0100b826, 0x0100b827, 0x0100b82c, 0x0100b82d, 0x0100b82f, 0x0100b830,
+        0x0100b833, 0x0100b834, 0x0100b836, 0x0100b837, 0x0100b83b, 0x0100b83c,
+        0x0100b83e, 0x0100b83f, 0x0100b842, 0x0100b843, 0x0100b845, 0x0500b848,
+        0x0230c201, 0x0630c216, 0x0231c201, 0x0631c216, 0x0232c201, 0x0632c216,
+        0x0261c201, 0x0661c216, 0x0263c201, 0x0663c216, 0x0265c201, 0x0665c216,
+        0x0269c201, 0x0669c216, 0x026fc201, 0x066fc216, 0x0273c201, 0x0673c216,
+        0x0274c201, 0x0674c216, 0x0620c200, 0x0625c200, 0x062dc200, 0x062ec200,
+        0x062fc200, 0x0633c200, 0x0634c200, 0x0635c200, 0x0636c200, 0x0637c200,
+        0x0638c200, 0x0639c200, 0x063dc200, 0x0641c200, 0x065fc200, 0x0662c200,
+        0x0664c200, 0x0666c200, 0x0667c200, 0x0668c200, 0x066cc200, 0x066dc200,
+        0x066ec200, 0x0670c200, 0x0672c200, 0x0675c200, 0x0100c226, 0x0100c227,
+        0x0100c22c, 0x0100c22d, 0x0100c22f, 0x0100c230, 0x0100c233, 0x0100c234,
+        0x0100c236, 0x0100c237, 0x0100c23b, 0x0100c23c, 0x0100c23e, 0x0100c23f,
+        0x0100c242, 0x0100c243, 0x0100c245, 0x0500c248
+    },
+    /* 103 */
+    {
+        0x02308302, 0x02308309, 0x02308317, 0x06308328, 0x02318302, 0x02318309,
+        0x02318317, 0x06318328, 0x02328302, 0x02328309, 0x02328317, 0x06328328,
+        0x02618302, 0x02618309, 0x02618317, 0x06618328, 0x02638302, 0x02638309,
+        0x02638317, 0x06638328, 0x02658302, 0x02658309, 0x02658317, 0x06658328,
+        0x02698302, 0x02698309, 0x02698317, 0x06698328, 0x026f8302, 0x026f8309,
+        0x026f8317, 0x066f8328, 0x02738302, 0x02738309, 0x02738317, 0x06738328,
+        0x02748302, 0x02748309, 0x02748317, 0x06748328, 0x02208301, 0x06208316,
+        0x02258301, 0x06258316, 0x022d8301, 0x062d8316, 0x022e8301, 0x062e8316,
+        0x022f8301, 0x062f8316, 0x02338301, 0x06338316, 0x02348301, 0x06348316,
+        0x02358301, 0x06358316, 0x02368301, 0x06368316, 0x02378301, 0x06378316,
+        0x02388301, 0x06388316, 0x02398301, 0x06398316, 0x023d8301, 0x063d8316,
+        0x02418301, 0x06418316, 0x025f8301, 0x065f8316, 0x02628301, 0x06628316,
+        0x02648301, 0x06648316, 0x02668301, 0x06668316, 0x02678301, 0x06678316,
+        0x02688301, 0x06688316, 0x026c8301, 0x066c8316, 0x026d8301, 0x066d8316,
+        0x026e8301, 0x066e8316, 0x02708301, 0x06708316, 0x02728301, 0x06728316,
+        0x02758301, 0x06758316, 0x063a8300, 0x06428300, 0x06438300, 0x06448300,
+        0x06458300, 0x06468300, 0x06478300, 0x06488300, 0x06498300, 0x064a8300,
+        0x064b8300, 0x064c8300, 0x064d8300, 0x064e8300, 0x064f8300, 0x06508300,
+        0x06518300, 0x06528300, 0x06538300, 0x06548300, 0x06558300, 0x06568300,
+        0x06578300, 0x06598300, 0x066a8300, 0x066b8300, 0x06718300, 0x06768300,
+        0x06778300, 0x06788300, 0x06798300, 0x067a8300, 0x01008346, 0x01008347,
+        0x01008349, 0x0500834a, 0x0230a202, 0x0230a209, 0x0230a217, 0x0630a228,
+        0x0231a202, 0x0231a209, 0x0231a217, 0x0631a228, 0x0232a202, 0x0232a209,
+        0x0232a217, 0x0632a228, 0x0261a202, 0x0261a209, 0x0261a217, 0x0661a228,
+        0x0263a202, 0x0263a209, 0x0263a217, 0x0663a228, 0x0265a202, 0x0265a209,
+        0x0265a217, 0x0665a228, 0x0269a202, 0x0269a209, 0x0269a217, 0x0669a228,
+        0x026fa202, 0x026fa209, 0x026fa217, 0x066fa228, 0x0273a202, 0x0273a209,
+        0x0273a217, 0x0673a228, 0x0274a202, 0x0274a209, 0x0274a217, 0x0674a228,
+        0x0220a201, 0x0620a216, 0x0225a201, 0x0625a216, 0x022da201, 0x062da216,
+        0x022ea201, 0x062ea216, 0x022fa201, 0x062fa216, 0x0233a201, 0x0633a216,
+        0x0234a201, 0x0634a216, 0x0235a201, 0x0635a216, 0x0236a201, 0x0636a216,
+        0x0237a201, 0x0637a216, 0x0238a201, 0x0638a216, 0x0239a201, 0x0639a216,
+        0x023da201, 0x063da216, 0x0241a201, 0x0641a216, 0x025fa201, 0x065fa216,
+        0x0262a201, 0x0662a216, 0x0264a201, 0x0664a216, 0x0266a201, 0x0666a216,
+        0x0267a201, 0x0667a216, 0x0268a201, 0x0668a216, 0x026ca201, 0x066ca216,
+        0x026da201, 0x066da216, 0x026ea201, 0x066ea216, 0x0270a201, 0x0670a216,
+        0x0272a201, 0x0672a216, 0x0275a201, 0x0675a216, 0x063aa200, 0x0642a200,
+        0x0643a200, 0x0644a200, 0x0645a200, 0x0646a200, 0x0647a200, 0x0648a200,
+        0x0649a200, 0x064aa200, 0x064ba200, 0x064ca200, 0x064da200, 0x064ea200,
+        0x064fa200, 0x0650a200, 0x0651a200, 0x0652a200, 0x0653a200, 0x0654a200,
+        0x0655a200, 0x0656a200, 0x0657a200, 0x0659a200, 0x066aa200, 0x066ba200,
+        0x0671a200, 0x0676a200, 0x0677a200, 0x0678a200, 0x0679a200, 0x067aa200,
+        0x0100a246, 0x0100a247, 0x0100a249, 0x0500a24a
+    },
+    /* 104 */
+    {
+        0x0230b802, 0x0230b809, 0x0230b817, 0x0630b828, 0x0231b802, 0x0231b809,
+        0x0231b817, 0x0631b828, 0x0232b802, 0x0232b809, 0x0232b817, 0x0632b828,
+        0x0261b802, 0x0261b809, 0x0261b817, 0x0661b828, 0x0263b802, 0x0263b809,
+        0x0263b817, 0x0663b828, 0x0265b802, 0x0265b809, 0x0265b817, 0x0665b828,
+        0x0269b802, 0x0269b809, 0x0269b817, 0x0669b828, 0x026fb802, 0x026fb809,
+        0x026fb817, 0x066fb828, 0x0273b802, 0x0273b809, 0x0273b817, 0x0673b828,
+        0x0274b802, 0x0274b809, 0x0274b817, 0x0674b828, 0x0220b801, 0x0620b816,
+        0x0225b801, 0x0625b816, 0x022db801, 0x062db816, 0x022eb801, 0x062eb816,
+        0x022fb801, 0x062fb816, 0x0233b801, 0x0633b816, 0x0234b801, 0x0634b816,
+        0x0235b801, 0x0635b816, 0x0236b801, 0x0636b816, 0x0237b801, 0x0637b816,
+        0x0238b801, 0x0638b816, 0x0239b801, 0x0639b816, 0x023db801, 0x063db816,
+        0x0241b801, 0x0641b816, 0x025fb801, 0x065fb816, 0x0262b801, 0x0662b816,
+        0x0264b801, 0x0664b816, 0x0266b801, 0x0666b816, 0x0267b801, 0x0667b816,
+        0x0268b801, 0x0668b816, 0x026cb801, 0x066cb816, 0x026db801, 0x066db816,
+        0x026eb801, 0x066eb816, 0x0270b801, 0x0670b816, 0x0272b801, 0x0672b816,
+        0x0275b801, 0x0675b816, 0x063ab800, 0x0642b800, 0x0643b800, 0x0644b800,
+        0x0645b800, 0x0646b800, 0x0647b800, 0x0648b800, 0x0649b800, 0x064ab800,
+        0x064bb800, 0x064cb800, 0x064db800, 0x064eb800, 0x064fb800, 0x0650b800,
+        0x0651b800, 0x0652b800, 0x0653b800, 0x0654b800, 0x0655b800, 0x0656b800,
+        0x0657b800, 0x0659b800, 0x066ab800, 0x066bb800, 0x0671b800, 0x0676b800,
+        0x0677b800, 0x0678b800, 0x0679b800, 0x067ab800, 0x0100b846, 0x0100b847,
+        0x0100b849, 0x0500b84a, 0x0230c202, 0x0230c209, 0x0230c217, 0x0630c228,
+        0x0231c202, 0x0231c209, 0x0231c217, 0x0631c228, 0x0232c202, 0x0232c209,
+        0x0232c217, 0x0632c228, 0x0261c202, 0x0261c209, 0x0261c217, 0x0661c228,
+        0x0263c202, 0x0263c209, 0x0263c217, 0x0663c228, 0x0265c202, 0x0265c209,
+        0x0265c217, 0x0665c228, 0x0269c202, 0x0269c209, 0x0269c217, 0x0669c228,
+        0x026fc202, 0x026fc209, 0x026fc217, 0x066fc228, 0x0273c202, 0x0273c209,
+        0x0273c217, 0x0673c228, 0x0274c202, 0x0274c209, 0x0274c217, 0x0674c228,
+        0x0220c201, 0x0620c216, 0x0225c201, 0x0625c216, 0x022dc201, 0x062dc216,
+        0x022ec201, 0x062ec216, 0x022fc201, 0x062fc216, 0x0233c201, 0x0633c216,
+        0x0234c201, 0x0634c216, 0x0235c201, 0x0635c216, 0x0236c201, 0x0636c216,
+        0x0237c201, 0x0637c216, 0x0238c201, 0x0638c216, 0x0239c201, 0x0639c216,
+        0x023dc201, 0x063dc216, 0x0241c201, 0x0641c216, 0x025fc201, 0x065fc216,
+        0x0262c201, 0x0662c216, 0x0264c201, 0x0664c216, 0x0266c201, 0x0666c216,
+        0x0267c201, 0x0667c216, 0x0268c201, 0x0668c216, 0x026cc201, 0x066cc216,
+        0x026dc201, 0x066dc216, 0x026ec201, 0x066ec216, 0x0270c201, 0x0670c216,
+        0x0272c201, 0x0672c216, 0x0275c201, 0x0675c216, 0x063ac200, 0x0642c200,
+        0x0643c200, 0x0644c200, 0x0645c200, 0x0646c200, 0x0647c200, 0x0648c200,
+        0x0649c200, 0x064ac200, 0x064bc200, 0x064cc200, 0x064dc200, 0x064ec200,
+        0x064fc200, 0x0650c200, 0x0651c200, 0x0652c200, 0x0653c200, 0x0654c200,
+        0x0655c200, 0x0656c200, 0x0657c200, 0x0659c200, 0x066ac200, 0x066bc200,
+        0x0671c200, 0x0676c200, 0x0677c200, 0x0678c200, 0x0679c200, 0x067ac200,
+        0x0100c246, 0x0100c247, 0x0100c249, 0x0500c24a
+    },
+    /* 105 */
+    {
+        0x0230e001, 0x0630e016, 0x0231e001, 0x0631e016, 0x0232e001, 0x0632e016,
+        0x0261e001, 0x0661e016, 0x0263e001, 0x0663e016, 0x0265e001, 0x0665e016,
+        0x0269e001, 0x0669e016, 0x026fe001, 0x066fe016, 0x0273e001, 0x0673e016,
+        0x0274e001, 0x0674e016, 0x0620e000, 0x0625e000, 0x062de000, 0x062ee000,
+        0x062fe000, 0x0633e000, 0x0634e000, 0x0635e000, 0x0636e000, 0x0637e000,
+        0x0638e000, 0x0639e000, 0x063de000, 0x0641e000, 0x065fe000, 0x0662e000,
+        0x0664e000, 0x0666e000, 0x0667e000, 0x0668e000, 0x066ce000, 0x066de000,
+        0x066ee000, 0x0670e000, 0x0672e000, 0x0675e000, 0x0100e026, 0x0100e027,
+        0x0100e02c, 0x0100e02d, 0x0100e02f, 0x0100e030, 0x0100e033, 0x0100e034,
+        0x0100e036, 0x0100e037, 0x0100e03b, 0x0100e03c, 0x0100e03e, 0x0100e03f,
+        0x0100e042, 0x0100e043, 0x0100e045, 0x0500e048, 0x0230e201, 0x0630e216,
+        0x0231e201, 0x0631e216, 0x0232e201, 0x0632e216, 0x0261e201, 0x0661e216,
+        0x0263e201, 0x0663e216, 0x0265e201, 0x0665e216, 0x0269e201, 0x0669e216,
+        0x026fe201, 0x066fe216, 0x0273e201, 0x0673e216, 0x0274e201, 0x0674e216,
+        0x0620e200, 0x0625e200, 0x062de200, 0x062ee200, 0x062fe200, 0x0633e200,
+        0x0634e200, 0x0635e200, 0x0636e200, 0x0637e200, 0x0638e200, 0x0639e200,
+        0x063de200, 0x0641e200, 0x065fe200, 0x0662e200, 0x0664e200, 0x0666e200,
+        0x0667e200, 0x0668e200, 0x066ce200, 0x066de200, 0x066ee200, 0x0670e200,
+        0x0672e200, 0x0675e200, 0x0100e226, 0x0100e227, 0x0100e22c, 0x0100e22d,
+        0x0100e22f, 0x0100e230, 0x0100e233, 0x0100e234, 0x0100e236, 0x0100e237,
+        0x0100e23b, 0x0100e23c, 0x0100e23e, 0x0100e23f, 0x0100e242, 0x0100e243,
+        0x0100e245, 0x0500e248, 0x06309900, 0x06319900, 0x06329900, 0x06619900,
+        0x06639900, 0x06659900, 0x06699900, 0x066f9900, 0x06739900, 0x06749900,
+        0x0100990d, 0x0100990e, 0x01009911, 0x01009912, 0x01009914, 0x01009915,
+        0x0100991a, 0x0100991b, 0x0100991d, 0x0100991e, 0x01009921, 0x01009922,
+        0x01009924, 0x01009925, 0x0100992b, 0x0100992e, 0x01009932, 0x01009935,
+        0x0100993a, 0x0100993d, 0x01009941, 0x05009944, 0x0630a100, 0x0631a100,
+        0x0632a100, 0x0661a100, 0x0663a100, 0x0665a100, 0x0669a100, 0x066fa100,
+        0x0673a100, 0x0674a100, 0x0100a10d, 0x0100a10e, 0x0100a111, 0x0100a112,
+        0x0100a114, 0x0100a115, 0x0100a11a, 0x0100a11b, 0x0100a11d, 0x0100a11e,
+        0x0100a121, 0x0100a122, 0x0100a124, 0x0100a125, 0x0100a12b, 0x0100a12e,
+        0x0100a132, 0x0100a135, 0x0100a13a, 0x0100a13d, 0x0100a141, 0x0500a144,
+        0x0630a700, 0x0631a700, 0x0632a700, 0x0661a700, 0x0663a700, 0x0665a700,
+        0x0669a700, 0x066fa700, 0x0673a700, 0x0674a700, 0x0100a70d, 0x0100a70e,
+        0x0100a711, 0x0100a712, 0x0100a714, 0x0100a715, 0x0100a71a, 0x0100a71b,
+        0x0100a71d, 0x0100a71e, 0x0100a721, 0x0100a722, 0x0100a724, 0x0100a725,
+        0x0100a72b, 0x0100a72e, 0x0100a732, 0x0100a735, 0x0100a73a, 0x0100a73d,
+        0x0100a741, 0x0500a744, 0x0630ac00, 0x0631ac00, 0x0632ac00, 0x0661ac00,
+        0x0663ac00, 0x0665ac00, 0x0669ac00, 0x066fac00, 0x0673ac00, 0x0674ac00,
+        0x0100ac0d, 0x0100ac0e, 0x0100ac11, 0x0100ac12, 0x0100ac14, 0x0100ac15,
+        0x0100ac1a, 0x0100ac1b, 0x0100ac1d, 0x0100ac1e, 0x0100ac21, 0x0100ac22,
+        0x0100ac24, 0x0100ac25, 0x0100ac2b, 0x0100ac2e, 0x0100ac32, 0x0100ac35,
+        0x0100ac3a, 0x0100ac3d, 0x0100ac41, 0x0500ac44
+    },
+    /* 106 */
+    {
+        0x0230e002, 0x0230e009, 0x0230e017, 0x0630e028, 0x0231e002, 0x0231e009,
+        0x0231e017, 0x0631e028, 0x0232e002, 0x0232e009, 0x0232e017, 0x0632e028,
+        0x0261e002, 0x0261e009, 0x0261e017, 0x0661e028, 0x0263e002, 0x0263e009,
+        0x0263e017, 0x0663e028, 0x0265e002, 0x0265e009, 0x0265e017, 0x0665e028,
+        0x0269e002, 0x0269e009, 0x0269e017, 0x0669e028, 0x026fe002, 0x026fe009,
+        0x026fe017, 0x066fe028, 0x0273e002, 0x0273e009, 0x0273e017, 0x0673e028,
+        0x0274e002, 0x0274e009, 0x0274e017, 0x0674e028, 0x0220e001, 0x0620e016,
+        0x0225e001, 0x0625e016, 0x022de001, 0x062de016, 0x022ee001, 0x062ee016,
+        0x022fe001, 0x062fe016, 0x0233e001, 0x0633e016, 0x0234e001, 0x0634e016,
+        0x0235e001, 0x0635e016, 0x0236e001, 0x0636e016, 0x0237e001, 0x0637e016,
+        0x0238e001, 0x0638e016, 0x0239e001, 0x0639e016, 0x023de001, 0x063de016,
+        0x0241e001, 0x0641e016, 0x025fe001, 0x065fe016, 0x0262e001, 0x0662e016,
+        0x0264e001, 0x0664e016, 0x0266e001, 0x0666e016, 0x0267e001, 0x0667e016,
+        0x0268e001, 0x0668e016, 0x026ce001, 0x066ce016, 0x026de001, 0x066de016,
+        0x026ee001, 0x066ee016, 0x0270e001, 0x0670e016, 0x0272e001, 0x0672e016,
+        0x0275e001, 0x0675e016, 0x063ae000, 0x0642e000, 0x0643e000, 0x0644e000,
+        0x0645e000, 0x0646e000, 0x0647e000, 0x0648e000, 0x0649e000, 0x064ae000,
+        0x064be000, 0x064ce000, 0x064de000, 0x064ee000, 0x064fe000, 0x0650e000,
+        0x0651e000, 0x0652e000, 0x0653e000, 0x0654e000, 0x0655e000, 0x0656e000,
+        0x0657e000, 0x0659e000, 0x066ae000, 0x066be000, 0x0671e000, 0x0676e000,
+        0x0677e000, 0x0678e000, 0x0679e000, 0x067ae000, 0x0100e046, 0x0100e047,
+        0x0100e049, 0x0500e04a, 0x0230e202, 0x0230e209, 0x0230e217, 0x0630e228,
+        0x0231e202, 0x0231e209, 0x0231e217, 0x0631e228, 0x0232e202, 0x0232e209,
+        0x0232e217, 0x0632e228, 0x0261e202, 0x0261e209, 0x0261e217, 0x0661e228,
+        0x0263e202, 0x0263e209, 0x0263e217, 0x0663e228, 0x0265e202, 0x0265e209,
+        0x0265e217, 0x0665e228, 0x0269e202, 0x0269e209, 0x0269e217, 0x0669e228,
+        0x026fe202, 0x026fe209, 0x026fe217, 0x066fe228, 0x0273e202, 0x0273e209,
+        0x0273e217, 0x0673e228, 0x0274e202, 0x0274e209, 0x0274e217, 0x0674e228,
+        0x0220e201, 0x0620e216, 0x0225e201, 0x0625e216, 0x022de201, 0x062de216,
+        0x022ee201, 0x062ee216, 0x022fe201, 0x062fe216, 0x0233e201, 0x0633e216,
+        0x0234e201, 0x0634e216, 0x0235e201, 0x0635e216, 0x0236e201, 0x0636e216,
+        0x0237e201, 0x0637e216, 0x0238e201, 0x0638e216, 0x0239e201, 0x0639e216,
+        0x023de201, 0x063de216, 0x0241e201, 0x0641e216, 0x025fe201, 0x065fe216,
+        0x0262e201, 0x0662e216, 0x0264e201, 0x0664e216, 0x0266e201, 0x0666e216,
+        0x0267e201, 0x0667e216, 0x0268e201, 0x0668e216, 0x026ce201, 0x066ce216,
+        0x026de201, 0x066de216, 0x026ee201, 0x066ee216, 0x0270e201, 0x0670e216,
+        0x0272e201, 0x0672e216, 0x0275e201, 0x0675e216, 0x063ae200, 0x0642e200,
+        0x0643e200, 0x0644e200, 0x0645e200, 0x0646e200, 0x0647e200, 0x0648e200,
+        0x0649e200, 0x064ae200, 0x064be200, 0x064ce200, 0x064de200, 0x064ee200,
+        0x064fe200, 0x0650e200, 0x0651e200, 0x0652e200, 0x0653e200, 0x0654e200,
+        0x0655e200, 0x0656e200, 0x0657e200, 0x0659e200, 0x066ae200, 0x066be200,
+        0x0671e200, 0x0676e200, 0x0677e200, 0x0678e200, 0x0679e200, 0x067ae200,
+        0x0100e246, 0x0100e247, 0x0100e249, 0x0500e24a
+    },
+    /* 107 */
+    {
+        0x02309901, 0x06309916, 0x02319901, 0x06319916, 0x02329901, 0x06329916,
+        0x02619901, 0x06619916, 0x02639901, 0x06639916, 0x02659901, 0x06659916,
+        0x02699901, 0x06699916, 0x026f9901, 0x066f9916, 0x02739901, 0x06739916,
+        0x02749901, 0x06749916, 0x06209900, 0x06259900, 0x062d9900, 0x062e9900,
+        0x062f9900, 0x06339900, 0x06349900, 0x06359900, 0x06369900, 0x06379900,
+        0x06389900, 0x06399900, 0x063d9900, 0x06419900, 0x065f9900, 0x06629900,
+        0x06649900, 0x06669900, 0x06679900, 0x06689900, 0x066c9900, 0x066d9900,
+        0x066e9900, 0x06709900, 0x06729900, 0x06759900, 0x01009926, 0x01009927,
+        0x0100992c, 0x0100992d, 0x0100992f, 0x01009930, 0x01009933, 0x01009934,
+        0x01009936, 0x01009937, 0x0100993b, 0x0100993c, 0x0100993e, 0x0100993f,
+        0x01009942, 0x01009943, 0x01009945, 0x05009948, 0x0230a101, 0x0630a116,
+        0x0231a101, 0x0631a116, 0x0232a101, 0x0632a116, 0x0261a101, 0x0661a116,
+        0x0263a101, 0x0663a116, 0x0265a101, 0x0665a116, 0x0269a101, 0x0669a116,
+        0x026fa101, 0x066fa116, 0x0273a101, 0x0673a116, 0x0274a101, 0x0674a116,
+        0x0620a100, 0x0625a100, 0x062da100, 0x062ea100, 0x062fa100, 0x0633a100,
+        0x0634a100, 0x0635a100, 0x0636a100, 0x0637a100, 0x0638a100, 0x0639a100,
+        0x063da100, 0x0641a100, 0x065fa100, 0x0662a100, 0x0664a100, 0x0666a100,
+        0x0667a100, 0x0668a100, 0x066ca100, 0x066da100, 0x066ea100, 0x0670a100,
+        0x0672a100, 0x0675a100, 0x0100a126, 0x0100a127, 0x0100a12c, 0x0100a12d,
+        0x0100a12f, 0x0100a130, 0x0100a133, 0x0100a134, 0x0100a136, 0x0100a137,
+        0x0100a13b, 0x0100a13c, 0x0100a13e, 0x0100a13f, 0x0100a142, 0x0100a143,
+        0x0100a145, 0x0500a148, 0x0230a701, 0x0630a716, 0x0231a701, 0x0631a716,
+        0x0232a701, 0x0632a716, 0x0261a701, 0x0661a716, 0x0263a701, 0x0663a716,
+        0x0265a701, 0x0665a716, 0x0269a701, 0x0669a716, 0x026fa701, 0x066fa716,
+        0x0273a701, 0x0673a716, 0x0274a701, 0x0674a716, 0x0620a700, 0x0625a700,
+        0x062da700, 0x062ea700, 0x062fa700, 0x0633a700, 0x0634a700, 0x0635a700,
+        0x0636a700, 0x0637a700, 0x0638a700, 0x0639a700, 0x063da700, 0x0641a700,
+        0x065fa700, 0x0662a700, 0x0664a700, 0x0666a700, 0x0667a700, 0x0668a700,
+        0x066ca700, 0x066da700, 0x066ea700, 0x0670a700, 0x0672a700, 0x0675a700,
+        0x0100a726, 0x0100a727, 0x0100a72c, 0x0100a72d, 0x0100a72f, 0x0100a730,
+        0x0100a733, 0x0100a734, 0x0100a736, 0x0100a737, 0x0100a73b, 0x0100a73c,
+        0x0100a73e, 0x0100a73f, 0x0100a742, 0x0100a743, 0x0100a745, 0x0500a748,
+        0x0230ac01, 0x0630ac16, 0x0231ac01, 0x0631ac16, 0x0232ac01, 0x0632ac16,
+        0x0261ac01, 0x0661ac16, 0x0263ac01, 0x0663ac16, 0x0265ac01, 0x0665ac16,
+        0x0269ac01, 0x0669ac16, 0x026fac01, 0x066fac16, 0x0273ac01, 0x0673ac16,
+        0x0274ac01, 0x0674ac16, 0x0620ac00, 0x0625ac00, 0x062dac00, 0x062eac00,
+        0x062fac00, 0x0633ac00, 0x0634ac00, 0x0635ac00, 0x0636ac00, 0x0637ac00,
+        0x0638ac00, 0x0639ac00, 0x063dac00, 0x0641ac00, 0x065fac00, 0x0662ac00,
+        0x0664ac00, 0x0666ac00, 0x0667ac00, 0x0668ac00, 0x066cac00, 0x066dac00,
+        0x066eac00, 0x0670ac00, 0x0672ac00, 0x0675ac00, 0x0100ac26, 0x0100ac27,
+        0x0100ac2c, 0x0100ac2d, 0x0100ac2f, 0x0100ac30, 0x0100ac33, 0x0100ac34,
+        0x0100ac36, 0x0100ac37, 0x0100ac3b, 0x0100ac3c, 0x0100ac3e, 0x0100ac3f,
+        0x0100ac42, 0x0100ac43, 0x0100ac45, 0x0500ac48
+    },
+    /* 108 */
+    {
+        0x02309902, 0x02309909, 0x02309917, 0x06309928, 0x02319902, 0x02319909,
+        0x02319917, 0x06319928, 0x02329902, 0x02329909, 0x02329917, 0x06329928,
+        0x02619902, 0x02619909, 0x02619917, 0x06619928, 0x02639902, 0x02639909,
+        0x02639917, 0x06639928, 0x02659902, 0x02659909, 0x02659917, 0x06659928,
+        0x02699902, 0x02699909, 0x02699917, 0x06699928, 0x026f9902, 0x026f9909,
+        0x026f9917, 0x066f9928, 0x02739902, 0x02739909, 0x02739917, 0x06739928,
+        0x02749902, 0x02749909, 0x02749917, 0x06749928, 0x02209901, 0x06209916,
+        0x02259901, 0x06259916, 0x022d9901, 0x062d9916, 0x022e9901, 0x062e9916,
+        0x022f9901, 0x062f9916, 0x02339901, 0x06339916, 0x02349901, 0x06349916,
+        0x02359901, 0x06359916, 0x02369901, 0x06369916, 0x02379901, 0x06379916,
+        0x02389901, 0x06389916, 0x02399901, 0x06399916, 0x023d9901, 0x063d9916,
+        0x02419901, 0x06419916, 0x025f9901, 0x065f9916, 0x02629901, 0x06629916,
+        0x02649901, 0x06649916, 0x02669901, 0x06669916, 0x02679901, 0x06679916,
+        0x02689901, 0x06689916, 0x026c9901, 0x066c9916, 0x026d9901, 0x066d9916,
+        0x026e9901, 0x066e9916, 0x02709901, 0x06709916, 0x02729901, 0x06729916,
+        0x02759901, 0x06759916, 0x063a9900, 0x06429900, 0x06439900, 0x06449900,
+        0x06459900, 0x06469900, 0x06479900, 0x06489900, 0x06499900, 0x064a9900,
+        0x064b9900, 0x064c9900, 0x064d9900, 0x064e9900, 0x064f9900, 0x06509900,
+        0x06519900, 0x06529900, 0x06539900, 0x06549900, 0x06559900, 0x06569900,
+        0x06579900, 0x06599900, 0x066a9900, 0x066b9900, 0x06719900, 0x06769900,
+        0x06779900, 0x06789900, 0x06799900, 0x067a9900, 0x01009946, 0x01009947,
+        0x01009949, 0x0500994a, 0x0230a102, 0x0230a109, 0x0230a117, 0x0630a128,
+        0x0231a102, 0x0231a109, 0x0231a117, 0x0631a128, 0x0232a102, 0x0232a109,
+        0x0232a117, 0x0632a128, 0x0261a102, 0x0261a109, 0x0261a117, 0x0661a128,
+        0x0263a102, 0x0263a109, 0x0263a117, 0x0663a128, 0x0265a102, 0x0265a109,
+        0x0265a117, 0x0665a128, 0x0269a102, 0x0269a109, 0x0269a117, 0x0669a128,
+        0x026fa102, 0x026fa109, 0x026fa117, 0x066fa128, 0x0273a102, 0x0273a109,
+        0x0273a117, 0x0673a128, 0x0274a102, 0x0274a109, 0x0274a117, 0x0674a128,
+        0x0220a101, 0x0620a116, 0x0225a101, 0x0625a116, 0x022da101, 0x062da116,
+        0x022ea101, 0x062ea116, 0x022fa101, 0x062fa116, 0x0233a101, 0x0633a116,
+        0x0234a101, 0x0634a116, 0x0235a101, 0x0635a116, 0x0236a101, 0x0636a116,
+        0x0237a101, 0x0637a116, 0x0238a101, 0x0638a116, 0x0239a101, 0x0639a116,
+        0x023da101, 0x063da116, 0x0241a101, 0x0641a116, 0x025fa101, 0x065fa116,
+        0x0262a101, 0x0662a116, 0x0264a101, 0x0664a116, 0x0266a101, 0x0666a116,
+        0x0267a101, 0x0667a116, 0x0268a101, 0x0668a116, 0x026ca101, 0x066ca116,
+        0x026da101, 0x066da116, 0x026ea101, 0x066ea116, 0x0270a101, 0x0670a116,
+        0x0272a101, 0x0672a116, 0x0275a101, 0x0675a116, 0x063aa100, 0x0642a100,
+        0x0643a100, 0x0644a100, 0x0645a100, 0x0646a100, 0x0647a100, 0x0648a100,
+        0x0649a100, 0x064aa100, 0x064ba100, 0x064ca100, 0x064da100, 0x064ea100,
+        0x064fa100, 0x0650a100, 0x0651a100, 0x0652a100, 0x0653a100, 0x0654a100,
+        0x0655a100, 0x0656a100, 0x0657a100, 0x0659a100, 0x066aa100, 0x066ba100,
+        0x0671a100, 0x0676a100, 0x0677a100, 0x0678a100, 0x0679a100, 0x067aa100,
+        0x0100a146, 0x0100a147, 0x0100a149, 0x0500a14a
+    },
+    /* 109 */
+    {
+        0x0230a702, 0x0230a709, 0x0230a717, 0x0630a728, 0x0231a702, 0x0231a709,
+        0x0231a717, 0x0631a728, 0x0232a702, 0x0232a709, 0x0232a717, 0x0632a728,
+        0x0261a702, 0x0261a709, 0x0261a717, 0x0661a728, 0x0263a702, 0x0263a709,
+        0x0263a717, 0x0663a728, 0x0265a702, 0x0265a709, 0x0265a717, 0x0665a728,
+        0x0269a702, 0x0269a709, 0x0269a717, 0x0669a728, 0x026fa702, 0x026fa709,
+        0x026fa717, 0x066fa728, 0x0273a702, 0x0273a709, 0x0273a717, 0x0673a728,
+        0x0274a702, 0x0274a709, 0x0274a717, 0x0674a728, 0x0220a701, 0x0620a716,
+        0x0225a701, 0x0625a716, 0x022da701, 0x062da716, 0x022ea701, 0x062ea716,
+        0x022fa701, 0x062fa716, 0x0233a701, 0x0633a716, 0x0234a701, 0x0634a716,
+        0x0235a701, 0x0635a716, 0x0236a701, 0x0636a716, 0x0237a701, 0x0637a716,
+        0x0238a701, 0x0638a716, 0x0239a701, 0x0639a716, 0x023da701, 0x063da716,
+        0x0241a701, 0x0641a716, 0x025fa701, 0x065fa716, 0x0262a701, 0x0662a716,
+        0x0264a701, 0x0664a716, 0x0266a701, 0x0666a716, 0x0267a701, 0x0667a716,
+        0x0268a701, 0x0668a716, 0x026ca701, 0x066ca716, 0x026da701, 0x066da716,
+        0x026ea701, 0x066ea716, 0x0270a701, 0x0670a716, 0x0272a701, 0x0672a716,
+        0x0275a701, 0x0675a716, 0x063aa700, 0x0642a700, 0x0643a700, 0x0644a700,
+        0x0645a700, 0x0646a700, 0x0647a700, 0x0648a700, 0x0649a700, 0x064aa700,
+        0x064ba700, 0x064ca700, 0x064da700, 0x064ea700, 0x064fa700, 0x0650a700,
+        0x0651a700, 0x0652a700, 0x0653a700, 0x0654a700, 0x0655a700, 0x0656a700,
+        0x0657a700, 0x0659a700, 0x066aa700, 0x066ba700, 0x0671a700, 0x0676a700,
+        0x0677a700, 0x0678a700, 0x0679a700, 0x067aa700, 0x0100a746, 0x0100a747,
+        0x0100a749, 0x0500a74a, 0x0230ac02, 0x0230ac09, 0x0230ac17, 0x0630ac28,
+        0x0231ac02, 0x0231ac09, 0x0231ac17, 0x0631ac28, 0x0232ac02, 0x0232ac09,
+        0x0232ac17, 0x0632ac28, 0x0261ac02, 0x0261ac09, 0x0261ac17, 0x0661ac28,
+        0x0263ac02, 0x0263ac09, 0x0263ac17, 0x0663ac28, 0x0265ac02, 0x0265ac09,
+        0x0265ac17, 0x0665ac28, 0x0269ac02, 0x0269ac09, 0x0269ac17, 0x0669ac28,
+        0x026fac02, 0x026fac09, 0x026fac17, 0x066fac28, 0x0273ac02, 0x0273ac09,
+        0x0273ac17, 0x0673ac28, 0x0274ac02, 0x0274ac09, 0x0274ac17, 0x0674ac28,
+        0x0220ac01, 0x0620ac16, 0x0225ac01, 0x0625ac16, 0x022dac01, 0x062dac16,
+        0x022eac01, 0x062eac16, 0x022fac01, 0x062fac16, 0x0233ac01, 0x0633ac16,
+        0x0234ac01, 0x0634ac16, 0x0235ac01, 0x0635ac16, 0x0236ac01, 0x0636ac16,
+        0x0237ac01, 0x0637ac16, 0x0238ac01, 0x0638ac16, 0x0239ac01, 0x0639ac16,
+        0x023dac01, 0x063dac16, 0x0241ac01, 0x0641ac16, 0x025fac01, 0x065fac16,
+        0x0262ac01, 0x0662ac16, 0x0264ac01, 0x0664ac16, 0x0266ac01, 0x0666ac16,
+        0x0267ac01, 0x0667ac16, 0x0268ac01, 0x0668ac16, 0x026cac01, 0x066cac16,
+        0x026dac01, 0x066dac16, 0x026eac01, 0x066eac16, 0x0270ac01, 0x0670ac16,
+        0x0272ac01, 0x0672ac16, 0x0275ac01, 0x0675ac16, 0x063aac00, 0x0642ac00,
+        0x0643ac00, 0x0644ac00, 0x0645ac00, 0x0646ac00, 0x0647ac00, 0x0648ac00,
+        0x0649ac00, 0x064aac00, 0x064bac00, 0x064cac00, 0x064dac00, 0x064eac00,
+        0x064fac00, 0x0650ac00, 0x0651ac00, 0x0652ac00, 0x0653ac00, 0x0654ac00,
+        0x0655ac00, 0x0656ac00, 0x0657ac00, 0x0659ac00, 0x066aac00, 0x066bac00,
+        0x0671ac00, 0x0676ac00, 0x0677ac00, 0x0678ac00, 0x0679ac00, 0x067aac00,
+        0x0100ac46, 0x0100ac47, 0x0100ac49, 0x0500ac4a
+    },
+    /* 110 */
+    {
+        0x0100b003, 0x0100b006, 0x0100b00a, 0x0100b00f, 0x0100b018, 0x0100b01f,
+        0x0100b029, 0x0500b038, 0x0100b103, 0x0100b106, 0x0100b10a, 0x0100b10f,
+        0x0100b118, 0x0100b11f, 0x0100b129, 0x0500b138, 0x0100b303, 0x0100b306,
+        0x0100b30a, 0x0100b30f, 0x0100b318, 0x0100b31f, 0x0100b329, 0x0500b338,
+        0x0100d103, 0x0100d106, 0x0100d10a, 0x0100d10f, 0x0100d118, 0x0100d11f,
+        0x0100d129, 0x0500d138, 0x0100d803, 0x0100d806, 0x0100d80a, 0x0100d80f,
+        0x0100d818, 0x0100d81f, 0x0100d829, 0x0500d838, 0x0100d903, 0x0100d906,
+        0x0100d90a, 0x0100d90f, 0x0100d918, 0x0100d91f, 0x0100d929, 0x0500d938,
+        0x0100e303, 0x0100e306, 0x0100e30a, 0x0100e30f, 0x0100e318, 0x0100e31f,
+        0x0100e329, 0x0500e338, 0x0100e503, 0x0100e506, 0x0100e50a, 0x0100e50f,
+        0x0100e518, 0x0100e51f, 0x0100e529, 0x0500e538, 0x0100e603, 0x0100e606,
+        0x0100e60a, 0x0100e60f, 0x0100e618, 0x0100e61f, 0x0100e629, 0x0500e638,
+        0x01008102, 0x01008109, 0x01008117, 0x05008128, 0x01008402, 0x01008409,
+        0x01008417, 0x05008428, 0x01008502, 0x01008509, 0x01008517, 0x05008528,
+        0x01008602, 0x01008609, 0x01008617, 0x05008628, 0x01008802, 0x01008809,
+        0x01008817, 0x05008828, 0x01009202, 0x01009209, 0x01009217, 0x05009228,
+        0x01009a02, 0x01009a09, 0x01009a17, 0x05009a28, 0x01009c02, 0x01009c09,
+        0x01009c17, 0x05009c28, 0x0100a002, 0x0100a009, 0x0100a017, 0x0500a028,
+        0x0100a302, 0x0100a309, 0x0100a317, 0x0500a328, 0x0100a402, 0x0100a409,
+        0x0100a417, 0x0500a428, 0x0100a902, 0x0100a909, 0x0100a917, 0x0500a928,
+        0x0100aa02, 0x0100aa09, 0x0100aa17, 0x0500aa28, 0x0100ad02, 0x0100ad09,
+        0x0100ad17, 0x0500ad28, 0x0100b202, 0x0100b209, 0x0100b217, 0x0500b228,
+        0x0100b502, 0x0100b509, 0x0100b517, 0x0500b528, 0x0100b902, 0x0100b909,
+        0x0100b917, 0x0500b928, 0x0100ba02, 0x0100ba09, 0x0100ba17, 0x0500ba28,
+        0x0100bb02, 0x0100bb09, 0x0100bb17, 0x0500bb28, 0x0100bd02, 0x0100bd09,
+        0x0100bd17, 0x0500bd28, 0x0100be02, 0x0100be09, 0x0100be17, 0x0500be28,
+        0x0100c402, 0x0100c409, 0x0100c417, 0x0500c428, 0x0100c602, 0x0100c609,
+        0x0100c617, 0x0500c628, 0x0100e402, 0x0100e409, 0x0100e417, 0x0500e428,
+        0x0100e802, 0x0100e809, 0x0100e817, 0x0500e828, 0x0100e902, 0x0100e909,
+        0x0100e917, 0x0500e928, 0x01000101, 0x05000116, 0x01008701, 0x05008716,
+        0x01008901, 0x05008916, 0x01008a01, 0x05008a16, 0x01008b01, 0x05008b16,
+        0x01008c01, 0x05008c16, 0x01008d01, 0x05008d16, 0x01008f01, 0x05008f16,
+        0x01009301, 0x05009316, 0x01009501, 0x05009516, 0x01009601, 0x05009616,
+        0x01009701, 0x05009716, 0x01009801, 0x05009816, 0x01009b01, 0x05009b16,
+        0x01009d01, 0x05009d16, 0x01009e01, 0x05009e16, 0x0100a501, 0x0500a516,
+        0x0100a601, 0x0500a616, 0x0100a801, 0x0500a816, 0x0100ae01, 0x0500ae16,
+        0x0100af01, 0x0500af16, 0x0100b401, 0x0500b416, 0x0100b601, 0x0500b616,
+        0x0100b701, 0x0500b716, 0x0100bc01, 0x0500bc16, 0x0100bf01, 0x0500bf16,
+        0x0100c501, 0x0500c516, 0x0100e701, 0x0500e716, 0x0100ef01, 0x0500ef16,
+        0x05000900, 0x05008e00, 0x05009000, 0x05009100, 0x05009400, 0x05009f00,
+        0x0500ab00, 0x0500ce00, 0x0500d700, 0x0500e100, 0x0500ec00, 0x0500ed00,
+        0x000000bc, 0x000000bd, 0x000000c1, 0x000000c4, 0x000000c8, 0x000000cb,
+        0x000000d1, 0x000000d8, 0x000000e0, 0x040000ee
+    },
+    /* 111 */
+    {
+        0x0100b004, 0x0100b005, 0x0100b007, 0x0100b008, 0x0100b00b, 0x0100b00c,
+        0x0100b010, 0x0100b013, 0x0100b019, 0x0100b01c, 0x0100b020, 0x0100b023,
+        0x0100b02a, 0x0100b031, 0x0100b039, 0x0500b040, 0x0100b104, 0x0100b105,
+        0x0100b107, 0x0100b108, 0x0100b10b, 0x0100b10c, 0x0100b110, 0x0100b113,
+        0x0100b119, 0x0100b11c, 0x0100b120, 0x0100b123, 0x0100b12a, 0x0100b131,
+        0x0100b139, 0x0500b140, 0x0100b304, 0x0100b305, 0x0100b307, 0x0100b308,
+        0x0100b30b, 0x0100b30c, 0x0100b310, 0x0100b313, 0x0100b319, 0x0100b31c,
+        0x0100b320, 0x0100b323, 0x0100b32a, 0x0100b331, 0x0100b339, 0x0500b340,
+        0x0100d104, 0x0100d105, 0x0100d107, 0x0100d108, 0x0100d10b, 0x0100d10c,
+        0x0100d110, 0x0100d113, 0x0100d119, 0x0100d11c, 0x0100d120, 0x0100d123,
+        0x0100d12a, 0x0100d131, 0x0100d139, 0x0500d140, 0x0100d804, 0x0100d805,
+        0x0100d807, 0x0100d808, 0x0100d80b, 0x0100d80c, 0x0100d810, 0x0100d813,
+        0x0100d819, 0x0100d81c, 0x0100d820, 0x0100d823, 0x0100d82a, 0x0100d831,
+        0x0100d839, 0x0500d840, 0x0100d904, 0x0100d905, 0x0100d907, 0x0100d908,
+        0x0100d90b, 0x0100d90c, 0x0100d910, 0x0100d913, 0x0100d919, 0x0100d91c,
+        0x0100d920, 0x0100d923, 0x0100d92a, 0x0100d931, 0x0100d939, 0x0500d940,
+        0x0100e304, 0x0100e305, 0x0100e307, 0x0100e308, 0x0100e30b, 0x0100e30c,
+        0x0100e310, 0x0100e313, 0x0100e319, 0x0100e31c, 0x0100e320, 0x0100e323,
+        0x0100e32a, 0x0100e331, 0x0100e339, 0x0500e340, 0x0100e504, 0x0100e505,
+        0x0100e507, 0x0100e508, 0x0100e50b, 0x0100e50c, 0x0100e510, 0x0100e513,
+        0x0100e519, 0x0100e51c, 0x0100e520, 0x0100e523, 0x0100e52a, 0x0100e531,
+        0x0100e539, 0x0500e540, 0x0100e604, 0x0100e605, 0x0100e607, 0x0100e608,
+        0x0100e60b, 0x0100e60c, 0x0100e610, 0x0100e613, 0x0100e619, 0x0100e61c,
+        0x0100e620, 0x0100e623, 0x0100e62a, 0x0100e631, 0x0100e639, 0x0500e640,
+        0x01008103, 0x01008106, 0x0100810a, 0x0100810f, 0x01008118, 0x0100811f,
+        0x01008129, 0x05008138, 0x01008403, 0x01008406, 0x0100840a, 0x0100840f,
+        0x01008418, 0x0100841f, 0x01008429, 0x05008438, 0x01008503, 0x01008506,
+        0x0100850a, 0x0100850f, 0x01008518, 0x0100851f, 0x01008529, 0x05008538,
+        0x01008603, 0x01008606, 0x0100860a, 0x0100860f, 0x01008618, 0x0100861f,
+        0x01008629, 0x05008638, 0x01008803, 0x01008806, 0x0100880a, 0x0100880f,
+        0x01008818, 0x0100881f, 0x01008829, 0x05008838, 0x01009203, 0x01009206,
+        0x0100920a, 0x0100920f, 0x01009218, 0x0100921f, 0x01009229, 0x05009238,
+        0x01009a03, 0x01009a06, 0x01009a0a, 0x01009a0f, 0x01009a18, 0x01009a1f,
+        0x01009a29, 0x05009a38, 0x01009c03, 0x01009c06, 0x01009c0a, 0x01009c0f,
+        0x01009c18, 0x01009c1f, 0x01009c29, 0x05009c38, 0x0100a003, 0x0100a006,
+        0x0100a00a, 0x0100a00f, 0x0100a018, 0x0100a01f, 0x0100a029, 0x0500a038,
+        0x0100a303, 0x0100a306, 0x0100a30a, 0x0100a30f, 0x0100a318, 0x0100a31f,
+        0x0100a329, 0x0500a338, 0x0100a403, 0x0100a406, 0x0100a40a, 0x0100a40f,
+        0x0100a418, 0x0100a41f, 0x0100a429, 0x0500a438, 0x0100a903, 0x0100a906,
+        0x0100a90a, 0x0100a90f, 0x0100a918, 0x0100a91f, 0x0100a929, 0x0500a938,
+        0x0100aa03, 0x0100aa06, 0x0100aa0a, 0x0100aa0f, 0x0100aa18, 0x0100aa1f,
+        0x0100aa29, 0x0500aa38, 0x0100ad03, 0x0100ad06, 0x0100ad0a, 0x0100ad0f,
+        0x0100ad18, 0x0100ad1f, 0x0100ad29, 0x0500ad38
+    },
+    /* 112 */
+    {
+        0x0630b000, 0x0631b000, 0x0632b000, 0x0661b000, 0x0663b000, 0x0665b000,
+        0x0669b000, 0x066fb000, 0x0673b000, 0x0674b000, 0x0100b00d, 0x0100b00e,
+        0x0100b011, 0x0100b012, 0x0100b014, 0x0100b015, 0x0100b01a, 0x0100b01b,
+        0x0100b01d, 0x0100b01e, 0x0100b021, 0x0100b022, 0x0100b024, 0x0100b025,
+        0x0100b02b, 0x0100b02e, 0x0100b032, 0x0100b035, 0x0100b03a, 0x0100b03d,
+        0x0100b041, 0x0500b044, 0x0630b100, 0x0631b100, 0x0632b100, 0x0661b100,
+        0x0663b100, 0x0665b100, 0x0669b100, 0x066fb100, 0x0673b100, 0x0674b100,
+        0x0100b10d, 0x0100b10e, 0x0100b111, 0x0100b112, 0x0100b114, 0x0100b115,
+        0x0100b11a, 0x0100b11b, 0x0100b11d, 0x0100b11e, 0x0100b121, 0x0100b122,
+        0x0100b124, 0x0100b125, 0x0100b12b, 0x0100b12e, 0x0100b132, 0x0100b135,
+        0x0100b13a, 0x0100b13d, 0x0100b141, 0x0500b144, 0x0630b300, 0x0631b300,
+        0x0632b300, 0x0661b300, 0x0663b300, 0x0665b300, 0x0669b300, 0x066fb300,
+        0x0673b300, 0x0674b300, 0x0100b30d, 0x0100b30e, 0x0100b311, 0x0100b312,
+        0x0100b314, 0x0100b315, 0x0100b31a, 0x0100b31b, 0x0100b31d, 0x0100b31e,
+        0x0100b321, 0x0100b322, 0x0100b324, 0x0100b325, 0x0100b32b, 0x0100b32e,
+        0x0100b332, 0x0100b335, 0x0100b33a, 0x0100b33d, 0x0100b341, 0x0500b344,
+        0x0630d100, 0x0631d100, 0x0632d100, 0x0661d100, 0x0663d100, 0x0665d100,
+        0x0669d100, 0x066fd100, 0x0673d100, 0x0674d100, 0x0100d10d, 0x0100d10e,
+        0x0100d111, 0x0100d112, 0x0100d114, 0x0100d115, 0x0100d11a, 0x0100d11b,
+        0x0100d11d, 0x0100d11e, 0x0100d121, 0x0100d122, 0x0100d124, 0x0100d125,
+        0x0100d12b, 0x0100d12e, 0x0100d132, 0x0100d135, 0x0100d13a, 0x0100d13d,
+        0x0100d141, 0x0500d144, 0x0630d800, 0x0631d800, 0x0632d800, 0x0661d800,
+        0x0663d800, 0x0665d800, 0x0669d800, 0x066fd800, 0x0673d800, 0x0674d800,
+        0x0100d80d, 0x0100d80e, 0x0100d811, 0x0100d812, 0x0100d814, 0x0100d815,
+        0x0100d81a, 0x0100d81b, 0x0100d81d, 0x0100d81e, 0x0100d821, 0x0100d822,
+        0x0100d824, 0x0100d825, 0x0100d82b, 0x0100d82e, 0x0100d832, 0x0100d835,
+        0x0100d83a, 0x0100d83d, 0x0100d841, 0x0500d844, 0x0630d900, 0x0631d900,
+        0x0632d900, 0x0661d900, 0x0663d900, 0x0665d900, 0x0669d900, 0x066fd900,
+        0x0673d900, 0x0674d900, 0x0100d90d, 0x0100d90e, 0x0100d911, 0x0100d912,
+        0x0100d914, 0x0100d915, 0x0100d91a, 0x0100d91b, 0x0100d91d, 0x0100d91e,
+        0x0100d921, 0x0100d922, 0x0100d924, 0x0100d925, 0x0100d92b, 0x0100d92e,
+        0x0100d932, 0x0100d935, 0x0100d93a, 0x0100d93d, 0x0100d941, 0x0500d944,
+        0x0630e300, 0x0631e300, 0x0632e300, 0x0661e300, 0x0663e300, 0x0665e300,
+        0x0669e300, 0x066fe300, 0x0673e300, 0x0674e300, 0x0100e30d, 0x0100e30e,
+        0x0100e311, 0x0100e312, 0x0100e314, 0x0100e315, 0x0100e31a, 0x0100e31b,
+        0x0100e31d, 0x0100e31e, 0x0100e321, 0x0100e322, 0x0100e324, 0x0100e325,
+        0x0100e32b, 0x0100e32e, 0x0100e332, 0x0100e335, 0x0100e33a, 0x0100e33d,
+        0x0100e341, 0x0500e344, 0x0630e500, 0x0631e500, 0x0632e500, 0x0661e500,
+        0x0663e500, 0x0665e500, 0x0669e500, 0x066fe500, 0x0673e500, 0x0674e500,
+        0x0100e50d, 0x0100e50e, 0x0100e511, 0x0100e512, 0x0100e514, 0x0100e515,
+        0x0100e51a, 0x0100e51b, 0x0100e51d, 0x0100e51e, 0x0100e521, 0x0100e522,
+        0x0100e524, 0x0100e525, 0x0100e52b, 0x0100e52e, 0x0100e532, 0x0100e535,
+        0x0100e53a, 0x0100e53d, 0x0100e541, 0x0500e544
+    },
+    /* 113 */
+    {
+        0x0230b001, 0x0630b016, 0x0231b001, 0x0631b016, 0x0232b001, 0x0632b016,
+        0x0261b001, 0x0661b016, 0x0263b001, 0x0663b016, 0x0265b001, 0x0665b016,
+        0x0269b001, 0x0669b016, 0x026fb001, 0x066fb016, 0x0273b001, 0x0673b016,
+        0x0274b001, 0x0674b016, 0x0620b000, 0x0625b000, 0x062db000, 0x062eb000,
+        0x062fb000, 0x0633b000, 0x0634b000, 0x0635b000, 0x0636b000, 0x0637b000,
+        0x0638b000, 0x0639b000, 0x063db000, 0x0641b000, 0x065fb000, 0x0662b000,
+        0x0664b000, 0x0666b000, 0x0667b000, 0x0668b000, 0x066cb000, 0x066db000,
+        0x066eb000, 0x0670b000, 0x0672b000, 0x0675b000, 0x0100b026, 0x0100b027,
+        0x0100b02c, 0x0100b02d, 0x0100b02f, 0x0100b030, 0x0100b033, 0x0100b034,
+        0x0100b036, 0x0100b037, 0x0100b03b, 0x0100b03c, 0x0100b03e, 0x0100b03f,
+        0x0100b042, 0x0100b043, 0x0100b045, 0x0500b048, 0x0230b101, 0x0630b116,
+        0x0231b101, 0x0631b116, 0x0232b101, 0x0632b116, 0x0261b101, 0x0661b116,
+        0x0263b101, 0x0663b116, 0x0265b101, 0x0665b116, 0x0269b101, 0x0669b116,
+        0x026fb101, 0x066fb116, 0x0273b101, 0x0673b116, 0x0274b101, 0x0674b116,
+        0x0620b100, 0x0625b100, 0x062db100, 0x062eb100, 0x062fb100, 0x0633b100,
+        0x0634b100, 0x0635b100, 0x0636b100, 0x0637b100, 0x0638b100, 0x0639b100,
+        0x063db100, 0x0641b100, 0x065fb100, 0x0662b100, 0x0664b100, 0x0666b100,
+        0x0667b100, 0x0668b100, 0x066cb100, 0x066db100, 0x066eb100, 0x0670b100,
+        0x0672b100, 0x0675b100, 0x0100b126, 0x0100b127, 0x0100b12c, 0x0100b12d,
+        0x0100b12f, 0x0100b130, 0x0100b133, 0x0100b134, 0x0100b136, 0x0100b137,
+        0x0100b13b, 0x0100b13c, 0x0100b13e, 0x0100b13f, 0x0100b142, 0x0100b143,
+        0x0100b145, 0x0500b148, 0x0230b301, 0x0630b316, 0x0231b301, 0x0631b316,
+        0x0232b301, 0x0632b316, 0x0261b301, 0x0661b316, 0x0263b301, 0x0663b316,
+        0x0265b301, 0x0665b316, 0x0269b301, 0x0669b316, 0x026fb301, 0x066fb316,
+        0x0273b301, 0x0673b316, 0x0274b301, 0x0674b316, 0x0620b300, 0x0625b300,
+        0x062db300, 0x062eb300, 0x062fb300, 0x0633b300, 0x0634b300, 0x0635b300,
+        0x0636b300, 0x0637b300, 0x0638b300, 0x0639b300, 0x063db300, 0x0641b300,
+        0x065fb300, 0x0662b300, 0x0664b300, 0x0666b300, 0x0667b300, 0x0668b300,
+        0x066cb300, 0x066db300, 0x066eb300, 0x0670b300, 0x0672b300, 0x0675b300,
+        0x0100b326, 0x0100b327, 0x0100b32c, 0x0100b32d, 0x0100b32f, 0x0100b330,
+        0x0100b333, 0x0100b334, 0x0100b336, 0x0100b337, 0x0100b33b, 0x0100b33c,
+        0x0100b33e, 0x0100b33f, 0x0100b342, 0x0100b343, 0x0100b345, 0x0500b348,
+        0x0230d101, 0x0630d116, 0x0231d101, 0x0631d116, 0x0232d101, 0x0632d116,
+        0x0261d101, 0x0661d116, 0x0263d101, 0x0663d116, 0x0265d101, 0x0665d116,
+        0x0269d101, 0x0669d116, 0x026fd101, 0x066fd116, 0x0273d101, 0x0673d116,
+        0x0274d101, 0x0674d116, 0x0620d100, 0x0625d100, 0x062dd100, 0x062ed100,
+        0x062fd100, 0x0633d100, 0x0634d100, 0x0635d100, 0x0636d100, 0x0637d100,
+        0x0638d100, 0x0639d100, 0x063dd100, 0x0641d100, 0x065fd100, 0x0662d100,
+        0x0664d100, 0x0666d100, 0x0667d100, 0x0668d100, 0x066cd100, 0x066dd100,
+        0x066ed100, 0x0670d100, 0x0672d100, 0x0675d100, 0x0100d126, 0x0100d127,
+        0x0100d12c, 0x0100d12d, 0x0100d12f, 0x0100d130, 0x0100d133, 0x0100d134,
+        0x0100d136, 0x0100d137, 0x0100d13b, 0x0100d13c, 0x0100d13e, 0x0100d13f,
+        0x0100d142, 0x0100d143, 0x0100d145, 0x0500d148
+    },
+    /* 114 */
+    {
+        0x0230b002, 0x0230b009, 0x0230b017, 0x0630b028, 0x0231b002, 0x0231b009,
+        0x0231b017, 0x0631b028, 0x0232b002, 0x0232b009, 0x0232b017, 0x0632b028,
+        0x0261b002, 0x0261b009, 0x0261b017, 0x0661b028, 0x0263b002, 0x0263b009,
+        0x0263b017, 0x0663b028, 0x0265b002, 0x0265b009, 0x0265b017, 0x0665b028,
+        0x0269b002, 0x0269b009, 0x0269b017, 0x0669b028, 0x026fb002, 0x026fb009,
+        0x026fb017, 0x066fb028, 0x0273b002, 0x0273b009, 0x0273b017, 0x0673b028,
+        0x0274b002, 0x0274b009, 0x0274b017, 0x0674b028, 0x0220b001, 0x0620b016,
+        0x0225b001, 0x0625b016, 0x022db001, 0x062db016, 0x022eb001, 0x062eb016,
+        0x022fb001, 0x062fb016, 0x0233b001, 0x0633b016, 0x0234b001, 0x0634b016,
+        0x0235b001, 0x0635b016, 0x0236b001, 0x0636b016, 0x0237b001, 0x0637b016,
+        0x0238b001, 0x0638b016, 0x0239b001, 0x0639b016, 0x023db001, 0x063db016,
+        0x0241b001, 0x0641b016, 0x025fb001, 0x065fb016, 0x0262b001, 0x0662b016,
+        0x0264b001, 0x0664b016, 0x0266b001, 0x0666b016, 0x0267b001, 0x0667b016,
+        0x0268b001, 0x0668b016, 0x026cb001, 0x066cb016, 0x026db001, 0x066db016,
+        0x026eb001, 0x066eb016, 0x0270b001, 0x0670b016, 0x0272b001, 0x0672b016,
+        0x0275b001, 0x0675b016, 0x063ab000, 0x0642b000, 0x0643b000, 0x0644b000,
+        0x0645b000, 0x0646b000, 0x0647b000, 0x0648b000, 0x0649b000, 0x064ab000,
+        0x064bb000, 0x064cb000, 0x064db000, 0x064eb000, 0x064fb000, 0x0650b000,
+        0x0651b000, 0x0652b000, 0x0653b000, 0x0654b000, 0x0655b000, 0x0656b000,
+        0x0657b000, 0x0659b000, 0x066ab000, 0x066bb000, 0x0671b000, 0x0676b000,
+        0x0677b000, 0x0678b000, 0x0679b000, 0x067ab000, 0x0100b046, 0x0100b047,
+        0x0100b049, 0x0500b04a, 0x0230b102, 0x0230b109, 0x0230b117, 0x0630b128,
+        0x0231b102, 0x0231b109, 0x0231b117, 0x0631b128, 0x0232b102, 0x0232b109,
+        0x0232b117, 0x0632b128, 0x0261b102, 0x0261b109, 0x0261b117, 0x0661b128,
+        0x0263b102, 0x0263b109, 0x0263b117, 0x0663b128, 0x0265b102, 0x0265b109,
+        0x0265b117, 0x0665b128, 0x0269b102, 0x0269b109, 0x0269b117, 0x0669b128,
+        0x026fb102, 0x026fb109, 0x026fb117, 0x066fb128, 0x0273b102, 0x0273b109,
+        0x0273b117, 0x0673b128, 0x0274b102, 0x0274b109, 0x0274b117, 0x0674b128,
+        0x0220b101, 0x0620b116, 0x0225b101, 0x0625b116, 0x022db101, 0x062db116,
+        0x022eb101, 0x062eb116, 0x022fb101, 0x062fb116, 0x0233b101, 0x0633b116,
+        0x0234b101, 0x0634b116, 0x0235b101, 0x0635b116, 0x0236b101, 0x0636b116,
+        0x0237b101, 0x0637b116, 0x0238b101, 0x0638b116, 0x0239b101, 0x0639b116,
+        0x023db101, 0x063db116, 0x0241b101, 0x0641b116, 0x025fb101, 0x065fb116,
+        0x0262b101, 0x0662b116, 0x0264b101, 0x0664b116, 0x0266b101, 0x0666b116,
+        0x0267b101, 0x0667b116, 0x0268b101, 0x0668b116, 0x026cb101, 0x066cb116,
+        0x026db101, 0x066db116, 0x026eb101, 0x066eb116, 0x0270b101, 0x0670b116,
+        0x0272b101, 0x0672b116, 0x0275b101, 0x0675b116, 0x063ab100, 0x0642b100,
+        0x0643b100, 0x0644b100, 0x0645b100, 0x0646b100, 0x0647b100, 0x0648b100,
+        0x0649b100, 0x064ab100, 0x064bb100, 0x064cb100, 0x064db100, 0x064eb100,
+        0x064fb100, 0x0650b100, 0x0651b100, 0x0652b100, 0x0653b100, 0x0654b100,
+        0x0655b100, 0x0656b100, 0x0657b100, 0x0659b100, 0x066ab100, 0x066bb100,
+        0x0671b100, 0x0676b100, 0x0677b100, 0x0678b100, 0x0679b100, 0x067ab100,
+        0x0100b146, 0x0100b147, 0x0100b149, 0x0500b14a
+    },
+    /* 115 */
+    {
+        0x0230b302, 0x0230b309, 0x0230b317, 0x0630b328, 0x0231b302, 0x0231b309,
+        0x0231b317, 0x0631b328, 0x0232b302, 0x0232b309, 0x0232b317, 0x0632b328,
+        0x0261b302, 0x0261b309, 0x0261b317, 0x0661b328, 0x0263b302, 0x0263b309,
+        0x0263b317, 0x0663b328, 0x0265b302, 0x0265b309, 0x0265b317, 0x0665b328,
+        0x0269b302, 0x0269b309, 0x0269b317, 0x0669b328, 0x026fb302, 0x026fb309,
+        0x026fb317, 0x066fb328, 0x0273b302, 0x0273b309, 0x0273b317, 0x0673b328,
+        0x0274b302, 0x0274b309, 0x0274b317, 0x0674b328, 0x0220b301, 0x0620b316,
+        0x0225b301, 0x0625b316, 0x022db301, 0x062db316, 0x022eb301, 0x062eb316,
+        0x022fb301, 0x062fb316, 0x0233b301, 0x0633b316, 0x0234b301, 0x0634b316,
+        0x0235b301, 0x0635b316, 0x0236b301, 0x0636b316, 0x0237b301, 0x0637b316,
+        0x0238b301, 0x0638b316, 0x0239b301, 0x0639b316, 0x023db301, 0x063db316,
+        0x0241b301, 0x0641b316, 0x025fb301, 0x065fb316, 0x0262b301, 0x0662b316,
+        0x0264b301, 0x0664b316, 0x0266b301, 0x0666b316, 0x0267b301, 0x0667b316,
+        0x0268b301, 0x0668b316, 0x026cb301, 0x066cb316, 0x026db301, 0x066db316,
+        0x026eb301, 0x066eb316, 0x0270b301, 0x0670b316, 0x0272b301, 0x0672b316,
+        0x0275b301, 0x0675b316, 0x063ab300, 0x0642b300, 0x0643b300, 0x0644b300,
+        0x0645b300, 0x0646b300, 0x0647b300, 0x0648b300, 0x0649b300, 0x064ab300,
+        0x064bb300, 0x064cb300, 0x064db300, 0x064eb300, 0x064fb300, 0x0650b300,
+        0x0651b300, 0x0652b300, 0x0653b300, 0x0654b300, 0x0655b300, 0x0656b300,
+        0x0657b300, 0x0659b300, 0x066ab300, 0x066bb300, 0x0671b300, 0x0676b300,
+        0x0677b300, 0x0678b300, 0x0679b300, 0x067ab300, 0x0100b346, 0x0100b347,
+        0x0100b349, 0x0500b34a, 0x0230d102, 0x0230d109, 0x0230d117, 0x0630d128,
+        0x0231d102, 0x0231d109, 0x0231d117, 0x0631d128, 0x0232d102, 0x0232d109,
+        0x0232d117, 0x0632d128, 0x0261d102, 0x0261d109, 0x0261d117, 0x0661d128,
+        0x0263d102, 0x0263d109, 0x0263d117, 0x0663d128, 0x0265d102, 0x0265d109,
+        0x0265d117, 0x0665d128, 0x0269d102, 0x0269d109, 0x0269d117, 0x0669d128,
+        0x026fd102, 0x026fd109, 0x026fd117, 0x066fd128, 0x0273d102, 0x0273d109,
+        0x0273d117, 0x0673d128, 0x0274d102, 0x0274d109, 0x0274d117, 0x0674d128,
+        0x0220d101, 0x0620d116, 0x0225d101, 0x0625d116, 0x022dd101, 0x062dd116,
+        0x022ed101, 0x062ed116, 0x022fd101, 0x062fd116, 0x0233d101, 0x0633d116,
+        0x0234d101, 0x0634d116, 0x0235d101, 0x0635d116, 0x0236d101, 0x0636d116,
+        0x0237d101, 0x0637d116, 0x0238d101, 0x0638d116, 0x0239d101, 0x0639d116,
+        0x023dd101, 0x063dd116, 0x0241d101, 0x0641d116, 0x025fd101, 0x065fd116,
+        0x0262d101, 0x0662d116, 0x0264d101, 0x0664d116, 0x0266d101, 0x0666d116,
+        0x0267d101, 0x0667d116, 0x0268d101, 0x0668d116, 0x026cd101, 0x066cd116,
+        0x026dd101, 0x066dd116, 0x026ed101, 0x066ed116, 0x0270d101, 0x0670d116,
+        0x0272d101, 0x0672d116, 0x0275d101, 0x0675d116, 0x063ad100, 0x0642d100,
+        0x0643d100, 0x0644d100, 0x0645d100, 0x0646d100, 0x0647d100, 0x0648d100,
+        0x0649d100, 0x064ad100, 0x064bd100, 0x064cd100, 0x064dd100, 0x064ed100,
+        0x064fd100, 0x0650d100, 0x0651d100, 0x0652d100, 0x0653d100, 0x0654d100,
+        0x0655d100, 0x0656d100, 0x0657d100, 0x0659d100, 0x066ad100, 0x066bd100,
+        0x0671d100, 0x0676d100, 0x0677d100, 0x0678d100, 0x0679d100, 0x067ad100,
+        0x0100d146, 0x0100d147, 0x0100d149, 0x0500d14a
+    },
+    /* 116 */
+    {
+        0x0230d801, 0x0630d816, 0x0231d801, 0x0631d816, 0x0232d801, 0x0632d816,
+        0x0261d801, 0x0661d816, 0x0263d801, 0x0663d816, 0x0265d801, 0x0665d816,
+        0x0269d801, 0x0669d816, 0x026fd801, 0x066fd816, 0x0273d801, 0x0673d816,
+        0x0274d801, 0x0674d816, 0x0620d800, 0x0625d800, 0x062dd800, 0x062ed800,
+        0x062fd800, 0x0633d800, 0x0634d800, 0x0635d800, 0x0636d800, 0x0637d800,
+        0x0638d800, 0x0639d800, 0x063dd800, 0x0641d800, 0x065fd800, 0x0662d800,
+        0x0664d800, 0x0666d800, 0x0667d800, 0x0668d800, 0x066cd800, 0x066dd800,
+        0x066ed800, 0x0670d800, 0x0672d800, 0x0675d800, 0x0100d826, 0x0100d827,
+        0x0100d82c, 0x0100d82d, 0x0100d82f, 0x0100d830, 0x0100d833, 0x0100d834,
+        0x0100d836, 0x0100d837, 0x0100d83b, 0x0100d83c, 0x0100d83e, 0x0100d83f,
+        0x0100d842, 0x0100d843, 0x0100d845, 0x0500d848, 0x0230d901, 0x0630d916,
+        0x0231d901, 0x0631d916, 0x0232d901, 0x0632d916, 0x0261d901, 0x0661d916,
+        0x0263d901, 0x0663d916, 0x0265d901, 0x0665d916, 0x0269d901, 0x0669d916,
+        0x026fd901, 0x066fd916, 0x0273d901, 0x0673d916, 0x0274d901, 0x0674d916,
+        0x0620d900, 0x0625d900, 0x062dd900, 0x062ed900, 0x062fd900, 0x0633d900,
+        0x0634d900, 0x0635d900, 0x0636d900, 0x0637d900, 0x0638d900, 0x0639d900,
+        0x063dd900, 0x0641d900, 0x065fd900, 0x0662d900, 0x0664d900, 0x0666d900,
+        0x0667d900, 0x0668d900, 0x066cd900, 0x066dd900, 0x066ed900, 0x0670d900,
+        0x0672d900, 0x0675d900, 0x0100d926, 0x0100d927, 0x0100d92c, 0x0100d92d,
+        0x0100d92f, 0x0100d930, 0x0100d933, 0x0100d934, 0x0100d936, 0x0100d937,
+        0x0100d93b, 0x0100d93c, 0x0100d93e, 0x0100d93f, 0x0100d942, 0x0100d943,
+        0x0100d945, 0x0500d948, 0x0230e301, 0x0630e316, 0x0231e301, 0x0631e316,
+        0x0232e301, 0x0632e316, 0x0261e301, 0x0661e316, 0x0263e301, 0x0663e316,
+        0x0265e301, 0x0665e316, 0x0269e301, 0x0669e316, 0x026fe301, 0x066fe316,
+        0x0273e301, 0x0673e316, 0x0274e301, 0x0674e316, 0x0620e300, 0x0625e300,
+        0x062de300, 0x062ee300, 0x062fe300, 0x0633e300, 0x0634e300, 0x0635e300,
+        0x0636e300, 0x0637e300, 0x0638e300, 0x0639e300, 0x063de300, 0x0641e300,
+        0x065fe300, 0x0662e300, 0x0664e300, 0x0666e300, 0x0667e300, 0x0668e300,
+        0x066ce300, 0x066de300, 0x066ee300, 0x0670e300, 0x0672e300, 0x0675e300,
+        0x0100e326, 0x0100e327, 0x0100e32c, 0x0100e32d, 0x0100e32f, 0x0100e330,
+        0x0100e333, 0x0100e334, 0x0100e336, 0x0100e337, 0x0100e33b, 0x0100e33c,
+        0x0100e33e, 0x0100e33f, 0x0100e342, 0x0100e343, 0x0100e345, 0x0500e348,
+        0x0230e501, 0x0630e516, 0x0231e501, 0x0631e516, 0x0232e501, 0x0632e516,
+        0x0261e501, 0x0661e516, 0x0263e501, 0x0663e516, 0x0265e501, 0x0665e516,
+        0x0269e501, 0x0669e516, 0x026fe501, 0x066fe516, 0x0273e501, 0x0673e516,
+        0x0274e501, 0x0674e516, 0x0620e500, 0x0625e500, 0x062de500, 0x062ee500,
+        0x062fe500, 0x0633e500, 0x0634e500, 0x0635e500, 0x0636e500, 0x0637e500,
+        0x0638e500, 0x0639e500, 0x063de500, 0x0641e500, 0x065fe500, 0x0662e500,
+        0x0664e500, 0x0666e500, 0x0667e500, 0x0668e500, 0x066ce500, 0x066de500,
+        0x066ee500, 0x0670e500, 0x0672e500, 0x0675e500, 0x0100e526, 0x0100e527,
+        0x0100e52c, 0x0100e52d, 0x0100e52f, 0x0100e530, 0x0100e533, 0x0100e534,
+        0x0100e536, 0x0100e537, 0x0100e53b, 0x0100e53c, 0x0100e53e, 0x0100e53f,
+        0x0100e542, 0x0100e543, 0x0100e545, 0x0500e548
+    },
+    /* 117 */
+    {
+        0x0230d802, 0x0230d809, 0x0230d817, 0x0630d828, 0x0231d802, 0x0231d809,
+        0x0231d817, 0x0631d828, 0x0232d802, 0x0232d809, 0x0232d817, 0x0632d828,
+        0x0261d802, 0x0261d809, 0x0261d817, 0x0661d828, 0x0263d802, 0x0263d809,
+        0x0263d817, 0x0663d828, 0x0265d802, 0x0265d809, 0x0265d817, 0x0665d828,
+        0x0269d802, 0x0269d809, 0x0269d817, 0x0669d828, 0x026fd802, 0x026fd809,
+        0x026fd817, 0x066fd828, 0x0273d802, 0x0273d809, 0x0273d817, 0x0673d828,
+        0x0274d802, 0x0274d809, 0x0274d817, 0x0674d828, 0x0220d801, 0x0620d816,
+        0x0225d801, 0x0625d816, 0x022dd801, 0x062dd816, 0x022ed801, 0x062ed816,
+        0x022fd801, 0x062fd816, 0x0233d801, 0x0633d816, 0x0234d801, 0x0634d816,
+        0x0235d801, 0x0635d816, 0x0236d801, 0x0636d816, 0x0237d801, 0x0637d816,
+        0x0238d801, 0x0638d816, 0x0239d801, 0x0639d816, 0x023dd801, 0x063dd816,
+        0x0241d801, 0x0641d816, 0x025fd801, 0x065fd816, 0x0262d801, 0x0662d816,
+        0x0264d801, 0x0664d816, 0x0266d801, 0x0666d816, 0x0267d801, 0x0667d816,
+        0x0268d801, 0x0668d816, 0x026cd801, 0x066cd816, 0x026dd801, 0x066dd816,
+        0x026ed801, 0x066ed816, 0x0270d801, 0x0670d816, 0x0272d801, 0x0672d816,
+        0x0275d801, 0x0675d816, 0x063ad800, 0x0642d800, 0x0643d800, 0x0644d800,
+        0x0645d800, 0x0646d800, 0x0647d800, 0x0648d800, 0x0649d800, 0x064ad800,
+        0x064bd800, 0x064cd800, 0x064dd800, 0x064ed800, 0x064fd800, 0x0650d800,
+        0x0651d800, 0x0652d800, 0x0653d800, 0x0654d800, 0x0655d800, 0x0656d800,
+        0x0657d800, 0x0659d800, 0x066ad800, 0x066bd800, 0x0671d800, 0x0676d800,
+        0x0677d800, 0x0678d800, 0x0679d800, 0x067ad800, 0x0100d846, 0x0100d847,
+        0x0100d849, 0x0500d84a, 0x0230d902, 0x0230d909, 0x0230d917, 0x0630d928,
+        0x0231d902, 0x0231d909, 0x0231d917, 0x0631d928, 0x0232d902, 0x0232d909,
+        0x0232d917, 0x0632d928, 0x0261d902, 0x0261d909, 0x0261d917, 0x0661d928,
+        0x0263d902, 0x0263d909, 0x0263d917, 0x0663d928, 0x0265d902, 0x0265d909,
+        0x0265d917, 0x0665d928, 0x0269d902, 0x0269d909, 0x0269d917, 0x0669d928,
+        0x026fd902, 0x026fd909, 0x026fd917, 0x066fd928, 0x0273d902, 0x0273d909,
+        0x0273d917, 0x0673d928, 0x0274d902, 0x0274d909, 0x0274d917, 0x0674d928,
+        0x0220d901, 0x0620d916, 0x0225d901, 0x0625d916, 0x022dd901, 0x062dd916,
+        0x022ed901, 0x062ed916, 0x022fd901, 0x062fd916, 0x0233d901, 0x0633d916,
+        0x0234d901, 0x0634d916, 0x0235d901, 0x0635d916, 0x0236d901, 0x0636d916,
+        0x0237d901, 0x0637d916, 0x0238d901, 0x0638d916, 0x0239d901, 0x0639d916,
+        0x023dd901, 0x063dd916, 0x0241d901, 0x0641d916, 0x025fd901, 0x065fd916,
+        0x0262d901, 0x0662d916, 0x0264d901, 0x0664d916, 0x0266d901, 0x0666d916,
+        0x0267d901, 0x0667d916, 0x0268d901, 0x0668d916, 0x026cd901, 0x066cd916,
+        0x026dd901, 0x066dd916, 0x026ed901, 0x066ed916, 0x0270d901, 0x0670d916,
+        0x0272d901, 0x0672d916, 0x0275d901, 0x0675d916, 0x063ad900, 0x0642d900,
+        0x0643d900, 0x0644d900, 0x0645d900, 0x0646d900, 0x0647d900, 0x0648d900,
+        0x0649d900, 0x064ad900, 0x064bd900, 0x064cd900, 0x064dd900, 0x064ed900,
+        0x064fd900, 0x0650d900, 0x0651d900, 0x0652d900, 0x0653d900, 0x0654d900,
+        0x0655d900, 0x0656d900, 0x0657d900, 0x0659d900, 0x066ad900, 0x066bd900,
+        0x0671d900, 0x0676d900, 0x0677d900, 0x0678d900, 0x0679d900, 0x067ad900,
+        0x0100d946, 0x0100d947, 0x0100d949, 0x0500d94a
+    },
+    /* 118 */
+    {
+        0x0230e302, 0x0230e309, 0x0230e317, 0x0630e328, 0x0231e302, 0x0231e309,
+        0x0231e317, 0x0631e328, 0x0232e302, 0x0232e309, 0x0232e317, 0x0632e328,
+        0x0261e302, 0x0261e309, 0x0261e317, 0x0661e328, 0x0263e302, 0x0263e309,
+        0x0263e317, 0x0663e328, 0x0265e302, 0x0265e309, 0x0265e317, 0x0665e328,
+        0x0269e302, 0x0269e309, 0x0269e317, 0x0669e328, 0x026fe302, 0x026fe309,
+        0x026fe317, 0x066fe328, 0x0273e302, 0x0273e309, 0x0273e317, 0x0673e328,
+        0x0274e302, 0x0274e309, 0x0274e317, 0x0674e328, 0x0220e301, 0x0620e316,
+        0x0225e301, 0x0625e316, 0x022de301, 0x062de316, 0x022ee301, 0x062ee316,
+        0x022fe301, 0x062fe316, 0x0233e301, 0x0633e316, 0x0234e301, 0x0634e316,
+        0x0235e301, 0x0635e316, 0x0236e301, 0x0636e316, 0x0237e301, 0x0637e316,
+        0x0238e301, 0x0638e316, 0x0239e301, 0x0639e316, 0x023de301, 0x063de316,
+        0x0241e301, 0x0641e316, 0x025fe301, 0x065fe316, 0x0262e301, 0x0662e316,
+        0x0264e301, 0x0664e316, 0x0266e301, 0x0666e316, 0x0267e301, 0x0667e316,
+        0x0268e301, 0x0668e316, 0x026ce301, 0x066ce316, 0x026de301, 0x066de316,
+        0x026ee301, 0x066ee316, 0x0270e301, 0x0670e316, 0x0272e301, 0x0672e316,
+        0x0275e301, 0x0675e316, 0x063ae300, 0x0642e300, 0x0643e300, 0x0644e300,
+        0x0645e300, 0x0646e300, 0x0647e300, 0x0648e300, 0x0649e300, 0x064ae300,
+        0x064be300, 0x064ce300, 0x064de300, 0x064ee300, 0x064fe300, 0x0650e300,
+        0x0651e300, 0x0652e300, 0x0653e300, 0x0654e300, 0x0655e300, 0x0656e300,
+        0x0657e300, 0x0659e300, 0x066ae300, 0x066be300, 0x0671e300, 0x0676e300,
+        0x0677e300, 0x0678e300, 0x0679e300, 0x067ae300, 0x0100e346, 0x0100e347,
+        0x0100e349, 0x0500e34a, 0x0230e502, 0x0230e509, 0x0230e517, 0x0630e528,
+        0x0231e502, 0x0231e509, 0x0231e517, 0x0631e528, 0x0232e502, 0x0232e509,
+        0x0232e517, 0x0632e528, 0x0261e502, 0x0261e509, 0x0261e517, 0x0661e528,
+        0x0263e502, 0x0263e509, 0x0263e517, 0x0663e528, 0x0265e502, 0x0265e509,
+        0x0265e517, 0x0665e528, 0x0269e502, 0x0269e509, 0x0269e517, 0x0669e528,
+        0x026fe502, 0x026fe509, 0x026fe517, 0x066fe528, 0x0273e502, 0x0273e509,
+        0x0273e517, 0x0673e528, 0x0274e502, 0x0274e509, 0x0274e517, 0x0674e528,
+        0x0220e501, 0x0620e516, 0x0225e501, 0x0625e516, 0x022de501, 0x062de516,
+        0x022ee501, 0x062ee516, 0x022fe501, 0x062fe516, 0x0233e501, 0x0633e516,
+        0x0234e501, 0x0634e516, 0x0235e501, 0x0635e516, 0x0236e501, 0x0636e516,
+        0x0237e501, 0x0637e516, 0x0238e501, 0x0638e516, 0x0239e501, 0x0639e516,
+        0x023de501, 0x063de516, 0x0241e501, 0x0641e516, 0x025fe501, 0x065fe516,
+        0x0262e501, 0x0662e516, 0x0264e501, 0x0664e516, 0x0266e501, 0x0666e516,
+        0x0267e501, 0x0667e516, 0x0268e501, 0x0668e516, 0x026ce501, 0x066ce516,
+        0x026de501, 0x066de516, 0x026ee501, 0x066ee516, 0x0270e501, 0x0670e516,
+        0x0272e501, 0x0672e516, 0x0275e501, 0x0675e516, 0x063ae500, 0x0642e500,
+        0x0643e500, 0x0644e500, 0x0645e500, 0x0646e500, 0x0647e500, 0x0648e500,
+        0x0649e500, 0x064ae500, 0x064be500, 0x064ce500, 0x064de500, 0x064ee500,
+        0x064fe500, 0x0650e500, 0x0651e500, 0x0652e500, 0x0653e500, 0x0654e500,
+        0x0655e500, 0x0656e500, 0x0657e500, 0x0659e500, 0x066ae500, 0x066be500,
+        0x0671e500, 0x0676e500, 0x0677e500, 0x0678e500, 0x0679e500, 0x067ae500,
+        0x0100e546, 0x0100e547, 0x0100e549, 0x0500e54a
+    },
+    /* 119 */
+    {
+        0x0630e600, 0x0631e600, 0x0632e600, 0x0661e600, 0x0663e600, 0x0665e600,
+        0x0669e600, 0x066fe600, 0x0673e600, 0x0674e600, 0x0100e60d, 0x0100e60e,
+        0x0100e611, 0x0100e612, 0x0100e614, 0x0100e615, 0x0100e61a, 0x0100e61b,
+        0x0100e61d, 0x0100e61e, 0x0100e621, 0x0100e622, 0x0100e624, 0x0100e625,
+        0x0100e62b, 0x0100e62e, 0x0100e632, 0x0100e635, 0x0100e63a, 0x0100e63d,
+        0x0100e641, 0x0500e644, 0x01008104, 0x01008105, 0x01008107, 0x01008108,
+        0x0100810b, 0x0100810c, 0x01008110, 0x01008113, 0x01008119, 0x0100811c,
+        0x01008120, 0x01008123, 0x0100812a, 0x01008131, 0x01008139, 0x05008140,
+        0x01008404, 0x01008405, 0x01008407, 0x01008408, 0x0100840b, 0x0100840c,
+        0x01008410, 0x01008413, 0x01008419, 0x0100841c, 0x01008420, 0x01008423,
+        0x0100842a, 0x01008431, 0x01008439, 0x05008440, 0x01008504, 0x01008505,
+        0x01008507, 0x01008508, 0x0100850b, 0x0100850c, 0x01008510, 0x01008513,
+        0x01008519, 0x0100851c, 0x01008520, 0x01008523, 0x0100852a, 0x01008531,
+        0x01008539, 0x05008540, 0x01008604, 0x01008605, 0x01008607, 0x01008608,
+        0x0100860b, 0x0100860c, 0x01008610, 0x01008613, 0x01008619, 0x0100861c,
+        0x01008620, 0x01008623, 0x0100862a, 0x01008631, 0x01008639, 0x05008640,
+        0x01008804, 0x01008805, 0x01008807, 0x01008808, 0x0100880b, 0x0100880c,
+        0x01008810, 0x01008813, 0x01008819, 0x0100881c, 0x01008820, 0x01008823,
+        0x0100882a, 0x01008831, 0x01008839, 0x05008840, 0x01009204, 0x01009205,
+        0x01009207, 0x01009208, 0x0100920b, 0x0100920c, 0x01009210, 0x01009213,
+        0x01009219, 0x0100921c, 0x01009220, 0x01009223, 0x0100922a, 0x01009231,
+        0x01009239, 0x05009240, 0x01009a04, 0x01009a05, 0x01009a07, 0x01009a08,
+        0x01009a0b, 0x01009a0c, 0x01009a10, 0x01009a13, 0x01009a19, 0x01009a1c,
+        0x01009a20, 0x01009a23, 0x01009a2a, 0x01009a31, 0x01009a39, 0x05009a40,
+        0x01009c04, 0x01009c05, 0x01009c07, 0x01009c08, 0x01009c0b, 0x01009c0c,
+        0x01009c10, 0x01009c13, 0x01009c19, 0x01009c1c, 0x01009c20, 0x01009c23,
+        0x01009c2a, 0x01009c31, 0x01009c39, 0x05009c40, 0x0100a004, 0x0100a005,
+        0x0100a007, 0x0100a008, 0x0100a00b, 0x0100a00c, 0x0100a010, 0x0100a013,
+        0x0100a019, 0x0100a01c, 0x0100a020, 0x0100a023, 0x0100a02a, 0x0100a031,
+        0x0100a039, 0x0500a040, 0x0100a304, 0x0100a305, 0x0100a307, 0x0100a308,
+        0x0100a30b, 0x0100a30c, 0x0100a310, 0x0100a313, 0x0100a319, 0x0100a31c,
+        0x0100a320, 0x0100a323, 0x0100a32a, 0x0100a331, 0x0100a339, 0x0500a340,
+        0x0100a404, 0x0100a405, 0x0100a407, 0x0100a408, 0x0100a40b, 0x0100a40c,
+        0x0100a410, 0x0100a413, 0x0100a419, 0x0100a41c, 0x0100a420, 0x0100a423,
+        0x0100a42a, 0x0100a431, 0x0100a439, 0x0500a440, 0x0100a904, 0x0100a905,
+        0x0100a907, 0x0100a908, 0x0100a90b, 0x0100a90c, 0x0100a910, 0x0100a913,
+        0x0100a919, 0x0100a91c, 0x0100a920, 0x0100a923, 0x0100a92a, 0x0100a931,
+        0x0100a939, 0x0500a940, 0x0100aa04, 0x0100aa05, 0x0100aa07, 0x0100aa08,
+        0x0100aa0b, 0x0100aa0c, 0x0100aa10, 0x0100aa13, 0x0100aa19, 0x0100aa1c,
+        0x0100aa20, 0x0100aa23, 0x0100aa2a, 0x0100aa31, 0x0100aa39, 0x0500aa40,
+        0x0100ad04, 0x0100ad05, 0x0100ad07, 0x0100ad08, 0x0100ad0b, 0x0100ad0c,
+        0x0100ad10, 0x0100ad13, 0x0100ad19, 0x0100ad1c, 0x0100ad20, 0x0100ad23,
+        0x0100ad2a, 0x0100ad31, 0x0100ad39, 0x0500ad40
+    },
+    /* 120 */
+    {
+        0x0230e601, 0x0630e616, 0x0231e601, 0x0631e616, 0x0232e601, 0x0632e616,
+        0x0261e601, 0x0661e616, 0x0263e601, 0x0663e616, 0x0265e601, 0x0665e616,
+        0x0269e601, 0x0669e616, 0x026fe601, 0x066fe616, 0x0273e601, 0x0673e616,
+        0x0274e601, 0x0674e616, 0x0620e600, 0x0625e600, 0x062de600, 0x062ee600,
+        0x062fe600, 0x0633e600, 0x0634e600, 0x0635e600, 0x0636e600, 0x0637e600,
+        0x0638e600, 0x0639e600, 0x063de600, 0x0641e600, 0x065fe600, 0x0662e600,
+        0x0664e600, 0x0666e600, 0x0667e600, 0x0668e600, 0x066ce600, 0x066de600,
+        0x066ee600, 0x0670e600, 0x0672e600, 0x0675e600, 0x0100e626, 0x0100e627,
+        0x0100e62c, 0x0100e62d, 0x0100e62f, 0x0100e630, 0x0100e633, 0x0100e634,
+        0x0100e636, 0x0100e637, 0x0100e63b, 0x0100e63c, 0x0100e63e, 0x0100e63f,
+        0x0100e642, 0x0100e643, 0x0100e645, 0x0500e648, 0x06308100, 0x06318100,
+        0x06328100, 0x06618100, 0x06638100, 0x06658100, 0x06698100, 0x066f8100,
+        0x06738100, 0x06748100, 0x0100810d, 0x0100810e, 0x01008111, 0x01008112,
+        0x01008114, 0x01008115, 0x0100811a, 0x0100811b, 0x0100811d, 0x0100811e,
+        0x01008121, 0x01008122, 0x01008124, 0x01008125, 0x0100812b, 0x0100812e,
+        0x01008132, 0x01008135, 0x0100813a, 0x0100813d, 0x01008141, 0x05008144,
+        0x06308400, 0x06318400, 0x06328400, 0x06618400, 0x06638400, 0x06658400,
+        0x06698400, 0x066f8400, 0x06738400, 0x06748400, 0x0100840d, 0x0100840e,
+        0x01008411, 0x01008412, 0x01008414, 0x01008415, 0x0100841a, 0x0100841b,
+        0x0100841d, 0x0100841e, 0x01008421, 0x01008422, 0x01008424, 0x01008425,
+        0x0100842b, 0x0100842e, 0x01008432, 0x01008435, 0x0100843a, 0x0100843d,
+        0x01008441, 0x05008444, 0x06308500, 0x06318500, 0x06328500, 0x06618500,
+        0x06638500, 0x06658500, 0x06698500, 0x066f8500, 0x06738500, 0x06748500,
+        0x0100850d, 0x0100850e, 0x01008511, 0x01008512, 0x01008514, 0x01008515,
+        0x0100851a, 0x0100851b, 0x0100851d, 0x0100851e, 0x01008521, 0x01008522,
+        0x01008524, 0x01008525, 0x0100852b, 0x0100852e, 0x01008532, 0x01008535,
+        0x0100853a, 0x0100853d, 0x01008541, 0x05008544, 0x06308600, 0x06318600,
+        0x06328600, 0x06618600, 0x06638600, 0x06658600, 0x06698600, 0x066f8600,
+        0x06738600, 0x06748600, 0x0100860d, 0x0100860e, 0x01008611, 0x01008612,
+        0x01008614, 0x01008615, 0x0100861a, 0x0100861b, 0x0100861d, 0x0100861e,
+        0x01008621, 0x01008622, 0x01008624, 0x01008625, 0x0100862b, 0x0100862e,
+        0x01008632, 0x01008635, 0x0100863a, 0x0100863d, 0x01008641, 0x05008644,
+        0x06308800, 0x06318800, 0x06328800, 0x06618800, 0x06638800, 0x06658800,
+        0x06698800, 0x066f8800, 0x06738800, 0x06748800, 0x0100880d, 0x0100880e,
+        0x01008811, 0x01008812, 0x01008814, 0x01008815, 0x0100881a, 0x0100881b,
+        0x0100881d, 0x0100881e, 0x01008821, 0x01008822, 0x01008824, 0x01008825,
+        0x0100882b, 0x0100882e, 0x01008832, 0x01008835, 0x0100883a, 0x0100883d,
+        0x01008841, 0x05008844, 0x06309200, 0x06319200, 0x06329200, 0x06619200,
+        0x06639200, 0x06659200, 0x06699200, 0x066f9200, 0x06739200, 0x06749200,
+        0x0100920d, 0x0100920e, 0x01009211, 0x01009212, 0x01009214, 0x01009215,
+        0x0100921a, 0x0100921b, 0x0100921d, 0x0100921e, 0x01009221, 0x01009222,
+        0x01009224, 0x01009225, 0x0100922b, 0x0100922e, 0x01009232, 0x01009235,
+        0x0100923a, 0x0100923d, 0x01009241, 0x05009244
+    },
+    /* 121 */
+    {
+        0x0230e602, 0x0230e609, 0x0230e617, 0x0630e628, 0x0231e602, 0x0231e609,
+        0x0231e617, 0x0631e628, 0x0232e602, 0x0232e609, 0x0232e617, 0x0632e628,
+        0x0261e602, 0x0261e609, 0x0261e617, 0x0661e628, 0x0263e602, 0x0263e609,
+        0x0263e617, 0x0663e628, 0x0265e602, 0x0265e609, 0x0265e617, 0x0665e628,
+        0x0269e602, 0x0269e609, 0x0269e617, 0x0669e628, 0x026fe602, 0x026fe609,
+        0x026fe617, 0x066fe628, 0x0273e602, 0x0273e609, 0x0273e617, 0x0673e628,
+        0x0274e602, 0x0274e609, 0x0274e617, 0x0674e628, 0x0220e601, 0x0620e616,
+        0x0225e601, 0x0625e616, 0x022de601, 0x062de616, 0x022ee601, 0x062ee616,
+        0x022fe601, 0x062fe616, 0x0233e601, 0x0633e616, 0x0234e601, 0x0634e616,
+        0x0235e601, 0x0635e616, 0x0236e601, 0x0636e616, 0x0237e601, 0x0637e616,
+        0x0238e601, 0x0638e616, 0x0239e601, 0x0639e616, 0x023de601, 0x063de616,
+        0x0241e601, 0x0641e616, 0x025fe601, 0x065fe616, 0x0262e601, 0x0662e616,
+        0x0264e601, 0x0664e616, 0x0266e601, 0x0666e616, 0x0267e601, 0x0667e616,
+        0x0268e601, 0x0668e616, 0x026ce601, 0x066ce616, 0x026de601, 0x066de616,
+        0x026ee601, 0x066ee616, 0x0270e601, 0x0670e616, 0x0272e601, 0x0672e616,
+        0x0275e601, 0x0675e616, 0x063ae600, 0x0642e600, 0x0643e600, 0x0644e600,
+        0x0645e600, 0x0646e600, 0x0647e600, 0x0648e600, 0x0649e600, 0x064ae600,
+        0x064be600, 0x064ce600, 0x064de600, 0x064ee600, 0x064fe600, 0x0650e600,
+        0x0651e600, 0x0652e600, 0x0653e600, 0x0654e600, 0x0655e600, 0x0656e600,
+        0x0657e600, 0x0659e600, 0x066ae600, 0x066be600, 0x0671e600, 0x0676e600,
+        0x0677e600, 0x0678e600, 0x0679e600, 0x067ae600, 0x0100e646, 0x0100e647,
+        0x0100e649, 0x0500e64a, 0x02308101, 0x06308116, 0x02318101, 0x06318116,
+        0x02328101, 0x06328116, 0x02618101, 0x06618116, 0x02638101, 0x06638116,
+        0x02658101, 0x06658116, 0x02698101, 0x06698116, 0x026f8101, 0x066f8116,
+        0x02738101, 0x06738116, 0x02748101, 0x06748116, 0x06208100, 0x06258100,
+        0x062d8100, 0x062e8100, 0x062f8100, 0x06338100, 0x06348100, 0x06358100,
+        0x06368100, 0x06378100, 0x06388100, 0x06398100, 0x063d8100, 0x06418100,
+        0x065f8100, 0x06628100, 0x06648100, 0x06668100, 0x06678100, 0x06688100,
+        0x066c8100, 0x066d8100, 0x066e8100, 0x06708100, 0x06728100, 0x06758100,
+        0x01008126, 0x01008127, 0x0100812c, 0x0100812d, 0x0100812f, 0x01008130,
+        0x01008133, 0x01008134, 0x01008136, 0x01008137, 0x0100813b, 0x0100813c,
+        0x0100813e, 0x0100813f, 0x01008142, 0x01008143, 0x01008145, 0x05008148,
+        0x02308401, 0x06308416, 0x02318401, 0x06318416, 0x02328401, 0x06328416,
+        0x02618401, 0x06618416, 0x02638401, 0x06638416, 0x02658401, 0x06658416,
+        0x02698401, 0x06698416, 0x026f8401, 0x066f8416, 0x02738401, 0x06738416,
+        0x02748401, 0x06748416, 0x06208400, 0x06258400, 0x062d8400, 0x062e8400,
+        0x062f8400, 0x06338400, 0x06348400, 0x06358400, 0x06368400, 0x06378400,
+        0x06388400, 0x06398400, 0x063d8400, 0x06418400, 0x065f8400, 0x06628400,
+        0x06648400, 0x06668400, 0x06678400, 0x06688400, 0x066c8400, 0x066d8400,
+        0x066e8400, 0x06708400, 0x06728400, 0x06758400, 0x01008426, 0x01008427,
+        0x0100842c, 0x0100842d, 0x0100842f, 0x01008430, 0x01008433, 0x01008434,
+        0x01008436, 0x01008437, 0x0100843b, 0x0100843c, 0x0100843e, 0x0100843f,
+        0x01008442, 0x01008443, 0x01008445, 0x05008448
+    },
+    /* 122 */
+    {
+        0x02308102, 0x02308109, 0x02308117, 0x06308128, 0x02318102, 0x02318109,
+        0x02318117, 0x06318128, 0x02328102, 0x02328109, 0x02328117, 0x06328128,
+        0x02618102, 0x02618109, 0x02618117, 0x06618128, 0x02638102, 0x02638109,
+        0x02638117, 0x06638128, 0x02658102, 0x02658109, 0x02658117, 0x06658128,
+        0x02698102, 0x02698109, 0x02698117, 0x06698128, 0x026f8102, 0x026f8109,
+        0x026f8117, 0x066f8128, 0x02738102, 0x02738109, 0x02738117, 0x06738128,
+        0x02748102, 0x02748109, 0x02748117, 0x06748128, 0x02208101, 0x06208116,
+        0x02258101, 0x06258116, 0x022d8101, 0x062d8116, 0x022e8101, 0x062e8116,
+        0x022f8101, 0x062f8116, 0x02338101, 0x06338116, 0x02348101, 0x06348116,
+        0x02358101, 0x06358116, 0x02368101, 0x06368116, 0x02378101, 0x06378116,
+        0x02388101, 0x06388116, 0x02398101, 0x06398116, 0x023d8101, 0x063d8116,
+        0x02418101, 0x06418116, 0x025f8101, 0x065f8116, 0x02628101, 0x06628116,
+        0x02648101, 0x06648116, 0x02668101, 0x06668116, 0x02678101, 0x06678116,
+        0x02688101, 0x06688116, 0x026c8101, 0x066c8116, 0x026d8101, 0x066d8116,
+        0x026e8101, 0x066e8116, 0x02708101, 0x06708116, 0x02728101, 0x06728116,
+        0x02758101, 0x06758116, 0x063a8100, 0x06428100, 0x06438100, 0x06448100,
+        0x06458100, 0x06468100, 0x06478100, 0x06488100, 0x06498100, 0x064a8100,
+        0x064b8100, 0x064c8100, 0x064d8100, 0x064e8100, 0x064f8100, 0x06508100,
+        0x06518100, 0x06528100, 0x06538100, 0x06548100, 0x06558100, 0x06568100,
+        0x06578100, 0x06598100, 0x066a8100, 0x066b8100, 0x06718100, 0x06768100,
+        0x06778100, 0x06788100, 0x06798100, 0x067a8100, 0x01008146, 0x01008147,
+        0x01008149, 0x0500814a, 0x02308402, 0x02308409, 0x02308417, 0x06308428,
+        0x02318402, 0x02318409, 0x02318417, 0x06318428, 0x02328402, 0x02328409,
+        0x02328417, 0x06328428, 0x02618402, 0x02618409, 0x02618417, 0x06618428,
+        0x02638402, 0x02638409, 0x02638417, 0x06638428, 0x02658402, 0x02658409,
+        0x02658417, 0x06658428, 0x02698402, 0x02698409, 0x02698417, 0x06698428,
+        0x026f8402, 0x026f8409, 0x026f8417, 0x066f8428, 0x02738402, 0x02738409,
+        0x02738417, 0x06738428, 0x02748402, 0x02748409, 0x02748417, 0x06748428,
+        0x02208401, 0x06208416, 0x02258401, 0x06258416, 0x022d8401, 0x062d8416,
+        0x022e8401, 0x062e8416, 0x022f8401, 0x062f8416, 0x02338401, 0x06338416,
+        0x02348401, 0x06348416, 0x02358401, 0x06358416, 0x02368401, 0x06368416,
+        0x02378401, 0x06378416, 0x02388401, 0x06388416, 0x02398401, 0x06398416,
+        0x023d8401, 0x063d8416, 0x02418401, 0x06418416, 0x025f8401, 0x065f8416,
+        0x02628401, 0x06628416, 0x02648401, 0x06648416, 0x02668401, 0x06668416,
+        0x02678401, 0x06678416, 0x02688401, 0x06688416, 0x026c8401, 0x066c8416,
+        0x026d8401, 0x066d8416, 0x026e8401, 0x066e8416, 0x02708401, 0x06708416,
+        0x02728401, 0x06728416, 0x02758401, 0x06758416, 0x063a8400, 0x06428400,
+        0x06438400, 0x06448400, 0x06458400, 0x06468400, 0x06478400, 0x06488400,
+        0x06498400, 0x064a8400, 0x064b8400, 0x064c8400, 0x064d8400, 0x064e8400,
+        0x064f8400, 0x06508400, 0x06518400, 0x06528400, 0x06538400, 0x06548400,
+        0x06558400, 0x06568400, 0x06578400, 0x06598400, 0x066a8400, 0x066b8400,
+        0x06718400, 0x06768400, 0x06778400, 0x06788400, 0x06798400, 0x067a8400,
+        0x01008446, 0x01008447, 0x01008449, 0x0500844a
+    },
+    /* 123 */
+    {
+        0x02308501, 0x06308516, 0x02318501, 0x06318516, 0x02328501, 0x06328516,
+        0x02618501, 0x06618516, 0x02638501, 0x06638516, 0x02658501, 0x06658516,
+        0x02698501, 0x06698516, 0x026f8501, 0x066f8516, 0x02738501, 0x06738516,
+        0x02748501, 0x06748516, 0x06208500, 0x06258500, 0x062d8500, 0x062e8500,
+        0x062f8500, 0x06338500, 0x06348500, 0x06358500, 0x06368500, 0x06378500,
+        0x06388500, 0x06398500, 0x063d8500, 0x06418500, 0x065f8500, 0x06628500,
+        0x06648500, 0x06668500, 0x06678500, 0x06688500, 0x066c8500, 0x066d8500,
+        0x066e8500, 0x06708500, 0x06728500, 0x06758500, 0x01008526, 0x01008527,
+        0x0100852c, 0x0100852d, 0x0100852f, 0x01008530, 0x01008533, 0x01008534,
+        0x01008536, 0x01008537, 0x0100853b, 0x0100853c, 0x0100853e, 0x0100853f,
+        0x01008542, 0x01008543, 0x01008545, 0x05008548, 0x02308601, 0x06308616,
+        0x02318601, 0x06318616, 0x02328601, 0x06328616, 0x02618601, 0x06618616,
+        0x02638601, 0x06638616, 0x02658601, 0x06658616, 0x02698601, 0x06698616,
+        0x026f8601, 0x066f8616, 0x02738601, 0x06738616, 0x02748601, 0x06748616,
+        0x06208600, 0x06258600, 0x062d8600, 0x062e8600, 0x062f8600, 0x06338600,
+        0x06348600, 0x06358600, 0x06368600, 0x06378600, 0x06388600, 0x06398600,
+        0x063d8600, 0x06418600, 0x065f8600, 0x06628600, 0x06648600, 0x06668600,
+        0x06678600, 0x06688600, 0x066c8600, 0x066d8600, 0x066e8600, 0x06708600,
+        0x06728600, 0x06758600, 0x01008626, 0x01008627, 0x0100862c, 0x0100862d,
+        0x0100862f, 0x01008630, 0x01008633, 0x01008634, 0x01008636, 0x01008637,
+        0x0100863b, 0x0100863c, 0x0100863e, 0x0100863f, 0x01008642, 0x01008643,
+        0x01008645, 0x05008648, 0x02308801, 0x06308816, 0x02318801, 0x06318816,
+        0x02328801, 0x06328816, 0x02618801, 0x06618816, 0x02638801, 0x06638816,
+        0x02658801, 0x06658816, 0x02698801, 0x06698816, 0x026f8801, 0x066f8816,
+        0x02738801, 0x06738816, 0x02748801, 0x06748816, 0x06208800, 0x06258800,
+        0x062d8800, 0x062e8800, 0x062f8800, 0x06338800, 0x06348800, 0x06358800,
+        0x06368800, 0x06378800, 0x06388800, 0x06398800, 0x063d8800, 0x06418800,
+        0x065f8800, 0x06628800, 0x06648800, 0x06668800, 0x06678800, 0x06688800,
+        0x066c8800, 0x066d8800, 0x066e8800, 0x06708800, 0x06728800, 0x06758800,
+        0x01008826, 0x01008827, 0x0100882c, 0x0100882d, 0x0100882f, 0x01008830,
+        0x01008833, 0x01008834, 0x01008836, 0x01008837, 0x0100883b, 0x0100883c,
+        0x0100883e, 0x0100883f, 0x01008842, 0x01008843, 0x01008845, 0x05008848,
+        0x02309201, 0x06309216, 0x02319201, 0x06319216, 0x02329201, 0x06329216,
+        0x02619201, 0x06619216, 0x02639201, 0x06639216, 0x02659201, 0x06659216,
+        0x02699201, 0x06699216, 0x026f9201, 0x066f9216, 0x02739201, 0x06739216,
+        0x02749201, 0x06749216, 0x06209200, 0x06259200, 0x062d9200, 0x062e9200,
+        0x062f9200, 0x06339200, 0x06349200, 0x06359200, 0x06369200, 0x06379200,
+        0x06389200, 0x06399200, 0x063d9200, 0x06419200, 0x065f9200, 0x06629200,
+        0x06649200, 0x06669200, 0x06679200, 0x06689200, 0x066c9200, 0x066d9200,
+        0x066e9200, 0x06709200, 0x06729200, 0x06759200, 0x01009226, 0x01009227,
+        0x0100922c, 0x0100922d, 0x0100922f, 0x01009230, 0x01009233, 0x01009234,
+        0x01009236, 0x01009237, 0x0100923b, 0x0100923c, 0x0100923e, 0x0100923f,
+        0x01009242, 0x01009243, 0x01009245, 0x05009248
+    },
+    /* 124 */
+    {
+        0x02308502, 0x02308509, 0x02308517, 0x06308528, 0x02318502, 0x02318509,
+        0x02318517, 0x06318528, 0x02328502, 0x02328509, 0x02328517, 0x06328528,
+        0x02618502, 0x02618509, 0x02618517, 0x06618528, 0x02638502, 0x02638509,
+        0x02638517, 0x06638528, 0x02658502, 0x02658509, 0x02658517, 0x06658528,
+        0x02698502, 0x02698509, 0x02698517, 0x06698528, 0x026f8502, 0x026f8509,
+        0x026f8517, 0x066f8528, 0x02738502, 0x02738509, 0x02738517, 0x06738528,
+        0x02748502, 0x02748509, 0x02748517, 0x06748528, 0x02208501, 0x06208516,
+        0x02258501, 0x06258516, 0x022d8501, 0x062d8516, 0x022e8501, 0x062e8516,
+        0x022f8501, 0x062f8516, 0x02338501, 0x06338516, 0x02348501, 0x06348516,
+        0x02358501, 0x06358516, 0x02368501, 0x06368516, 0x02378501, 0x06378516,
+        0x02388501, 0x06388516, 0x02398501, 0x06398516, 0x023d8501, 0x063d8516,
+        0x02418501, 0x06418516, 0x025f8501, 0x065f8516, 0x02628501, 0x06628516,
+        0x02648501, 0x06648516, 0x02668501, 0x06668516, 0x02678501, 0x06678516,
+        0x02688501, 0x06688516, 0x026c8501, 0x066c8516, 0x026d8501, 0x066d8516,
+        0x026e8501, 0x066e8516, 0x02708501, 0x06708516, 0x02728501, 0x06728516,
+        0x02758501, 0x06758516, 0x063a8500, 0x06428500, 0x06438500, 0x06448500,
+        0x06458500, 0x06468500, 0x06478500, 0x06488500, 0x06498500, 0x064a8500,
+        0x064b8500, 0x064c8500, 0x064d8500, 0x064e8500, 0x064f8500, 0x06508500,
+        0x06518500, 0x06528500, 0x06538500, 0x06548500, 0x06558500, 0x06568500,
+        0x06578500, 0x06598500, 0x066a8500, 0x066b8500, 0x06718500, 0x06768500,
+        0x06778500, 0x06788500, 0x06798500, 0x067a8500, 0x01008546, 0x01008547,
+        0x01008549, 0x0500854a, 0x02308602, 0x02308609, 0x02308617, 0x06308628,
+        0x02318602, 0x02318609, 0x02318617, 0x06318628, 0x02328602, 0x02328609,
+        0x02328617, 0x06328628, 0x02618602, 0x02618609, 0x02618617, 0x06618628,
+        0x02638602, 0x02638609, 0x02638617, 0x06638628, 0x02658602, 0x02658609,
+        0x02658617, 0x06658628, 0x02698602, 0x02698609, 0x02698617, 0x06698628,
+        0x026f8602, 0x026f8609, 0x026f8617, 0x066f8628, 0x02738602, 0x02738609,
+        0x02738617, 0x06738628, 0x02748602, 0x02748609, 0x02748617, 0x06748628,
+        0x02208601, 0x06208616, 0x02258601, 0x06258616, 0x022d8601, 0x062d8616,
+        0x022e8601, 0x062e8616, 0x022f8601, 0x062f8616, 0x02338601, 0x06338616,
+        0x02348601, 0x06348616, 0x02358601, 0x06358616, 0x02368601, 0x06368616,
+        0x02378601, 0x06378616, 0x02388601, 0x06388616, 0x02398601, 0x06398616,
+        0x023d8601, 0x063d8616, 0x02418601, 0x06418616, 0x025f8601, 0x065f8616,
+        0x02628601, 0x06628616, 0x02648601, 0x06648616, 0x02668601, 0x06668616,
+        0x02678601, 0x06678616, 0x02688601, 0x06688616, 0x026c8601, 0x066c8616,
+        0x026d8601, 0x066d8616, 0x026e8601, 0x066e8616, 0x02708601, 0x06708616,
+        0x02728601, 0x06728616, 0x02758601, 0x06758616, 0x063a8600, 0x06428600,
+        0x06438600, 0x06448600, 0x06458600, 0x06468600, 0x06478600, 0x06488600,
+        0x06498600, 0x064a8600, 0x064b8600, 0x064c8600, 0x064d8600, 0x064e8600,
+        0x064f8600, 0x06508600, 0x06518600, 0x06528600, 0x06538600, 0x06548600,
+        0x06558600, 0x06568600, 0x06578600, 0x06598600, 0x066a8600, 0x066b8600,
+        0x06718600, 0x06768600, 0x06778600, 0x06788600, 0x06798600, 0x067a8600,
+        0x01008646, 0x01008647, 0x01008649, 0x0500864a
+    },
+    /* 125 */
+    {
+        0x02308802, 0x02308809, 0x02308817, 0x06308828, 0x02318802, 0x02318809,
+        0x02318817, 0x06318828, 0x02328802, 0x02328809, 0x02328817, 0x06328828,
+        0x02618802, 0x02618809, 0x02618817, 0x06618828, 0x02638802, 0x02638809,
+        0x02638817, 0x06638828, 0x02658802, 0x02658809, 0x02658817, 0x06658828,
+        0x02698802, 0x02698809, 0x02698817, 0x06698828, 0x026f8802, 0x026f8809,
+        0x026f8817, 0x066f8828, 0x02738802, 0x02738809, 0x02738817, 0x06738828,
+        0x02748802, 0x02748809, 0x02748817, 0x06748828, 0x02208801, 0x06208816,
+        0x02258801, 0x06258816, 0x022d8801, 0x062d8816, 0x022e8801, 0x062e8816,
+        0x022f8801, 0x062f8816, 0x02338801, 0x06338816, 0x02348801, 0x06348816,
+        0x02358801, 0x06358816, 0x02368801, 0x06368816, 0x02378801, 0x06378816,
+        0x02388801, 0x06388816, 0x02398801, 0x06398816, 0x023d8801, 0x063d8816,
+        0x02418801, 0x06418816, 0x025f8801, 0x065f8816, 0x02628801, 0x06628816,
+        0x02648801, 0x06648816, 0x02668801, 0x06668816, 0x02678801, 0x06678816,
+        0x02688801, 0x06688816, 0x026c8801, 0x066c8816, 0x026d8801, 0x066d8816,
+        0x026e8801, 0x066e8816, 0x02708801, 0x06708816, 0x02728801, 0x06728816,
+        0x02758801, 0x06758816, 0x063a8800, 0x06428800, 0x06438800, 0x06448800,
+        0x06458800, 0x06468800, 0x06478800, 0x06488800, 0x06498800, 0x064a8800,
+        0x064b8800, 0x064c8800, 0x064d8800, 0x064e8800, 0x064f8800, 0x06508800,
+        0x06518800, 0x06528800, 0x06538800, 0x06548800, 0x06558800, 0x06568800,
+        0x06578800, 0x06598800, 0x066a8800, 0x066b8800, 0x06718800, 0x06768800,
+        0x06778800, 0x06788800, 0x06798800, 0x067a8800, 0x01008846, 0x01008847,
+        0x01008849, 0x0500884a, 0x02309202, 0x02309209, 0x02309217, 0x06309228,
+        0x02319202, 0x02319209, 0x02319217, 0x06319228, 0x02329202, 0x02329209,
+        0x02329217, 0x06329228, 0x02619202, 0x02619209, 0x02619217, 0x06619228,
+        0x02639202, 0x02639209, 0x02639217, 0x06639228, 0x02659202, 0x02659209,
+        0x02659217, 0x06659228, 0x02699202, 0x02699209, 0x02699217, 0x06699228,
+        0x026f9202, 0x026f9209, 0x026f9217, 0x066f9228, 0x02739202, 0x02739209,
+        0x02739217, 0x06739228, 0x02749202, 0x02749209, 0x02749217, 0x06749228,
+        0x02209201, 0x06209216, 0x02259201, 0x06259216, 0x022d9201, 0x062d9216,
+        0x022e9201, 0x062e9216, 0x022f9201, 0x062f9216, 0x02339201, 0x06339216,
+        0x02349201, 0x06349216, 0x02359201, 0x06359216, 0x02369201, 0x06369216,
+        0x02379201, 0x06379216, 0x02389201, 0x06389216, 0x02399201, 0x06399216,
+        0x023d9201, 0x063d9216, 0x02419201, 0x06419216, 0x025f9201, 0x065f9216,
+        0x02629201, 0x06629216, 0x02649201, 0x06649216, 0x02669201, 0x06669216,
+        0x02679201, 0x06679216, 0x02689201, 0x06689216, 0x026c9201, 0x066c9216,
+        0x026d9201, 0x066d9216, 0x026e9201, 0x066e9216, 0x02709201, 0x06709216,
+        0x02729201, 0x06729216, 0x02759201, 0x06759216, 0x063a9200, 0x06429200,
+        0x06439200, 0x06449200, 0x06459200, 0x06469200, 0x06479200, 0x06489200,
+        0x06499200, 0x064a9200, 0x064b9200, 0x064c9200, 0x064d9200, 0x064e9200,
+        0x064f9200, 0x06509200, 0x06519200, 0x06529200, 0x06539200, 0x06549200,
+        0x06559200, 0x06569200, 0x06579200, 0x06599200, 0x066a9200, 0x066b9200,
+        0x06719200, 0x06769200, 0x06779200, 0x06789200, 0x06799200, 0x067a9200,
+        0x01009246, 0x01009247, 0x01009249, 0x0500924a
+    },
+    /* 126 */
+    {
+        0x06309a00, 0x06319a00, 0x06329a00, 0x06619a00, 0x06639a00, 0x06659a00,
+        0x06699a00, 0x066f9a00, 0x06739a00, 0x06749a00, 0x01009a0d, 0x01009a0e,
+        0x01009a11, 0x01009a12, 0x01009a14, 0x01009a15, 0x01009a1a, 0x01009a1b,
+        0x01009a1d, 0x01009a1e, 0x01009a21, 0x01009a22, 0x01009a24, 0x01009a25,
+        0x01009a2b, 0x01009a2e, 0x01009a32, 0x01009a35, 0x01009a3a, 0x01009a3d,
+        0x01009a41, 0x05009a44, 0x06309c00, 0x06319c00, 0x06329c00, 0x06619c00,
+        0x06639c00, 0x06659c00, 0x06699c00, 0x066f9c00, 0x06739c00, 0x06749c00,
+        0x01009c0d, 0x01009c0e, 0x01009c11, 0x01009c12, 0x01009c14, 0x01009c15,
+        0x01009c1a, 0x01009c1b, 0x01009c1d, 0x01009c1e, 0x01009c21, 0x01009c22,
+        0x01009c24, 0x01009c25, 0x01009c2b, 0x01009c2e, 0x01009c32, 0x01009c35,
+        0x01009c3a, 0x01009c3d, 0x01009c41, 0x05009c44, 0x0630a000, 0x0631a000,
+        0x0632a000, 0x0661a000, 0x0663a000, 0x0665a000, 0x0669a000, 0x066fa000,
+        0x0673a000, 0x0674a000, 0x0100a00d, 0x0100a00e, 0x0100a011, 0x0100a012,
+        0x0100a014, 0x0100a015, 0x0100a01a, 0x0100a01b, 0x0100a01d, 0x0100a01e,
+        0x0100a021, 0x0100a022, 0x0100a024, 0x0100a025, 0x0100a02b, 0x0100a02e,
+        0x0100a032, 0x0100a035, 0x0100a03a, 0x0100a03d, 0x0100a041, 0x0500a044,
+        0x0630a300, 0x0631a300, 0x0632a300, 0x0661a300, 0x0663a300, 0x0665a300,
+        0x0669a300, 0x066fa300, 0x0673a300, 0x0674a300, 0x0100a30d, 0x0100a30e,
+        0x0100a311, 0x0100a312, 0x0100a314, 0x0100a315, 0x0100a31a, 0x0100a31b,
+        0x0100a31d, 0x0100a31e, 0x0100a321, 0x0100a322, 0x0100a324, 0x0100a325,
+        0x0100a32b, 0x0100a32e, 0x0100a332, 0x0100a335, 0x0100a33a, 0x0100a33d,
+        0x0100a341, 0x0500a344, 0x0630a400, 0x0631a400, 0x0632a400, 0x0661a400,
+        0x0663a400, 0x0665a400, 0x0669a400, 0x066fa400, 0x0673a400, 0x0674a400,
+        0x0100a40d, 0x0100a40e, 0x0100a411, 0x0100a412, 0x0100a414, 0x0100a415,
+        0x0100a41a, 0x0100a41b, 0x0100a41d, 0x0100a41e, 0x0100a421, 0x0100a422,
+        0x0100a424, 0x0100a425, 0x0100a42b, 0x0100a42e, 0x0100a432, 0x0100a435,
+        0x0100a43a, 0x0100a43d, 0x0100a441, 0x0500a444, 0x0630a900, 0x0631a900,
+        0x0632a900, 0x0661a900, 0x0663a900, 0x0665a900, 0x0669a900, 0x066fa900,
+        0x0673a900, 0x0674a900, 0x0100a90d, 0x0100a90e, 0x0100a911, 0x0100a912,
+        0x0100a914, 0x0100a915, 0x0100a91a, 0x0100a91b, 0x0100a91d, 0x0100a91e,
+        0x0100a921, 0x0100a922, 0x0100a924, 0x0100a925, 0x0100a92b, 0x0100a92e,
+        0x0100a932, 0x0100a935, 0x0100a93a, 0x0100a93d, 0x0100a941, 0x0500a944,
+        0x0630aa00, 0x0631aa00, 0x0632aa00, 0x0661aa00, 0x0663aa00, 0x0665aa00,
+        0x0669aa00, 0x066faa00, 0x0673aa00, 0x0674aa00, 0x0100aa0d, 0x0100aa0e,
+        0x0100aa11, 0x0100aa12, 0x0100aa14, 0x0100aa15, 0x0100aa1a, 0x0100aa1b,
+        0x0100aa1d, 0x0100aa1e, 0x0100aa21, 0x0100aa22, 0x0100aa24, 0x0100aa25,
+        0x0100aa2b, 0x0100aa2e, 0x0100aa32, 0x0100aa35, 0x0100aa3a, 0x0100aa3d,
+        0x0100aa41, 0x0500aa44, 0x0630ad00, 0x0631ad00, 0x0632ad00, 0x0661ad00,
+        0x0663ad00, 0x0665ad00, 0x0669ad00, 0x066fad00, 0x0673ad00, 0x0674ad00,
+        0x0100ad0d, 0x0100ad0e, 0x0100ad11, 0x0100ad12, 0x0100ad14, 0x0100ad15,
+        0x0100ad1a, 0x0100ad1b, 0x0100ad1d, 0x0100ad1e, 0x0100ad21, 0x0100ad22,
+        0x0100ad24, 0x0100ad25, 0x0100ad2b, 0x0100ad2e, 0x0100ad32, 0x0100ad35,
+        0x0100ad3a, 0x0100ad3d, 0x0100ad41, 0x0500ad44
+    },
+    /* 127 */
+    {
+        0x02309a01, 0x06309a16, 0x02319a01, 0x06319a16, 0x02329a01, 0x06329a16,
+        0x02619a01, 0x06619a16, 0x02639a01, 0x06639a16, 0x02659a01, 0x06659a16,
+        0x02699a01, 0x06699a16, 0x026f9a01, 0x066f9a16, 0x02739a01, 0x06739a16,
+        0x02749a01, 0x06749a16, 0x06209a00, 0x06259a00, 0x062d9a00, 0x062e9a00,
+        0x062f9a00, 0x06339a00, 0x06349a00, 0x06359a00, 0x06369a00, 0x06379a00,
+        0x06389a00, 0x06399a00, 0x063d9a00, 0x06419a00, 0x065f9a00, 0x06629a00,
+        0x06649a00, 0x06669a00, 0x06679a00, 0x06689a00, 0x066c9a00, 0x066d9a00,
+        0x066e9a00, 0x06709a00, 0x06729a00, 0x06759a00, 0x01009a26, 0x01009a27,
+        0x01009a2c, 0x01009a2d, 0x01009a2f, 0x01009a30, 0x01009a33, 0x01009a34,
+        0x01009a36, 0x01009a37, 0x01009a3b, 0x01009a3c, 0x01009a3e, 0x01009a3f,
+        0x01009a42, 0x01009a43, 0x01009a45, 0x05009a48, 0x02309c01, 0x06309c16,
+        0x02319c01, 0x06319c16, 0x02329c01, 0x06329c16, 0x02619c01, 0x06619c16,
+        0x02639c01, 0x06639c16, 0x02659c01, 0x06659c16, 0x02699c01, 0x06699c16,
+        0x026f9c01, 0x066f9c16, 0x02739c01, 0x06739c16, 0x02749c01, 0x06749c16,
+        0x06209c00, 0x06259c00, 0x062d9c00, 0x062e9c00, 0x062f9c00, 0x06339c00,
+        0x06349c00, 0x06359c00, 0x06369c00, 0x06379c00, 0x06389c00, 0x06399c00,
+        0x063d9c00, 0x06419c00, 0x065f9c00, 0x06629c00, 0x06649c00, 0x06669c00,
+        0x06679c00, 0x06689c00, 0x066c9c00, 0x066d9c00, 0x066e9c00, 0x06709c00,
+        0x06729c00, 0x06759c00, 0x01009c26, 0x01009c27, 0x01009c2c, 0x01009c2d,
+        0x01009c2f, 0x01009c30, 0x01009c33, 0x01009c34, 0x01009c36, 0x01009c37,
+        0x01009c3b, 0x01009c3c, 0x01009c3e, 0x01009c3f, 0x01009c42, 0x01009c43,
+        0x01009c45, 0x05009c48, 0x0230a001, 0x0630a016, 0x0231a001, 0x0631a016,
+        0x0232a001, 0x0632a016, 0x0261a001, 0x0661a016, 0x0263a001, 0x0663a016,
+        0x0265a001, 0x0665a016, 0x0269a001, 0x0669a016, 0x026fa001, 0x066fa016,
+        0x0273a001, 0x0673a016, 0x0274a001, 0x0674a016, 0x0620a000, 0x0625a000,
+        0x062da000, 0x062ea000, 0x062fa000, 0x0633a000, 0x0634a000, 0x0635a000,
+        0x0636a000, 0x0637a000, 0x0638a000, 0x0639a000, 0x063da000, 0x0641a000,
+        0x065fa000, 0x0662a000, 0x0664a000, 0x0666a000, 0x0667a000, 0x0668a000,
+        0x066ca000, 0x066da000, 0x066ea000, 0x0670a000, 0x0672a000, 0x0675a000,
+        0x0100a026, 0x0100a027, 0x0100a02c, 0x0100a02d, 0x0100a02f, 0x0100a030,
+        0x0100a033, 0x0100a034, 0x0100a036, 0x0100a037, 0x0100a03b, 0x0100a03c,
+        0x0100a03e, 0x0100a03f, 0x0100a042, 0x0100a043, 0x0100a045, 0x0500a048,
+        0x0230a301, 0x0630a316, 0x0231a301, 0x0631a316, 0x0232a301, 0x0632a316,
+        0x0261a301, 0x0661a316, 0x0263a301, 0x0663a316, 0x0265a301, 0x0665a316,
+        0x0269a301, 0x0669a316, 0x026fa301, 0x066fa316, 0x0273a301, 0x0673a316,
+        0x0274a301, 0x0674a316, 0x0620a300, 0x0625a300, 0x062da300, 0x062ea300,
+        0x062fa300, 0x0633a300, 0x0634a300, 0x0635a300, 0x0636a300, 0x0637a300,
+        0x0638a300, 0x0639a300, 0x063da300, 0x0641a300, 0x065fa300, 0x0662a300,
+        0x0664a300, 0x0666a300, 0x0667a300, 0x0668a300, 0x066ca300, 0x066da300,
+        0x066ea300, 0x0670a300, 0x0672a300, 0x0675a300, 0x0100a326, 0x0100a327,
+        0x0100a32c, 0x0100a32d, 0x0100a32f, 0x0100a330, 0x0100a333, 0x0100a334,
+        0x0100a336, 0x0100a337, 0x0100a33b, 0x0100a33c, 0x0100a33e, 0x0100a33f,
+        0x0100a342, 0x0100a343, 0x0100a345, 0x0500a348
+    },
+    /* 128 */
+    {
+        0x02309a02, 0x02309a09, 0x02309a17, 0x06309a28, 0x02319a02, 0x02319a09,
+        0x02319a17, 0x06319a28, 0x02329a02, 0x02329a09, 0x02329a17, 0x06329a28,
+        0x02619a02, 0x02619a09, 0x02619a17, 0x06619a28, 0x02639a02, 0x02639a09,
+        0x02639a17, 0x06639a28, 0x02659a02, 0x02659a09, 0x02659a17, 0x06659a28,
+        0x02699a02, 0x02699a09, 0x02699a17, 0x06699a28, 0x026f9a02, 0x026f9a09,
+        0x026f9a17, 0x066f9a28, 0x02739a02, 0x02739a09, 0x02739a17, 0x06739a28,
+        0x02749a02, 0x02749a09, 0x02749a17, 0x06749a28, 0x02209a01, 0x06209a16,
+        0x02259a01, 0x06259a16, 0x022d9a01, 0x062d9a16, 0x022e9a01, 0x062e9a16,
+        0x022f9a01, 0x062f9a16, 0x02339a01, 0x06339a16, 0x02349a01, 0x06349a16,
+        0x02359a01, 0x06359a16, 0x02369a01, 0x06369a16, 0x02379a01, 0x06379a16,
+        0x02389a01, 0x06389a16, 0x02399a01, 0x06399a16, 0x023d9a01, 0x063d9a16,
+        0x02419a01, 0x06419a16, 0x025f9a01, 0x065f9a16, 0x02629a01, 0x06629a16,
+        0x02649a01, 0x06649a16, 0x02669a01, 0x06669a16, 0x02679a01, 0x06679a16,
+        0x02689a01, 0x06689a16, 0x026c9a01, 0x066c9a16, 0x026d9a01, 0x066d9a16,
+        0x026e9a01, 0x066e9a16, 0x02709a01, 0x06709a16, 0x02729a01, 0x06729a16,
+        0x02759a01, 0x06759a16, 0x063a9a00, 0x06429a00, 0x06439a00, 0x06449a00,
+        0x06459a00, 0x06469a00, 0x06479a00, 0x06489a00, 0x06499a00, 0x064a9a00,
+        0x064b9a00, 0x064c9a00, 0x064d9a00, 0x064e9a00, 0x064f9a00, 0x06509a00,
+        0x06519a00, 0x06529a00, 0x06539a00, 0x06549a00, 0x06559a00, 0x06569a00,
+        0x06579a00, 0x06599a00, 0x066a9a00, 0x066b9a00, 0x06719a00, 0x06769a00,
+        0x06779a00, 0x06789a00, 0x06799a00, 0x067a9a00, 0x01009a46, 0x01009a47,
+        0x01009a49, 0x05009a4a, 0x02309c02, 0x02309c09, 0x02309c17, 0x06309c28,
+        0x02319c02, 0x02319c09, 0x02319c17, 0x06319c28, 0x02329c02, 0x02329c09,
+        0x02329c17, 0x06329c28, 0x02619c02, 0x02619c09, 0x02619c17, 0x06619c28,
+        0x02639c02, 0x02639c09, 0x02639c17, 0x06639c28, 0x02659c02, 0x02659c09,
+        0x02659c17, 0x06659c28, 0x02699c02, 0x02699c09, 0x02699c17, 0x06699c28,
+        0x026f9c02, 0x026f9c09, 0x026f9c17, 0x066f9c28, 0x02739c02, 0x02739c09,
+        0x02739c17, 0x06739c28, 0x02749c02, 0x02749c09, 0x02749c17, 0x06749c28,
+        0x02209c01, 0x06209c16, 0x02259c01, 0x06259c16, 0x022d9c01, 0x062d9c16,
+        0x022e9c01, 0x062e9c16, 0x022f9c01, 0x062f9c16, 0x02339c01, 0x06339c16,
+        0x02349c01, 0x06349c16, 0x02359c01, 0x06359c16, 0x02369c01, 0x06369c16,
+        0x02379c01, 0x06379c16, 0x02389c01, 0x06389c16, 0x02399c01, 0x06399c16,
+        0x023d9c01, 0x063d9c16, 0x02419c01, 0x06419c16, 0x025f9c01, 0x065f9c16,
+        0x02629c01, 0x06629c16, 0x02649c01, 0x06649c16, 0x02669c01, 0x06669c16,
+        0x02679c01, 0x06679c16, 0x02689c01, 0x06689c16, 0x026c9c01, 0x066c9c16,
+        0x026d9c01, 0x066d9c16, 0x026e9c01, 0x066e9c16, 0x02709c01, 0x06709c16,
+        0x02729c01, 0x06729c16, 0x02759c01, 0x06759c16, 0x063a9c00, 0x06429c00,
+        0x06439c00, 0x06449c00, 0x06459c00, 0x06469c00, 0x06479c00, 0x06489c00,
+        0x06499c00, 0x064a9c00, 0x064b9c00, 0x064c9c00, 0x064d9c00, 0x064e9c00,
+        0x064f9c00, 0x06509c00, 0x06519c00, 0x06529c00, 0x06539c00, 0x06549c00,
+        0x06559c00, 0x06569c00, 0x06579c00, 0x06599c00, 0x066a9c00, 0x066b9c00,
+        0x06719c00, 0x06769c00, 0x06779c00, 0x06789c00, 0x06799c00, 0x067a9c00,
+        0x01009c46, 0x01009c47, 0x01009c49, 0x05009c4a
+    },
+    /* 129 */
+    {
+        0x0230a002, 0x0230a009, 0x0230a017, 0x0630a028, 0x0231a002, 0x0231a009,
+        0x0231a017, 0x0631a028, 0x0232a002, 0x0232a009, 0x0232a017, 0x0632a028,
+        0x0261a002, 0x0261a009, 0x0261a017, 0x0661a028, 0x0263a002, 0x0263a009,
+        0x0263a017, 0x0663a028, 0x0265a002, 0x0265a009, 0x0265a017, 0x0665a028,
+        0x0269a002, 0x0269a009, 0x0269a017, 0x0669a028, 0x026fa002, 0x026fa009,
+        0x026fa017, 0x066fa028, 0x0273a002, 0x0273a009, 0x0273a017, 0x0673a028,
+        0x0274a002, 0x0274a009, 0x0274a017, 0x0674a028, 0x0220a001, 0x0620a016,
+        0x0225a001, 0x0625a016, 0x022da001, 0x062da016, 0x022ea001, 0x062ea016,
+        0x022fa001, 0x062fa016, 0x0233a001, 0x0633a016, 0x0234a001, 0x0634a016,
+        0x0235a001, 0x0635a016, 0x0236a001, 0x0636a016, 0x0237a001, 0x0637a016,
+        0x0238a001, 0x0638a016, 0x0239a001, 0x0639a016, 0x023da001, 0x063da016,
+        0x0241a001, 0x0641a016, 0x025fa001, 0x065fa016, 0x0262a001, 0x0662a016,
+        0x0264a001, 0x0664a016, 0x0266a001, 0x0666a016, 0x0267a001, 0x0667a016,
+        0x0268a001, 0x0668a016, 0x026ca001, 0x066ca016, 0x026da001, 0x066da016,
+        0x026ea001, 0x066ea016, 0x0270a001, 0x0670a016, 0x0272a001, 0x0672a016,
+        0x0275a001, 0x0675a016, 0x063aa000, 0x0642a000, 0x0643a000, 0x0644a000,
+        0x0645a000, 0x0646a000, 0x0647a000, 0x0648a000, 0x0649a000, 0x064aa000,
+        0x064ba000, 0x064ca000, 0x064da000, 0x064ea000, 0x064fa000, 0x0650a000,
+        0x0651a000, 0x0652a000, 0x0653a000, 0x0654a000, 0x0655a000, 0x0656a000,
+        0x0657a000, 0x0659a000, 0x066aa000, 0x066ba000, 0x0671a000, 0x0676a000,
+        0x0677a000, 0x0678a000, 0x0679a000, 0x067aa000, 0x0100a046, 0x0100a047,
+        0x0100a049, 0x0500a04a, 0x0230a302, 0x0230a309, 0x0230a317, 0x0630a328,
+        0x0231a302, 0x0231a309, 0x0231a317, 0x0631a328, 0x0232a302, 0x0232a309,
+        0x0232a317, 0x0632a328, 0x0261a302, 0x0261a309, 0x0261a317, 0x0661a328,
+        0x0263a302, 0x0263a309, 0x0263a317, 0x0663a328, 0x0265a302, 0x0265a309,
+        0x0265a317, 0x0665a328, 0x0269a302, 0x0269a309, 0x0269a317, 0x0669a328,
+        0x026fa302, 0x026fa309, 0x026fa317, 0x066fa328, 0x0273a302, 0x0273a309,
+        0x0273a317, 0x0673a328, 0x0274a302, 0x0274a309, 0x0274a317, 0x0674a328,
+        0x0220a301, 0x0620a316, 0x0225a301, 0x0625a316, 0x022da301, 0x062da316,
+        0x022ea301, 0x062ea316, 0x022fa301, 0x062fa316, 0x0233a301, 0x0633a316,
+        0x0234a301, 0x0634a316, 0x0235a301, 0x0635a316, 0x0236a301, 0x0636a316,
+        0x0237a301, 0x0637a316, 0x0238a301, 0x0638a316, 0x0239a301, 0x0639a316,
+        0x023da301, 0x063da316, 0x0241a301, 0x0641a316, 0x025fa301, 0x065fa316,
+        0x0262a301, 0x0662a316, 0x0264a301, 0x0664a316, 0x0266a301, 0x0666a316,
+        0x0267a301, 0x0667a316, 0x0268a301, 0x0668a316, 0x026ca301, 0x066ca316,
+        0x026da301, 0x066da316, 0x026ea301, 0x066ea316, 0x0270a301, 0x0670a316,
+        0x0272a301, 0x0672a316, 0x0275a301, 0x0675a316, 0x063aa300, 0x0642a300,
+        0x0643a300, 0x0644a300, 0x0645a300, 0x0646a300, 0x0647a300, 0x0648a300,
+        0x0649a300, 0x064aa300, 0x064ba300, 0x064ca300, 0x064da300, 0x064ea300,
+        0x064fa300, 0x0650a300, 0x0651a300, 0x0652a300, 0x0653a300, 0x0654a300,
+        0x0655a300, 0x0656a300, 0x0657a300, 0x0659a300, 0x066aa300, 0x066ba300,
+        0x0671a300, 0x0676a300, 0x0677a300, 0x0678a300, 0x0679a300, 0x067aa300,
+        0x0100a346, 0x0100a347, 0x0100a349, 0x0500a34a
+    },
+    /* 130 */
+    {
+        0x0230a401, 0x0630a416, 0x0231a401, 0x0631a416, 0x0232a401, 0x0632a416,
+        0x0261a401, 0x0661a416, 0x0263a401, 0x0663a416, 0x0265a401, 0x0665a416,
+        0x0269a401, 0x0669a416, 0x026fa401, 0x066fa416, 0x0273a401, 0x0673a416,
+        0x0274a401, 0x0674a416, 0x0620a400, 0x0625a400, 0x062da400, 0x062ea400,
+        0x062fa400, 0x0633a400, 0x0634a400, 0x0635a400, 0x0636a400, 0x0637a400,
+        0x0638a400, 0x0639a400, 0x063da400, 0x0641a400, 0x065fa400, 0x0662a400,
+        0x0664a400, 0x0666a400, 0x0667a400, 0x0668a400, 0x066ca400, 0x066da400,
+        0x066ea400, 0x0670a400, 0x0672a400, 0x0675a400, 0x0100a426, 0x0100a427,
+        0x0100a42c, 0x0100a42d, 0x0100a42f, 0x0100a430, 0x0100a433, 0x0100a434,
+        0x0100a436, 0x0100a437, 0x0100a43b, 0x0100a43c, 0x0100a43e, 0x0100a43f,
+        0x0100a442, 0x0100a443, 0x0100a445, 0x0500a448, 0x0230a901, 0x0630a916,
+        0x0231a901, 0x0631a916, 0x0232a901, 0x0632a916, 0x0261a901, 0x0661a916,
+        0x0263a901, 0x0663a916, 0x0265a901, 0x0665a916, 0x0269a901, 0x0669a916,
+        0x026fa901, 0x066fa916, 0x0273a901, 0x0673a916, 0x0274a901, 0x0674a916,
+        0x0620a900, 0x0625a900, 0x062da900, 0x062ea900, 0x062fa900, 0x0633a900,
+        0x0634a900, 0x0635a900, 0x0636a900, 0x0637a900, 0x0638a900, 0x0639a900,
+        0x063da900, 0x0641a900, 0x065fa900, 0x0662a900, 0x0664a900, 0x0666a900,
+        0x0667a900, 0x0668a900, 0x066ca900, 0x066da900, 0x066ea900, 0x0670a900,
+        0x0672a900, 0x0675a900, 0x0100a926, 0x0100a927, 0x0100a92c, 0x0100a92d,
+        0x0100a92f, 0x0100a930, 0x0100a933, 0x0100a934, 0x0100a936, 0x0100a937,
+        0x0100a93b, 0x0100a93c, 0x0100a93e, 0x0100a93f, 0x0100a942, 0x0100a943,
+        0x0100a945, 0x0500a948, 0x0230aa01, 0x0630aa16, 0x0231aa01, 0x0631aa16,
+        0x0232aa01, 0x0632aa16, 0x0261aa01, 0x0661aa16, 0x0263aa01, 0x0663aa16,
+        0x0265aa01, 0x0665aa16, 0x0269aa01, 0x0669aa16, 0x026faa01, 0x066faa16,
+        0x0273aa01, 0x0673aa16, 0x0274aa01, 0x0674aa16, 0x0620aa00, 0x0625aa00,
+        0x062daa00, 0x062eaa00, 0x062faa00, 0x0633aa00, 0x0634aa00, 0x0635aa00,
+        0x0636aa00, 0x0637aa00, 0x0638aa00, 0x0639aa00, 0x063daa00, 0x0641aa00,
+        0x065faa00, 0x0662aa00, 0x0664aa00, 0x0666aa00, 0x0667aa00, 0x0668aa00,
+        0x066caa00, 0x066daa00, 0x066eaa00, 0x0670aa00, 0x0672aa00, 0x0675aa00,
+        0x0100aa26, 0x0100aa27, 0x0100aa2c, 0x0100aa2d, 0x0100aa2f, 0x0100aa30,
+        0x0100aa33, 0x0100aa34, 0x0100aa36, 0x0100aa37, 0x0100aa3b, 0x0100aa3c,
+        0x0100aa3e, 0x0100aa3f, 0x0100aa42, 0x0100aa43, 0x0100aa45, 0x0500aa48,
+        0x0230ad01, 0x0630ad16, 0x0231ad01, 0x0631ad16, 0x0232ad01, 0x0632ad16,
+        0x0261ad01, 0x0661ad16, 0x0263ad01, 0x0663ad16, 0x0265ad01, 0x0665ad16,
+        0x0269ad01, 0x0669ad16, 0x026fad01, 0x066fad16, 0x0273ad01, 0x0673ad16,
+        0x0274ad01, 0x0674ad16, 0x0620ad00, 0x0625ad00, 0x062dad00, 0x062ead00,
+        0x062fad00, 0x0633ad00, 0x0634ad00, 0x0635ad00, 0x0636ad00, 0x0637ad00,
+        0x0638ad00, 0x0639ad00, 0x063dad00, 0x0641ad00, 0x065fad00, 0x0662ad00,
+        0x0664ad00, 0x0666ad00, 0x0667ad00, 0x0668ad00, 0x066cad00, 0x066dad00,
+        0x066ead00, 0x0670ad00, 0x0672ad00, 0x0675ad00, 0x0100ad26, 0x0100ad27,
+        0x0100ad2c, 0x0100ad2d, 0x0100ad2f, 0x0100ad30, 0x0100ad33, 0x0100ad34,
+        0x0100ad36, 0x0100ad37, 0x0100ad3b, 0x0100ad3c, 0x0100ad3e, 0x0100ad3f,
+        0x0100ad42, 0x0100ad43, 0x0100ad45, 0x0500ad48
+    },
+    /* 131 */
+    {
+        0x0230a402, 0x0230a409, 0x0230a417, 0x0630a428, 0x0231a402, 0x0231a409,
+        0x0231a417, 0x0631a428, 0x0232a402, 0x0232a409, 0x0232a417, 0x0632a428,
+        0x0261a402, 0x0261a409, 0x0261a417, 0x0661a428, 0x0263a402, 0x0263a409,
+        0x0263a417, 0x0663a428, 0x0265a402, 0x0265a409, 0x0265a417, 0x0665a428,
+        0x0269a402, 0x0269a409, 0x0269a417, 0x0669a428, 0x026fa402, 0x026fa409,
+        0x026fa417, 0x066fa428, 0x0273a402, 0x0273a409, 0x0273a417, 0x0673a428,
+        0x0274a402, 0x0274a409, 0x0274a417, 0x0674a428, 0x0220a401, 0x0620a416,
+        0x0225a401, 0x0625a416, 0x022da401, 0x062da416, 0x022ea401, 0x062ea416,
+        0x022fa401, 0x062fa416, 0x0233a401, 0x0633a416, 0x0234a401, 0x0634a416,
+        0x0235a401, 0x0635a416, 0x0236a401, 0x0636a416, 0x0237a401, 0x0637a416,
+        0x0238a401, 0x0638a416, 0x0239a401, 0x0639a416, 0x023da401, 0x063da416,
+        0x0241a401, 0x0641a416, 0x025fa401, 0x065fa416, 0x0262a401, 0x0662a416,
+        0x0264a401, 0x0664a416, 0x0266a401, 0x0666a416, 0x0267a401, 0x0667a416,
+        0x0268a401, 0x0668a416, 0x026ca401, 0x066ca416, 0x026da401, 0x066da416,
+        0x026ea401, 0x066ea416, 0x0270a401, 0x0670a416, 0x0272a401, 0x0672a416,
+        0x0275a401, 0x0675a416, 0x063aa400, 0x0642a400, 0x0643a400, 0x0644a400,
+        0x0645a400, 0x0646a400, 0x0647a400, 0x0648a400, 0x0649a400, 0x064aa400,
+        0x064ba400, 0x064ca400, 0x064da400, 0x064ea400, 0x064fa400, 0x0650a400,
+        0x0651a400, 0x0652a400, 0x0653a400, 0x0654a400, 0x0655a400, 0x0656a400,
+        0x0657a400, 0x0659a400, 0x066aa400, 0x066ba400, 0x0671a400, 0x0676a400,
+        0x0677a400, 0x0678a400, 0x0679a400, 0x067aa400, 0x0100a446, 0x0100a447,
+        0x0100a449, 0x0500a44a, 0x0230a902, 0x0230a909, 0x0230a917, 0x0630a928,
+        0x0231a902, 0x0231a909, 0x0231a917, 0x0631a928, 0x0232a902, 0x0232a909,
+        0x0232a917, 0x0632a928, 0x0261a902, 0x0261a909, 0x0261a917, 0x0661a928,
+        0x0263a902, 0x0263a909, 0x0263a917, 0x0663a928, 0x0265a902, 0x0265a909,
+        0x0265a917, 0x0665a928, 0x0269a902, 0x0269a909, 0x0269a917, 0x0669a928,
+        0x026fa902, 0x026fa909, 0x026fa917, 0x066fa928, 0x0273a902, 0x0273a909,
+        0x0273a917, 0x0673a928, 0x0274a902, 0x0274a909, 0x0274a917, 0x0674a928,
+        0x0220a901, 0x0620a916, 0x0225a901, 0x0625a916, 0x022da901, 0x062da916,
+        0x022ea901, 0x062ea916, 0x022fa901, 0x062fa916, 0x0233a901, 0x0633a916,
+        0x0234a901, 0x0634a916, 0x0235a901, 0x0635a916, 0x0236a901, 0x0636a916,
+        0x0237a901, 0x0637a916, 0x0238a901, 0x0638a916, 0x0239a901, 0x0639a916,
+        0x023da901, 0x063da916, 0x0241a901, 0x0641a916, 0x025fa901, 0x065fa916,
+        0x0262a901, 0x0662a916, 0x0264a901, 0x0664a916, 0x0266a901, 0x0666a916,
+        0x0267a901, 0x0667a916, 0x0268a901, 0x0668a916, 0x026ca901, 0x066ca916,
+        0x026da901, 0x066da916, 0x026ea901, 0x066ea916, 0x0270a901, 0x0670a916,
+        0x0272a901, 0x0672a916, 0x0275a901, 0x0675a916, 0x063aa900, 0x0642a900,
+        0x0643a900, 0x0644a900, 0x0645a900, 0x0646a900, 0x0647a900, 0x0648a900,
+        0x0649a900, 0x064aa900, 0x064ba900, 0x064ca900, 0x064da900, 0x064ea900,
+        0x064fa900, 0x0650a900, 0x0651a900, 0x0652a900, 0x0653a900, 0x0654a900,
+        0x0655a900, 0x0656a900, 0x0657a900, 0x0659a900, 0x066aa900, 0x066ba900,
+        0x0671a900, 0x0676a900, 0x0677a900, 0x0678a900, 0x0679a900, 0x067aa900,
+        0x0100a946, 0x0100a947, 0x0100a949, 0x0500a94a
+    },
+    /* 132 */
+    {
+        0x0230aa02, 0x0230aa09, 0x0230aa17, 0x0630aa28, 0x0231aa02, 0x0231aa09,
+        0x0231aa17, 0x0631aa28, 0x0232aa02, 0x0232aa09, 0x0232aa17, 0x0632aa28,
+        0x0261aa02, 0x0261aa09, 0x0261aa17, 0x0661aa28, 0x0263aa02, 0x0263aa09,
+        0x0263aa17, 0x0663aa28, 0x0265aa02, 0x0265aa09, 0x0265aa17, 0x0665aa28,
+        0x0269aa02, 0x0269aa09, 0x0269aa17, 0x0669aa28, 0x026faa02, 0x026faa09,
+        0x026faa17, 0x066faa28, 0x0273aa02, 0x0273aa09, 0x0273aa17, 0x0673aa28,
+        0x0274aa02, 0x0274aa09, 0x0274aa17, 0x0674aa28, 0x0220aa01, 0x0620aa16,
+        0x0225aa01, 0x0625aa16, 0x022daa01, 0x062daa16, 0x022eaa01, 0x062eaa16,
+        0x022faa01, 0x062faa16, 0x0233aa01, 0x0633aa16, 0x0234aa01, 0x0634aa16,
+        0x0235aa01, 0x0635aa16, 0x0236aa01, 0x0636aa16, 0x0237aa01, 0x0637aa16,
+        0x0238aa01, 0x0638aa16, 0x0239aa01, 0x0639aa16, 0x023daa01, 0x063daa16,
+        0x0241aa01, 0x0641aa16, 0x025faa01, 0x065faa16, 0x0262aa01, 0x0662aa16,
+        0x0264aa01, 0x0664aa16, 0x0266aa01, 0x0666aa16, 0x0267aa01, 0x0667aa16,
+        0x0268aa01, 0x0668aa16, 0x026caa01, 0x066caa16, 0x026daa01, 0x066daa16,
+        0x026eaa01, 0x066eaa16, 0x0270aa01, 0x0670aa16, 0x0272aa01, 0x0672aa16,
+        0x0275aa01, 0x0675aa16, 0x063aaa00, 0x0642aa00, 0x0643aa00, 0x0644aa00,
+        0x0645aa00, 0x0646aa00, 0x0647aa00, 0x0648aa00, 0x0649aa00, 0x064aaa00,
+        0x064baa00, 0x064caa00, 0x064daa00, 0x064eaa00, 0x064faa00, 0x0650aa00,
+        0x0651aa00, 0x0652aa00, 0x0653aa00, 0x0654aa00, 0x0655aa00, 0x0656aa00,
+        0x0657aa00, 0x0659aa00, 0x066aaa00, 0x066baa00, 0x0671aa00, 0x0676aa00,
+        0x0677aa00, 0x0678aa00, 0x0679aa00, 0x067aaa00, 0x0100aa46, 0x0100aa47,
+        0x0100aa49, 0x0500aa4a, 0x0230ad02, 0x0230ad09, 0x0230ad17, 0x0630ad28,
+        0x0231ad02, 0x0231ad09, 0x0231ad17, 0x0631ad28, 0x0232ad02, 0x0232ad09,
+        0x0232ad17, 0x0632ad28, 0x0261ad02, 0x0261ad09, 0x0261ad17, 0x0661ad28,
+        0x0263ad02, 0x0263ad09, 0x0263ad17, 0x0663ad28, 0x0265ad02, 0x0265ad09,
+        0x0265ad17, 0x0665ad28, 0x0269ad02, 0x0269ad09, 0x0269ad17, 0x0669ad28,
+        0x026fad02, 0x026fad09, 0x026fad17, 0x066fad28, 0x0273ad02, 0x0273ad09,
+        0x0273ad17, 0x0673ad28, 0x0274ad02, 0x0274ad09, 0x0274ad17, 0x0674ad28,
+        0x0220ad01, 0x0620ad16, 0x0225ad01, 0x0625ad16, 0x022dad01, 0x062dad16,
+        0x022ead01, 0x062ead16, 0x022fad01, 0x062fad16, 0x0233ad01, 0x0633ad16,
+        0x0234ad01, 0x0634ad16, 0x0235ad01, 0x0635ad16, 0x0236ad01, 0x0636ad16,
+        0x0237ad01, 0x0637ad16, 0x0238ad01, 0x0638ad16, 0x0239ad01, 0x0639ad16,
+        0x023dad01, 0x063dad16, 0x0241ad01, 0x0641ad16, 0x025fad01, 0x065fad16,
+        0x0262ad01, 0x0662ad16, 0x0264ad01, 0x0664ad16, 0x0266ad01, 0x0666ad16,
+        0x0267ad01, 0x0667ad16, 0x0268ad01, 0x0668ad16, 0x026cad01, 0x066cad16,
+        0x026dad01, 0x066dad16, 0x026ead01, 0x066ead16, 0x0270ad01, 0x0670ad16,
+        0x0272ad01, 0x0672ad16, 0x0275ad01, 0x0675ad16, 0x063aad00, 0x0642ad00,
+        0x0643ad00, 0x0644ad00, 0x0645ad00, 0x0646ad00, 0x0647ad00, 0x0648ad00,
+        0x0649ad00, 0x064aad00, 0x064bad00, 0x064cad00, 0x064dad00, 0x064ead00,
+        0x064fad00, 0x0650ad00, 0x0651ad00, 0x0652ad00, 0x0653ad00, 0x0654ad00,
+        0x0655ad00, 0x0656ad00, 0x0657ad00, 0x0659ad00, 0x066aad00, 0x066bad00,
+        0x0671ad00, 0x0676ad00, 0x0677ad00, 0x0678ad00, 0x0679ad00, 0x067aad00,
+        0x0100ad46, 0x0100ad47, 0x0100ad49, 0x0500ad4a
+    },
+    /* 133 */
+    {
+        0x0100b203, 0x0100b206, 0x0100b20a, 0x0100b20f, 0x0100b218, 0x0100b21f,
+        0x0100b229, 0x0500b238, 0x0100b503, 0x0100b506, 0x0100b50a, 0x0100b50f,
+        0x0100b518, 0x0100b51f, 0x0100b529, 0x0500b538, 0x0100b903, 0x0100b906,
+        0x0100b90a, 0x0100b90f, 0x0100b918, 0x0100b91f, 0x0100b929, 0x0500b938,
+        0x0100ba03, 0x0100ba06, 0x0100ba0a, 0x0100ba0f, 0x0100ba18, 0x0100ba1f,
+        0x0100ba29, 0x0500ba38, 0x0100bb03, 0x0100bb06, 0x0100bb0a, 0x0100bb0f,
+        0x0100bb18, 0x0100bb1f, 0x0100bb29, 0x0500bb38, 0x0100bd03, 0x0100bd06,
+        0x0100bd0a, 0x0100bd0f, 0x0100bd18, 0x0100bd1f, 0x0100bd29, 0x0500bd38,
+        0x0100be03, 0x0100be06, 0x0100be0a, 0x0100be0f, 0x0100be18, 0x0100be1f,
+        0x0100be29, 0x0500be38, 0x0100c403, 0x0100c406, 0x0100c40a, 0x0100c40f,
+        0x0100c418, 0x0100c41f, 0x0100c429, 0x0500c438, 0x0100c603, 0x0100c606,
+        0x0100c60a, 0x0100c60f, 0x0100c618, 0x0100c61f, 0x0100c629, 0x0500c638,
+        0x0100e403, 0x0100e406, 0x0100e40a, 0x0100e40f, 0x0100e418, 0x0100e41f,
+        0x0100e429, 0x0500e438, 0x0100e803, 0x0100e806, 0x0100e80a, 0x0100e80f,
+        0x0100e818, 0x0100e81f, 0x0100e829, 0x0500e838, 0x0100e903, 0x0100e906,
+        0x0100e90a, 0x0100e90f, 0x0100e918, 0x0100e91f, 0x0100e929, 0x0500e938,
+        0x01000102, 0x01000109, 0x01000117, 0x05000128, 0x01008702, 0x01008709,
+        0x01008717, 0x05008728, 0x01008902, 0x01008909, 0x01008917, 0x05008928,
+        0x01008a02, 0x01008a09, 0x01008a17, 0x05008a28, 0x01008b02, 0x01008b09,
+        0x01008b17, 0x05008b28, 0x01008c02, 0x01008c09, 0x01008c17, 0x05008c28,
+        0x01008d02, 0x01008d09, 0x01008d17, 0x05008d28, 0x01008f02, 0x01008f09,
+        0x01008f17, 0x05008f28, 0x01009302, 0x01009309, 0x01009317, 0x05009328,
+        0x01009502, 0x01009509, 0x01009517, 0x05009528, 0x01009602, 0x01009609,
+        0x01009617, 0x05009628, 0x01009702, 0x01009709, 0x01009717, 0x05009728,
+        0x01009802, 0x01009809, 0x01009817, 0x05009828, 0x01009b02, 0x01009b09,
+        0x01009b17, 0x05009b28, 0x01009d02, 0x01009d09, 0x01009d17, 0x05009d28,
+        0x01009e02, 0x01009e09, 0x01009e17, 0x05009e28, 0x0100a502, 0x0100a509,
+        0x0100a517, 0x0500a528, 0x0100a602, 0x0100a609, 0x0100a617, 0x0500a628,
+        0x0100a802, 0x0100a809, 0x0100a817, 0x0500a828, 0x0100ae02, 0x0100ae09,
+        0x0100ae17, 0x0500ae28, 0x0100af02, 0x0100af09, 0x0100af17, 0x0500af28,
+        0x0100b402, 0x0100b409, 0x0100b417, 0x0500b428, 0x0100b602, 0x0100b609,
+        0x0100b617, 0x0500b628, 0x0100b702, 0x0100b709, 0x0100b717, 0x0500b728,
+        0x0100bc02, 0x0100bc09, 0x0100bc17, 0x0500bc28, 0x0100bf02, 0x0100bf09,
+        0x0100bf17, 0x0500bf28, 0x0100c502, 0x0100c509, 0x0100c517, 0x0500c528,
+        0x0100e702, 0x0100e709, 0x0100e717, 0x0500e728, 0x0100ef02, 0x0100ef09,
+        0x0100ef17, 0x0500ef28, 0x01000901, 0x05000916, 0x01008e01, 0x05008e16,
+        0x01009001, 0x05009016, 0x01009101, 0x05009116, 0x01009401, 0x05009416,
+        0x01009f01, 0x05009f16, 0x0100ab01, 0x0500ab16, 0x0100ce01, 0x0500ce16,
+        0x0100d701, 0x0500d716, 0x0100e101, 0x0500e116, 0x0100ec01, 0x0500ec16,
+        0x0100ed01, 0x0500ed16, 0x0500c700, 0x0500cf00, 0x0500ea00, 0x0500eb00,
+        0x000000c2, 0x000000c3, 0x000000c5, 0x000000c6, 0x000000c9, 0x000000ca,
+        0x000000cc, 0x000000cd, 0x000000d2, 0x000000d5, 0x000000d9, 0x000000dc,
+        0x000000e1, 0x000000e7, 0x000000ef, 0x040000f6
+    },
+    /* 134 */
+    {
+        0x0100b204, 0x0100b205, 0x0100b207, 0x0100b208, 0x0100b20b, 0x0100b20c,
+        0x0100b210, 0x0100b213, 0x0100b219, 0x0100b21c, 0x0100b220, 0x0100b223,
+        0x0100b22a, 0x0100b231, 0x0100b239, 0x0500b240, 0x0100b504, 0x0100b505,
+        0x0100b507, 0x0100b508, 0x0100b50b, 0x0100b50c, 0x0100b510, 0x0100b513,
+        0x0100b519, 0x0100b51c, 0x0100b520, 0x0100b523, 0x0100b52a, 0x0100b531,
+        0x0100b539, 0x0500b540, 0x0100b904, 0x0100b905, 0x0100b907, 0x0100b908,
+        0x0100b90b, 0x0100b90c, 0x0100b910, 0x0100b913, 0x0100b919, 0x0100b91c,
+        0x0100b920, 0x0100b923, 0x0100b92a, 0x0100b931, 0x0100b939, 0x0500b940,
+        0x0100ba04, 0x0100ba05, 0x0100ba07, 0x0100ba08, 0x0100ba0b, 0x0100ba0c,
+        0x0100ba10, 0x0100ba13, 0x0100ba19, 0x0100ba1c, 0x0100ba20, 0x0100ba23,
+        0x0100ba2a, 0x0100ba31, 0x0100ba39, 0x0500ba40, 0x0100bb04, 0x0100bb05,
+        0x0100bb07, 0x0100bb08, 0x0100bb0b, 0x0100bb0c, 0x0100bb10, 0x0100bb13,
+        0x0100bb19, 0x0100bb1c, 0x0100bb20, 0x0100bb23, 0x0100bb2a, 0x0100bb31,
+        0x0100bb39, 0x0500bb40, 0x0100bd04, 0x0100bd05, 0x0100bd07, 0x0100bd08,
+        0x0100bd0b, 0x0100bd0c, 0x0100bd10, 0x0100bd13, 0x0100bd19, 0x0100bd1c,
+        0x0100bd20, 0x0100bd23, 0x0100bd2a, 0x0100bd31, 0x0100bd39, 0x0500bd40,
+        0x0100be04, 0x0100be05, 0x0100be07, 0x0100be08, 0x0100be0b, 0x0100be0c,
+        0x0100be10, 0x0100be13, 0x0100be19, 0x0100be1c, 0x0100be20, 0x0100be23,
+        0x0100be2a, 0x0100be31, 0x0100be39, 0x0500be40, 0x0100c404, 0x0100c405,
+        0x0100c407, 0x0100c408, 0x0100c40b, 0x0100c40c, 0x0100c410, 0x0100c413,
+        0x0100c419, 0x0100c41c, 0x0100c420, 0x0100c423, 0x0100c42a, 0x0100c431,
+        0x0100c439, 0x0500c440, 0x0100c604, 0x0100c605, 0x0100c607, 0x0100c608,
+        0x0100c60b, 0x0100c60c, 0x0100c610, 0x0100c613, 0x0100c619, 0x0100c61c,
+        0x0100c620, 0x0100c623, 0x0100c62a, 0x0100c631, 0x0100c639, 0x0500c640,
+        0x0100e404, 0x0100e405, 0x0100e407, 0x0100e408, 0x0100e40b, 0x0100e40c,
+        0x0100e410, 0x0100e413, 0x0100e419, 0x0100e41c, 0x0100e420, 0x0100e423,
+        0x0100e42a, 0x0100e431, 0x0100e439, 0x0500e440, 0x0100e804, 0x0100e805,
+        0x0100e807, 0x0100e808, 0x0100e80b, 0x0100e80c, 0x0100e810, 0x0100e813,
+        0x0100e819, 0x0100e81c, 0x0100e820, 0x0100e823, 0x0100e82a, 0x0100e831,
+        0x0100e839, 0x0500e840, 0x0100e904, 0x0100e905, 0x0100e907, 0x0100e908,
+        0x0100e90b, 0x0100e90c, 0x0100e910, 0x0100e913, 0x0100e919, 0x0100e91c,
+        0x0100e920, 0x0100e923, 0x0100e92a, 0x0100e931, 0x0100e939, 0x0500e940,
+        0x01000103, 0x01000106, 0x0100010a, 0x0100010f, 0x01000118, 0x0100011f,
+        0x01000129, 0x05000138, 0x01008703, 0x01008706, 0x0100870a, 0x0100870f,
+        0x01008718, 0x0100871f, 0x01008729, 0x05008738, 0x01008903, 0x01008906,
+        0x0100890a, 0x0100890f, 0x01008918, 0x0100891f, 0x01008929, 0x05008938,
+        0x01008a03, 0x01008a06, 0x01008a0a, 0x01008a0f, 0x01008a18, 0x01008a1f,
+        0x01008a29, 0x05008a38, 0x01008b03, 0x01008b06, 0x01008b0a, 0x01008b0f,
+        0x01008b18, 0x01008b1f, 0x01008b29, 0x05008b38, 0x01008c03, 0x01008c06,
+        0x01008c0a, 0x01008c0f, 0x01008c18, 0x01008c1f, 0x01008c29, 0x05008c38,
+        0x01008d03, 0x01008d06, 0x01008d0a, 0x01008d0f, 0x01008d18, 0x01008d1f,
+        0x01008d29, 0x05008d38, 0x01008f03, 0x01008f06, 0x01008f0a, 0x01008f0f,
+        0x01008f18, 0x01008f1f, 0x01008f29, 0x05008f38
+    },
+    /* 135 */
+    {
+        0x0630b200, 0x0631b200, 0x0632b200, 0x0661b200, 0x0663b200, 0x0665b200,
+        0x0669b200, 0x066fb200, 0x0673b200, 0x0674b200, 0x0100b20d, 0x0100b20e,
+        0x0100b211, 0x0100b212, 0x0100b214, 0x0100b215, 0x0100b21a, 0x0100b21b,
+        0x0100b21d, 0x0100b21e, 0x0100b221, 0x0100b222, 0x0100b224, 0x0100b225,
+        0x0100b22b, 0x0100b22e, 0x0100b232, 0x0100b235, 0x0100b23a, 0x0100b23d,
+        0x0100b241, 0x0500b244, 0x0630b500, 0x0631b500, 0x0632b500, 0x0661b500,
+        0x0663b500, 0x0665b500, 0x0669b500, 0x066fb500, 0x0673b500, 0x0674b500,
+        0x0100b50d, 0x0100b50e, 0x0100b511, 0x0100b512, 0x0100b514, 0x0100b515,
+        0x0100b51a, 0x0100b51b, 0x0100b51d, 0x0100b51e, 0x0100b521, 0x0100b522,
+        0x0100b524, 0x0100b525, 0x0100b52b, 0x0100b52e, 0x0100b532, 0x0100b535,
+        0x0100b53a, 0x0100b53d, 0x0100b541, 0x0500b544, 0x0630b900, 0x0631b900,
+        0x0632b900, 0x0661b900, 0x0663b900, 0x0665b900, 0x0669b900, 0x066fb900,
+        0x0673b900, 0x0674b900, 0x0100b90d, 0x0100b90e, 0x0100b911, 0x0100b912,
+        0x0100b914, 0x0100b915, 0x0100b91a, 0x0100b91b, 0x0100b91d, 0x0100b91e,
+        0x0100b921, 0x0100b922, 0x0100b924, 0x0100b925, 0x0100b92b, 0x0100b92e,
+        0x0100b932, 0x0100b935, 0x0100b93a, 0x0100b93d, 0x0100b941, 0x0500b944,
+        0x0630ba00, 0x0631ba00, 0x0632ba00, 0x0661ba00, 0x0663ba00, 0x0665ba00,
+        0x0669ba00, 0x066fba00, 0x0673ba00, 0x0674ba00, 0x0100ba0d, 0x0100ba0e,
+        0x0100ba11, 0x0100ba12, 0x0100ba14, 0x0100ba15, 0x0100ba1a, 0x0100ba1b,
+        0x0100ba1d, 0x0100ba1e, 0x0100ba21, 0x0100ba22, 0x0100ba24, 0x0100ba25,
+        0x0100ba2b, 0x0100ba2e, 0x0100ba32, 0x0100ba35, 0x0100ba3a, 0x0100ba3d,
+        0x0100ba41, 0x0500ba44, 0x0630bb00, 0x0631bb00, 0x0632bb00, 0x0661bb00,
+        0x0663bb00, 0x0665bb00, 0x0669bb00, 0x066fbb00, 0x0673bb00, 0x0674bb00,
+        0x0100bb0d, 0x0100bb0e, 0x0100bb11, 0x0100bb12, 0x0100bb14, 0x0100bb15,
+        0x0100bb1a, 0x0100bb1b, 0x0100bb1d, 0x0100bb1e, 0x0100bb21, 0x0100bb22,
+        0x0100bb24, 0x0100bb25, 0x0100bb2b, 0x0100bb2e, 0x0100bb32, 0x0100bb35,
+        0x0100bb3a, 0x0100bb3d, 0x0100bb41, 0x0500bb44, 0x0630bd00, 0x0631bd00,
+        0x0632bd00, 0x0661bd00, 0x0663bd00, 0x0665bd00, 0x0669bd00, 0x066fbd00,
+        0x0673bd00, 0x0674bd00, 0x0100bd0d, 0x0100bd0e, 0x0100bd11, 0x0100bd12,
+        0x0100bd14, 0x0100bd15, 0x0100bd1a, 0x0100bd1b, 0x0100bd1d, 0x0100bd1e,
+        0x0100bd21, 0x0100bd22, 0x0100bd24, 0x0100bd25, 0x0100bd2b, 0x0100bd2e,
+        0x0100bd32, 0x0100bd35, 0x0100bd3a, 0x0100bd3d, 0x0100bd41, 0x0500bd44,
+        0x0630be00, 0x0631be00, 0x0632be00, 0x0661be00, 0x0663be00, 0x0665be00,
+        0x0669be00, 0x066fbe00, 0x0673be00, 0x0674be00, 0x0100be0d, 0x0100be0e,
+        0x0100be11, 0x0100be12, 0x0100be14, 0x0100be15, 0x0100be1a, 0x0100be1b,
+        0x0100be1d, 0x0100be1e, 0x0100be21, 0x0100be22, 0x0100be24, 0x0100be25,
+        0x0100be2b, 0x0100be2e, 0x0100be32, 0x0100be35, 0x0100be3a, 0x0100be3d,
+        0x0100be41, 0x0500be44, 0x0630c400, 0x0631c400, 0x0632c400, 0x0661c400,
+        0x0663c400, 0x0665c400, 0x0669c400, 0x066fc400, 0x0673c400, 0x0674c400,
+        0x0100c40d, 0x0100c40e, 0x0100c411, 0x0100c412, 0x0100c414, 0x0100c415,
+        0x0100c41a, 0x0100c41b, 0x0100c41d, 0x0100c41e, 0x0100c421, 0x0100c422,
+        0x0100c424, 0x0100c425, 0x0100c42b, 0x0100c42e, 0x0100c432, 0x0100c435,
+        0x0100c43a, 0x0100c43d, 0x0100c441, 0x0500c444
+    },
+    /* 136 */
+    {
+        0x0230b201, 0x0630b216, 0x0231b201, 0x0631b216, 0x0232b201, 0x0632b216,
+        0x0261b201, 0x0661b216, 0x0263b201, 0x0663b216, 0x0265b201, 0x0665b216,
+        0x0269b201, 0x0669b216, 0x026fb201, 0x066fb216, 0x0273b201, 0x0673b216,
+        0x0274b201, 0x0674b216, 0x0620b200, 0x0625b200, 0x062db200, 0x062eb200,
+        0x062fb200, 0x0633b200, 0x0634b200, 0x0635b200, 0x0636b200, 0x0637b200,
+        0x0638b200, 0x0639b200, 0x063db200, 0x0641b200, 0x065fb200, 0x0662b200,
+        0x0664b200, 0x0666b200, 0x0667b200, 0x0668b200, 0x066cb200, 0x066db200,
+        0x066eb200, 0x0670b200, 0x0672b200, 0x0675b200, 0x0100b226, 0x0100b227,
+        0x0100b22c, 0x0100b22d, 0x0100b22f, 0x0100b230, 0x0100b233, 0x0100b234,
+        0x0100b236, 0x0100b237, 0x0100b23b, 0x0100b23c, 0x0100b23e, 0x0100b23f,
+        0x0100b242, 0x0100b243, 0x0100b245, 0x0500b248, 0x0230b501, 0x0630b516,
+        0x0231b501, 0x0631b516, 0x0232b501, 0x0632b516, 0x0261b501, 0x0661b516,
+        0x0263b501, 0x0663b516, 0x0265b501, 0x0665b516, 0x0269b501, 0x0669b516,
+        0x026fb501, 0x066fb516, 0x0273b501, 0x0673b516, 0x0274b501, 0x0674b516,
+        0x0620b500, 0x0625b500, 0x062db500, 0x062eb500, 0x062fb500, 0x0633b500,
+        0x0634b500, 0x0635b500, 0x0636b500, 0x0637b500, 0x0638b500, 0x0639b500,
+        0x063db500, 0x0641b500, 0x065fb500, 0x0662b500, 0x0664b500, 0x0666b500,
+        0x0667b500, 0x0668b500, 0x066cb500, 0x066db500, 0x066eb500, 0x0670b500,
+        0x0672b500, 0x0675b500, 0x0100b526, 0x0100b527, 0x0100b52c, 0x0100b52d,
+        0x0100b52f, 0x0100b530, 0x0100b533, 0x0100b534, 0x0100b536, 0x0100b537,
+        0x0100b53b, 0x0100b53c, 0x0100b53e, 0x0100b53f, 0x0100b542, 0x0100b543,
+        0x0100b545, 0x0500b548, 0x0230b901, 0x0630b916, 0x0231b901, 0x0631b916,
+        0x0232b901, 0x0632b916, 0x0261b901, 0x0661b916, 0x0263b901, 0x0663b916,
+        0x0265b901, 0x0665b916, 0x0269b901, 0x0669b916, 0x026fb901, 0x066fb916,
+        0x0273b901, 0x0673b916, 0x0274b901, 0x0674b916, 0x0620b900, 0x0625b900,
+        0x062db900, 0x062eb900, 0x062fb900, 0x0633b900, 0x0634b900, 0x0635b900,
+        0x0636b900, 0x0637b900, 0x0638b900, 0x0639b900, 0x063db900, 0x0641b900,
+        0x065fb900, 0x0662b900, 0x0664b900, 0x0666b900, 0x0667b900, 0x0668b900,
+        0x066cb900, 0x066db900, 0x066eb900, 0x0670b900, 0x0672b900, 0x0675b900,
+        0x0100b926, 0x0100b927, 0x0100b92c, 0x0100b92d, 0x0100b92f, 0x0100b930,
+        0x0100b933, 0x0100b934, 0x0100b936, 0x0100b937, 0x0100b93b, 0x0100b93c,
+        0x0100b93e, 0x0100b93f, 0x0100b942, 0x0100b943, 0x0100b945, 0x0500b948,
+        0x0230ba01, 0x0630ba16, 0x0231ba01, 0x0631ba16, 0x0232ba01, 0x0632ba16,
+        0x0261ba01, 0x0661ba16, 0x0263ba01, 0x0663ba16, 0x0265ba01, 0x0665ba16,
+        0x0269ba01, 0x0669ba16, 0x026fba01, 0x066fba16, 0x0273ba01, 0x0673ba16,
+        0x0274ba01, 0x0674ba16, 0x0620ba00, 0x0625ba00, 0x062dba00, 0x062eba00,
+        0x062fba00, 0x0633ba00, 0x0634ba00, 0x0635ba00, 0x0636ba00, 0x0637ba00,
+        0x0638ba00, 0x0639ba00, 0x063dba00, 0x0641ba00, 0x065fba00, 0x0662ba00,
+        0x0664ba00, 0x0666ba00, 0x0667ba00, 0x0668ba00, 0x066cba00, 0x066dba00,
+        0x066eba00, 0x0670ba00, 0x0672ba00, 0x0675ba00, 0x0100ba26, 0x0100ba27,
+        0x0100ba2c, 0x0100ba2d, 0x0100ba2f, 0x0100ba30, 0x0100ba33, 0x0100ba34,
+        0x0100ba36, 0x0100ba37, 0x0100ba3b, 0x0100ba3c, 0x0100ba3e, 0x0100ba3f,
+        0x0100ba42, 0x0100ba43, 0x0100ba45, 0x0500ba48
+    },
+    /* 137 */
+    {
+        0x0230b202, 0x0230b209, 0x0230b217, 0x0630b228, 0x0231b202, 0x0231b209,
+        0x0231b217, 0x0631b228, 0x0232b202, 0x0232b209, 0x0232b217, 0x0632b228,
+        0x0261b202, 0x0261b209, 0x0261b217, 0x0661b228, 0x0263b202, 0x0263b209,
+        0x0263b217, 0x0663b228, 0x0265b202, 0x0265b209, 0x0265b217, 0x0665b228,
+        0x0269b202, 0x0269b209, 0x0269b217, 0x0669b228, 0x026fb202, 0x026fb209,
+        0x026fb217, 0x066fb228, 0x0273b202, 0x0273b209, 0x0273b217, 0x0673b228,
+        0x0274b202, 0x0274b209, 0x0274b217, 0x0674b228, 0x0220b201, 0x0620b216,
+        0x0225b201, 0x0625b216, 0x022db201, 0x062db216, 0x022eb201, 0x062eb216,
+        0x022fb201, 0x062fb216, 0x0233b201, 0x0633b216, 0x0234b201, 0x0634b216,
+        0x0235b201, 0x0635b216, 0x0236b201, 0x0636b216, 0x0237b201, 0x0637b216,
+        0x0238b201, 0x0638b216, 0x0239b201, 0x0639b216, 0x023db201, 0x063db216,
+        0x0241b201, 0x0641b216, 0x025fb201, 0x065fb216, 0x0262b201, 0x0662b216,
+        0x0264b201, 0x0664b216, 0x0266b201, 0x0666b216, 0x0267b201, 0x0667b216,
+        0x0268b201, 0x0668b216, 0x026cb201, 0x066cb216, 0x026db201, 0x066db216,
+        0x026eb201, 0x066eb216, 0x0270b201, 0x0670b216, 0x0272b201, 0x0672b216,
+        0x0275b201, 0x0675b216, 0x063ab200, 0x0642b200, 0x0643b200, 0x0644b200,
+        0x0645b200, 0x0646b200, 0x0647b200, 0x0648b200, 0x0649b200, 0x064ab200,
+        0x064bb200, 0x064cb200, 0x064db200, 0x064eb200, 0x064fb200, 0x0650b200,
+        0x0651b200, 0x0652b200, 0x0653b200, 0x0654b200, 0x0655b200, 0x0656b200,
+        0x0657b200, 0x0659b200, 0x066ab200, 0x066bb200, 0x0671b200, 0x0676b200,
+        0x0677b200, 0x0678b200, 0x0679b200, 0x067ab200, 0x0100b246, 0x0100b247,
+        0x0100b249, 0x0500b24a, 0x0230b502, 0x0230b509, 0x0230b517, 0x0630b528,
+        0x0231b502, 0x0231b509, 0x0231b517, 0x0631b528, 0x0232b502, 0x0232b509,
+        0x0232b517, 0x0632b528, 0x0261b502, 0x0261b509, 0x0261b517, 0x0661b528,
+        0x0263b502, 0x0263b509, 0x0263b517, 0x0663b528, 0x0265b502, 0x0265b509,
+        0x0265b517, 0x0665b528, 0x0269b502, 0x0269b509, 0x0269b517, 0x0669b528,
+        0x026fb502, 0x026fb509, 0x026fb517, 0x066fb528, 0x0273b502, 0x0273b509,
+        0x0273b517, 0x0673b528, 0x0274b502, 0x0274b509, 0x0274b517, 0x0674b528,
+        0x0220b501, 0x0620b516, 0x0225b501, 0x0625b516, 0x022db501, 0x062db516,
+        0x022eb501, 0x062eb516, 0x022fb501, 0x062fb516, 0x0233b501, 0x0633b516,
+        0x0234b501, 0x0634b516, 0x0235b501, 0x0635b516, 0x0236b501, 0x0636b516,
+        0x0237b501, 0x0637b516, 0x0238b501, 0x0638b516, 0x0239b501, 0x0639b516,
+        0x023db501, 0x063db516, 0x0241b501, 0x0641b516, 0x025fb501, 0x065fb516,
+        0x0262b501, 0x0662b516, 0x0264b501, 0x0664b516, 0x0266b501, 0x0666b516,
+        0x0267b501, 0x0667b516, 0x0268b501, 0x0668b516, 0x026cb501, 0x066cb516,
+        0x026db501, 0x066db516, 0x026eb501, 0x066eb516, 0x0270b501, 0x0670b516,
+        0x0272b501, 0x0672b516, 0x0275b501, 0x0675b516, 0x063ab500, 0x0642b500,
+        0x0643b500, 0x0644b500, 0x0645b500, 0x0646b500, 0x0647b500, 0x0648b500,
+        0x0649b500, 0x064ab500, 0x064bb500, 0x064cb500, 0x064db500, 0x064eb500,
+        0x064fb500, 0x0650b500, 0x0651b500, 0x0652b500, 0x0653b500, 0x0654b500,
+        0x0655b500, 0x0656b500, 0x0657b500, 0x0659b500, 0x066ab500, 0x066bb500,
+        0x0671b500, 0x0676b500, 0x0677b500, 0x0678b500, 0x0679b500, 0x067ab500,
+        0x0100b546, 0x0100b547, 0x0100b549, 0x0500b54a
+    },
+    /* 138 */
+    {
+        0x0230b902, 0x0230b909, 0x0230b917, 0x0630b928, 0x0231b902, 0x0231b909,
+        0x0231b917, 0x0631b928, 0x0232b902, 0x0232b909, 0x0232b917, 0x0632b928,
+        0x0261b902, 0x0261b909, 0x0261b917, 0x0661b928, 0x0263b902, 0x0263b909,
+        0x0263b917, 0x0663b928, 0x0265b902, 0x0265b909, 0x0265b917, 0x0665b928,
+        0x0269b902, 0x0269b909, 0x0269b917, 0x0669b928, 0x026fb902, 0x026fb909,
+        0x026fb917, 0x066fb928, 0x0273b902, 0x0273b909, 0x0273b917, 0x0673b928,
+        0x0274b902, 0x0274b909, 0x0274b917, 0x0674b928, 0x0220b901, 0x0620b916,
+        0x0225b901, 0x0625b916, 0x022db901, 0x062db916, 0x022eb901, 0x062eb916,
+        0x022fb901, 0x062fb916, 0x0233b901, 0x0633b916, 0x0234b901, 0x0634b916,
+        0x0235b901, 0x0635b916, 0x0236b901, 0x0636b916, 0x0237b901, 0x0637b916,
+        0x0238b901, 0x0638b916, 0x0239b901, 0x0639b916, 0x023db901, 0x063db916,
+        0x0241b901, 0x0641b916, 0x025fb901, 0x065fb916, 0x0262b901, 0x0662b916,
+        0x0264b901, 0x0664b916, 0x0266b901, 0x0666b916, 0x0267b901, 0x0667b916,
+        0x0268b901, 0x0668b916, 0x026cb901, 0x066cb916, 0x026db901, 0x066db916,
+        0x026eb901, 0x066eb916, 0x0270b901, 0x0670b916, 0x0272b901, 0x0672b916,
+        0x0275b901, 0x0675b916, 0x063ab900, 0x0642b900, 0x0643b900, 0x0644b900,
+        0x0645b900, 0x0646b900, 0x0647b900, 0x0648b900, 0x0649b900, 0x064ab900,
+        0x064bb900, 0x064cb900, 0x064db900, 0x064eb900, 0x064fb900, 0x0650b900,
+        0x0651b900, 0x0652b900, 0x0653b900, 0x0654b900, 0x0655b900, 0x0656b900,
+        0x0657b900, 0x0659b900, 0x066ab900, 0x066bb900, 0x0671b900, 0x0676b900,
+        0x0677b900, 0x0678b900, 0x0679b900, 0x067ab900, 0x0100b946, 0x0100b947,
+        0x0100b949, 0x0500b94a, 0x0230ba02, 0x0230ba09, 0x0230ba17, 0x0630ba28,
+        0x0231ba02, 0x0231ba09, 0x0231ba17, 0x0631ba28, 0x0232ba02, 0x0232ba09,
+        0x0232ba17, 0x0632ba28, 0x0261ba02, 0x0261ba09, 0x0261ba17, 0x0661ba28,
+        0x0263ba02, 0x0263ba09, 0x0263ba17, 0x0663ba28, 0x0265ba02, 0x0265ba09,
+        0x0265ba17, 0x0665ba28, 0x0269ba02, 0x0269ba09, 0x0269ba17, 0x0669ba28,
+        0x026fba02, 0x026fba09, 0x026fba17, 0x066fba28, 0x0273ba02, 0x0273ba09,
+        0x0273ba17, 0x0673ba28, 0x0274ba02, 0x0274ba09, 0x0274ba17, 0x0674ba28,
+        0x0220ba01, 0x0620ba16, 0x0225ba01, 0x0625ba16, 0x022dba01, 0x062dba16,
+        0x022eba01, 0x062eba16, 0x022fba01, 0x062fba16, 0x0233ba01, 0x0633ba16,
+        0x0234ba01, 0x0634ba16, 0x0235ba01, 0x0635ba16, 0x0236ba01, 0x0636ba16,
+        0x0237ba01, 0x0637ba16, 0x0238ba01, 0x0638ba16, 0x0239ba01, 0x0639ba16,
+        0x023dba01, 0x063dba16, 0x0241ba01, 0x0641ba16, 0x025fba01, 0x065fba16,
+        0x0262ba01, 0x0662ba16, 0x0264ba01, 0x0664ba16, 0x0266ba01, 0x0666ba16,
+        0x0267ba01, 0x0667ba16, 0x0268ba01, 0x0668ba16, 0x026cba01, 0x066cba16,
+        0x026dba01, 0x066dba16, 0x026eba01, 0x066eba16, 0x0270ba01, 0x0670ba16,
+        0x0272ba01, 0x0672ba16, 0x0275ba01, 0x0675ba16, 0x063aba00, 0x0642ba00,
+        0x0643ba00, 0x0644ba00, 0x0645ba00, 0x0646ba00, 0x0647ba00, 0x0648ba00,
+        0x0649ba00, 0x064aba00, 0x064bba00, 0x064cba00, 0x064dba00, 0x064eba00,
+        0x064fba00, 0x0650ba00, 0x0651ba00, 0x0652ba00, 0x0653ba00, 0x0654ba00,
+        0x0655ba00, 0x0656ba00, 0x0657ba00, 0x0659ba00, 0x066aba00, 0x066bba00,
+        0x0671ba00, 0x0676ba00, 0x0677ba00, 0x0678ba00, 0x0679ba00, 0x067aba00,
+        0x0100ba46, 0x0100ba47, 0x0100ba49, 0x0500ba4a
+    },
+    /* 139 */
+    {
+        0x0230bb01, 0x0630bb16, 0x0231bb01, 0x0631bb16, 0x0232bb01, 0x0632bb16,
+        0x0261bb01, 0x0661bb16, 0x0263bb01, 0x0663bb16, 0x0265bb01, 0x0665bb16,
+        0x0269bb01, 0x0669bb16, 0x026fbb01, 0x066fbb16, 0x0273bb01, 0x0673bb16,
+        0x0274bb01, 0x0674bb16, 0x0620bb00, 0x0625bb00, 0x062dbb00, 0x062ebb00,
+        0x062fbb00, 0x0633bb00, 0x0634bb00, 0x0635bb00, 0x0636bb00, 0x0637bb00,
+        0x0638bb00, 0x0639bb00, 0x063dbb00, 0x0641bb00, 0x065fbb00, 0x0662bb00,
+        0x0664bb00, 0x0666bb00, 0x0667bb00, 0x0668bb00, 0x066cbb00, 0x066dbb00,
+        0x066ebb00, 0x0670bb00, 0x0672bb00, 0x0675bb00, 0x0100bb26, 0x0100bb27,
+        0x0100bb2c, 0x0100bb2d, 0x0100bb2f, 0x0100bb30, 0x0100bb33, 0x0100bb34,
+        0x0100bb36, 0x0100bb37, 0x0100bb3b, 0x0100bb3c, 0x0100bb3e, 0x0100bb3f,
+        0x0100bb42, 0x0100bb43, 0x0100bb45, 0x0500bb48, 0x0230bd01, 0x0630bd16,
+        0x0231bd01, 0x0631bd16, 0x0232bd01, 0x0632bd16, 0x0261bd01, 0x0661bd16,
+        0x0263bd01, 0x0663bd16, 0x0265bd01, 0x0665bd16, 0x0269bd01, 0x0669bd16,
+        0x026fbd01, 0x066fbd16, 0x0273bd01, 0x0673bd16, 0x0274bd01, 0x0674bd16,
+        0x0620bd00, 0x0625bd00, 0x062dbd00, 0x062ebd00, 0x062fbd00, 0x0633bd00,
+        0x0634bd00, 0x0635bd00, 0x0636bd00, 0x0637bd00, 0x0638bd00, 0x0639bd00,
+        0x063dbd00, 0x0641bd00, 0x065fbd00, 0x0662bd00, 0x0664bd00, 0x0666bd00,
+        0x0667bd00, 0x0668bd00, 0x066cbd00, 0x066dbd00, 0x066ebd00, 0x0670bd00,
+        0x0672bd00, 0x0675bd00, 0x0100bd26, 0x0100bd27, 0x0100bd2c, 0x0100bd2d,
+        0x0100bd2f, 0x0100bd30, 0x0100bd33, 0x0100bd34, 0x0100bd36, 0x0100bd37,
+        0x0100bd3b, 0x0100bd3c, 0x0100bd3e, 0x0100bd3f, 0x0100bd42, 0x0100bd43,
+        0x0100bd45, 0x0500bd48, 0x0230be01, 0x0630be16, 0x0231be01, 0x0631be16,
+        0x0232be01, 0x0632be16, 0x0261be01, 0x0661be16, 0x0263be01, 0x0663be16,
+        0x0265be01, 0x0665be16, 0x0269be01, 0x0669be16, 0x026fbe01, 0x066fbe16,
+        0x0273be01, 0x0673be16, 0x0274be01, 0x0674be16, 0x0620be00, 0x0625be00,
+        0x062dbe00, 0x062ebe00, 0x062fbe00, 0x0633be00, 0x0634be00, 0x0635be00,
+        0x0636be00, 0x0637be00, 0x0638be00, 0x0639be00, 0x063dbe00, 0x0641be00,
+        0x065fbe00, 0x0662be00, 0x0664be00, 0x0666be00, 0x0667be00, 0x0668be00,
+        0x066cbe00, 0x066dbe00, 0x066ebe00, 0x0670be00, 0x0672be00, 0x0675be00,
+        0x0100be26, 0x0100be27, 0x0100be2c, 0x0100be2d, 0x0100be2f, 0x0100be30,
+        0x0100be33, 0x0100be34, 0x0100be36, 0x0100be37, 0x0100be3b, 0x0100be3c,
+        0x0100be3e, 0x0100be3f, 0x0100be42, 0x0100be43, 0x0100be45, 0x0500be48,
+        0x0230c401, 0x0630c416, 0x0231c401, 0x0631c416, 0x0232c401, 0x0632c416,
+        0x0261c401, 0x0661c416, 0x0263c401, 0x0663c416, 0x0265c401, 0x0665c416,
+        0x0269c401, 0x0669c416, 0x026fc401, 0x066fc416, 0x0273c401, 0x0673c416,
+        0x0274c401, 0x0674c416, 0x0620c400, 0x0625c400, 0x062dc400, 0x062ec400,
+        0x062fc400, 0x0633c400, 0x0634c400, 0x0635c400, 0x0636c400, 0x0637c400,
+        0x0638c400, 0x0639c400, 0x063dc400, 0x0641c400, 0x065fc400, 0x0662c400,
+        0x0664c400, 0x0666c400, 0x0667c400, 0x0668c400, 0x066cc400, 0x066dc400,
+        0x066ec400, 0x0670c400, 0x0672c400, 0x0675c400, 0x0100c426, 0x0100c427,
+        0x0100c42c, 0x0100c42d, 0x0100c42f, 0x0100c430, 0x0100c433, 0x0100c434,
+        0x0100c436, 0x0100c437, 0x0100c43b, 0x0100c43c, 0x0100c43e, 0x0100c43f,
+        0x0100c442, 0x0100c443, 0x0100c445, 0x0500c448
+    },
+    /* 140 */
+    {
+        0x0230bb02, 0x0230bb09, 0x0230bb17, 0x0630bb28, 0x0231bb02, 0x0231bb09,
+        0x0231bb17, 0x0631bb28, 0x0232bb02, 0x0232bb09, 0x0232bb17, 0x0632bb28,
+        0x0261bb02, 0x0261bb09, 0x0261bb17, 0x0661bb28, 0x0263bb02, 0x0263bb09,
+        0x0263bb17, 0x0663bb28, 0x0265bb02, 0x0265bb09, 0x0265bb17, 0x0665bb28,
+        0x0269bb02, 0x0269bb09, 0x0269bb17, 0x0669bb28, 0x026fbb02, 0x026fbb09,
+        0x026fbb17, 0x066fbb28, 0x0273bb02, 0x0273bb09, 0x0273bb17, 0x0673bb28,
+        0x0274bb02, 0x0274bb09, 0x0274bb17, 0x0674bb28, 0x0220bb01, 0x0620bb16,
+        0x0225bb01, 0x0625bb16, 0x022dbb01, 0x062dbb16, 0x022ebb01, 0x062ebb16,
+        0x022fbb01, 0x062fbb16, 0x0233bb01, 0x0633bb16, 0x0234bb01, 0x0634bb16,
+        0x0235bb01, 0x0635bb16, 0x0236bb01, 0x0636bb16, 0x0237bb01, 0x0637bb16,
+        0x0238bb01, 0x0638bb16, 0x0239bb01, 0x0639bb16, 0x023dbb01, 0x063dbb16,
+        0x0241bb01, 0x0641bb16, 0x025fbb01, 0x065fbb16, 0x0262bb01, 0x0662bb16,
+        0x0264bb01, 0x0664bb16, 0x0266bb01, 0x0666bb16, 0x0267bb01, 0x0667bb16,
+        0x0268bb01, 0x0668bb16, 0x026cbb01, 0x066cbb16, 0x026dbb01, 0x066dbb16,
+        0x026ebb01, 0x066ebb16, 0x0270bb01, 0x0670bb16, 0x0272bb01, 0x0672bb16,
+        0x0275bb01, 0x0675bb16, 0x063abb00, 0x0642bb00, 0x0643bb00, 0x0644bb00,
+        0x0645bb00, 0x0646bb00, 0x0647bb00, 0x0648bb00, 0x0649bb00, 0x064abb00,
+        0x064bbb00, 0x064cbb00, 0x064dbb00, 0x064ebb00, 0x064fbb00, 0x0650bb00,
+        0x0651bb00, 0x0652bb00, 0x0653bb00, 0x0654bb00, 0x0655bb00, 0x0656bb00,
+        0x0657bb00, 0x0659bb00, 0x066abb00, 0x066bbb00, 0x0671bb00, 0x0676bb00,
+        0x0677bb00, 0x0678bb00, 0x0679bb00, 0x067abb00, 0x0100bb46, 0x0100bb47,
+        0x0100bb49, 0x0500bb4a, 0x0230bd02, 0x0230bd09, 0x0230bd17, 0x0630bd28,
+        0x0231bd02, 0x0231bd09, 0x0231bd17, 0x0631bd28, 0x0232bd02, 0x0232bd09,
+        0x0232bd17, 0x0632bd28, 0x0261bd02, 0x0261bd09, 0x0261bd17, 0x0661bd28,
+        0x0263bd02, 0x0263bd09, 0x0263bd17, 0x0663bd28, 0x0265bd02, 0x0265bd09,
+        0x0265bd17, 0x0665bd28, 0x0269bd02, 0x0269bd09, 0x0269bd17, 0x0669bd28,
+        0x026fbd02, 0x026fbd09, 0x026fbd17, 0x066fbd28, 0x0273bd02, 0x0273bd09,
+        0x0273bd17, 0x0673bd28, 0x0274bd02, 0x0274bd09, 0x0274bd17, 0x0674bd28,
+        0x0220bd01, 0x0620bd16, 0x0225bd01, 0x0625bd16, 0x022dbd01, 0x062dbd16,
+        0x022ebd01, 0x062ebd16, 0x022fbd01, 0x062fbd16, 0x0233bd01, 0x0633bd16,
+        0x0234bd01, 0x0634bd16, 0x0235bd01, 0x0635bd16, 0x0236bd01, 0x0636bd16,
+        0x0237bd01, 0x0637bd16, 0x0238bd01, 0x0638bd16, 0x0239bd01, 0x0639bd16,
+        0x023dbd01, 0x063dbd16, 0x0241bd01, 0x0641bd16, 0x025fbd01, 0x065fbd16,
+        0x0262bd01, 0x0662bd16, 0x0264bd01, 0x0664bd16, 0x0266bd01, 0x0666bd16,
+        0x0267bd01, 0x0667bd16, 0x0268bd01, 0x0668bd16, 0x026cbd01, 0x066cbd16,
+        0x026dbd01, 0x066dbd16, 0x026ebd01, 0x066ebd16, 0x0270bd01, 0x0670bd16,
+        0x0272bd01, 0x0672bd16, 0x0275bd01, 0x0675bd16, 0x063abd00, 0x0642bd00,
+        0x0643bd00, 0x0644bd00, 0x0645bd00, 0x0646bd00, 0x0647bd00, 0x0648bd00,
+        0x0649bd00, 0x064abd00, 0x064bbd00, 0x064cbd00, 0x064dbd00, 0x064ebd00,
+        0x064fbd00, 0x0650bd00, 0x0651bd00, 0x0652bd00, 0x0653bd00, 0x0654bd00,
+        0x0655bd00, 0x0656bd00, 0x0657bd00, 0x0659bd00, 0x066abd00, 0x066bbd00,
+        0x0671bd00, 0x0676bd00, 0x0677bd00, 0x0678bd00, 0x0679bd00, 0x067abd00,
+        0x0100bd46, 0x0100bd47, 0x0100bd49, 0x0500bd4a
+    },
+    /* 141 */
+    {
+        0x0230be02, 0x0230be09, 0x0230be17, 0x0630be28, 0x0231be02, 0x0231be09,
+        0x0231be17, 0x0631be28, 0x0232be02, 0x0232be09, 0x0232be17, 0x0632be28,
+        0x0261be02, 0x0261be09, 0x0261be17, 0x0661be28, 0x0263be02, 0x0263be09,
+        0x0263be17, 0x0663be28, 0x0265be02, 0x0265be09, 0x0265be17, 0x0665be28,
+        0x0269be02, 0x0269be09, 0x0269be17, 0x0669be28, 0x026fbe02, 0x026fbe09,
+        0x026fbe17, 0x066fbe28, 0x0273be02, 0x0273be09, 0x0273be17, 0x0673be28,
+        0x0274be02, 0x0274be09, 0x0274be17, 0x0674be28, 0x0220be01, 0x0620be16,
+        0x0225be01, 0x0625be16, 0x022dbe01, 0x062dbe16, 0x022ebe01, 0x062ebe16,
+        0x022fbe01, 0x062fbe16, 0x0233be01, 0x0633be16, 0x0234be01, 0x0634be16,
+        0x0235be01, 0x0635be16, 0x0236be01, 0x0636be16, 0x0237be01, 0x0637be16,
+        0x0238be01, 0x0638be16, 0x0239be01, 0x0639be16, 0x023dbe01, 0x063dbe16,
+        0x0241be01, 0x0641be16, 0x025fbe01, 0x065fbe16, 0x0262be01, 0x0662be16,
+        0x0264be01, 0x0664be16, 0x0266be01, 0x0666be16, 0x0267be01, 0x0667be16,
+        0x0268be01, 0x0668be16, 0x026cbe01, 0x066cbe16, 0x026dbe01, 0x066dbe16,
+        0x026ebe01, 0x066ebe16, 0x0270be01, 0x0670be16, 0x0272be01, 0x0672be16,
+        0x0275be01, 0x0675be16, 0x063abe00, 0x0642be00, 0x0643be00, 0x0644be00,
+        0x0645be00, 0x0646be00, 0x0647be00, 0x0648be00, 0x0649be00, 0x064abe00,
+        0x064bbe00, 0x064cbe00, 0x064dbe00, 0x064ebe00, 0x064fbe00, 0x0650be00,
+        0x0651be00, 0x0652be00, 0x0653be00, 0x0654be00, 0x0655be00, 0x0656be00,
+        0x0657be00, 0x0659be00, 0x066abe00, 0x066bbe00, 0x0671be00, 0x0676be00,
+        0x0677be00, 0x0678be00, 0x0679be00, 0x067abe00, 0x0100be46, 0x0100be47,
+        0x0100be49, 0x0500be4a, 0x0230c402, 0x0230c409, 0x0230c417, 0x0630c428,
+        0x0231c402, 0x0231c409, 0x0231c417, 0x0631c428, 0x0232c402, 0x0232c409,
+        0x0232c417, 0x0632c428, 0x0261c402, 0x0261c409, 0x0261c417, 0x0661c428,
+        0x0263c402, 0x0263c409, 0x0263c417, 0x0663c428, 0x0265c402, 0x0265c409,
+        0x0265c417, 0x0665c428, 0x0269c402, 0x0269c409, 0x0269c417, 0x0669c428,
+        0x026fc402, 0x026fc409, 0x026fc417, 0x066fc428, 0x0273c402, 0x0273c409,
+        0x0273c417, 0x0673c428, 0x0274c402, 0x0274c409, 0x0274c417, 0x0674c428,
+        0x0220c401, 0x0620c416, 0x0225c401, 0x0625c416, 0x022dc401, 0x062dc416,
+        0x022ec401, 0x062ec416, 0x022fc401, 0x062fc416, 0x0233c401, 0x0633c416,
+        0x0234c401, 0x0634c416, 0x0235c401, 0x0635c416, 0x0236c401, 0x0636c416,
+        0x0237c401, 0x0637c416, 0x0238c401, 0x0638c416, 0x0239c401, 0x0639c416,
+        0x023dc401, 0x063dc416, 0x0241c401, 0x0641c416, 0x025fc401, 0x065fc416,
+        0x0262c401, 0x0662c416, 0x0264c401, 0x0664c416, 0x0266c401, 0x0666c416,
+        0x0267c401, 0x0667c416, 0x0268c401, 0x0668c416, 0x026cc401, 0x066cc416,
+        0x026dc401, 0x066dc416, 0x026ec401, 0x066ec416, 0x0270c401, 0x0670c416,
+        0x0272c401, 0x0672c416, 0x0275c401, 0x0675c416, 0x063ac400, 0x0642c400,
+        0x0643c400, 0x0644c400, 0x0645c400, 0x0646c400, 0x0647c400, 0x0648c400,
+        0x0649c400, 0x064ac400, 0x064bc400, 0x064cc400, 0x064dc400, 0x064ec400,
+        0x064fc400, 0x0650c400, 0x0651c400, 0x0652c400, 0x0653c400, 0x0654c400,
+        0x0655c400, 0x0656c400, 0x0657c400, 0x0659c400, 0x066ac400, 0x066bc400,
+        0x0671c400, 0x0676c400, 0x0677c400, 0x0678c400, 0x0679c400, 0x067ac400,
+        0x0100c446, 0x0100c447, 0x0100c449, 0x0500c44a
+    },
+    /* 142 */
+    {
+        0x0630c600, 0x0631c600, 0x0632c600, 0x0661c600, 0x0663c600, 0x0665c600,
+        0x0669c600, 0x066fc600, 0x0673c600, 0x0674c600, 0x0100c60d, 0x0100c60e,
+        0x0100c611, 0x0100c612, 0x0100c614, 0x0100c615, 0x0100c61a, 0x0100c61b,
+        0x0100c61d, 0x0100c61e, 0x0100c621, 0x0100c622, 0x0100c624, 0x0100c625,
+        0x0100c62b, 0x0100c62e, 0x0100c632, 0x0100c635, 0x0100c63a, 0x0100c63d,
+        0x0100c641, 0x0500c644, 0x0630e400, 0x0631e400, 0x0632e400, 0x0661e400,
+        0x0663e400, 0x0665e400, 0x0669e400, 0x066fe400, 0x0673e400, 0x0674e400,
+        0x0100e40d, 0x0100e40e, 0x0100e411, 0x0100e412, 0x0100e414, 0x0100e415,
+        0x0100e41a, 0x0100e41b, 0x0100e41d, 0x0100e41e, 0x0100e421, 0x0100e422,
+        0x0100e424, 0x0100e425, 0x0100e42b, 0x0100e42e, 0x0100e432, 0x0100e435,
+        0x0100e43a, 0x0100e43d, 0x0100e441, 0x0500e444, 0x0630e800, 0x0631e800,
+        0x0632e800, 0x0661e800, 0x0663e800, 0x0665e800, 0x0669e800, 0x066fe800,
+        0x0673e800, 0x0674e800, 0x0100e80d, 0x0100e80e, 0x0100e811, 0x0100e812,
+        0x0100e814, 0x0100e815, 0x0100e81a, 0x0100e81b, 0x0100e81d, 0x0100e81e,
+        0x0100e821, 0x0100e822, 0x0100e824, 0x0100e825, 0x0100e82b, 0x0100e82e,
+        0x0100e832, 0x0100e835, 0x0100e83a, 0x0100e83d, 0x0100e841, 0x0500e844,
+        0x0630e900, 0x0631e900, 0x0632e900, 0x0661e900, 0x0663e900, 0x0665e900,
+        0x0669e900, 0x066fe900, 0x0673e900, 0x0674e900, 0x0100e90d, 0x0100e90e,
+        0x0100e911, 0x0100e912, 0x0100e914, 0x0100e915, 0x0100e91a, 0x0100e91b,
+        0x0100e91d, 0x0100e91e, 0x0100e921, 0x0100e922, 0x0100e924, 0x0100e925,
+        0x0100e92b, 0x0100e92e, 0x0100e932, 0x0100e935, 0x0100e93a, 0x0100e93d,
+        0x0100e941, 0x0500e944, 0x01000104, 0x01000105, 0x01000107, 0x01000108,
+        0x0100010b, 0x0100010c, 0x01000110, 0x01000113, 0x01000119, 0x0100011c,
+        0x01000120, 0x01000123, 0x0100012a, 0x01000131, 0x01000139, 0x05000140,
+        0x01008704, 0x01008705, 0x01008707, 0x01008708, 0x0100870b, 0x0100870c,
+        0x01008710, 0x01008713, 0x01008719, 0x0100871c, 0x01008720, 0x01008723,
+        0x0100872a, 0x01008731, 0x01008739, 0x05008740, 0x01008904, 0x01008905,
+        0x01008907, 0x01008908, 0x0100890b, 0x0100890c, 0x01008910, 0x01008913,
+        0x01008919, 0x0100891c, 0x01008920, 0x01008923, 0x0100892a, 0x01008931,
+        0x01008939, 0x05008940, 0x01008a04, 0x01008a05, 0x01008a07, 0x01008a08,
+        0x01008a0b, 0x01008a0c, 0x01008a10, 0x01008a13, 0x01008a19, 0x01008a1c,
+        0x01008a20, 0x01008a23, 0x01008a2a, 0x01008a31, 0x01008a39, 0x05008a40,
+        0x01008b04, 0x01008b05, 0x01008b07, 0x01008b08, 0x01008b0b, 0x01008b0c,
+        0x01008b10, 0x01008b13, 0x01008b19, 0x01008b1c, 0x01008b20, 0x01008b23,
+        0x01008b2a, 0x01008b31, 0x01008b39, 0x05008b40, 0x01008c04, 0x01008c05,
+        0x01008c07, 0x01008c08, 0x01008c0b, 0x01008c0c, 0x01008c10, 0x01008c13,
+        0x01008c19, 0x01008c1c, 0x01008c20, 0x01008c23, 0x01008c2a, 0x01008c31,
+        0x01008c39, 0x05008c40, 0x01008d04, 0x01008d05, 0x01008d07, 0x01008d08,
+        0x01008d0b, 0x01008d0c, 0x01008d10, 0x01008d13, 0x01008d19, 0x01008d1c,
+        0x01008d20, 0x01008d23, 0x01008d2a, 0x01008d31, 0x01008d39, 0x05008d40,
+        0x01008f04, 0x01008f05, 0x01008f07, 0x01008f08, 0x01008f0b, 0x01008f0c,
+        0x01008f10, 0x01008f13, 0x01008f19, 0x01008f1c, 0x01008f20, 0x01008f23,
+        0x01008f2a, 0x01008f31, 0x01008f39, 0x05008f40
+    },
+    /* 143 */
+    {
+        0x0230c601, 0x0630c616, 0x0231c601, 0x0631c616, 0x0232c601, 0x0632c616,
+        0x0261c601, 0x0661c616, 0x0263c601, 0x0663c616, 0x0265c601, 0x0665c616,
+        0x0269c601, 0x0669c616, 0x026fc601, 0x066fc616, 0x0273c601, 0x0673c616,
+        0x0274c601, 0x0674c616, 0x0620c600, 0x0625c600, 0x062dc600, 0x062ec600,
+        0x062fc600, 0x0633c600, 0x0634c600, 0x0635c600, 0x0636c600, 0x0637c600,
+        0x0638c600, 0x0639c600, 0x063dc600, 0x0641c600, 0x065fc600, 0x0662c600,
+        0x0664c600, 0x0666c600, 0x0667c600, 0x0668c600, 0x066cc600, 0x066dc600,
+        0x066ec600, 0x0670c600, 0x0672c600, 0x0675c600, 0x0100c626, 0x0100c627,
+        0x0100c62c, 0x0100c62d, 0x0100c62f, 0x0100c630, 0x0100c633, 0x0100c634,
+        0x0100c636, 0x0100c637, 0x0100c63b, 0x0100c63c, 0x0100c63e, 0x0100c63f,
+        0x0100c642, 0x0100c643, 0x0100c645, 0x0500c648, 0x0230e401, 0x0630e416,
+        0x0231e401, 0x0631e416, 0x0232e401, 0x0632e416, 0x0261e401, 0x0661e416,
+        0x0263e401, 0x0663e416, 0x0265e401, 0x0665e416, 0x0269e401, 0x0669e416,
+        0x026fe401, 0x066fe416, 0x0273e401, 0x0673e416, 0x0274e401, 0x0674e416,
+        0x0620e400, 0x0625e400, 0x062de400, 0x062ee400, 0x062fe400, 0x0633e400,
+        0x0634e400, 0x0635e400, 0x0636e400, 0x0637e400, 0x0638e400, 0x0639e400,
+        0x063de400, 0x0641e400, 0x065fe400, 0x0662e400, 0x0664e400, 0x0666e400,
+        0x0667e400, 0x0668e400, 0x066ce400, 0x066de400, 0x066ee400, 0x0670e400,
+        0x0672e400, 0x0675e400, 0x0100e426, 0x0100e427, 0x0100e42c, 0x0100e42d,
+        0x0100e42f, 0x0100e430, 0x0100e433, 0x0100e434, 0x0100e436, 0x0100e437,
+        0x0100e43b, 0x0100e43c, 0x0100e43e, 0x0100e43f, 0x0100e442, 0x0100e443,
+        0x0100e445, 0x0500e448, 0x0230e801, 0x0630e816, 0x0231e801, 0x0631e816,
+        0x0232e801, 0x0632e816, 0x0261e801, 0x0661e816, 0x0263e801, 0x0663e816,
+        0x0265e801, 0x0665e816, 0x0269e801, 0x0669e816, 0x026fe801, 0x066fe816,
+        0x0273e801, 0x0673e816, 0x0274e801, 0x0674e816, 0x0620e800, 0x0625e800,
+        0x062de800, 0x062ee800, 0x062fe800, 0x0633e800, 0x0634e800, 0x0635e800,
+        0x0636e800, 0x0637e800, 0x0638e800, 0x0639e800, 0x063de800, 0x0641e800,
+        0x065fe800, 0x0662e800, 0x0664e800, 0x0666e800, 0x0667e800, 0x0668e800,
+        0x066ce800, 0x066de800, 0x066ee800, 0x0670e800, 0x0672e800, 0x0675e800,
+        0x0100e826, 0x0100e827, 0x0100e82c, 0x0100e82d, 0x0100e82f, 0x0100e830,
+        0x0100e833, 0x0100e834, 0x0100e836, 0x0100e837, 0x0100e83b, 0x0100e83c,
+        0x0100e83e, 0x0100e83f, 0x0100e842, 0x0100e843, 0x0100e845, 0x0500e848,
+        0x0230e901, 0x0630e916, 0x0231e901, 0x0631e916, 0x0232e901, 0x0632e916,
+        0x0261e901, 0x0661e916, 0x0263e901, 0x0663e916, 0x0265e901, 0x0665e916,
+        0x0269e901, 0x0669e916, 0x026fe901, 0x066fe916, 0x0273e901, 0x0673e916,
+        0x0274e901, 0x0674e916, 0x0620e900, 0x0625e900, 0x062de900, 0x062ee900,
+        0x062fe900, 0x0633e900, 0x0634e900, 0x0635e900, 0x0636e900, 0x0637e900,
+        0x0638e900, 0x0639e900, 0x063de900, 0x0641e900, 0x065fe900, 0x0662e900,
+        0x0664e900, 0x0666e900, 0x0667e900, 0x0668e900, 0x066ce900, 0x066de900,
+        0x066ee900, 0x0670e900, 0x0672e900, 0x0675e900, 0x0100e926, 0x0100e927,
+        0x0100e92c, 0x0100e92d, 0x0100e92f, 0x0100e930, 0x0100e933, 0x0100e934,
+        0x0100e936, 0x0100e937, 0x0100e93b, 0x0100e93c, 0x0100e93e, 0x0100e93f,
+        0x0100e942, 0x0100e943, 0x0100e945, 0x0500e948
+    },
+    /* 144 */
+    {
+        0x0230c602, 0x0230c609, 0x0230c617, 0x0630c628, 0x0231c602, 0x0231c609,
+        0x0231c617, 0x0631c628, 0x0232c602, 0x0232c609, 0x0232c617, 0x0632c628,
+        0x0261c602, 0x0261c609, 0x0261c617, 0x0661c628, 0x0263c602, 0x0263c609,
+        0x0263c617, 0x0663c628, 0x0265c602, 0x0265c609, 0x0265c617, 0x0665c628,
+        0x0269c602, 0x0269c609, 0x0269c617, 0x0669c628, 0x026fc602, 0x026fc609,
+        0x026fc617, 0x066fc628, 0x0273c602, 0x0273c609, 0x0273c617, 0x0673c628,
+        0x0274c602, 0x0274c609, 0x0274c617, 0x0674c628, 0x0220c601, 0x0620c616,
+        0x0225c601, 0x0625c616, 0x022dc601, 0x062dc616, 0x022ec601, 0x062ec616,
+        0x022fc601, 0x062fc616, 0x0233c601, 0x0633c616, 0x0234c601, 0x0634c616,
+        0x0235c601, 0x0635c616, 0x0236c601, 0x0636c616, 0x0237c601, 0x0637c616,
+        0x0238c601, 0x0638c616, 0x0239c601, 0x0639c616, 0x023dc601, 0x063dc616,
+        0x0241c601, 0x0641c616, 0x025fc601, 0x065fc616, 0x0262c601, 0x0662c616,
+        0x0264c601, 0x0664c616, 0x0266c601, 0x0666c616, 0x0267c601, 0x0667c616,
+        0x0268c601, 0x0668c616, 0x026cc601, 0x066cc616, 0x026dc601, 0x066dc616,
+        0x026ec601, 0x066ec616, 0x0270c601, 0x0670c616, 0x0272c601, 0x0672c616,
+        0x0275c601, 0x0675c616, 0x063ac600, 0x0642c600, 0x0643c600, 0x0644c600,
+        0x0645c600, 0x0646c600, 0x0647c600, 0x0648c600, 0x0649c600, 0x064ac600,
+        0x064bc600, 0x064cc600, 0x064dc600, 0x064ec600, 0x064fc600, 0x0650c600,
+        0x0651c600, 0x0652c600, 0x0653c600, 0x0654c600, 0x0655c600, 0x0656c600,
+        0x0657c600, 0x0659c600, 0x066ac600, 0x066bc600, 0x0671c600, 0x0676c600,
+        0x0677c600, 0x0678c600, 0x0679c600, 0x067ac600, 0x0100c646, 0x0100c647,
+        0x0100c649, 0x0500c64a, 0x0230e402, 0x0230e409, 0x0230e417, 0x0630e428,
+        0x0231e402, 0x0231e409, 0x0231e417, 0x0631e428, 0x0232e402, 0x0232e409,
+        0x0232e417, 0x0632e428, 0x0261e402, 0x0261e409, 0x0261e417, 0x0661e428,
+        0x0263e402, 0x0263e409, 0x0263e417, 0x0663e428, 0x0265e402, 0x0265e409,
+        0x0265e417, 0x0665e428, 0x0269e402, 0x0269e409, 0x0269e417, 0x0669e428,
+        0x026fe402, 0x026fe409, 0x026fe417, 0x066fe428, 0x0273e402, 0x0273e409,
+        0x0273e417, 0x0673e428, 0x0274e402, 0x0274e409, 0x0274e417, 0x0674e428,
+        0x0220e401, 0x0620e416, 0x0225e401, 0x0625e416, 0x022de401, 0x062de416,
+        0x022ee401, 0x062ee416, 0x022fe401, 0x062fe416, 0x0233e401, 0x0633e416,
+        0x0234e401, 0x0634e416, 0x0235e401, 0x0635e416, 0x0236e401, 0x0636e416,
+        0x0237e401, 0x0637e416, 0x0238e401, 0x0638e416, 0x0239e401, 0x0639e416,
+        0x023de401, 0x063de416, 0x0241e401, 0x0641e416, 0x025fe401, 0x065fe416,
+        0x0262e401, 0x0662e416, 0x0264e401, 0x0664e416, 0x0266e401, 0x0666e416,
+        0x0267e401, 0x0667e416, 0x0268e401, 0x0668e416, 0x026ce401, 0x066ce416,
+        0x026de401, 0x066de416, 0x026ee401, 0x066ee416, 0x0270e401, 0x0670e416,
+        0x0272e401, 0x0672e416, 0x0275e401, 0x0675e416, 0x063ae400, 0x0642e400,
+        0x0643e400, 0x0644e400, 0x0645e400, 0x0646e400, 0x0647e400, 0x0648e400,
+        0x0649e400, 0x064ae400, 0x064be400, 0x064ce400, 0x064de400, 0x064ee400,
+        0x064fe400, 0x0650e400, 0x0651e400, 0x0652e400, 0x0653e400, 0x0654e400,
+        0x0655e400, 0x0656e400, 0x0657e400, 0x0659e400, 0x066ae400, 0x066be400,
+        0x0671e400, 0x0676e400, 0x0677e400, 0x0678e400, 0x0679e400, 0x067ae400,
+        0x0100e446, 0x0100e447, 0x0100e449, 0x0500e44a
+    },
+    /* 145 */
+    {
+        0x0230e802, 0x0230e809, 0x0230e817, 0x0630e828, 0x0231e802, 0x0231e809,
+        0x0231e817, 0x0631e828, 0x0232e802, 0x0232e809, 0x0232e817, 0x0632e828,
+        0x0261e802, 0x0261e809, 0x0261e817, 0x0661e828, 0x0263e802, 0x0263e809,
+        0x0263e817, 0x0663e828, 0x0265e802, 0x0265e809, 0x0265e817, 0x0665e828,
+        0x0269e802, 0x0269e809, 0x0269e817, 0x0669e828, 0x026fe802, 0x026fe809,
+        0x026fe817, 0x066fe828, 0x0273e802, 0x0273e809, 0x0273e817, 0x0673e828,
+        0x0274e802, 0x0274e809, 0x0274e817, 0x0674e828, 0x0220e801, 0x0620e816,
+        0x0225e801, 0x0625e816, 0x022de801, 0x062de816, 0x022ee801, 0x062ee816,
+        0x022fe801, 0x062fe816, 0x0233e801, 0x0633e816, 0x0234e801, 0x0634e816,
+        0x0235e801, 0x0635e816, 0x0236e801, 0x0636e816, 0x0237e801, 0x0637e816,
+        0x0238e801, 0x0638e816, 0x0239e801, 0x0639e816, 0x023de801, 0x063de816,
+        0x0241e801, 0x0641e816, 0x025fe801, 0x065fe816, 0x0262e801, 0x0662e816,
+        0x0264e801, 0x0664e816, 0x0266e801, 0x0666e816, 0x0267e801, 0x0667e816,
+        0x0268e801, 0x0668e816, 0x026ce801, 0x066ce816, 0x026de801, 0x066de816,
+        0x026ee801, 0x066ee816, 0x0270e801, 0x0670e816, 0x0272e801, 0x0672e816,
+        0x0275e801, 0x0675e816, 0x063ae800, 0x0642e800, 0x0643e800, 0x0644e800,
+        0x0645e800, 0x0646e800, 0x0647e800, 0x0648e800, 0x0649e800, 0x064ae800,
+        0x064be800, 0x064ce800, 0x064de800, 0x064ee800, 0x064fe800, 0x0650e800,
+        0x0651e800, 0x0652e800, 0x0653e800, 0x0654e800, 0x0655e800, 0x0656e800,
+        0x0657e800, 0x0659e800, 0x066ae800, 0x066be800, 0x0671e800, 0x0676e800,
+        0x0677e800, 0x0678e800, 0x0679e800, 0x067ae800, 0x0100e846, 0x0100e847,
+        0x0100e849, 0x0500e84a, 0x0230e902, 0x0230e909, 0x0230e917, 0x0630e928,
+        0x0231e902, 0x0231e909, 0x0231e917, 0x0631e928, 0x0232e902, 0x0232e909,
+        0x0232e917, 0x0632e928, 0x0261e902, 0x0261e909, 0x0261e917, 0x0661e928,
+        0x0263e902, 0x0263e909, 0x0263e917, 0x0663e928, 0x0265e902, 0x0265e909,
+        0x0265e917, 0x0665e928, 0x0269e902, 0x0269e909, 0x0269e917, 0x0669e928,
+        0x026fe902, 0x026fe909, 0x026fe917, 0x066fe928, 0x0273e902, 0x0273e909,
+        0x0273e917, 0x0673e928, 0x0274e902, 0x0274e909, 0x0274e917, 0x0674e928,
+        0x0220e901, 0x0620e916, 0x0225e901, 0x0625e916, 0x022de901, 0x062de916,
+        0x022ee901, 0x062ee916, 0x022fe901, 0x062fe916, 0x0233e901, 0x0633e916,
+        0x0234e901, 0x0634e916, 0x0235e901, 0x0635e916, 0x0236e901, 0x0636e916,
+        0x0237e901, 0x0637e916, 0x0238e901, 0x0638e916, 0x0239e901, 0x0639e916,
+        0x023de901, 0x063de916, 0x0241e901, 0x0641e916, 0x025fe901, 0x065fe916,
+        0x0262e901, 0x0662e916, 0x0264e901, 0x0664e916, 0x0266e901, 0x0666e916,
+        0x0267e901, 0x0667e916, 0x0268e901, 0x0668e916, 0x026ce901, 0x066ce916,
+        0x026de901, 0x066de916, 0x026ee901, 0x066ee916, 0x0270e901, 0x0670e916,
+        0x0272e901, 0x0672e916, 0x0275e901, 0x0675e916, 0x063ae900, 0x0642e900,
+        0x0643e900, 0x0644e900, 0x0645e900, 0x0646e900, 0x0647e900, 0x0648e900,
+        0x0649e900, 0x064ae900, 0x064be900, 0x064ce900, 0x064de900, 0x064ee900,
+        0x064fe900, 0x0650e900, 0x0651e900, 0x0652e900, 0x0653e900, 0x0654e900,
+        0x0655e900, 0x0656e900, 0x0657e900, 0x0659e900, 0x066ae900, 0x066be900,
+        0x0671e900, 0x0676e900, 0x0677e900, 0x0678e900, 0x0679e900, 0x067ae900,
+        0x0100e946, 0x0100e947, 0x0100e949, 0x0500e94a
+    },
+    /* 146 */
+    {
+        0x06300100, 0x06310100, 0x06320100, 0x06610100, 0x06630100, 0x06650100,
+        0x06690100, 0x066f0100, 0x06730100, 0x06740100, 0x0100010d, 0x0100010e,
+        0x01000111, 0x01000112, 0x01000114, 0x01000115, 0x0100011a, 0x0100011b,
+        0x0100011d, 0x0100011e, 0x01000121, 0x01000122, 0x01000124, 0x01000125,
+        0x0100012b, 0x0100012e, 0x01000132, 0x01000135, 0x0100013a, 0x0100013d,
+        0x01000141, 0x05000144, 0x06308700, 0x06318700, 0x06328700, 0x06618700,
+        0x06638700, 0x06658700, 0x06698700, 0x066f8700, 0x06738700, 0x06748700,
+        0x0100870d, 0x0100870e, 0x01008711, 0x01008712, 0x01008714, 0x01008715,
+        0x0100871a, 0x0100871b, 0x0100871d, 0x0100871e, 0x01008721, 0x01008722,
+        0x01008724, 0x01008725, 0x0100872b, 0x0100872e, 0x01008732, 0x01008735,
+        0x0100873a, 0x0100873d, 0x01008741, 0x05008744, 0x06308900, 0x06318900,
+        0x06328900, 0x06618900, 0x06638900, 0x06658900, 0x06698900, 0x066f8900,
+        0x06738900, 0x06748900, 0x0100890d, 0x0100890e, 0x01008911, 0x01008912,
+        0x01008914, 0x01008915, 0x0100891a, 0x0100891b, 0x0100891d, 0x0100891e,
+        0x01008921, 0x01008922, 0x01008924, 0x01008925, 0x0100892b, 0x0100892e,
+        0x01008932, 0x01008935, 0x0100893a, 0x0100893d, 0x01008941, 0x05008944,
+        0x06308a00, 0x06318a00, 0x06328a00, 0x06618a00, 0x06638a00, 0x06658a00,
+        0x06698a00, 0x066f8a00, 0x06738a00, 0x06748a00, 0x01008a0d, 0x01008a0e,
+        0x01008a11, 0x01008a12, 0x01008a14, 0x01008a15, 0x01008a1a, 0x01008a1b,
+        0x01008a1d, 0x01008a1e, 0x01008a21, 0x01008a22, 0x01008a24, 0x01008a25,
+        0x01008a2b, 0x01008a2e, 0x01008a32, 0x01008a35, 0x01008a3a, 0x01008a3d,
+        0x01008a41, 0x05008a44, 0x06308b00, 0x06318b00, 0x06328b00, 0x06618b00,
+        0x06638b00, 0x06658b00, 0x06698b00, 0x066f8b00, 0x06738b00, 0x06748b00,
+        0x01008b0d, 0x01008b0e, 0x01008b11, 0x01008b12, 0x01008b14, 0x01008b15,
+        0x01008b1a, 0x01008b1b, 0x01008b1d, 0x01008b1e, 0x01008b21, 0x01008b22,
+        0x01008b24, 0x01008b25, 0x01008b2b, 0x01008b2e, 0x01008b32, 0x01008b35,
+        0x01008b3a, 0x01008b3d, 0x01008b41, 0x05008b44, 0x06308c00, 0x06318c00,
+        0x06328c00, 0x06618c00, 0x06638c00, 0x06658c00, 0x06698c00, 0x066f8c00,
+        0x06738c00, 0x06748c00, 0x01008c0d, 0x01008c0e, 0x01008c11, 0x01008c12,
+        0x01008c14, 0x01008c15, 0x01008c1a, 0x01008c1b, 0x01008c1d, 0x01008c1e,
+        0x01008c21, 0x01008c22, 0x01008c24, 0x01008c25, 0x01008c2b, 0x01008c2e,
+        0x01008c32, 0x01008c35, 0x01008c3a, 0x01008c3d, 0x01008c41, 0x05008c44,
+        0x06308d00, 0x06318d00, 0x06328d00, 0x06618d00, 0x06638d00, 0x06658d00,
+        0x06698d00, 0x066f8d00, 0x06738d00, 0x06748d00, 0x01008d0d, 0x01008d0e,
+        0x01008d11, 0x01008d12, 0x01008d14, 0x01008d15, 0x01008d1a, 0x01008d1b,
+        0x01008d1d, 0x01008d1e, 0x01008d21, 0x01008d22, 0x01008d24, 0x01008d25,
+        0x01008d2b, 0x01008d2e, 0x01008d32, 0x01008d35, 0x01008d3a, 0x01008d3d,
+        0x01008d41, 0x05008d44, 0x06308f00, 0x06318f00, 0x06328f00, 0x06618f00,
+        0x06638f00, 0x06658f00, 0x06698f00, 0x066f8f00, 0x06738f00, 0x06748f00,
+        0x01008f0d, 0x01008f0e, 0x01008f11, 0x01008f12, 0x01008f14, 0x01008f15,
+        0x01008f1a, 0x01008f1b, 0x01008f1d, 0x01008f1e, 0x01008f21, 0x01008f22,
+        0x01008f24, 0x01008f25, 0x01008f2b, 0x01008f2e, 0x01008f32, 0x01008f35,
+        0x01008f3a, 0x01008f3d, 0x01008f41, 0x05008f44
+    },
+    /* 147 */
+    {
+        0x02300101, 0x06300116, 0x02310101, 0x06310116, 0x02320101, 0x06320116,
+        0x02610101, 0x06610116, 0x02630101, 0x06630116, 0x02650101, 0x06650116,
+        0x02690101, 0x06690116, 0x026f0101, 0x066f0116, 0x02730101, 0x06730116,
+        0x02740101, 0x06740116, 0x06200100, 0x06250100, 0x062d0100, 0x062e0100,
+        0x062f0100, 0x06330100, 0x06340100, 0x06350100, 0x06360100, 0x06370100,
+        0x06380100, 0x06390100, 0x063d0100, 0x06410100, 0x065f0100, 0x06620100,
+        0x06640100, 0x06660100, 0x06670100, 0x06680100, 0x066c0100, 0x066d0100,
+        0x066e0100, 0x06700100, 0x06720100, 0x06750100, 0x01000126, 0x01000127,
+        0x0100012c, 0x0100012d, 0x0100012f, 0x01000130, 0x01000133, 0x01000134,
+        0x01000136, 0x01000137, 0x0100013b, 0x0100013c, 0x0100013e, 0x0100013f,
+        0x01000142, 0x01000143, 0x01000145, 0x05000148, 0x02308701, 0x06308716,
+        0x02318701, 0x06318716, 0x02328701, 0x06328716, 0x02618701, 0x06618716,
+        0x02638701, 0x06638716, 0x02658701, 0x06658716, 0x02698701, 0x06698716,
+        0x026f8701, 0x066f8716, 0x02738701, 0x06738716, 0x02748701, 0x06748716,
+        0x06208700, 0x06258700, 0x062d8700, 0x062e8700, 0x062f8700, 0x06338700,
+        0x06348700, 0x06358700, 0x06368700, 0x06378700, 0x06388700, 0x06398700,
+        0x063d8700, 0x06418700, 0x065f8700, 0x06628700, 0x06648700, 0x06668700,
+        0x06678700, 0x06688700, 0x066c8700, 0x066d8700, 0x066e8700, 0x06708700,
+        0x06728700, 0x06758700, 0x01008726, 0x01008727, 0x0100872c, 0x0100872d,
+        0x0100872f, 0x01008730, 0x01008733, 0x01008734, 0x01008736, 0x01008737,
+        0x0100873b, 0x0100873c, 0x0100873e, 0x0100873f, 0x01008742, 0x01008743,
+        0x01008745, 0x05008748, 0x02308901, 0x06308916, 0x02318901, 0x06318916,
+        0x02328901, 0x06328916, 0x02618901, 0x06618916, 0x02638901, 0x06638916,
+        0x02658901, 0x06658916, 0x02698901, 0x06698916, 0x026f8901, 0x066f8916,
+        0x02738901, 0x06738916, 0x02748901, 0x06748916, 0x06208900, 0x06258900,
+        0x062d8900, 0x062e8900, 0x062f8900, 0x06338900, 0x06348900, 0x06358900,
+        0x06368900, 0x06378900, 0x06388900, 0x06398900, 0x063d8900, 0x06418900,
+        0x065f8900, 0x06628900, 0x06648900, 0x06668900, 0x06678900, 0x06688900,
+        0x066c8900, 0x066d8900, 0x066e8900, 0x06708900, 0x06728900, 0x06758900,
+        0x01008926, 0x01008927, 0x0100892c, 0x0100892d, 0x0100892f, 0x01008930,
+        0x01008933, 0x01008934, 0x01008936, 0x01008937, 0x0100893b, 0x0100893c,
+        0x0100893e, 0x0100893f, 0x01008942, 0x01008943, 0x01008945, 0x05008948,
+        0x02308a01, 0x06308a16, 0x02318a01, 0x06318a16, 0x02328a01, 0x06328a16,
+        0x02618a01, 0x06618a16, 0x02638a01, 0x06638a16, 0x02658a01, 0x06658a16,
+        0x02698a01, 0x06698a16, 0x026f8a01, 0x066f8a16, 0x02738a01, 0x06738a16,
+        0x02748a01, 0x06748a16, 0x06208a00, 0x06258a00, 0x062d8a00, 0x062e8a00,
+        0x062f8a00, 0x06338a00, 0x06348a00, 0x06358a00, 0x06368a00, 0x06378a00,
+        0x06388a00, 0x06398a00, 0x063d8a00, 0x06418a00, 0x065f8a00, 0x06628a00,
+        0x06648a00, 0x06668a00, 0x06678a00, 0x06688a00, 0x066c8a00, 0x066d8a00,
+        0x066e8a00, 0x06708a00, 0x06728a00, 0x06758a00, 0x01008a26, 0x01008a27,
+        0x01008a2c, 0x01008a2d, 0x01008a2f, 0x01008a30, 0x01008a33, 0x01008a34,
+        0x01008a36, 0x01008a37, 0x01008a3b, 0x01008a3c, 0x01008a3e, 0x01008a3f,
+        0x01008a42, 0x01008a43, 0x01008a45, 0x05008a48
+    },
+    /* 148 */
+    {
+        0x02300102, 0x02300109, 0x02300117, 0x06300128, 0x02310102, 0x02310109,
+        0x02310117, 0x06310128, 0x02320102, 0x02320109, 0x02320117, 0x06320128,
+        0x02610102, 0x02610109, 0x02610117, 0x06610128, 0x02630102, 0x02630109,
+        0x02630117, 0x06630128, 0x02650102, 0x02650109, 0x02650117, 0x06650128,
+        0x02690102, 0x02690109, 0x02690117, 0x06690128, 0x026f0102, 0x026f0109,
+        0x026f0117, 0x066f0128, 0x02730102, 0x02730109, 0x02730117, 0x06730128,
+        0x02740102, 0x02740109, 0x02740117, 0x06740128, 0x02200101, 0x06200116,
+        0x02250101, 0x06250116, 0x022d0101, 0x062d0116, 0x022e0101, 0x062e0116,
+        0x022f0101, 0x062f0116, 0x02330101, 0x06330116, 0x02340101, 0x06340116,
+        0x02350101, 0x06350116, 0x02360101, 0x06360116, 0x02370101, 0x06370116,
+        0x02380101, 0x06380116, 0x02390101, 0x06390116, 0x023d0101, 0x063d0116,
+        0x02410101, 0x06410116, 0x025f0101, 0x065f0116, 0x02620101, 0x06620116,
+        0x02640101, 0x06640116, 0x02660101, 0x06660116, 0x02670101, 0x06670116,
+        0x02680101, 0x06680116, 0x026c0101, 0x066c0116, 0x026d0101, 0x066d0116,
+        0x026e0101, 0x066e0116, 0x02700101, 0x06700116, 0x02720101, 0x06720116,
+        0x02750101, 0x06750116, 0x063a0100, 0x06420100, 0x06430100, 0x06440100,
+        0x06450100, 0x06460100, 0x06470100, 0x06480100, 0x06490100, 0x064a0100,
+        0x064b0100, 0x064c0100, 0x064d0100, 0x064e0100, 0x064f0100, 0x06500100,
+        0x06510100, 0x06520100, 0x06530100, 0x06540100, 0x06550100, 0x06560100,
+        0x06570100, 0x06590100, 0x066a0100, 0x066b0100, 0x06710100, 0x06760100,
+        0x06770100, 0x06780100, 0x06790100, 0x067a0100, 0x01000146, 0x01000147,
+        0x01000149, 0x0500014a, 0x02308702, 0x02308709, 0x02308717, 0x06308728,
+        0x02318702, 0x02318709, 0x02318717, 0x06318728, 0x02328702, 0x02328709,
+        0x02328717, 0x06328728, 0x02618702, 0x02618709, 0x02618717, 0x06618728,
+        0x02638702, 0x02638709, 0x02638717, 0x06638728, 0x02658702, 0x02658709,
+        0x02658717, 0x06658728, 0x02698702, 0x02698709, 0x02698717, 0x06698728,
+        0x026f8702, 0x026f8709, 0x026f8717, 0x066f8728, 0x02738702, 0x02738709,
+        0x02738717, 0x06738728, 0x02748702, 0x02748709, 0x02748717, 0x06748728,
+        0x02208701, 0x06208716, 0x02258701, 0x06258716, 0x022d8701, 0x062d8716,
+        0x022e8701, 0x062e8716, 0x022f8701, 0x062f8716, 0x02338701, 0x06338716,
+        0x02348701, 0x06348716, 0x02358701, 0x06358716, 0x02368701, 0x06368716,
+        0x02378701, 0x06378716, 0x02388701, 0x06388716, 0x02398701, 0x06398716,
+        0x023d8701, 0x063d8716, 0x02418701, 0x06418716, 0x025f8701, 0x065f8716,
+        0x02628701, 0x06628716, 0x02648701, 0x06648716, 0x02668701, 0x06668716,
+        0x02678701, 0x06678716, 0x02688701, 0x06688716, 0x026c8701, 0x066c8716,
+        0x026d8701, 0x066d8716, 0x026e8701, 0x066e8716, 0x02708701, 0x06708716,
+        0x02728701, 0x06728716, 0x02758701, 0x06758716, 0x063a8700, 0x06428700,
+        0x06438700, 0x06448700, 0x06458700, 0x06468700, 0x06478700, 0x06488700,
+        0x06498700, 0x064a8700, 0x064b8700, 0x064c8700, 0x064d8700, 0x064e8700,
+        0x064f8700, 0x06508700, 0x06518700, 0x06528700, 0x06538700, 0x06548700,
+        0x06558700, 0x06568700, 0x06578700, 0x06598700, 0x066a8700, 0x066b8700,
+        0x06718700, 0x06768700, 0x06778700, 0x06788700, 0x06798700, 0x067a8700,
+        0x01008746, 0x01008747, 0x01008749, 0x0500874a
+    },
+    /* 149 */
+    {
+        0x02308902, 0x02308909, 0x02308917, 0x06308928, 0x02318902, 0x02318909,
+        0x02318917, 0x06318928, 0x02328902, 0x02328909, 0x02328917, 0x06328928,
+        0x02618902, 0x02618909, 0x02618917, 0x06618928, 0x02638902, 0x02638909,
+        0x02638917, 0x06638928, 0x02658902, 0x02658909, 0x02658917, 0x06658928,
+        0x02698902, 0x02698909, 0x02698917, 0x06698928, 0x026f8902, 0x026f8909,
+        0x026f8917, 0x066f8928, 0x02738902, 0x02738909, 0x02738917, 0x06738928,
+        0x02748902, 0x02748909, 0x02748917, 0x06748928, 0x02208901, 0x06208916,
+        0x02258901, 0x06258916, 0x022d8901, 0x062d8916, 0x022e8901, 0x062e8916,
+        0x022f8901, 0x062f8916, 0x02338901, 0x06338916, 0x02348901, 0x06348916,
+        0x02358901, 0x06358916, 0x02368901, 0x06368916, 0x02378901, 0x06378916,
+        0x02388901, 0x06388916, 0x02398901, 0x06398916, 0x023d8901, 0x063d8916,
+        0x02418901, 0x06418916, 0x025f8901, 0x065f8916, 0x02628901, 0x06628916,
+        0x02648901, 0x06648916, 0x02668901, 0x06668916, 0x02678901, 0x06678916,
+        0x02688901, 0x06688916, 0x026c8901, 0x066c8916, 0x026d8901, 0x066d8916,
+        0x026e8901, 0x066e8916, 0x02708901, 0x06708916, 0x02728901, 0x06728916,
+        0x02758901, 0x06758916, 0x063a8900, 0x06428900, 0x06438900, 0x06448900,
+        0x06458900, 0x06468900, 0x06478900, 0x06488900, 0x06498900, 0x064a8900,
+        0x064b8900, 0x064c8900, 0x064d8900, 0x064e8900, 0x064f8900, 0x06508900,
+        0x06518900, 0x06528900, 0x06538900, 0x06548900, 0x06558900, 0x06568900,
+        0x06578900, 0x06598900, 0x066a8900, 0x066b8900, 0x06718900, 0x06768900,
+        0x06778900, 0x06788900, 0x06798900, 0x067a8900, 0x01008946, 0x01008947,
+        0x01008949, 0x0500894a, 0x02308a02, 0x02308a09, 0x02308a17, 0x06308a28,
+        0x02318a02, 0x02318a09, 0x02318a17, 0x06318a28, 0x02328a02, 0x02328a09,
+        0x02328a17, 0x06328a28, 0x02618a02, 0x02618a09, 0x02618a17, 0x06618a28,
+        0x02638a02, 0x02638a09, 0x02638a17, 0x06638a28, 0x02658a02, 0x02658a09,
+        0x02658a17, 0x06658a28, 0x02698a02, 0x02698a09, 0x02698a17, 0x06698a28,
+        0x026f8a02, 0x026f8a09, 0x026f8a17, 0x066f8a28, 0x02738a02, 0x02738a09,
+        0x02738a17, 0x06738a28, 0x02748a02, 0x02748a09, 0x02748a17, 0x06748a28,
+        0x02208a01, 0x06208a16, 0x02258a01, 0x06258a16, 0x022d8a01, 0x062d8a16,
+        0x022e8a01, 0x062e8a16, 0x022f8a01, 0x062f8a16, 0x02338a01, 0x06338a16,
+        0x02348a01, 0x06348a16, 0x02358a01, 0x06358a16, 0x02368a01, 0x06368a16,
+        0x02378a01, 0x06378a16, 0x02388a01, 0x06388a16, 0x02398a01, 0x06398a16,
+        0x023d8a01, 0x063d8a16, 0x02418a01, 0x06418a16, 0x025f8a01, 0x065f8a16,
+        0x02628a01, 0x06628a16, 0x02648a01, 0x06648a16, 0x02668a01, 0x06668a16,
+        0x02678a01, 0x06678a16, 0x02688a01, 0x06688a16, 0x026c8a01, 0x066c8a16,
+        0x026d8a01, 0x066d8a16, 0x026e8a01, 0x066e8a16, 0x02708a01, 0x06708a16,
+        0x02728a01, 0x06728a16, 0x02758a01, 0x06758a16, 0x063a8a00, 0x06428a00,
+        0x06438a00, 0x06448a00, 0x06458a00, 0x06468a00, 0x06478a00, 0x06488a00,
+        0x06498a00, 0x064a8a00, 0x064b8a00, 0x064c8a00, 0x064d8a00, 0x064e8a00,
+        0x064f8a00, 0x06508a00, 0x06518a00, 0x06528a00, 0x06538a00, 0x06548a00,
+        0x06558a00, 0x06568a00, 0x06578a00, 0x06598a00, 0x066a8a00, 0x066b8a00,
+        0x06718a00, 0x06768a00, 0x06778a00, 0x06788a00, 0x06798a00, 0x067a8a00,
+        0x01008a46, 0x01008a47, 0x01008a49, 0x05008a4a
+    },
+    /* 150 */
+    {
+        0x02308b01, 0x06308b16, 0x02318b01, 0x06318b16, 0x02328b01, 0x06328b16,
+        0x02618b01, 0x06618b16, 0x02638b01, 0x06638b16, 0x02658b01, 0x06658b16,
+        0x02698b01, 0x06698b16, 0x026f8b01, 0x066f8b16, 0x02738b01, 0x06738b16,
+        0x02748b01, 0x06748b16, 0x06208b00, 0x06258b00, 0x062d8b00, 0x062e8b00,
+        0x062f8b00, 0x06338b00, 0x06348b00, 0x06358b00, 0x06368b00, 0x06378b00,
+        0x06388b00, 0x06398b00, 0x063d8b00, 0x06418b00, 0x065f8b00, 0x06628b00,
+        0x06648b00, 0x06668b00, 0x06678b00, 0x06688b00, 0x066c8b00, 0x066d8b00,
+        0x066e8b00, 0x06708b00, 0x06728b00, 0x06758b00, 0x01008b26, 0x01008b27,
+        0x01008b2c, 0x01008b2d, 0x01008b2f, 0x01008b30, 0x01008b33, 0x01008b34,
+        0x01008b36, 0x01008b37, 0x01008b3b, 0x01008b3c, 0x01008b3e, 0x01008b3f,
+        0x01008b42, 0x01008b43, 0x01008b45, 0x05008b48, 0x02308c01, 0x06308c16,
+        0x02318c01, 0x06318c16, 0x02328c01, 0x06328c16, 0x02618c01, 0x06618c16,
+        0x02638c01, 0x06638c16, 0x02658c01, 0x06658c16, 0x02698c01, 0x06698c16,
+        0x026f8c01, 0x066f8c16, 0x02738c01, 0x06738c16, 0x02748c01, 0x06748c16,
+        0x06208c00, 0x06258c00, 0x062d8c00, 0x062e8c00, 0x062f8c00, 0x06338c00,
+        0x06348c00, 0x06358c00, 0x06368c00, 0x06378c00, 0x06388c00, 0x06398c00,
+        0x063d8c00, 0x06418c00, 0x065f8c00, 0x06628c00, 0x06648c00, 0x06668c00,
+        0x06678c00, 0x06688c00, 0x066c8c00, 0x066d8c00, 0x066e8c00, 0x06708c00,
+        0x06728c00, 0x06758c00, 0x01008c26, 0x01008c27, 0x01008c2c, 0x01008c2d,
+        0x01008c2f, 0x01008c30, 0x01008c33, 0x01008c34, 0x01008c36, 0x01008c37,
+        0x01008c3b, 0x01008c3c, 0x01008c3e, 0x01008c3f, 0x01008c42, 0x01008c43,
+        0x01008c45, 0x05008c48, 0x02308d01, 0x06308d16, 0x02318d01, 0x06318d16,
+        0x02328d01, 0x06328d16, 0x02618d01, 0x06618d16, 0x02638d01, 0x06638d16,
+        0x02658d01, 0x06658d16, 0x02698d01, 0x06698d16, 0x026f8d01, 0x066f8d16,
+        0x02738d01, 0x06738d16, 0x02748d01, 0x06748d16, 0x06208d00, 0x06258d00,
+        0x062d8d00, 0x062e8d00, 0x062f8d00, 0x06338d00, 0x06348d00, 0x06358d00,
+        0x06368d00, 0x06378d00, 0x06388d00, 0x06398d00, 0x063d8d00, 0x06418d00,
+        0x065f8d00, 0x06628d00, 0x06648d00, 0x06668d00, 0x06678d00, 0x06688d00,
+        0x066c8d00, 0x066d8d00, 0x066e8d00, 0x06708d00, 0x06728d00, 0x06758d00,
+        0x01008d26, 0x01008d27, 0x01008d2c, 0x01008d2d, 0x01008d2f, 0x01008d30,
+        0x01008d33, 0x01008d34, 0x01008d36, 0x01008d37, 0x01008d3b, 0x01008d3c,
+        0x01008d3e, 0x01008d3f, 0x01008d42, 0x01008d43, 0x01008d45, 0x05008d48,
+        0x02308f01, 0x06308f16, 0x02318f01, 0x06318f16, 0x02328f01, 0x06328f16,
+        0x02618f01, 0x06618f16, 0x02638f01, 0x06638f16, 0x02658f01, 0x06658f16,
+        0x02698f01, 0x06698f16, 0x026f8f01, 0x066f8f16, 0x02738f01, 0x06738f16,
+        0x02748f01, 0x06748f16, 0x06208f00, 0x06258f00, 0x062d8f00, 0x062e8f00,
+        0x062f8f00, 0x06338f00, 0x06348f00, 0x06358f00, 0x06368f00, 0x06378f00,
+        0x06388f00, 0x06398f00, 0x063d8f00, 0x06418f00, 0x065f8f00, 0x06628f00,
+        0x06648f00, 0x06668f00, 0x06678f00, 0x06688f00, 0x066c8f00, 0x066d8f00,
+        0x066e8f00, 0x06708f00, 0x06728f00, 0x06758f00, 0x01008f26, 0x01008f27,
+        0x01008f2c, 0x01008f2d, 0x01008f2f, 0x01008f30, 0x01008f33, 0x01008f34,
+        0x01008f36, 0x01008f37, 0x01008f3b, 0x01008f3c, 0x01008f3e, 0x01008f3f,
+        0x01008f42, 0x01008f43, 0x01008f45, 0x05008f48
+    },
+    /* 151 */
+    {
+        0x02308b02, 0x02308b09, 0x02308b17, 0x06308b28, 0x02318b02, 0x02318b09,
+        0x02318b17, 0x06318b28, 0x02328b02, 0x02328b09, 0x02328b17, 0x06328b28,
+        0x02618b02, 0x02618b09, 0x02618b17, 0x06618b28, 0x02638b02, 0x02638b09,
+        0x02638b17, 0x06638b28, 0x02658b02, 0x02658b09, 0x02658b17, 0x06658b28,
+        0x02698b02, 0x02698b09, 0x02698b17, 0x06698b28, 0x026f8b02, 0x026f8b09,
+        0x026f8b17, 0x066f8b28, 0x02738b02, 0x02738b09, 0x02738b17, 0x06738b28,
+        0x02748b02, 0x02748b09, 0x02748b17, 0x06748b28, 0x02208b01, 0x06208b16,
+        0x02258b01, 0x06258b16, 0x022d8b01, 0x062d8b16, 0x022e8b01, 0x062e8b16,
+        0x022f8b01, 0x062f8b16, 0x02338b01, 0x06338b16, 0x02348b01, 0x06348b16,
+        0x02358b01, 0x06358b16, 0x02368b01, 0x06368b16, 0x02378b01, 0x06378b16,
+        0x02388b01, 0x06388b16, 0x02398b01, 0x06398b16, 0x023d8b01, 0x063d8b16,
+        0x02418b01, 0x06418b16, 0x025f8b01, 0x065f8b16, 0x02628b01, 0x06628b16,
+        0x02648b01, 0x06648b16, 0x02668b01, 0x06668b16, 0x02678b01, 0x06678b16,
+        0x02688b01, 0x06688b16, 0x026c8b01, 0x066c8b16, 0x026d8b01, 0x066d8b16,
+        0x026e8b01, 0x066e8b16, 0x02708b01, 0x06708b16, 0x02728b01, 0x06728b16,
+        0x02758b01, 0x06758b16, 0x063a8b00, 0x06428b00, 0x06438b00, 0x06448b00,
+        0x06458b00, 0x06468b00, 0x06478b00, 0x06488b00, 0x06498b00, 0x064a8b00,
+        0x064b8b00, 0x064c8b00, 0x064d8b00, 0x064e8b00, 0x064f8b00, 0x06508b00,
+        0x06518b00, 0x06528b00, 0x06538b00, 0x06548b00, 0x06558b00, 0x06568b00,
+        0x06578b00, 0x06598b00, 0x066a8b00, 0x066b8b00, 0x06718b00, 0x06768b00,
+        0x06778b00, 0x06788b00, 0x06798b00, 0x067a8b00, 0x01008b46, 0x01008b47,
+        0x01008b49, 0x05008b4a, 0x02308c02, 0x02308c09, 0x02308c17, 0x06308c28,
+        0x02318c02, 0x02318c09, 0x02318c17, 0x06318c28, 0x02328c02, 0x02328c09,
+        0x02328c17, 0x06328c28, 0x02618c02, 0x02618c09, 0x02618c17, 0x06618c28,
+        0x02638c02, 0x02638c09, 0x02638c17, 0x06638c28, 0x02658c02, 0x02658c09,
+        0x02658c17, 0x06658c28, 0x02698c02, 0x02698c09, 0x02698c17, 0x06698c28,
+        0x026f8c02, 0x026f8c09, 0x026f8c17, 0x066f8c28, 0x02738c02, 0x02738c09,
+        0x02738c17, 0x06738c28, 0x02748c02, 0x02748c09, 0x02748c17, 0x06748c28,
+        0x02208c01, 0x06208c16, 0x02258c01, 0x06258c16, 0x022d8c01, 0x062d8c16,
+        0x022e8c01, 0x062e8c16, 0x022f8c01, 0x062f8c16, 0x02338c01, 0x06338c16,
+        0x02348c01, 0x06348c16, 0x02358c01, 0x06358c16, 0x02368c01, 0x06368c16,
+        0x02378c01, 0x06378c16, 0x02388c01, 0x06388c16, 0x02398c01, 0x06398c16,
+        0x023d8c01, 0x063d8c16, 0x02418c01, 0x06418c16, 0x025f8c01, 0x065f8c16,
+        0x02628c01, 0x06628c16, 0x02648c01, 0x06648c16, 0x02668c01, 0x06668c16,
+        0x02678c01, 0x06678c16, 0x02688c01, 0x06688c16, 0x026c8c01, 0x066c8c16,
+        0x026d8c01, 0x066d8c16, 0x026e8c01, 0x066e8c16, 0x02708c01, 0x06708c16,
+        0x02728c01, 0x06728c16, 0x02758c01, 0x06758c16, 0x063a8c00, 0x06428c00,
+        0x06438c00, 0x06448c00, 0x06458c00, 0x06468c00, 0x06478c00, 0x06488c00,
+        0x06498c00, 0x064a8c00, 0x064b8c00, 0x064c8c00, 0x064d8c00, 0x064e8c00,
+        0x064f8c00, 0x06508c00, 0x06518c00, 0x06528c00, 0x06538c00, 0x06548c00,
+        0x06558c00, 0x06568c00, 0x06578c00, 0x06598c00, 0x066a8c00, 0x066b8c00,
+        0x06718c00, 0x06768c00, 0x06778c00, 0x06788c00, 0x06798c00, 0x067a8c00,
+        0x01008c46, 0x01008c47, 0x01008c49, 0x05008c4a
+    },
+    /* 152 */
+    {
+        0x02308d02, 0x02308d09, 0x02308d17, 0x06308d28, 0x02318d02, 0x02318d09,
+        0x02318d17, 0x06318d28, 0x02328d02, 0x02328d09, 0x02328d17, 0x06328d28,
+        0x02618d02, 0x02618d09, 0x02618d17, 0x06618d28, 0x02638d02, 0x02638d09,
+        0x02638d17, 0x06638d28, 0x02658d02, 0x02658d09, 0x02658d17, 0x06658d28,
+        0x02698d02, 0x02698d09, 0x02698d17, 0x06698d28, 0x026f8d02, 0x026f8d09,
+        0x026f8d17, 0x066f8d28, 0x02738d02, 0x02738d09, 0x02738d17, 0x06738d28,
+        0x02748d02, 0x02748d09, 0x02748d17, 0x06748d28, 0x02208d01, 0x06208d16,
+        0x02258d01, 0x06258d16, 0x022d8d01, 0x062d8d16, 0x022e8d01, 0x062e8d16,
+        0x022f8d01, 0x062f8d16, 0x02338d01, 0x06338d16, 0x02348d01, 0x06348d16,
+        0x02358d01, 0x06358d16, 0x02368d01, 0x06368d16, 0x02378d01, 0x06378d16,
+        0x02388d01, 0x06388d16, 0x02398d01, 0x06398d16, 0x023d8d01, 0x063d8d16,
+        0x02418d01, 0x06418d16, 0x025f8d01, 0x065f8d16, 0x02628d01, 0x06628d16,
+        0x02648d01, 0x06648d16, 0x02668d01, 0x06668d16, 0x02678d01, 0x06678d16,
+        0x02688d01, 0x06688d16, 0x026c8d01, 0x066c8d16, 0x026d8d01, 0x066d8d16,
+        0x026e8d01, 0x066e8d16, 0x02708d01, 0x06708d16, 0x02728d01, 0x06728d16,
+        0x02758d01, 0x06758d16, 0x063a8d00, 0x06428d00, 0x06438d00, 0x06448d00,
+        0x06458d00, 0x06468d00, 0x06478d00, 0x06488d00, 0x06498d00, 0x064a8d00,
+        0x064b8d00, 0x064c8d00, 0x064d8d00, 0x064e8d00, 0x064f8d00, 0x06508d00,
+        0x06518d00, 0x06528d00, 0x06538d00, 0x06548d00, 0x06558d00, 0x06568d00,
+        0x06578d00, 0x06598d00, 0x066a8d00, 0x066b8d00, 0x06718d00, 0x06768d00,
+        0x06778d00, 0x06788d00, 0x06798d00, 0x067a8d00, 0x01008d46, 0x01008d47,
+        0x01008d49, 0x05008d4a, 0x02308f02, 0x02308f09, 0x02308f17, 0x06308f28,
+        0x02318f02, 0x02318f09, 0x02318f17, 0x06318f28, 0x02328f02, 0x02328f09,
+        0x02328f17, 0x06328f28, 0x02618f02, 0x02618f09, 0x02618f17, 0x06618f28,
+        0x02638f02, 0x02638f09, 0x02638f17, 0x06638f28, 0x02658f02, 0x02658f09,
+        0x02658f17, 0x06658f28, 0x02698f02, 0x02698f09, 0x02698f17, 0x06698f28,
+        0x026f8f02, 0x026f8f09, 0x026f8f17, 0x066f8f28, 0x02738f02, 0x02738f09,
+        0x02738f17, 0x06738f28, 0x02748f02, 0x02748f09, 0x02748f17, 0x06748f28,
+        0x02208f01, 0x06208f16, 0x02258f01, 0x06258f16, 0x022d8f01, 0x062d8f16,
+        0x022e8f01, 0x062e8f16, 0x022f8f01, 0x062f8f16, 0x02338f01, 0x06338f16,
+        0x02348f01, 0x06348f16, 0x02358f01, 0x06358f16, 0x02368f01, 0x06368f16,
+        0x02378f01, 0x06378f16, 0x02388f01, 0x06388f16, 0x02398f01, 0x06398f16,
+        0x023d8f01, 0x063d8f16, 0x02418f01, 0x06418f16, 0x025f8f01, 0x065f8f16,
+        0x02628f01, 0x06628f16, 0x02648f01, 0x06648f16, 0x02668f01, 0x06668f16,
+        0x02678f01, 0x06678f16, 0x02688f01, 0x06688f16, 0x026c8f01, 0x066c8f16,
+        0x026d8f01, 0x066d8f16, 0x026e8f01, 0x066e8f16, 0x02708f01, 0x06708f16,
+        0x02728f01, 0x06728f16, 0x02758f01, 0x06758f16, 0x063a8f00, 0x06428f00,
+        0x06438f00, 0x06448f00, 0x06458f00, 0x06468f00, 0x06478f00, 0x06488f00,
+        0x06498f00, 0x064a8f00, 0x064b8f00, 0x064c8f00, 0x064d8f00, 0x064e8f00,
+        0x064f8f00, 0x06508f00, 0x06518f00, 0x06528f00, 0x06538f00, 0x06548f00,
+        0x06558f00, 0x06568f00, 0x06578f00, 0x06598f00, 0x066a8f00, 0x066b8f00,
+        0x06718f00, 0x06768f00, 0x06778f00, 0x06788f00, 0x06798f00, 0x067a8f00,
+        0x01008f46, 0x01008f47, 0x01008f49, 0x05008f4a
+    },
+    /* 153 */
+    {
+        0x01009303, 0x01009306, 0x0100930a, 0x0100930f, 0x01009318, 0x0100931f,
+        0x01009329, 0x05009338, 0x01009503, 0x01009506, 0x0100950a, 0x0100950f,
+        0x01009518, 0x0100951f, 0x01009529, 0x05009538, 0x01009603, 0x01009606,
+        0x0100960a, 0x0100960f, 0x01009618, 0x0100961f, 0x01009629, 0x05009638,
+        0x01009703, 0x01009706, 0x0100970a, 0x0100970f, 0x01009718, 0x0100971f,
+        0x01009729, 0x05009738, 0x01009803, 0x01009806, 0x0100980a, 0x0100980f,
+        0x01009818, 0x0100981f, 0x01009829, 0x05009838, 0x01009b03, 0x01009b06,
+        0x01009b0a, 0x01009b0f, 0x01009b18, 0x01009b1f, 0x01009b29, 0x05009b38,
+        0x01009d03, 0x01009d06, 0x01009d0a, 0x01009d0f, 0x01009d18, 0x01009d1f,
+        0x01009d29, 0x05009d38, 0x01009e03, 0x01009e06, 0x01009e0a, 0x01009e0f,
+        0x01009e18, 0x01009e1f, 0x01009e29, 0x05009e38, 0x0100a503, 0x0100a506,
+        0x0100a50a, 0x0100a50f, 0x0100a518, 0x0100a51f, 0x0100a529, 0x0500a538,
+        0x0100a603, 0x0100a606, 0x0100a60a, 0x0100a60f, 0x0100a618, 0x0100a61f,
+        0x0100a629, 0x0500a638, 0x0100a803, 0x0100a806, 0x0100a80a, 0x0100a80f,
+        0x0100a818, 0x0100a81f, 0x0100a829, 0x0500a838, 0x0100ae03, 0x0100ae06,
+        0x0100ae0a, 0x0100ae0f, 0x0100ae18, 0x0100ae1f, 0x0100ae29, 0x0500ae38,
+        0x0100af03, 0x0100af06, 0x0100af0a, 0x0100af0f, 0x0100af18, 0x0100af1f,
+        0x0100af29, 0x0500af38, 0x0100b403, 0x0100b406, 0x0100b40a, 0x0100b40f,
+        0x0100b418, 0x0100b41f, 0x0100b429, 0x0500b438, 0x0100b603, 0x0100b606,
+        0x0100b60a, 0x0100b60f, 0x0100b618, 0x0100b61f, 0x0100b629, 0x0500b638,
+        0x0100b703, 0x0100b706, 0x0100b70a, 0x0100b70f, 0x0100b718, 0x0100b71f,
+        0x0100b729, 0x0500b738, 0x0100bc03, 0x0100bc06, 0x0100bc0a, 0x0100bc0f,
+        0x0100bc18, 0x0100bc1f, 0x0100bc29, 0x0500bc38, 0x0100bf03, 0x0100bf06,
+        0x0100bf0a, 0x0100bf0f, 0x0100bf18, 0x0100bf1f, 0x0100bf29, 0x0500bf38,
+        0x0100c503, 0x0100c506, 0x0100c50a, 0x0100c50f, 0x0100c518, 0x0100c51f,
+        0x0100c529, 0x0500c538, 0x0100e703, 0x0100e706, 0x0100e70a, 0x0100e70f,
+        0x0100e718, 0x0100e71f, 0x0100e729, 0x0500e738, 0x0100ef03, 0x0100ef06,
+        0x0100ef0a, 0x0100ef0f, 0x0100ef18, 0x0100ef1f, 0x0100ef29, 0x0500ef38,
+        0x01000902, 0x01000909, 0x01000917, 0x05000928, 0x01008e02, 0x01008e09,
+        0x01008e17, 0x05008e28, 0x01009002, 0x01009009, 0x01009017, 0x05009028,
+        0x01009102, 0x01009109, 0x01009117, 0x05009128, 0x01009402, 0x01009409,
+        0x01009417, 0x05009428, 0x01009f02, 0x01009f09, 0x01009f17, 0x05009f28,
+        0x0100ab02, 0x0100ab09, 0x0100ab17, 0x0500ab28, 0x0100ce02, 0x0100ce09,
+        0x0100ce17, 0x0500ce28, 0x0100d702, 0x0100d709, 0x0100d717, 0x0500d728,
+        0x0100e102, 0x0100e109, 0x0100e117, 0x0500e128, 0x0100ec02, 0x0100ec09,
+        0x0100ec17, 0x0500ec28, 0x0100ed02, 0x0100ed09, 0x0100ed17, 0x0500ed28,
+        0x0100c701, 0x0500c716, 0x0100cf01, 0x0500cf16, 0x0100ea01, 0x0500ea16,
+        0x0100eb01, 0x0500eb16, 0x0500c000, 0x0500c100, 0x0500c800, 0x0500c900,
+        0x0500ca00, 0x0500cd00, 0x0500d200, 0x0500d500, 0x0500da00, 0x0500db00,
+        0x0500ee00, 0x0500f000, 0x0500f200, 0x0500f300, 0x0500ff00, 0x000000ce,
+        0x000000d3, 0x000000d4, 0x000000d6, 0x000000d7, 0x000000da, 0x000000db,
+        0x000000dd, 0x000000de, 0x000000e2, 0x000000e4, 0x000000e8, 0x000000eb,
+        0x000000f0, 0x000000f3, 0x000000f7, 0x040000fa
+    },
+    /* 154 */
+    {
+        0x01009304, 0x01009305, 0x01009307, 0x01009308, 0x0100930b, 0x0100930c,
+        0x01009310, 0x01009313, 0x01009319, 0x0100931c, 0x01009320, 0x01009323,
+        0x0100932a, 0x01009331, 0x01009339, 0x05009340, 0x01009504, 0x01009505,
+        0x01009507, 0x01009508, 0x0100950b, 0x0100950c, 0x01009510, 0x01009513,
+        0x01009519, 0x0100951c, 0x01009520, 0x01009523, 0x0100952a, 0x01009531,
+        0x01009539, 0x05009540, 0x01009604, 0x01009605, 0x01009607, 0x01009608,
+        0x0100960b, 0x0100960c, 0x01009610, 0x01009613, 0x01009619, 0x0100961c,
+        0x01009620, 0x01009623, 0x0100962a, 0x01009631, 0x01009639, 0x05009640,
+        0x01009704, 0x01009705, 0x01009707, 0x01009708, 0x0100970b, 0x0100970c,
+        0x01009710, 0x01009713, 0x01009719, 0x0100971c, 0x01009720, 0x01009723,
+        0x0100972a, 0x01009731, 0x01009739, 0x05009740, 0x01009804, 0x01009805,
+        0x01009807, 0x01009808, 0x0100980b, 0x0100980c, 0x01009810, 0x01009813,
+        0x01009819, 0x0100981c, 0x01009820, 0x01009823, 0x0100982a, 0x01009831,
+        0x01009839, 0x05009840, 0x01009b04, 0x01009b05, 0x01009b07, 0x01009b08,
+        0x01009b0b, 0x01009b0c, 0x01009b10, 0x01009b13, 0x01009b19, 0x01009b1c,
+        0x01009b20, 0x01009b23, 0x01009b2a, 0x01009b31, 0x01009b39, 0x05009b40,
+        0x01009d04, 0x01009d05, 0x01009d07, 0x01009d08, 0x01009d0b, 0x01009d0c,
+        0x01009d10, 0x01009d13, 0x01009d19, 0x01009d1c, 0x01009d20, 0x01009d23,
+        0x01009d2a, 0x01009d31, 0x01009d39, 0x05009d40, 0x01009e04, 0x01009e05,
+        0x01009e07, 0x01009e08, 0x01009e0b, 0x01009e0c, 0x01009e10, 0x01009e13,
+        0x01009e19, 0x01009e1c, 0x01009e20, 0x01009e23, 0x01009e2a, 0x01009e31,
+        0x01009e39, 0x05009e40, 0x0100a504, 0x0100a505, 0x0100a507, 0x0100a508,
+        0x0100a50b, 0x0100a50c, 0x0100a510, 0x0100a513, 0x0100a519, 0x0100a51c,
+        0x0100a520, 0x0100a523, 0x0100a52a, 0x0100a531, 0x0100a539, 0x0500a540,
+        0x0100a604, 0x0100a605, 0x0100a607, 0x0100a608, 0x0100a60b, 0x0100a60c,
+        0x0100a610, 0x0100a613, 0x0100a619, 0x0100a61c, 0x0100a620, 0x0100a623,
+        0x0100a62a, 0x0100a631, 0x0100a639, 0x0500a640, 0x0100a804, 0x0100a805,
+        0x0100a807, 0x0100a808, 0x0100a80b, 0x0100a80c, 0x0100a810, 0x0100a813,
+        0x0100a819, 0x0100a81c, 0x0100a820, 0x0100a823, 0x0100a82a, 0x0100a831,
+        0x0100a839, 0x0500a840, 0x0100ae04, 0x0100ae05, 0x0100ae07, 0x0100ae08,
+        0x0100ae0b, 0x0100ae0c, 0x0100ae10, 0x0100ae13, 0x0100ae19, 0x0100ae1c,
+        0x0100ae20, 0x0100ae23, 0x0100ae2a, 0x0100ae31, 0x0100ae39, 0x0500ae40,
+        0x0100af04, 0x0100af05, 0x0100af07, 0x0100af08, 0x0100af0b, 0x0100af0c,
+        0x0100af10, 0x0100af13, 0x0100af19, 0x0100af1c, 0x0100af20, 0x0100af23,
+        0x0100af2a, 0x0100af31, 0x0100af39, 0x0500af40, 0x0100b404, 0x0100b405,
+        0x0100b407, 0x0100b408, 0x0100b40b, 0x0100b40c, 0x0100b410, 0x0100b413,
+        0x0100b419, 0x0100b41c, 0x0100b420, 0x0100b423, 0x0100b42a, 0x0100b431,
+        0x0100b439, 0x0500b440, 0x0100b604, 0x0100b605, 0x0100b607, 0x0100b608,
+        0x0100b60b, 0x0100b60c, 0x0100b610, 0x0100b613, 0x0100b619, 0x0100b61c,
+        0x0100b620, 0x0100b623, 0x0100b62a, 0x0100b631, 0x0100b639, 0x0500b640,
+        0x0100b704, 0x0100b705, 0x0100b707, 0x0100b708, 0x0100b70b, 0x0100b70c,
+        0x0100b710, 0x0100b713, 0x0100b719, 0x0100b71c, 0x0100b720, 0x0100b723,
+        0x0100b72a, 0x0100b731, 0x0100b739, 0x0500b740
+    },
+    /* 155 */
+    {
+        0x06309300, 0x06319300, 0x06329300, 0x06619300, 0x06639300, 0x06659300,
+        0x06699300, 0x066f9300, 0x06739300, 0x06749300, 0x0100930d, 0x0100930e,
+        0x01009311, 0x01009312, 0x01009314, 0x01009315, 0x0100931a, 0x0100931b,
+        0x0100931d, 0x0100931e, 0x01009321, 0x01009322, 0x01009324, 0x01009325,
+        0x0100932b, 0x0100932e, 0x01009332, 0x01009335, 0x0100933a, 0x0100933d,
+        0x01009341, 0x05009344, 0x06309500, 0x06319500, 0x06329500, 0x06619500,
+        0x06639500, 0x06659500, 0x06699500, 0x066f9500, 0x06739500, 0x06749500,
+        0x0100950d, 0x0100950e, 0x01009511, 0x01009512, 0x01009514, 0x01009515,
+        0x0100951a, 0x0100951b, 0x0100951d, 0x0100951e, 0x01009521, 0x01009522,
+        0x01009524, 0x01009525, 0x0100952b, 0x0100952e, 0x01009532, 0x01009535,
+        0x0100953a, 0x0100953d, 0x01009541, 0x05009544, 0x06309600, 0x06319600,
+        0x06329600, 0x06619600, 0x06639600, 0x06659600, 0x06699600, 0x066f9600,
+        0x06739600, 0x06749600, 0x0100960d, 0x0100960e, 0x01009611, 0x01009612,
+        0x01009614, 0x01009615, 0x0100961a, 0x0100961b, 0x0100961d, 0x0100961e,
+        0x01009621, 0x01009622, 0x01009624, 0x01009625, 0x0100962b, 0x0100962e,
+        0x01009632, 0x01009635, 0x0100963a, 0x0100963d, 0x01009641, 0x05009644,
+        0x06309700, 0x06319700, 0x06329700, 0x06619700, 0x06639700, 0x06659700,
+        0x06699700, 0x066f9700, 0x06739700, 0x06749700, 0x0100970d, 0x0100970e,
+        0x01009711, 0x01009712, 0x01009714, 0x01009715, 0x0100971a, 0x0100971b,
+        0x0100971d, 0x0100971e, 0x01009721, 0x01009722, 0x01009724, 0x01009725,
+        0x0100972b, 0x0100972e, 0x01009732, 0x01009735, 0x0100973a, 0x0100973d,
+        0x01009741, 0x05009744, 0x06309800, 0x06319800, 0x06329800, 0x06619800,
+        0x06639800, 0x06659800, 0x06699800, 0x066f9800, 0x06739800, 0x06749800,
+        0x0100980d, 0x0100980e, 0x01009811, 0x01009812, 0x01009814, 0x01009815,
+        0x0100981a, 0x0100981b, 0x0100981d, 0x0100981e, 0x01009821, 0x01009822,
+        0x01009824, 0x01009825, 0x0100982b, 0x0100982e, 0x01009832, 0x01009835,
+        0x0100983a, 0x0100983d, 0x01009841, 0x05009844, 0x06309b00, 0x06319b00,
+        0x06329b00, 0x06619b00, 0x06639b00, 0x06659b00, 0x06699b00, 0x066f9b00,
+        0x06739b00, 0x06749b00, 0x01009b0d, 0x01009b0e, 0x01009b11, 0x01009b12,
+        0x01009b14, 0x01009b15, 0x01009b1a, 0x01009b1b, 0x01009b1d, 0x01009b1e,
+        0x01009b21, 0x01009b22, 0x01009b24, 0x01009b25, 0x01009b2b, 0x01009b2e,
+        0x01009b32, 0x01009b35, 0x01009b3a, 0x01009b3d, 0x01009b41, 0x05009b44,
+        0x06309d00, 0x06319d00, 0x06329d00, 0x06619d00, 0x06639d00, 0x06659d00,
+        0x06699d00, 0x066f9d00, 0x06739d00, 0x06749d00, 0x01009d0d, 0x01009d0e,
+        0x01009d11, 0x01009d12, 0x01009d14, 0x01009d15, 0x01009d1a, 0x01009d1b,
+        0x01009d1d, 0x01009d1e, 0x01009d21, 0x01009d22, 0x01009d24, 0x01009d25,
+        0x01009d2b, 0x01009d2e, 0x01009d32, 0x01009d35, 0x01009d3a, 0x01009d3d,
+        0x01009d41, 0x05009d44, 0x06309e00, 0x06319e00, 0x06329e00, 0x06619e00,
+        0x06639e00, 0x06659e00, 0x06699e00, 0x066f9e00, 0x06739e00, 0x06749e00,
+        0x01009e0d, 0x01009e0e, 0x01009e11, 0x01009e12, 0x01009e14, 0x01009e15,
+        0x01009e1a, 0x01009e1b, 0x01009e1d, 0x01009e1e, 0x01009e21, 0x01009e22,
+        0x01009e24, 0x01009e25, 0x01009e2b, 0x01009e2e, 0x01009e32, 0x01009e35,
+        0x01009e3a, 0x01009e3d, 0x01009e41, 0x05009e44
+    },
+    /* 156 */
+    {
+        0x02309301, 0x06309316, 0x02319301, 0x06319316, 0x02329301, 0x06329316,
+        0x02619301, 0x06619316, 0x02639301, 0x06639316, 0x02659301, 0x06659316,
+        0x02699301, 0x06699316, 0x026f9301, 0x066f9316, 0x02739301, 0x06739316,
+        0x02749301, 0x06749316, 0x06209300, 0x06259300, 0x062d9300, 0x062e9300,
+        0x062f9300, 0x06339300, 0x06349300, 0x06359300, 0x06369300, 0x06379300,
+        0x06389300, 0x06399300, 0x063d9300, 0x06419300, 0x065f9300, 0x06629300,
+        0x06649300, 0x06669300, 0x06679300, 0x06689300, 0x066c9300, 0x066d9300,
+        0x066e9300, 0x06709300, 0x06729300, 0x06759300, 0x01009326, 0x01009327,
+        0x0100932c, 0x0100932d, 0x0100932f, 0x01009330, 0x01009333, 0x01009334,
+        0x01009336, 0x01009337, 0x0100933b, 0x0100933c, 0x0100933e, 0x0100933f,
+        0x01009342, 0x01009343, 0x01009345, 0x05009348, 0x02309501, 0x06309516,
+        0x02319501, 0x06319516, 0x02329501, 0x06329516, 0x02619501, 0x06619516,
+        0x02639501, 0x06639516, 0x02659501, 0x06659516, 0x02699501, 0x06699516,
+        0x026f9501, 0x066f9516, 0x02739501, 0x06739516, 0x02749501, 0x06749516,
+        0x06209500, 0x06259500, 0x062d9500, 0x062e9500, 0x062f9500, 0x06339500,
+        0x06349500, 0x06359500, 0x06369500, 0x06379500, 0x06389500, 0x06399500,
+        0x063d9500, 0x06419500, 0x065f9500, 0x06629500, 0x06649500, 0x06669500,
+        0x06679500, 0x06689500, 0x066c9500, 0x066d9500, 0x066e9500, 0x06709500,
+        0x06729500, 0x06759500, 0x01009526, 0x01009527, 0x0100952c, 0x0100952d,
+        0x0100952f, 0x01009530, 0x01009533, 0x01009534, 0x01009536, 0x01009537,
+        0x0100953b, 0x0100953c, 0x0100953e, 0x0100953f, 0x01009542, 0x01009543,
+        0x01009545, 0x05009548, 0x02309601, 0x06309616, 0x02319601, 0x06319616,
+        0x02329601, 0x06329616, 0x02619601, 0x06619616, 0x02639601, 0x06639616,
+        0x02659601, 0x06659616, 0x02699601, 0x06699616, 0x026f9601, 0x066f9616,
+        0x02739601, 0x06739616, 0x02749601, 0x06749616, 0x06209600, 0x06259600,
+        0x062d9600, 0x062e9600, 0x062f9600, 0x06339600, 0x06349600, 0x06359600,
+        0x06369600, 0x06379600, 0x06389600, 0x06399600, 0x063d9600, 0x06419600,
+        0x065f9600, 0x06629600, 0x06649600, 0x06669600, 0x06679600, 0x06689600,
+        0x066c9600, 0x066d9600, 0x066e9600, 0x06709600, 0x06729600, 0x06759600,
+        0x01009626, 0x01009627, 0x0100962c, 0x0100962d, 0x0100962f, 0x01009630,
+        0x01009633, 0x01009634, 0x01009636, 0x01009637, 0x0100963b, 0x0100963c,
+        0x0100963e, 0x0100963f, 0x01009642, 0x01009643, 0x01009645, 0x05009648,
+        0x02309701, 0x06309716, 0x02319701, 0x06319716, 0x02329701, 0x06329716,
+        0x02619701, 0x06619716, 0x02639701, 0x06639716, 0x02659701, 0x06659716,
+        0x02699701, 0x06699716, 0x026f9701, 0x066f9716, 0x02739701, 0x06739716,
+        0x02749701, 0x06749716, 0x06209700, 0x06259700, 0x062d9700, 0x062e9700,
+        0x062f9700, 0x06339700, 0x06349700, 0x06359700, 0x06369700, 0x06379700,
+        0x06389700, 0x06399700, 0x063d9700, 0x06419700, 0x065f9700, 0x06629700,
+        0x06649700, 0x06669700, 0x06679700, 0x06689700, 0x066c9700, 0x066d9700,
+        0x066e9700, 0x06709700, 0x06729700, 0x06759700, 0x01009726, 0x01009727,
+        0x0100972c, 0x0100972d, 0x0100972f, 0x01009730, 0x01009733, 0x01009734,
+        0x01009736, 0x01009737, 0x0100973b, 0x0100973c, 0x0100973e, 0x0100973f,
+        0x01009742, 0x01009743, 0x01009745, 0x05009748
+    },
+    /* 157 */
+    {
+        0x02309302, 0x02309309, 0x02309317, 0x06309328, 0x02319302, 0x02319309,
+        0x02319317, 0x06319328, 0x02329302, 0x02329309, 0x02329317, 0x06329328,
+        0x02619302, 0x02619309, 0x02619317, 0x06619328, 0x02639302, 0x02639309,
+        0x02639317, 0x06639328, 0x02659302, 0x02659309, 0x02659317, 0x06659328,
+        0x02699302, 0x02699309, 0x02699317, 0x06699328, 0x026f9302, 0x026f9309,
+        0x026f9317, 0x066f9328, 0x02739302, 0x02739309, 0x02739317, 0x06739328,
+        0x02749302, 0x02749309, 0x02749317, 0x06749328, 0x02209301, 0x06209316,
+        0x02259301, 0x06259316, 0x022d9301, 0x062d9316, 0x022e9301, 0x062e9316,
+        0x022f9301, 0x062f9316, 0x02339301, 0x06339316, 0x02349301, 0x06349316,
+        0x02359301, 0x06359316, 0x02369301, 0x06369316, 0x02379301, 0x06379316,
+        0x02389301, 0x06389316, 0x02399301, 0x06399316, 0x023d9301, 0x063d9316,
+        0x02419301, 0x06419316, 0x025f9301, 0x065f9316, 0x02629301, 0x06629316,
+        0x02649301, 0x06649316, 0x02669301, 0x06669316, 0x02679301, 0x06679316,
+        0x02689301, 0x06689316, 0x026c9301, 0x066c9316, 0x026d9301, 0x066d9316,
+        0x026e9301, 0x066e9316, 0x02709301, 0x06709316, 0x02729301, 0x06729316,
+        0x02759301, 0x06759316, 0x063a9300, 0x06429300, 0x06439300, 0x06449300,
+        0x06459300, 0x06469300, 0x06479300, 0x06489300, 0x06499300, 0x064a9300,
+        0x064b9300, 0x064c9300, 0x064d9300, 0x064e9300, 0x064f9300, 0x06509300,
+        0x06519300, 0x06529300, 0x06539300, 0x06549300, 0x06559300, 0x06569300,
+        0x06579300, 0x06599300, 0x066a9300, 0x066b9300, 0x06719300, 0x06769300,
+        0x06779300, 0x06789300, 0x06799300, 0x067a9300, 0x01009346, 0x01009347,
+        0x01009349, 0x0500934a, 0x02309502, 0x02309509, 0x02309517, 0x06309528,
+        0x02319502, 0x02319509, 0x02319517, 0x06319528, 0x02329502, 0x02329509,
+        0x02329517, 0x06329528, 0x02619502, 0x02619509, 0x02619517, 0x06619528,
+        0x02639502, 0x02639509, 0x02639517, 0x06639528, 0x02659502, 0x02659509,
+        0x02659517, 0x06659528, 0x02699502, 0x02699509, 0x02699517, 0x06699528,
+        0x026f9502, 0x026f9509, 0x026f9517, 0x066f9528, 0x02739502, 0x02739509,
+        0x02739517, 0x06739528, 0x02749502, 0x02749509, 0x02749517, 0x06749528,
+        0x02209501, 0x06209516, 0x02259501, 0x06259516, 0x022d9501, 0x062d9516,
+        0x022e9501, 0x062e9516, 0x022f9501, 0x062f9516, 0x02339501, 0x06339516,
+        0x02349501, 0x06349516, 0x02359501, 0x06359516, 0x02369501, 0x06369516,
+        0x02379501, 0x06379516, 0x02389501, 0x06389516, 0x02399501, 0x06399516,
+        0x023d9501, 0x063d9516, 0x02419501, 0x06419516, 0x025f9501, 0x065f9516,
+        0x02629501, 0x06629516, 0x02649501, 0x06649516, 0x02669501, 0x06669516,
+        0x02679501, 0x06679516, 0x02689501, 0x06689516, 0x026c9501, 0x066c9516,
+        0x026d9501, 0x066d9516, 0x026e9501, 0x066e9516, 0x02709501, 0x06709516,
+        0x02729501, 0x06729516, 0x02759501, 0x06759516, 0x063a9500, 0x06429500,
+        0x06439500, 0x06449500, 0x06459500, 0x06469500, 0x06479500, 0x06489500,
+        0x06499500, 0x064a9500, 0x064b9500, 0x064c9500, 0x064d9500, 0x064e9500,
+        0x064f9500, 0x06509500, 0x06519500, 0x06529500, 0x06539500, 0x06549500,
+        0x06559500, 0x06569500, 0x06579500, 0x06599500, 0x066a9500, 0x066b9500,
+        0x06719500, 0x06769500, 0x06779500, 0x06789500, 0x06799500, 0x067a9500,
+        0x01009546, 0x01009547, 0x01009549, 0x0500954a
+    },
+    /* 158 */
+    {
+        0x02309602, 0x02309609, 0x02309617, 0x06309628, 0x02319602, 0x02319609,
+        0x02319617, 0x06319628, 0x02329602, 0x02329609, 0x02329617, 0x06329628,
+        0x02619602, 0x02619609, 0x02619617, 0x06619628, 0x02639602, 0x02639609,
+        0x02639617, 0x06639628, 0x02659602, 0x02659609, 0x02659617, 0x06659628,
+        0x02699602, 0x02699609, 0x02699617, 0x06699628, 0x026f9602, 0x026f9609,
+        0x026f9617, 0x066f9628, 0x02739602, 0x02739609, 0x02739617, 0x06739628,
+        0x02749602, 0x02749609, 0x02749617, 0x06749628, 0x02209601, 0x06209616,
+        0x02259601, 0x06259616, 0x022d9601, 0x062d9616, 0x022e9601, 0x062e9616,
+        0x022f9601, 0x062f9616, 0x02339601, 0x06339616, 0x02349601, 0x06349616,
+        0x02359601, 0x06359616, 0x02369601, 0x06369616, 0x02379601, 0x06379616,
+        0x02389601, 0x06389616, 0x02399601, 0x06399616, 0x023d9601, 0x063d9616,
+        0x02419601, 0x06419616, 0x025f9601, 0x065f9616, 0x02629601, 0x06629616,
+        0x02649601, 0x06649616, 0x02669601, 0x06669616, 0x02679601, 0x06679616,
+        0x02689601, 0x06689616, 0x026c9601, 0x066c9616, 0x026d9601, 0x066d9616,
+        0x026e9601, 0x066e9616, 0x02709601, 0x06709616, 0x02729601, 0x06729616,
+        0x02759601, 0x06759616, 0x063a9600, 0x06429600, 0x06439600, 0x06449600,
+        0x06459600, 0x06469600, 0x06479600, 0x06489600, 0x06499600, 0x064a9600,
+        0x064b9600, 0x064c9600, 0x064d9600, 0x064e9600, 0x064f9600, 0x06509600,
+        0x06519600, 0x06529600, 0x06539600, 0x06549600, 0x06559600, 0x06569600,
+        0x06579600, 0x06599600, 0x066a9600, 0x066b9600, 0x06719600, 0x06769600,
+        0x06779600, 0x06789600, 0x06799600, 0x067a9600, 0x01009646, 0x01009647,
+        0x01009649, 0x0500964a, 0x02309702, 0x02309709, 0x02309717, 0x06309728,
+        0x02319702, 0x02319709, 0x02319717, 0x06319728, 0x02329702, 0x02329709,
+        0x02329717, 0x06329728, 0x02619702, 0x02619709, 0x02619717, 0x06619728,
+        0x02639702, 0x02639709, 0x02639717, 0x06639728, 0x02659702, 0x02659709,
+        0x02659717, 0x06659728, 0x02699702, 0x02699709, 0x02699717, 0x06699728,
+        0x026f9702, 0x026f9709, 0x026f9717, 0x066f9728, 0x02739702, 0x02739709,
+        0x02739717, 0x06739728, 0x02749702, 0x02749709, 0x02749717, 0x06749728,
+        0x02209701, 0x06209716, 0x02259701, 0x06259716, 0x022d9701, 0x062d9716,
+        0x022e9701, 0x062e9716, 0x022f9701, 0x062f9716, 0x02339701, 0x06339716,
+        0x02349701, 0x06349716, 0x02359701, 0x06359716, 0x02369701, 0x06369716,
+        0x02379701, 0x06379716, 0x02389701, 0x06389716, 0x02399701, 0x06399716,
+        0x023d9701, 0x063d9716, 0x02419701, 0x06419716, 0x025f9701, 0x065f9716,
+        0x02629701, 0x06629716, 0x02649701, 0x06649716, 0x02669701, 0x06669716,
+        0x02679701, 0x06679716, 0x02689701, 0x06689716, 0x026c9701, 0x066c9716,
+        0x026d9701, 0x066d9716, 0x026e9701, 0x066e9716, 0x02709701, 0x06709716,
+        0x02729701, 0x06729716, 0x02759701, 0x06759716, 0x063a9700, 0x06429700,
+        0x06439700, 0x06449700, 0x06459700, 0x06469700, 0x06479700, 0x06489700,
+        0x06499700, 0x064a9700, 0x064b9700, 0x064c9700, 0x064d9700, 0x064e9700,
+        0x064f9700, 0x06509700, 0x06519700, 0x06529700, 0x06539700, 0x06549700,
+        0x06559700, 0x06569700, 0x06579700, 0x06599700, 0x066a9700, 0x066b9700,
+        0x06719700, 0x06769700, 0x06779700, 0x06789700, 0x06799700, 0x067a9700,
+        0x01009746, 0x01009747, 0x01009749, 0x0500974a
+    },
+    /* 159 */
+    {
+        0x02309801, 0x06309816, 0x02319801, 0x06319816, 0x02329801, 0x06329816,
+        0x02619801, 0x06619816, 0x02639801, 0x06639816, 0x02659801, 0x06659816,
+        0x02699801, 0x06699816, 0x026f9801, 0x066f9816, 0x02739801, 0x06739816,
+        0x02749801, 0x06749816, 0x06209800, 0x06259800, 0x062d9800, 0x062e9800,
+        0x062f9800, 0x06339800, 0x06349800, 0x06359800, 0x06369800, 0x06379800,
+        0x06389800, 0x06399800, 0x063d9800, 0x06419800, 0x065f9800, 0x06629800,
+        0x06649800, 0x06669800, 0x06679800, 0x06689800, 0x066c9800, 0x066d9800,
+        0x066e9800, 0x06709800, 0x06729800, 0x06759800, 0x01009826, 0x01009827,
+        0x0100982c, 0x0100982d, 0x0100982f, 0x01009830, 0x01009833, 0x01009834,
+        0x01009836, 0x01009837, 0x0100983b, 0x0100983c, 0x0100983e, 0x0100983f,
+        0x01009842, 0x01009843, 0x01009845, 0x05009848, 0x02309b01, 0x06309b16,
+        0x02319b01, 0x06319b16, 0x02329b01, 0x06329b16, 0x02619b01, 0x06619b16,
+        0x02639b01, 0x06639b16, 0x02659b01, 0x06659b16, 0x02699b01, 0x06699b16,
+        0x026f9b01, 0x066f9b16, 0x02739b01, 0x06739b16, 0x02749b01, 0x06749b16,
+        0x06209b00, 0x06259b00, 0x062d9b00, 0x062e9b00, 0x062f9b00, 0x06339b00,
+        0x06349b00, 0x06359b00, 0x06369b00, 0x06379b00, 0x06389b00, 0x06399b00,
+        0x063d9b00, 0x06419b00, 0x065f9b00, 0x06629b00, 0x06649b00, 0x06669b00,
+        0x06679b00, 0x06689b00, 0x066c9b00, 0x066d9b00, 0x066e9b00, 0x06709b00,
+        0x06729b00, 0x06759b00, 0x01009b26, 0x01009b27, 0x01009b2c, 0x01009b2d,
+        0x01009b2f, 0x01009b30, 0x01009b33, 0x01009b34, 0x01009b36, 0x01009b37,
+        0x01009b3b, 0x01009b3c, 0x01009b3e, 0x01009b3f, 0x01009b42, 0x01009b43,
+        0x01009b45, 0x05009b48, 0x02309d01, 0x06309d16, 0x02319d01, 0x06319d16,
+        0x02329d01, 0x06329d16, 0x02619d01, 0x06619d16, 0x02639d01, 0x06639d16,
+        0x02659d01, 0x06659d16, 0x02699d01, 0x06699d16, 0x026f9d01, 0x066f9d16,
+        0x02739d01, 0x06739d16, 0x02749d01, 0x06749d16, 0x06209d00, 0x06259d00,
+        0x062d9d00, 0x062e9d00, 0x062f9d00, 0x06339d00, 0x06349d00, 0x06359d00,
+        0x06369d00, 0x06379d00, 0x06389d00, 0x06399d00, 0x063d9d00, 0x06419d00,
+        0x065f9d00, 0x06629d00, 0x06649d00, 0x06669d00, 0x06679d00, 0x06689d00,
+        0x066c9d00, 0x066d9d00, 0x066e9d00, 0x06709d00, 0x06729d00, 0x06759d00,
+        0x01009d26, 0x01009d27, 0x01009d2c, 0x01009d2d, 0x01009d2f, 0x01009d30,
+        0x01009d33, 0x01009d34, 0x01009d36, 0x01009d37, 0x01009d3b, 0x01009d3c,
+        0x01009d3e, 0x01009d3f, 0x01009d42, 0x01009d43, 0x01009d45, 0x05009d48,
+        0x02309e01, 0x06309e16, 0x02319e01, 0x06319e16, 0x02329e01, 0x06329e16,
+        0x02619e01, 0x06619e16, 0x02639e01, 0x06639e16, 0x02659e01, 0x06659e16,
+        0x02699e01, 0x06699e16, 0x026f9e01, 0x066f9e16, 0x02739e01, 0x06739e16,
+        0x02749e01, 0x06749e16, 0x06209e00, 0x06259e00, 0x062d9e00, 0x062e9e00,
+        0x062f9e00, 0x06339e00, 0x06349e00, 0x06359e00, 0x06369e00, 0x06379e00,
+        0x06389e00, 0x06399e00, 0x063d9e00, 0x06419e00, 0x065f9e00, 0x06629e00,
+        0x06649e00, 0x06669e00, 0x06679e00, 0x06689e00, 0x066c9e00, 0x066d9e00,
+        0x066e9e00, 0x06709e00, 0x06729e00, 0x06759e00, 0x01009e26, 0x01009e27,
+        0x01009e2c, 0x01009e2d, 0x01009e2f, 0x01009e30, 0x01009e33, 0x01009e34,
+        0x01009e36, 0x01009e37, 0x01009e3b, 0x01009e3c, 0x01009e3e, 0x01009e3f,
+        0x01009e42, 0x01009e43, 0x01009e45, 0x05009e48
+    },
+    /* 160 */
+    {
+        0x02309802, 0x02309809, 0x02309817, 0x06309828, 0x02319802, 0x02319809,
+        0x02319817, 0x06319828, 0x02329802, 0x02329809, 0x02329817, 0x06329828,
+        0x02619802, 0x02619809, 0x02619817, 0x06619828, 0x02639802, 0x02639809,
+        0x02639817, 0x06639828, 0x02659802, 0x02659809, 0x02659817, 0x06659828,
+        0x02699802, 0x02699809, 0x02699817, 0x06699828, 0x026f9802, 0x026f9809,
+        0x026f9817, 0x066f9828, 0x02739802, 0x02739809, 0x02739817, 0x06739828,
+        0x02749802, 0x02749809, 0x02749817, 0x06749828, 0x02209801, 0x06209816,
+        0x02259801, 0x06259816, 0x022d9801, 0x062d9816, 0x022e9801, 0x062e9816,
+        0x022f9801, 0x062f9816, 0x02339801, 0x06339816, 0x02349801, 0x06349816,
+        0x02359801, 0x06359816, 0x02369801, 0x06369816, 0x02379801, 0x06379816,
+        0x02389801, 0x06389816, 0x02399801, 0x06399816, 0x023d9801, 0x063d9816,
+        0x02419801, 0x06419816, 0x025f9801, 0x065f9816, 0x02629801, 0x06629816,
+        0x02649801, 0x06649816, 0x02669801, 0x06669816, 0x02679801, 0x06679816,
+        0x02689801, 0x06689816, 0x026c9801, 0x066c9816, 0x026d9801, 0x066d9816,
+        0x026e9801, 0x066e9816, 0x02709801, 0x06709816, 0x02729801, 0x06729816,
+        0x02759801, 0x06759816, 0x063a9800, 0x06429800, 0x06439800, 0x06449800,
+        0x06459800, 0x06469800, 0x06479800, 0x06489800, 0x06499800, 0x064a9800,
+        0x064b9800, 0x064c9800, 0x064d9800, 0x064e9800, 0x064f9800, 0x06509800,
+        0x06519800, 0x06529800, 0x06539800, 0x06549800, 0x06559800, 0x06569800,
+        0x06579800, 0x06599800, 0x066a9800, 0x066b9800, 0x06719800, 0x06769800,
+        0x06779800, 0x06789800, 0x06799800, 0x067a9800, 0x01009846, 0x01009847,
+        0x01009849, 0x0500984a, 0x02309b02, 0x02309b09, 0x02309b17, 0x06309b28,
+        0x02319b02, 0x02319b09, 0x02319b17, 0x06319b28, 0x02329b02, 0x02329b09,
+        0x02329b17, 0x06329b28, 0x02619b02, 0x02619b09, 0x02619b17, 0x06619b28,
+        0x02639b02, 0x02639b09, 0x02639b17, 0x06639b28, 0x02659b02, 0x02659b09,
+        0x02659b17, 0x06659b28, 0x02699b02, 0x02699b09, 0x02699b17, 0x06699b28,
+        0x026f9b02, 0x026f9b09, 0x026f9b17, 0x066f9b28, 0x02739b02, 0x02739b09,
+        0x02739b17, 0x06739b28, 0x02749b02, 0x02749b09, 0x02749b17, 0x06749b28,
+        0x02209b01, 0x06209b16, 0x02259b01, 0x06259b16, 0x022d9b01, 0x062d9b16,
+        0x022e9b01, 0x062e9b16, 0x022f9b01, 0x062f9b16, 0x02339b01, 0x06339b16,
+        0x02349b01, 0x06349b16, 0x02359b01, 0x06359b16, 0x02369b01, 0x06369b16,
+        0x02379b01, 0x06379b16, 0x02389b01, 0x06389b16, 0x02399b01, 0x06399b16,
+        0x023d9b01, 0x063d9b16, 0x02419b01, 0x06419b16, 0x025f9b01, 0x065f9b16,
+        0x02629b01, 0x06629b16, 0x02649b01, 0x06649b16, 0x02669b01, 0x06669b16,
+        0x02679b01, 0x06679b16, 0x02689b01, 0x06689b16, 0x026c9b01, 0x066c9b16,
+        0x026d9b01, 0x066d9b16, 0x026e9b01, 0x066e9b16, 0x02709b01, 0x06709b16,
+        0x02729b01, 0x06729b16, 0x02759b01, 0x06759b16, 0x063a9b00, 0x06429b00,
+        0x06439b00, 0x06449b00, 0x06459b00, 0x06469b00, 0x06479b00, 0x06489b00,
+        0x06499b00, 0x064a9b00, 0x064b9b00, 0x064c9b00, 0x064d9b00, 0x064e9b00,
+        0x064f9b00, 0x06509b00, 0x06519b00, 0x06529b00, 0x06539b00, 0x06549b00,
+        0x06559b00, 0x06569b00, 0x06579b00, 0x06599b00, 0x066a9b00, 0x066b9b00,
+        0x06719b00, 0x06769b00, 0x06779b00, 0x06789b00, 0x06799b00, 0x067a9b00,
+        0x01009b46, 0x01009b47, 0x01009b49, 0x05009b4a
+    },
+    /* 161 */
+    {
+        0x02309d02, 0x02309d09, 0x02309d17, 0x06309d28, 0x02319d02, 0x02319d09,
+        0x02319d17, 0x06319d28, 0x02329d02, 0x02329d09, 0x02329d17, 0x06329d28,
+        0x02619d02, 0x02619d09, 0x02619d17, 0x06619d28, 0x02639d02, 0x02639d09,
+        0x02639d17, 0x06639d28, 0x02659d02, 0x02659d09, 0x02659d17, 0x06659d28,
+        0x02699d02, 0x02699d09, 0x02699d17, 0x06699d28, 0x026f9d02, 0x026f9d09,
+        0x026f9d17, 0x066f9d28, 0x02739d02, 0x02739d09, 0x02739d17, 0x06739d28,
+        0x02749d02, 0x02749d09, 0x02749d17, 0x06749d28, 0x02209d01, 0x06209d16,
+        0x02259d01, 0x06259d16, 0x022d9d01, 0x062d9d16, 0x022e9d01, 0x062e9d16,
+        0x022f9d01, 0x062f9d16, 0x02339d01, 0x06339d16, 0x02349d01, 0x06349d16,
+        0x02359d01, 0x06359d16, 0x02369d01, 0x06369d16, 0x02379d01, 0x06379d16,
+        0x02389d01, 0x06389d16, 0x02399d01, 0x06399d16, 0x023d9d01, 0x063d9d16,
+        0x02419d01, 0x06419d16, 0x025f9d01, 0x065f9d16, 0x02629d01, 0x06629d16,
+        0x02649d01, 0x06649d16, 0x02669d01, 0x06669d16, 0x02679d01, 0x06679d16,
+        0x02689d01, 0x06689d16, 0x026c9d01, 0x066c9d16, 0x026d9d01, 0x066d9d16,
+        0x026e9d01, 0x066e9d16, 0x02709d01, 0x06709d16, 0x02729d01, 0x06729d16,
+        0x02759d01, 0x06759d16, 0x063a9d00, 0x06429d00, 0x06439d00, 0x06449d00,
+        0x06459d00, 0x06469d00, 0x06479d00, 0x06489d00, 0x06499d00, 0x064a9d00,
+        0x064b9d00, 0x064c9d00, 0x064d9d00, 0x064e9d00, 0x064f9d00, 0x06509d00,
+        0x06519d00, 0x06529d00, 0x06539d00, 0x06549d00, 0x06559d00, 0x06569d00,
+        0x06579d00, 0x06599d00, 0x066a9d00, 0x066b9d00, 0x06719d00, 0x06769d00,
+        0x06779d00, 0x06789d00, 0x06799d00, 0x067a9d00, 0x01009d46, 0x01009d47,
+        0x01009d49, 0x05009d4a, 0x02309e02, 0x02309e09, 0x02309e17, 0x06309e28,
+        0x02319e02, 0x02319e09, 0x02319e17, 0x06319e28, 0x02329e02, 0x02329e09,
+        0x02329e17, 0x06329e28, 0x02619e02, 0x02619e09, 0x02619e17, 0x06619e28,
+        0x02639e02, 0x02639e09, 0x02639e17, 0x06639e28, 0x02659e02, 0x02659e09,
+        0x02659e17, 0x06659e28, 0x02699e02, 0x02699e09, 0x02699e17, 0x06699e28,
+        0x026f9e02, 0x026f9e09, 0x026f9e17, 0x066f9e28, 0x02739e02, 0x02739e09,
+        0x02739e17, 0x06739e28, 0x02749e02, 0x02749e09, 0x02749e17, 0x06749e28,
+        0x02209e01, 0x06209e16, 0x02259e01, 0x06259e16, 0x022d9e01, 0x062d9e16,
+        0x022e9e01, 0x062e9e16, 0x022f9e01, 0x062f9e16, 0x02339e01, 0x06339e16,
+        0x02349e01, 0x06349e16, 0x02359e01, 0x06359e16, 0x02369e01, 0x06369e16,
+        0x02379e01, 0x06379e16, 0x02389e01, 0x06389e16, 0x02399e01, 0x06399e16,
+        0x023d9e01, 0x063d9e16, 0x02419e01, 0x06419e16, 0x025f9e01, 0x065f9e16,
+        0x02629e01, 0x06629e16, 0x02649e01, 0x06649e16, 0x02669e01, 0x06669e16,
+        0x02679e01, 0x06679e16, 0x02689e01, 0x06689e16, 0x026c9e01, 0x066c9e16,
+        0x026d9e01, 0x066d9e16, 0x026e9e01, 0x066e9e16, 0x02709e01, 0x06709e16,
+        0x02729e01, 0x06729e16, 0x02759e01, 0x06759e16, 0x063a9e00, 0x06429e00,
+        0x06439e00, 0x06449e00, 0x06459e00, 0x06469e00, 0x06479e00, 0x06489e00,
+        0x06499e00, 0x064a9e00, 0x064b9e00, 0x064c9e00, 0x064d9e00, 0x064e9e00,
+        0x064f9e00, 0x06509e00, 0x06519e00, 0x06529e00, 0x06539e00, 0x06549e00,
+        0x06559e00, 0x06569e00, 0x06579e00, 0x06599e00, 0x066a9e00, 0x066b9e00,
+        0x06719e00, 0x06769e00, 0x06779e00, 0x06789e00, 0x06799e00, 0x067a9e00,
+        0x01009e46, 0x01009e47, 0x01009e49, 0x05009e4a
+    },
+    /* 162 */
+    {
+        0x0630a500, 0x0631a500, 0x0632a500, 0x0661a500, 0x0663a500, 0x0665a500,
+        0x0669a500, 0x066fa500, 0x0673a500, 0x0674a500, 0x0100a50d, 0x0100a50e,
+        0x0100a511, 0x0100a512, 0x0100a514, 0x0100a515, 0x0100a51a, 0x0100a51b,
+        0x0100a51d, 0x0100a51e, 0x0100a521, 0x0100a522, 0x0100a524, 0x0100a525,
+        0x0100a52b, 0x0100a52e, 0x0100a532, 0x0100a535, 0x0100a53a, 0x0100a53d,
+        0x0100a541, 0x0500a544, 0x0630a600, 0x0631a600, 0x0632a600, 0x0661a600,
+        0x0663a600, 0x0665a600, 0x0669a600, 0x066fa600, 0x0673a600, 0x0674a600,
+        0x0100a60d, 0x0100a60e, 0x0100a611, 0x0100a612, 0x0100a614, 0x0100a615,
+        0x0100a61a, 0x0100a61b, 0x0100a61d, 0x0100a61e, 0x0100a621, 0x0100a622,
+        0x0100a624, 0x0100a625, 0x0100a62b, 0x0100a62e, 0x0100a632, 0x0100a635,
+        0x0100a63a, 0x0100a63d, 0x0100a641, 0x0500a644, 0x0630a800, 0x0631a800,
+        0x0632a800, 0x0661a800, 0x0663a800, 0x0665a800, 0x0669a800, 0x066fa800,
+        0x0673a800, 0x0674a800, 0x0100a80d, 0x0100a80e, 0x0100a811, 0x0100a812,
+        0x0100a814, 0x0100a815, 0x0100a81a, 0x0100a81b, 0x0100a81d, 0x0100a81e,
+        0x0100a821, 0x0100a822, 0x0100a824, 0x0100a825, 0x0100a82b, 0x0100a82e,
+        0x0100a832, 0x0100a835, 0x0100a83a, 0x0100a83d, 0x0100a841, 0x0500a844,
+        0x0630ae00, 0x0631ae00, 0x0632ae00, 0x0661ae00, 0x0663ae00, 0x0665ae00,
+        0x0669ae00, 0x066fae00, 0x0673ae00, 0x0674ae00, 0x0100ae0d, 0x0100ae0e,
+        0x0100ae11, 0x0100ae12, 0x0100ae14, 0x0100ae15, 0x0100ae1a, 0x0100ae1b,
+        0x0100ae1d, 0x0100ae1e, 0x0100ae21, 0x0100ae22, 0x0100ae24, 0x0100ae25,
+        0x0100ae2b, 0x0100ae2e, 0x0100ae32, 0x0100ae35, 0x0100ae3a, 0x0100ae3d,
+        0x0100ae41, 0x0500ae44, 0x0630af00, 0x0631af00, 0x0632af00, 0x0661af00,
+        0x0663af00, 0x0665af00, 0x0669af00, 0x066faf00, 0x0673af00, 0x0674af00,
+        0x0100af0d, 0x0100af0e, 0x0100af11, 0x0100af12, 0x0100af14, 0x0100af15,
+        0x0100af1a, 0x0100af1b, 0x0100af1d, 0x0100af1e, 0x0100af21, 0x0100af22,
+        0x0100af24, 0x0100af25, 0x0100af2b, 0x0100af2e, 0x0100af32, 0x0100af35,
+        0x0100af3a, 0x0100af3d, 0x0100af41, 0x0500af44, 0x0630b400, 0x0631b400,
+        0x0632b400, 0x0661b400, 0x0663b400, 0x0665b400, 0x0669b400, 0x066fb400,
+        0x0673b400, 0x0674b400, 0x0100b40d, 0x0100b40e, 0x0100b411, 0x0100b412,
+        0x0100b414, 0x0100b415, 0x0100b41a, 0x0100b41b, 0x0100b41d, 0x0100b41e,
+        0x0100b421, 0x0100b422, 0x0100b424, 0x0100b425, 0x0100b42b, 0x0100b42e,
+        0x0100b432, 0x0100b435, 0x0100b43a, 0x0100b43d, 0x0100b441, 0x0500b444,
+        0x0630b600, 0x0631b600, 0x0632b600, 0x0661b600, 0x0663b600, 0x0665b600,
+        0x0669b600, 0x066fb600, 0x0673b600, 0x0674b600, 0x0100b60d, 0x0100b60e,
+        0x0100b611, 0x0100b612, 0x0100b614, 0x0100b615, 0x0100b61a, 0x0100b61b,
+        0x0100b61d, 0x0100b61e, 0x0100b621, 0x0100b622, 0x0100b624, 0x0100b625,
+        0x0100b62b, 0x0100b62e, 0x0100b632, 0x0100b635, 0x0100b63a, 0x0100b63d,
+        0x0100b641, 0x0500b644, 0x0630b700, 0x0631b700, 0x0632b700, 0x0661b700,
+        0x0663b700, 0x0665b700, 0x0669b700, 0x066fb700, 0x0673b700, 0x0674b700,
+        0x0100b70d, 0x0100b70e, 0x0100b711, 0x0100b712, 0x0100b714, 0x0100b715,
+        0x0100b71a, 0x0100b71b, 0x0100b71d, 0x0100b71e, 0x0100b721, 0x0100b722,
+        0x0100b724, 0x0100b725, 0x0100b72b, 0x0100b72e, 0x0100b732, 0x0100b735,
+        0x0100b73a, 0x0100b73d, 0x0100b741, 0x0500b744
+    },
+    /* 163 */
+    {
+        0x0230a501, 0x0630a516, 0x0231a501, 0x0631a516, 0x0232a501, 0x0632a516,
+        0x0261a501, 0x0661a516, 0x0263a501, 0x0663a516, 0x0265a501, 0x0665a516,
+        0x0269a501, 0x0669a516, 0x026fa501, 0x066fa516, 0x0273a501, 0x0673a516,
+        0x0274a501, 0x0674a516, 0x0620a500, 0x0625a500, 0x062da500, 0x062ea500,
+        0x062fa500, 0x0633a500, 0x0634a500, 0x0635a500, 0x0636a500, 0x0637a500,
+        0x0638a500, 0x0639a500, 0x063da500, 0x0641a500, 0x065fa500, 0x0662a500,
+        0x0664a500, 0x0666a500, 0x0667a500, 0x0668a500, 0x066ca500, 0x066da500,
+        0x066ea500, 0x0670a500, 0x0672a500, 0x0675a500, 0x0100a526, 0x0100a527,
+        0x0100a52c, 0x0100a52d, 0x0100a52f, 0x0100a530, 0x0100a533, 0x0100a534,
+        0x0100a536, 0x0100a537, 0x0100a53b, 0x0100a53c, 0x0100a53e, 0x0100a53f,
+        0x0100a542, 0x0100a543, 0x0100a545, 0x0500a548, 0x0230a601, 0x0630a616,
+        0x0231a601, 0x0631a616, 0x0232a601, 0x0632a616, 0x0261a601, 0x0661a616,
+        0x0263a601, 0x0663a616, 0x0265a601, 0x0665a616, 0x0269a601, 0x0669a616,
+        0x026fa601, 0x066fa616, 0x0273a601, 0x0673a616, 0x0274a601, 0x0674a616,
+        0x0620a600, 0x0625a600, 0x062da600, 0x062ea600, 0x062fa600, 0x0633a600,
+        0x0634a600, 0x0635a600, 0x0636a600, 0x0637a600, 0x0638a600, 0x0639a600,
+        0x063da600, 0x0641a600, 0x065fa600, 0x0662a600, 0x0664a600, 0x0666a600,
+        0x0667a600, 0x0668a600, 0x066ca600, 0x066da600, 0x066ea600, 0x0670a600,
+        0x0672a600, 0x0675a600, 0x0100a626, 0x0100a627, 0x0100a62c, 0x0100a62d,
+        0x0100a62f, 0x0100a630, 0x0100a633, 0x0100a634, 0x0100a636, 0x0100a637,
+        0x0100a63b, 0x0100a63c, 0x0100a63e, 0x0100a63f, 0x0100a642, 0x0100a643,
+        0x0100a645, 0x0500a648, 0x0230a801, 0x0630a816, 0x0231a801, 0x0631a816,
+        0x0232a801, 0x0632a816, 0x0261a801, 0x0661a816, 0x0263a801, 0x0663a816,
+        0x0265a801, 0x0665a816, 0x0269a801, 0x0669a816, 0x026fa801, 0x066fa816,
+        0x0273a801, 0x0673a816, 0x0274a801, 0x0674a816, 0x0620a800, 0x0625a800,
+        0x062da800, 0x062ea800, 0x062fa800, 0x0633a800, 0x0634a800, 0x0635a800,
+        0x0636a800, 0x0637a800, 0x0638a800, 0x0639a800, 0x063da800, 0x0641a800,
+        0x065fa800, 0x0662a800, 0x0664a800, 0x0666a800, 0x0667a800, 0x0668a800,
+        0x066ca800, 0x066da800, 0x066ea800, 0x0670a800, 0x0672a800, 0x0675a800,
+        0x0100a826, 0x0100a827, 0x0100a82c, 0x0100a82d, 0x0100a82f, 0x0100a830,
+        0x0100a833, 0x0100a834, 0x0100a836, 0x0100a837, 0x0100a83b, 0x0100a83c,
+        0x0100a83e, 0x0100a83f, 0x0100a842, 0x0100a843, 0x0100a845, 0x0500a848,
+        0x0230ae01, 0x0630ae16, 0x0231ae01, 0x0631ae16, 0x0232ae01, 0x0632ae16,
+        0x0261ae01, 0x0661ae16, 0x0263ae01, 0x0663ae16, 0x0265ae01, 0x0665ae16,
+        0x0269ae01, 0x0669ae16, 0x026fae01, 0x066fae16, 0x0273ae01, 0x0673ae16,
+        0x0274ae01, 0x0674ae16, 0x0620ae00, 0x0625ae00, 0x062dae00, 0x062eae00,
+        0x062fae00, 0x0633ae00, 0x0634ae00, 0x0635ae00, 0x0636ae00, 0x0637ae00,
+        0x0638ae00, 0x0639ae00, 0x063dae00, 0x0641ae00, 0x065fae00, 0x0662ae00,
+        0x0664ae00, 0x0666ae00, 0x0667ae00, 0x0668ae00, 0x066cae00, 0x066dae00,
+        0x066eae00, 0x0670ae00, 0x0672ae00, 0x0675ae00, 0x0100ae26, 0x0100ae27,
+        0x0100ae2c, 0x0100ae2d, 0x0100ae2f, 0x0100ae30, 0x0100ae33, 0x0100ae34,
+        0x0100ae36, 0x0100ae37, 0x0100ae3b, 0x0100ae3c, 0x0100ae3e, 0x0100ae3f,
+        0x0100ae42, 0x0100ae43, 0x0100ae45, 0x0500ae48
+    },
+    /* 164 */
+    {
+        0x0230a502, 0x0230a509, 0x0230a517, 0x0630a528, 0x0231a502, 0x0231a509,
+        0x0231a517, 0x0631a528, 0x0232a502, 0x0232a509, 0x0232a517, 0x0632a528,
+        0x0261a502, 0x0261a509, 0x0261a517, 0x0661a528, 0x0263a502, 0x0263a509,
+        0x0263a517, 0x0663a528, 0x0265a502, 0x0265a509, 0x0265a517, 0x0665a528,
+        0x0269a502, 0x0269a509, 0x0269a517, 0x0669a528, 0x026fa502, 0x026fa509,
+        0x026fa517, 0x066fa528, 0x0273a502, 0x0273a509, 0x0273a517, 0x0673a528,
+        0x0274a502, 0x0274a509, 0x0274a517, 0x0674a528, 0x0220a501, 0x0620a516,
+        0x0225a501, 0x0625a516, 0x022da501, 0x062da516, 0x022ea501, 0x062ea516,
+        0x022fa501, 0x062fa516, 0x0233a501, 0x0633a516, 0x0234a501, 0x0634a516,
+        0x0235a501, 0x0635a516, 0x0236a501, 0x0636a516, 0x0237a501, 0x0637a516,
+        0x0238a501, 0x0638a516, 0x0239a501, 0x0639a516, 0x023da501, 0x063da516,
+        0x0241a501, 0x0641a516, 0x025fa501, 0x065fa516, 0x0262a501, 0x0662a516,
+        0x0264a501, 0x0664a516, 0x0266a501, 0x0666a516, 0x0267a501, 0x0667a516,
+        0x0268a501, 0x0668a516, 0x026ca501, 0x066ca516, 0x026da501, 0x066da516,
+        0x026ea501, 0x066ea516, 0x0270a501, 0x0670a516, 0x0272a501, 0x0672a516,
+        0x0275a501, 0x0675a516, 0x063aa500, 0x0642a500, 0x0643a500, 0x0644a500,
+        0x0645a500, 0x0646a500, 0x0647a500, 0x0648a500, 0x0649a500, 0x064aa500,
+        0x064ba500, 0x064ca500, 0x064da500, 0x064ea500, 0x064fa500, 0x0650a500,
+        0x0651a500, 0x0652a500, 0x0653a500, 0x0654a500, 0x0655a500, 0x0656a500,
+        0x0657a500, 0x0659a500, 0x066aa500, 0x066ba500, 0x0671a500, 0x0676a500,
+        0x0677a500, 0x0678a500, 0x0679a500, 0x067aa500, 0x0100a546, 0x0100a547,
+        0x0100a549, 0x0500a54a, 0x0230a602, 0x0230a609, 0x0230a617, 0x0630a628,
+        0x0231a602, 0x0231a609, 0x0231a617, 0x0631a628, 0x0232a602, 0x0232a609,
+        0x0232a617, 0x0632a628, 0x0261a602, 0x0261a609, 0x0261a617, 0x0661a628,
+        0x0263a602, 0x0263a609, 0x0263a617, 0x0663a628, 0x0265a602, 0x0265a609,
+        0x0265a617, 0x0665a628, 0x0269a602, 0x0269a609, 0x0269a617, 0x0669a628,
+        0x026fa602, 0x026fa609, 0x026fa617, 0x066fa628, 0x0273a602, 0x0273a609,
+        0x0273a617, 0x0673a628, 0x0274a602, 0x0274a609, 0x0274a617, 0x0674a628,
+        0x0220a601, 0x0620a616, 0x0225a601, 0x0625a616, 0x022da601, 0x062da616,
+        0x022ea601, 0x062ea616, 0x022fa601, 0x062fa616, 0x0233a601, 0x0633a616,
+        0x0234a601, 0x0634a616, 0x0235a601, 0x0635a616, 0x0236a601, 0x0636a616,
+        0x0237a601, 0x0637a616, 0x0238a601, 0x0638a616, 0x0239a601, 0x0639a616,
+        0x023da601, 0x063da616, 0x0241a601, 0x0641a616, 0x025fa601, 0x065fa616,
+        0x0262a601, 0x0662a616, 0x0264a601, 0x0664a616, 0x0266a601, 0x0666a616,
+        0x0267a601, 0x0667a616, 0x0268a601, 0x0668a616, 0x026ca601, 0x066ca616,
+        0x026da601, 0x066da616, 0x026ea601, 0x066ea616, 0x0270a601, 0x0670a616,
+        0x0272a601, 0x0672a616, 0x0275a601, 0x0675a616, 0x063aa600, 0x0642a600,
+        0x0643a600, 0x0644a600, 0x0645a600, 0x0646a600, 0x0647a600, 0x0648a600,
+        0x0649a600, 0x064aa600, 0x064ba600, 0x064ca600, 0x064da600, 0x064ea600,
+        0x064fa600, 0x0650a600, 0x0651a600, 0x0652a600, 0x0653a600, 0x0654a600,
+        0x0655a600, 0x0656a600, 0x0657a600, 0x0659a600, 0x066aa600, 0x066ba600,
+        0x0671a600, 0x0676a600, 0x0677a600, 0x0678a600, 0x0679a600, 0x067aa600,
+        0x0100a646, 0x0100a647, 0x0100a649, 0x0500a64a
+    },
+    /* 165 */
+    {
+        0x0230a802, 0x0230a809, 0x0230a817, 0x0630a828, 0x0231a802, 0x0231a809,
+        0x0231a817, 0x0631a828, 0x0232a802, 0x0232a809, 0x0232a817, 0x0632a828,
+        0x0261a802, 0x0261a809, 0x0261a817, 0x0661a828, 0x0263a802, 0x0263a809,
+        0x0263a817, 0x0663a828, 0x0265a802, 0x0265a809, 0x0265a817, 0x0665a828,
+        0x0269a802, 0x0269a809, 0x0269a817, 0x0669a828, 0x026fa802, 0x026fa809,
+        0x026fa817, 0x066fa828, 0x0273a802, 0x0273a809, 0x0273a817, 0x0673a828,
+        0x0274a802, 0x0274a809, 0x0274a817, 0x0674a828, 0x0220a801, 0x0620a816,
+        0x0225a801, 0x0625a816, 0x022da801, 0x062da816, 0x022ea801, 0x062ea816,
+        0x022fa801, 0x062fa816, 0x0233a801, 0x0633a816, 0x0234a801, 0x0634a816,
+        0x0235a801, 0x0635a816, 0x0236a801, 0x0636a816, 0x0237a801, 0x0637a816,
+        0x0238a801, 0x0638a816, 0x0239a801, 0x0639a816, 0x023da801, 0x063da816,
+        0x0241a801, 0x0641a816, 0x025fa801, 0x065fa816, 0x0262a801, 0x0662a816,
+        0x0264a801, 0x0664a816, 0x0266a801, 0x0666a816, 0x0267a801, 0x0667a816,
+        0x0268a801, 0x0668a816, 0x026ca801, 0x066ca816, 0x026da801, 0x066da816,
+        0x026ea801, 0x066ea816, 0x0270a801, 0x0670a816, 0x0272a801, 0x0672a816,
+        0x0275a801, 0x0675a816, 0x063aa800, 0x0642a800, 0x0643a800, 0x0644a800,
+        0x0645a800, 0x0646a800, 0x0647a800, 0x0648a800, 0x0649a800, 0x064aa800,
+        0x064ba800, 0x064ca800, 0x064da800, 0x064ea800, 0x064fa800, 0x0650a800,
+        0x0651a800, 0x0652a800, 0x0653a800, 0x0654a800, 0x0655a800, 0x0656a800,
+        0x0657a800, 0x0659a800, 0x066aa800, 0x066ba800, 0x0671a800, 0x0676a800,
+        0x0677a800, 0x0678a800, 0x0679a800, 0x067aa800, 0x0100a846, 0x0100a847,
+        0x0100a849, 0x0500a84a, 0x0230ae02, 0x0230ae09, 0x0230ae17, 0x0630ae28,
+        0x0231ae02, 0x0231ae09, 0x0231ae17, 0x0631ae28, 0x0232ae02, 0x0232ae09,
+        0x0232ae17, 0x0632ae28, 0x0261ae02, 0x0261ae09, 0x0261ae17, 0x0661ae28,
+        0x0263ae02, 0x0263ae09, 0x0263ae17, 0x0663ae28, 0x0265ae02, 0x0265ae09,
+        0x0265ae17, 0x0665ae28, 0x0269ae02, 0x0269ae09, 0x0269ae17, 0x0669ae28,
+        0x026fae02, 0x026fae09, 0x026fae17, 0x066fae28, 0x0273ae02, 0x0273ae09,
+        0x0273ae17, 0x0673ae28, 0x0274ae02, 0x0274ae09, 0x0274ae17, 0x0674ae28,
+        0x0220ae01, 0x0620ae16, 0x0225ae01, 0x0625ae16, 0x022dae01, 0x062dae16,
+        0x022eae01, 0x062eae16, 0x022fae01, 0x062fae16, 0x0233ae01, 0x0633ae16,
+        0x0234ae01, 0x0634ae16, 0x0235ae01, 0x0635ae16, 0x0236ae01, 0x0636ae16,
+        0x0237ae01, 0x0637ae16, 0x0238ae01, 0x0638ae16, 0x0239ae01, 0x0639ae16,
+        0x023dae01, 0x063dae16, 0x0241ae01, 0x0641ae16, 0x025fae01, 0x065fae16,
+        0x0262ae01, 0x0662ae16, 0x0264ae01, 0x0664ae16, 0x0266ae01, 0x0666ae16,
+        0x0267ae01, 0x0667ae16, 0x0268ae01, 0x0668ae16, 0x026cae01, 0x066cae16,
+        0x026dae01, 0x066dae16, 0x026eae01, 0x066eae16, 0x0270ae01, 0x0670ae16,
+        0x0272ae01, 0x0672ae16, 0x0275ae01, 0x0675ae16, 0x063aae00, 0x0642ae00,
+        0x0643ae00, 0x0644ae00, 0x0645ae00, 0x0646ae00, 0x0647ae00, 0x0648ae00,
+        0x0649ae00, 0x064aae00, 0x064bae00, 0x064cae00, 0x064dae00, 0x064eae00,
+        0x064fae00, 0x0650ae00, 0x0651ae00, 0x0652ae00, 0x0653ae00, 0x0654ae00,
+        0x0655ae00, 0x0656ae00, 0x0657ae00, 0x0659ae00, 0x066aae00, 0x066bae00,
+        0x0671ae00, 0x0676ae00, 0x0677ae00, 0x0678ae00, 0x0679ae00, 0x067aae00,
+        0x0100ae46, 0x0100ae47, 0x0100ae49, 0x0500ae4a
+    },
+    /* 166 */
+    {
+        0x0230af01, 0x0630af16, 0x0231af01, 0x0631af16, 0x0232af01, 0x0632af16,
+        0x0261af01, 0x0661af16, 0x0263af01, 0x0663af16, 0x0265af01, 0x0665af16,
+        0x0269af01, 0x0669af16, 0x026faf01, 0x066faf16, 0x0273af01, 0x0673af16,
+        0x0274af01, 0x0674af16, 0x0620af00, 0x0625af00, 0x062daf00, 0x062eaf00,
+        0x062faf00, 0x0633af00, 0x0634af00, 0x0635af00, 0x0636af00, 0x0637af00,
+        0x0638af00, 0x0639af00, 0x063daf00, 0x0641af00, 0x065faf00, 0x0662af00,
+        0x0664af00, 0x0666af00, 0x0667af00, 0x0668af00, 0x066caf00, 0x066daf00,
+        0x066eaf00, 0x0670af00, 0x0672af00, 0x0675af00, 0x0100af26, 0x0100af27,
+        0x0100af2c, 0x0100af2d, 0x0100af2f, 0x0100af30, 0x0100af33, 0x0100af34,
+        0x0100af36, 0x0100af37, 0x0100af3b, 0x0100af3c, 0x0100af3e, 0x0100af3f,
+        0x0100af42, 0x0100af43, 0x0100af45, 0x0500af48, 0x0230b401, 0x0630b416,
+        0x0231b401, 0x0631b416, 0x0232b401, 0x0632b416, 0x0261b401, 0x0661b416,
+        0x0263b401, 0x0663b416, 0x0265b401, 0x0665b416, 0x0269b401, 0x0669b416,
+        0x026fb401, 0x066fb416, 0x0273b401, 0x0673b416, 0x0274b401, 0x0674b416,
+        0x0620b400, 0x0625b400, 0x062db400, 0x062eb400, 0x062fb400, 0x0633b400,
+        0x0634b400, 0x0635b400, 0x0636b400, 0x0637b400, 0x0638b400, 0x0639b400,
+        0x063db400, 0x0641b400, 0x065fb400, 0x0662b400, 0x0664b400, 0x0666b400,
+        0x0667b400, 0x0668b400, 0x066cb400, 0x066db400, 0x066eb400, 0x0670b400,
+        0x0672b400, 0x0675b400, 0x0100b426, 0x0100b427, 0x0100b42c, 0x0100b42d,
+        0x0100b42f, 0x0100b430, 0x0100b433, 0x0100b434, 0x0100b436, 0x0100b437,
+        0x0100b43b, 0x0100b43c, 0x0100b43e, 0x0100b43f, 0x0100b442, 0x0100b443,
+        0x0100b445, 0x0500b448, 0x0230b601, 0x0630b616, 0x0231b601, 0x0631b616,
+        0x0232b601, 0x0632b616, 0x0261b601, 0x0661b616, 0x0263b601, 0x0663b616,
+        0x0265b601, 0x0665b616, 0x0269b601, 0x0669b616, 0x026fb601, 0x066fb616,
+        0x0273b601, 0x0673b616, 0x0274b601, 0x0674b616, 0x0620b600, 0x0625b600,
+        0x062db600, 0x062eb600, 0x062fb600, 0x0633b600, 0x0634b600, 0x0635b600,
+        0x0636b600, 0x0637b600, 0x0638b600, 0x0639b600, 0x063db600, 0x0641b600,
+        0x065fb600, 0x0662b600, 0x0664b600, 0x0666b600, 0x0667b600, 0x0668b600,
+        0x066cb600, 0x066db600, 0x066eb600, 0x0670b600, 0x0672b600, 0x0675b600,
+        0x0100b626, 0x0100b627, 0x0100b62c, 0x0100b62d, 0x0100b62f, 0x0100b630,
+        0x0100b633, 0x0100b634, 0x0100b636, 0x0100b637, 0x0100b63b, 0x0100b63c,
+        0x0100b63e, 0x0100b63f, 0x0100b642, 0x0100b643, 0x0100b645, 0x0500b648,
+        0x0230b701, 0x0630b716, 0x0231b701, 0x0631b716, 0x0232b701, 0x0632b716,
+        0x0261b701, 0x0661b716, 0x0263b701, 0x0663b716, 0x0265b701, 0x0665b716,
+        0x0269b701, 0x0669b716, 0x026fb701, 0x066fb716, 0x0273b701, 0x0673b716,
+        0x0274b701, 0x0674b716, 0x0620b700, 0x0625b700, 0x062db700, 0x062eb700,
+        0x062fb700, 0x0633b700, 0x0634b700, 0x0635b700, 0x0636b700, 0x0637b700,
+        0x0638b700, 0x0639b700, 0x063db700, 0x0641b700, 0x065fb700, 0x0662b700,
+        0x0664b700, 0x0666b700, 0x0667b700, 0x0668b700, 0x066cb700, 0x066db700,
+        0x066eb700, 0x0670b700, 0x0672b700, 0x0675b700, 0x0100b726, 0x0100b727,
+        0x0100b72c, 0x0100b72d, 0x0100b72f, 0x0100b730, 0x0100b733, 0x0100b734,
+        0x0100b736, 0x0100b737, 0x0100b73b, 0x0100b73c, 0x0100b73e, 0x0100b73f,
+        0x0100b742, 0x0100b743, 0x0100b745, 0x0500b748
+    },
+    /* 167 */
+    {
+        0x0230af02, 0x0230af09, 0x0230af17, 0x0630af28, 0x0231af02, 0x0231af09,
+        0x0231af17, 0x0631af28, 0x0232af02, 0x0232af09, 0x0232af17, 0x0632af28,
+        0x0261af02, 0x0261af09, 0x0261af17, 0x0661af28, 0x0263af02, 0x0263af09,
+        0x0263af17, 0x0663af28, 0x0265af02, 0x0265af09, 0x0265af17, 0x0665af28,
+        0x0269af02, 0x0269af09, 0x0269af17, 0x0669af28, 0x026faf02, 0x026faf09,
+        0x026faf17, 0x066faf28, 0x0273af02, 0x0273af09, 0x0273af17, 0x0673af28,
+        0x0274af02, 0x0274af09, 0x0274af17, 0x0674af28, 0x0220af01, 0x0620af16,
+        0x0225af01, 0x0625af16, 0x022daf01, 0x062daf16, 0x022eaf01, 0x062eaf16,
+        0x022faf01, 0x062faf16, 0x0233af01, 0x0633af16, 0x0234af01, 0x0634af16,
+        0x0235af01, 0x0635af16, 0x0236af01, 0x0636af16, 0x0237af01, 0x0637af16,
+        0x0238af01, 0x0638af16, 0x0239af01, 0x0639af16, 0x023daf01, 0x063daf16,
+        0x0241af01, 0x0641af16, 0x025faf01, 0x065faf16, 0x0262af01, 0x0662af16,
+        0x0264af01, 0x0664af16, 0x0266af01, 0x0666af16, 0x0267af01, 0x0667af16,
+        0x0268af01, 0x0668af16, 0x026caf01, 0x066caf16, 0x026daf01, 0x066daf16,
+        0x026eaf01, 0x066eaf16, 0x0270af01, 0x0670af16, 0x0272af01, 0x0672af16,
+        0x0275af01, 0x0675af16, 0x063aaf00, 0x0642af00, 0x0643af00, 0x0644af00,
+        0x0645af00, 0x0646af00, 0x0647af00, 0x0648af00, 0x0649af00, 0x064aaf00,
+        0x064baf00, 0x064caf00, 0x064daf00, 0x064eaf00, 0x064faf00, 0x0650af00,
+        0x0651af00, 0x0652af00, 0x0653af00, 0x0654af00, 0x0655af00, 0x0656af00,
+        0x0657af00, 0x0659af00, 0x066aaf00, 0x066baf00, 0x0671af00, 0x0676af00,
+        0x0677af00, 0x0678af00, 0x0679af00, 0x067aaf00, 0x0100af46, 0x0100af47,
+        0x0100af49, 0x0500af4a, 0x0230b402, 0x0230b409, 0x0230b417, 0x0630b428,
+        0x0231b402, 0x0231b409, 0x0231b417, 0x0631b428, 0x0232b402, 0x0232b409,
+        0x0232b417, 0x0632b428, 0x0261b402, 0x0261b409, 0x0261b417, 0x0661b428,
+        0x0263b402, 0x0263b409, 0x0263b417, 0x0663b428, 0x0265b402, 0x0265b409,
+        0x0265b417, 0x0665b428, 0x0269b402, 0x0269b409, 0x0269b417, 0x0669b428,
+        0x026fb402, 0x026fb409, 0x026fb417, 0x066fb428, 0x0273b402, 0x0273b409,
+        0x0273b417, 0x0673b428, 0x0274b402, 0x0274b409, 0x0274b417, 0x0674b428,
+        0x0220b401, 0x0620b416, 0x0225b401, 0x0625b416, 0x022db401, 0x062db416,
+        0x022eb401, 0x062eb416, 0x022fb401, 0x062fb416, 0x0233b401, 0x0633b416,
+        0x0234b401, 0x0634b416, 0x0235b401, 0x0635b416, 0x0236b401, 0x0636b416,
+        0x0237b401, 0x0637b416, 0x0238b401, 0x0638b416, 0x0239b401, 0x0639b416,
+        0x023db401, 0x063db416, 0x0241b401, 0x0641b416, 0x025fb401, 0x065fb416,
+        0x0262b401, 0x0662b416, 0x0264b401, 0x0664b416, 0x0266b401, 0x0666b416,
+        0x0267b401, 0x0667b416, 0x0268b401, 0x0668b416, 0x026cb401, 0x066cb416,
+        0x026db401, 0x066db416, 0x026eb401, 0x066eb416, 0x0270b401, 0x0670b416,
+        0x0272b401, 0x0672b416, 0x0275b401, 0x0675b416, 0x063ab400, 0x0642b400,
+        0x0643b400, 0x0644b400, 0x0645b400, 0x0646b400, 0x0647b400, 0x0648b400,
+        0x0649b400, 0x064ab400, 0x064bb400, 0x064cb400, 0x064db400, 0x064eb400,
+        0x064fb400, 0x0650b400, 0x0651b400, 0x0652b400, 0x0653b400, 0x0654b400,
+        0x0655b400, 0x0656b400, 0x0657b400, 0x0659b400, 0x066ab400, 0x066bb400,
+        0x0671b400, 0x0676b400, 0x0677b400, 0x0678b400, 0x0679b400, 0x067ab400,
+        0x0100b446, 0x0100b447, 0x0100b449, 0x0500b44a
+    },
+    /* 168 */
+    {
+        0x0230b602, 0x0230b609, 0x0230b617, 0x0630b628, 0x0231b602, 0x0231b609,
+        0x0231b617, 0x0631b628, 0x0232b602, 0x0232b609, 0x0232b617, 0x0632b628,
+        0x0261b602, 0x0261b609, 0x0261b617, 0x0661b628, 0x0263b602, 0x0263b609,
+        0x0263b617, 0x0663b628, 0x0265b602, 0x0265b609, 0x0265b617, 0x0665b628,
+        0x0269b602, 0x0269b609, 0x0269b617, 0x0669b628, 0x026fb602, 0x026fb609,
+        0x026fb617, 0x066fb628, 0x0273b602, 0x0273b609, 0x0273b617, 0x0673b628,
+        0x0274b602, 0x0274b609, 0x0274b617, 0x0674b628, 0x0220b601, 0x0620b616,
+        0x0225b601, 0x0625b616, 0x022db601, 0x062db616, 0x022eb601, 0x062eb616,
+        0x022fb601, 0x062fb616, 0x0233b601, 0x0633b616, 0x0234b601, 0x0634b616,
+        0x0235b601, 0x0635b616, 0x0236b601, 0x0636b616, 0x0237b601, 0x0637b616,
+        0x0238b601, 0x0638b616, 0x0239b601, 0x0639b616, 0x023db601, 0x063db616,
+        0x0241b601, 0x0641b616, 0x025fb601, 0x065fb616, 0x0262b601, 0x0662b616,
+        0x0264b601, 0x0664b616, 0x0266b601, 0x0666b616, 0x0267b601, 0x0667b616,
+        0x0268b601, 0x0668b616, 0x026cb601, 0x066cb616, 0x026db601, 0x066db616,
+        0x026eb601, 0x066eb616, 0x0270b601, 0x0670b616, 0x0272b601, 0x0672b616,
+        0x0275b601, 0x0675b616, 0x063ab600, 0x0642b600, 0x0643b600, 0x0644b600,
+        0x0645b600, 0x0646b600, 0x0647b600, 0x0648b600, 0x0649b600, 0x064ab600,
+        0x064bb600, 0x064cb600, 0x064db600, 0x064eb600, 0x064fb600, 0x0650b600,
+        0x0651b600, 0x0652b600, 0x0653b600, 0x0654b600, 0x0655b600, 0x0656b600,
+        0x0657b600, 0x0659b600, 0x066ab600, 0x066bb600, 0x0671b600, 0x0676b600,
+        0x0677b600, 0x0678b600, 0x0679b600, 0x067ab600, 0x0100b646, 0x0100b647,
+        0x0100b649, 0x0500b64a, 0x0230b702, 0x0230b709, 0x0230b717, 0x0630b728,
+        0x0231b702, 0x0231b709, 0x0231b717, 0x0631b728, 0x0232b702, 0x0232b709,
+        0x0232b717, 0x0632b728, 0x0261b702, 0x0261b709, 0x0261b717, 0x0661b728,
+        0x0263b702, 0x0263b709, 0x0263b717, 0x0663b728, 0x0265b702, 0x0265b709,
+        0x0265b717, 0x0665b728, 0x0269b702, 0x0269b709, 0x0269b717, 0x0669b728,
+        0x026fb702, 0x026fb709, 0x026fb717, 0x066fb728, 0x0273b702, 0x0273b709,
+        0x0273b717, 0x0673b728, 0x0274b702, 0x0274b709, 0x0274b717, 0x0674b728,
+        0x0220b701, 0x0620b716, 0x0225b701, 0x0625b716, 0x022db701, 0x062db716,
+        0x022eb701, 0x062eb716, 0x022fb701, 0x062fb716, 0x0233b701, 0x0633b716,
+        0x0234b701, 0x0634b716, 0x0235b701, 0x0635b716, 0x0236b701, 0x0636b716,
+        0x0237b701, 0x0637b716, 0x0238b701, 0x0638b716, 0x0239b701, 0x0639b716,
+        0x023db701, 0x063db716, 0x0241b701, 0x0641b716, 0x025fb701, 0x065fb716,
+        0x0262b701, 0x0662b716, 0x0264b701, 0x0664b716, 0x0266b701, 0x0666b716,
+        0x0267b701, 0x0667b716, 0x0268b701, 0x0668b716, 0x026cb701, 0x066cb716,
+        0x026db701, 0x066db716, 0x026eb701, 0x066eb716, 0x0270b701, 0x0670b716,
+        0x0272b701, 0x0672b716, 0x0275b701, 0x0675b716, 0x063ab700, 0x0642b700,
+        0x0643b700, 0x0644b700, 0x0645b700, 0x0646b700, 0x0647b700, 0x0648b700,
+        0x0649b700, 0x064ab700, 0x064bb700, 0x064cb700, 0x064db700, 0x064eb700,
+        0x064fb700, 0x0650b700, 0x0651b700, 0x0652b700, 0x0653b700, 0x0654b700,
+        0x0655b700, 0x0656b700, 0x0657b700, 0x0659b700, 0x066ab700, 0x066bb700,
+        0x0671b700, 0x0676b700, 0x0677b700, 0x0678b700, 0x0679b700, 0x067ab700,
+        0x0100b746, 0x0100b747, 0x0100b749, 0x0500b74a
+    },
+    /* 169 */
+    {
+        0x0100bc04, 0x0100bc05, 0x0100bc07, 0x0100bc08, 0x0100bc0b, 0x0100bc0c,
+        0x0100bc10, 0x0100bc13, 0x0100bc19, 0x0100bc1c, 0x0100bc20, 0x0100bc23,
+        0x0100bc2a, 0x0100bc31, 0x0100bc39, 0x0500bc40, 0x0100bf04, 0x0100bf05,
+        0x0100bf07, 0x0100bf08, 0x0100bf0b, 0x0100bf0c, 0x0100bf10, 0x0100bf13,
+        0x0100bf19, 0x0100bf1c, 0x0100bf20, 0x0100bf23, 0x0100bf2a, 0x0100bf31,
+        0x0100bf39, 0x0500bf40, 0x0100c504, 0x0100c505, 0x0100c507, 0x0100c508,
+        0x0100c50b, 0x0100c50c, 0x0100c510, 0x0100c513, 0x0100c519, 0x0100c51c,
+        0x0100c520, 0x0100c523, 0x0100c52a, 0x0100c531, 0x0100c539, 0x0500c540,
+        0x0100e704, 0x0100e705, 0x0100e707, 0x0100e708, 0x0100e70b, 0x0100e70c,
+        0x0100e710, 0x0100e713, 0x0100e719, 0x0100e71c, 0x0100e720, 0x0100e723,
+        0x0100e72a, 0x0100e731, 0x0100e739, 0x0500e740, 0x0100ef04, 0x0100ef05,
+        0x0100ef07, 0x0100ef08, 0x0100ef0b, 0x0100ef0c, 0x0100ef10, 0x0100ef13,
+        0x0100ef19, 0x0100ef1c, 0x0100ef20, 0x0100ef23, 0x0100ef2a, 0x0100ef31,
+        0x0100ef39, 0x0500ef40, 0x01000903, 0x01000906, 0x0100090a, 0x0100090f,
+        0x01000918, 0x0100091f, 0x01000929, 0x05000938, 0x01008e03, 0x01008e06,
+        0x01008e0a, 0x01008e0f, 0x01008e18, 0x01008e1f, 0x01008e29, 0x05008e38,
+        0x01009003, 0x01009006, 0x0100900a, 0x0100900f, 0x01009018, 0x0100901f,
+        0x01009029, 0x05009038, 0x01009103, 0x01009106, 0x0100910a, 0x0100910f,
+        0x01009118, 0x0100911f, 0x01009129, 0x05009138, 0x01009403, 0x01009406,
+        0x0100940a, 0x0100940f, 0x01009418, 0x0100941f, 0x01009429, 0x05009438,
+        0x01009f03, 0x01009f06, 0x01009f0a, 0x01009f0f, 0x01009f18, 0x01009f1f,
+        0x01009f29, 0x05009f38, 0x0100ab03, 0x0100ab06, 0x0100ab0a, 0x0100ab0f,
+        0x0100ab18, 0x0100ab1f, 0x0100ab29, 0x0500ab38, 0x0100ce03, 0x0100ce06,
+        0x0100ce0a, 0x0100ce0f, 0x0100ce18, 0x0100ce1f, 0x0100ce29, 0x0500ce38,
+        0x0100d703, 0x0100d706, 0x0100d70a, 0x0100d70f, 0x0100d718, 0x0100d71f,
+        0x0100d729, 0x0500d738, 0x0100e103, 0x0100e106, 0x0100e10a, 0x0100e10f,
+        0x0100e118, 0x0100e11f, 0x0100e129, 0x0500e138, 0x0100ec03, 0x0100ec06,
+        0x0100ec0a, 0x0100ec0f, 0x0100ec18, 0x0100ec1f, 0x0100ec29, 0x0500ec38,
+        0x0100ed03, 0x0100ed06, 0x0100ed0a, 0x0100ed0f, 0x0100ed18, 0x0100ed1f,
+        0x0100ed29, 0x0500ed38, 0x0100c702, 0x0100c709, 0x0100c717, 0x0500c728,
+        0x0100cf02, 0x0100cf09, 0x0100cf17, 0x0500cf28, 0x0100ea02, 0x0100ea09,
+        0x0100ea17, 0x0500ea28, 0x0100eb02, 0x0100eb09, 0x0100eb17, 0x0500eb28,
+        0x0100c001, 0x0500c016, 0x0100c101, 0x0500c116, 0x0100c801, 0x0500c816,
+        0x0100c901, 0x0500c916, 0x0100ca01, 0x0500ca16, 0x0100cd01, 0x0500cd16,
+        0x0100d201, 0x0500d216, 0x0100d501, 0x0500d516, 0x0100da01, 0x0500da16,
+        0x0100db01, 0x0500db16, 0x0100ee01, 0x0500ee16, 0x0100f001, 0x0500f016,
+        0x0100f201, 0x0500f216, 0x0100f301, 0x0500f316, 0x0100ff01, 0x0500ff16,
+        0x0500cb00, 0x0500cc00, 0x0500d300, 0x0500d400, 0x0500d600, 0x0500dd00,
+        0x0500de00, 0x0500df00, 0x0500f100, 0x0500f400, 0x0500f500, 0x0500f600,
+        0x0500f700, 0x0500f800, 0x0500fa00, 0x0500fb00, 0x0500fc00, 0x0500fd00,
+        0x0500fe00, 0x000000e3, 0x000000e5, 0x000000e6, 0x000000e9, 0x000000ea,
+        0x000000ec, 0x000000ed, 0x000000f1, 0x000000f2, 0x000000f4, 0x000000f5,
+        0x000000f8, 0x000000f9, 0x000000fb, 0x040000fc
+    },
+    /* 170 */
+    {
+        0x0630bc00, 0x0631bc00, 0x0632bc00, 0x0661bc00, 0x0663bc00, 0x0665bc00,
+        0x0669bc00, 0x066fbc00, 0x0673bc00, 0x0674bc00, 0x0100bc0d, 0x0100bc0e,
+        0x0100bc11, 0x0100bc12, 0x0100bc14, 0x0100bc15, 0x0100bc1a, 0x0100bc1b,
+        0x0100bc1d, 0x0100bc1e, 0x0100bc21, 0x0100bc22, 0x0100bc24, 0x0100bc25,
+        0x0100bc2b, 0x0100bc2e, 0x0100bc32, 0x0100bc35, 0x0100bc3a, 0x0100bc3d,
+        0x0100bc41, 0x0500bc44, 0x0630bf00, 0x0631bf00, 0x0632bf00, 0x0661bf00,
+        0x0663bf00, 0x0665bf00, 0x0669bf00, 0x066fbf00, 0x0673bf00, 0x0674bf00,
+        0x0100bf0d, 0x0100bf0e, 0x0100bf11, 0x0100bf12, 0x0100bf14, 0x0100bf15,
+        0x0100bf1a, 0x0100bf1b, 0x0100bf1d, 0x0100bf1e, 0x0100bf21, 0x0100bf22,
+        0x0100bf24, 0x0100bf25, 0x0100bf2b, 0x0100bf2e, 0x0100bf32, 0x0100bf35,
+        0x0100bf3a, 0x0100bf3d, 0x0100bf41, 0x0500bf44, 0x0630c500, 0x0631c500,
+        0x0632c500, 0x0661c500, 0x0663c500, 0x0665c500, 0x0669c500, 0x066fc500,
+        0x0673c500, 0x0674c500, 0x0100c50d, 0x0100c50e, 0x0100c511, 0x0100c512,
+        0x0100c514, 0x0100c515, 0x0100c51a, 0x0100c51b, 0x0100c51d, 0x0100c51e,
+        0x0100c521, 0x0100c522, 0x0100c524, 0x0100c525, 0x0100c52b, 0x0100c52e,
+        0x0100c532, 0x0100c535, 0x0100c53a, 0x0100c53d, 0x0100c541, 0x0500c544,
+        0x0630e700, 0x0631e700, 0x0632e700, 0x0661e700, 0x0663e700, 0x0665e700,
+        0x0669e700, 0x066fe700, 0x0673e700, 0x0674e700, 0x0100e70d, 0x0100e70e,
+        0x0100e711, 0x0100e712, 0x0100e714, 0x0100e715, 0x0100e71a, 0x0100e71b,
+        0x0100e71d, 0x0100e71e, 0x0100e721, 0x0100e722, 0x0100e724, 0x0100e725,
+        0x0100e72b, 0x0100e72e, 0x0100e732, 0x0100e735, 0x0100e73a, 0x0100e73d,
+        0x0100e741, 0x0500e744, 0x0630ef00, 0x0631ef00, 0x0632ef00, 0x0661ef00,
+        0x0663ef00, 0x0665ef00, 0x0669ef00, 0x066fef00, 0x0673ef00, 0x0674ef00,
+        0x0100ef0d, 0x0100ef0e, 0x0100ef11, 0x0100ef12, 0x0100ef14, 0x0100ef15,
+        0x0100ef1a, 0x0100ef1b, 0x0100ef1d, 0x0100ef1e, 0x0100ef21, 0x0100ef22,
+        0x0100ef24, 0x0100ef25, 0x0100ef2b, 0x0100ef2e, 0x0100ef32, 0x0100ef35,
+        0x0100ef3a, 0x0100ef3d, 0x0100ef41, 0x0500ef44, 0x01000904, 0x01000905,
+        0x01000907, 0x01000908, 0x0100090b, 0x0100090c, 0x01000910, 0x01000913,
+        0x01000919, 0x0100091c, 0x01000920, 0x01000923, 0x0100092a, 0x01000931,
+        0x01000939, 0x05000940, 0x01008e04, 0x01008e05, 0x01008e07, 0x01008e08,
+        0x01008e0b, 0x01008e0c, 0x01008e10, 0x01008e13, 0x01008e19, 0x01008e1c,
+        0x01008e20, 0x01008e23, 0x01008e2a, 0x01008e31, 0x01008e39, 0x05008e40,
+        0x01009004, 0x01009005, 0x01009007, 0x01009008, 0x0100900b, 0x0100900c,
+        0x01009010, 0x01009013, 0x01009019, 0x0100901c, 0x01009020, 0x01009023,
+        0x0100902a, 0x01009031, 0x01009039, 0x05009040, 0x01009104, 0x01009105,
+        0x01009107, 0x01009108, 0x0100910b, 0x0100910c, 0x01009110, 0x01009113,
+        0x01009119, 0x0100911c, 0x01009120, 0x01009123, 0x0100912a, 0x01009131,
+        0x01009139, 0x05009140, 0x01009404, 0x01009405, 0x01009407, 0x01009408,
+        0x0100940b, 0x0100940c, 0x01009410, 0x01009413, 0x01009419, 0x0100941c,
+        0x01009420, 0x01009423, 0x0100942a, 0x01009431, 0x01009439, 0x05009440,
+        0x01009f04, 0x01009f05, 0x01009f07, 0x01009f08, 0x01009f0b, 0x01009f0c,
+        0x01009f10, 0x01009f13, 0x01009f19, 0x01009f1c, 0x01009f20, 0x01009f23,
+        0x01009f2a, 0x01009f31, 0x01009f39, 0x05009f40
+    },
+    /* 171 */
+    {
+        0x0230bc01, 0x0630bc16, 0x0231bc01, 0x0631bc16, 0x0232bc01, 0x0632bc16,
+        0x0261bc01, 0x0661bc16, 0x0263bc01, 0x0663bc16, 0x0265bc01, 0x0665bc16,
+        0x0269bc01, 0x0669bc16, 0x026fbc01, 0x066fbc16, 0x0273bc01, 0x0673bc16,
+        0x0274bc01, 0x0674bc16, 0x0620bc00, 0x0625bc00, 0x062dbc00, 0x062ebc00,
+        0x062fbc00, 0x0633bc00, 0x0634bc00, 0x0635bc00, 0x0636bc00, 0x0637bc00,
+        0x0638bc00, 0x0639bc00, 0x063dbc00, 0x0641bc00, 0x065fbc00, 0x0662bc00,
+        0x0664bc00, 0x0666bc00, 0x0667bc00, 0x0668bc00, 0x066cbc00, 0x066dbc00,
+        0x066ebc00, 0x0670bc00, 0x0672bc00, 0x0675bc00, 0x0100bc26, 0x0100bc27,
+        0x0100bc2c, 0x0100bc2d, 0x0100bc2f, 0x0100bc30, 0x0100bc33, 0x0100bc34,
+        0x0100bc36, 0x0100bc37, 0x0100bc3b, 0x0100bc3c, 0x0100bc3e, 0x0100bc3f,
+        0x0100bc42, 0x0100bc43, 0x0100bc45, 0x0500bc48, 0x0230bf01, 0x0630bf16,
+        0x0231bf01, 0x0631bf16, 0x0232bf01, 0x0632bf16, 0x0261bf01, 0x0661bf16,
+        0x0263bf01, 0x0663bf16, 0x0265bf01, 0x0665bf16, 0x0269bf01, 0x0669bf16,
+        0x026fbf01, 0x066fbf16, 0x0273bf01, 0x0673bf16, 0x0274bf01, 0x0674bf16,
+        0x0620bf00, 0x0625bf00, 0x062dbf00, 0x062ebf00, 0x062fbf00, 0x0633bf00,
+        0x0634bf00, 0x0635bf00, 0x0636bf00, 0x0637bf00, 0x0638bf00, 0x0639bf00,
+        0x063dbf00, 0x0641bf00, 0x065fbf00, 0x0662bf00, 0x0664bf00, 0x0666bf00,
+        0x0667bf00, 0x0668bf00, 0x066cbf00, 0x066dbf00, 0x066ebf00, 0x0670bf00,
+        0x0672bf00, 0x0675bf00, 0x0100bf26, 0x0100bf27, 0x0100bf2c, 0x0100bf2d,
+        0x0100bf2f, 0x0100bf30, 0x0100bf33, 0x0100bf34, 0x0100bf36, 0x0100bf37,
+        0x0100bf3b, 0x0100bf3c, 0x0100bf3e, 0x0100bf3f, 0x0100bf42, 0x0100bf43,
+        0x0100bf45, 0x0500bf48, 0x0230c501, 0x0630c516, 0x0231c501, 0x0631c516,
+        0x0232c501, 0x0632c516, 0x0261c501, 0x0661c516, 0x0263c501, 0x0663c516,
+        0x0265c501, 0x0665c516, 0x0269c501, 0x0669c516, 0x026fc501, 0x066fc516,
+        0x0273c501, 0x0673c516, 0x0274c501, 0x0674c516, 0x0620c500, 0x0625c500,
+        0x062dc500, 0x062ec500, 0x062fc500, 0x0633c500, 0x0634c500, 0x0635c500,
+        0x0636c500, 0x0637c500, 0x0638c500, 0x0639c500, 0x063dc500, 0x0641c500,
+        0x065fc500, 0x0662c500, 0x0664c500, 0x0666c500, 0x0667c500, 0x0668c500,
+        0x066cc500, 0x066dc500, 0x066ec500, 0x0670c500, 0x0672c500, 0x0675c500,
+        0x0100c526, 0x0100c527, 0x0100c52c, 0x0100c52d, 0x0100c52f, 0x0100c530,
+        0x0100c533, 0x0100c534, 0x0100c536, 0x0100c537, 0x0100c53b, 0x0100c53c,
+        0x0100c53e, 0x0100c53f, 0x0100c542, 0x0100c543, 0x0100c545, 0x0500c548,
+        0x0230e701, 0x0630e716, 0x0231e701, 0x0631e716, 0x0232e701, 0x0632e716,
+        0x0261e701, 0x0661e716, 0x0263e701, 0x0663e716, 0x0265e701, 0x0665e716,
+        0x0269e701, 0x0669e716, 0x026fe701, 0x066fe716, 0x0273e701, 0x0673e716,
+        0x0274e701, 0x0674e716, 0x0620e700, 0x0625e700, 0x062de700, 0x062ee700,
+        0x062fe700, 0x0633e700, 0x0634e700, 0x0635e700, 0x0636e700, 0x0637e700,
+        0x0638e700, 0x0639e700, 0x063de700, 0x0641e700, 0x065fe700, 0x0662e700,
+        0x0664e700, 0x0666e700, 0x0667e700, 0x0668e700, 0x066ce700, 0x066de700,
+        0x066ee700, 0x0670e700, 0x0672e700, 0x0675e700, 0x0100e726, 0x0100e727,
+        0x0100e72c, 0x0100e72d, 0x0100e72f, 0x0100e730, 0x0100e733, 0x0100e734,
+        0x0100e736, 0x0100e737, 0x0100e73b, 0x0100e73c, 0x0100e73e, 0x0100e73f,
+        0x0100e742, 0x0100e743, 0x0100e745, 0x0500e748
+    },
+    /* 172 */
+    {
+        0x0230bc02, 0x0230bc09, 0x0230bc17, 0x0630bc28, 0x0231bc02, 0x0231bc09,
+        0x0231bc17, 0x0631bc28, 0x0232bc02, 0x0232bc09, 0x0232bc17, 0x0632bc28,
+        0x0261bc02, 0x0261bc09, 0x0261bc17, 0x0661bc28, 0x0263bc02, 0x0263bc09,
+        0x0263bc17, 0x0663bc28, 0x0265bc02, 0x0265bc09, 0x0265bc17, 0x0665bc28,
+        0x0269bc02, 0x0269bc09, 0x0269bc17, 0x0669bc28, 0x026fbc02, 0x026fbc09,
+        0x026fbc17, 0x066fbc28, 0x0273bc02, 0x0273bc09, 0x0273bc17, 0x0673bc28,
+        0x0274bc02, 0x0274bc09, 0x0274bc17, 0x0674bc28, 0x0220bc01, 0x0620bc16,
+        0x0225bc01, 0x0625bc16, 0x022dbc01, 0x062dbc16, 0x022ebc01, 0x062ebc16,
+        0x022fbc01, 0x062fbc16, 0x0233bc01, 0x0633bc16, 0x0234bc01, 0x0634bc16,
+        0x0235bc01, 0x0635bc16, 0x0236bc01, 0x0636bc16, 0x0237bc01, 0x0637bc16,
+        0x0238bc01, 0x0638bc16, 0x0239bc01, 0x0639bc16, 0x023dbc01, 0x063dbc16,
+        0x0241bc01, 0x0641bc16, 0x025fbc01, 0x065fbc16, 0x0262bc01, 0x0662bc16,
+        0x0264bc01, 0x0664bc16, 0x0266bc01, 0x0666bc16, 0x0267bc01, 0x0667bc16,
+        0x0268bc01, 0x0668bc16, 0x026cbc01, 0x066cbc16, 0x026dbc01, 0x066dbc16,
+        0x026ebc01, 0x066ebc16, 0x0270bc01, 0x0670bc16, 0x0272bc01, 0x0672bc16,
+        0x0275bc01, 0x0675bc16, 0x063abc00, 0x0642bc00, 0x0643bc00, 0x0644bc00,
+        0x0645bc00, 0x0646bc00, 0x0647bc00, 0x0648bc00, 0x0649bc00, 0x064abc00,
+        0x064bbc00, 0x064cbc00, 0x064dbc00, 0x064ebc00, 0x064fbc00, 0x0650bc00,
+        0x0651bc00, 0x0652bc00, 0x0653bc00, 0x0654bc00, 0x0655bc00, 0x0656bc00,
+        0x0657bc00, 0x0659bc00, 0x066abc00, 0x066bbc00, 0x0671bc00, 0x0676bc00,
+        0x0677bc00, 0x0678bc00, 0x0679bc00, 0x067abc00, 0x0100bc46, 0x0100bc47,
+        0x0100bc49, 0x0500bc4a, 0x0230bf02, 0x0230bf09, 0x0230bf17, 0x0630bf28,
+        0x0231bf02, 0x0231bf09, 0x0231bf17, 0x0631bf28, 0x0232bf02, 0x0232bf09,
+        0x0232bf17, 0x0632bf28, 0x0261bf02, 0x0261bf09, 0x0261bf17, 0x0661bf28,
+        0x0263bf02, 0x0263bf09, 0x0263bf17, 0x0663bf28, 0x0265bf02, 0x0265bf09,
+        0x0265bf17, 0x0665bf28, 0x0269bf02, 0x0269bf09, 0x0269bf17, 0x0669bf28,
+        0x026fbf02, 0x026fbf09, 0x026fbf17, 0x066fbf28, 0x0273bf02, 0x0273bf09,
+        0x0273bf17, 0x0673bf28, 0x0274bf02, 0x0274bf09, 0x0274bf17, 0x0674bf28,
+        0x0220bf01, 0x0620bf16, 0x0225bf01, 0x0625bf16, 0x022dbf01, 0x062dbf16,
+        0x022ebf01, 0x062ebf16, 0x022fbf01, 0x062fbf16, 0x0233bf01, 0x0633bf16,
+        0x0234bf01, 0x0634bf16, 0x0235bf01, 0x0635bf16, 0x0236bf01, 0x0636bf16,
+        0x0237bf01, 0x0637bf16, 0x0238bf01, 0x0638bf16, 0x0239bf01, 0x0639bf16,
+        0x023dbf01, 0x063dbf16, 0x0241bf01, 0x0641bf16, 0x025fbf01, 0x065fbf16,
+        0x0262bf01, 0x0662bf16, 0x0264bf01, 0x0664bf16, 0x0266bf01, 0x0666bf16,
+        0x0267bf01, 0x0667bf16, 0x0268bf01, 0x0668bf16, 0x026cbf01, 0x066cbf16,
+        0x026dbf01, 0x066dbf16, 0x026ebf01, 0x066ebf16, 0x0270bf01, 0x0670bf16,
+        0x0272bf01, 0x0672bf16, 0x0275bf01, 0x0675bf16, 0x063abf00, 0x0642bf00,
+        0x0643bf00, 0x0644bf00, 0x0645bf00, 0x0646bf00, 0x0647bf00, 0x0648bf00,
+        0x0649bf00, 0x064abf00, 0x064bbf00, 0x064cbf00, 0x064dbf00, 0x064ebf00,
+        0x064fbf00, 0x0650bf00, 0x0651bf00, 0x0652bf00, 0x0653bf00, 0x0654bf00,
+        0x0655bf00, 0x0656bf00, 0x0657bf00, 0x0659bf00, 0x066abf00, 0x066bbf00,
+        0x0671bf00, 0x0676bf00, 0x0677bf00, 0x0678bf00, 0x0679bf00, 0x067abf00,
+        0x0100bf46, 0x0100bf47, 0x0100bf49, 0x0500bf4a
+    },
+    /* 173 */
+    {
+        0x0230c502, 0x0230c509, 0x0230c517, 0x0630c528, 0x0231c502, 0x0231c509,
+        0x0231c517, 0x0631c528, 0x0232c502, 0x0232c509, 0x0232c517, 0x0632c528,
+        0x0261c502, 0x0261c509, 0x0261c517, 0x0661c528, 0x0263c502, 0x0263c509,
+        0x0263c517, 0x0663c528, 0x0265c502, 0x0265c509, 0x0265c517, 0x0665c528,
+        0x0269c502, 0x0269c509, 0x0269c517, 0x0669c528, 0x026fc502, 0x026fc509,
+        0x026fc517, 0x066fc528, 0x0273c502, 0x0273c509, 0x0273c517, 0x0673c528,
+        0x0274c502, 0x0274c509, 0x0274c517, 0x0674c528, 0x0220c501, 0x0620c516,
+        0x0225c501, 0x0625c516, 0x022dc501, 0x062dc516, 0x022ec501, 0x062ec516,
+        0x022fc501, 0x062fc516, 0x0233c501, 0x0633c516, 0x0234c501, 0x0634c516,
+        0x0235c501, 0x0635c516, 0x0236c501, 0x0636c516, 0x0237c501, 0x0637c516,
+        0x0238c501, 0x0638c516, 0x0239c501, 0x0639c516, 0x023dc501, 0x063dc516,
+        0x0241c501, 0x0641c516, 0x025fc501, 0x065fc516, 0x0262c501, 0x0662c516,
+        0x0264c501, 0x0664c516, 0x0266c501, 0x0666c516, 0x0267c501, 0x0667c516,
+        0x0268c501, 0x0668c516, 0x026cc501, 0x066cc516, 0x026dc501, 0x066dc516,
+        0x026ec501, 0x066ec516, 0x0270c501, 0x0670c516, 0x0272c501, 0x0672c516,
+        0x0275c501, 0x0675c516, 0x063ac500, 0x0642c500, 0x0643c500, 0x0644c500,
+        0x0645c500, 0x0646c500, 0x0647c500, 0x0648c500, 0x0649c500, 0x064ac500,
+        0x064bc500, 0x064cc500, 0x064dc500, 0x064ec500, 0x064fc500, 0x0650c500,
+        0x0651c500, 0x0652c500, 0x0653c500, 0x0654c500, 0x0655c500, 0x0656c500,
+        0x0657c500, 0x0659c500, 0x066ac500, 0x066bc500, 0x0671c500, 0x0676c500,
+        0x0677c500, 0x0678c500, 0x0679c500, 0x067ac500, 0x0100c546, 0x0100c547,
+        0x0100c549, 0x0500c54a, 0x0230e702, 0x0230e709, 0x0230e717, 0x0630e728,
+        0x0231e702, 0x0231e709, 0x0231e717, 0x0631e728, 0x0232e702, 0x0232e709,
+        0x0232e717, 0x0632e728, 0x0261e702, 0x0261e709, 0x0261e717, 0x0661e728,
+        0x0263e702, 0x0263e709, 0x0263e717, 0x0663e728, 0x0265e702, 0x0265e709,
+        0x0265e717, 0x0665e728, 0x0269e702, 0x0269e709, 0x0269e717, 0x0669e728,
+        0x026fe702, 0x026fe709, 0x026fe717, 0x066fe728, 0x0273e702, 0x0273e709,
+        0x0273e717, 0x0673e728, 0x0274e702, 0x0274e709, 0x0274e717, 0x0674e728,
+        0x0220e701, 0x0620e716, 0x0225e701, 0x0625e716, 0x022de701, 0x062de716,
+        0x022ee701, 0x062ee716, 0x022fe701, 0x062fe716, 0x0233e701, 0x0633e716,
+        0x0234e701, 0x0634e716, 0x0235e701, 0x0635e716, 0x0236e701, 0x0636e716,
+        0x0237e701, 0x0637e716, 0x0238e701, 0x0638e716, 0x0239e701, 0x0639e716,
+        0x023de701, 0x063de716, 0x0241e701, 0x0641e716, 0x025fe701, 0x065fe716,
+        0x0262e701, 0x0662e716, 0x0264e701, 0x0664e716, 0x0266e701, 0x0666e716,
+        0x0267e701, 0x0667e716, 0x0268e701, 0x0668e716, 0x026ce701, 0x066ce716,
+        0x026de701, 0x066de716, 0x026ee701, 0x066ee716, 0x0270e701, 0x0670e716,
+        0x0272e701, 0x0672e716, 0x0275e701, 0x0675e716, 0x063ae700, 0x0642e700,
+        0x0643e700, 0x0644e700, 0x0645e700, 0x0646e700, 0x0647e700, 0x0648e700,
+        0x0649e700, 0x064ae700, 0x064be700, 0x064ce700, 0x064de700, 0x064ee700,
+        0x064fe700, 0x0650e700, 0x0651e700, 0x0652e700, 0x0653e700, 0x0654e700,
+        0x0655e700, 0x0656e700, 0x0657e700, 0x0659e700, 0x066ae700, 0x066be700,
+        0x0671e700, 0x0676e700, 0x0677e700, 0x0678e700, 0x0679e700, 0x067ae700,
+        0x0100e746, 0x0100e747, 0x0100e749, 0x0500e74a
+    },
+    /* 174 */
+    {
+        0x0230ef01, 0x0630ef16, 0x0231ef01, 0x0631ef16, 0x0232ef01, 0x0632ef16,
+        0x0261ef01, 0x0661ef16, 0x0263ef01, 0x0663ef16, 0x0265ef01, 0x0665ef16,
+        0x0269ef01, 0x0669ef16, 0x026fef01, 0x066fef16, 0x0273ef01, 0x0673ef16,
+        0x0274ef01, 0x0674ef16, 0x0620ef00, 0x0625ef00, 0x062def00, 0x062eef00,
+        0x062fef00, 0x0633ef00, 0x0634ef00, 0x0635ef00, 0x0636ef00, 0x0637ef00,
+        0x0638ef00, 0x0639ef00, 0x063def00, 0x0641ef00, 0x065fef00, 0x0662ef00,
+        0x0664ef00, 0x0666ef00, 0x0667ef00, 0x0668ef00, 0x066cef00, 0x066def00,
+        0x066eef00, 0x0670ef00, 0x0672ef00, 0x0675ef00, 0x0100ef26, 0x0100ef27,
+        0x0100ef2c, 0x0100ef2d, 0x0100ef2f, 0x0100ef30, 0x0100ef33, 0x0100ef34,
+        0x0100ef36, 0x0100ef37, 0x0100ef3b, 0x0100ef3c, 0x0100ef3e, 0x0100ef3f,
+        0x0100ef42, 0x0100ef43, 0x0100ef45, 0x0500ef48, 0x06300900, 0x06310900,
+        0x06320900, 0x06610900, 0x06630900, 0x06650900, 0x06690900, 0x066f0900,
+        0x06730900, 0x06740900, 0x0100090d, 0x0100090e, 0x01000911, 0x01000912,
+        0x01000914, 0x01000915, 0x0100091a, 0x0100091b, 0x0100091d, 0x0100091e,
+        0x01000921, 0x01000922, 0x01000924, 0x01000925, 0x0100092b, 0x0100092e,
+        0x01000932, 0x01000935, 0x0100093a, 0x0100093d, 0x01000941, 0x05000944,
+        0x06308e00, 0x06318e00, 0x06328e00, 0x06618e00, 0x06638e00, 0x06658e00,
+        0x06698e00, 0x066f8e00, 0x06738e00, 0x06748e00, 0x01008e0d, 0x01008e0e,
+        0x01008e11, 0x01008e12, 0x01008e14, 0x01008e15, 0x01008e1a, 0x01008e1b,
+        0x01008e1d, 0x01008e1e, 0x01008e21, 0x01008e22, 0x01008e24, 0x01008e25,
+        0x01008e2b, 0x01008e2e, 0x01008e32, 0x01008e35, 0x01008e3a, 0x01008e3d,
+        0x01008e41, 0x05008e44, 0x06309000, 0x06319000, 0x06329000, 0x06619000,
+        0x06639000, 0x06659000, 0x06699000, 0x066f9000, 0x06739000, 0x06749000,
+        0x0100900d, 0x0100900e, 0x01009011, 0x01009012, 0x01009014, 0x01009015,
+        0x0100901a, 0x0100901b, 0x0100901d, 0x0100901e, 0x01009021, 0x01009022,
+        0x01009024, 0x01009025, 0x0100902b, 0x0100902e, 0x01009032, 0x01009035,
+        0x0100903a, 0x0100903d, 0x01009041, 0x05009044, 0x06309100, 0x06319100,
+        0x06329100, 0x06619100, 0x06639100, 0x06659100, 0x06699100, 0x066f9100,
+        0x06739100, 0x06749100, 0x0100910d, 0x0100910e, 0x01009111, 0x01009112,
+        0x01009114, 0x01009115, 0x0100911a, 0x0100911b, 0x0100911d, 0x0100911e,
+        0x01009121, 0x01009122, 0x01009124, 0x01009125, 0x0100912b, 0x0100912e,
+        0x01009132, 0x01009135, 0x0100913a, 0x0100913d, 0x01009141, 0x05009144,
+        0x06309400, 0x06319400, 0x06329400, 0x06619400, 0x06639400, 0x06659400,
+        0x06699400, 0x066f9400, 0x06739400, 0x06749400, 0x0100940d, 0x0100940e,
+        0x01009411, 0x01009412, 0x01009414, 0x01009415, 0x0100941a, 0x0100941b,
+        0x0100941d, 0x0100941e, 0x01009421, 0x01009422, 0x01009424, 0x01009425,
+        0x0100942b, 0x0100942e, 0x01009432, 0x01009435, 0x0100943a, 0x0100943d,
+        0x01009441, 0x05009444, 0x06309f00, 0x06319f00, 0x06329f00, 0x06619f00,
+        0x06639f00, 0x06659f00, 0x06699f00, 0x066f9f00, 0x06739f00, 0x06749f00,
+        0x01009f0d, 0x01009f0e, 0x01009f11, 0x01009f12, 0x01009f14, 0x01009f15,
+        0x01009f1a, 0x01009f1b, 0x01009f1d, 0x01009f1e, 0x01009f21, 0x01009f22,
+        0x01009f24, 0x01009f25, 0x01009f2b, 0x01009f2e, 0x01009f32, 0x01009f35,
+        0x01009f3a, 0x01009f3d, 0x01009f41, 0x05009f44
+    },
+    /* 175 */
+    {
+        0x0230ef02, 0x0230ef09, 0x0230ef17, 0x0630ef28, 0x0231ef02, 0x0231ef09,
+        0x0231ef17, 0x0631ef28, 0x0232ef02, 0x0232ef09, 0x0232ef17, 0x0632ef28,
+        0x0261ef02, 0x0261ef09, 0x0261ef17, 0x0661ef28, 0x0263ef02, 0x0263ef09,
+        0x0263ef17, 0x0663ef28, 0x0265ef02, 0x0265ef09, 0x0265ef17, 0x0665ef28,
+        0x0269ef02, 0x0269ef09, 0x0269ef17, 0x0669ef28, 0x026fef02, 0x026fef09,
+        0x026fef17, 0x066fef28, 0x0273ef02, 0x0273ef09, 0x0273ef17, 0x0673ef28,
+        0x0274ef02, 0x0274ef09, 0x0274ef17, 0x0674ef28, 0x0220ef01, 0x0620ef16,
+        0x0225ef01, 0x0625ef16, 0x022def01, 0x062def16, 0x022eef01, 0x062eef16,
+        0x022fef01, 0x062fef16, 0x0233ef01, 0x0633ef16, 0x0234ef01, 0x0634ef16,
+        0x0235ef01, 0x0635ef16, 0x0236ef01, 0x0636ef16, 0x0237ef01, 0x0637ef16,
+        0x0238ef01, 0x0638ef16, 0x0239ef01, 0x0639ef16, 0x023def01, 0x063def16,
+        0x0241ef01, 0x0641ef16, 0x025fef01, 0x065fef16, 0x0262ef01, 0x0662ef16,
+        0x0264ef01, 0x0664ef16, 0x0266ef01, 0x0666ef16, 0x0267ef01, 0x0667ef16,
+        0x0268ef01, 0x0668ef16, 0x026cef01, 0x066cef16, 0x026def01, 0x066def16,
+        0x026eef01, 0x066eef16, 0x0270ef01, 0x0670ef16, 0x0272ef01, 0x0672ef16,
+        0x0275ef01, 0x0675ef16, 0x063aef00, 0x0642ef00, 0x0643ef00, 0x0644ef00,
+        0x0645ef00, 0x0646ef00, 0x0647ef00, 0x0648ef00, 0x0649ef00, 0x064aef00,
+        0x064bef00, 0x064cef00, 0x064def00, 0x064eef00, 0x064fef00, 0x0650ef00,
+        0x0651ef00, 0x0652ef00, 0x0653ef00, 0x0654ef00, 0x0655ef00, 0x0656ef00,
+        0x0657ef00, 0x0659ef00, 0x066aef00, 0x066bef00, 0x0671ef00, 0x0676ef00,
+        0x0677ef00, 0x0678ef00, 0x0679ef00, 0x067aef00, 0x0100ef46, 0x0100ef47,
+        0x0100ef49, 0x0500ef4a, 0x02300901, 0x06300916, 0x02310901, 0x06310916,
+        0x02320901, 0x06320916, 0x02610901, 0x06610916, 0x02630901, 0x06630916,
+        0x02650901, 0x06650916, 0x02690901, 0x06690916, 0x026f0901, 0x066f0916,
+        0x02730901, 0x06730916, 0x02740901, 0x06740916, 0x06200900, 0x06250900,
+        0x062d0900, 0x062e0900, 0x062f0900, 0x06330900, 0x06340900, 0x06350900,
+        0x06360900, 0x06370900, 0x06380900, 0x06390900, 0x063d0900, 0x06410900,
+        0x065f0900, 0x06620900, 0x06640900, 0x06660900, 0x06670900, 0x06680900,
+        0x066c0900, 0x066d0900, 0x066e0900, 0x06700900, 0x06720900, 0x06750900,
+        0x01000926, 0x01000927, 0x0100092c, 0x0100092d, 0x0100092f, 0x01000930,
+        0x01000933, 0x01000934, 0x01000936, 0x01000937, 0x0100093b, 0x0100093c,
+        0x0100093e, 0x0100093f, 0x01000942, 0x01000943, 0x01000945, 0x05000948,
+        0x02308e01, 0x06308e16, 0x02318e01, 0x06318e16, 0x02328e01, 0x06328e16,
+        0x02618e01, 0x06618e16, 0x02638e01, 0x06638e16, 0x02658e01, 0x06658e16,
+        0x02698e01, 0x06698e16, 0x026f8e01, 0x066f8e16, 0x02738e01, 0x06738e16,
+        0x02748e01, 0x06748e16, 0x06208e00, 0x06258e00, 0x062d8e00, 0x062e8e00,
+        0x062f8e00, 0x06338e00, 0x06348e00, 0x06358e00, 0x06368e00, 0x06378e00,
+        0x06388e00, 0x06398e00, 0x063d8e00, 0x06418e00, 0x065f8e00, 0x06628e00,
+        0x06648e00, 0x06668e00, 0x06678e00, 0x06688e00, 0x066c8e00, 0x066d8e00,
+        0x066e8e00, 0x06708e00, 0x06728e00, 0x06758e00, 0x01008e26, 0x01008e27,
+        0x01008e2c, 0x01008e2d, 0x01008e2f, 0x01008e30, 0x01008e33, 0x01008e34,
+        0x01008e36, 0x01008e37, 0x01008e3b, 0x01008e3c, 0x01008e3e, 0x01008e3f,
+        0x01008e42, 0x01008e43, 0x01008e45, 0x05008e48
+    },
+    /* 176 */
+    {
+        0x02300902, 0x02300909, 0x02300917, 0x06300928, 0x02310902, 0x02310909,
+        0x02310917, 0x06310928, 0x02320902, 0x02320909, 0x02320917, 0x06320928,
+        0x02610902, 0x02610909, 0x02610917, 0x06610928, 0x02630902, 0x02630909,
+        0x02630917, 0x06630928, 0x02650902, 0x02650909, 0x02650917, 0x06650928,
+        0x02690902, 0x02690909, 0x02690917, 0x06690928, 0x026f0902, 0x026f0909,
+        0x026f0917, 0x066f0928, 0x02730902, 0x02730909, 0x02730917, 0x06730928,
+        0x02740902, 0x02740909, 0x02740917, 0x06740928, 0x02200901, 0x06200916,
+        0x02250901, 0x06250916, 0x022d0901, 0x062d0916, 0x022e0901, 0x062e0916,
+        0x022f0901, 0x062f0916, 0x02330901, 0x06330916, 0x02340901, 0x06340916,
+        0x02350901, 0x06350916, 0x02360901, 0x06360916, 0x02370901, 0x06370916,
+        0x02380901, 0x06380916, 0x02390901, 0x06390916, 0x023d0901, 0x063d0916,
+        0x02410901, 0x06410916, 0x025f0901, 0x065f0916, 0x02620901, 0x06620916,
+        0x02640901, 0x06640916, 0x02660901, 0x06660916, 0x02670901, 0x06670916,
+        0x02680901, 0x06680916, 0x026c0901, 0x066c0916, 0x026d0901, 0x066d0916,
+        0x026e0901, 0x066e0916, 0x02700901, 0x06700916, 0x02720901, 0x06720916,
+        0x02750901, 0x06750916, 0x063a0900, 0x06420900, 0x06430900, 0x06440900,
+        0x06450900, 0x06460900, 0x06470900, 0x06480900, 0x06490900, 0x064a0900,
+        0x064b0900, 0x064c0900, 0x064d0900, 0x064e0900, 0x064f0900, 0x06500900,
+        0x06510900, 0x06520900, 0x06530900, 0x06540900, 0x06550900, 0x06560900,
+        0x06570900, 0x06590900, 0x066a0900, 0x066b0900, 0x06710900, 0x06760900,
+        0x06770900, 0x06780900, 0x06790900, 0x067a0900, 0x01000946, 0x01000947,
+        0x01000949, 0x0500094a, 0x02308e02, 0x02308e09, 0x02308e17, 0x06308e28,
+        0x02318e02, 0x02318e09, 0x02318e17, 0x06318e28, 0x02328e02, 0x02328e09,
+        0x02328e17, 0x06328e28, 0x02618e02, 0x02618e09, 0x02618e17, 0x06618e28,
+        0x02638e02, 0x02638e09, 0x02638e17, 0x06638e28, 0x02658e02, 0x02658e09,
+        0x02658e17, 0x06658e28, 0x02698e02, 0x02698e09, 0x02698e17, 0x06698e28,
+        0x026f8e02, 0x026f8e09, 0x026f8e17, 0x066f8e28, 0x02738e02, 0x02738e09,
+        0x02738e17, 0x06738e28, 0x02748e02, 0x02748e09, 0x02748e17, 0x06748e28,
+        0x02208e01, 0x06208e16, 0x02258e01, 0x06258e16, 0x022d8e01, 0x062d8e16,
+        0x022e8e01, 0x062e8e16, 0x022f8e01, 0x062f8e16, 0x02338e01, 0x06338e16,
+        0x02348e01, 0x06348e16, 0x02358e01, 0x06358e16, 0x02368e01, 0x06368e16,
+        0x02378e01, 0x06378e16, 0x02388e01, 0x06388e16, 0x02398e01, 0x06398e16,
+        0x023d8e01, 0x063d8e16, 0x02418e01, 0x06418e16, 0x025f8e01, 0x065f8e16,
+        0x02628e01, 0x06628e16, 0x02648e01, 0x06648e16, 0x02668e01, 0x06668e16,
+        0x02678e01, 0x06678e16, 0x02688e01, 0x06688e16, 0x026c8e01, 0x066c8e16,
+        0x026d8e01, 0x066d8e16, 0x026e8e01, 0x066e8e16, 0x02708e01, 0x06708e16,
+        0x02728e01, 0x06728e16, 0x02758e01, 0x06758e16, 0x063a8e00, 0x06428e00,
+        0x06438e00, 0x06448e00, 0x06458e00, 0x06468e00, 0x06478e00, 0x06488e00,
+        0x06498e00, 0x064a8e00, 0x064b8e00, 0x064c8e00, 0x064d8e00, 0x064e8e00,
+        0x064f8e00, 0x06508e00, 0x06518e00, 0x06528e00, 0x06538e00, 0x06548e00,
+        0x06558e00, 0x06568e00, 0x06578e00, 0x06598e00, 0x066a8e00, 0x066b8e00,
+        0x06718e00, 0x06768e00, 0x06778e00, 0x06788e00, 0x06798e00, 0x067a8e00,
+        0x01008e46, 0x01008e47, 0x01008e49, 0x05008e4a
+    },
+    /* 177 */
+    {
+        0x02309001, 0x06309016, 0x02319001, 0x06319016, 0x02329001, 0x06329016,
+        0x02619001, 0x06619016, 0x02639001, 0x06639016, 0x02659001, 0x06659016,
+        0x02699001, 0x06699016, 0x026f9001, 0x066f9016, 0x02739001, 0x06739016,
+        0x02749001, 0x06749016, 0x06209000, 0x06259000, 0x062d9000, 0x062e9000,
+        0x062f9000, 0x06339000, 0x06349000, 0x06359000, 0x06369000, 0x06379000,
+        0x06389000, 0x06399000, 0x063d9000, 0x06419000, 0x065f9000, 0x06629000,
+        0x06649000, 0x06669000, 0x06679000, 0x06689000, 0x066c9000, 0x066d9000,
+        0x066e9000, 0x06709000, 0x06729000, 0x06759000, 0x01009026, 0x01009027,
+        0x0100902c, 0x0100902d, 0x0100902f, 0x01009030, 0x01009033, 0x01009034,
+        0x01009036, 0x01009037, 0x0100903b, 0x0100903c, 0x0100903e, 0x0100903f,
+        0x01009042, 0x01009043, 0x01009045, 0x05009048, 0x02309101, 0x06309116,
+        0x02319101, 0x06319116, 0x02329101, 0x06329116, 0x02619101, 0x06619116,
+        0x02639101, 0x06639116, 0x02659101, 0x06659116, 0x02699101, 0x06699116,
+        0x026f9101, 0x066f9116, 0x02739101, 0x06739116, 0x02749101, 0x06749116,
+        0x06209100, 0x06259100, 0x062d9100, 0x062e9100, 0x062f9100, 0x06339100,
+        0x06349100, 0x06359100, 0x06369100, 0x06379100, 0x06389100, 0x06399100,
+        0x063d9100, 0x06419100, 0x065f9100, 0x06629100, 0x06649100, 0x06669100,
+        0x06679100, 0x06689100, 0x066c9100, 0x066d9100, 0x066e9100, 0x06709100,
+        0x06729100, 0x06759100, 0x01009126, 0x01009127, 0x0100912c, 0x0100912d,
+        0x0100912f, 0x01009130, 0x01009133, 0x01009134, 0x01009136, 0x01009137,
+        0x0100913b, 0x0100913c, 0x0100913e, 0x0100913f, 0x01009142, 0x01009143,
+        0x01009145, 0x05009148, 0x02309401, 0x06309416, 0x02319401, 0x06319416,
+        0x02329401, 0x06329416, 0x02619401, 0x06619416, 0x02639401, 0x06639416,
+        0x02659401, 0x06659416, 0x02699401, 0x06699416, 0x026f9401, 0x066f9416,
+        0x02739401, 0x06739416, 0x02749401, 0x06749416, 0x06209400, 0x06259400,
+        0x062d9400, 0x062e9400, 0x062f9400, 0x06339400, 0x06349400, 0x06359400,
+        0x06369400, 0x06379400, 0x06389400, 0x06399400, 0x063d9400, 0x06419400,
+        0x065f9400, 0x06629400, 0x06649400, 0x06669400, 0x06679400, 0x06689400,
+        0x066c9400, 0x066d9400, 0x066e9400, 0x06709400, 0x06729400, 0x06759400,
+        0x01009426, 0x01009427, 0x0100942c, 0x0100942d, 0x0100942f, 0x01009430,
+        0x01009433, 0x01009434, 0x01009436, 0x01009437, 0x0100943b, 0x0100943c,
+        0x0100943e, 0x0100943f, 0x01009442, 0x01009443, 0x01009445, 0x05009448,
+        0x02309f01, 0x06309f16, 0x02319f01, 0x06319f16, 0x02329f01, 0x06329f16,
+        0x02619f01, 0x06619f16, 0x02639f01, 0x06639f16, 0x02659f01, 0x06659f16,
+        0x02699f01, 0x06699f16, 0x026f9f01, 0x066f9f16, 0x02739f01, 0x06739f16,
+        0x02749f01, 0x06749f16, 0x06209f00, 0x06259f00, 0x062d9f00, 0x062e9f00,
+        0x062f9f00, 0x06339f00, 0x06349f00, 0x06359f00, 0x06369f00, 0x06379f00,
+        0x06389f00, 0x06399f00, 0x063d9f00, 0x06419f00, 0x065f9f00, 0x06629f00,
+        0x06649f00, 0x06669f00, 0x06679f00, 0x06689f00, 0x066c9f00, 0x066d9f00,
+        0x066e9f00, 0x06709f00, 0x06729f00, 0x06759f00, 0x01009f26, 0x01009f27,
+        0x01009f2c, 0x01009f2d, 0x01009f2f, 0x01009f30, 0x01009f33, 0x01009f34,
+        0x01009f36, 0x01009f37, 0x01009f3b, 0x01009f3c, 0x01009f3e, 0x01009f3f,
+        0x01009f42, 0x01009f43, 0x01009f45, 0x05009f48
+    },
+    /* 178 */
+    {
+        0x02309002, 0x02309009, 0x02309017, 0x06309028, 0x02319002, 0x02319009,
+        0x02319017, 0x06319028, 0x02329002, 0x02329009, 0x02329017, 0x06329028,
+        0x02619002, 0x02619009, 0x02619017, 0x06619028, 0x02639002, 0x02639009,
+        0x02639017, 0x06639028, 0x02659002, 0x02659009, 0x02659017, 0x06659028,
+        0x02699002, 0x02699009, 0x02699017, 0x06699028, 0x026f9002, 0x026f9009,
+        0x026f9017, 0x066f9028, 0x02739002, 0x02739009, 0x02739017, 0x06739028,
+        0x02749002, 0x02749009, 0x02749017, 0x06749028, 0x02209001, 0x06209016,
+        0x02259001, 0x06259016, 0x022d9001, 0x062d9016, 0x022e9001, 0x062e9016,
+        0x022f9001, 0x062f9016, 0x02339001, 0x06339016, 0x02349001, 0x06349016,
+        0x02359001, 0x06359016, 0x02369001, 0x06369016, 0x02379001, 0x06379016,
+        0x02389001, 0x06389016, 0x02399001, 0x06399016, 0x023d9001, 0x063d9016,
+        0x02419001, 0x06419016, 0x025f9001, 0x065f9016, 0x02629001, 0x06629016,
+        0x02649001, 0x06649016, 0x02669001, 0x06669016, 0x02679001, 0x06679016,
+        0x02689001, 0x06689016, 0x026c9001, 0x066c9016, 0x026d9001, 0x066d9016,
+        0x026e9001, 0x066e9016, 0x02709001, 0x06709016, 0x02729001, 0x06729016,
+        0x02759001, 0x06759016, 0x063a9000, 0x06429000, 0x06439000, 0x06449000,
+        0x06459000, 0x06469000, 0x06479000, 0x06489000, 0x06499000, 0x064a9000,
+        0x064b9000, 0x064c9000, 0x064d9000, 0x064e9000, 0x064f9000, 0x06509000,
+        0x06519000, 0x06529000, 0x06539000, 0x06549000, 0x06559000, 0x06569000,
+        0x06579000, 0x06599000, 0x066a9000, 0x066b9000, 0x06719000, 0x06769000,
+        0x06779000, 0x06789000, 0x06799000, 0x067a9000, 0x01009046, 0x01009047,
+        0x01009049, 0x0500904a, 0x02309102, 0x02309109, 0x02309117, 0x06309128,
+        0x02319102, 0x02319109, 0x02319117, 0x06319128, 0x02329102, 0x02329109,
+        0x02329117, 0x06329128, 0x02619102, 0x02619109, 0x02619117, 0x06619128,
+        0x02639102, 0x02639109, 0x02639117, 0x06639128, 0x02659102, 0x02659109,
+        0x02659117, 0x06659128, 0x02699102, 0x02699109, 0x02699117, 0x06699128,
+        0x026f9102, 0x026f9109, 0x026f9117, 0x066f9128, 0x02739102, 0x02739109,
+        0x02739117, 0x06739128, 0x02749102, 0x02749109, 0x02749117, 0x06749128,
+        0x02209101, 0x06209116, 0x02259101, 0x06259116, 0x022d9101, 0x062d9116,
+        0x022e9101, 0x062e9116, 0x022f9101, 0x062f9116, 0x02339101, 0x06339116,
+        0x02349101, 0x06349116, 0x02359101, 0x06359116, 0x02369101, 0x06369116,
+        0x02379101, 0x06379116, 0x02389101, 0x06389116, 0x02399101, 0x06399116,
+        0x023d9101, 0x063d9116, 0x02419101, 0x06419116, 0x025f9101, 0x065f9116,
+        0x02629101, 0x06629116, 0x02649101, 0x06649116, 0x02669101, 0x06669116,
+        0x02679101, 0x06679116, 0x02689101, 0x06689116, 0x026c9101, 0x066c9116,
+        0x026d9101, 0x066d9116, 0x026e9101, 0x066e9116, 0x02709101, 0x06709116,
+        0x02729101, 0x06729116, 0x02759101, 0x06759116, 0x063a9100, 0x06429100,
+        0x06439100, 0x06449100, 0x06459100, 0x06469100, 0x06479100, 0x06489100,
+        0x06499100, 0x064a9100, 0x064b9100, 0x064c9100, 0x064d9100, 0x064e9100,
+        0x064f9100, 0x06509100, 0x06519100, 0x06529100, 0x06539100, 0x06549100,
+        0x06559100, 0x06569100, 0x06579100, 0x06599100, 0x066a9100, 0x066b9100,
+        0x06719100, 0x06769100, 0x06779100, 0x06789100, 0x06799100, 0x067a9100,
+        0x01009146, 0x01009147, 0x01009149, 0x0500914a
+    },
+    /* 179 */
+    {
+        0x02309402, 0x02309409, 0x02309417, 0x06309428, 0x02319402, 0x02319409,
+        0x02319417, 0x06319428, 0x02329402, 0x02329409, 0x02329417, 0x06329428,
+        0x02619402, 0x02619409, 0x02619417, 0x06619428, 0x02639402, 0x02639409,
+        0x02639417, 0x06639428, 0x02659402, 0x02659409, 0x02659417, 0x06659428,
+        0x02699402, 0x02699409, 0x02699417, 0x06699428, 0x026f9402, 0x026f9409,
+        0x026f9417, 0x066f9428, 0x02739402, 0x02739409, 0x02739417, 0x06739428,
+        0x02749402, 0x02749409, 0x02749417, 0x06749428, 0x02209401, 0x06209416,
+        0x02259401, 0x06259416, 0x022d9401, 0x062d9416, 0x022e9401, 0x062e9416,
+        0x022f9401, 0x062f9416, 0x02339401, 0x06339416, 0x02349401, 0x06349416,
+        0x02359401, 0x06359416, 0x02369401, 0x06369416, 0x02379401, 0x06379416,
+        0x02389401, 0x06389416, 0x02399401, 0x06399416, 0x023d9401, 0x063d9416,
+        0x02419401, 0x06419416, 0x025f9401, 0x065f9416, 0x02629401, 0x06629416,
+        0x02649401, 0x06649416, 0x02669401, 0x06669416, 0x02679401, 0x06679416,
+        0x02689401, 0x06689416, 0x026c9401, 0x066c9416, 0x026d9401, 0x066d9416,
+        0x026e9401, 0x066e9416, 0x02709401, 0x06709416, 0x02729401, 0x06729416,
+        0x02759401, 0x06759416, 0x063a9400, 0x06429400, 0x06439400, 0x06449400,
+        0x06459400, 0x06469400, 0x06479400, 0x06489400, 0x06499400, 0x064a9400,
+        0x064b9400, 0x064c9400, 0x064d9400, 0x064e9400, 0x064f9400, 0x06509400,
+        0x06519400, 0x06529400, 0x06539400, 0x06549400, 0x06559400, 0x06569400,
+        0x06579400, 0x06599400, 0x066a9400, 0x066b9400, 0x06719400, 0x06769400,
+        0x06779400, 0x06789400, 0x06799400, 0x067a9400, 0x01009446, 0x01009447,
+        0x01009449, 0x0500944a, 0x02309f02, 0x02309f09, 0x02309f17, 0x06309f28,
+        0x02319f02, 0x02319f09, 0x02319f17, 0x06319f28, 0x02329f02, 0x02329f09,
+        0x02329f17, 0x06329f28, 0x02619f02, 0x02619f09, 0x02619f17, 0x06619f28,
+        0x02639f02, 0x02639f09, 0x02639f17, 0x06639f28, 0x02659f02, 0x02659f09,
+        0x02659f17, 0x06659f28, 0x02699f02, 0x02699f09, 0x02699f17, 0x06699f28,
+        0x026f9f02, 0x026f9f09, 0x026f9f17, 0x066f9f28, 0x02739f02, 0x02739f09,
+        0x02739f17, 0x06739f28, 0x02749f02, 0x02749f09, 0x02749f17, 0x06749f28,
+        0x02209f01, 0x06209f16, 0x02259f01, 0x06259f16, 0x022d9f01, 0x062d9f16,
+        0x022e9f01, 0x062e9f16, 0x022f9f01, 0x062f9f16, 0x02339f01, 0x06339f16,
+        0x02349f01, 0x06349f16, 0x02359f01, 0x06359f16, 0x02369f01, 0x06369f16,
+        0x02379f01, 0x06379f16, 0x02389f01, 0x06389f16, 0x02399f01, 0x06399f16,
+        0x023d9f01, 0x063d9f16, 0x02419f01, 0x06419f16, 0x025f9f01, 0x065f9f16,
+        0x02629f01, 0x06629f16, 0x02649f01, 0x06649f16, 0x02669f01, 0x06669f16,
+        0x02679f01, 0x06679f16, 0x02689f01, 0x06689f16, 0x026c9f01, 0x066c9f16,
+        0x026d9f01, 0x066d9f16, 0x026e9f01, 0x066e9f16, 0x02709f01, 0x06709f16,
+        0x02729f01, 0x06729f16, 0x02759f01, 0x06759f16, 0x063a9f00, 0x06429f00,
+        0x06439f00, 0x06449f00, 0x06459f00, 0x06469f00, 0x06479f00, 0x06489f00,
+        0x06499f00, 0x064a9f00, 0x064b9f00, 0x064c9f00, 0x064d9f00, 0x064e9f00,
+        0x064f9f00, 0x06509f00, 0x06519f00, 0x06529f00, 0x06539f00, 0x06549f00,
+        0x06559f00, 0x06569f00, 0x06579f00, 0x06599f00, 0x066a9f00, 0x066b9f00,
+        0x06719f00, 0x06769f00, 0x06779f00, 0x06789f00, 0x06799f00, 0x067a9f00,
+        0x01009f46, 0x01009f47, 0x01009f49, 0x05009f4a
+    },
+    /* 180 */
+    {
+        0x0100ab04, 0x0100ab05, 0x0100ab07, 0x0100ab08, 0x0100ab0b, 0x0100ab0c,
+        0x0100ab10, 0x0100ab13, 0x0100ab19, 0x0100ab1c, 0x0100ab20, 0x0100ab23,
+        0x0100ab2a, 0x0100ab31, 0x0100ab39, 0x0500ab40, 0x0100ce04, 0x0100ce05,
+        0x0100ce07, 0x0100ce08, 0x0100ce0b, 0x0100ce0c, 0x0100ce10, 0x0100ce13,
+        0x0100ce19, 0x0100ce1c, 0x0100ce20, 0x0100ce23, 0x0100ce2a, 0x0100ce31,
+        0x0100ce39, 0x0500ce40, 0x0100d704, 0x0100d705, 0x0100d707, 0x0100d708,
+        0x0100d70b, 0x0100d70c, 0x0100d710, 0x0100d713, 0x0100d719, 0x0100d71c,
+        0x0100d720, 0x0100d723, 0x0100d72a, 0x0100d731, 0x0100d739, 0x0500d740,
+        0x0100e104, 0x0100e105, 0x0100e107, 0x0100e108, 0x0100e10b, 0x0100e10c,
+        0x0100e110, 0x0100e113, 0x0100e119, 0x0100e11c, 0x0100e120, 0x0100e123,
+        0x0100e12a, 0x0100e131, 0x0100e139, 0x0500e140, 0x0100ec04, 0x0100ec05,
+        0x0100ec07, 0x0100ec08, 0x0100ec0b, 0x0100ec0c, 0x0100ec10, 0x0100ec13,
+        0x0100ec19, 0x0100ec1c, 0x0100ec20, 0x0100ec23, 0x0100ec2a, 0x0100ec31,
+        0x0100ec39, 0x0500ec40, 0x0100ed04, 0x0100ed05, 0x0100ed07, 0x0100ed08,
+        0x0100ed0b, 0x0100ed0c, 0x0100ed10, 0x0100ed13, 0x0100ed19, 0x0100ed1c,
+        0x0100ed20, 0x0100ed23, 0x0100ed2a, 0x0100ed31, 0x0100ed39, 0x0500ed40,
+        0x0100c703, 0x0100c706, 0x0100c70a, 0x0100c70f, 0x0100c718, 0x0100c71f,
+        0x0100c729, 0x0500c738, 0x0100cf03, 0x0100cf06, 0x0100cf0a, 0x0100cf0f,
+        0x0100cf18, 0x0100cf1f, 0x0100cf29, 0x0500cf38, 0x0100ea03, 0x0100ea06,
+        0x0100ea0a, 0x0100ea0f, 0x0100ea18, 0x0100ea1f, 0x0100ea29, 0x0500ea38,
+        0x0100eb03, 0x0100eb06, 0x0100eb0a, 0x0100eb0f, 0x0100eb18, 0x0100eb1f,
+        0x0100eb29, 0x0500eb38, 0x0100c002, 0x0100c009, 0x0100c017, 0x0500c028,
+        0x0100c102, 0x0100c109, 0x0100c117, 0x0500c128, 0x0100c802, 0x0100c809,
+        0x0100c817, 0x0500c828, 0x0100c902, 0x0100c909, 0x0100c917, 0x0500c928,
+        0x0100ca02, 0x0100ca09, 0x0100ca17, 0x0500ca28, 0x0100cd02, 0x0100cd09,
+        0x0100cd17, 0x0500cd28, 0x0100d202, 0x0100d209, 0x0100d217, 0x0500d228,
+        0x0100d502, 0x0100d509, 0x0100d517, 0x0500d528, 0x0100da02, 0x0100da09,
+        0x0100da17, 0x0500da28, 0x0100db02, 0x0100db09, 0x0100db17, 0x0500db28,
+        0x0100ee02, 0x0100ee09, 0x0100ee17, 0x0500ee28, 0x0100f002, 0x0100f009,
+        0x0100f017, 0x0500f028, 0x0100f202, 0x0100f209, 0x0100f217, 0x0500f228,
+        0x0100f302, 0x0100f309, 0x0100f317, 0x0500f328, 0x0100ff02, 0x0100ff09,
+        0x0100ff17, 0x0500ff28, 0x0100cb01, 0x0500cb16, 0x0100cc01, 0x0500cc16,
+        0x0100d301, 0x0500d316, 0x0100d401, 0x0500d416, 0x0100d601, 0x0500d616,
+        0x0100dd01, 0x0500dd16, 0x0100de01, 0x0500de16, 0x0100df01, 0x0500df16,
+        0x0100f101, 0x0500f116, 0x0100f401, 0x0500f416, 0x0100f501, 0x0500f516,
+        0x0100f601, 0x0500f616, 0x0100f701, 0x0500f716, 0x0100f801, 0x0500f816,
+        0x0100fa01, 0x0500fa16, 0x0100fb01, 0x0500fb16, 0x0100fc01, 0x0500fc16,
+        0x0100fd01, 0x0500fd16, 0x0100fe01, 0x0500fe16, 0x05000200, 0x05000300,
+        0x05000400, 0x05000500, 0x05000600, 0x05000700, 0x05000800, 0x05000b00,
+        0x05000c00, 0x05000e00, 0x05000f00, 0x05001000, 0x05001100, 0x05001200,
+        0x05001300, 0x05001400, 0x05001500, 0x05001700, 0x05001800, 0x05001900,
+        0x05001a00, 0x05001b00, 0x05001c00, 0x05001d00, 0x05001e00, 0x05001f00,
+        0x05007f00, 0x0500dc00, 0x0500f900, 0x040000fd
+    },
+    /* 181 */
+    {
+        0x0630ab00, 0x0631ab00, 0x0632ab00, 0x0661ab00, 0x0663ab00, 0x0665ab00,
+        0x0669ab00, 0x066fab00, 0x0673ab00, 0x0674ab00, 0x0100ab0d, 0x0100ab0e,
+        0x0100ab11, 0x0100ab12, 0x0100ab14, 0x0100ab15, 0x0100ab1a, 0x0100ab1b,
+        0x0100ab1d, 0x0100ab1e, 0x0100ab21, 0x0100ab22, 0x0100ab24, 0x0100ab25,
+        0x0100ab2b, 0x0100ab2e, 0x0100ab32, 0x0100ab35, 0x0100ab3a, 0x0100ab3d,
+        0x0100ab41, 0x0500ab44, 0x0630ce00, 0x0631ce00, 0x0632ce00, 0x0661ce00,
+        0x0663ce00, 0x0665ce00, 0x0669ce00, 0x066fce00, 0x0673ce00, 0x0674ce00,
+        0x0100ce0d, 0x0100ce0e, 0x0100ce11, 0x0100ce12, 0x0100ce14, 0x0100ce15,
+        0x0100ce1a, 0x0100ce1b, 0x0100ce1d, 0x0100ce1e, 0x0100ce21, 0x0100ce22,
+        0x0100ce24, 0x0100ce25, 0x0100ce2b, 0x0100ce2e, 0x0100ce32, 0x0100ce35,
+        0x0100ce3a, 0x0100ce3d, 0x0100ce41, 0x0500ce44, 0x0630d700, 0x0631d700,
+        0x0632d700, 0x0661d700, 0x0663d700, 0x0665d700, 0x0669d700, 0x066fd700,
+        0x0673d700, 0x0674d700, 0x0100d70d, 0x0100d70e, 0x0100d711, 0x0100d712,
+        0x0100d714, 0x0100d715, 0x0100d71a, 0x0100d71b, 0x0100d71d, 0x0100d71e,
+        0x0100d721, 0x0100d722, 0x0100d724, 0x0100d725, 0x0100d72b, 0x0100d72e,
+        0x0100d732, 0x0100d735, 0x0100d73a, 0x0100d73d, 0x0100d741, 0x0500d744,
+        0x0630e100, 0x0631e100, 0x0632e100, 0x0661e100, 0x0663e100, 0x0665e100,
+        0x0669e100, 0x066fe100, 0x0673e100, 0x0674e100, 0x0100e10d, 0x0100e10e,
+        0x0100e111, 0x0100e112, 0x0100e114, 0x0100e115, 0x0100e11a, 0x0100e11b,
+        0x0100e11d, 0x0100e11e, 0x0100e121, 0x0100e122, 0x0100e124, 0x0100e125,
+        0x0100e12b, 0x0100e12e, 0x0100e132, 0x0100e135, 0x0100e13a, 0x0100e13d,
+        0x0100e141, 0x0500e144, 0x0630ec00, 0x0631ec00, 0x0632ec00, 0x0661ec00,
+        0x0663ec00, 0x0665ec00, 0x0669ec00, 0x066fec00, 0x0673ec00, 0x0674ec00,
+        0x0100ec0d, 0x0100ec0e, 0x0100ec11, 0x0100ec12, 0x0100ec14, 0x0100ec15,
+        0x0100ec1a, 0x0100ec1b, 0x0100ec1d, 0x0100ec1e, 0x0100ec21, 0x0100ec22,
+        0x0100ec24, 0x0100ec25, 0x0100ec2b, 0x0100ec2e, 0x0100ec32, 0x0100ec35,
+        0x0100ec3a, 0x0100ec3d, 0x0100ec41, 0x0500ec44, 0x0630ed00, 0x0631ed00,
+        0x0632ed00, 0x0661ed00, 0x0663ed00, 0x0665ed00, 0x0669ed00, 0x066fed00,
+        0x0673ed00, 0x0674ed00, 0x0100ed0d, 0x0100ed0e, 0x0100ed11, 0x0100ed12,
+        0x0100ed14, 0x0100ed15, 0x0100ed1a, 0x0100ed1b, 0x0100ed1d, 0x0100ed1e,
+        0x0100ed21, 0x0100ed22, 0x0100ed24, 0x0100ed25, 0x0100ed2b, 0x0100ed2e,
+        0x0100ed32, 0x0100ed35, 0x0100ed3a, 0x0100ed3d, 0x0100ed41, 0x0500ed44,
+        0x0100c704, 0x0100c705, 0x0100c707, 0x0100c708, 0x0100c70b, 0x0100c70c,
+        0x0100c710, 0x0100c713, 0x0100c719, 0x0100c71c, 0x0100c720, 0x0100c723,
+        0x0100c72a, 0x0100c731, 0x0100c739, 0x0500c740, 0x0100cf04, 0x0100cf05,
+        0x0100cf07, 0x0100cf08, 0x0100cf0b, 0x0100cf0c, 0x0100cf10, 0x0100cf13,
+        0x0100cf19, 0x0100cf1c, 0x0100cf20, 0x0100cf23, 0x0100cf2a, 0x0100cf31,
+        0x0100cf39, 0x0500cf40, 0x0100ea04, 0x0100ea05, 0x0100ea07, 0x0100ea08,
+        0x0100ea0b, 0x0100ea0c, 0x0100ea10, 0x0100ea13, 0x0100ea19, 0x0100ea1c,
+        0x0100ea20, 0x0100ea23, 0x0100ea2a, 0x0100ea31, 0x0100ea39, 0x0500ea40,
+        0x0100eb04, 0x0100eb05, 0x0100eb07, 0x0100eb08, 0x0100eb0b, 0x0100eb0c,
+        0x0100eb10, 0x0100eb13, 0x0100eb19, 0x0100eb1c, 0x0100eb20, 0x0100eb23,
+        0x0100eb2a, 0x0100eb31, 0x0100eb39, 0x0500eb40
+    },
+    /* 182 */
+    {
+        0x0230ab01, 0x0630ab16, 0x0231ab01, 0x0631ab16, 0x0232ab01, 0x0632ab16,
+        0x0261ab01, 0x0661ab16, 0x0263ab01, 0x0663ab16, 0x0265ab01, 0x0665ab16,
+        0x0269ab01, 0x0669ab16, 0x026fab01, 0x066fab16, 0x0273ab01, 0x0673ab16,
+        0x0274ab01, 0x0674ab16, 0x0620ab00, 0x0625ab00, 0x062dab00, 0x062eab00,
+        0x062fab00, 0x0633ab00, 0x0634ab00, 0x0635ab00, 0x0636ab00, 0x0637ab00,
+        0x0638ab00, 0x0639ab00, 0x063dab00, 0x0641ab00, 0x065fab00, 0x0662ab00,
+        0x0664ab00, 0x0666ab00, 0x0667ab00, 0x0668ab00, 0x066cab00, 0x066dab00,
+        0x066eab00, 0x0670ab00, 0x0672ab00, 0x0675ab00, 0x0100ab26, 0x0100ab27,
+        0x0100ab2c, 0x0100ab2d, 0x0100ab2f, 0x0100ab30, 0x0100ab33, 0x0100ab34,
+        0x0100ab36, 0x0100ab37, 0x0100ab3b, 0x0100ab3c, 0x0100ab3e, 0x0100ab3f,
+        0x0100ab42, 0x0100ab43, 0x0100ab45, 0x0500ab48, 0x0230ce01, 0x0630ce16,
+        0x0231ce01, 0x0631ce16, 0x0232ce01, 0x0632ce16, 0x0261ce01, 0x0661ce16,
+        0x0263ce01, 0x0663ce16, 0x0265ce01, 0x0665ce16, 0x0269ce01, 0x0669ce16,
+        0x026fce01, 0x066fce16, 0x0273ce01, 0x0673ce16, 0x0274ce01, 0x0674ce16,
+        0x0620ce00, 0x0625ce00, 0x062dce00, 0x062ece00, 0x062fce00, 0x0633ce00,
+        0x0634ce00, 0x0635ce00, 0x0636ce00, 0x0637ce00, 0x0638ce00, 0x0639ce00,
+        0x063dce00, 0x0641ce00, 0x065fce00, 0x0662ce00, 0x0664ce00, 0x0666ce00,
+        0x0667ce00, 0x0668ce00, 0x066cce00, 0x066dce00, 0x066ece00, 0x0670ce00,
+        0x0672ce00, 0x0675ce00, 0x0100ce26, 0x0100ce27, 0x0100ce2c, 0x0100ce2d,
+        0x0100ce2f, 0x0100ce30, 0x0100ce33, 0x0100ce34, 0x0100ce36, 0x0100ce37,
+        0x0100ce3b, 0x0100ce3c, 0x0100ce3e, 0x0100ce3f, 0x0100ce42, 0x0100ce43,
+        0x0100ce45, 0x0500ce48, 0x0230d701, 0x0630d716, 0x0231d701, 0x0631d716,
+        0x0232d701, 0x0632d716, 0x0261d701, 0x0661d716, 0x0263d701, 0x0663d716,
+        0x0265d701, 0x0665d716, 0x0269d701, 0x0669d716, 0x026fd701, 0x066fd716,
+        0x0273d701, 0x0673d716, 0x0274d701, 0x0674d716, 0x0620d700, 0x0625d700,
+        0x062dd700, 0x062ed700, 0x062fd700, 0x0633d700, 0x0634d700, 0x0635d700,
+        0x0636d700, 0x0637d700, 0x0638d700, 0x0639d700, 0x063dd700, 0x0641d700,
+        0x065fd700, 0x0662d700, 0x0664d700, 0x0666d700, 0x0667d700, 0x0668d700,
+        0x066cd700, 0x066dd700, 0x066ed700, 0x0670d700, 0x0672d700, 0x0675d700,
+        0x0100d726, 0x0100d727, 0x0100d72c, 0x0100d72d, 0x0100d72f, 0x0100d730,
+        0x0100d733, 0x0100d734, 0x0100d736, 0x0100d737, 0x0100d73b, 0x0100d73c,
+        0x0100d73e, 0x0100d73f, 0x0100d742, 0x0100d743, 0x0100d745, 0x0500d748,
+        0x0230e101, 0x0630e116, 0x0231e101, 0x0631e116, 0x0232e101, 0x0632e116,
+        0x0261e101, 0x0661e116, 0x0263e101, 0x0663e116, 0x0265e101, 0x0665e116,
+        0x0269e101, 0x0669e116, 0x026fe101, 0x066fe116, 0x0273e101, 0x0673e116,
+        0x0274e101, 0x0674e116, 0x0620e100, 0x0625e100, 0x062de100, 0x062ee100,
+        0x062fe100, 0x0633e100, 0x0634e100, 0x0635e100, 0x0636e100, 0x0637e100,
+        0x0638e100, 0x0639e100, 0x063de100, 0x0641e100, 0x065fe100, 0x0662e100,
+        0x0664e100, 0x0666e100, 0x0667e100, 0x0668e100, 0x066ce100, 0x066de100,
+        0x066ee100, 0x0670e100, 0x0672e100, 0x0675e100, 0x0100e126, 0x0100e127,
+        0x0100e12c, 0x0100e12d, 0x0100e12f, 0x0100e130, 0x0100e133, 0x0100e134,
+        0x0100e136, 0x0100e137, 0x0100e13b, 0x0100e13c, 0x0100e13e, 0x0100e13f,
+        0x0100e142, 0x0100e143, 0x0100e145, 0x0500e148
+    },
+    /* 183 */
+    {
+        0x0230ab02, 0x0230ab09, 0x0230ab17, 0x0630ab28, 0x0231ab02, 0x0231ab09,
+        0x0231ab17, 0x0631ab28, 0x0232ab02, 0x0232ab09, 0x0232ab17, 0x0632ab28,
+        0x0261ab02, 0x0261ab09, 0x0261ab17, 0x0661ab28, 0x0263ab02, 0x0263ab09,
+        0x0263ab17, 0x0663ab28, 0x0265ab02, 0x0265ab09, 0x0265ab17, 0x0665ab28,
+        0x0269ab02, 0x0269ab09, 0x0269ab17, 0x0669ab28, 0x026fab02, 0x026fab09,
+        0x026fab17, 0x066fab28, 0x0273ab02, 0x0273ab09, 0x0273ab17, 0x0673ab28,
+        0x0274ab02, 0x0274ab09, 0x0274ab17, 0x0674ab28, 0x0220ab01, 0x0620ab16,
+        0x0225ab01, 0x0625ab16, 0x022dab01, 0x062dab16, 0x022eab01, 0x062eab16,
+        0x022fab01, 0x062fab16, 0x0233ab01, 0x0633ab16, 0x0234ab01, 0x0634ab16,
+        0x0235ab01, 0x0635ab16, 0x0236ab01, 0x0636ab16, 0x0237ab01, 0x0637ab16,
+        0x0238ab01, 0x0638ab16, 0x0239ab01, 0x0639ab16, 0x023dab01, 0x063dab16,
+        0x0241ab01, 0x0641ab16, 0x025fab01, 0x065fab16, 0x0262ab01, 0x0662ab16,
+        0x0264ab01, 0x0664ab16, 0x0266ab01, 0x0666ab16, 0x0267ab01, 0x0667ab16,
+        0x0268ab01, 0x0668ab16, 0x026cab01, 0x066cab16, 0x026dab01, 0x066dab16,
+        0x026eab01, 0x066eab16, 0x0270ab01, 0x0670ab16, 0x0272ab01, 0x0672ab16,
+        0x0275ab01, 0x0675ab16, 0x063aab00, 0x0642ab00, 0x0643ab00, 0x0644ab00,
+        0x0645ab00, 0x0646ab00, 0x0647ab00, 0x0648ab00, 0x0649ab00, 0x064aab00,
+        0x064bab00, 0x064cab00, 0x064dab00, 0x064eab00, 0x064fab00, 0x0650ab00,
+        0x0651ab00, 0x0652ab00, 0x0653ab00, 0x0654ab00, 0x0655ab00, 0x0656ab00,
+        0x0657ab00, 0x0659ab00, 0x066aab00, 0x066bab00, 0x0671ab00, 0x0676ab00,
+        0x0677ab00, 0x0678ab00, 0x0679ab00, 0x067aab00, 0x0100ab46, 0x0100ab47,
+        0x0100ab49, 0x0500ab4a, 0x0230ce02, 0x0230ce09, 0x0230ce17, 0x0630ce28,
+        0x0231ce02, 0x0231ce09, 0x0231ce17, 0x0631ce28, 0x0232ce02, 0x0232ce09,
+        0x0232ce17, 0x0632ce28, 0x0261ce02, 0x0261ce09, 0x0261ce17, 0x0661ce28,
+        0x0263ce02, 0x0263ce09, 0x0263ce17, 0x0663ce28, 0x0265ce02, 0x0265ce09,
+        0x0265ce17, 0x0665ce28, 0x0269ce02, 0x0269ce09, 0x0269ce17, 0x0669ce28,
+        0x026fce02, 0x026fce09, 0x026fce17, 0x066fce28, 0x0273ce02, 0x0273ce09,
+        0x0273ce17, 0x0673ce28, 0x0274ce02, 0x0274ce09, 0x0274ce17, 0x0674ce28,
+        0x0220ce01, 0x0620ce16, 0x0225ce01, 0x0625ce16, 0x022dce01, 0x062dce16,
+        0x022ece01, 0x062ece16, 0x022fce01, 0x062fce16, 0x0233ce01, 0x0633ce16,
+        0x0234ce01, 0x0634ce16, 0x0235ce01, 0x0635ce16, 0x0236ce01, 0x0636ce16,
+        0x0237ce01, 0x0637ce16, 0x0238ce01, 0x0638ce16, 0x0239ce01, 0x0639ce16,
+        0x023dce01, 0x063dce16, 0x0241ce01, 0x0641ce16, 0x025fce01, 0x065fce16,
+        0x0262ce01, 0x0662ce16, 0x0264ce01, 0x0664ce16, 0x0266ce01, 0x0666ce16,
+        0x0267ce01, 0x0667ce16, 0x0268ce01, 0x0668ce16, 0x026cce01, 0x066cce16,
+        0x026dce01, 0x066dce16, 0x026ece01, 0x066ece16, 0x0270ce01, 0x0670ce16,
+        0x0272ce01, 0x0672ce16, 0x0275ce01, 0x0675ce16, 0x063ace00, 0x0642ce00,
+        0x0643ce00, 0x0644ce00, 0x0645ce00, 0x0646ce00, 0x0647ce00, 0x0648ce00,
+        0x0649ce00, 0x064ace00, 0x064bce00, 0x064cce00, 0x064dce00, 0x064ece00,
+        0x064fce00, 0x0650ce00, 0x0651ce00, 0x0652ce00, 0x0653ce00, 0x0654ce00,
+        0x0655ce00, 0x0656ce00, 0x0657ce00, 0x0659ce00, 0x066ace00, 0x066bce00,
+        0x0671ce00, 0x0676ce00, 0x0677ce00, 0x0678ce00, 0x0679ce00, 0x067ace00,
+        0x0100ce46, 0x0100ce47, 0x0100ce49, 0x0500ce4a
+    },
+    /* 184 */
+    {
+        0x0230d702, 0x0230d709, 0x0230d717, 0x0630d728, 0x0231d702, 0x0231d709,
+        0x0231d717, 0x0631d728, 0x0232d702, 0x0232d709, 0x0232d717, 0x0632d728,
+        0x0261d702, 0x0261d709, 0x0261d717, 0x0661d728, 0x0263d702, 0x0263d709,
+        0x0263d717, 0x0663d728, 0x0265d702, 0x0265d709, 0x0265d717, 0x0665d728,
+        0x0269d702, 0x0269d709, 0x0269d717, 0x0669d728, 0x026fd702, 0x026fd709,
+        0x026fd717, 0x066fd728, 0x0273d702, 0x0273d709, 0x0273d717, 0x0673d728,
+        0x0274d702, 0x0274d709, 0x0274d717, 0x0674d728, 0x0220d701, 0x0620d716,
+        0x0225d701, 0x0625d716, 0x022dd701, 0x062dd716, 0x022ed701, 0x062ed716,
+        0x022fd701, 0x062fd716, 0x0233d701, 0x0633d716, 0x0234d701, 0x0634d716,
+        0x0235d701, 0x0635d716, 0x0236d701, 0x0636d716, 0x0237d701, 0x0637d716,
+        0x0238d701, 0x0638d716, 0x0239d701, 0x0639d716, 0x023dd701, 0x063dd716,
+        0x0241d701, 0x0641d716, 0x025fd701, 0x065fd716, 0x0262d701, 0x0662d716,
+        0x0264d701, 0x0664d716, 0x0266d701, 0x0666d716, 0x0267d701, 0x0667d716,
+        0x0268d701, 0x0668d716, 0x026cd701, 0x066cd716, 0x026dd701, 0x066dd716,
+        0x026ed701, 0x066ed716, 0x0270d701, 0x0670d716, 0x0272d701, 0x0672d716,
+        0x0275d701, 0x0675d716, 0x063ad700, 0x0642d700, 0x0643d700, 0x0644d700,
+        0x0645d700, 0x0646d700, 0x0647d700, 0x0648d700, 0x0649d700, 0x064ad700,
+        0x064bd700, 0x064cd700, 0x064dd700, 0x064ed700, 0x064fd700, 0x0650d700,
+        0x0651d700, 0x0652d700, 0x0653d700, 0x0654d700, 0x0655d700, 0x0656d700,
+        0x0657d700, 0x0659d700, 0x066ad700, 0x066bd700, 0x0671d700, 0x0676d700,
+        0x0677d700, 0x0678d700, 0x0679d700, 0x067ad700, 0x0100d746, 0x0100d747,
+        0x0100d749, 0x0500d74a, 0x0230e102, 0x0230e109, 0x0230e117, 0x0630e128,
+        0x0231e102, 0x0231e109, 0x0231e117, 0x0631e128, 0x0232e102, 0x0232e109,
+        0x0232e117, 0x0632e128, 0x0261e102, 0x0261e109, 0x0261e117, 0x0661e128,
+        0x0263e102, 0x0263e109, 0x0263e117, 0x0663e128, 0x0265e102, 0x0265e109,
+        0x0265e117, 0x0665e128, 0x0269e102, 0x0269e109, 0x0269e117, 0x0669e128,
+        0x026fe102, 0x026fe109, 0x026fe117, 0x066fe128, 0x0273e102, 0x0273e109,
+        0x0273e117, 0x0673e128, 0x0274e102, 0x0274e109, 0x0274e117, 0x0674e128,
+        0x0220e101, 0x0620e116, 0x0225e101, 0x0625e116, 0x022de101, 0x062de116,
+        0x022ee101, 0x062ee116, 0x022fe101, 0x062fe116, 0x0233e101, 0x0633e116,
+        0x0234e101, 0x0634e116, 0x0235e101, 0x0635e116, 0x0236e101, 0x0636e116,
+        0x0237e101, 0x0637e116, 0x0238e101, 0x0638e116, 0x0239e101, 0x0639e116,
+        0x023de101, 0x063de116, 0x0241e101, 0x0641e116, 0x025fe101, 0x065fe116,
+        0x0262e101, 0x0662e116, 0x0264e101, 0x0664e116, 0x0266e101, 0x0666e116,
+        0x0267e101, 0x0667e116, 0x0268e101, 0x0668e116, 0x026ce101, 0x066ce116,
+        0x026de101, 0x066de116, 0x026ee101, 0x066ee116, 0x0270e101, 0x0670e116,
+        0x0272e101, 0x0672e116, 0x0275e101, 0x0675e116, 0x063ae100, 0x0642e100,
+        0x0643e100, 0x0644e100, 0x0645e100, 0x0646e100, 0x0647e100, 0x0648e100,
+        0x0649e100, 0x064ae100, 0x064be100, 0x064ce100, 0x064de100, 0x064ee100,
+        0x064fe100, 0x0650e100, 0x0651e100, 0x0652e100, 0x0653e100, 0x0654e100,
+        0x0655e100, 0x0656e100, 0x0657e100, 0x0659e100, 0x066ae100, 0x066be100,
+        0x0671e100, 0x0676e100, 0x0677e100, 0x0678e100, 0x0679e100, 0x067ae100,
+        0x0100e146, 0x0100e147, 0x0100e149, 0x0500e14a
+    },
+    /* 185 */
+    {
+        0x0230ec01, 0x0630ec16, 0x0231ec01, 0x0631ec16, 0x0232ec01, 0x0632ec16,
+        0x0261ec01, 0x0661ec16, 0x0263ec01, 0x0663ec16, 0x0265ec01, 0x0665ec16,
+        0x0269ec01, 0x0669ec16, 0x026fec01, 0x066fec16, 0x0273ec01, 0x0673ec16,
+        0x0274ec01, 0x0674ec16, 0x0620ec00, 0x0625ec00, 0x062dec00, 0x062eec00,
+        0x062fec00, 0x0633ec00, 0x0634ec00, 0x0635ec00, 0x0636ec00, 0x0637ec00,
+        0x0638ec00, 0x0639ec00, 0x063dec00, 0x0641ec00, 0x065fec00, 0x0662ec00,
+        0x0664ec00, 0x0666ec00, 0x0667ec00, 0x0668ec00, 0x066cec00, 0x066dec00,
+        0x066eec00, 0x0670ec00, 0x0672ec00, 0x0675ec00, 0x0100ec26, 0x0100ec27,
+        0x0100ec2c, 0x0100ec2d, 0x0100ec2f, 0x0100ec30, 0x0100ec33, 0x0100ec34,
+        0x0100ec36, 0x0100ec37, 0x0100ec3b, 0x0100ec3c, 0x0100ec3e, 0x0100ec3f,
+        0x0100ec42, 0x0100ec43, 0x0100ec45, 0x0500ec48, 0x0230ed01, 0x0630ed16,
+        0x0231ed01, 0x0631ed16, 0x0232ed01, 0x0632ed16, 0x0261ed01, 0x0661ed16,
+        0x0263ed01, 0x0663ed16, 0x0265ed01, 0x0665ed16, 0x0269ed01, 0x0669ed16,
+        0x026fed01, 0x066fed16, 0x0273ed01, 0x0673ed16, 0x0274ed01, 0x0674ed16,
+        0x0620ed00, 0x0625ed00, 0x062ded00, 0x062eed00, 0x062fed00, 0x0633ed00,
+        0x0634ed00, 0x0635ed00, 0x0636ed00, 0x0637ed00, 0x0638ed00, 0x0639ed00,
+        0x063ded00, 0x0641ed00, 0x065fed00, 0x0662ed00, 0x0664ed00, 0x0666ed00,
+        0x0667ed00, 0x0668ed00, 0x066ced00, 0x066ded00, 0x066eed00, 0x0670ed00,
+        0x0672ed00, 0x0675ed00, 0x0100ed26, 0x0100ed27, 0x0100ed2c, 0x0100ed2d,
+        0x0100ed2f, 0x0100ed30, 0x0100ed33, 0x0100ed34, 0x0100ed36, 0x0100ed37,
+        0x0100ed3b, 0x0100ed3c, 0x0100ed3e, 0x0100ed3f, 0x0100ed42, 0x0100ed43,
+        0x0100ed45, 0x0500ed48, 0x0630c700, 0x0631c700, 0x0632c700, 0x0661c700,
+        0x0663c700, 0x0665c700, 0x0669c700, 0x066fc700, 0x0673c700, 0x0674c700,
+        0x0100c70d, 0x0100c70e, 0x0100c711, 0x0100c712, 0x0100c714, 0x0100c715,
+        0x0100c71a, 0x0100c71b, 0x0100c71d, 0x0100c71e, 0x0100c721, 0x0100c722,
+        0x0100c724, 0x0100c725, 0x0100c72b, 0x0100c72e, 0x0100c732, 0x0100c735,
+        0x0100c73a, 0x0100c73d, 0x0100c741, 0x0500c744, 0x0630cf00, 0x0631cf00,
+        0x0632cf00, 0x0661cf00, 0x0663cf00, 0x0665cf00, 0x0669cf00, 0x066fcf00,
+        0x0673cf00, 0x0674cf00, 0x0100cf0d, 0x0100cf0e, 0x0100cf11, 0x0100cf12,
+        0x0100cf14, 0x0100cf15, 0x0100cf1a, 0x0100cf1b, 0x0100cf1d, 0x0100cf1e,
+        0x0100cf21, 0x0100cf22, 0x0100cf24, 0x0100cf25, 0x0100cf2b, 0x0100cf2e,
+        0x0100cf32, 0x0100cf35, 0x0100cf3a, 0x0100cf3d, 0x0100cf41, 0x0500cf44,
+        0x0630ea00, 0x0631ea00, 0x0632ea00, 0x0661ea00, 0x0663ea00, 0x0665ea00,
+        0x0669ea00, 0x066fea00, 0x0673ea00, 0x0674ea00, 0x0100ea0d, 0x0100ea0e,
+        0x0100ea11, 0x0100ea12, 0x0100ea14, 0x0100ea15, 0x0100ea1a, 0x0100ea1b,
+        0x0100ea1d, 0x0100ea1e, 0x0100ea21, 0x0100ea22, 0x0100ea24, 0x0100ea25,
+        0x0100ea2b, 0x0100ea2e, 0x0100ea32, 0x0100ea35, 0x0100ea3a, 0x0100ea3d,
+        0x0100ea41, 0x0500ea44, 0x0630eb00, 0x0631eb00, 0x0632eb00, 0x0661eb00,
+        0x0663eb00, 0x0665eb00, 0x0669eb00, 0x066feb00, 0x0673eb00, 0x0674eb00,
+        0x0100eb0d, 0x0100eb0e, 0x0100eb11, 0x0100eb12, 0x0100eb14, 0x0100eb15,
+        0x0100eb1a, 0x0100eb1b, 0x0100eb1d, 0x0100eb1e, 0x0100eb21, 0x0100eb22,
+        0x0100eb24, 0x0100eb25, 0x0100eb2b, 0x0100eb2e, 0x0100eb32, 0x0100eb35,
+        0x0100eb3a, 0x0100eb3d, 0x0100eb41, 0x0500eb44
+    },
+    /* 186 */
+    {
+        0x0230ec02, 0x0230ec09, 0x0230ec17, 0x0630ec28, 0x0231ec02, 0x0231ec09,
+        0x0231ec17, 0x0631ec28, 0x0232ec02, 0x0232ec09, 0x0232ec17, 0x0632ec28,
+        0x0261ec02, 0x0261ec09, 0x0261ec17, 0x0661ec28, 0x0263ec02, 0x0263ec09,
+        0x0263ec17, 0x0663ec28, 0x0265ec02, 0x0265ec09, 0x0265ec17, 0x0665ec28,
+        0x0269ec02, 0x0269ec09, 0x0269ec17, 0x0669ec28, 0x026fec02, 0x026fec09,
+        0x026fec17, 0x066fec28, 0x0273ec02, 0x0273ec09, 0x0273ec17, 0x0673ec28,
+        0x0274ec02, 0x0274ec09, 0x0274ec17, 0x0674ec28, 0x0220ec01, 0x0620ec16,
+        0x0225ec01, 0x0625ec16, 0x022dec01, 0x062dec16, 0x022eec01, 0x062eec16,
+        0x022fec01, 0x062fec16, 0x0233ec01, 0x0633ec16, 0x0234ec01, 0x0634ec16,
+        0x0235ec01, 0x0635ec16, 0x0236ec01, 0x0636ec16, 0x0237ec01, 0x0637ec16,
+        0x0238ec01, 0x0638ec16, 0x0239ec01, 0x0639ec16, 0x023dec01, 0x063dec16,
+        0x0241ec01, 0x0641ec16, 0x025fec01, 0x065fec16, 0x0262ec01, 0x0662ec16,
+        0x0264ec01, 0x0664ec16, 0x0266ec01, 0x0666ec16, 0x0267ec01, 0x0667ec16,
+        0x0268ec01, 0x0668ec16, 0x026cec01, 0x066cec16, 0x026dec01, 0x066dec16,
+        0x026eec01, 0x066eec16, 0x0270ec01, 0x0670ec16, 0x0272ec01, 0x0672ec16,
+        0x0275ec01, 0x0675ec16, 0x063aec00, 0x0642ec00, 0x0643ec00, 0x0644ec00,
+        0x0645ec00, 0x0646ec00, 0x0647ec00, 0x0648ec00, 0x0649ec00, 0x064aec00,
+        0x064bec00, 0x064cec00, 0x064dec00, 0x064eec00, 0x064fec00, 0x0650ec00,
+        0x0651ec00, 0x0652ec00, 0x0653ec00, 0x0654ec00, 0x0655ec00, 0x0656ec00,
+        0x0657ec00, 0x0659ec00, 0x066aec00, 0x066bec00, 0x0671ec00, 0x0676ec00,
+        0x0677ec00, 0x0678ec00, 0x0679ec00, 0x067aec00, 0x0100ec46, 0x0100ec47,
+        0x0100ec49, 0x0500ec4a, 0x0230ed02, 0x0230ed09, 0x0230ed17, 0x0630ed28,
+        0x0231ed02, 0x0231ed09, 0x0231ed17, 0x0631ed28, 0x0232ed02, 0x0232ed09,
+        0x0232ed17, 0x0632ed28, 0x0261ed02, 0x0261ed09, 0x0261ed17, 0x0661ed28,
+        0x0263ed02, 0x0263ed09, 0x0263ed17, 0x0663ed28, 0x0265ed02, 0x0265ed09,
+        0x0265ed17, 0x0665ed28, 0x0269ed02, 0x0269ed09, 0x0269ed17, 0x0669ed28,
+        0x026fed02, 0x026fed09, 0x026fed17, 0x066fed28, 0x0273ed02, 0x0273ed09,
+        0x0273ed17, 0x0673ed28, 0x0274ed02, 0x0274ed09, 0x0274ed17, 0x0674ed28,
+        0x0220ed01, 0x0620ed16, 0x0225ed01, 0x0625ed16, 0x022ded01, 0x062ded16,
+        0x022eed01, 0x062eed16, 0x022fed01, 0x062fed16, 0x0233ed01, 0x0633ed16,
+        0x0234ed01, 0x0634ed16, 0x0235ed01, 0x0635ed16, 0x0236ed01, 0x0636ed16,
+        0x0237ed01, 0x0637ed16, 0x0238ed01, 0x0638ed16, 0x0239ed01, 0x0639ed16,
+        0x023ded01, 0x063ded16, 0x0241ed01, 0x0641ed16, 0x025fed01, 0x065fed16,
+        0x0262ed01, 0x0662ed16, 0x0264ed01, 0x0664ed16, 0x0266ed01, 0x0666ed16,
+        0x0267ed01, 0x0667ed16, 0x0268ed01, 0x0668ed16, 0x026ced01, 0x066ced16,
+        0x026ded01, 0x066ded16, 0x026eed01, 0x066eed16, 0x0270ed01, 0x0670ed16,
+        0x0272ed01, 0x0672ed16, 0x0275ed01, 0x0675ed16, 0x063aed00, 0x0642ed00,
+        0x0643ed00, 0x0644ed00, 0x0645ed00, 0x0646ed00, 0x0647ed00, 0x0648ed00,
+        0x0649ed00, 0x064aed00, 0x064bed00, 0x064ced00, 0x064ded00, 0x064eed00,
+        0x064fed00, 0x0650ed00, 0x0651ed00, 0x0652ed00, 0x0653ed00, 0x0654ed00,
+        0x0655ed00, 0x0656ed00, 0x0657ed00, 0x0659ed00, 0x066aed00, 0x066bed00,
+        0x0671ed00, 0x0676ed00, 0x0677ed00, 0x0678ed00, 0x0679ed00, 0x067aed00,
+        0x0100ed46, 0x0100ed47, 0x0100ed49, 0x0500ed4a
+    },
+    /* 187 */
+    {
+        0x0230c701, 0x0630c716, 0x0231c701, 0x0631c716, 0x0232c701, 0x0632c716,
+        0x0261c701, 0x0661c716, 0x0263c701, 0x0663c716, 0x0265c701, 0x0665c716,
+        0x0269c701, 0x0669c716, 0x026fc701, 0x066fc716, 0x0273c701, 0x0673c716,
+        0x0274c701, 0x0674c716, 0x0620c700, 0x0625c700, 0x062dc700, 0x062ec700,
+        0x062fc700, 0x0633c700, 0x0634c700, 0x0635c700, 0x0636c700, 0x0637c700,
+        0x0638c700, 0x0639c700, 0x063dc700, 0x0641c700, 0x065fc700, 0x0662c700,
+        0x0664c700, 0x0666c700, 0x0667c700, 0x0668c700, 0x066cc700, 0x066dc700,
+        0x066ec700, 0x0670c700, 0x0672c700, 0x0675c700, 0x0100c726, 0x0100c727,
+        0x0100c72c, 0x0100c72d, 0x0100c72f, 0x0100c730, 0x0100c733, 0x0100c734,
+        0x0100c736, 0x0100c737, 0x0100c73b, 0x0100c73c, 0x0100c73e, 0x0100c73f,
+        0x0100c742, 0x0100c743, 0x0100c745, 0x0500c748, 0x0230cf01, 0x0630cf16,
+        0x0231cf01, 0x0631cf16, 0x0232cf01, 0x0632cf16, 0x0261cf01, 0x0661cf16,
+        0x0263cf01, 0x0663cf16, 0x0265cf01, 0x0665cf16, 0x0269cf01, 0x0669cf16,
+        0x026fcf01, 0x066fcf16, 0x0273cf01, 0x0673cf16, 0x0274cf01, 0x0674cf16,
+        0x0620cf00, 0x0625cf00, 0x062dcf00, 0x062ecf00, 0x062fcf00, 0x0633cf00,
+        0x0634cf00, 0x0635cf00, 0x0636cf00, 0x0637cf00, 0x0638cf00, 0x0639cf00,
+        0x063dcf00, 0x0641cf00, 0x065fcf00, 0x0662cf00, 0x0664cf00, 0x0666cf00,
+        0x0667cf00, 0x0668cf00, 0x066ccf00, 0x066dcf00, 0x066ecf00, 0x0670cf00,
+        0x0672cf00, 0x0675cf00, 0x0100cf26, 0x0100cf27, 0x0100cf2c, 0x0100cf2d,
+        0x0100cf2f, 0x0100cf30, 0x0100cf33, 0x0100cf34, 0x0100cf36, 0x0100cf37,
+        0x0100cf3b, 0x0100cf3c, 0x0100cf3e, 0x0100cf3f, 0x0100cf42, 0x0100cf43,
+        0x0100cf45, 0x0500cf48, 0x0230ea01, 0x0630ea16, 0x0231ea01, 0x0631ea16,
+        0x0232ea01, 0x0632ea16, 0x0261ea01, 0x0661ea16, 0x0263ea01, 0x0663ea16,
+        0x0265ea01, 0x0665ea16, 0x0269ea01, 0x0669ea16, 0x026fea01, 0x066fea16,
+        0x0273ea01, 0x0673ea16, 0x0274ea01, 0x0674ea16, 0x0620ea00, 0x0625ea00,
+        0x062dea00, 0x062eea00, 0x062fea00, 0x0633ea00, 0x0634ea00, 0x0635ea00,
+        0x0636ea00, 0x0637ea00, 0x0638ea00, 0x0639ea00, 0x063dea00, 0x0641ea00,
+        0x065fea00, 0x0662ea00, 0x0664ea00, 0x0666ea00, 0x0667ea00, 0x0668ea00,
+        0x066cea00, 0x066dea00, 0x066eea00, 0x0670ea00, 0x0672ea00, 0x0675ea00,
+        0x0100ea26, 0x0100ea27, 0x0100ea2c, 0x0100ea2d, 0x0100ea2f, 0x0100ea30,
+        0x0100ea33, 0x0100ea34, 0x0100ea36, 0x0100ea37, 0x0100ea3b, 0x0100ea3c,
+        0x0100ea3e, 0x0100ea3f, 0x0100ea42, 0x0100ea43, 0x0100ea45, 0x0500ea48,
+        0x0230eb01, 0x0630eb16, 0x0231eb01, 0x0631eb16, 0x0232eb01, 0x0632eb16,
+        0x0261eb01, 0x0661eb16, 0x0263eb01, 0x0663eb16, 0x0265eb01, 0x0665eb16,
+        0x0269eb01, 0x0669eb16, 0x026feb01, 0x066feb16, 0x0273eb01, 0x0673eb16,
+        0x0274eb01, 0x0674eb16, 0x0620eb00, 0x0625eb00, 0x062deb00, 0x062eeb00,
+        0x062feb00, 0x0633eb00, 0x0634eb00, 0x0635eb00, 0x0636eb00, 0x0637eb00,
+        0x0638eb00, 0x0639eb00, 0x063deb00, 0x0641eb00, 0x065feb00, 0x0662eb00,
+        0x0664eb00, 0x0666eb00, 0x0667eb00, 0x0668eb00, 0x066ceb00, 0x066deb00,
+        0x066eeb00, 0x0670eb00, 0x0672eb00, 0x0675eb00, 0x0100eb26, 0x0100eb27,
+        0x0100eb2c, 0x0100eb2d, 0x0100eb2f, 0x0100eb30, 0x0100eb33, 0x0100eb34,
+        0x0100eb36, 0x0100eb37, 0x0100eb3b, 0x0100eb3c, 0x0100eb3e, 0x0100eb3f,
+        0x0100eb42, 0x0100eb43, 0x0100eb45, 0x0500eb48
+    },
+    /* 188 */
+    {
+        0x0230c702, 0x0230c709, 0x0230c717, 0x0630c728, 0x0231c702, 0x0231c709,
+        0x0231c717, 0x0631c728, 0x0232c702, 0x0232c709, 0x0232c717, 0x0632c728,
+        0x0261c702, 0x0261c709, 0x0261c717, 0x0661c728, 0x0263c702, 0x0263c709,
+        0x0263c717, 0x0663c728, 0x0265c702, 0x0265c709, 0x0265c717, 0x0665c728,
+        0x0269c702, 0x0269c709, 0x0269c717, 0x0669c728, 0x026fc702, 0x026fc709,
+        0x026fc717, 0x066fc728, 0x0273c702, 0x0273c709, 0x0273c717, 0x0673c728,
+        0x0274c702, 0x0274c709, 0x0274c717, 0x0674c728, 0x0220c701, 0x0620c716,
+        0x0225c701, 0x0625c716, 0x022dc701, 0x062dc716, 0x022ec701, 0x062ec716,
+        0x022fc701, 0x062fc716, 0x0233c701, 0x0633c716, 0x0234c701, 0x0634c716,
+        0x0235c701, 0x0635c716, 0x0236c701, 0x0636c716, 0x0237c701, 0x0637c716,
+        0x0238c701, 0x0638c716, 0x0239c701, 0x0639c716, 0x023dc701, 0x063dc716,
+        0x0241c701, 0x0641c716, 0x025fc701, 0x065fc716, 0x0262c701, 0x0662c716,
+        0x0264c701, 0x0664c716, 0x0266c701, 0x0666c716, 0x0267c701, 0x0667c716,
+        0x0268c701, 0x0668c716, 0x026cc701, 0x066cc716, 0x026dc701, 0x066dc716,
+        0x026ec701, 0x066ec716, 0x0270c701, 0x0670c716, 0x0272c701, 0x0672c716,
+        0x0275c701, 0x0675c716, 0x063ac700, 0x0642c700, 0x0643c700, 0x0644c700,
+        0x0645c700, 0x0646c700, 0x0647c700, 0x0648c700, 0x0649c700, 0x064ac700,
+        0x064bc700, 0x064cc700, 0x064dc700, 0x064ec700, 0x064fc700, 0x0650c700,
+        0x0651c700, 0x0652c700, 0x0653c700, 0x0654c700, 0x0655c700, 0x0656c700,
+        0x0657c700, 0x0659c700, 0x066ac700, 0x066bc700, 0x0671c700, 0x0676c700,
+        0x0677c700, 0x0678c700, 0x0679c700, 0x067ac700, 0x0100c746, 0x0100c747,
+        0x0100c749, 0x0500c74a, 0x0230cf02, 0x0230cf09, 0x0230cf17, 0x0630cf28,
+        0x0231cf02, 0x0231cf09, 0x0231cf17, 0x0631cf28, 0x0232cf02, 0x0232cf09,
+        0x0232cf17, 0x0632cf28, 0x0261cf02, 0x0261cf09, 0x0261cf17, 0x0661cf28,
+        0x0263cf02, 0x0263cf09, 0x0263cf17, 0x0663cf28, 0x0265cf02, 0x0265cf09,
+        0x0265cf17, 0x0665cf28, 0x0269cf02, 0x0269cf09, 0x0269cf17, 0x0669cf28,
+        0x026fcf02, 0x026fcf09, 0x026fcf17, 0x066fcf28, 0x0273cf02, 0x0273cf09,
+        0x0273cf17, 0x0673cf28, 0x0274cf02, 0x0274cf09, 0x0274cf17, 0x0674cf28,
+        0x0220cf01, 0x0620cf16, 0x0225cf01, 0x0625cf16, 0x022dcf01, 0x062dcf16,
+        0x022ecf01, 0x062ecf16, 0x022fcf01, 0x062fcf16, 0x0233cf01, 0x0633cf16,
+        0x0234cf01, 0x0634cf16, 0x0235cf01, 0x0635cf16, 0x0236cf01, 0x0636cf16,
+        0x0237cf01, 0x0637cf16, 0x0238cf01, 0x0638cf16, 0x0239cf01, 0x0639cf16,
+        0x023dcf01, 0x063dcf16, 0x0241cf01, 0x0641cf16, 0x025fcf01, 0x065fcf16,
+        0x0262cf01, 0x0662cf16, 0x0264cf01, 0x0664cf16, 0x0266cf01, 0x0666cf16,
+        0x0267cf01, 0x0667cf16, 0x0268cf01, 0x0668cf16, 0x026ccf01, 0x066ccf16,
+        0x026dcf01, 0x066dcf16, 0x026ecf01, 0x066ecf16, 0x0270cf01, 0x0670cf16,
+        0x0272cf01, 0x0672cf16, 0x0275cf01, 0x0675cf16, 0x063acf00, 0x0642cf00,
+        0x0643cf00, 0x0644cf00, 0x0645cf00, 0x0646cf00, 0x0647cf00, 0x0648cf00,
+        0x0649cf00, 0x064acf00, 0x064bcf00, 0x064ccf00, 0x064dcf00, 0x064ecf00,
+        0x064fcf00, 0x0650cf00, 0x0651cf00, 0x0652cf00, 0x0653cf00, 0x0654cf00,
+        0x0655cf00, 0x0656cf00, 0x0657cf00, 0x0659cf00, 0x066acf00, 0x066bcf00,
+        0x0671cf00, 0x0676cf00, 0x0677cf00, 0x0678cf00, 0x0679cf00, 0x067acf00,
+        0x0100cf46, 0x0100cf47, 0x0100cf49, 0x0500cf4a
+    },
+    /* 189 */
+    {
+        0x0230ea02, 0x0230ea09, 0x0230ea17, 0x0630ea28, 0x0231ea02, 0x0231ea09,
+        0x0231ea17, 0x0631ea28, 0x0232ea02, 0x0232ea09, 0x0232ea17, 0x0632ea28,
+        0x0261ea02, 0x0261ea09, 0x0261ea17, 0x0661ea28, 0x0263ea02, 0x0263ea09,
+        0x0263ea17, 0x0663ea28, 0x0265ea02, 0x0265ea09, 0x0265ea17, 0x0665ea28,
+        0x0269ea02, 0x0269ea09, 0x0269ea17, 0x0669ea28, 0x026fea02, 0x026fea09,
+        0x026fea17, 0x066fea28, 0x0273ea02, 0x0273ea09, 0x0273ea17, 0x0673ea28,
+        0x0274ea02, 0x0274ea09, 0x0274ea17, 0x0674ea28, 0x0220ea01, 0x0620ea16,
+        0x0225ea01, 0x0625ea16, 0x022dea01, 0x062dea16, 0x022eea01, 0x062eea16,
+        0x022fea01, 0x062fea16, 0x0233ea01, 0x0633ea16, 0x0234ea01, 0x0634ea16,
+        0x0235ea01, 0x0635ea16, 0x0236ea01, 0x0636ea16, 0x0237ea01, 0x0637ea16,
+        0x0238ea01, 0x0638ea16, 0x0239ea01, 0x0639ea16, 0x023dea01, 0x063dea16,
+        0x0241ea01, 0x0641ea16, 0x025fea01, 0x065fea16, 0x0262ea01, 0x0662ea16,
+        0x0264ea01, 0x0664ea16, 0x0266ea01, 0x0666ea16, 0x0267ea01, 0x0667ea16,
+        0x0268ea01, 0x0668ea16, 0x026cea01, 0x066cea16, 0x026dea01, 0x066dea16,
+        0x026eea01, 0x066eea16, 0x0270ea01, 0x0670ea16, 0x0272ea01, 0x0672ea16,
+        0x0275ea01, 0x0675ea16, 0x063aea00, 0x0642ea00, 0x0643ea00, 0x0644ea00,
+        0x0645ea00, 0x0646ea00, 0x0647ea00, 0x0648ea00, 0x0649ea00, 0x064aea00,
+        0x064bea00, 0x064cea00, 0x064dea00, 0x064eea00, 0x064fea00, 0x0650ea00,
+        0x0651ea00, 0x0652ea00, 0x0653ea00, 0x0654ea00, 0x0655ea00, 0x0656ea00,
+        0x0657ea00, 0x0659ea00, 0x066aea00, 0x066bea00, 0x0671ea00, 0x0676ea00,
+        0x0677ea00, 0x0678ea00, 0x0679ea00, 0x067aea00, 0x0100ea46, 0x0100ea47,
+        0x0100ea49, 0x0500ea4a, 0x0230eb02, 0x0230eb09, 0x0230eb17, 0x0630eb28,
+        0x0231eb02, 0x0231eb09, 0x0231eb17, 0x0631eb28, 0x0232eb02, 0x0232eb09,
+        0x0232eb17, 0x0632eb28, 0x0261eb02, 0x0261eb09, 0x0261eb17, 0x0661eb28,
+        0x0263eb02, 0x0263eb09, 0x0263eb17, 0x0663eb28, 0x0265eb02, 0x0265eb09,
+        0x0265eb17, 0x0665eb28, 0x0269eb02, 0x0269eb09, 0x0269eb17, 0x0669eb28,
+        0x026feb02, 0x026feb09, 0x026feb17, 0x066feb28, 0x0273eb02, 0x0273eb09,
+        0x0273eb17, 0x0673eb28, 0x0274eb02, 0x0274eb09, 0x0274eb17, 0x0674eb28,
+        0x0220eb01, 0x0620eb16, 0x0225eb01, 0x0625eb16, 0x022deb01, 0x062deb16,
+        0x022eeb01, 0x062eeb16, 0x022feb01, 0x062feb16, 0x0233eb01, 0x0633eb16,
+        0x0234eb01, 0x0634eb16, 0x0235eb01, 0x0635eb16, 0x0236eb01, 0x0636eb16,
+        0x0237eb01, 0x0637eb16, 0x0238eb01, 0x0638eb16, 0x0239eb01, 0x0639eb16,
+        0x023deb01, 0x063deb16, 0x0241eb01, 0x0641eb16, 0x025feb01, 0x065feb16,
+        0x0262eb01, 0x0662eb16, 0x0264eb01, 0x0664eb16, 0x0266eb01, 0x0666eb16,
+        0x0267eb01, 0x0667eb16, 0x0268eb01, 0x0668eb16, 0x026ceb01, 0x066ceb16,
+        0x026deb01, 0x066deb16, 0x026eeb01, 0x066eeb16, 0x0270eb01, 0x0670eb16,
+        0x0272eb01, 0x0672eb16, 0x0275eb01, 0x0675eb16, 0x063aeb00, 0x0642eb00,
+        0x0643eb00, 0x0644eb00, 0x0645eb00, 0x0646eb00, 0x0647eb00, 0x0648eb00,
+        0x0649eb00, 0x064aeb00, 0x064beb00, 0x064ceb00, 0x064deb00, 0x064eeb00,
+        0x064feb00, 0x0650eb00, 0x0651eb00, 0x0652eb00, 0x0653eb00, 0x0654eb00,
+        0x0655eb00, 0x0656eb00, 0x0657eb00, 0x0659eb00, 0x066aeb00, 0x066beb00,
+        0x0671eb00, 0x0676eb00, 0x0677eb00, 0x0678eb00, 0x0679eb00, 0x067aeb00,
+        0x0100eb46, 0x0100eb47, 0x0100eb49, 0x0500eb4a
+    },
+    /* 190 */
+    {
+        0x0100c003, 0x0100c006, 0x0100c00a, 0x0100c00f, 0x0100c018, 0x0100c01f,
+        0x0100c029, 0x0500c038, 0x0100c103, 0x0100c106, 0x0100c10a, 0x0100c10f,
+        0x0100c118, 0x0100c11f, 0x0100c129, 0x0500c138, 0x0100c803, 0x0100c806,
+        0x0100c80a, 0x0100c80f, 0x0100c818, 0x0100c81f, 0x0100c829, 0x0500c838,
+        0x0100c903, 0x0100c906, 0x0100c90a, 0x0100c90f, 0x0100c918, 0x0100c91f,
+        0x0100c929, 0x0500c938, 0x0100ca03, 0x0100ca06, 0x0100ca0a, 0x0100ca0f,
+        0x0100ca18, 0x0100ca1f, 0x0100ca29, 0x0500ca38, 0x0100cd03, 0x0100cd06,
+        0x0100cd0a, 0x0100cd0f, 0x0100cd18, 0x0100cd1f, 0x0100cd29, 0x0500cd38,
+        0x0100d203, 0x0100d206, 0x0100d20a, 0x0100d20f, 0x0100d218, 0x0100d21f,
+        0x0100d229, 0x0500d238, 0x0100d503, 0x0100d506, 0x0100d50a, 0x0100d50f,
+        0x0100d518, 0x0100d51f, 0x0100d529, 0x0500d538, 0x0100da03, 0x0100da06,
+        0x0100da0a, 0x0100da0f, 0x0100da18, 0x0100da1f, 0x0100da29, 0x0500da38,
+        0x0100db03, 0x0100db06, 0x0100db0a, 0x0100db0f, 0x0100db18, 0x0100db1f,
+        0x0100db29, 0x0500db38, 0x0100ee03, 0x0100ee06, 0x0100ee0a, 0x0100ee0f,
+        0x0100ee18, 0x0100ee1f, 0x0100ee29, 0x0500ee38, 0x0100f003, 0x0100f006,
+        0x0100f00a, 0x0100f00f, 0x0100f018, 0x0100f01f, 0x0100f029, 0x0500f038,
+        0x0100f203, 0x0100f206, 0x0100f20a, 0x0100f20f, 0x0100f218, 0x0100f21f,
+        0x0100f229, 0x0500f238, 0x0100f303, 0x0100f306, 0x0100f30a, 0x0100f30f,
+        0x0100f318, 0x0100f31f, 0x0100f329, 0x0500f338, 0x0100ff03, 0x0100ff06,
+        0x0100ff0a, 0x0100ff0f, 0x0100ff18, 0x0100ff1f, 0x0100ff29, 0x0500ff38,
+        0x0100cb02, 0x0100cb09, 0x0100cb17, 0x0500cb28, 0x0100cc02, 0x0100cc09,
+        0x0100cc17, 0x0500cc28, 0x0100d302, 0x0100d309, 0x0100d317, 0x0500d328,
+        0x0100d402, 0x0100d409, 0x0100d417, 0x0500d428, 0x0100d602, 0x0100d609,
+        0x0100d617, 0x0500d628, 0x0100dd02, 0x0100dd09, 0x0100dd17, 0x0500dd28,
+        0x0100de02, 0x0100de09, 0x0100de17, 0x0500de28, 0x0100df02, 0x0100df09,
+        0x0100df17, 0x0500df28, 0x0100f102, 0x0100f109, 0x0100f117, 0x0500f128,
+        0x0100f402, 0x0100f409, 0x0100f417, 0x0500f428, 0x0100f502, 0x0100f509,
+        0x0100f517, 0x0500f528, 0x0100f602, 0x0100f609, 0x0100f617, 0x0500f628,
+        0x0100f702, 0x0100f709, 0x0100f717, 0x0500f728, 0x0100f802, 0x0100f809,
+        0x0100f817, 0x0500f828, 0x0100fa02, 0x0100fa09, 0x0100fa17, 0x0500fa28,
+        0x0100fb02, 0x0100fb09, 0x0100fb17, 0x0500fb28, 0x0100fc02, 0x0100fc09,
+        0x0100fc17, 0x0500fc28, 0x0100fd02, 0x0100fd09, 0x0100fd17, 0x0500fd28,
+        0x0100fe02, 0x0100fe09, 0x0100fe17, 0x0500fe28, 0x01000201, 0x05000216,
+        0x01000301, 0x05000316, 0x01000401, 0x05000416, 0x01000501, 0x05000516,
+        0x01000601, 0x05000616, 0x01000701, 0x05000716, 0x01000801, 0x05000816,
+        0x01000b01, 0x05000b16, 0x01000c01, 0x05000c16, 0x01000e01, 0x05000e16,
+        0x01000f01, 0x05000f16, 0x01001001, 0x05001016, 0x01001101, 0x05001116,
+        0x01001201, 0x05001216, 0x01001301, 0x05001316, 0x01001401, 0x05001416,
+        0x01001501, 0x05001516, 0x01001701, 0x05001716, 0x01001801, 0x05001816,
+        0x01001901, 0x05001916, 0x01001a01, 0x05001a16, 0x01001b01, 0x05001b16,
+        0x01001c01, 0x05001c16, 0x01001d01, 0x05001d16, 0x01001e01, 0x05001e16,
+        0x01001f01, 0x05001f16, 0x01007f01, 0x05007f16, 0x0100dc01, 0x0500dc16,
+        0x0100f901, 0x0500f916, 0x000000fe, 0x040000ff
+    },
+    /* 191 */
+    {
+        0x0100c004, 0x0100c005, 0x0100c007, 0x0100c008, 0x0100c00b, 0x0100c00c,
+        0x0100c010, 0x0100c013, 0x0100c019, 0x0100c01c, 0x0100c020, 0x0100c023,
+        0x0100c02a, 0x0100c031, 0x0100c039, 0x0500c040, 0x0100c104, 0x0100c105,
+        0x0100c107, 0x0100c108, 0x0100c10b, 0x0100c10c, 0x0100c110, 0x0100c113,
+        0x0100c119, 0x0100c11c, 0x0100c120, 0x0100c123, 0x0100c12a, 0x0100c131,
+        0x0100c139, 0x0500c140, 0x0100c804, 0x0100c805, 0x0100c807, 0x0100c808,
+        0x0100c80b, 0x0100c80c, 0x0100c810, 0x0100c813, 0x0100c819, 0x0100c81c,
+        0x0100c820, 0x0100c823, 0x0100c82a, 0x0100c831, 0x0100c839, 0x0500c840,
+        0x0100c904, 0x0100c905, 0x0100c907, 0x0100c908, 0x0100c90b, 0x0100c90c,
+        0x0100c910, 0x0100c913, 0x0100c919, 0x0100c91c, 0x0100c920, 0x0100c923,
+        0x0100c92a, 0x0100c931, 0x0100c939, 0x0500c940, 0x0100ca04, 0x0100ca05,
+        0x0100ca07, 0x0100ca08, 0x0100ca0b, 0x0100ca0c, 0x0100ca10, 0x0100ca13,
+        0x0100ca19, 0x0100ca1c, 0x0100ca20, 0x0100ca23, 0x0100ca2a, 0x0100ca31,
+        0x0100ca39, 0x0500ca40, 0x0100cd04, 0x0100cd05, 0x0100cd07, 0x0100cd08,
+        0x0100cd0b, 0x0100cd0c, 0x0100cd10, 0x0100cd13, 0x0100cd19, 0x0100cd1c,
+        0x0100cd20, 0x0100cd23, 0x0100cd2a, 0x0100cd31, 0x0100cd39, 0x0500cd40,
+        0x0100d204, 0x0100d205, 0x0100d207, 0x0100d208, 0x0100d20b, 0x0100d20c,
+        0x0100d210, 0x0100d213, 0x0100d219, 0x0100d21c, 0x0100d220, 0x0100d223,
+        0x0100d22a, 0x0100d231, 0x0100d239, 0x0500d240, 0x0100d504, 0x0100d505,
+        0x0100d507, 0x0100d508, 0x0100d50b, 0x0100d50c, 0x0100d510, 0x0100d513,
+        0x0100d519, 0x0100d51c, 0x0100d520, 0x0100d523, 0x0100d52a, 0x0100d531,
+        0x0100d539, 0x0500d540, 0x0100da04, 0x0100da05, 0x0100da07, 0x0100da08,
+        0x0100da0b, 0x0100da0c, 0x0100da10, 0x0100da13, 0x0100da19, 0x0100da1c,
+        0x0100da20, 0x0100da23, 0x0100da2a, 0x0100da31, 0x0100da39, 0x0500da40,
+        0x0100db04, 0x0100db05, 0x0100db07, 0x0100db08, 0x0100db0b, 0x0100db0c,
+        0x0100db10, 0x0100db13, 0x0100db19, 0x0100db1c, 0x0100db20, 0x0100db23,
+        0x0100db2a, 0x0100db31, 0x0100db39, 0x0500db40, 0x0100ee04, 0x0100ee05,
+        0x0100ee07, 0x0100ee08, 0x0100ee0b, 0x0100ee0c, 0x0100ee10, 0x0100ee13,
+        0x0100ee19, 0x0100ee1c, 0x0100ee20, 0x0100ee23, 0x0100ee2a, 0x0100ee31,
+        0x0100ee39, 0x0500ee40, 0x0100f004, 0x0100f005, 0x0100f007, 0x0100f008,
+        0x0100f00b, 0x0100f00c, 0x0100f010, 0x0100f013, 0x0100f019, 0x0100f01c,
+        0x0100f020, 0x0100f023, 0x0100f02a, 0x0100f031, 0x0100f039, 0x0500f040,
+        0x0100f204, 0x0100f205, 0x0100f207, 0x0100f208, 0x0100f20b, 0x0100f20c,
+        0x0100f210, 0x0100f213, 0x0100f219, 0x0100f21c, 0x0100f220, 0x0100f223,
+        0x0100f22a, 0x0100f231, 0x0100f239, 0x0500f240, 0x0100f304, 0x0100f305,
+        0x0100f307, 0x0100f308, 0x0100f30b, 0x0100f30c, 0x0100f310, 0x0100f313,
+        0x0100f319, 0x0100f31c, 0x0100f320, 0x0100f323, 0x0100f32a, 0x0100f331,
+        0x0100f339, 0x0500f340, 0x0100ff04, 0x0100ff05, 0x0100ff07, 0x0100ff08,
+        0x0100ff0b, 0x0100ff0c, 0x0100ff10, 0x0100ff13, 0x0100ff19, 0x0100ff1c,
+        0x0100ff20, 0x0100ff23, 0x0100ff2a, 0x0100ff31, 0x0100ff39, 0x0500ff40,
+        0x0100cb03, 0x0100cb06, 0x0100cb0a, 0x0100cb0f, 0x0100cb18, 0x0100cb1f,
+        0x0100cb29, 0x0500cb38, 0x0100cc03, 0x0100cc06, 0x0100cc0a, 0x0100cc0f,
+        0x0100cc18, 0x0100cc1f, 0x0100cc29, 0x0500cc38
+    },
+    /* 192 */
+    {
+        0x0630c000, 0x0631c000, 0x0632c000, 0x0661c000, 0x0663c000, 0x0665c000,
+        0x0669c000, 0x066fc000, 0x0673c000, 0x0674c000, 0x0100c00d, 0x0100c00e,
+        0x0100c011, 0x0100c012, 0x0100c014, 0x0100c015, 0x0100c01a, 0x0100c01b,
+        0x0100c01d, 0x0100c01e, 0x0100c021, 0x0100c022, 0x0100c024, 0x0100c025,
+        0x0100c02b, 0x0100c02e, 0x0100c032, 0x0100c035, 0x0100c03a, 0x0100c03d,
+        0x0100c041, 0x0500c044, 0x0630c100, 0x0631c100, 0x0632c100, 0x0661c100,
+        0x0663c100, 0x0665c100, 0x0669c100, 0x066fc100, 0x0673c100, 0x0674c100,
+        0x0100c10d, 0x0100c10e, 0x0100c111, 0x0100c112, 0x0100c114, 0x0100c115,
+        0x0100c11a, 0x0100c11b, 0x0100c11d, 0x0100c11e, 0x0100c121, 0x0100c122,
+        0x0100c124, 0x0100c125, 0x0100c12b, 0x0100c12e, 0x0100c132, 0x0100c135,
+        0x0100c13a, 0x0100c13d, 0x0100c141, 0x0500c144, 0x0630c800, 0x0631c800,
+        0x0632c800, 0x0661c800, 0x0663c800, 0x0665c800, 0x0669c800, 0x066fc800,
+        0x0673c800, 0x0674c800, 0x0100c80d, 0x0100c80e, 0x0100c811, 0x0100c812,
+        0x0100c814, 0x0100c815, 0x0100c81a, 0x0100c81b, 0x0100c81d, 0x0100c81e,
+        0x0100c821, 0x0100c822, 0x0100c824, 0x0100c825, 0x0100c82b, 0x0100c82e,
+        0x0100c832, 0x0100c835, 0x0100c83a, 0x0100c83d, 0x0100c841, 0x0500c844,
+        0x0630c900, 0x0631c900, 0x0632c900, 0x0661c900, 0x0663c900, 0x0665c900,
+        0x0669c900, 0x066fc900, 0x0673c900, 0x0674c900, 0x0100c90d, 0x0100c90e,
+        0x0100c911, 0x0100c912, 0x0100c914, 0x0100c915, 0x0100c91a, 0x0100c91b,
+        0x0100c91d, 0x0100c91e, 0x0100c921, 0x0100c922, 0x0100c924, 0x0100c925,
+        0x0100c92b, 0x0100c92e, 0x0100c932, 0x0100c935, 0x0100c93a, 0x0100c93d,
+        0x0100c941, 0x0500c944, 0x0630ca00, 0x0631ca00, 0x0632ca00, 0x0661ca00,
+        0x0663ca00, 0x0665ca00, 0x0669ca00, 0x066fca00, 0x0673ca00, 0x0674ca00,
+        0x0100ca0d, 0x0100ca0e, 0x0100ca11, 0x0100ca12, 0x0100ca14, 0x0100ca15,
+        0x0100ca1a, 0x0100ca1b, 0x0100ca1d, 0x0100ca1e, 0x0100ca21, 0x0100ca22,
+        0x0100ca24, 0x0100ca25, 0x0100ca2b, 0x0100ca2e, 0x0100ca32, 0x0100ca35,
+        0x0100ca3a, 0x0100ca3d, 0x0100ca41, 0x0500ca44, 0x0630cd00, 0x0631cd00,
+        0x0632cd00, 0x0661cd00, 0x0663cd00, 0x0665cd00, 0x0669cd00, 0x066fcd00,
+        0x0673cd00, 0x0674cd00, 0x0100cd0d, 0x0100cd0e, 0x0100cd11, 0x0100cd12,
+        0x0100cd14, 0x0100cd15, 0x0100cd1a, 0x0100cd1b, 0x0100cd1d, 0x0100cd1e,
+        0x0100cd21, 0x0100cd22, 0x0100cd24, 0x0100cd25, 0x0100cd2b, 0x0100cd2e,
+        0x0100cd32, 0x0100cd35, 0x0100cd3a, 0x0100cd3d, 0x0100cd41, 0x0500cd44,
+        0x0630d200, 0x0631d200, 0x0632d200, 0x0661d200, 0x0663d200, 0x0665d200,
+        0x0669d200, 0x066fd200, 0x0673d200, 0x0674d200, 0x0100d20d, 0x0100d20e,
+        0x0100d211, 0x0100d212, 0x0100d214, 0x0100d215, 0x0100d21a, 0x0100d21b,
+        0x0100d21d, 0x0100d21e, 0x0100d221, 0x0100d222, 0x0100d224, 0x0100d225,
+        0x0100d22b, 0x0100d22e, 0x0100d232, 0x0100d235, 0x0100d23a, 0x0100d23d,
+        0x0100d241, 0x0500d244, 0x0630d500, 0x0631d500, 0x0632d500, 0x0661d500,
+        0x0663d500, 0x0665d500, 0x0669d500, 0x066fd500, 0x0673d500, 0x0674d500,
+        0x0100d50d, 0x0100d50e, 0x0100d511, 0x0100d512, 0x0100d514, 0x0100d515,
+        0x0100d51a, 0x0100d51b, 0x0100d51d, 0x0100d51e, 0x0100d521, 0x0100d522,
+        0x0100d524, 0x0100d525, 0x0100d52b, 0x0100d52e, 0x0100d532, 0x0100d535,
+        0x0100d53a, 0x0100d53d, 0x0100d541, 0x0500d544
+    },
+    /* 193 */
+    {
+        0x0230c001, 0x0630c016, 0x0231c001, 0x0631c016, 0x0232c001, 0x0632c016,
+        0x0261c001, 0x0661c016, 0x0263c001, 0x0663c016, 0x0265c001, 0x0665c016,
+        0x0269c001, 0x0669c016, 0x026fc001, 0x066fc016, 0x0273c001, 0x0673c016,
+        0x0274c001, 0x0674c016, 0x0620c000, 0x0625c000, 0x062dc000, 0x062ec000,
+        0x062fc000, 0x0633c000, 0x0634c000, 0x0635c000, 0x0636c000, 0x0637c000,
+        0x0638c000, 0x0639c000, 0x063dc000, 0x0641c000, 0x065fc000, 0x0662c000,
+        0x0664c000, 0x0666c000, 0x0667c000, 0x0668c000, 0x066cc000, 0x066dc000,
+        0x066ec000, 0x0670c000, 0x0672c000, 0x0675c000, 0x0100c026, 0x0100c027,
+        0x0100c02c, 0x0100c02d, 0x0100c02f, 0x0100c030, 0x0100c033, 0x0100c034,
+        0x0100c036, 0x0100c037, 0x0100c03b, 0x0100c03c, 0x0100c03e, 0x0100c03f,
+        0x0100c042, 0x0100c043, 0x0100c045, 0x0500c048, 0x0230c101, 0x0630c116,
+        0x0231c101, 0x0631c116, 0x0232c101, 0x0632c116, 0x0261c101, 0x0661c116,
+        0x0263c101, 0x0663c116, 0x0265c101, 0x0665c116, 0x0269c101, 0x0669c116,
+        0x026fc101, 0x066fc116, 0x0273c101, 0x0673c116, 0x0274c101, 0x0674c116,
+        0x0620c100, 0x0625c100, 0x062dc100, 0x062ec100, 0x062fc100, 0x0633c100,
+        0x0634c100, 0x0635c100, 0x0636c100, 0x0637c100, 0x0638c100, 0x0639c100,
+        0x063dc100, 0x0641c100, 0x065fc100, 0x0662c100, 0x0664c100, 0x0666c100,
+        0x0667c100, 0x0668c100, 0x066cc100, 0x066dc100, 0x066ec100, 0x0670c100,
+        0x0672c100, 0x0675c100, 0x0100c126, 0x0100c127, 0x0100c12c, 0x0100c12d,
+        0x0100c12f, 0x0100c130, 0x0100c133, 0x0100c134, 0x0100c136, 0x0100c137,
+        0x0100c13b, 0x0100c13c, 0x0100c13e, 0x0100c13f, 0x0100c142, 0x0100c143,
+        0x0100c145, 0x0500c148, 0x0230c801, 0x0630c816, 0x0231c801, 0x0631c816,
+        0x0232c801, 0x0632c816, 0x0261c801, 0x0661c816, 0x0263c801, 0x0663c816,
+        0x0265c801, 0x0665c816, 0x0269c801, 0x0669c816, 0x026fc801, 0x066fc816,
+        0x0273c801, 0x0673c816, 0x0274c801, 0x0674c816, 0x0620c800, 0x0625c800,
+        0x062dc800, 0x062ec800, 0x062fc800, 0x0633c800, 0x0634c800, 0x0635c800,
+        0x0636c800, 0x0637c800, 0x0638c800, 0x0639c800, 0x063dc800, 0x0641c800,
+        0x065fc800, 0x0662c800, 0x0664c800, 0x0666c800, 0x0667c800, 0x0668c800,
+        0x066cc800, 0x066dc800, 0x066ec800, 0x0670c800, 0x0672c800, 0x0675c800,
+        0x0100c826, 0x0100c827, 0x0100c82c, 0x0100c82d, 0x0100c82f, 0x0100c830,
+        0x0100c833, 0x0100c834, 0x0100c836, 0x0100c837, 0x0100c83b, 0x0100c83c,
+        0x0100c83e, 0x0100c83f, 0x0100c842, 0x0100c843, 0x0100c845, 0x0500c848,
+        0x0230c901, 0x0630c916, 0x0231c901, 0x0631c916, 0x0232c901, 0x0632c916,
+        0x0261c901, 0x0661c916, 0x0263c901, 0x0663c916, 0x0265c901, 0x0665c916,
+        0x0269c901, 0x0669c916, 0x026fc901, 0x066fc916, 0x0273c901, 0x0673c916,
+        0x0274c901, 0x0674c916, 0x0620c900, 0x0625c900, 0x062dc900, 0x062ec900,
+        0x062fc900, 0x0633c900, 0x0634c900, 0x0635c900, 0x0636c900, 0x0637c900,
+        0x0638c900, 0x0639c900, 0x063dc900, 0x0641c900, 0x065fc900, 0x0662c900,
+        0x0664c900, 0x0666c900, 0x0667c900, 0x0668c900, 0x066cc900, 0x066dc900,
+        0x066ec900, 0x0670c900, 0x0672c900, 0x0675c900, 0x0100c926, 0x0100c927,
+        0x0100c92c, 0x0100c92d, 0x0100c92f, 0x0100c930, 0x0100c933, 0x0100c934,
+        0x0100c936, 0x0100c937, 0x0100c93b, 0x0100c93c, 0x0100c93e, 0x0100c93f,
+        0x0100c942, 0x0100c943, 0x0100c945, 0x0500c948
+    },
+    /* 194 */
+    {
+        0x0230c002, 0x0230c009, 0x0230c017, 0x0630c028, 0x0231c002, 0x0231c009,
+        0x0231c017, 0x0631c028, 0x0232c002, 0x0232c009, 0x0232c017, 0x0632c028,
+        0x0261c002, 0x0261c009, 0x0261c017, 0x0661c028, 0x0263c002, 0x0263c009,
+        0x0263c017, 0x0663c028, 0x0265c002, 0x0265c009, 0x0265c017, 0x0665c028,
+        0x0269c002, 0x0269c009, 0x0269c017, 0x0669c028, 0x026fc002, 0x026fc009,
+        0x026fc017, 0x066fc028, 0x0273c002, 0x0273c009, 0x0273c017, 0x0673c028,
+        0x0274c002, 0x0274c009, 0x0274c017, 0x0674c028, 0x0220c001, 0x0620c016,
+        0x0225c001, 0x0625c016, 0x022dc001, 0x062dc016, 0x022ec001, 0x062ec016,
+        0x022fc001, 0x062fc016, 0x0233c001, 0x0633c016, 0x0234c001, 0x0634c016,
+        0x0235c001, 0x0635c016, 0x0236c001, 0x0636c016, 0x0237c001, 0x0637c016,
+        0x0238c001, 0x0638c016, 0x0239c001, 0x0639c016, 0x023dc001, 0x063dc016,
+        0x0241c001, 0x0641c016, 0x025fc001, 0x065fc016, 0x0262c001, 0x0662c016,
+        0x0264c001, 0x0664c016, 0x0266c001, 0x0666c016, 0x0267c001, 0x0667c016,
+        0x0268c001, 0x0668c016, 0x026cc001, 0x066cc016, 0x026dc001, 0x066dc016,
+        0x026ec001, 0x066ec016, 0x0270c001, 0x0670c016, 0x0272c001, 0x0672c016,
+        0x0275c001, 0x0675c016, 0x063ac000, 0x0642c000, 0x0643c000, 0x0644c000,
+        0x0645c000, 0x0646c000, 0x0647c000, 0x0648c000, 0x0649c000, 0x064ac000,
+        0x064bc000, 0x064cc000, 0x064dc000, 0x064ec000, 0x064fc000, 0x0650c000,
+        0x0651c000, 0x0652c000, 0x0653c000, 0x0654c000, 0x0655c000, 0x0656c000,
+        0x0657c000, 0x0659c000, 0x066ac000, 0x066bc000, 0x0671c000, 0x0676c000,
+        0x0677c000, 0x0678c000, 0x0679c000, 0x067ac000, 0x0100c046, 0x0100c047,
+        0x0100c049, 0x0500c04a, 0x0230c102, 0x0230c109, 0x0230c117, 0x0630c128,
+        0x0231c102, 0x0231c109, 0x0231c117, 0x0631c128, 0x0232c102, 0x0232c109,
+        0x0232c117, 0x0632c128, 0x0261c102, 0x0261c109, 0x0261c117, 0x0661c128,
+        0x0263c102, 0x0263c109, 0x0263c117, 0x0663c128, 0x0265c102, 0x0265c109,
+        0x0265c117, 0x0665c128, 0x0269c102, 0x0269c109, 0x0269c117, 0x0669c128,
+        0x026fc102, 0x026fc109, 0x026fc117, 0x066fc128, 0x0273c102, 0x0273c109,
+        0x0273c117, 0x0673c128, 0x0274c102, 0x0274c109, 0x0274c117, 0x0674c128,
+        0x0220c101, 0x0620c116, 0x0225c101, 0x0625c116, 0x022dc101, 0x062dc116,
+        0x022ec101, 0x062ec116, 0x022fc101, 0x062fc116, 0x0233c101, 0x0633c116,
+        0x0234c101, 0x0634c116, 0x0235c101, 0x0635c116, 0x0236c101, 0x0636c116,
+        0x0237c101, 0x0637c116, 0x0238c101, 0x0638c116, 0x0239c101, 0x0639c116,
+        0x023dc101, 0x063dc116, 0x0241c101, 0x0641c116, 0x025fc101, 0x065fc116,
+        0x0262c101, 0x0662c116, 0x0264c101, 0x0664c116, 0x0266c101, 0x0666c116,
+        0x0267c101, 0x0667c116, 0x0268c101, 0x0668c116, 0x026cc101, 0x066cc116,
+        0x026dc101, 0x066dc116, 0x026ec101, 0x066ec116, 0x0270c101, 0x0670c116,
+        0x0272c101, 0x0672c116, 0x0275c101, 0x0675c116, 0x063ac100, 0x0642c100,
+        0x0643c100, 0x0644c100, 0x0645c100, 0x0646c100, 0x0647c100, 0x0648c100,
+        0x0649c100, 0x064ac100, 0x064bc100, 0x064cc100, 0x064dc100, 0x064ec100,
+        0x064fc100, 0x0650c100, 0x0651c100, 0x0652c100, 0x0653c100, 0x0654c100,
+        0x0655c100, 0x0656c100, 0x0657c100, 0x0659c100, 0x066ac100, 0x066bc100,
+        0x0671c100, 0x0676c100, 0x0677c100, 0x0678c100, 0x0679c100, 0x067ac100,
+        0x0100c146, 0x0100c147, 0x0100c149, 0x0500c14a
+    },
+    /* 195 */
+    {
+        0x0230c802, 0x0230c809, 0x0230c817, 0x0630c828, 0x0231c802, 0x0231c809,
+        0x0231c817, 0x0631c828, 0x0232c802, 0x0232c809, 0x0232c817, 0x0632c828,
+        0x0261c802, 0x0261c809, 0x0261c817, 0x0661c828, 0x0263c802, 0x0263c809,
+        0x0263c817, 0x0663c828, 0x0265c802, 0x0265c809, 0x0265c817, 0x0665c828,
+        0x0269c802, 0x0269c809, 0x0269c817, 0x0669c828, 0x026fc802, 0x026fc809,
+        0x026fc817, 0x066fc828, 0x0273c802, 0x0273c809, 0x0273c817, 0x0673c828,
+        0x0274c802, 0x0274c809, 0x0274c817, 0x0674c828, 0x0220c801, 0x0620c816,
+        0x0225c801, 0x0625c816, 0x022dc801, 0x062dc816, 0x022ec801, 0x062ec816,
+        0x022fc801, 0x062fc816, 0x0233c801, 0x0633c816, 0x0234c801, 0x0634c816,
+        0x0235c801, 0x0635c816, 0x0236c801, 0x0636c816, 0x0237c801, 0x0637c816,
+        0x0238c801, 0x0638c816, 0x0239c801, 0x0639c816, 0x023dc801, 0x063dc816,
+        0x0241c801, 0x0641c816, 0x025fc801, 0x065fc816, 0x0262c801, 0x0662c816,
+        0x0264c801, 0x0664c816, 0x0266c801, 0x0666c816, 0x0267c801, 0x0667c816,
+        0x0268c801, 0x0668c816, 0x026cc801, 0x066cc816, 0x026dc801, 0x066dc816,
+        0x026ec801, 0x066ec816, 0x0270c801, 0x0670c816, 0x0272c801, 0x0672c816,
+        0x0275c801, 0x0675c816, 0x063ac800, 0x0642c800, 0x0643c800, 0x0644c800,
+        0x0645c800, 0x0646c800, 0x0647c800, 0x0648c800, 0x0649c800, 0x064ac800,
+        0x064bc800, 0x064cc800, 0x064dc800, 0x064ec800, 0x064fc800, 0x0650c800,
+        0x0651c800, 0x0652c800, 0x0653c800, 0x0654c800, 0x0655c800, 0x0656c800,
+        0x0657c800, 0x0659c800, 0x066ac800, 0x066bc800, 0x0671c800, 0x0676c800,
+        0x0677c800, 0x0678c800, 0x0679c800, 0x067ac800, 0x0100c846, 0x0100c847,
+        0x0100c849, 0x0500c84a, 0x0230c902, 0x0230c909, 0x0230c917, 0x0630c928,
+        0x0231c902, 0x0231c909, 0x0231c917, 0x0631c928, 0x0232c902, 0x0232c909,
+        0x0232c917, 0x0632c928, 0x0261c902, 0x0261c909, 0x0261c917, 0x0661c928,
+        0x0263c902, 0x0263c909, 0x0263c917, 0x0663c928, 0x0265c902, 0x0265c909,
+        0x0265c917, 0x0665c928, 0x0269c902, 0x0269c909, 0x0269c917, 0x0669c928,
+        0x026fc902, 0x026fc909, 0x026fc917, 0x066fc928, 0x0273c902, 0x0273c909,
+        0x0273c917, 0x0673c928, 0x0274c902, 0x0274c909, 0x0274c917, 0x0674c928,
+        0x0220c901, 0x0620c916, 0x0225c901, 0x0625c916, 0x022dc901, 0x062dc916,
+        0x022ec901, 0x062ec916, 0x022fc901, 0x062fc916, 0x0233c901, 0x0633c916,
+        0x0234c901, 0x0634c916, 0x0235c901, 0x0635c916, 0x0236c901, 0x0636c916,
+        0x0237c901, 0x0637c916, 0x0238c901, 0x0638c916, 0x0239c901, 0x0639c916,
+        0x023dc901, 0x063dc916, 0x0241c901, 0x0641c916, 0x025fc901, 0x065fc916,
+        0x0262c901, 0x0662c916, 0x0264c901, 0x0664c916, 0x0266c901, 0x0666c916,
+        0x0267c901, 0x0667c916, 0x0268c901, 0x0668c916, 0x026cc901, 0x066cc916,
+        0x026dc901, 0x066dc916, 0x026ec901, 0x066ec916, 0x0270c901, 0x0670c916,
+        0x0272c901, 0x0672c916, 0x0275c901, 0x0675c916, 0x063ac900, 0x0642c900,
+        0x0643c900, 0x0644c900, 0x0645c900, 0x0646c900, 0x0647c900, 0x0648c900,
+        0x0649c900, 0x064ac900, 0x064bc900, 0x064cc900, 0x064dc900, 0x064ec900,
+        0x064fc900, 0x0650c900, 0x0651c900, 0x0652c900, 0x0653c900, 0x0654c900,
+        0x0655c900, 0x0656c900, 0x0657c900, 0x0659c900, 0x066ac900, 0x066bc900,
+        0x0671c900, 0x0676c900, 0x0677c900, 0x0678c900, 0x0679c900, 0x067ac900,
+        0x0100c946, 0x0100c947, 0x0100c949, 0x0500c94a
+    },
+    /* 196 */
+    {
+        0x0230ca01, 0x0630ca16, 0x0231ca01, 0x0631ca16, 0x0232ca01, 0x0632ca16,
+        0x0261ca01, 0x0661ca16, 0x0263ca01, 0x0663ca16, 0x0265ca01, 0x0665ca16,
+        0x0269ca01, 0x0669ca16, 0x026fca01, 0x066fca16, 0x0273ca01, 0x0673ca16,
+        0x0274ca01, 0x0674ca16, 0x0620ca00, 0x0625ca00, 0x062dca00, 0x062eca00,
+        0x062fca00, 0x0633ca00, 0x0634ca00, 0x0635ca00, 0x0636ca00, 0x0637ca00,
+        0x0638ca00, 0x0639ca00, 0x063dca00, 0x0641ca00, 0x065fca00, 0x0662ca00,
+        0x0664ca00, 0x0666ca00, 0x0667ca00, 0x0668ca00, 0x066cca00, 0x066dca00,
+        0x066eca00, 0x0670ca00, 0x0672ca00, 0x0675ca00, 0x0100ca26, 0x0100ca27,
+        0x0100ca2c, 0x0100ca2d, 0x0100ca2f, 0x0100ca30, 0x0100ca33, 0x0100ca34,
+        0x0100ca36, 0x0100ca37, 0x0100ca3b, 0x0100ca3c, 0x0100ca3e, 0x0100ca3f,
+        0x0100ca42, 0x0100ca43, 0x0100ca45, 0x0500ca48, 0x0230cd01, 0x0630cd16,
+        0x0231cd01, 0x0631cd16, 0x0232cd01, 0x0632cd16, 0x0261cd01, 0x0661cd16,
+        0x0263cd01, 0x0663cd16, 0x0265cd01, 0x0665cd16, 0x0269cd01, 0x0669cd16,
+        0x026fcd01, 0x066fcd16, 0x0273cd01, 0x0673cd16, 0x0274cd01, 0x0674cd16,
+        0x0620cd00, 0x0625cd00, 0x062dcd00, 0x062ecd00, 0x062fcd00, 0x0633cd00,
+        0x0634cd00, 0x0635cd00, 0x0636cd00, 0x0637cd00, 0x0638cd00, 0x0639cd00,
+        0x063dcd00, 0x0641cd00, 0x065fcd00, 0x0662cd00, 0x0664cd00, 0x0666cd00,
+        0x0667cd00, 0x0668cd00, 0x066ccd00, 0x066dcd00, 0x066ecd00, 0x0670cd00,
+        0x0672cd00, 0x0675cd00, 0x0100cd26, 0x0100cd27, 0x0100cd2c, 0x0100cd2d,
+        0x0100cd2f, 0x0100cd30, 0x0100cd33, 0x0100cd34, 0x0100cd36, 0x0100cd37,
+        0x0100cd3b, 0x0100cd3c, 0x0100cd3e, 0x0100cd3f, 0x0100cd42, 0x0100cd43,
+        0x0100cd45, 0x0500cd48, 0x0230d201, 0x0630d216, 0x0231d201, 0x0631d216,
+        0x0232d201, 0x0632d216, 0x0261d201, 0x0661d216, 0x0263d201, 0x0663d216,
+        0x0265d201, 0x0665d216, 0x0269d201, 0x0669d216, 0x026fd201, 0x066fd216,
+        0x0273d201, 0x0673d216, 0x0274d201, 0x0674d216, 0x0620d200, 0x0625d200,
+        0x062dd200, 0x062ed200, 0x062fd200, 0x0633d200, 0x0634d200, 0x0635d200,
+        0x0636d200, 0x0637d200, 0x0638d200, 0x0639d200, 0x063dd200, 0x0641d200,
+        0x065fd200, 0x0662d200, 0x0664d200, 0x0666d200, 0x0667d200, 0x0668d200,
+        0x066cd200, 0x066dd200, 0x066ed200, 0x0670d200, 0x0672d200, 0x0675d200,
+        0x0100d226, 0x0100d227, 0x0100d22c, 0x0100d22d, 0x0100d22f, 0x0100d230,
+        0x0100d233, 0x0100d234, 0x0100d236, 0x0100d237, 0x0100d23b, 0x0100d23c,
+        0x0100d23e, 0x0100d23f, 0x0100d242, 0x0100d243, 0x0100d245, 0x0500d248,
+        0x0230d501, 0x0630d516, 0x0231d501, 0x0631d516, 0x0232d501, 0x0632d516,
+        0x0261d501, 0x0661d516, 0x0263d501, 0x0663d516, 0x0265d501, 0x0665d516,
+        0x0269d501, 0x0669d516, 0x026fd501, 0x066fd516, 0x0273d501, 0x0673d516,
+        0x0274d501, 0x0674d516, 0x0620d500, 0x0625d500, 0x062dd500, 0x062ed500,
+        0x062fd500, 0x0633d500, 0x0634d500, 0x0635d500, 0x0636d500, 0x0637d500,
+        0x0638d500, 0x0639d500, 0x063dd500, 0x0641d500, 0x065fd500, 0x0662d500,
+        0x0664d500, 0x0666d500, 0x0667d500, 0x0668d500, 0x066cd500, 0x066dd500,
+        0x066ed500, 0x0670d500, 0x0672d500, 0x0675d500, 0x0100d526, 0x0100d527,
+        0x0100d52c, 0x0100d52d, 0x0100d52f, 0x0100d530, 0x0100d533, 0x0100d534,
+        0x0100d536, 0x0100d537, 0x0100d53b, 0x0100d53c, 0x0100d53e, 0x0100d53f,
+        0x0100d542, 0x0100d543, 0x0100d545, 0x0500d548
+    },
+    /* 197 */
+    {
+        0x0230ca02, 0x0230ca09, 0x0230ca17, 0x0630ca28, 0x0231ca02, 0x0231ca09,
+        0x0231ca17, 0x0631ca28, 0x0232ca02, 0x0232ca09, 0x0232ca17, 0x0632ca28,
+        0x0261ca02, 0x0261ca09, 0x0261ca17, 0x0661ca28, 0x0263ca02, 0x0263ca09,
+        0x0263ca17, 0x0663ca28, 0x0265ca02, 0x0265ca09, 0x0265ca17, 0x0665ca28,
+        0x0269ca02, 0x0269ca09, 0x0269ca17, 0x0669ca28, 0x026fca02, 0x026fca09,
+        0x026fca17, 0x066fca28, 0x0273ca02, 0x0273ca09, 0x0273ca17, 0x0673ca28,
+        0x0274ca02, 0x0274ca09, 0x0274ca17, 0x0674ca28, 0x0220ca01, 0x0620ca16,
+        0x0225ca01, 0x0625ca16, 0x022dca01, 0x062dca16, 0x022eca01, 0x062eca16,
+        0x022fca01, 0x062fca16, 0x0233ca01, 0x0633ca16, 0x0234ca01, 0x0634ca16,
+        0x0235ca01, 0x0635ca16, 0x0236ca01, 0x0636ca16, 0x0237ca01, 0x0637ca16,
+        0x0238ca01, 0x0638ca16, 0x0239ca01, 0x0639ca16, 0x023dca01, 0x063dca16,
+        0x0241ca01, 0x0641ca16, 0x025fca01, 0x065fca16, 0x0262ca01, 0x0662ca16,
+        0x0264ca01, 0x0664ca16, 0x0266ca01, 0x0666ca16, 0x0267ca01, 0x0667ca16,
+        0x0268ca01, 0x0668ca16, 0x026cca01, 0x066cca16, 0x026dca01, 0x066dca16,
+        0x026eca01, 0x066eca16, 0x0270ca01, 0x0670ca16, 0x0272ca01, 0x0672ca16,
+        0x0275ca01, 0x0675ca16, 0x063aca00, 0x0642ca00, 0x0643ca00, 0x0644ca00,
+        0x0645ca00, 0x0646ca00, 0x0647ca00, 0x0648ca00, 0x0649ca00, 0x064aca00,
+        0x064bca00, 0x064cca00, 0x064dca00, 0x064eca00, 0x064fca00, 0x0650ca00,
+        0x0651ca00, 0x0652ca00, 0x0653ca00, 0x0654ca00, 0x0655ca00, 0x0656ca00,
+        0x0657ca00, 0x0659ca00, 0x066aca00, 0x066bca00, 0x0671ca00, 0x0676ca00,
+        0x0677ca00, 0x0678ca00, 0x0679ca00, 0x067aca00, 0x0100ca46, 0x0100ca47,
+        0x0100ca49, 0x0500ca4a, 0x0230cd02, 0x0230cd09, 0x0230cd17, 0x0630cd28,
+        0x0231cd02, 0x0231cd09, 0x0231cd17, 0x0631cd28, 0x0232cd02, 0x0232cd09,
+        0x0232cd17, 0x0632cd28, 0x0261cd02, 0x0261cd09, 0x0261cd17, 0x0661cd28,
+        0x0263cd02, 0x0263cd09, 0x0263cd17, 0x0663cd28, 0x0265cd02, 0x0265cd09,
+        0x0265cd17, 0x0665cd28, 0x0269cd02, 0x0269cd09, 0x0269cd17, 0x0669cd28,
+        0x026fcd02, 0x026fcd09, 0x026fcd17, 0x066fcd28, 0x0273cd02, 0x0273cd09,
+        0x0273cd17, 0x0673cd28, 0x0274cd02, 0x0274cd09, 0x0274cd17, 0x0674cd28,
+        0x0220cd01, 0x0620cd16, 0x0225cd01, 0x0625cd16, 0x022dcd01, 0x062dcd16,
+        0x022ecd01, 0x062ecd16, 0x022fcd01, 0x062fcd16, 0x0233cd01, 0x0633cd16,
+        0x0234cd01, 0x0634cd16, 0x0235cd01, 0x0635cd16, 0x0236cd01, 0x0636cd16,
+        0x0237cd01, 0x0637cd16, 0x0238cd01, 0x0638cd16, 0x0239cd01, 0x0639cd16,
+        0x023dcd01, 0x063dcd16, 0x0241cd01, 0x0641cd16, 0x025fcd01, 0x065fcd16,
+        0x0262cd01, 0x0662cd16, 0x0264cd01, 0x0664cd16, 0x0266cd01, 0x0666cd16,
+        0x0267cd01, 0x0667cd16, 0x0268cd01, 0x0668cd16, 0x026ccd01, 0x066ccd16,
+        0x026dcd01, 0x066dcd16, 0x026ecd01, 0x066ecd16, 0x0270cd01, 0x0670cd16,
+        0x0272cd01, 0x0672cd16, 0x0275cd01, 0x0675cd16, 0x063acd00, 0x0642cd00,
+        0x0643cd00, 0x0644cd00, 0x0645cd00, 0x0646cd00, 0x0647cd00, 0x0648cd00,
+        0x0649cd00, 0x064acd00, 0x064bcd00, 0x064ccd00, 0x064dcd00, 0x064ecd00,
+        0x064fcd00, 0x0650cd00, 0x0651cd00, 0x0652cd00, 0x0653cd00, 0x0654cd00,
+        0x0655cd00, 0x0656cd00, 0x0657cd00, 0x0659cd00, 0x066acd00, 0x066bcd00,
+        0x0671cd00, 0x0676cd00, 0x0677cd00, 0x0678cd00, 0x0679cd00, 0x067acd00,
+        0x0100cd46, 0x0100cd47, 0x0100cd49, 0x0500cd4a
+    },
+    /* 198 */
+    {
+        0x0230d202, 0x0230d209, 0x0230d217, 0x0630d228, 0x0231d202, 0x0231d209,
+        0x0231d217, 0x0631d228, 0x0232d202, 0x0232d209, 0x0232d217, 0x0632d228,
+        0x0261d202, 0x0261d209, 0x0261d217, 0x0661d228, 0x0263d202, 0x0263d209,
+        0x0263d217, 0x0663d228, 0x0265d202, 0x0265d209, 0x0265d217, 0x0665d228,
+        0x0269d202, 0x0269d209, 0x0269d217, 0x0669d228, 0x026fd202, 0x026fd209,
+        0x026fd217, 0x066fd228, 0x0273d202, 0x0273d209, 0x0273d217, 0x0673d228,
+        0x0274d202, 0x0274d209, 0x0274d217, 0x0674d228, 0x0220d201, 0x0620d216,
+        0x0225d201, 0x0625d216, 0x022dd201, 0x062dd216, 0x022ed201, 0x062ed216,
+        0x022fd201, 0x062fd216, 0x0233d201, 0x0633d216, 0x0234d201, 0x0634d216,
+        0x0235d201, 0x0635d216, 0x0236d201, 0x0636d216, 0x0237d201, 0x0637d216,
+        0x0238d201, 0x0638d216, 0x0239d201, 0x0639d216, 0x023dd201, 0x063dd216,
+        0x0241d201, 0x0641d216, 0x025fd201, 0x065fd216, 0x0262d201, 0x0662d216,
+        0x0264d201, 0x0664d216, 0x0266d201, 0x0666d216, 0x0267d201, 0x0667d216,
+        0x0268d201, 0x0668d216, 0x026cd201, 0x066cd216, 0x026dd201, 0x066dd216,
+        0x026ed201, 0x066ed216, 0x0270d201, 0x0670d216, 0x0272d201, 0x0672d216,
+        0x0275d201, 0x0675d216, 0x063ad200, 0x0642d200, 0x0643d200, 0x0644d200,
+        0x0645d200, 0x0646d200, 0x0647d200, 0x0648d200, 0x0649d200, 0x064ad200,
+        0x064bd200, 0x064cd200, 0x064dd200, 0x064ed200, 0x064fd200, 0x0650d200,
+        0x0651d200, 0x0652d200, 0x0653d200, 0x0654d200, 0x0655d200, 0x0656d200,
+        0x0657d200, 0x0659d200, 0x066ad200, 0x066bd200, 0x0671d200, 0x0676d200,
+        0x0677d200, 0x0678d200, 0x0679d200, 0x067ad200, 0x0100d246, 0x0100d247,
+        0x0100d249, 0x0500d24a, 0x0230d502, 0x0230d509, 0x0230d517, 0x0630d528,
+        0x0231d502, 0x0231d509, 0x0231d517, 0x0631d528, 0x0232d502, 0x0232d509,
+        0x0232d517, 0x0632d528, 0x0261d502, 0x0261d509, 0x0261d517, 0x0661d528,
+        0x0263d502, 0x0263d509, 0x0263d517, 0x0663d528, 0x0265d502, 0x0265d509,
+        0x0265d517, 0x0665d528, 0x0269d502, 0x0269d509, 0x0269d517, 0x0669d528,
+        0x026fd502, 0x026fd509, 0x026fd517, 0x066fd528, 0x0273d502, 0x0273d509,
+        0x0273d517, 0x0673d528, 0x0274d502, 0x0274d509, 0x0274d517, 0x0674d528,
+        0x0220d501, 0x0620d516, 0x0225d501, 0x0625d516, 0x022dd501, 0x062dd516,
+        0x022ed501, 0x062ed516, 0x022fd501, 0x062fd516, 0x0233d501, 0x0633d516,
+        0x0234d501, 0x0634d516, 0x0235d501, 0x0635d516, 0x0236d501, 0x0636d516,
+        0x0237d501, 0x0637d516, 0x0238d501, 0x0638d516, 0x0239d501, 0x0639d516,
+        0x023dd501, 0x063dd516, 0x0241d501, 0x0641d516, 0x025fd501, 0x065fd516,
+        0x0262d501, 0x0662d516, 0x0264d501, 0x0664d516, 0x0266d501, 0x0666d516,
+        0x0267d501, 0x0667d516, 0x0268d501, 0x0668d516, 0x026cd501, 0x066cd516,
+        0x026dd501, 0x066dd516, 0x026ed501, 0x066ed516, 0x0270d501, 0x0670d516,
+        0x0272d501, 0x0672d516, 0x0275d501, 0x0675d516, 0x063ad500, 0x0642d500,
+        0x0643d500, 0x0644d500, 0x0645d500, 0x0646d500, 0x0647d500, 0x0648d500,
+        0x0649d500, 0x064ad500, 0x064bd500, 0x064cd500, 0x064dd500, 0x064ed500,
+        0x064fd500, 0x0650d500, 0x0651d500, 0x0652d500, 0x0653d500, 0x0654d500,
+        0x0655d500, 0x0656d500, 0x0657d500, 0x0659d500, 0x066ad500, 0x066bd500,
+        0x0671d500, 0x0676d500, 0x0677d500, 0x0678d500, 0x0679d500, 0x067ad500,
+        0x0100d546, 0x0100d547, 0x0100d549, 0x0500d54a
+    },
+    /* 199 */
+    {
+        0x0630da00, 0x0631da00, 0x0632da00, 0x0661da00, 0x0663da00, 0x0665da00,
+        0x0669da00, 0x066fda00, 0x0673da00, 0x0674da00, 0x0100da0d, 0x0100da0e,
+        0x0100da11, 0x0100da12, 0x0100da14, 0x0100da15, 0x0100da1a, 0x0100da1b,
+        0x0100da1d, 0x0100da1e, 0x0100da21, 0x0100da22, 0x0100da24, 0x0100da25,
+        0x0100da2b, 0x0100da2e, 0x0100da32, 0x0100da35, 0x0100da3a, 0x0100da3d,
+        0x0100da41, 0x0500da44, 0x0630db00, 0x0631db00, 0x0632db00, 0x0661db00,
+        0x0663db00, 0x0665db00, 0x0669db00, 0x066fdb00, 0x0673db00, 0x0674db00,
+        0x0100db0d, 0x0100db0e, 0x0100db11, 0x0100db12, 0x0100db14, 0x0100db15,
+        0x0100db1a, 0x0100db1b, 0x0100db1d, 0x0100db1e, 0x0100db21, 0x0100db22,
+        0x0100db24, 0x0100db25, 0x0100db2b, 0x0100db2e, 0x0100db32, 0x0100db35,
+        0x0100db3a, 0x0100db3d, 0x0100db41, 0x0500db44, 0x0630ee00, 0x0631ee00,
+        0x0632ee00, 0x0661ee00, 0x0663ee00, 0x0665ee00, 0x0669ee00, 0x066fee00,
+        0x0673ee00, 0x0674ee00, 0x0100ee0d, 0x0100ee0e, 0x0100ee11, 0x0100ee12,
+        0x0100ee14, 0x0100ee15, 0x0100ee1a, 0x0100ee1b, 0x0100ee1d, 0x0100ee1e,
+        0x0100ee21, 0x0100ee22, 0x0100ee24, 0x0100ee25, 0x0100ee2b, 0x0100ee2e,
+        0x0100ee32, 0x0100ee35, 0x0100ee3a, 0x0100ee3d, 0x0100ee41, 0x0500ee44,
+        0x0630f000, 0x0631f000, 0x0632f000, 0x0661f000, 0x0663f000, 0x0665f000,
+        0x0669f000, 0x066ff000, 0x0673f000, 0x0674f000, 0x0100f00d, 0x0100f00e,
+        0x0100f011, 0x0100f012, 0x0100f014, 0x0100f015, 0x0100f01a, 0x0100f01b,
+        0x0100f01d, 0x0100f01e, 0x0100f021, 0x0100f022, 0x0100f024, 0x0100f025,
+        0x0100f02b, 0x0100f02e, 0x0100f032, 0x0100f035, 0x0100f03a, 0x0100f03d,
+        0x0100f041, 0x0500f044, 0x0630f200, 0x0631f200, 0x0632f200, 0x0661f200,
+        0x0663f200, 0x0665f200, 0x0669f200, 0x066ff200, 0x0673f200, 0x0674f200,
+        0x0100f20d, 0x0100f20e, 0x0100f211, 0x0100f212, 0x0100f214, 0x0100f215,
+        0x0100f21a, 0x0100f21b, 0x0100f21d, 0x0100f21e, 0x0100f221, 0x0100f222,
+        0x0100f224, 0x0100f225, 0x0100f22b, 0x0100f22e, 0x0100f232, 0x0100f235,
+        0x0100f23a, 0x0100f23d, 0x0100f241, 0x0500f244, 0x0630f300, 0x0631f300,
+        0x0632f300, 0x0661f300, 0x0663f300, 0x0665f300, 0x0669f300, 0x066ff300,
+        0x0673f300, 0x0674f300, 0x0100f30d, 0x0100f30e, 0x0100f311, 0x0100f312,
+        0x0100f314, 0x0100f315, 0x0100f31a, 0x0100f31b, 0x0100f31d, 0x0100f31e,
+        0x0100f321, 0x0100f322, 0x0100f324, 0x0100f325, 0x0100f32b, 0x0100f32e,
+        0x0100f332, 0x0100f335, 0x0100f33a, 0x0100f33d, 0x0100f341, 0x0500f344,
+        0x0630ff00, 0x0631ff00, 0x0632ff00, 0x0661ff00, 0x0663ff00, 0x0665ff00,
+        0x0669ff00, 0x066fff00, 0x0673ff00, 0x0674ff00, 0x0100ff0d, 0x0100ff0e,
+        0x0100ff11, 0x0100ff12, 0x0100ff14, 0x0100ff15, 0x0100ff1a, 0x0100ff1b,
+        0x0100ff1d, 0x0100ff1e, 0x0100ff21, 0x0100ff22, 0x0100ff24, 0x0100ff25,
+        0x0100ff2b, 0x0100ff2e, 0x0100ff32, 0x0100ff35, 0x0100ff3a, 0x0100ff3d,
+        0x0100ff41, 0x0500ff44, 0x0100cb04, 0x0100cb05, 0x0100cb07, 0x0100cb08,
+        0x0100cb0b, 0x0100cb0c, 0x0100cb10, 0x0100cb13, 0x0100cb19, 0x0100cb1c,
+        0x0100cb20, 0x0100cb23, 0x0100cb2a, 0x0100cb31, 0x0100cb39, 0x0500cb40,
+        0x0100cc04, 0x0100cc05, 0x0100cc07, 0x0100cc08, 0x0100cc0b, 0x0100cc0c,
+        0x0100cc10, 0x0100cc13, 0x0100cc19, 0x0100cc1c, 0x0100cc20, 0x0100cc23,
+        0x0100cc2a, 0x0100cc31, 0x0100cc39, 0x0500cc40
+    },
+    /* 200 */
+    {
+        0x0230da01, 0x0630da16, 0x0231da01, 0x0631da16, 0x0232da01, 0x0632da16,
+        0x0261da01, 0x0661da16, 0x0263da01, 0x0663da16, 0x0265da01, 0x0665da16,
+        0x0269da01, 0x0669da16, 0x026fda01, 0x066fda16, 0x0273da01, 0x0673da16,
+        0x0274da01, 0x0674da16, 0x0620da00, 0x0625da00, 0x062dda00, 0x062eda00,
+        0x062fda00, 0x0633da00, 0x0634da00, 0x0635da00, 0x0636da00, 0x0637da00,
+        0x0638da00, 0x0639da00, 0x063dda00, 0x0641da00, 0x065fda00, 0x0662da00,
+        0x0664da00, 0x0666da00, 0x0667da00, 0x0668da00, 0x066cda00, 0x066dda00,
+        0x066eda00, 0x0670da00, 0x0672da00, 0x0675da00, 0x0100da26, 0x0100da27,
+        0x0100da2c, 0x0100da2d, 0x0100da2f, 0x0100da30, 0x0100da33, 0x0100da34,
+        0x0100da36, 0x0100da37, 0x0100da3b, 0x0100da3c, 0x0100da3e, 0x0100da3f,
+        0x0100da42, 0x0100da43, 0x0100da45, 0x0500da48, 0x0230db01, 0x0630db16,
+        0x0231db01, 0x0631db16, 0x0232db01, 0x0632db16, 0x0261db01, 0x0661db16,
+        0x0263db01, 0x0663db16, 0x0265db01, 0x0665db16, 0x0269db01, 0x0669db16,
+        0x026fdb01, 0x066fdb16, 0x0273db01, 0x0673db16, 0x0274db01, 0x0674db16,
+        0x0620db00, 0x0625db00, 0x062ddb00, 0x062edb00, 0x062fdb00, 0x0633db00,
+        0x0634db00, 0x0635db00, 0x0636db00, 0x0637db00, 0x0638db00, 0x0639db00,
+        0x063ddb00, 0x0641db00, 0x065fdb00, 0x0662db00, 0x0664db00, 0x0666db00,
+        0x0667db00, 0x0668db00, 0x066cdb00, 0x066ddb00, 0x066edb00, 0x0670db00,
+        0x0672db00, 0x0675db00, 0x0100db26, 0x0100db27, 0x0100db2c, 0x0100db2d,
+        0x0100db2f, 0x0100db30, 0x0100db33, 0x0100db34, 0x0100db36, 0x0100db37,
+        0x0100db3b, 0x0100db3c, 0x0100db3e, 0x0100db3f, 0x0100db42, 0x0100db43,
+        0x0100db45, 0x0500db48, 0x0230ee01, 0x0630ee16, 0x0231ee01, 0x0631ee16,
+        0x0232ee01, 0x0632ee16, 0x0261ee01, 0x0661ee16, 0x0263ee01, 0x0663ee16,
+        0x0265ee01, 0x0665ee16, 0x0269ee01, 0x0669ee16, 0x026fee01, 0x066fee16,
+        0x0273ee01, 0x0673ee16, 0x0274ee01, 0x0674ee16, 0x0620ee00, 0x0625ee00,
+        0x062dee00, 0x062eee00, 0x062fee00, 0x0633ee00, 0x0634ee00, 0x0635ee00,
+        0x0636ee00, 0x0637ee00, 0x0638ee00, 0x0639ee00, 0x063dee00, 0x0641ee00,
+        0x065fee00, 0x0662ee00, 0x0664ee00, 0x0666ee00, 0x0667ee00, 0x0668ee00,
+        0x066cee00, 0x066dee00, 0x066eee00, 0x0670ee00, 0x0672ee00, 0x0675ee00,
+        0x0100ee26, 0x0100ee27, 0x0100ee2c, 0x0100ee2d, 0x0100ee2f, 0x0100ee30,
+        0x0100ee33, 0x0100ee34, 0x0100ee36, 0x0100ee37, 0x0100ee3b, 0x0100ee3c,
+        0x0100ee3e, 0x0100ee3f, 0x0100ee42, 0x0100ee43, 0x0100ee45, 0x0500ee48,
+        0x0230f001, 0x0630f016, 0x0231f001, 0x0631f016, 0x0232f001, 0x0632f016,
+        0x0261f001, 0x0661f016, 0x0263f001, 0x0663f016, 0x0265f001, 0x0665f016,
+        0x0269f001, 0x0669f016, 0x026ff001, 0x066ff016, 0x0273f001, 0x0673f016,
+        0x0274f001, 0x0674f016, 0x0620f000, 0x0625f000, 0x062df000, 0x062ef000,
+        0x062ff000, 0x0633f000, 0x0634f000, 0x0635f000, 0x0636f000, 0x0637f000,
+        0x0638f000, 0x0639f000, 0x063df000, 0x0641f000, 0x065ff000, 0x0662f000,
+        0x0664f000, 0x0666f000, 0x0667f000, 0x0668f000, 0x066cf000, 0x066df000,
+        0x066ef000, 0x0670f000, 0x0672f000, 0x0675f000, 0x0100f026, 0x0100f027,
+        0x0100f02c, 0x0100f02d, 0x0100f02f, 0x0100f030, 0x0100f033, 0x0100f034,
+        0x0100f036, 0x0100f037, 0x0100f03b, 0x0100f03c, 0x0100f03e, 0x0100f03f,
+        0x0100f042, 0x0100f043, 0x0100f045, 0x0500f048
+    },
+    /* 201 */
+    {
+        0x0230da02, 0x0230da09, 0x0230da17, 0x0630da28, 0x0231da02, 0x0231da09,
+        0x0231da17, 0x0631da28, 0x0232da02, 0x0232da09, 0x0232da17, 0x0632da28,
+        0x0261da02, 0x0261da09, 0x0261da17, 0x0661da28, 0x0263da02, 0x0263da09,
+        0x0263da17, 0x0663da28, 0x0265da02, 0x0265da09, 0x0265da17, 0x0665da28,
+        0x0269da02, 0x0269da09, 0x0269da17, 0x0669da28, 0x026fda02, 0x026fda09,
+        0x026fda17, 0x066fda28, 0x0273da02, 0x0273da09, 0x0273da17, 0x0673da28,
+        0x0274da02, 0x0274da09, 0x0274da17, 0x0674da28, 0x0220da01, 0x0620da16,
+        0x0225da01, 0x0625da16, 0x022dda01, 0x062dda16, 0x022eda01, 0x062eda16,
+        0x022fda01, 0x062fda16, 0x0233da01, 0x0633da16, 0x0234da01, 0x0634da16,
+        0x0235da01, 0x0635da16, 0x0236da01, 0x0636da16, 0x0237da01, 0x0637da16,
+        0x0238da01, 0x0638da16, 0x0239da01, 0x0639da16, 0x023dda01, 0x063dda16,
+        0x0241da01, 0x0641da16, 0x025fda01, 0x065fda16, 0x0262da01, 0x0662da16,
+        0x0264da01, 0x0664da16, 0x0266da01, 0x0666da16, 0x0267da01, 0x0667da16,
+        0x0268da01, 0x0668da16, 0x026cda01, 0x066cda16, 0x026dda01, 0x066dda16,
+        0x026eda01, 0x066eda16, 0x0270da01, 0x0670da16, 0x0272da01, 0x0672da16,
+        0x0275da01, 0x0675da16, 0x063ada00, 0x0642da00, 0x0643da00, 0x0644da00,
+        0x0645da00, 0x0646da00, 0x0647da00, 0x0648da00, 0x0649da00, 0x064ada00,
+        0x064bda00, 0x064cda00, 0x064dda00, 0x064eda00, 0x064fda00, 0x0650da00,
+        0x0651da00, 0x0652da00, 0x0653da00, 0x0654da00, 0x0655da00, 0x0656da00,
+        0x0657da00, 0x0659da00, 0x066ada00, 0x066bda00, 0x0671da00, 0x0676da00,
+        0x0677da00, 0x0678da00, 0x0679da00, 0x067ada00, 0x0100da46, 0x0100da47,
+        0x0100da49, 0x0500da4a, 0x0230db02, 0x0230db09, 0x0230db17, 0x0630db28,
+        0x0231db02, 0x0231db09, 0x0231db17, 0x0631db28, 0x0232db02, 0x0232db09,
+        0x0232db17, 0x0632db28, 0x0261db02, 0x0261db09, 0x0261db17, 0x0661db28,
+        0x0263db02, 0x0263db09, 0x0263db17, 0x0663db28, 0x0265db02, 0x0265db09,
+        0x0265db17, 0x0665db28, 0x0269db02, 0x0269db09, 0x0269db17, 0x0669db28,
+        0x026fdb02, 0x026fdb09, 0x026fdb17, 0x066fdb28, 0x0273db02, 0x0273db09,
+        0x0273db17, 0x0673db28, 0x0274db02, 0x0274db09, 0x0274db17, 0x0674db28,
+        0x0220db01, 0x0620db16, 0x0225db01, 0x0625db16, 0x022ddb01, 0x062ddb16,
+        0x022edb01, 0x062edb16, 0x022fdb01, 0x062fdb16, 0x0233db01, 0x0633db16,
+        0x0234db01, 0x0634db16, 0x0235db01, 0x0635db16, 0x0236db01, 0x0636db16,
+        0x0237db01, 0x0637db16, 0x0238db01, 0x0638db16, 0x0239db01, 0x0639db16,
+        0x023ddb01, 0x063ddb16, 0x0241db01, 0x0641db16, 0x025fdb01, 0x065fdb16,
+        0x0262db01, 0x0662db16, 0x0264db01, 0x0664db16, 0x0266db01, 0x0666db16,
+        0x0267db01, 0x0667db16, 0x0268db01, 0x0668db16, 0x026cdb01, 0x066cdb16,
+        0x026ddb01, 0x066ddb16, 0x026edb01, 0x066edb16, 0x0270db01, 0x0670db16,
+        0x0272db01, 0x0672db16, 0x0275db01, 0x0675db16, 0x063adb00, 0x0642db00,
+        0x0643db00, 0x0644db00, 0x0645db00, 0x0646db00, 0x0647db00, 0x0648db00,
+        0x0649db00, 0x064adb00, 0x064bdb00, 0x064cdb00, 0x064ddb00, 0x064edb00,
+        0x064fdb00, 0x0650db00, 0x0651db00, 0x0652db00, 0x0653db00, 0x0654db00,
+        0x0655db00, 0x0656db00, 0x0657db00, 0x0659db00, 0x066adb00, 0x066bdb00,
+        0x0671db00, 0x0676db00, 0x0677db00, 0x0678db00, 0x0679db00, 0x067adb00,
+        0x0100db46, 0x0100db47, 0x0100db49, 0x0500db4a
+    },
+    /* 202 */
+    {
+        0x0230ee02, 0x0230ee09, 0x0230ee17, 0x0630ee28, 0x0231ee02, 0x0231ee09,
+        0x0231ee17, 0x0631ee28, 0x0232ee02, 0x0232ee09, 0x0232ee17, 0x0632ee28,
+        0x0261ee02, 0x0261ee09, 0x0261ee17, 0x0661ee28, 0x0263ee02, 0x0263ee09,
+        0x0263ee17, 0x0663ee28, 0x0265ee02, 0x0265ee09, 0x0265ee17, 0x0665ee28,
+        0x0269ee02, 0x0269ee09, 0x0269ee17, 0x0669ee28, 0x026fee02, 0x026fee09,
+        0x026fee17, 0x066fee28, 0x0273ee02, 0x0273ee09, 0x0273ee17, 0x0673ee28,
+        0x0274ee02, 0x0274ee09, 0x0274ee17, 0x0674ee28, 0x0220ee01, 0x0620ee16,
+        0x0225ee01, 0x0625ee16, 0x022dee01, 0x062dee16, 0x022eee01, 0x062eee16,
+        0x022fee01, 0x062fee16, 0x0233ee01, 0x0633ee16, 0x0234ee01, 0x0634ee16,
+        0x0235ee01, 0x0635ee16, 0x0236ee01, 0x0636ee16, 0x0237ee01, 0x0637ee16,
+        0x0238ee01, 0x0638ee16, 0x0239ee01, 0x0639ee16, 0x023dee01, 0x063dee16,
+        0x0241ee01, 0x0641ee16, 0x025fee01, 0x065fee16, 0x0262ee01, 0x0662ee16,
+        0x0264ee01, 0x0664ee16, 0x0266ee01, 0x0666ee16, 0x0267ee01, 0x0667ee16,
+        0x0268ee01, 0x0668ee16, 0x026cee01, 0x066cee16, 0x026dee01, 0x066dee16,
+        0x026eee01, 0x066eee16, 0x0270ee01, 0x0670ee16, 0x0272ee01, 0x0672ee16,
+        0x0275ee01, 0x0675ee16, 0x063aee00, 0x0642ee00, 0x0643ee00, 0x0644ee00,
+        0x0645ee00, 0x0646ee00, 0x0647ee00, 0x0648ee00, 0x0649ee00, 0x064aee00,
+        0x064bee00, 0x064cee00, 0x064dee00, 0x064eee00, 0x064fee00, 0x0650ee00,
+        0x0651ee00, 0x0652ee00, 0x0653ee00, 0x0654ee00, 0x0655ee00, 0x0656ee00,
+        0x0657ee00, 0x0659ee00, 0x066aee00, 0x066bee00, 0x0671ee00, 0x0676ee00,
+        0x0677ee00, 0x0678ee00, 0x0679ee00, 0x067aee00, 0x0100ee46, 0x0100ee47,
+        0x0100ee49, 0x0500ee4a, 0x0230f002, 0x0230f009, 0x0230f017, 0x0630f028,
+        0x0231f002, 0x0231f009, 0x0231f017, 0x0631f028, 0x0232f002, 0x0232f009,
+        0x0232f017, 0x0632f028, 0x0261f002, 0x0261f009, 0x0261f017, 0x0661f028,
+        0x0263f002, 0x0263f009, 0x0263f017, 0x0663f028, 0x0265f002, 0x0265f009,
+        0x0265f017, 0x0665f028, 0x0269f002, 0x0269f009, 0x0269f017, 0x0669f028,
+        0x026ff002, 0x026ff009, 0x026ff017, 0x066ff028, 0x0273f002, 0x0273f009,
+        0x0273f017, 0x0673f028, 0x0274f002, 0x0274f009, 0x0274f017, 0x0674f028,
+        0x0220f001, 0x0620f016, 0x0225f001, 0x0625f016, 0x022df001, 0x062df016,
+        0x022ef001, 0x062ef016, 0x022ff001, 0x062ff016, 0x0233f001, 0x0633f016,
+        0x0234f001, 0x0634f016, 0x0235f001, 0x0635f016, 0x0236f001, 0x0636f016,
+        0x0237f001, 0x0637f016, 0x0238f001, 0x0638f016, 0x0239f001, 0x0639f016,
+        0x023df001, 0x063df016, 0x0241f001, 0x0641f016, 0x025ff001, 0x065ff016,
+        0x0262f001, 0x0662f016, 0x0264f001, 0x0664f016, 0x0266f001, 0x0666f016,
+        0x0267f001, 0x0667f016, 0x0268f001, 0x0668f016, 0x026cf001, 0x066cf016,
+        0x026df001, 0x066df016, 0x026ef001, 0x066ef016, 0x0270f001, 0x0670f016,
+        0x0272f001, 0x0672f016, 0x0275f001, 0x0675f016, 0x063af000, 0x0642f000,
+        0x0643f000, 0x0644f000, 0x0645f000, 0x0646f000, 0x0647f000, 0x0648f000,
+        0x0649f000, 0x064af000, 0x064bf000, 0x064cf000, 0x064df000, 0x064ef000,
+        0x064ff000, 0x0650f000, 0x0651f000, 0x0652f000, 0x0653f000, 0x0654f000,
+        0x0655f000, 0x0656f000, 0x0657f000, 0x0659f000, 0x066af000, 0x066bf000,
+        0x0671f000, 0x0676f000, 0x0677f000, 0x0678f000, 0x0679f000, 0x067af000,
+        0x0100f046, 0x0100f047, 0x0100f049, 0x0500f04a
+    },
+    /* 203 */
+    {
+        0x0230f201, 0x0630f216, 0x0231f201, 0x0631f216, 0x0232f201, 0x0632f216,
+        0x0261f201, 0x0661f216, 0x0263f201, 0x0663f216, 0x0265f201, 0x0665f216,
+        0x0269f201, 0x0669f216, 0x026ff201, 0x066ff216, 0x0273f201, 0x0673f216,
+        0x0274f201, 0x0674f216, 0x0620f200, 0x0625f200, 0x062df200, 0x062ef200,
+        0x062ff200, 0x0633f200, 0x0634f200, 0x0635f200, 0x0636f200, 0x0637f200,
+        0x0638f200, 0x0639f200, 0x063df200, 0x0641f200, 0x065ff200, 0x0662f200,
+        0x0664f200, 0x0666f200, 0x0667f200, 0x0668f200, 0x066cf200, 0x066df200,
+        0x066ef200, 0x0670f200, 0x0672f200, 0x0675f200, 0x0100f226, 0x0100f227,
+        0x0100f22c, 0x0100f22d, 0x0100f22f, 0x0100f230, 0x0100f233, 0x0100f234,
+        0x0100f236, 0x0100f237, 0x0100f23b, 0x0100f23c, 0x0100f23e, 0x0100f23f,
+        0x0100f242, 0x0100f243, 0x0100f245, 0x0500f248, 0x0230f301, 0x0630f316,
+        0x0231f301, 0x0631f316, 0x0232f301, 0x0632f316, 0x0261f301, 0x0661f316,
+        0x0263f301, 0x0663f316, 0x0265f301, 0x0665f316, 0x0269f301, 0x0669f316,
+        0x026ff301, 0x066ff316, 0x0273f301, 0x0673f316, 0x0274f301, 0x0674f316,
+        0x0620f300, 0x0625f300, 0x062df300, 0x062ef300, 0x062ff300, 0x0633f300,
+        0x0634f300, 0x0635f300, 0x0636f300, 0x0637f300, 0x0638f300, 0x0639f300,
+        0x063df300, 0x0641f300, 0x065ff300, 0x0662f300, 0x0664f300, 0x0666f300,
+        0x0667f300, 0x0668f300, 0x066cf300, 0x066df300, 0x066ef300, 0x0670f300,
+        0x0672f300, 0x0675f300, 0x0100f326, 0x0100f327, 0x0100f32c, 0x0100f32d,
+        0x0100f32f, 0x0100f330, 0x0100f333, 0x0100f334, 0x0100f336, 0x0100f337,
+        0x0100f33b, 0x0100f33c, 0x0100f33e, 0x0100f33f, 0x0100f342, 0x0100f343,
+        0x0100f345, 0x0500f348, 0x0230ff01, 0x0630ff16, 0x0231ff01, 0x0631ff16,
+        0x0232ff01, 0x0632ff16, 0x0261ff01, 0x0661ff16, 0x0263ff01, 0x0663ff16,
+        0x0265ff01, 0x0665ff16, 0x0269ff01, 0x0669ff16, 0x026fff01, 0x066fff16,
+        0x0273ff01, 0x0673ff16, 0x0274ff01, 0x0674ff16, 0x0620ff00, 0x0625ff00,
+        0x062dff00, 0x062eff00, 0x062fff00, 0x0633ff00, 0x0634ff00, 0x0635ff00,
+        0x0636ff00, 0x0637ff00, 0x0638ff00, 0x0639ff00, 0x063dff00, 0x0641ff00,
+        0x065fff00, 0x0662ff00, 0x0664ff00, 0x0666ff00, 0x0667ff00, 0x0668ff00,
+        0x066cff00, 0x066dff00, 0x066eff00, 0x0670ff00, 0x0672ff00, 0x0675ff00,
+        0x0100ff26, 0x0100ff27, 0x0100ff2c, 0x0100ff2d, 0x0100ff2f, 0x0100ff30,
+        0x0100ff33, 0x0100ff34, 0x0100ff36, 0x0100ff37, 0x0100ff3b, 0x0100ff3c,
+        0x0100ff3e, 0x0100ff3f, 0x0100ff42, 0x0100ff43, 0x0100ff45, 0x0500ff48,
+        0x0630cb00, 0x0631cb00, 0x0632cb00, 0x0661cb00, 0x0663cb00, 0x0665cb00,
+        0x0669cb00, 0x066fcb00, 0x0673cb00, 0x0674cb00, 0x0100cb0d, 0x0100cb0e,
+        0x0100cb11, 0x0100cb12, 0x0100cb14, 0x0100cb15, 0x0100cb1a, 0x0100cb1b,
+        0x0100cb1d, 0x0100cb1e, 0x0100cb21, 0x0100cb22, 0x0100cb24, 0x0100cb25,
+        0x0100cb2b, 0x0100cb2e, 0x0100cb32, 0x0100cb35, 0x0100cb3a, 0x0100cb3d,
+        0x0100cb41, 0x0500cb44, 0x0630cc00, 0x0631cc00, 0x0632cc00, 0x0661cc00,
+        0x0663cc00, 0x0665cc00, 0x0669cc00, 0x066fcc00, 0x0673cc00, 0x0674cc00,
+        0x0100cc0d, 0x0100cc0e, 0x0100cc11, 0x0100cc12, 0x0100cc14, 0x0100cc15,
+        0x0100cc1a, 0x0100cc1b, 0x0100cc1d, 0x0100cc1e, 0x0100cc21, 0x0100cc22,
+        0x0100cc24, 0x0100cc25, 0x0100cc2b, 0x0100cc2e, 0x0100cc32, 0x0100cc35,
+        0x0100cc3a, 0x0100cc3d, 0x0100cc41, 0x0500cc44
+    },
+    /* 204 */
+    {
+        0x0230f202, 0x0230f209, 0x0230f217, 0x0630f228, 0x0231f202, 0x0231f209,
+        0x0231f217, 0x0631f228, 0x0232f202, 0x0232f209, 0x0232f217, 0x0632f228,
+        0x0261f202, 0x0261f209, 0x0261f217, 0x0661f228, 0x0263f202, 0x0263f209,
+        0x0263f217, 0x0663f228, 0x0265f202, 0x0265f209, 0x0265f217, 0x0665f228,
+        0x0269f202, 0x0269f209, 0x0269f217, 0x0669f228, 0x026ff202, 0x026ff209,
+        0x026ff217, 0x066ff228, 0x0273f202, 0x0273f209, 0x0273f217, 0x0673f228,
+        0x0274f202, 0x0274f209, 0x0274f217, 0x0674f228, 0x0220f201, 0x0620f216,
+        0x0225f201, 0x0625f216, 0x022df201, 0x062df216, 0x022ef201, 0x062ef216,
+        0x022ff201, 0x062ff216, 0x0233f201, 0x0633f216, 0x0234f201, 0x0634f216,
+        0x0235f201, 0x0635f216, 0x0236f201, 0x0636f216, 0x0237f201, 0x0637f216,
+        0x0238f201, 0x0638f216, 0x0239f201, 0x0639f216, 0x023df201, 0x063df216,
+        0x0241f201, 0x0641f216, 0x025ff201, 0x065ff216, 0x0262f201, 0x0662f216,
+        0x0264f201, 0x0664f216, 0x0266f201, 0x0666f216, 0x0267f201, 0x0667f216,
+        0x0268f201, 0x0668f216, 0x026cf201, 0x066cf216, 0x026df201, 0x066df216,
+        0x026ef201, 0x066ef216, 0x0270f201, 0x0670f216, 0x0272f201, 0x0672f216,
+        0x0275f201, 0x0675f216, 0x063af200, 0x0642f200, 0x0643f200, 0x0644f200,
+        0x0645f200, 0x0646f200, 0x0647f200, 0x0648f200, 0x0649f200, 0x064af200,
+        0x064bf200, 0x064cf200, 0x064df200, 0x064ef200, 0x064ff200, 0x0650f200,
+        0x0651f200, 0x0652f200, 0x0653f200, 0x0654f200, 0x0655f200, 0x0656f200,
+        0x0657f200, 0x0659f200, 0x066af200, 0x066bf200, 0x0671f200, 0x0676f200,
+        0x0677f200, 0x0678f200, 0x0679f200, 0x067af200, 0x0100f246, 0x0100f247,
+        0x0100f249, 0x0500f24a, 0x0230f302, 0x0230f309, 0x0230f317, 0x0630f328,
+        0x0231f302, 0x0231f309, 0x0231f317, 0x0631f328, 0x0232f302, 0x0232f309,
+        0x0232f317, 0x0632f328, 0x0261f302, 0x0261f309, 0x0261f317, 0x0661f328,
+        0x0263f302, 0x0263f309, 0x0263f317, 0x0663f328, 0x0265f302, 0x0265f309,
+        0x0265f317, 0x0665f328, 0x0269f302, 0x0269f309, 0x0269f317, 0x0669f328,
+        0x026ff302, 0x026ff309, 0x026ff317, 0x066ff328, 0x0273f302, 0x0273f309,
+        0x0273f317, 0x0673f328, 0x0274f302, 0x0274f309, 0x0274f317, 0x0674f328,
+        0x0220f301, 0x0620f316, 0x0225f301, 0x0625f316, 0x022df301, 0x062df316,
+        0x022ef301, 0x062ef316, 0x022ff301, 0x062ff316, 0x0233f301, 0x0633f316,
+        0x0234f301, 0x0634f316, 0x0235f301, 0x0635f316, 0x0236f301, 0x0636f316,
+        0x0237f301, 0x0637f316, 0x0238f301, 0x0638f316, 0x0239f301, 0x0639f316,
+        0x023df301, 0x063df316, 0x0241f301, 0x0641f316, 0x025ff301, 0x065ff316,
+        0x0262f301, 0x0662f316, 0x0264f301, 0x0664f316, 0x0266f301, 0x0666f316,
+        0x0267f301, 0x0667f316, 0x0268f301, 0x0668f316, 0x026cf301, 0x066cf316,
+        0x026df301, 0x066df316, 0x026ef301, 0x066ef316, 0x0270f301, 0x0670f316,
+        0x0272f301, 0x0672f316, 0x0275f301, 0x0675f316, 0x063af300, 0x0642f300,
+        0x0643f300, 0x0644f300, 0x0645f300, 0x0646f300, 0x0647f300, 0x0648f300,
+        0x0649f300, 0x064af300, 0x064bf300, 0x064cf300, 0x064df300, 0x064ef300,
+        0x064ff300, 0x0650f300, 0x0651f300, 0x0652f300, 0x0653f300, 0x0654f300,
+        0x0655f300, 0x0656f300, 0x0657f300, 0x0659f300, 0x066af300, 0x066bf300,
+        0x0671f300, 0x0676f300, 0x0677f300, 0x0678f300, 0x0679f300, 0x067af300,
+        0x0100f346, 0x0100f347, 0x0100f349, 0x0500f34a
+    },
+    /* 205 */
+    {
+        0x0230ff02, 0x0230ff09, 0x0230ff17, 0x0630ff28, 0x0231ff02, 0x0231ff09,
+        0x0231ff17, 0x0631ff28, 0x0232ff02, 0x0232ff09, 0x0232ff17, 0x0632ff28,
+        0x0261ff02, 0x0261ff09, 0x0261ff17, 0x0661ff28, 0x0263ff02, 0x0263ff09,
+        0x0263ff17, 0x0663ff28, 0x0265ff02, 0x0265ff09, 0x0265ff17, 0x0665ff28,
+        0x0269ff02, 0x0269ff09, 0x0269ff17, 0x0669ff28, 0x026fff02, 0x026fff09,
+        0x026fff17, 0x066fff28, 0x0273ff02, 0x0273ff09, 0x0273ff17, 0x0673ff28,
+        0x0274ff02, 0x0274ff09, 0x0274ff17, 0x0674ff28, 0x0220ff01, 0x0620ff16,
+        0x0225ff01, 0x0625ff16, 0x022dff01, 0x062dff16, 0x022eff01, 0x062eff16,
+        0x022fff01, 0x062fff16, 0x0233ff01, 0x0633ff16, 0x0234ff01, 0x0634ff16,
+        0x0235ff01, 0x0635ff16, 0x0236ff01, 0x0636ff16, 0x0237ff01, 0x0637ff16,
+        0x0238ff01, 0x0638ff16, 0x0239ff01, 0x0639ff16, 0x023dff01, 0x063dff16,
+        0x0241ff01, 0x0641ff16, 0x025fff01, 0x065fff16, 0x0262ff01, 0x0662ff16,
+        0x0264ff01, 0x0664ff16, 0x0266ff01, 0x0666ff16, 0x0267ff01, 0x0667ff16,
+        0x0268ff01, 0x0668ff16, 0x026cff01, 0x066cff16, 0x026dff01, 0x066dff16,
+        0x026eff01, 0x066eff16, 0x0270ff01, 0x0670ff16, 0x0272ff01, 0x0672ff16,
+        0x0275ff01, 0x0675ff16, 0x063aff00, 0x0642ff00, 0x0643ff00, 0x0644ff00,
+        0x0645ff00, 0x0646ff00, 0x0647ff00, 0x0648ff00, 0x0649ff00, 0x064aff00,
+        0x064bff00, 0x064cff00, 0x064dff00, 0x064eff00, 0x064fff00, 0x0650ff00,
+        0x0651ff00, 0x0652ff00, 0x0653ff00, 0x0654ff00, 0x0655ff00, 0x0656ff00,
+        0x0657ff00, 0x0659ff00, 0x066aff00, 0x066bff00, 0x0671ff00, 0x0676ff00,
+        0x0677ff00, 0x0678ff00, 0x0679ff00, 0x067aff00, 0x0100ff46, 0x0100ff47,
+        0x0100ff49, 0x0500ff4a, 0x0230cb01, 0x0630cb16, 0x0231cb01, 0x0631cb16,
+        0x0232cb01, 0x0632cb16, 0x0261cb01, 0x0661cb16, 0x0263cb01, 0x0663cb16,
+        0x0265cb01, 0x0665cb16, 0x0269cb01, 0x0669cb16, 0x026fcb01, 0x066fcb16,
+        0x0273cb01, 0x0673cb16, 0x0274cb01, 0x0674cb16, 0x0620cb00, 0x0625cb00,
+        0x062dcb00, 0x062ecb00, 0x062fcb00, 0x0633cb00, 0x0634cb00, 0x0635cb00,
+        0x0636cb00, 0x0637cb00, 0x0638cb00, 0x0639cb00, 0x063dcb00, 0x0641cb00,
+        0x065fcb00, 0x0662cb00, 0x0664cb00, 0x0666cb00, 0x0667cb00, 0x0668cb00,
+        0x066ccb00, 0x066dcb00, 0x066ecb00, 0x0670cb00, 0x0672cb00, 0x0675cb00,
+        0x0100cb26, 0x0100cb27, 0x0100cb2c, 0x0100cb2d, 0x0100cb2f, 0x0100cb30,
+        0x0100cb33, 0x0100cb34, 0x0100cb36, 0x0100cb37, 0x0100cb3b, 0x0100cb3c,
+        0x0100cb3e, 0x0100cb3f, 0x0100cb42, 0x0100cb43, 0x0100cb45, 0x0500cb48,
+        0x0230cc01, 0x0630cc16, 0x0231cc01, 0x0631cc16, 0x0232cc01, 0x0632cc16,
+        0x0261cc01, 0x0661cc16, 0x0263cc01, 0x0663cc16, 0x0265cc01, 0x0665cc16,
+        0x0269cc01, 0x0669cc16, 0x026fcc01, 0x066fcc16, 0x0273cc01, 0x0673cc16,
+        0x0274cc01, 0x0674cc16, 0x0620cc00, 0x0625cc00, 0x062dcc00, 0x062ecc00,
+        0x062fcc00, 0x0633cc00, 0x0634cc00, 0x0635cc00, 0x0636cc00, 0x0637cc00,
+        0x0638cc00, 0x0639cc00, 0x063dcc00, 0x0641cc00, 0x065fcc00, 0x0662cc00,
+        0x0664cc00, 0x0666cc00, 0x0667cc00, 0x0668cc00, 0x066ccc00, 0x066dcc00,
+        0x066ecc00, 0x0670cc00, 0x0672cc00, 0x0675cc00, 0x0100cc26, 0x0100cc27,
+        0x0100cc2c, 0x0100cc2d, 0x0100cc2f, 0x0100cc30, 0x0100cc33, 0x0100cc34,
+        0x0100cc36, 0x0100cc37, 0x0100cc3b, 0x0100cc3c, 0x0100cc3e, 0x0100cc3f,
+        0x0100cc42, 0x0100cc43, 0x0100cc45, 0x0500cc48
+    },
+    /* 206 */
+    {
+        0x0230cb02, 0x0230cb09, 0x0230cb17, 0x0630cb28, 0x0231cb02, 0x0231cb09,
+        0x0231cb17, 0x0631cb28, 0x0232cb02, 0x0232cb09, 0x0232cb17, 0x0632cb28,
+        0x0261cb02, 0x0261cb09, 0x0261cb17, 0x0661cb28, 0x0263cb02, 0x0263cb09,
+        0x0263cb17, 0x0663cb28, 0x0265cb02, 0x0265cb09, 0x0265cb17, 0x0665cb28,
+        0x0269cb02, 0x0269cb09, 0x0269cb17, 0x0669cb28, 0x026fcb02, 0x026fcb09,
+        0x026fcb17, 0x066fcb28, 0x0273cb02, 0x0273cb09, 0x0273cb17, 0x0673cb28,
+        0x0274cb02, 0x0274cb09, 0x0274cb17, 0x0674cb28, 0x0220cb01, 0x0620cb16,
+        0x0225cb01, 0x0625cb16, 0x022dcb01, 0x062dcb16, 0x022ecb01, 0x062ecb16,
+        0x022fcb01, 0x062fcb16, 0x0233cb01, 0x0633cb16, 0x0234cb01, 0x0634cb16,
+        0x0235cb01, 0x0635cb16, 0x0236cb01, 0x0636cb16, 0x0237cb01, 0x0637cb16,
+        0x0238cb01, 0x0638cb16, 0x0239cb01, 0x0639cb16, 0x023dcb01, 0x063dcb16,
+        0x0241cb01, 0x0641cb16, 0x025fcb01, 0x065fcb16, 0x0262cb01, 0x0662cb16,
+        0x0264cb01, 0x0664cb16, 0x0266cb01, 0x0666cb16, 0x0267cb01, 0x0667cb16,
+        0x0268cb01, 0x0668cb16, 0x026ccb01, 0x066ccb16, 0x026dcb01, 0x066dcb16,
+        0x026ecb01, 0x066ecb16, 0x0270cb01, 0x0670cb16, 0x0272cb01, 0x0672cb16,
+        0x0275cb01, 0x0675cb16, 0x063acb00, 0x0642cb00, 0x0643cb00, 0x0644cb00,
+        0x0645cb00, 0x0646cb00, 0x0647cb00, 0x0648cb00, 0x0649cb00, 0x064acb00,
+        0x064bcb00, 0x064ccb00, 0x064dcb00, 0x064ecb00, 0x064fcb00, 0x0650cb00,
+        0x0651cb00, 0x0652cb00, 0x0653cb00, 0x0654cb00, 0x0655cb00, 0x0656cb00,
+        0x0657cb00, 0x0659cb00, 0x066acb00, 0x066bcb00, 0x0671cb00, 0x0676cb00,
+        0x0677cb00, 0x0678cb00, 0x0679cb00, 0x067acb00, 0x0100cb46, 0x0100cb47,
+        0x0100cb49, 0x0500cb4a, 0x0230cc02, 0x0230cc09, 0x0230cc17, 0x0630cc28,
+        0x0231cc02, 0x0231cc09, 0x0231cc17, 0x0631cc28, 0x0232cc02, 0x0232cc09,
+        0x0232cc17, 0x0632cc28, 0x0261cc02, 0x0261cc09, 0x0261cc17, 0x0661cc28,
+        0x0263cc02, 0x0263cc09, 0x0263cc17, 0x0663cc28, 0x0265cc02, 0x0265cc09,
+        0x0265cc17, 0x0665cc28, 0x0269cc02, 0x0269cc09, 0x0269cc17, 0x0669cc28,
+        0x026fcc02, 0x026fcc09, 0x026fcc17, 0x066fcc28, 0x0273cc02, 0x0273cc09,
+        0x0273cc17, 0x0673cc28, 0x0274cc02, 0x0274cc09, 0x0274cc17, 0x0674cc28,
+        0x0220cc01, 0x0620cc16, 0x0225cc01, 0x0625cc16, 0x022dcc01, 0x062dcc16,
+        0x022ecc01, 0x062ecc16, 0x022fcc01, 0x062fcc16, 0x0233cc01, 0x0633cc16,
+        0x0234cc01, 0x0634cc16, 0x0235cc01, 0x0635cc16, 0x0236cc01, 0x0636cc16,
+        0x0237cc01, 0x0637cc16, 0x0238cc01, 0x0638cc16, 0x0239cc01, 0x0639cc16,
+        0x023dcc01, 0x063dcc16, 0x0241cc01, 0x0641cc16, 0x025fcc01, 0x065fcc16,
+        0x0262cc01, 0x0662cc16, 0x0264cc01, 0x0664cc16, 0x0266cc01, 0x0666cc16,
+        0x0267cc01, 0x0667cc16, 0x0268cc01, 0x0668cc16, 0x026ccc01, 0x066ccc16,
+        0x026dcc01, 0x066dcc16, 0x026ecc01, 0x066ecc16, 0x0270cc01, 0x0670cc16,
+        0x0272cc01, 0x0672cc16, 0x0275cc01, 0x0675cc16, 0x063acc00, 0x0642cc00,
+        0x0643cc00, 0x0644cc00, 0x0645cc00, 0x0646cc00, 0x0647cc00, 0x0648cc00,
+        0x0649cc00, 0x064acc00, 0x064bcc00, 0x064ccc00, 0x064dcc00, 0x064ecc00,
+        0x064fcc00, 0x0650cc00, 0x0651cc00, 0x0652cc00, 0x0653cc00, 0x0654cc00,
+        0x0655cc00, 0x0656cc00, 0x0657cc00, 0x0659cc00, 0x066acc00, 0x066bcc00,
+        0x0671cc00, 0x0676cc00, 0x0677cc00, 0x0678cc00, 0x0679cc00, 0x067acc00,
+        0x0100cc46, 0x0100cc47, 0x0100cc49, 0x0500cc4a
+    },
+    /* 207 */
+    {
+        0x0100d303, 0x0100d306, 0x0100d30a, 0x0100d30f, 0x0100d318, 0x0100d31f,
+        0x0100d329, 0x0500d338, 0x0100d403, 0x0100d406, 0x0100d40a, 0x0100d40f,
+        0x0100d418, 0x0100d41f, 0x0100d429, 0x0500d438, 0x0100d603, 0x0100d606,
+        0x0100d60a, 0x0100d60f, 0x0100d618, 0x0100d61f, 0x0100d629, 0x0500d638,
+        0x0100dd03, 0x0100dd06, 0x0100dd0a, 0x0100dd0f, 0x0100dd18, 0x0100dd1f,
+        0x0100dd29, 0x0500dd38, 0x0100de03, 0x0100de06, 0x0100de0a, 0x0100de0f,
+        0x0100de18, 0x0100de1f, 0x0100de29, 0x0500de38, 0x0100df03, 0x0100df06,
+        0x0100df0a, 0x0100df0f, 0x0100df18, 0x0100df1f, 0x0100df29, 0x0500df38,
+        0x0100f103, 0x0100f106, 0x0100f10a, 0x0100f10f, 0x0100f118, 0x0100f11f,
+        0x0100f129, 0x0500f138, 0x0100f403, 0x0100f406, 0x0100f40a, 0x0100f40f,
+        0x0100f418, 0x0100f41f, 0x0100f429, 0x0500f438, 0x0100f503, 0x0100f506,
+        0x0100f50a, 0x0100f50f, 0x0100f518, 0x0100f51f, 0x0100f529, 0x0500f538,
+        0x0100f603, 0x0100f606, 0x0100f60a, 0x0100f60f, 0x0100f618, 0x0100f61f,
+        0x0100f629, 0x0500f638, 0x0100f703, 0x0100f706, 0x0100f70a, 0x0100f70f,
+        0x0100f718, 0x0100f71f, 0x0100f729, 0x0500f738, 0x0100f803, 0x0100f806,
+        0x0100f80a, 0x0100f80f, 0x0100f818, 0x0100f81f, 0x0100f829, 0x0500f838,
+        0x0100fa03, 0x0100fa06, 0x0100fa0a, 0x0100fa0f, 0x0100fa18, 0x0100fa1f,
+        0x0100fa29, 0x0500fa38, 0x0100fb03, 0x0100fb06, 0x0100fb0a, 0x0100fb0f,
+        0x0100fb18, 0x0100fb1f, 0x0100fb29, 0x0500fb38, 0x0100fc03, 0x0100fc06,
+        0x0100fc0a, 0x0100fc0f, 0x0100fc18, 0x0100fc1f, 0x0100fc29, 0x0500fc38,
+        0x0100fd03, 0x0100fd06, 0x0100fd0a, 0x0100fd0f, 0x0100fd18, 0x0100fd1f,
+        0x0100fd29, 0x0500fd38, 0x0100fe03, 0x0100fe06, 0x0100fe0a, 0x0100fe0f,
+        0x0100fe18, 0x0100fe1f, 0x0100fe29, 0x0500fe38, 0x01000202, 0x01000209,
+        0x01000217, 0x05000228, 0x01000302, 0x01000309, 0x01000317, 0x05000328,
+        0x01000402, 0x01000409, 0x01000417, 0x05000428, 0x01000502, 0x01000509,
+        0x01000517, 0x05000528, 0x01000602, 0x01000609, 0x01000617, 0x05000628,
+        0x01000702, 0x01000709, 0x01000717, 0x05000728, 0x01000802, 0x01000809,
+        0x01000817, 0x05000828, 0x01000b02, 0x01000b09, 0x01000b17, 0x05000b28,
+        0x01000c02, 0x01000c09, 0x01000c17, 0x05000c28, 0x01000e02, 0x01000e09,
+        0x01000e17, 0x05000e28, 0x01000f02, 0x01000f09, 0x01000f17, 0x05000f28,
+        0x01001002, 0x01001009, 0x01001017, 0x05001028, 0x01001102, 0x01001109,
+        0x01001117, 0x05001128, 0x01001202, 0x01001209, 0x01001217, 0x05001228,
+        0x01001302, 0x01001309, 0x01001317, 0x05001328, 0x01001402, 0x01001409,
+        0x01001417, 0x05001428, 0x01001502, 0x01001509, 0x01001517, 0x05001528,
+        0x01001702, 0x01001709, 0x01001717, 0x05001728, 0x01001802, 0x01001809,
+        0x01001817, 0x05001828, 0x01001902, 0x01001909, 0x01001917, 0x05001928,
+        0x01001a02, 0x01001a09, 0x01001a17, 0x05001a28, 0x01001b02, 0x01001b09,
+        0x01001b17, 0x05001b28, 0x01001c02, 0x01001c09, 0x01001c17, 0x05001c28,
+        0x01001d02, 0x01001d09, 0x01001d17, 0x05001d28, 0x01001e02, 0x01001e09,
+        0x01001e17, 0x05001e28, 0x01001f02, 0x01001f09, 0x01001f17, 0x05001f28,
+        0x01007f02, 0x01007f09, 0x01007f17, 0x05007f28, 0x0100dc02, 0x0100dc09,
+        0x0100dc17, 0x0500dc28, 0x0100f902, 0x0100f909, 0x0100f917, 0x0500f928,
+        0x05000a00, 0x05000d00, 0x05001600, 0x08000000
+    },
+    /* 208 */
+    {
+        0x0100d304, 0x0100d305, 0x0100d307, 0x0100d308, 0x0100d30b, 0x0100d30c,
+        0x0100d310, 0x0100d313, 0x0100d319, 0x0100d31c, 0x0100d320, 0x0100d323,
+        0x0100d32a, 0x0100d331, 0x0100d339, 0x0500d340, 0x0100d404, 0x0100d405,
+        0x0100d407, 0x0100d408, 0x0100d40b, 0x0100d40c, 0x0100d410, 0x0100d413,
+        0x0100d419, 0x0100d41c, 0x0100d420, 0x0100d423, 0x0100d42a, 0x0100d431,
+        0x0100d439, 0x0500d440, 0x0100d604, 0x0100d605, 0x0100d607, 0x0100d608,
+        0x0100d60b, 0x0100d60c, 0x0100d610, 0x0100d613, 0x0100d619, 0x0100d61c,
+        0x0100d620, 0x0100d623, 0x0100d62a, 0x0100d631, 0x0100d639, 0x0500d640,
+        0x0100dd04, 0x0100dd05, 0x0100dd07, 0x0100dd08, 0x0100dd0b, 0x0100dd0c,
+        0x0100dd10, 0x0100dd13, 0x0100dd19, 0x0100dd1c, 0x0100dd20, 0x0100dd23,
+        0x0100dd2a, 0x0100dd31, 0x0100dd39, 0x0500dd40, 0x0100de04, 0x0100de05,
+        0x0100de07, 0x0100de08, 0x0100de0b, 0x0100de0c, 0x0100de10, 0x0100de13,
+        0x0100de19, 0x0100de1c, 0x0100de20, 0x0100de23, 0x0100de2a, 0x0100de31,
+        0x0100de39, 0x0500de40, 0x0100df04, 0x0100df05, 0x0100df07, 0x0100df08,
+        0x0100df0b, 0x0100df0c, 0x0100df10, 0x0100df13, 0x0100df19, 0x0100df1c,
+        0x0100df20, 0x0100df23, 0x0100df2a, 0x0100df31, 0x0100df39, 0x0500df40,
+        0x0100f104, 0x0100f105, 0x0100f107, 0x0100f108, 0x0100f10b, 0x0100f10c,
+        0x0100f110, 0x0100f113, 0x0100f119, 0x0100f11c, 0x0100f120, 0x0100f123,
+        0x0100f12a, 0x0100f131, 0x0100f139, 0x0500f140, 0x0100f404, 0x0100f405,
+        0x0100f407, 0x0100f408, 0x0100f40b, 0x0100f40c, 0x0100f410, 0x0100f413,
+        0x0100f419, 0x0100f41c, 0x0100f420, 0x0100f423, 0x0100f42a, 0x0100f431,
+        0x0100f439, 0x0500f440, 0x0100f504, 0x0100f505, 0x0100f507, 0x0100f508,
+        0x0100f50b, 0x0100f50c, 0x0100f510, 0x0100f513, 0x0100f519, 0x0100f51c,
+        0x0100f520, 0x0100f523, 0x0100f52a, 0x0100f531, 0x0100f539, 0x0500f540,
+        0x0100f604, 0x0100f605, 0x0100f607, 0x0100f608, 0x0100f60b, 0x0100f60c,
+        0x0100f610, 0x0100f613, 0x0100f619, 0x0100f61c, 0x0100f620, 0x0100f623,
+        0x0100f62a, 0x0100f631, 0x0100f639, 0x0500f640, 0x0100f704, 0x0100f705,
+        0x0100f707, 0x0100f708, 0x0100f70b, 0x0100f70c, 0x0100f710, 0x0100f713,
+        0x0100f719, 0x0100f71c, 0x0100f720, 0x0100f723, 0x0100f72a, 0x0100f731,
+        0x0100f739, 0x0500f740, 0x0100f804, 0x0100f805, 0x0100f807, 0x0100f808,
+        0x0100f80b, 0x0100f80c, 0x0100f810, 0x0100f813, 0x0100f819, 0x0100f81c,
+        0x0100f820, 0x0100f823, 0x0100f82a, 0x0100f831, 0x0100f839, 0x0500f840,
+        0x0100fa04, 0x0100fa05, 0x0100fa07, 0x0100fa08, 0x0100fa0b, 0x0100fa0c,
+        0x0100fa10, 0x0100fa13, 0x0100fa19, 0x0100fa1c, 0x0100fa20, 0x0100fa23,
+        0x0100fa2a, 0x0100fa31, 0x0100fa39, 0x0500fa40, 0x0100fb04, 0x0100fb05,
+        0x0100fb07, 0x0100fb08, 0x0100fb0b, 0x0100fb0c, 0x0100fb10, 0x0100fb13,
+        0x0100fb19, 0x0100fb1c, 0x0100fb20, 0x0100fb23, 0x0100fb2a, 0x0100fb31,
+        0x0100fb39, 0x0500fb40, 0x0100fc04, 0x0100fc05, 0x0100fc07, 0x0100fc08,
+        0x0100fc0b, 0x0100fc0c, 0x0100fc10, 0x0100fc13, 0x0100fc19, 0x0100fc1c,
+        0x0100fc20, 0x0100fc23, 0x0100fc2a, 0x0100fc31, 0x0100fc39, 0x0500fc40,
+        0x0100fd04, 0x0100fd05, 0x0100fd07, 0x0100fd08, 0x0100fd0b, 0x0100fd0c,
+        0x0100fd10, 0x0100fd13, 0x0100fd19, 0x0100fd1c, 0x0100fd20, 0x0100fd23,
+        0x0100fd2a, 0x0100fd31, 0x0100fd39, 0x0500fd40
+    },
+    /* 209 */
+    {
+        0x0630d300, 0x0631d300, 0x0632d300, 0x0661d300, 0x0663d300, 0x0665d300,
+        0x0669d300, 0x066fd300, 0x0673d300, 0x0674d300, 0x0100d30d, 0x0100d30e,
+        0x0100d311, 0x0100d312, 0x0100d314, 0x0100d315, 0x0100d31a, 0x0100d31b,
+        0x0100d31d, 0x0100d31e, 0x0100d321, 0x0100d322, 0x0100d324, 0x0100d325,
+        0x0100d32b, 0x0100d32e, 0x0100d332, 0x0100d335, 0x0100d33a, 0x0100d33d,
+        0x0100d341, 0x0500d344, 0x0630d400, 0x0631d400, 0x0632d400, 0x0661d400,
+        0x0663d400, 0x0665d400, 0x0669d400, 0x066fd400, 0x0673d400, 0x0674d400,
+        0x0100d40d, 0x0100d40e, 0x0100d411, 0x0100d412, 0x0100d414, 0x0100d415,
+        0x0100d41a, 0x0100d41b, 0x0100d41d, 0x0100d41e, 0x0100d421, 0x0100d422,
+        0x0100d424, 0x0100d425, 0x0100d42b, 0x0100d42e, 0x0100d432, 0x0100d435,
+        0x0100d43a, 0x0100d43d, 0x0100d441, 0x0500d444, 0x0630d600, 0x0631d600,
+        0x0632d600, 0x0661d600, 0x0663d600, 0x0665d600, 0x0669d600, 0x066fd600,
+        0x0673d600, 0x0674d600, 0x0100d60d, 0x0100d60e, 0x0100d611, 0x0100d612,
+        0x0100d614, 0x0100d615, 0x0100d61a, 0x0100d61b, 0x0100d61d, 0x0100d61e,
+        0x0100d621, 0x0100d622, 0x0100d624, 0x0100d625, 0x0100d62b, 0x0100d62e,
+        0x0100d632, 0x0100d635, 0x0100d63a, 0x0100d63d, 0x0100d641, 0x0500d644,
+        0x0630dd00, 0x0631dd00, 0x0632dd00, 0x0661dd00, 0x0663dd00, 0x0665dd00,
+        0x0669dd00, 0x066fdd00, 0x0673dd00, 0x0674dd00, 0x0100dd0d, 0x0100dd0e,
+        0x0100dd11, 0x0100dd12, 0x0100dd14, 0x0100dd15, 0x0100dd1a, 0x0100dd1b,
+        0x0100dd1d, 0x0100dd1e, 0x0100dd21, 0x0100dd22, 0x0100dd24, 0x0100dd25,
+        0x0100dd2b, 0x0100dd2e, 0x0100dd32, 0x0100dd35, 0x0100dd3a, 0x0100dd3d,
+        0x0100dd41, 0x0500dd44, 0x0630de00, 0x0631de00, 0x0632de00, 0x0661de00,
+        0x0663de00, 0x0665de00, 0x0669de00, 0x066fde00, 0x0673de00, 0x0674de00,
+        0x0100de0d, 0x0100de0e, 0x0100de11, 0x0100de12, 0x0100de14, 0x0100de15,
+        0x0100de1a, 0x0100de1b, 0x0100de1d, 0x0100de1e, 0x0100de21, 0x0100de22,
+        0x0100de24, 0x0100de25, 0x0100de2b, 0x0100de2e, 0x0100de32, 0x0100de35,
+        0x0100de3a, 0x0100de3d, 0x0100de41, 0x0500de44, 0x0630df00, 0x0631df00,
+        0x0632df00, 0x0661df00, 0x0663df00, 0x0665df00, 0x0669df00, 0x066fdf00,
+        0x0673df00, 0x0674df00, 0x0100df0d, 0x0100df0e, 0x0100df11, 0x0100df12,
+        0x0100df14, 0x0100df15, 0x0100df1a, 0x0100df1b, 0x0100df1d, 0x0100df1e,
+        0x0100df21, 0x0100df22, 0x0100df24, 0x0100df25, 0x0100df2b, 0x0100df2e,
+        0x0100df32, 0x0100df35, 0x0100df3a, 0x0100df3d, 0x0100df41, 0x0500df44,
+        0x0630f100, 0x0631f100, 0x0632f100, 0x0661f100, 0x0663f100, 0x0665f100,
+        0x0669f100, 0x066ff100, 0x0673f100, 0x0674f100, 0x0100f10d, 0x0100f10e,
+        0x0100f111, 0x0100f112, 0x0100f114, 0x0100f115, 0x0100f11a, 0x0100f11b,
+        0x0100f11d, 0x0100f11e, 0x0100f121, 0x0100f122, 0x0100f124, 0x0100f125,
+        0x0100f12b, 0x0100f12e, 0x0100f132, 0x0100f135, 0x0100f13a, 0x0100f13d,
+        0x0100f141, 0x0500f144, 0x0630f400, 0x0631f400, 0x0632f400, 0x0661f400,
+        0x0663f400, 0x0665f400, 0x0669f400, 0x066ff400, 0x0673f400, 0x0674f400,
+        0x0100f40d, 0x0100f40e, 0x0100f411, 0x0100f412, 0x0100f414, 0x0100f415,
+        0x0100f41a, 0x0100f41b, 0x0100f41d, 0x0100f41e, 0x0100f421, 0x0100f422,
+        0x0100f424, 0x0100f425, 0x0100f42b, 0x0100f42e, 0x0100f432, 0x0100f435,
+        0x0100f43a, 0x0100f43d, 0x0100f441, 0x0500f444
+    },
+    /* 210 */
+    {
+        0x0230d301, 0x0630d316, 0x0231d301, 0x0631d316, 0x0232d301, 0x0632d316,
+        0x0261d301, 0x0661d316, 0x0263d301, 0x0663d316, 0x0265d301, 0x0665d316,
+        0x0269d301, 0x0669d316, 0x026fd301, 0x066fd316, 0x0273d301, 0x0673d316,
+        0x0274d301, 0x0674d316, 0x0620d300, 0x0625d300, 0x062dd300, 0x062ed300,
+        0x062fd300, 0x0633d300, 0x0634d300, 0x0635d300, 0x0636d300, 0x0637d300,
+        0x0638d300, 0x0639d300, 0x063dd300, 0x0641d300, 0x065fd300, 0x0662d300,
+        0x0664d300, 0x0666d300, 0x0667d300, 0x0668d300, 0x066cd300, 0x066dd300,
+        0x066ed300, 0x0670d300, 0x0672d300, 0x0675d300, 0x0100d326, 0x0100d327,
+        0x0100d32c, 0x0100d32d, 0x0100d32f, 0x0100d330, 0x0100d333, 0x0100d334,
+        0x0100d336, 0x0100d337, 0x0100d33b, 0x0100d33c, 0x0100d33e, 0x0100d33f,
+        0x0100d342, 0x0100d343, 0x0100d345, 0x0500d348, 0x0230d401, 0x0630d416,
+        0x0231d401, 0x0631d416, 0x0232d401, 0x0632d416, 0x0261d401, 0x0661d416,
+        0x0263d401, 0x0663d416, 0x0265d401, 0x0665d416, 0x0269d401, 0x0669d416,
+        0x026fd401, 0x066fd416, 0x0273d401, 0x0673d416, 0x0274d401, 0x0674d416,
+        0x0620d400, 0x0625d400, 0x062dd400, 0x062ed400, 0x062fd400, 0x0633d400,
+        0x0634d400, 0x0635d400, 0x0636d400, 0x0637d400, 0x0638d400, 0x0639d400,
+        0x063dd400, 0x0641d400, 0x065fd400, 0x0662d400, 0x0664d400, 0x0666d400,
+        0x0667d400, 0x0668d400, 0x066cd400, 0x066dd400, 0x066ed400, 0x0670d400,
+        0x0672d400, 0x0675d400, 0x0100d426, 0x0100d427, 0x0100d42c, 0x0100d42d,
+        0x0100d42f, 0x0100d430, 0x0100d433, 0x0100d434, 0x0100d436, 0x0100d437,
+        0x0100d43b, 0x0100d43c, 0x0100d43e, 0x0100d43f, 0x0100d442, 0x0100d443,
+        0x0100d445, 0x0500d448, 0x0230d601, 0x0630d616, 0x0231d601, 0x0631d616,
+        0x0232d601, 0x0632d616, 0x0261d601, 0x0661d616, 0x0263d601, 0x0663d616,
+        0x0265d601, 0x0665d616, 0x0269d601, 0x0669d616, 0x026fd601, 0x066fd616,
+        0x0273d601, 0x0673d616, 0x0274d601, 0x0674d616, 0x0620d600, 0x0625d600,
+        0x062dd600, 0x062ed600, 0x062fd600, 0x0633d600, 0x0634d600, 0x0635d600,
+        0x0636d600, 0x0637d600, 0x0638d600, 0x0639d600, 0x063dd600, 0x0641d600,
+        0x065fd600, 0x0662d600, 0x0664d600, 0x0666d600, 0x0667d600, 0x0668d600,
+        0x066cd600, 0x066dd600, 0x066ed600, 0x0670d600, 0x0672d600, 0x0675d600,
+        0x0100d626, 0x0100d627, 0x0100d62c, 0x0100d62d, 0x0100d62f, 0x0100d630,
+        0x0100d633, 0x0100d634, 0x0100d636, 0x0100d637, 0x0100d63b, 0x0100d63c,
+        0x0100d63e, 0x0100d63f, 0x0100d642, 0x0100d643, 0x0100d645, 0x0500d648,
+        0x0230dd01, 0x0630dd16, 0x0231dd01, 0x0631dd16, 0x0232dd01, 0x0632dd16,
+        0x0261dd01, 0x0661dd16, 0x0263dd01, 0x0663dd16, 0x0265dd01, 0x0665dd16,
+        0x0269dd01, 0x0669dd16, 0x026fdd01, 0x066fdd16, 0x0273dd01, 0x0673dd16,
+        0x0274dd01, 0x0674dd16, 0x0620dd00, 0x0625dd00, 0x062ddd00, 0x062edd00,
+        0x062fdd00, 0x0633dd00, 0x0634dd00, 0x0635dd00, 0x0636dd00, 0x0637dd00,
+        0x0638dd00, 0x0639dd00, 0x063ddd00, 0x0641dd00, 0x065fdd00, 0x0662dd00,
+        0x0664dd00, 0x0666dd00, 0x0667dd00, 0x0668dd00, 0x066cdd00, 0x066ddd00,
+        0x066edd00, 0x0670dd00, 0x0672dd00, 0x0675dd00, 0x0100dd26, 0x0100dd27,
+        0x0100dd2c, 0x0100dd2d, 0x0100dd2f, 0x0100dd30, 0x0100dd33, 0x0100dd34,
+        0x0100dd36, 0x0100dd37, 0x0100dd3b, 0x0100dd3c, 0x0100dd3e, 0x0100dd3f,
+        0x0100dd42, 0x0100dd43, 0x0100dd45, 0x0500dd48
+    },
+    /* 211 */
+    {
+        0x0230d302, 0x0230d309, 0x0230d317, 0x0630d328, 0x0231d302, 0x0231d309,
+        0x0231d317, 0x0631d328, 0x0232d302, 0x0232d309, 0x0232d317, 0x0632d328,
+        0x0261d302, 0x0261d309, 0x0261d317, 0x0661d328, 0x0263d302, 0x0263d309,
+        0x0263d317, 0x0663d328, 0x0265d302, 0x0265d309, 0x0265d317, 0x0665d328,
+        0x0269d302, 0x0269d309, 0x0269d317, 0x0669d328, 0x026fd302, 0x026fd309,
+        0x026fd317, 0x066fd328, 0x0273d302, 0x0273d309, 0x0273d317, 0x0673d328,
+        0x0274d302, 0x0274d309, 0x0274d317, 0x0674d328, 0x0220d301, 0x0620d316,
+        0x0225d301, 0x0625d316, 0x022dd301, 0x062dd316, 0x022ed301, 0x062ed316,
+        0x022fd301, 0x062fd316, 0x0233d301, 0x0633d316, 0x0234d301, 0x0634d316,
+        0x0235d301, 0x0635d316, 0x0236d301, 0x0636d316, 0x0237d301, 0x0637d316,
+        0x0238d301, 0x0638d316, 0x0239d301, 0x0639d316, 0x023dd301, 0x063dd316,
+        0x0241d301, 0x0641d316, 0x025fd301, 0x065fd316, 0x0262d301, 0x0662d316,
+        0x0264d301, 0x0664d316, 0x0266d301, 0x0666d316, 0x0267d301, 0x0667d316,
+        0x0268d301, 0x0668d316, 0x026cd301, 0x066cd316, 0x026dd301, 0x066dd316,
+        0x026ed301, 0x066ed316, 0x0270d301, 0x0670d316, 0x0272d301, 0x0672d316,
+        0x0275d301, 0x0675d316, 0x063ad300, 0x0642d300, 0x0643d300, 0x0644d300,
+        0x0645d300, 0x0646d300, 0x0647d300, 0x0648d300, 0x0649d300, 0x064ad300,
+        0x064bd300, 0x064cd300, 0x064dd300, 0x064ed300, 0x064fd300, 0x0650d300,
+        0x0651d300, 0x0652d300, 0x0653d300, 0x0654d300, 0x0655d300, 0x0656d300,
+        0x0657d300, 0x0659d300, 0x066ad300, 0x066bd300, 0x0671d300, 0x0676d300,
+        0x0677d300, 0x0678d300, 0x0679d300, 0x067ad300, 0x0100d346, 0x0100d347,
+        0x0100d349, 0x0500d34a, 0x0230d402, 0x0230d409, 0x0230d417, 0x0630d428,
+        0x0231d402, 0x0231d409, 0x0231d417, 0x0631d428, 0x0232d402, 0x0232d409,
+        0x0232d417, 0x0632d428, 0x0261d402, 0x0261d409, 0x0261d417, 0x0661d428,
+        0x0263d402, 0x0263d409, 0x0263d417, 0x0663d428, 0x0265d402, 0x0265d409,
+        0x0265d417, 0x0665d428, 0x0269d402, 0x0269d409, 0x0269d417, 0x0669d428,
+        0x026fd402, 0x026fd409, 0x026fd417, 0x066fd428, 0x0273d402, 0x0273d409,
+        0x0273d417, 0x0673d428, 0x0274d402, 0x0274d409, 0x0274d417, 0x0674d428,
+        0x0220d401, 0x0620d416, 0x0225d401, 0x0625d416, 0x022dd401, 0x062dd416,
+        0x022ed401, 0x062ed416, 0x022fd401, 0x062fd416, 0x0233d401, 0x0633d416,
+        0x0234d401, 0x0634d416, 0x0235d401, 0x0635d416, 0x0236d401, 0x0636d416,
+        0x0237d401, 0x0637d416, 0x0238d401, 0x0638d416, 0x0239d401, 0x0639d416,
+        0x023dd401, 0x063dd416, 0x0241d401, 0x0641d416, 0x025fd401, 0x065fd416,
+        0x0262d401, 0x0662d416, 0x0264d401, 0x0664d416, 0x0266d401, 0x0666d416,
+        0x0267d401, 0x0667d416, 0x0268d401, 0x0668d416, 0x026cd401, 0x066cd416,
+        0x026dd401, 0x066dd416, 0x026ed401, 0x066ed416, 0x0270d401, 0x0670d416,
+        0x0272d401, 0x0672d416, 0x0275d401, 0x0675d416, 0x063ad400, 0x0642d400,
+        0x0643d400, 0x0644d400, 0x0645d400, 0x0646d400, 0x0647d400, 0x0648d400,
+        0x0649d400, 0x064ad400, 0x064bd400, 0x064cd400, 0x064dd400, 0x064ed400,
+        0x064fd400, 0x0650d400, 0x0651d400, 0x0652d400, 0x0653d400, 0x0654d400,
+        0x0655d400, 0x0656d400, 0x0657d400, 0x0659d400, 0x066ad400, 0x066bd400,
+        0x0671d400, 0x0676d400, 0x0677d400, 0x0678d400, 0x0679d400, 0x067ad400,
+        0x0100d446, 0x0100d447, 0x0100d449, 0x0500d44a
+    },
+    /* 212 */
+    {
+        0x0230d602, 0x0230d609, 0x0230d617, 0x0630d628, 0x0231d602, 0x0231d609,
+        0x0231d617, 0x0631d628, 0x0232d602, 0x0232d609, 0x0232d617, 0x0632d628,
+        0x0261d602, 0x0261d609, 0x0261d617, 0x0661d628, 0x0263d602, 0x0263d609,
+        0x0263d617, 0x0663d628, 0x0265d602, 0x0265d609, 0x0265d617, 0x0665d628,
+        0x0269d602, 0x0269d609, 0x0269d617, 0x0669d628, 0x026fd602, 0x026fd609,
+        0x026fd617, 0x066fd628, 0x0273d602, 0x0273d609, 0x0273d617, 0x0673d628,
+        0x0274d602, 0x0274d609, 0x0274d617, 0x0674d628, 0x0220d601, 0x0620d616,
+        0x0225d601, 0x0625d616, 0x022dd601, 0x062dd616, 0x022ed601, 0x062ed616,
+        0x022fd601, 0x062fd616, 0x0233d601, 0x0633d616, 0x0234d601, 0x0634d616,
+        0x0235d601, 0x0635d616, 0x0236d601, 0x0636d616, 0x0237d601, 0x0637d616,
+        0x0238d601, 0x0638d616, 0x0239d601, 0x0639d616, 0x023dd601, 0x063dd616,
+        0x0241d601, 0x0641d616, 0x025fd601, 0x065fd616, 0x0262d601, 0x0662d616,
+        0x0264d601, 0x0664d616, 0x0266d601, 0x0666d616, 0x0267d601, 0x0667d616,
+        0x0268d601, 0x0668d616, 0x026cd601, 0x066cd616, 0x026dd601, 0x066dd616,
+        0x026ed601, 0x066ed616, 0x0270d601, 0x0670d616, 0x0272d601, 0x0672d616,
+        0x0275d601, 0x0675d616, 0x063ad600, 0x0642d600, 0x0643d600, 0x0644d600,
+        0x0645d600, 0x0646d600, 0x0647d600, 0x0648d600, 0x0649d600, 0x064ad600,
+        0x064bd600, 0x064cd600, 0x064dd600, 0x064ed600, 0x064fd600, 0x0650d600,
+        0x0651d600, 0x0652d600, 0x0653d600, 0x0654d600, 0x0655d600, 0x0656d600,
+        0x0657d600, 0x0659d600, 0x066ad600, 0x066bd600, 0x0671d600, 0x0676d600,
+        0x0677d600, 0x0678d600, 0x0679d600, 0x067ad600, 0x0100d646, 0x0100d647,
+        0x0100d649, 0x0500d64a, 0x0230dd02, 0x0230dd09, 0x0230dd17, 0x0630dd28,
+        0x0231dd02, 0x0231dd09, 0x0231dd17, 0x0631dd28, 0x0232dd02, 0x0232dd09,
+        0x0232dd17, 0x0632dd28, 0x0261dd02, 0x0261dd09, 0x0261dd17, 0x0661dd28,
+        0x0263dd02, 0x0263dd09, 0x0263dd17, 0x0663dd28, 0x0265dd02, 0x0265dd09,
+        0x0265dd17, 0x0665dd28, 0x0269dd02, 0x0269dd09, 0x0269dd17, 0x0669dd28,
+        0x026fdd02, 0x026fdd09, 0x026fdd17, 0x066fdd28, 0x0273dd02, 0x0273dd09,
+        0x0273dd17, 0x0673dd28, 0x0274dd02, 0x0274dd09, 0x0274dd17, 0x0674dd28,
+        0x0220dd01, 0x0620dd16, 0x0225dd01, 0x0625dd16, 0x022ddd01, 0x062ddd16,
+        0x022edd01, 0x062edd16, 0x022fdd01, 0x062fdd16, 0x0233dd01, 0x0633dd16,
+        0x0234dd01, 0x0634dd16, 0x0235dd01, 0x0635dd16, 0x0236dd01, 0x0636dd16,
+        0x0237dd01, 0x0637dd16, 0x0238dd01, 0x0638dd16, 0x0239dd01, 0x0639dd16,
+        0x023ddd01, 0x063ddd16, 0x0241dd01, 0x0641dd16, 0x025fdd01, 0x065fdd16,
+        0x0262dd01, 0x0662dd16, 0x0264dd01, 0x0664dd16, 0x0266dd01, 0x0666dd16,
+        0x0267dd01, 0x0667dd16, 0x0268dd01, 0x0668dd16, 0x026cdd01, 0x066cdd16,
+        0x026ddd01, 0x066ddd16, 0x026edd01, 0x066edd16, 0x0270dd01, 0x0670dd16,
+        0x0272dd01, 0x0672dd16, 0x0275dd01, 0x0675dd16, 0x063add00, 0x0642dd00,
+        0x0643dd00, 0x0644dd00, 0x0645dd00, 0x0646dd00, 0x0647dd00, 0x0648dd00,
+        0x0649dd00, 0x064add00, 0x064bdd00, 0x064cdd00, 0x064ddd00, 0x064edd00,
+        0x064fdd00, 0x0650dd00, 0x0651dd00, 0x0652dd00, 0x0653dd00, 0x0654dd00,
+        0x0655dd00, 0x0656dd00, 0x0657dd00, 0x0659dd00, 0x066add00, 0x066bdd00,
+        0x0671dd00, 0x0676dd00, 0x0677dd00, 0x0678dd00, 0x0679dd00, 0x067add00,
+        0x0100dd46, 0x0100dd47, 0x0100dd49, 0x0500dd4a
+    },
+    /* 213 */
+    {
+        0x0230de01, 0x0630de16, 0x0231de01, 0x0631de16, 0x0232de01, 0x0632de16,
+        0x0261de01, 0x0661de16, 0x0263de01, 0x0663de16, 0x0265de01, 0x0665de16,
+        0x0269de01, 0x0669de16, 0x026fde01, 0x066fde16, 0x0273de01, 0x0673de16,
+        0x0274de01, 0x0674de16, 0x0620de00, 0x0625de00, 0x062dde00, 0x062ede00,
+        0x062fde00, 0x0633de00, 0x0634de00, 0x0635de00, 0x0636de00, 0x0637de00,
+        0x0638de00, 0x0639de00, 0x063dde00, 0x0641de00, 0x065fde00, 0x0662de00,
+        0x0664de00, 0x0666de00, 0x0667de00, 0x0668de00, 0x066cde00, 0x066dde00,
+        0x066ede00, 0x0670de00, 0x0672de00, 0x0675de00, 0x0100de26, 0x0100de27,
+        0x0100de2c, 0x0100de2d, 0x0100de2f, 0x0100de30, 0x0100de33, 0x0100de34,
+        0x0100de36, 0x0100de37, 0x0100de3b, 0x0100de3c, 0x0100de3e, 0x0100de3f,
+        0x0100de42, 0x0100de43, 0x0100de45, 0x0500de48, 0x0230df01, 0x0630df16,
+        0x0231df01, 0x0631df16, 0x0232df01, 0x0632df16, 0x0261df01, 0x0661df16,
+        0x0263df01, 0x0663df16, 0x0265df01, 0x0665df16, 0x0269df01, 0x0669df16,
+        0x026fdf01, 0x066fdf16, 0x0273df01, 0x0673df16, 0x0274df01, 0x0674df16,
+        0x0620df00, 0x0625df00, 0x062ddf00, 0x062edf00, 0x062fdf00, 0x0633df00,
+        0x0634df00, 0x0635df00, 0x0636df00, 0x0637df00, 0x0638df00, 0x0639df00,
+        0x063ddf00, 0x0641df00, 0x065fdf00, 0x0662df00, 0x0664df00, 0x0666df00,
+        0x0667df00, 0x0668df00, 0x066cdf00, 0x066ddf00, 0x066edf00, 0x0670df00,
+        0x0672df00, 0x0675df00, 0x0100df26, 0x0100df27, 0x0100df2c, 0x0100df2d,
+        0x0100df2f, 0x0100df30, 0x0100df33, 0x0100df34, 0x0100df36, 0x0100df37,
+        0x0100df3b, 0x0100df3c, 0x0100df3e, 0x0100df3f, 0x0100df42, 0x0100df43,
+        0x0100df45, 0x0500df48, 0x0230f101, 0x0630f116, 0x0231f101, 0x0631f116,
+        0x0232f101, 0x0632f116, 0x0261f101, 0x0661f116, 0x0263f101, 0x0663f116,
+        0x0265f101, 0x0665f116, 0x0269f101, 0x0669f116, 0x026ff101, 0x066ff116,
+        0x0273f101, 0x0673f116, 0x0274f101, 0x0674f116, 0x0620f100, 0x0625f100,
+        0x062df100, 0x062ef100, 0x062ff100, 0x0633f100, 0x0634f100, 0x0635f100,
+        0x0636f100, 0x0637f100, 0x0638f100, 0x0639f100, 0x063df100, 0x0641f100,
+        0x065ff100, 0x0662f100, 0x0664f100, 0x0666f100, 0x0667f100, 0x0668f100,
+        0x066cf100, 0x066df100, 0x066ef100, 0x0670f100, 0x0672f100, 0x0675f100,
+        0x0100f126, 0x0100f127, 0x0100f12c, 0x0100f12d, 0x0100f12f, 0x0100f130,
+        0x0100f133, 0x0100f134, 0x0100f136, 0x0100f137, 0x0100f13b, 0x0100f13c,
+        0x0100f13e, 0x0100f13f, 0x0100f142, 0x0100f143, 0x0100f145, 0x0500f148,
+        0x0230f401, 0x0630f416, 0x0231f401, 0x0631f416, 0x0232f401, 0x0632f416,
+        0x0261f401, 0x0661f416, 0x0263f401, 0x0663f416, 0x0265f401, 0x0665f416,
+        0x0269f401, 0x0669f416, 0x026ff401, 0x066ff416, 0x0273f401, 0x0673f416,
+        0x0274f401, 0x0674f416, 0x0620f400, 0x0625f400, 0x062df400, 0x062ef400,
+        0x062ff400, 0x0633f400, 0x0634f400, 0x0635f400, 0x0636f400, 0x0637f400,
+        0x0638f400, 0x0639f400, 0x063df400, 0x0641f400, 0x065ff400, 0x0662f400,
+        0x0664f400, 0x0666f400, 0x0667f400, 0x0668f400, 0x066cf400, 0x066df400,
+        0x066ef400, 0x0670f400, 0x0672f400, 0x0675f400, 0x0100f426, 0x0100f427,
+        0x0100f42c, 0x0100f42d, 0x0100f42f, 0x0100f430, 0x0100f433, 0x0100f434,
+        0x0100f436, 0x0100f437, 0x0100f43b, 0x0100f43c, 0x0100f43e, 0x0100f43f,
+        0x0100f442, 0x0100f443, 0x0100f445, 0x0500f448
+    },
+    /* 214 */
+    {
+        0x0230de02, 0x0230de09, 0x0230de17, 0x0630de28, 0x0231de02, 0x0231de09,
+        0x0231de17, 0x0631de28, 0x0232de02, 0x0232de09, 0x0232de17, 0x0632de28,
+        0x0261de02, 0x0261de09, 0x0261de17, 0x0661de28, 0x0263de02, 0x0263de09,
+        0x0263de17, 0x0663de28, 0x0265de02, 0x0265de09, 0x0265de17, 0x0665de28,
+        0x0269de02, 0x0269de09, 0x0269de17, 0x0669de28, 0x026fde02, 0x026fde09,
+        0x026fde17, 0x066fde28, 0x0273de02, 0x0273de09, 0x0273de17, 0x0673de28,
+        0x0274de02, 0x0274de09, 0x0274de17, 0x0674de28, 0x0220de01, 0x0620de16,
+        0x0225de01, 0x0625de16, 0x022dde01, 0x062dde16, 0x022ede01, 0x062ede16,
+        0x022fde01, 0x062fde16, 0x0233de01, 0x0633de16, 0x0234de01, 0x0634de16,
+        0x0235de01, 0x0635de16, 0x0236de01, 0x0636de16, 0x0237de01, 0x0637de16,
+        0x0238de01, 0x0638de16, 0x0239de01, 0x0639de16, 0x023dde01, 0x063dde16,
+        0x0241de01, 0x0641de16, 0x025fde01, 0x065fde16, 0x0262de01, 0x0662de16,
+        0x0264de01, 0x0664de16, 0x0266de01, 0x0666de16, 0x0267de01, 0x0667de16,
+        0x0268de01, 0x0668de16, 0x026cde01, 0x066cde16, 0x026dde01, 0x066dde16,
+        0x026ede01, 0x066ede16, 0x0270de01, 0x0670de16, 0x0272de01, 0x0672de16,
+        0x0275de01, 0x0675de16, 0x063ade00, 0x0642de00, 0x0643de00, 0x0644de00,
+        0x0645de00, 0x0646de00, 0x0647de00, 0x0648de00, 0x0649de00, 0x064ade00,
+        0x064bde00, 0x064cde00, 0x064dde00, 0x064ede00, 0x064fde00, 0x0650de00,
+        0x0651de00, 0x0652de00, 0x0653de00, 0x0654de00, 0x0655de00, 0x0656de00,
+        0x0657de00, 0x0659de00, 0x066ade00, 0x066bde00, 0x0671de00, 0x0676de00,
+        0x0677de00, 0x0678de00, 0x0679de00, 0x067ade00, 0x0100de46, 0x0100de47,
+        0x0100de49, 0x0500de4a, 0x0230df02, 0x0230df09, 0x0230df17, 0x0630df28,
+        0x0231df02, 0x0231df09, 0x0231df17, 0x0631df28, 0x0232df02, 0x0232df09,
+        0x0232df17, 0x0632df28, 0x0261df02, 0x0261df09, 0x0261df17, 0x0661df28,
+        0x0263df02, 0x0263df09, 0x0263df17, 0x0663df28, 0x0265df02, 0x0265df09,
+        0x0265df17, 0x0665df28, 0x0269df02, 0x0269df09, 0x0269df17, 0x0669df28,
+        0x026fdf02, 0x026fdf09, 0x026fdf17, 0x066fdf28, 0x0273df02, 0x0273df09,
+        0x0273df17, 0x0673df28, 0x0274df02, 0x0274df09, 0x0274df17, 0x0674df28,
+        0x0220df01, 0x0620df16, 0x0225df01, 0x0625df16, 0x022ddf01, 0x062ddf16,
+        0x022edf01, 0x062edf16, 0x022fdf01, 0x062fdf16, 0x0233df01, 0x0633df16,
+        0x0234df01, 0x0634df16, 0x0235df01, 0x0635df16, 0x0236df01, 0x0636df16,
+        0x0237df01, 0x0637df16, 0x0238df01, 0x0638df16, 0x0239df01, 0x0639df16,
+        0x023ddf01, 0x063ddf16, 0x0241df01, 0x0641df16, 0x025fdf01, 0x065fdf16,
+        0x0262df01, 0x0662df16, 0x0264df01, 0x0664df16, 0x0266df01, 0x0666df16,
+        0x0267df01, 0x0667df16, 0x0268df01, 0x0668df16, 0x026cdf01, 0x066cdf16,
+        0x026ddf01, 0x066ddf16, 0x026edf01, 0x066edf16, 0x0270df01, 0x0670df16,
+        0x0272df01, 0x0672df16, 0x0275df01, 0x0675df16, 0x063adf00, 0x0642df00,
+        0x0643df00, 0x0644df00, 0x0645df00, 0x0646df00, 0x0647df00, 0x0648df00,
+        0x0649df00, 0x064adf00, 0x064bdf00, 0x064cdf00, 0x064ddf00, 0x064edf00,
+        0x064fdf00, 0x0650df00, 0x0651df00, 0x0652df00, 0x0653df00, 0x0654df00,
+        0x0655df00, 0x0656df00, 0x0657df00, 0x0659df00, 0x066adf00, 0x066bdf00,
+        0x0671df00, 0x0676df00, 0x0677df00, 0x0678df00, 0x0679df00, 0x067adf00,
+        0x0100df46, 0x0100df47, 0x0100df49, 0x0500df4a
+    },
+    /* 215 */
+    {
+        0x0230f102, 0x0230f109, 0x0230f117, 0x0630f128, 0x0231f102, 0x0231f109,
+        0x0231f117, 0x0631f128, 0x0232f102, 0x0232f109, 0x0232f117, 0x0632f128,
+        0x0261f102, 0x0261f109, 0x0261f117, 0x0661f128, 0x0263f102, 0x0263f109,
+        0x0263f117, 0x0663f128, 0x0265f102, 0x0265f109, 0x0265f117, 0x0665f128,
+        0x0269f102, 0x0269f109, 0x0269f117, 0x0669f128, 0x026ff102, 0x026ff109,
+        0x026ff117, 0x066ff128, 0x0273f102, 0x0273f109, 0x0273f117, 0x0673f128,
+        0x0274f102, 0x0274f109, 0x0274f117, 0x0674f128, 0x0220f101, 0x0620f116,
+        0x0225f101, 0x0625f116, 0x022df101, 0x062df116, 0x022ef101, 0x062ef116,
+        0x022ff101, 0x062ff116, 0x0233f101, 0x0633f116, 0x0234f101, 0x0634f116,
+        0x0235f101, 0x0635f116, 0x0236f101, 0x0636f116, 0x0237f101, 0x0637f116,
+        0x0238f101, 0x0638f116, 0x0239f101, 0x0639f116, 0x023df101, 0x063df116,
+        0x0241f101, 0x0641f116, 0x025ff101, 0x065ff116, 0x0262f101, 0x0662f116,
+        0x0264f101, 0x0664f116, 0x0266f101, 0x0666f116, 0x0267f101, 0x0667f116,
+        0x0268f101, 0x0668f116, 0x026cf101, 0x066cf116, 0x026df101, 0x066df116,
+        0x026ef101, 0x066ef116, 0x0270f101, 0x0670f116, 0x0272f101, 0x0672f116,
+        0x0275f101, 0x0675f116, 0x063af100, 0x0642f100, 0x0643f100, 0x0644f100,
+        0x0645f100, 0x0646f100, 0x0647f100, 0x0648f100, 0x0649f100, 0x064af100,
+        0x064bf100, 0x064cf100, 0x064df100, 0x064ef100, 0x064ff100, 0x0650f100,
+        0x0651f100, 0x0652f100, 0x0653f100, 0x0654f100, 0x0655f100, 0x0656f100,
+        0x0657f100, 0x0659f100, 0x066af100, 0x066bf100, 0x0671f100, 0x0676f100,
+        0x0677f100, 0x0678f100, 0x0679f100, 0x067af100, 0x0100f146, 0x0100f147,
+        0x0100f149, 0x0500f14a, 0x0230f402, 0x0230f409, 0x0230f417, 0x0630f428,
+        0x0231f402, 0x0231f409, 0x0231f417, 0x0631f428, 0x0232f402, 0x0232f409,
+        0x0232f417, 0x0632f428, 0x0261f402, 0x0261f409, 0x0261f417, 0x0661f428,
+        0x0263f402, 0x0263f409, 0x0263f417, 0x0663f428, 0x0265f402, 0x0265f409,
+        0x0265f417, 0x0665f428, 0x0269f402, 0x0269f409, 0x0269f417, 0x0669f428,
+        0x026ff402, 0x026ff409, 0x026ff417, 0x066ff428, 0x0273f402, 0x0273f409,
+        0x0273f417, 0x0673f428, 0x0274f402, 0x0274f409, 0x0274f417, 0x0674f428,
+        0x0220f401, 0x0620f416, 0x0225f401, 0x0625f416, 0x022df401, 0x062df416,
+        0x022ef401, 0x062ef416, 0x022ff401, 0x062ff416, 0x0233f401, 0x0633f416,
+        0x0234f401, 0x0634f416, 0x0235f401, 0x0635f416, 0x0236f401, 0x0636f416,
+        0x0237f401, 0x0637f416, 0x0238f401, 0x0638f416, 0x0239f401, 0x0639f416,
+        0x023df401, 0x063df416, 0x0241f401, 0x0641f416, 0x025ff401, 0x065ff416,
+        0x0262f401, 0x0662f416, 0x0264f401, 0x0664f416, 0x0266f401, 0x0666f416,
+        0x0267f401, 0x0667f416, 0x0268f401, 0x0668f416, 0x026cf401, 0x066cf416,
+        0x026df401, 0x066df416, 0x026ef401, 0x066ef416, 0x0270f401, 0x0670f416,
+        0x0272f401, 0x0672f416, 0x0275f401, 0x0675f416, 0x063af400, 0x0642f400,
+        0x0643f400, 0x0644f400, 0x0645f400, 0x0646f400, 0x0647f400, 0x0648f400,
+        0x0649f400, 0x064af400, 0x064bf400, 0x064cf400, 0x064df400, 0x064ef400,
+        0x064ff400, 0x0650f400, 0x0651f400, 0x0652f400, 0x0653f400, 0x0654f400,
+        0x0655f400, 0x0656f400, 0x0657f400, 0x0659f400, 0x066af400, 0x066bf400,
+        0x0671f400, 0x0676f400, 0x0677f400, 0x0678f400, 0x0679f400, 0x067af400,
+        0x0100f446, 0x0100f447, 0x0100f449, 0x0500f44a
+    },
+    /* 216 */
+    {
+        0x0630f500, 0x0631f500, 0x0632f500, 0x0661f500, 0x0663f500, 0x0665f500,
+        0x0669f500, 0x066ff500, 0x0673f500, 0x0674f500, 0x0100f50d, 0x0100f50e,
+        0x0100f511, 0x0100f512, 0x0100f514, 0x0100f515, 0x0100f51a, 0x0100f51b,
+        0x0100f51d, 0x0100f51e, 0x0100f521, 0x0100f522, 0x0100f524, 0x0100f525,
+        0x0100f52b, 0x0100f52e, 0x0100f532, 0x0100f535, 0x0100f53a, 0x0100f53d,
+        0x0100f541, 0x0500f544, 0x0630f600, 0x0631f600, 0x0632f600, 0x0661f600,
+        0x0663f600, 0x0665f600, 0x0669f600, 0x066ff600, 0x0673f600, 0x0674f600,
+        0x0100f60d, 0x0100f60e, 0x0100f611, 0x0100f612, 0x0100f614, 0x0100f615,
+        0x0100f61a, 0x0100f61b, 0x0100f61d, 0x0100f61e, 0x0100f621, 0x0100f622,
+        0x0100f624, 0x0100f625, 0x0100f62b, 0x0100f62e, 0x0100f632, 0x0100f635,
+        0x0100f63a, 0x0100f63d, 0x0100f641, 0x0500f644, 0x0630f700, 0x0631f700,
+        0x0632f700, 0x0661f700, 0x0663f700, 0x0665f700, 0x0669f700, 0x066ff700,
+        0x0673f700, 0x0674f700, 0x0100f70d, 0x0100f70e, 0x0100f711, 0x0100f712,
+        0x0100f714, 0x0100f715, 0x0100f71a, 0x0100f71b, 0x0100f71d, 0x0100f71e,
+        0x0100f721, 0x0100f722, 0x0100f724, 0x0100f725, 0x0100f72b, 0x0100f72e,
+        0x0100f732, 0x0100f735, 0x0100f73a, 0x0100f73d, 0x0100f741, 0x0500f744,
+        0x0630f800, 0x0631f800, 0x0632f800, 0x0661f800, 0x0663f800, 0x0665f800,
+        0x0669f800, 0x066ff800, 0x0673f800, 0x0674f800, 0x0100f80d, 0x0100f80e,
+        0x0100f811, 0x0100f812, 0x0100f814, 0x0100f815, 0x0100f81a, 0x0100f81b,
+        0x0100f81d, 0x0100f81e, 0x0100f821, 0x0100f822, 0x0100f824, 0x0100f825,
+        0x0100f82b, 0x0100f82e, 0x0100f832, 0x0100f835, 0x0100f83a, 0x0100f83d,
+        0x0100f841, 0x0500f844, 0x0630fa00, 0x0631fa00, 0x0632fa00, 0x0661fa00,
+        0x0663fa00, 0x0665fa00, 0x0669fa00, 0x066ffa00, 0x0673fa00, 0x0674fa00,
+        0x0100fa0d, 0x0100fa0e, 0x0100fa11, 0x0100fa12, 0x0100fa14, 0x0100fa15,
+        0x0100fa1a, 0x0100fa1b, 0x0100fa1d, 0x0100fa1e, 0x0100fa21, 0x0100fa22,
+        0x0100fa24, 0x0100fa25, 0x0100fa2b, 0x0100fa2e, 0x0100fa32, 0x0100fa35,
+        0x0100fa3a, 0x0100fa3d, 0x0100fa41, 0x0500fa44, 0x0630fb00, 0x0631fb00,
+        0x0632fb00, 0x0661fb00, 0x0663fb00, 0x0665fb00, 0x0669fb00, 0x066ffb00,
+        0x0673fb00, 0x0674fb00, 0x0100fb0d, 0x0100fb0e, 0x0100fb11, 0x0100fb12,
+        0x0100fb14, 0x0100fb15, 0x0100fb1a, 0x0100fb1b, 0x0100fb1d, 0x0100fb1e,
+        0x0100fb21, 0x0100fb22, 0x0100fb24, 0x0100fb25, 0x0100fb2b, 0x0100fb2e,
+        0x0100fb32, 0x0100fb35, 0x0100fb3a, 0x0100fb3d, 0x0100fb41, 0x0500fb44,
+        0x0630fc00, 0x0631fc00, 0x0632fc00, 0x0661fc00, 0x0663fc00, 0x0665fc00,
+        0x0669fc00, 0x066ffc00, 0x0673fc00, 0x0674fc00, 0x0100fc0d, 0x0100fc0e,
+        0x0100fc11, 0x0100fc12, 0x0100fc14, 0x0100fc15, 0x0100fc1a, 0x0100fc1b,
+        0x0100fc1d, 0x0100fc1e, 0x0100fc21, 0x0100fc22, 0x0100fc24, 0x0100fc25,
+        0x0100fc2b, 0x0100fc2e, 0x0100fc32, 0x0100fc35, 0x0100fc3a, 0x0100fc3d,
+        0x0100fc41, 0x0500fc44, 0x0630fd00, 0x0631fd00, 0x0632fd00, 0x0661fd00,
+        0x0663fd00, 0x0665fd00, 0x0669fd00, 0x066ffd00, 0x0673fd00, 0x0674fd00,
+        0x0100fd0d, 0x0100fd0e, 0x0100fd11, 0x0100fd12, 0x0100fd14, 0x0100fd15,
+        0x0100fd1a, 0x0100fd1b, 0x0100fd1d, 0x0100fd1e, 0x0100fd21, 0x0100fd22,
+        0x0100fd24, 0x0100fd25, 0x0100fd2b, 0x0100fd2e, 0x0100fd32, 0x0100fd35,
+        0x0100fd3a, 0x0100fd3d, 0x0100fd41, 0x0500fd44
+    },
+    /* 217 */
+    {
+        0x0230f501, 0x0630f516, 0x0231f501, 0x0631f516, 0x0232f501, 0x0632f516,
+        0x0261f501, 0x0661f516, 0x0263f501, 0x0663f516, 0x0265f501, 0x0665f516,
+        0x0269f501, 0x0669f516, 0x026ff501, 0x066ff516, 0x0273f501, 0x0673f516,
+        0x0274f501, 0x0674f516, 0x0620f500, 0x0625f500, 0x062df500, 0x062ef500,
+        0x062ff500, 0x0633f500, 0x0634f500, 0x0635f500, 0x0636f500, 0x0637f500,
+        0x0638f500, 0x0639f500, 0x063df500, 0x0641f500, 0x065ff500, 0x0662f500,
+        0x0664f500, 0x0666f500, 0x0667f500, 0x0668f500, 0x066cf500, 0x066df500,
+        0x066ef500, 0x0670f500, 0x0672f500, 0x0675f500, 0x0100f526, 0x0100f527,
+        0x0100f52c, 0x0100f52d, 0x0100f52f, 0x0100f530, 0x0100f533, 0x0100f534,
+        0x0100f536, 0x0100f537, 0x0100f53b, 0x0100f53c, 0x0100f53e, 0x0100f53f,
+        0x0100f542, 0x0100f543, 0x0100f545, 0x0500f548, 0x0230f601, 0x0630f616,
+        0x0231f601, 0x0631f616, 0x0232f601, 0x0632f616, 0x0261f601, 0x0661f616,
+        0x0263f601, 0x0663f616, 0x0265f601, 0x0665f616, 0x0269f601, 0x0669f616,
+        0x026ff601, 0x066ff616, 0x0273f601, 0x0673f616, 0x0274f601, 0x0674f616,
+        0x0620f600, 0x0625f600, 0x062df600, 0x062ef600, 0x062ff600, 0x0633f600,
+        0x0634f600, 0x0635f600, 0x0636f600, 0x0637f600, 0x0638f600, 0x0639f600,
+        0x063df600, 0x0641f600, 0x065ff600, 0x0662f600, 0x0664f600, 0x0666f600,
+        0x0667f600, 0x0668f600, 0x066cf600, 0x066df600, 0x066ef600, 0x0670f600,
+        0x0672f600, 0x0675f600, 0x0100f626, 0x0100f627, 0x0100f62c, 0x0100f62d,
+        0x0100f62f, 0x0100f630, 0x0100f633, 0x0100f634, 0x0100f636, 0x0100f637,
+        0x0100f63b, 0x0100f63c, 0x0100f63e, 0x0100f63f, 0x0100f642, 0x0100f643,
+        0x0100f645, 0x0500f648, 0x0230f701, 0x0630f716, 0x0231f701, 0x0631f716,
+        0x0232f701, 0x0632f716, 0x0261f701, 0x0661f716, 0x0263f701, 0x0663f716,
+        0x0265f701, 0x0665f716, 0x0269f701, 0x0669f716, 0x026ff701, 0x066ff716,
+        0x0273f701, 0x0673f716, 0x0274f701, 0x0674f716, 0x0620f700, 0x0625f700,
+        0x062df700, 0x062ef700, 0x062ff700, 0x0633f700, 0x0634f700, 0x0635f700,
+        0x0636f700, 0x0637f700, 0x0638f700, 0x0639f700, 0x063df700, 0x0641f700,
+        0x065ff700, 0x0662f700, 0x0664f700, 0x0666f700, 0x0667f700, 0x0668f700,
+        0x066cf700, 0x066df700, 0x066ef700, 0x0670f700, 0x0672f700, 0x0675f700,
+        0x0100f726, 0x0100f727, 0x0100f72c, 0x0100f72d, 0x0100f72f, 0x0100f730,
+        0x0100f733, 0x0100f734, 0x0100f736, 0x0100f737, 0x0100f73b, 0x0100f73c,
+        0x0100f73e, 0x0100f73f, 0x0100f742, 0x0100f743, 0x0100f745, 0x0500f748,
+        0x0230f801, 0x0630f816, 0x0231f801, 0x0631f816, 0x0232f801, 0x0632f816,
+        0x0261f801, 0x0661f816, 0x0263f801, 0x0663f816, 0x0265f801, 0x0665f816,
+        0x0269f801, 0x0669f816, 0x026ff801, 0x066ff816, 0x0273f801, 0x0673f816,
+        0x0274f801, 0x0674f816, 0x0620f800, 0x0625f800, 0x062df800, 0x062ef800,
+        0x062ff800, 0x0633f800, 0x0634f800, 0x0635f800, 0x0636f800, 0x0637f800,
+        0x0638f800, 0x0639f800, 0x063df800, 0x0641f800, 0x065ff800, 0x0662f800,
+        0x0664f800, 0x0666f800, 0x0667f800, 0x0668f800, 0x066cf800, 0x066df800,
+        0x066ef800, 0x0670f800, 0x0672f800, 0x0675f800, 0x0100f826, 0x0100f827,
+        0x0100f82c, 0x0100f82d, 0x0100f82f, 0x0100f830, 0x0100f833, 0x0100f834,
+        0x0100f836, 0x0100f837, 0x0100f83b, 0x0100f83c, 0x0100f83e, 0x0100f83f,
+        0x0100f842, 0x0100f843, 0x0100f845, 0x0500f848
+    },
+    /* 218 */
+    {
+        0x0230f502, 0x0230f509, 0x0230f517, 0x0630f528, 0x0231f502, 0x0231f509,
+        0x0231f517, 0x0631f528, 0x0232f502, 0x0232f509, 0x0232f517, 0x0632f528,
+        0x0261f502, 0x0261f509, 0x0261f517, 0x0661f528, 0x0263f502, 0x0263f509,
+        0x0263f517, 0x0663f528, 0x0265f502, 0x0265f509, 0x0265f517, 0x0665f528,
+        0x0269f502, 0x0269f509, 0x0269f517, 0x0669f528, 0x026ff502, 0x026ff509,
+        0x026ff517, 0x066ff528, 0x0273f502, 0x0273f509, 0x0273f517, 0x0673f528,
+        0x0274f502, 0x0274f509, 0x0274f517, 0x0674f528, 0x0220f501, 0x0620f516,
+        0x0225f501, 0x0625f516, 0x022df501, 0x062df516, 0x022ef501, 0x062ef516,
+        0x022ff501, 0x062ff516, 0x0233f501, 0x0633f516, 0x0234f501, 0x0634f516,
+        0x0235f501, 0x0635f516, 0x0236f501, 0x0636f516, 0x0237f501, 0x0637f516,
+        0x0238f501, 0x0638f516, 0x0239f501, 0x0639f516, 0x023df501, 0x063df516,
+        0x0241f501, 0x0641f516, 0x025ff501, 0x065ff516, 0x0262f501, 0x0662f516,
+        0x0264f501, 0x0664f516, 0x0266f501, 0x0666f516, 0x0267f501, 0x0667f516,
+        0x0268f501, 0x0668f516, 0x026cf501, 0x066cf516, 0x026df501, 0x066df516,
+        0x026ef501, 0x066ef516, 0x0270f501, 0x0670f516, 0x0272f501, 0x0672f516,
+        0x0275f501, 0x0675f516, 0x063af500, 0x0642f500, 0x0643f500, 0x0644f500,
+        0x0645f500, 0x0646f500, 0x0647f500, 0x0648f500, 0x0649f500, 0x064af500,
+        0x064bf500, 0x064cf500, 0x064df500, 0x064ef500, 0x064ff500, 0x0650f500,
+        0x0651f500, 0x0652f500, 0x0653f500, 0x0654f500, 0x0655f500, 0x0656f500,
+        0x0657f500, 0x0659f500, 0x066af500, 0x066bf500, 0x0671f500, 0x0676f500,
+        0x0677f500, 0x0678f500, 0x0679f500, 0x067af500, 0x0100f546, 0x0100f547,
+        0x0100f549, 0x0500f54a, 0x0230f602, 0x0230f609, 0x0230f617, 0x0630f628,
+        0x0231f602, 0x0231f609, 0x0231f617, 0x0631f628, 0x0232f602, 0x0232f609,
+        0x0232f617, 0x0632f628, 0x0261f602, 0x0261f609, 0x0261f617, 0x0661f628,
+        0x0263f602, 0x0263f609, 0x0263f617, 0x0663f628, 0x0265f602, 0x0265f609,
+        0x0265f617, 0x0665f628, 0x0269f602, 0x0269f609, 0x0269f617, 0x0669f628,
+        0x026ff602, 0x026ff609, 0x026ff617, 0x066ff628, 0x0273f602, 0x0273f609,
+        0x0273f617, 0x0673f628, 0x0274f602, 0x0274f609, 0x0274f617, 0x0674f628,
+        0x0220f601, 0x0620f616, 0x0225f601, 0x0625f616, 0x022df601, 0x062df616,
+        0x022ef601, 0x062ef616, 0x022ff601, 0x062ff616, 0x0233f601, 0x0633f616,
+        0x0234f601, 0x0634f616, 0x0235f601, 0x0635f616, 0x0236f601, 0x0636f616,
+        0x0237f601, 0x0637f616, 0x0238f601, 0x0638f616, 0x0239f601, 0x0639f616,
+        0x023df601, 0x063df616, 0x0241f601, 0x0641f616, 0x025ff601, 0x065ff616,
+        0x0262f601, 0x0662f616, 0x0264f601, 0x0664f616, 0x0266f601, 0x0666f616,
+        0x0267f601, 0x0667f616, 0x0268f601, 0x0668f616, 0x026cf601, 0x066cf616,
+        0x026df601, 0x066df616, 0x026ef601, 0x066ef616, 0x0270f601, 0x0670f616,
+        0x0272f601, 0x0672f616, 0x0275f601, 0x0675f616, 0x063af600, 0x0642f600,
+        0x0643f600, 0x0644f600, 0x0645f600, 0x0646f600, 0x0647f600, 0x0648f600,
+        0x0649f600, 0x064af600, 0x064bf600, 0x064cf600, 0x064df600, 0x064ef600,
+        0x064ff600, 0x0650f600, 0x0651f600, 0x0652f600, 0x0653f600, 0x0654f600,
+        0x0655f600, 0x0656f600, 0x0657f600, 0x0659f600, 0x066af600, 0x066bf600,
+        0x0671f600, 0x0676f600, 0x0677f600, 0x0678f600, 0x0679f600, 0x067af600,
+        0x0100f646, 0x0100f647, 0x0100f649, 0x0500f64a
+    },
+    /* 219 */
+    {
+        0x0230f702, 0x0230f709, 0x0230f717, 0x0630f728, 0x0231f702, 0x0231f709,
+        0x0231f717, 0x0631f728, 0x0232f702, 0x0232f709, 0x0232f717, 0x0632f728,
+        0x0261f702, 0x0261f709, 0x0261f717, 0x0661f728, 0x0263f702, 0x0263f709,
+        0x0263f717, 0x0663f728, 0x0265f702, 0x0265f709, 0x0265f717, 0x0665f728,
+        0x0269f702, 0x0269f709, 0x0269f717, 0x0669f728, 0x026ff702, 0x026ff709,
+        0x026ff717, 0x066ff728, 0x0273f702, 0x0273f709, 0x0273f717, 0x0673f728,
+        0x0274f702, 0x0274f709, 0x0274f717, 0x0674f728, 0x0220f701, 0x0620f716,
+        0x0225f701, 0x0625f716, 0x022df701, 0x062df716, 0x022ef701, 0x062ef716,
+        0x022ff701, 0x062ff716, 0x0233f701, 0x0633f716, 0x0234f701, 0x0634f716,
+        0x0235f701, 0x0635f716, 0x0236f701, 0x0636f716, 0x0237f701, 0x0637f716,
+        0x0238f701, 0x0638f716, 0x0239f701, 0x0639f716, 0x023df701, 0x063df716,
+        0x0241f701, 0x0641f716, 0x025ff701, 0x065ff716, 0x0262f701, 0x0662f716,
+        0x0264f701, 0x0664f716, 0x0266f701, 0x0666f716, 0x0267f701, 0x0667f716,
+        0x0268f701, 0x0668f716, 0x026cf701, 0x066cf716, 0x026df701, 0x066df716,
+        0x026ef701, 0x066ef716, 0x0270f701, 0x0670f716, 0x0272f701, 0x0672f716,
+        0x0275f701, 0x0675f716, 0x063af700, 0x0642f700, 0x0643f700, 0x0644f700,
+        0x0645f700, 0x0646f700, 0x0647f700, 0x0648f700, 0x0649f700, 0x064af700,
+        0x064bf700, 0x064cf700, 0x064df700, 0x064ef700, 0x064ff700, 0x0650f700,
+        0x0651f700, 0x0652f700, 0x0653f700, 0x0654f700, 0x0655f700, 0x0656f700,
+        0x0657f700, 0x0659f700, 0x066af700, 0x066bf700, 0x0671f700, 0x0676f700,
+        0x0677f700, 0x0678f700, 0x0679f700, 0x067af700, 0x0100f746, 0x0100f747,
+        0x0100f749, 0x0500f74a, 0x0230f802, 0x0230f809, 0x0230f817, 0x0630f828,
+        0x0231f802, 0x0231f809, 0x0231f817, 0x0631f828, 0x0232f802, 0x0232f809,
+        0x0232f817, 0x0632f828, 0x0261f802, 0x0261f809, 0x0261f817, 0x0661f828,
+        0x0263f802, 0x0263f809, 0x0263f817, 0x0663f828, 0x0265f802, 0x0265f809,
+        0x0265f817, 0x0665f828, 0x0269f802, 0x0269f809, 0x0269f817, 0x0669f828,
+        0x026ff802, 0x026ff809, 0x026ff817, 0x066ff828, 0x0273f802, 0x0273f809,
+        0x0273f817, 0x0673f828, 0x0274f802, 0x0274f809, 0x0274f817, 0x0674f828,
+        0x0220f801, 0x0620f816, 0x0225f801, 0x0625f816, 0x022df801, 0x062df816,
+        0x022ef801, 0x062ef816, 0x022ff801, 0x062ff816, 0x0233f801, 0x0633f816,
+        0x0234f801, 0x0634f816, 0x0235f801, 0x0635f816, 0x0236f801, 0x0636f816,
+        0x0237f801, 0x0637f816, 0x0238f801, 0x0638f816, 0x0239f801, 0x0639f816,
+        0x023df801, 0x063df816, 0x0241f801, 0x0641f816, 0x025ff801, 0x065ff816,
+        0x0262f801, 0x0662f816, 0x0264f801, 0x0664f816, 0x0266f801, 0x0666f816,
+        0x0267f801, 0x0667f816, 0x0268f801, 0x0668f816, 0x026cf801, 0x066cf816,
+        0x026df801, 0x066df816, 0x026ef801, 0x066ef816, 0x0270f801, 0x0670f816,
+        0x0272f801, 0x0672f816, 0x0275f801, 0x0675f816, 0x063af800, 0x0642f800,
+        0x0643f800, 0x0644f800, 0x0645f800, 0x0646f800, 0x0647f800, 0x0648f800,
+        0x0649f800, 0x064af800, 0x064bf800, 0x064cf800, 0x064df800, 0x064ef800,
+        0x064ff800, 0x0650f800, 0x0651f800, 0x0652f800, 0x0653f800, 0x0654f800,
+        0x0655f800, 0x0656f800, 0x0657f800, 0x0659f800, 0x066af800, 0x066bf800,
+        0x0671f800, 0x0676f800, 0x0677f800, 0x0678f800, 0x0679f800, 0x067af800,
+        0x0100f846, 0x0100f847, 0x0100f849, 0x0500f84a
+    },
+    /* 220 */
+    {
+        0x0230fa01, 0x0630fa16, 0x0231fa01, 0x0631fa16, 0x0232fa01, 0x0632fa16,
+        0x0261fa01, 0x0661fa16, 0x0263fa01, 0x0663fa16, 0x0265fa01, 0x0665fa16,
+        0x0269fa01, 0x0669fa16, 0x026ffa01, 0x066ffa16, 0x0273fa01, 0x0673fa16,
+        0x0274fa01, 0x0674fa16, 0x0620fa00, 0x0625fa00, 0x062dfa00, 0x062efa00,
+        0x062ffa00, 0x0633fa00, 0x0634fa00, 0x0635fa00, 0x0636fa00, 0x0637fa00,
+        0x0638fa00, 0x0639fa00, 0x063dfa00, 0x0641fa00, 0x065ffa00, 0x0662fa00,
+        0x0664fa00, 0x0666fa00, 0x0667fa00, 0x0668fa00, 0x066cfa00, 0x066dfa00,
+        0x066efa00, 0x0670fa00, 0x0672fa00, 0x0675fa00, 0x0100fa26, 0x0100fa27,
+        0x0100fa2c, 0x0100fa2d, 0x0100fa2f, 0x0100fa30, 0x0100fa33, 0x0100fa34,
+        0x0100fa36, 0x0100fa37, 0x0100fa3b, 0x0100fa3c, 0x0100fa3e, 0x0100fa3f,
+        0x0100fa42, 0x0100fa43, 0x0100fa45, 0x0500fa48, 0x0230fb01, 0x0630fb16,
+        0x0231fb01, 0x0631fb16, 0x0232fb01, 0x0632fb16, 0x0261fb01, 0x0661fb16,
+        0x0263fb01, 0x0663fb16, 0x0265fb01, 0x0665fb16, 0x0269fb01, 0x0669fb16,
+        0x026ffb01, 0x066ffb16, 0x0273fb01, 0x0673fb16, 0x0274fb01, 0x0674fb16,
+        0x0620fb00, 0x0625fb00, 0x062dfb00, 0x062efb00, 0x062ffb00, 0x0633fb00,
+        0x0634fb00, 0x0635fb00, 0x0636fb00, 0x0637fb00, 0x0638fb00, 0x0639fb00,
+        0x063dfb00, 0x0641fb00, 0x065ffb00, 0x0662fb00, 0x0664fb00, 0x0666fb00,
+        0x0667fb00, 0x0668fb00, 0x066cfb00, 0x066dfb00, 0x066efb00, 0x0670fb00,
+        0x0672fb00, 0x0675fb00, 0x0100fb26, 0x0100fb27, 0x0100fb2c, 0x0100fb2d,
+        0x0100fb2f, 0x0100fb30, 0x0100fb33, 0x0100fb34, 0x0100fb36, 0x0100fb37,
+        0x0100fb3b, 0x0100fb3c, 0x0100fb3e, 0x0100fb3f, 0x0100fb42, 0x0100fb43,
+        0x0100fb45, 0x0500fb48, 0x0230fc01, 0x0630fc16, 0x0231fc01, 0x0631fc16,
+        0x0232fc01, 0x0632fc16, 0x0261fc01, 0x0661fc16, 0x0263fc01, 0x0663fc16,
+        0x0265fc01, 0x0665fc16, 0x0269fc01, 0x0669fc16, 0x026ffc01, 0x066ffc16,
+        0x0273fc01, 0x0673fc16, 0x0274fc01, 0x0674fc16, 0x0620fc00, 0x0625fc00,
+        0x062dfc00, 0x062efc00, 0x062ffc00, 0x0633fc00, 0x0634fc00, 0x0635fc00,
+        0x0636fc00, 0x0637fc00, 0x0638fc00, 0x0639fc00, 0x063dfc00, 0x0641fc00,
+        0x065ffc00, 0x0662fc00, 0x0664fc00, 0x0666fc00, 0x0667fc00, 0x0668fc00,
+        0x066cfc00, 0x066dfc00, 0x066efc00, 0x0670fc00, 0x0672fc00, 0x0675fc00,
+        0x0100fc26, 0x0100fc27, 0x0100fc2c, 0x0100fc2d, 0x0100fc2f, 0x0100fc30,
+        0x0100fc33, 0x0100fc34, 0x0100fc36, 0x0100fc37, 0x0100fc3b, 0x0100fc3c,
+        0x0100fc3e, 0x0100fc3f, 0x0100fc42, 0x0100fc43, 0x0100fc45, 0x0500fc48,
+        0x0230fd01, 0x0630fd16, 0x0231fd01, 0x0631fd16, 0x0232fd01, 0x0632fd16,
+        0x0261fd01, 0x0661fd16, 0x0263fd01, 0x0663fd16, 0x0265fd01, 0x0665fd16,
+        0x0269fd01, 0x0669fd16, 0x026ffd01, 0x066ffd16, 0x0273fd01, 0x0673fd16,
+        0x0274fd01, 0x0674fd16, 0x0620fd00, 0x0625fd00, 0x062dfd00, 0x062efd00,
+        0x062ffd00, 0x0633fd00, 0x0634fd00, 0x0635fd00, 0x0636fd00, 0x0637fd00,
+        0x0638fd00, 0x0639fd00, 0x063dfd00, 0x0641fd00, 0x065ffd00, 0x0662fd00,
+        0x0664fd00, 0x0666fd00, 0x0667fd00, 0x0668fd00, 0x066cfd00, 0x066dfd00,
+        0x066efd00, 0x0670fd00, 0x0672fd00, 0x0675fd00, 0x0100fd26, 0x0100fd27,
+        0x0100fd2c, 0x0100fd2d, 0x0100fd2f, 0x0100fd30, 0x0100fd33, 0x0100fd34,
+        0x0100fd36, 0x0100fd37, 0x0100fd3b, 0x0100fd3c, 0x0100fd3e, 0x0100fd3f,
+        0x0100fd42, 0x0100fd43, 0x0100fd45, 0x0500fd48
+    },
+    /* 221 */
+    {
+        0x0230fa02, 0x0230fa09, 0x0230fa17, 0x0630fa28, 0x0231fa02, 0x0231fa09,
+        0x0231fa17, 0x0631fa28, 0x0232fa02, 0x0232fa09, 0x0232fa17, 0x0632fa28,
+        0x0261fa02, 0x0261fa09, 0x0261fa17, 0x0661fa28, 0x0263fa02, 0x0263fa09,
+        0x0263fa17, 0x0663fa28, 0x0265fa02, 0x0265fa09, 0x0265fa17, 0x0665fa28,
+        0x0269fa02, 0x0269fa09, 0x0269fa17, 0x0669fa28, 0x026ffa02, 0x026ffa09,
+        0x026ffa17, 0x066ffa28, 0x0273fa02, 0x0273fa09, 0x0273fa17, 0x0673fa28,
+        0x0274fa02, 0x0274fa09, 0x0274fa17, 0x0674fa28, 0x0220fa01, 0x0620fa16,
+        0x0225fa01, 0x0625fa16, 0x022dfa01, 0x062dfa16, 0x022efa01, 0x062efa16,
+        0x022ffa01, 0x062ffa16, 0x0233fa01, 0x0633fa16, 0x0234fa01, 0x0634fa16,
+        0x0235fa01, 0x0635fa16, 0x0236fa01, 0x0636fa16, 0x0237fa01, 0x0637fa16,
+        0x0238fa01, 0x0638fa16, 0x0239fa01, 0x0639fa16, 0x023dfa01, 0x063dfa16,
+        0x0241fa01, 0x0641fa16, 0x025ffa01, 0x065ffa16, 0x0262fa01, 0x0662fa16,
+        0x0264fa01, 0x0664fa16, 0x0266fa01, 0x0666fa16, 0x0267fa01, 0x0667fa16,
+        0x0268fa01, 0x0668fa16, 0x026cfa01, 0x066cfa16, 0x026dfa01, 0x066dfa16,
+        0x026efa01, 0x066efa16, 0x0270fa01, 0x0670fa16, 0x0272fa01, 0x0672fa16,
+        0x0275fa01, 0x0675fa16, 0x063afa00, 0x0642fa00, 0x0643fa00, 0x0644fa00,
+        0x0645fa00, 0x0646fa00, 0x0647fa00, 0x0648fa00, 0x0649fa00, 0x064afa00,
+        0x064bfa00, 0x064cfa00, 0x064dfa00, 0x064efa00, 0x064ffa00, 0x0650fa00,
+        0x0651fa00, 0x0652fa00, 0x0653fa00, 0x0654fa00, 0x0655fa00, 0x0656fa00,
+        0x0657fa00, 0x0659fa00, 0x066afa00, 0x066bfa00, 0x0671fa00, 0x0676fa00,
+        0x0677fa00, 0x0678fa00, 0x0679fa00, 0x067afa00, 0x0100fa46, 0x0100fa47,
+        0x0100fa49, 0x0500fa4a, 0x0230fb02, 0x0230fb09, 0x0230fb17, 0x0630fb28,
+        0x0231fb02, 0x0231fb09, 0x0231fb17, 0x0631fb28, 0x0232fb02, 0x0232fb09,
+        0x0232fb17, 0x0632fb28, 0x0261fb02, 0x0261fb09, 0x0261fb17, 0x0661fb28,
+        0x0263fb02, 0x0263fb09, 0x0263fb17, 0x0663fb28, 0x0265fb02, 0x0265fb09,
+        0x0265fb17, 0x0665fb28, 0x0269fb02, 0x0269fb09, 0x0269fb17, 0x0669fb28,
+        0x026ffb02, 0x026ffb09, 0x026ffb17, 0x066ffb28, 0x0273fb02, 0x0273fb09,
+        0x0273fb17, 0x0673fb28, 0x0274fb02, 0x0274fb09, 0x0274fb17, 0x0674fb28,
+        0x0220fb01, 0x0620fb16, 0x0225fb01, 0x0625fb16, 0x022dfb01, 0x062dfb16,
+        0x022efb01, 0x062efb16, 0x022ffb01, 0x062ffb16, 0x0233fb01, 0x0633fb16,
+        0x0234fb01, 0x0634fb16, 0x0235fb01, 0x0635fb16, 0x0236fb01, 0x0636fb16,
+        0x0237fb01, 0x0637fb16, 0x0238fb01, 0x0638fb16, 0x0239fb01, 0x0639fb16,
+        0x023dfb01, 0x063dfb16, 0x0241fb01, 0x0641fb16, 0x025ffb01, 0x065ffb16,
+        0x0262fb01, 0x0662fb16, 0x0264fb01, 0x0664fb16, 0x0266fb01, 0x0666fb16,
+        0x0267fb01, 0x0667fb16, 0x0268fb01, 0x0668fb16, 0x026cfb01, 0x066cfb16,
+        0x026dfb01, 0x066dfb16, 0x026efb01, 0x066efb16, 0x0270fb01, 0x0670fb16,
+        0x0272fb01, 0x0672fb16, 0x0275fb01, 0x0675fb16, 0x063afb00, 0x0642fb00,
+        0x0643fb00, 0x0644fb00, 0x0645fb00, 0x0646fb00, 0x0647fb00, 0x0648fb00,
+        0x0649fb00, 0x064afb00, 0x064bfb00, 0x064cfb00, 0x064dfb00, 0x064efb00,
+        0x064ffb00, 0x0650fb00, 0x0651fb00, 0x0652fb00, 0x0653fb00, 0x0654fb00,
+        0x0655fb00, 0x0656fb00, 0x0657fb00, 0x0659fb00, 0x066afb00, 0x066bfb00,
+        0x0671fb00, 0x0676fb00, 0x0677fb00, 0x0678fb00, 0x0679fb00, 0x067afb00,
+        0x0100fb46, 0x0100fb47, 0x0100fb49, 0x0500fb4a
+    },
+    /* 222 */
+    {
+        0x0230fc02, 0x0230fc09, 0x0230fc17, 0x0630fc28, 0x0231fc02, 0x0231fc09,
+        0x0231fc17, 0x0631fc28, 0x0232fc02, 0x0232fc09, 0x0232fc17, 0x0632fc28,
+        0x0261fc02, 0x0261fc09, 0x0261fc17, 0x0661fc28, 0x0263fc02, 0x0263fc09,
+        0x0263fc17, 0x0663fc28, 0x0265fc02, 0x0265fc09, 0x0265fc17, 0x0665fc28,
+        0x0269fc02, 0x0269fc09, 0x0269fc17, 0x0669fc28, 0x026ffc02, 0x026ffc09,
+        0x026ffc17, 0x066ffc28, 0x0273fc02, 0x0273fc09, 0x0273fc17, 0x0673fc28,
+        0x0274fc02, 0x0274fc09, 0x0274fc17, 0x0674fc28, 0x0220fc01, 0x0620fc16,
+        0x0225fc01, 0x0625fc16, 0x022dfc01, 0x062dfc16, 0x022efc01, 0x062efc16,
+        0x022ffc01, 0x062ffc16, 0x0233fc01, 0x0633fc16, 0x0234fc01, 0x0634fc16,
+        0x0235fc01, 0x0635fc16, 0x0236fc01, 0x0636fc16, 0x0237fc01, 0x0637fc16,
+        0x0238fc01, 0x0638fc16, 0x0239fc01, 0x0639fc16, 0x023dfc01, 0x063dfc16,
+        0x0241fc01, 0x0641fc16, 0x025ffc01, 0x065ffc16, 0x0262fc01, 0x0662fc16,
+        0x0264fc01, 0x0664fc16, 0x0266fc01, 0x0666fc16, 0x0267fc01, 0x0667fc16,
+        0x0268fc01, 0x0668fc16, 0x026cfc01, 0x066cfc16, 0x026dfc01, 0x066dfc16,
+        0x026efc01, 0x066efc16, 0x0270fc01, 0x0670fc16, 0x0272fc01, 0x0672fc16,
+        0x0275fc01, 0x0675fc16, 0x063afc00, 0x0642fc00, 0x0643fc00, 0x0644fc00,
+        0x0645fc00, 0x0646fc00, 0x0647fc00, 0x0648fc00, 0x0649fc00, 0x064afc00,
+        0x064bfc00, 0x064cfc00, 0x064dfc00, 0x064efc00, 0x064ffc00, 0x0650fc00,
+        0x0651fc00, 0x0652fc00, 0x0653fc00, 0x0654fc00, 0x0655fc00, 0x0656fc00,
+        0x0657fc00, 0x0659fc00, 0x066afc00, 0x066bfc00, 0x0671fc00, 0x0676fc00,
+        0x0677fc00, 0x0678fc00, 0x0679fc00, 0x067afc00, 0x0100fc46, 0x0100fc47,
+        0x0100fc49, 0x0500fc4a, 0x0230fd02, 0x0230fd09, 0x0230fd17, 0x0630fd28,
+        0x0231fd02, 0x0231fd09, 0x0231fd17, 0x0631fd28, 0x0232fd02, 0x0232fd09,
+        0x0232fd17, 0x0632fd28, 0x0261fd02, 0x0261fd09, 0x0261fd17, 0x0661fd28,
+        0x0263fd02, 0x0263fd09, 0x0263fd17, 0x0663fd28, 0x0265fd02, 0x0265fd09,
+        0x0265fd17, 0x0665fd28, 0x0269fd02, 0x0269fd09, 0x0269fd17, 0x0669fd28,
+        0x026ffd02, 0x026ffd09, 0x026ffd17, 0x066ffd28, 0x0273fd02, 0x0273fd09,
+        0x0273fd17, 0x0673fd28, 0x0274fd02, 0x0274fd09, 0x0274fd17, 0x0674fd28,
+        0x0220fd01, 0x0620fd16, 0x0225fd01, 0x0625fd16, 0x022dfd01, 0x062dfd16,
+        0x022efd01, 0x062efd16, 0x022ffd01, 0x062ffd16, 0x0233fd01, 0x0633fd16,
+        0x0234fd01, 0x0634fd16, 0x0235fd01, 0x0635fd16, 0x0236fd01, 0x0636fd16,
+        0x0237fd01, 0x0637fd16, 0x0238fd01, 0x0638fd16, 0x0239fd01, 0x0639fd16,
+        0x023dfd01, 0x063dfd16, 0x0241fd01, 0x0641fd16, 0x025ffd01, 0x065ffd16,
+        0x0262fd01, 0x0662fd16, 0x0264fd01, 0x0664fd16, 0x0266fd01, 0x0666fd16,
+        0x0267fd01, 0x0667fd16, 0x0268fd01, 0x0668fd16, 0x026cfd01, 0x066cfd16,
+        0x026dfd01, 0x066dfd16, 0x026efd01, 0x066efd16, 0x0270fd01, 0x0670fd16,
+        0x0272fd01, 0x0672fd16, 0x0275fd01, 0x0675fd16, 0x063afd00, 0x0642fd00,
+        0x0643fd00, 0x0644fd00, 0x0645fd00, 0x0646fd00, 0x0647fd00, 0x0648fd00,
+        0x0649fd00, 0x064afd00, 0x064bfd00, 0x064cfd00, 0x064dfd00, 0x064efd00,
+        0x064ffd00, 0x0650fd00, 0x0651fd00, 0x0652fd00, 0x0653fd00, 0x0654fd00,
+        0x0655fd00, 0x0656fd00, 0x0657fd00, 0x0659fd00, 0x066afd00, 0x066bfd00,
+        0x0671fd00, 0x0676fd00, 0x0677fd00, 0x0678fd00, 0x0679fd00, 0x067afd00,
+        0x0100fd46, 0x0100fd47, 0x0100fd49, 0x0500fd4a
+    },
+    /* 223 */
+    {
+        0x0100fe04, 0x0100fe05, 0x0100fe07, 0x0100fe08, 0x0100fe0b, 0x0100fe0c,
+        0x0100fe10, 0x0100fe13, 0x0100fe19, 0x0100fe1c, 0x0100fe20, 0x0100fe23,
+        0x0100fe2a, 0x0100fe31, 0x0100fe39, 0x0500fe40, 0x01000203, 0x01000206,
+        0x0100020a, 0x0100020f, 0x01000218, 0x0100021f, 0x01000229, 0x05000238,
+        0x01000303, 0x01000306, 0x0100030a, 0x0100030f, 0x01000318, 0x0100031f,
+        0x01000329, 0x05000338, 0x01000403, 0x01000406, 0x0100040a, 0x0100040f,
+        0x01000418, 0x0100041f, 0x01000429, 0x05000438, 0x01000503, 0x01000506,
+        0x0100050a, 0x0100050f, 0x01000518, 0x0100051f, 0x01000529, 0x05000538,
+        0x01000603, 0x01000606, 0x0100060a, 0x0100060f, 0x01000618, 0x0100061f,
+        0x01000629, 0x05000638, 0x01000703, 0x01000706, 0x0100070a, 0x0100070f,
+        0x01000718, 0x0100071f, 0x01000729, 0x05000738, 0x01000803, 0x01000806,
+        0x0100080a, 0x0100080f, 0x01000818, 0x0100081f, 0x01000829, 0x05000838,
+        0x01000b03, 0x01000b06, 0x01000b0a, 0x01000b0f, 0x01000b18, 0x01000b1f,
+        0x01000b29, 0x05000b38, 0x01000c03, 0x01000c06, 0x01000c0a, 0x01000c0f,
+        0x01000c18, 0x01000c1f, 0x01000c29, 0x05000c38, 0x01000e03, 0x01000e06,
+        0x01000e0a, 0x01000e0f, 0x01000e18, 0x01000e1f, 0x01000e29, 0x05000e38,
+        0x01000f03, 0x01000f06, 0x01000f0a, 0x01000f0f, 0x01000f18, 0x01000f1f,
+        0x01000f29, 0x05000f38, 0x01001003, 0x01001006, 0x0100100a, 0x0100100f,
+        0x01001018, 0x0100101f, 0x01001029, 0x05001038, 0x01001103, 0x01001106,
+        0x0100110a, 0x0100110f, 0x01001118, 0x0100111f, 0x01001129, 0x05001138,
+        0x01001203, 0x01001206, 0x0100120a, 0x0100120f, 0x01001218, 0x0100121f,
+        0x01001229, 0x05001238, 0x01001303, 0x01001306, 0x0100130a, 0x0100130f,
+        0x01001318, 0x0100131f, 0x01001329, 0x05001338, 0x01001403, 0x01001406,
+        0x0100140a, 0x0100140f, 0x01001418, 0x0100141f, 0x01001429, 0x05001438,
+        0x01001503, 0x01001506, 0x0100150a, 0x0100150f, 0x01001518, 0x0100151f,
+        0x01001529, 0x05001538, 0x01001703, 0x01001706, 0x0100170a, 0x0100170f,
+        0x01001718, 0x0100171f, 0x01001729, 0x05001738, 0x01001803, 0x01001806,
+        0x0100180a, 0x0100180f, 0x01001818, 0x0100181f, 0x01001829, 0x05001838,
+        0x01001903, 0x01001906, 0x0100190a, 0x0100190f, 0x01001918, 0x0100191f,
+        0x01001929, 0x05001938, 0x01001a03, 0x01001a06, 0x01001a0a, 0x01001a0f,
+        0x01001a18, 0x01001a1f, 0x01001a29, 0x05001a38, 0x01001b03, 0x01001b06,
+        0x01001b0a, 0x01001b0f, 0x01001b18, 0x01001b1f, 0x01001b29, 0x05001b38,
+        0x01001c03, 0x01001c06, 0x01001c0a, 0x01001c0f, 0x01001c18, 0x01001c1f,
+        0x01001c29, 0x05001c38, 0x01001d03, 0x01001d06, 0x01001d0a, 0x01001d0f,
+        0x01001d18, 0x01001d1f, 0x01001d29, 0x05001d38, 0x01001e03, 0x01001e06,
+        0x01001e0a, 0x01001e0f, 0x01001e18, 0x01001e1f, 0x01001e29, 0x05001e38,
+        0x01001f03, 0x01001f06, 0x01001f0a, 0x01001f0f, 0x01001f18, 0x01001f1f,
+        0x01001f29, 0x05001f38, 0x01007f03, 0x01007f06, 0x01007f0a, 0x01007f0f,
+        0x01007f18, 0x01007f1f, 0x01007f29, 0x05007f38, 0x0100dc03, 0x0100dc06,
+        0x0100dc0a, 0x0100dc0f, 0x0100dc18, 0x0100dc1f, 0x0100dc29, 0x0500dc38,
+        0x0100f903, 0x0100f906, 0x0100f90a, 0x0100f90f, 0x0100f918, 0x0100f91f,
+        0x0100f929, 0x0500f938, 0x01000a01, 0x05000a16, 0x01000d01, 0x05000d16,
+        0x01001601, 0x05001616, 0x08000000, 0x08000000
+    },
+    /* 224 */
+    {
+        0x0630fe00, 0x0631fe00, 0x0632fe00, 0x0661fe00, 0x0663fe00, 0x0665fe00,
+        0x0669fe00, 0x066ffe00, 0x0673fe00, 0x0674fe00, 0x0100fe0d, 0x0100fe0e,
+        0x0100fe11, 0x0100fe12, 0x0100fe14, 0x0100fe15, 0x0100fe1a, 0x0100fe1b,
+        0x0100fe1d, 0x0100fe1e, 0x0100fe21, 0x0100fe22, 0x0100fe24, 0x0100fe25,
+        0x0100fe2b, 0x0100fe2e, 0x0100fe32, 0x0100fe35, 0x0100fe3a, 0x0100fe3d,
+        0x0100fe41, 0x0500fe44, 0x01000204, 0x01000205, 0x01000207, 0x01000208,
+        0x0100020b, 0x0100020c, 0x01000210, 0x01000213, 0x01000219, 0x0100021c,
+        0x01000220, 0x01000223, 0x0100022a, 0x01000231, 0x01000239, 0x05000240,
+        0x01000304, 0x01000305, 0x01000307, 0x01000308, 0x0100030b, 0x0100030c,
+        0x01000310, 0x01000313, 0x01000319, 0x0100031c, 0x01000320, 0x01000323,
+        0x0100032a, 0x01000331, 0x01000339, 0x05000340, 0x01000404, 0x01000405,
+        0x01000407, 0x01000408, 0x0100040b, 0x0100040c, 0x01000410, 0x01000413,
+        0x01000419, 0x0100041c, 0x01000420, 0x01000423, 0x0100042a, 0x01000431,
+        0x01000439, 0x05000440, 0x01000504, 0x01000505, 0x01000507, 0x01000508,
+        0x0100050b, 0x0100050c, 0x01000510, 0x01000513, 0x01000519, 0x0100051c,
+        0x01000520, 0x01000523, 0x0100052a, 0x01000531, 0x01000539, 0x05000540,
+        0x01000604, 0x01000605, 0x01000607, 0x01000608, 0x0100060b, 0x0100060c,
+        0x01000610, 0x01000613, 0x01000619, 0x0100061c, 0x01000620, 0x01000623,
+        0x0100062a, 0x01000631, 0x01000639, 0x05000640, 0x01000704, 0x01000705,
+        0x01000707, 0x01000708, 0x0100070b, 0x0100070c, 0x01000710, 0x01000713,
+        0x01000719, 0x0100071c, 0x01000720, 0x01000723, 0x0100072a, 0x01000731,
+        0x01000739, 0x05000740, 0x01000804, 0x01000805, 0x01000807, 0x01000808,
+        0x0100080b, 0x0100080c, 0x01000810, 0x01000813, 0x01000819, 0x0100081c,
+        0x01000820, 0x01000823, 0x0100082a, 0x01000831, 0x01000839, 0x05000840,
+        0x01000b04, 0x01000b05, 0x01000b07, 0x01000b08, 0x01000b0b, 0x01000b0c,
+        0x01000b10, 0x01000b13, 0x01000b19, 0x01000b1c, 0x01000b20, 0x01000b23,
+        0x01000b2a, 0x01000b31, 0x01000b39, 0x05000b40, 0x01000c04, 0x01000c05,
+        0x01000c07, 0x01000c08, 0x01000c0b, 0x01000c0c, 0x01000c10, 0x01000c13,
+        0x01000c19, 0x01000c1c, 0x01000c20, 0x01000c23, 0x01000c2a, 0x01000c31,
+        0x01000c39, 0x05000c40, 0x01000e04, 0x01000e05, 0x01000e07, 0x01000e08,
+        0x01000e0b, 0x01000e0c, 0x01000e10, 0x01000e13, 0x01000e19, 0x01000e1c,
+        0x01000e20, 0x01000e23, 0x01000e2a, 0x01000e31, 0x01000e39, 0x05000e40,
+        0x01000f04, 0x01000f05, 0x01000f07, 0x01000f08, 0x01000f0b, 0x01000f0c,
+        0x01000f10, 0x01000f13, 0x01000f19, 0x01000f1c, 0x01000f20, 0x01000f23,
+        0x01000f2a, 0x01000f31, 0x01000f39, 0x05000f40, 0x01001004, 0x01001005,
+        0x01001007, 0x01001008, 0x0100100b, 0x0100100c, 0x01001010, 0x01001013,
+        0x01001019, 0x0100101c, 0x01001020, 0x01001023, 0x0100102a, 0x01001031,
+        0x01001039, 0x05001040, 0x01001104, 0x01001105, 0x01001107, 0x01001108,
+        0x0100110b, 0x0100110c, 0x01001110, 0x01001113, 0x01001119, 0x0100111c,
+        0x01001120, 0x01001123, 0x0100112a, 0x01001131, 0x01001139, 0x05001140,
+        0x01001204, 0x01001205, 0x01001207, 0x01001208, 0x0100120b, 0x0100120c,
+        0x01001210, 0x01001213, 0x01001219, 0x0100121c, 0x01001220, 0x01001223,
+        0x0100122a, 0x01001231, 0x01001239, 0x05001240
+    },
+    /* 225 */
+    {
+        0x0230fe01, 0x0630fe16, 0x0231fe01, 0x0631fe16, 0x0232fe01, 0x0632fe16,
+        0x0261fe01, 0x0661fe16, 0x0263fe01, 0x0663fe16, 0x0265fe01, 0x0665fe16,
+        0x0269fe01, 0x0669fe16, 0x026ffe01, 0x066ffe16, 0x0273fe01, 0x0673fe16,
+        0x0274fe01, 0x0674fe16, 0x0620fe00, 0x0625fe00, 0x062dfe00, 0x062efe00,
+        0x062ffe00, 0x0633fe00, 0x0634fe00, 0x0635fe00, 0x0636fe00, 0x0637fe00,
+        0x0638fe00, 0x0639fe00, 0x063dfe00, 0x0641fe00, 0x065ffe00, 0x0662fe00,
+        0x0664fe00, 0x0666fe00, 0x0667fe00, 0x0668fe00, 0x066cfe00, 0x066dfe00,
+        0x066efe00, 0x0670fe00, 0x0672fe00, 0x0675fe00, 0x0100fe26, 0x0100fe27,
+        0x0100fe2c, 0x0100fe2d, 0x0100fe2f, 0x0100fe30, 0x0100fe33, 0x0100fe34,
+        0x0100fe36, 0x0100fe37, 0x0100fe3b, 0x0100fe3c, 0x0100fe3e, 0x0100fe3f,
+        0x0100fe42, 0x0100fe43, 0x0100fe45, 0x0500fe48, 0x06300200, 0x06310200,
+        0x06320200, 0x06610200, 0x06630200, 0x06650200, 0x06690200, 0x066f0200,
+        0x06730200, 0x06740200, 0x0100020d, 0x0100020e, 0x01000211, 0x01000212,
+        0x01000214, 0x01000215, 0x0100021a, 0x0100021b, 0x0100021d, 0x0100021e,
+        0x01000221, 0x01000222, 0x01000224, 0x01000225, 0x0100022b, 0x0100022e,
+        0x01000232, 0x01000235, 0x0100023a, 0x0100023d, 0x01000241, 0x05000244,
+        0x06300300, 0x06310300, 0x06320300, 0x06610300, 0x06630300, 0x06650300,
+        0x06690300, 0x066f0300, 0x06730300, 0x06740300, 0x0100030d, 0x0100030e,
+        0x01000311, 0x01000312, 0x01000314, 0x01000315, 0x0100031a, 0x0100031b,
+        0x0100031d, 0x0100031e, 0x01000321, 0x01000322, 0x01000324, 0x01000325,
+        0x0100032b, 0x0100032e, 0x01000332, 0x01000335, 0x0100033a, 0x0100033d,
+        0x01000341, 0x05000344, 0x06300400, 0x06310400, 0x06320400, 0x06610400,
+        0x06630400, 0x06650400, 0x06690400, 0x066f0400, 0x06730400, 0x06740400,
+        0x0100040d, 0x0100040e, 0x01000411, 0x01000412, 0x01000414, 0x01000415,
+        0x0100041a, 0x0100041b, 0x0100041d, 0x0100041e, 0x01000421, 0x01000422,
+        0x01000424, 0x01000425, 0x0100042b, 0x0100042e, 0x01000432, 0x01000435,
+        0x0100043a, 0x0100043d, 0x01000441, 0x05000444, 0x06300500, 0x06310500,
+        0x06320500, 0x06610500, 0x06630500, 0x06650500, 0x06690500, 0x066f0500,
+        0x06730500, 0x06740500, 0x0100050d, 0x0100050e, 0x01000511, 0x01000512,
+        0x01000514, 0x01000515, 0x0100051a, 0x0100051b, 0x0100051d, 0x0100051e,
+        0x01000521, 0x01000522, 0x01000524, 0x01000525, 0x0100052b, 0x0100052e,
+        0x01000532, 0x01000535, 0x0100053a, 0x0100053d, 0x01000541, 0x05000544,
+        0x06300600, 0x06310600, 0x06320600, 0x06610600, 0x06630600, 0x06650600,
+        0x06690600, 0x066f0600, 0x06730600, 0x06740600, 0x0100060d, 0x0100060e,
+        0x01000611, 0x01000612, 0x01000614, 0x01000615, 0x0100061a, 0x0100061b,
+        0x0100061d, 0x0100061e, 0x01000621, 0x01000622, 0x01000624, 0x01000625,
+        0x0100062b, 0x0100062e, 0x01000632, 0x01000635, 0x0100063a, 0x0100063d,
+        0x01000641, 0x05000644, 0x06300700, 0x06310700, 0x06320700, 0x06610700,
+        0x06630700, 0x06650700, 0x06690700, 0x066f0700, 0x06730700, 0x06740700,
+        0x0100070d, 0x0100070e, 0x01000711, 0x01000712, 0x01000714, 0x01000715,
+        0x0100071a, 0x0100071b, 0x0100071d, 0x0100071e, 0x01000721, 0x01000722,
+        0x01000724, 0x01000725, 0x0100072b, 0x0100072e, 0x01000732, 0x01000735,
+        0x0100073a, 0x0100073d, 0x01000741, 0x05000744
+    },
+    /* 226 */
+    {
+        0x0230fe02, 0x0230fe09, 0x0230fe17, 0x0630fe28, 0x0231fe02, 0x0231fe09,
+        0x0231fe17, 0x0631fe28, 0x0232fe02, 0x0232fe09, 0x0232fe17, 0x0632fe28,
+        0x0261fe02, 0x0261fe09, 0x0261fe17, 0x0661fe28, 0x0263fe02, 0x0263fe09,
+        0x0263fe17, 0x0663fe28, 0x0265fe02, 0x0265fe09, 0x0265fe17, 0x0665fe28,
+        0x0269fe02, 0x0269fe09, 0x0269fe17, 0x0669fe28, 0x026ffe02, 0x026ffe09,
+        0x026ffe17, 0x066ffe28, 0x0273fe02, 0x0273fe09, 0x0273fe17, 0x0673fe28,
+        0x0274fe02, 0x0274fe09, 0x0274fe17, 0x0674fe28, 0x0220fe01, 0x0620fe16,
+        0x0225fe01, 0x0625fe16, 0x022dfe01, 0x062dfe16, 0x022efe01, 0x062efe16,
+        0x022ffe01, 0x062ffe16, 0x0233fe01, 0x0633fe16, 0x0234fe01, 0x0634fe16,
+        0x0235fe01, 0x0635fe16, 0x0236fe01, 0x0636fe16, 0x0237fe01, 0x0637fe16,
+        0x0238fe01, 0x0638fe16, 0x0239fe01, 0x0639fe16, 0x023dfe01, 0x063dfe16,
+        0x0241fe01, 0x0641fe16, 0x025ffe01, 0x065ffe16, 0x0262fe01, 0x0662fe16,
+        0x0264fe01, 0x0664fe16, 0x0266fe01, 0x0666fe16, 0x0267fe01, 0x0667fe16,
+        0x0268fe01, 0x0668fe16, 0x026cfe01, 0x066cfe16, 0x026dfe01, 0x066dfe16,
+        0x026efe01, 0x066efe16, 0x0270fe01, 0x0670fe16, 0x0272fe01, 0x0672fe16,
+        0x0275fe01, 0x0675fe16, 0x063afe00, 0x0642fe00, 0x0643fe00, 0x0644fe00,
+        0x0645fe00, 0x0646fe00, 0x0647fe00, 0x0648fe00, 0x0649fe00, 0x064afe00,
+        0x064bfe00, 0x064cfe00, 0x064dfe00, 0x064efe00, 0x064ffe00, 0x0650fe00,
+        0x0651fe00, 0x0652fe00, 0x0653fe00, 0x0654fe00, 0x0655fe00, 0x0656fe00,
+        0x0657fe00, 0x0659fe00, 0x066afe00, 0x066bfe00, 0x0671fe00, 0x0676fe00,
+        0x0677fe00, 0x0678fe00, 0x0679fe00, 0x067afe00, 0x0100fe46, 0x0100fe47,
+        0x0100fe49, 0x0500fe4a, 0x02300201, 0x06300216, 0x02310201, 0x06310216,
+        0x02320201, 0x06320216, 0x02610201, 0x06610216, 0x02630201, 0x06630216,
+        0x02650201, 0x06650216, 0x02690201, 0x06690216, 0x026f0201, 0x066f0216,
+        0x02730201, 0x06730216, 0x02740201, 0x06740216, 0x06200200, 0x06250200,
+        0x062d0200, 0x062e0200, 0x062f0200, 0x06330200, 0x06340200, 0x06350200,
+        0x06360200, 0x06370200, 0x06380200, 0x06390200, 0x063d0200, 0x06410200,
+        0x065f0200, 0x06620200, 0x06640200, 0x06660200, 0x06670200, 0x06680200,
+        0x066c0200, 0x066d0200, 0x066e0200, 0x06700200, 0x06720200, 0x06750200,
+        0x01000226, 0x01000227, 0x0100022c, 0x0100022d, 0x0100022f, 0x01000230,
+        0x01000233, 0x01000234, 0x01000236, 0x01000237, 0x0100023b, 0x0100023c,
+        0x0100023e, 0x0100023f, 0x01000242, 0x01000243, 0x01000245, 0x05000248,
+        0x02300301, 0x06300316, 0x02310301, 0x06310316, 0x02320301, 0x06320316,
+        0x02610301, 0x06610316, 0x02630301, 0x06630316, 0x02650301, 0x06650316,
+        0x02690301, 0x06690316, 0x026f0301, 0x066f0316, 0x02730301, 0x06730316,
+        0x02740301, 0x06740316, 0x06200300, 0x06250300, 0x062d0300, 0x062e0300,
+        0x062f0300, 0x06330300, 0x06340300, 0x06350300, 0x06360300, 0x06370300,
+        0x06380300, 0x06390300, 0x063d0300, 0x06410300, 0x065f0300, 0x06620300,
+        0x06640300, 0x06660300, 0x06670300, 0x06680300, 0x066c0300, 0x066d0300,
+        0x066e0300, 0x06700300, 0x06720300, 0x06750300, 0x01000326, 0x01000327,
+        0x0100032c, 0x0100032d, 0x0100032f, 0x01000330, 0x01000333, 0x01000334,
+        0x01000336, 0x01000337, 0x0100033b, 0x0100033c, 0x0100033e, 0x0100033f,
+        0x01000342, 0x01000343, 0x01000345, 0x05000348
+    },
+    /* 227 */
+    {
+        0x02300202, 0x02300209, 0x02300217, 0x06300228, 0x02310202, 0x02310209,
+        0x02310217, 0x06310228, 0x02320202, 0x02320209, 0x02320217, 0x06320228,
+        0x02610202, 0x02610209, 0x02610217, 0x06610228, 0x02630202, 0x02630209,
+        0x02630217, 0x06630228, 0x02650202, 0x02650209, 0x02650217, 0x06650228,
+        0x02690202, 0x02690209, 0x02690217, 0x06690228, 0x026f0202, 0x026f0209,
+        0x026f0217, 0x066f0228, 0x02730202, 0x02730209, 0x02730217, 0x06730228,
+        0x02740202, 0x02740209, 0x02740217, 0x06740228, 0x02200201, 0x06200216,
+        0x02250201, 0x06250216, 0x022d0201, 0x062d0216, 0x022e0201, 0x062e0216,
+        0x022f0201, 0x062f0216, 0x02330201, 0x06330216, 0x02340201, 0x06340216,
+        0x02350201, 0x06350216, 0x02360201, 0x06360216, 0x02370201, 0x06370216,
+        0x02380201, 0x06380216, 0x02390201, 0x06390216, 0x023d0201, 0x063d0216,
+        0x02410201, 0x06410216, 0x025f0201, 0x065f0216, 0x02620201, 0x06620216,
+        0x02640201, 0x06640216, 0x02660201, 0x06660216, 0x02670201, 0x06670216,
+        0x02680201, 0x06680216, 0x026c0201, 0x066c0216, 0x026d0201, 0x066d0216,
+        0x026e0201, 0x066e0216, 0x02700201, 0x06700216, 0x02720201, 0x06720216,
+        0x02750201, 0x06750216, 0x063a0200, 0x06420200, 0x06430200, 0x06440200,
+        0x06450200, 0x06460200, 0x06470200, 0x06480200, 0x06490200, 0x064a0200,
+        0x064b0200, 0x064c0200, 0x064d0200, 0x064e0200, 0x064f0200, 0x06500200,
+        0x06510200, 0x06520200, 0x06530200, 0x06540200, 0x06550200, 0x06560200,
+        0x06570200, 0x06590200, 0x066a0200, 0x066b0200, 0x06710200, 0x06760200,
+        0x06770200, 0x06780200, 0x06790200, 0x067a0200, 0x01000246, 0x01000247,
+        0x01000249, 0x0500024a, 0x02300302, 0x02300309, 0x02300317, 0x06300328,
+        0x02310302, 0x02310309, 0x02310317, 0x06310328, 0x02320302, 0x02320309,
+        0x02320317, 0x06320328, 0x02610302, 0x02610309, 0x02610317, 0x06610328,
+        0x02630302, 0x02630309, 0x02630317, 0x06630328, 0x02650302, 0x02650309,
+        0x02650317, 0x06650328, 0x02690302, 0x02690309, 0x02690317, 0x06690328,
+        0x026f0302, 0x026f0309, 0x026f0317, 0x066f0328, 0x02730302, 0x02730309,
+        0x02730317, 0x06730328, 0x02740302, 0x02740309, 0x02740317, 0x06740328,
+        0x02200301, 0x06200316, 0x02250301, 0x06250316, 0x022d0301, 0x062d0316,
+        0x022e0301, 0x062e0316, 0x022f0301, 0x062f0316, 0x02330301, 0x06330316,
+        0x02340301, 0x06340316, 0x02350301, 0x06350316, 0x02360301, 0x06360316,
+        0x02370301, 0x06370316, 0x02380301, 0x06380316, 0x02390301, 0x06390316,
+        0x023d0301, 0x063d0316, 0x02410301, 0x06410316, 0x025f0301, 0x065f0316,
+        0x02620301, 0x06620316, 0x02640301, 0x06640316, 0x02660301, 0x06660316,
+        0x02670301, 0x06670316, 0x02680301, 0x06680316, 0x026c0301, 0x066c0316,
+        0x026d0301, 0x066d0316, 0x026e0301, 0x066e0316, 0x02700301, 0x06700316,
+        0x02720301, 0x06720316, 0x02750301, 0x06750316, 0x063a0300, 0x06420300,
+        0x06430300, 0x06440300, 0x06450300, 0x06460300, 0x06470300, 0x06480300,
+        0x06490300, 0x064a0300, 0x064b0300, 0x064c0300, 0x064d0300, 0x064e0300,
+        0x064f0300, 0x06500300, 0x06510300, 0x06520300, 0x06530300, 0x06540300,
+        0x06550300, 0x06560300, 0x06570300, 0x06590300, 0x066a0300, 0x066b0300,
+        0x06710300, 0x06760300, 0x06770300, 0x06780300, 0x06790300, 0x067a0300,
+        0x01000346, 0x01000347, 0x01000349, 0x0500034a
+    },
+    /* 228 */
+    {
+        0x02300401, 0x06300416, 0x02310401, 0x06310416, 0x02320401, 0x06320416,
+        0x02610401, 0x06610416, 0x02630401, 0x06630416, 0x02650401, 0x06650416,
+        0x02690401, 0x06690416, 0x026f0401, 0x066f0416, 0x02730401, 0x06730416,
+        0x02740401, 0x06740416, 0x06200400, 0x06250400, 0x062d0400, 0x062e0400,
+        0x062f0400, 0x06330400, 0x06340400, 0x06350400, 0x06360400, 0x06370400,
+        0x06380400, 0x06390400, 0x063d0400, 0x06410400, 0x065f0400, 0x06620400,
+        0x06640400, 0x06660400, 0x06670400, 0x06680400, 0x066c0400, 0x066d0400,
+        0x066e0400, 0x06700400, 0x06720400, 0x06750400, 0x01000426, 0x01000427,
+        0x0100042c, 0x0100042d, 0x0100042f, 0x01000430, 0x01000433, 0x01000434,
+        0x01000436, 0x01000437, 0x0100043b, 0x0100043c, 0x0100043e, 0x0100043f,
+        0x01000442, 0x01000443, 0x01000445, 0x05000448, 0x02300501, 0x06300516,
+        0x02310501, 0x06310516, 0x02320501, 0x06320516, 0x02610501, 0x06610516,
+        0x02630501, 0x06630516, 0x02650501, 0x06650516, 0x02690501, 0x06690516,
+        0x026f0501, 0x066f0516, 0x02730501, 0x06730516, 0x02740501, 0x06740516,
+        0x06200500, 0x06250500, 0x062d0500, 0x062e0500, 0x062f0500, 0x06330500,
+        0x06340500, 0x06350500, 0x06360500, 0x06370500, 0x06380500, 0x06390500,
+        0x063d0500, 0x06410500, 0x065f0500, 0x06620500, 0x06640500, 0x06660500,
+        0x06670500, 0x06680500, 0x066c0500, 0x066d0500, 0x066e0500, 0x06700500,
+        0x06720500, 0x06750500, 0x01000526, 0x01000527, 0x0100052c, 0x0100052d,
+        0x0100052f, 0x01000530, 0x01000533, 0x01000534, 0x01000536, 0x01000537,
+        0x0100053b, 0x0100053c, 0x0100053e, 0x0100053f, 0x01000542, 0x01000543,
+        0x01000545, 0x05000548, 0x02300601, 0x06300616, 0x02310601, 0x06310616,
+        0x02320601, 0x06320616, 0x02610601, 0x06610616, 0x02630601, 0x06630616,
+        0x02650601, 0x06650616, 0x02690601, 0x06690616, 0x026f0601, 0x066f0616,
+        0x02730601, 0x06730616, 0x02740601, 0x06740616, 0x06200600, 0x06250600,
+        0x062d0600, 0x062e0600, 0x062f0600, 0x06330600, 0x06340600, 0x06350600,
+        0x06360600, 0x06370600, 0x06380600, 0x06390600, 0x063d0600, 0x06410600,
+        0x065f0600, 0x06620600, 0x06640600, 0x06660600, 0x06670600, 0x06680600,
+        0x066c0600, 0x066d0600, 0x066e0600, 0x06700600, 0x06720600, 0x06750600,
+        0x01000626, 0x01000627, 0x0100062c, 0x0100062d, 0x0100062f, 0x01000630,
+        0x01000633, 0x01000634, 0x01000636, 0x01000637, 0x0100063b, 0x0100063c,
+        0x0100063e, 0x0100063f, 0x01000642, 0x01000643, 0x01000645, 0x05000648,
+        0x02300701, 0x06300716, 0x02310701, 0x06310716, 0x02320701, 0x06320716,
+        0x02610701, 0x06610716, 0x02630701, 0x06630716, 0x02650701, 0x06650716,
+        0x02690701, 0x06690716, 0x026f0701, 0x066f0716, 0x02730701, 0x06730716,
+        0x02740701, 0x06740716, 0x06200700, 0x06250700, 0x062d0700, 0x062e0700,
+        0x062f0700, 0x06330700, 0x06340700, 0x06350700, 0x06360700, 0x06370700,
+        0x06380700, 0x06390700, 0x063d0700, 0x06410700, 0x065f0700, 0x06620700,
+        0x06640700, 0x06660700, 0x06670700, 0x06680700, 0x066c0700, 0x066d0700,
+        0x066e0700, 0x06700700, 0x06720700, 0x06750700, 0x01000726, 0x01000727,
+        0x0100072c, 0x0100072d, 0x0100072f, 0x01000730, 0x01000733, 0x01000734,
+        0x01000736, 0x01000737, 0x0100073b, 0x0100073c, 0x0100073e, 0x0100073f,
+        0x01000742, 0x01000743, 0x01000745, 0x05000748
+    },
+    /* 229 */
+    {
+        0x02300402, 0x02300409, 0x02300417, 0x06300428, 0x02310402, 0x02310409,
+        0x02310417, 0x06310428, 0x02320402, 0x02320409, 0x02320417, 0x06320428,
+        0x02610402, 0x02610409, 0x02610417, 0x06610428, 0x02630402, 0x02630409,
+        0x02630417, 0x06630428, 0x02650402, 0x02650409, 0x02650417, 0x06650428,
+        0x02690402, 0x02690409, 0x02690417, 0x06690428, 0x026f0402, 0x026f0409,
+        0x026f0417, 0x066f0428, 0x02730402, 0x02730409, 0x02730417, 0x06730428,
+        0x02740402, 0x02740409, 0x02740417, 0x06740428, 0x02200401, 0x06200416,
+        0x02250401, 0x06250416, 0x022d0401, 0x062d0416, 0x022e0401, 0x062e0416,
+        0x022f0401, 0x062f0416, 0x02330401, 0x06330416, 0x02340401, 0x06340416,
+        0x02350401, 0x06350416, 0x02360401, 0x06360416, 0x02370401, 0x06370416,
+        0x02380401, 0x06380416, 0x02390401, 0x06390416, 0x023d0401, 0x063d0416,
+        0x02410401, 0x06410416, 0x025f0401, 0x065f0416, 0x02620401, 0x06620416,
+        0x02640401, 0x06640416, 0x02660401, 0x06660416, 0x02670401, 0x06670416,
+        0x02680401, 0x06680416, 0x026c0401, 0x066c0416, 0x026d0401, 0x066d0416,
+        0x026e0401, 0x066e0416, 0x02700401, 0x06700416, 0x02720401, 0x06720416,
+        0x02750401, 0x06750416, 0x063a0400, 0x06420400, 0x06430400, 0x06440400,
+        0x06450400, 0x06460400, 0x06470400, 0x06480400, 0x06490400, 0x064a0400,
+        0x064b0400, 0x064c0400, 0x064d0400, 0x064e0400, 0x064f0400, 0x06500400,
+        0x06510400, 0x06520400, 0x06530400, 0x06540400, 0x06550400, 0x06560400,
+        0x06570400, 0x06590400, 0x066a0400, 0x066b0400, 0x06710400, 0x06760400,
+        0x06770400, 0x06780400, 0x06790400, 0x067a0400, 0x01000446, 0x01000447,
+        0x01000449, 0x0500044a, 0x02300502, 0x02300509, 0x02300517, 0x06300528,
+        0x02310502, 0x02310509, 0x02310517, 0x06310528, 0x02320502, 0x02320509,
+        0x02320517, 0x06320528, 0x02610502, 0x02610509, 0x02610517, 0x06610528,
+        0x02630502, 0x02630509, 0x02630517, 0x06630528, 0x02650502, 0x02650509,
+        0x02650517, 0x06650528, 0x02690502, 0x02690509, 0x02690517, 0x06690528,
+        0x026f0502, 0x026f0509, 0x026f0517, 0x066f0528, 0x02730502, 0x02730509,
+        0x02730517, 0x06730528, 0x02740502, 0x02740509, 0x02740517, 0x06740528,
+        0x02200501, 0x06200516, 0x02250501, 0x06250516, 0x022d0501, 0x062d0516,
+        0x022e0501, 0x062e0516, 0x022f0501, 0x062f0516, 0x02330501, 0x06330516,
+        0x02340501, 0x06340516, 0x02350501, 0x06350516, 0x02360501, 0x06360516,
+        0x02370501, 0x06370516, 0x02380501, 0x06380516, 0x02390501, 0x06390516,
+        0x023d0501, 0x063d0516, 0x02410501, 0x06410516, 0x025f0501, 0x065f0516,
+        0x02620501, 0x06620516, 0x02640501, 0x06640516, 0x02660501, 0x06660516,
+        0x02670501, 0x06670516, 0x02680501, 0x06680516, 0x026c0501, 0x066c0516,
+        0x026d0501, 0x066d0516, 0x026e0501, 0x066e0516, 0x02700501, 0x06700516,
+        0x02720501, 0x06720516, 0x02750501, 0x06750516, 0x063a0500, 0x06420500,
+        0x06430500, 0x06440500, 0x06450500, 0x06460500, 0x06470500, 0x06480500,
+        0x06490500, 0x064a0500, 0x064b0500, 0x064c0500, 0x064d0500, 0x064e0500,
+        0x064f0500, 0x06500500, 0x06510500, 0x06520500, 0x06530500, 0x06540500,
+        0x06550500, 0x06560500, 0x06570500, 0x06590500, 0x066a0500, 0x066b0500,
+        0x06710500, 0x06760500, 0x06770500, 0x06780500, 0x06790500, 0x067a0500,
+        0x01000546, 0x01000547, 0x01000549, 0x0500054a
+    },
+    /* 230 */
+    {
+        0x02300602, 0x02300609, 0x02300617, 0x06300628, 0x02310602, 0x02310609,
+        0x02310617, 0x06310628, 0x02320602, 0x02320609, 0x02320617, 0x06320628,
+        0x02610602, 0x02610609, 0x02610617, 0x06610628, 0x02630602, 0x02630609,
+        0x02630617, 0x06630628, 0x02650602, 0x02650609, 0x02650617, 0x06650628,
+        0x02690602, 0x02690609, 0x02690617, 0x06690628, 0x026f0602, 0x026f0609,
+        0x026f0617, 0x066f0628, 0x02730602, 0x02730609, 0x02730617, 0x06730628,
+        0x02740602, 0x02740609, 0x02740617, 0x06740628, 0x02200601, 0x06200616,
+        0x02250601, 0x06250616, 0x022d0601, 0x062d0616, 0x022e0601, 0x062e0616,
+        0x022f0601, 0x062f0616, 0x02330601, 0x06330616, 0x02340601, 0x06340616,
+        0x02350601, 0x06350616, 0x02360601, 0x06360616, 0x02370601, 0x06370616,
+        0x02380601, 0x06380616, 0x02390601, 0x06390616, 0x023d0601, 0x063d0616,
+        0x02410601, 0x06410616, 0x025f0601, 0x065f0616, 0x02620601, 0x06620616,
+        0x02640601, 0x06640616, 0x02660601, 0x06660616, 0x02670601, 0x06670616,
+        0x02680601, 0x06680616, 0x026c0601, 0x066c0616, 0x026d0601, 0x066d0616,
+        0x026e0601, 0x066e0616, 0x02700601, 0x06700616, 0x02720601, 0x06720616,
+        0x02750601, 0x06750616, 0x063a0600, 0x06420600, 0x06430600, 0x06440600,
+        0x06450600, 0x06460600, 0x06470600, 0x06480600, 0x06490600, 0x064a0600,
+        0x064b0600, 0x064c0600, 0x064d0600, 0x064e0600, 0x064f0600, 0x06500600,
+        0x06510600, 0x06520600, 0x06530600, 0x06540600, 0x06550600, 0x06560600,
+        0x06570600, 0x06590600, 0x066a0600, 0x066b0600, 0x06710600, 0x06760600,
+        0x06770600, 0x06780600, 0x06790600, 0x067a0600, 0x01000646, 0x01000647,
+        0x01000649, 0x0500064a, 0x02300702, 0x02300709, 0x02300717, 0x06300728,
+        0x02310702, 0x02310709, 0x02310717, 0x06310728, 0x02320702, 0x02320709,
+        0x02320717, 0x06320728, 0x02610702, 0x02610709, 0x02610717, 0x06610728,
+        0x02630702, 0x02630709, 0x02630717, 0x06630728, 0x02650702, 0x02650709,
+        0x02650717, 0x06650728, 0x02690702, 0x02690709, 0x02690717, 0x06690728,
+        0x026f0702, 0x026f0709, 0x026f0717, 0x066f0728, 0x02730702, 0x02730709,
+        0x02730717, 0x06730728, 0x02740702, 0x02740709, 0x02740717, 0x06740728,
+        0x02200701, 0x06200716, 0x02250701, 0x06250716, 0x022d0701, 0x062d0716,
+        0x022e0701, 0x062e0716, 0x022f0701, 0x062f0716, 0x02330701, 0x06330716,
+        0x02340701, 0x06340716, 0x02350701, 0x06350716, 0x02360701, 0x06360716,
+        0x02370701, 0x06370716, 0x02380701, 0x06380716, 0x02390701, 0x06390716,
+        0x023d0701, 0x063d0716, 0x02410701, 0x06410716, 0x025f0701, 0x065f0716,
+        0x02620701, 0x06620716, 0x02640701, 0x06640716, 0x02660701, 0x06660716,
+        0x02670701, 0x06670716, 0x02680701, 0x06680716, 0x026c0701, 0x066c0716,
+        0x026d0701, 0x066d0716, 0x026e0701, 0x066e0716, 0x02700701, 0x06700716,
+        0x02720701, 0x06720716, 0x02750701, 0x06750716, 0x063a0700, 0x06420700,
+        0x06430700, 0x06440700, 0x06450700, 0x06460700, 0x06470700, 0x06480700,
+        0x06490700, 0x064a0700, 0x064b0700, 0x064c0700, 0x064d0700, 0x064e0700,
+        0x064f0700, 0x06500700, 0x06510700, 0x06520700, 0x06530700, 0x06540700,
+        0x06550700, 0x06560700, 0x06570700, 0x06590700, 0x066a0700, 0x066b0700,
+        0x06710700, 0x06760700, 0x06770700, 0x06780700, 0x06790700, 0x067a0700,
+        0x01000746, 0x01000747, 0x01000749, 0x0500074a
+    },
+    /* 231 */
+    {
+        0x06300800, 0x06310800, 0x06320800, 0x06610800, 0x06630800, 0x06650800,
+        0x06690800, 0x066f0800, 0x06730800, 0x06740800, 0x0100080d, 0x0100080e,
+        0x01000811, 0x01000812, 0x01000814, 0x01000815, 0x0100081a, 0x0100081b,
+        0x0100081d, 0x0100081e, 0x01000821, 0x01000822, 0x01000824, 0x01000825,
+        0x0100082b, 0x0100082e, 0x01000832, 0x01000835, 0x0100083a, 0x0100083d,
+        0x01000841, 0x05000844, 0x06300b00, 0x06310b00, 0x06320b00, 0x06610b00,
+        0x06630b00, 0x06650b00, 0x06690b00, 0x066f0b00, 0x06730b00, 0x06740b00,
+        0x01000b0d, 0x01000b0e, 0x01000b11, 0x01000b12, 0x01000b14, 0x01000b15,
+        0x01000b1a, 0x01000b1b, 0x01000b1d, 0x01000b1e, 0x01000b21, 0x01000b22,
+        0x01000b24, 0x01000b25, 0x01000b2b, 0x01000b2e, 0x01000b32, 0x01000b35,
+        0x01000b3a, 0x01000b3d, 0x01000b41, 0x05000b44, 0x06300c00, 0x06310c00,
+        0x06320c00, 0x06610c00, 0x06630c00, 0x06650c00, 0x06690c00, 0x066f0c00,
+        0x06730c00, 0x06740c00, 0x01000c0d, 0x01000c0e, 0x01000c11, 0x01000c12,
+        0x01000c14, 0x01000c15, 0x01000c1a, 0x01000c1b, 0x01000c1d, 0x01000c1e,
+        0x01000c21, 0x01000c22, 0x01000c24, 0x01000c25, 0x01000c2b, 0x01000c2e,
+        0x01000c32, 0x01000c35, 0x01000c3a, 0x01000c3d, 0x01000c41, 0x05000c44,
+        0x06300e00, 0x06310e00, 0x06320e00, 0x06610e00, 0x06630e00, 0x06650e00,
+        0x06690e00, 0x066f0e00, 0x06730e00, 0x06740e00, 0x01000e0d, 0x01000e0e,
+        0x01000e11, 0x01000e12, 0x01000e14, 0x01000e15, 0x01000e1a, 0x01000e1b,
+        0x01000e1d, 0x01000e1e, 0x01000e21, 0x01000e22, 0x01000e24, 0x01000e25,
+        0x01000e2b, 0x01000e2e, 0x01000e32, 0x01000e35, 0x01000e3a, 0x01000e3d,
+        0x01000e41, 0x05000e44, 0x06300f00, 0x06310f00, 0x06320f00, 0x06610f00,
+        0x06630f00, 0x06650f00, 0x06690f00, 0x066f0f00, 0x06730f00, 0x06740f00,
+        0x01000f0d, 0x01000f0e, 0x01000f11, 0x01000f12, 0x01000f14, 0x01000f15,
+        0x01000f1a, 0x01000f1b, 0x01000f1d, 0x01000f1e, 0x01000f21, 0x01000f22,
+        0x01000f24, 0x01000f25, 0x01000f2b, 0x01000f2e, 0x01000f32, 0x01000f35,
+        0x01000f3a, 0x01000f3d, 0x01000f41, 0x05000f44, 0x06301000, 0x06311000,
+        0x06321000, 0x06611000, 0x06631000, 0x06651000, 0x06691000, 0x066f1000,
+        0x06731000, 0x06741000, 0x0100100d, 0x0100100e, 0x01001011, 0x01001012,
+        0x01001014, 0x01001015, 0x0100101a, 0x0100101b, 0x0100101d, 0x0100101e,
+        0x01001021, 0x01001022, 0x01001024, 0x01001025, 0x0100102b, 0x0100102e,
+        0x01001032, 0x01001035, 0x0100103a, 0x0100103d, 0x01001041, 0x05001044,
+        0x06301100, 0x06311100, 0x06321100, 0x06611100, 0x06631100, 0x06651100,
+        0x06691100, 0x066f1100, 0x06731100, 0x06741100, 0x0100110d, 0x0100110e,
+        0x01001111, 0x01001112, 0x01001114, 0x01001115, 0x0100111a, 0x0100111b,
+        0x0100111d, 0x0100111e, 0x01001121, 0x01001122, 0x01001124, 0x01001125,
+        0x0100112b, 0x0100112e, 0x01001132, 0x01001135, 0x0100113a, 0x0100113d,
+        0x01001141, 0x05001144, 0x06301200, 0x06311200, 0x06321200, 0x06611200,
+        0x06631200, 0x06651200, 0x06691200, 0x066f1200, 0x06731200, 0x06741200,
+        0x0100120d, 0x0100120e, 0x01001211, 0x01001212, 0x01001214, 0x01001215,
+        0x0100121a, 0x0100121b, 0x0100121d, 0x0100121e, 0x01001221, 0x01001222,
+        0x01001224, 0x01001225, 0x0100122b, 0x0100122e, 0x01001232, 0x01001235,
+        0x0100123a, 0x0100123d, 0x01001241, 0x05001244
+    },
+    /* 232 */
+    {
+        0x02300801, 0x06300816, 0x02310801, 0x06310816, 0x02320801, 0x06320816,
+        0x02610801, 0x06610816, 0x02630801, 0x06630816, 0x02650801, 0x06650816,
+        0x02690801, 0x06690816, 0x026f0801, 0x066f0816, 0x02730801, 0x06730816,
+        0x02740801, 0x06740816, 0x06200800, 0x06250800, 0x062d0800, 0x062e0800,
+        0x062f0800, 0x06330800, 0x06340800, 0x06350800, 0x06360800, 0x06370800,
+        0x06380800, 0x06390800, 0x063d0800, 0x06410800, 0x065f0800, 0x06620800,
+        0x06640800, 0x06660800, 0x06670800, 0x06680800, 0x066c0800, 0x066d0800,
+        0x066e0800, 0x06700800, 0x06720800, 0x06750800, 0x01000826, 0x01000827,
+        0x0100082c, 0x0100082d, 0x0100082f, 0x01000830, 0x01000833, 0x01000834,
+        0x01000836, 0x01000837, 0x0100083b, 0x0100083c, 0x0100083e, 0x0100083f,
+        0x01000842, 0x01000843, 0x01000845, 0x05000848, 0x02300b01, 0x06300b16,
+        0x02310b01, 0x06310b16, 0x02320b01, 0x06320b16, 0x02610b01, 0x06610b16,
+        0x02630b01, 0x06630b16, 0x02650b01, 0x06650b16, 0x02690b01, 0x06690b16,
+        0x026f0b01, 0x066f0b16, 0x02730b01, 0x06730b16, 0x02740b01, 0x06740b16,
+        0x06200b00, 0x06250b00, 0x062d0b00, 0x062e0b00, 0x062f0b00, 0x06330b00,
+        0x06340b00, 0x06350b00, 0x06360b00, 0x06370b00, 0x06380b00, 0x06390b00,
+        0x063d0b00, 0x06410b00, 0x065f0b00, 0x06620b00, 0x06640b00, 0x06660b00,
+        0x06670b00, 0x06680b00, 0x066c0b00, 0x066d0b00, 0x066e0b00, 0x06700b00,
+        0x06720b00, 0x06750b00, 0x01000b26, 0x01000b27, 0x01000b2c, 0x01000b2d,
+        0x01000b2f, 0x01000b30, 0x01000b33, 0x01000b34, 0x01000b36, 0x01000b37,
+        0x01000b3b, 0x01000b3c, 0x01000b3e, 0x01000b3f, 0x01000b42, 0x01000b43,
+        0x01000b45, 0x05000b48, 0x02300c01, 0x06300c16, 0x02310c01, 0x06310c16,
+        0x02320c01, 0x06320c16, 0x02610c01, 0x06610c16, 0x02630c01, 0x06630c16,
+        0x02650c01, 0x06650c16, 0x02690c01, 0x06690c16, 0x026f0c01, 0x066f0c16,
+        0x02730c01, 0x06730c16, 0x02740c01, 0x06740c16, 0x06200c00, 0x06250c00,
+        0x062d0c00, 0x062e0c00, 0x062f0c00, 0x06330c00, 0x06340c00, 0x06350c00,
+        0x06360c00, 0x06370c00, 0x06380c00, 0x06390c00, 0x063d0c00, 0x06410c00,
+        0x065f0c00, 0x06620c00, 0x06640c00, 0x06660c00, 0x06670c00, 0x06680c00,
+        0x066c0c00, 0x066d0c00, 0x066e0c00, 0x06700c00, 0x06720c00, 0x06750c00,
+        0x01000c26, 0x01000c27, 0x01000c2c, 0x01000c2d, 0x01000c2f, 0x01000c30,
+        0x01000c33, 0x01000c34, 0x01000c36, 0x01000c37, 0x01000c3b, 0x01000c3c,
+        0x01000c3e, 0x01000c3f, 0x01000c42, 0x01000c43, 0x01000c45, 0x05000c48,
+        0x02300e01, 0x06300e16, 0x02310e01, 0x06310e16, 0x02320e01, 0x06320e16,
+        0x02610e01, 0x06610e16, 0x02630e01, 0x06630e16, 0x02650e01, 0x06650e16,
+        0x02690e01, 0x06690e16, 0x026f0e01, 0x066f0e16, 0x02730e01, 0x06730e16,
+        0x02740e01, 0x06740e16, 0x06200e00, 0x06250e00, 0x062d0e00, 0x062e0e00,
+        0x062f0e00, 0x06330e00, 0x06340e00, 0x06350e00, 0x06360e00, 0x06370e00,
+        0x06380e00, 0x06390e00, 0x063d0e00, 0x06410e00, 0x065f0e00, 0x06620e00,
+        0x06640e00, 0x06660e00, 0x06670e00, 0x06680e00, 0x066c0e00, 0x066d0e00,
+        0x066e0e00, 0x06700e00, 0x06720e00, 0x06750e00, 0x01000e26, 0x01000e27,
+        0x01000e2c, 0x01000e2d, 0x01000e2f, 0x01000e30, 0x01000e33, 0x01000e34,
+        0x01000e36, 0x01000e37, 0x01000e3b, 0x01000e3c, 0x01000e3e, 0x01000e3f,
+        0x01000e42, 0x01000e43, 0x01000e45, 0x05000e48
+    },
+    /* 233 */
+    {
+        0x02300802, 0x02300809, 0x02300817, 0x06300828, 0x02310802, 0x02310809,
+        0x02310817, 0x06310828, 0x02320802, 0x02320809, 0x02320817, 0x06320828,
+        0x02610802, 0x02610809, 0x02610817, 0x06610828, 0x02630802, 0x02630809,
+        0x02630817, 0x06630828, 0x02650802, 0x02650809, 0x02650817, 0x06650828,
+        0x02690802, 0x02690809, 0x02690817, 0x06690828, 0x026f0802, 0x026f0809,
+        0x026f0817, 0x066f0828, 0x02730802, 0x02730809, 0x02730817, 0x06730828,
+        0x02740802, 0x02740809, 0x02740817, 0x06740828, 0x02200801, 0x06200816,
+        0x02250801, 0x06250816, 0x022d0801, 0x062d0816, 0x022e0801, 0x062e0816,
+        0x022f0801, 0x062f0816, 0x02330801, 0x06330816, 0x02340801, 0x06340816,
+        0x02350801, 0x06350816, 0x02360801, 0x06360816, 0x02370801, 0x06370816,
+        0x02380801, 0x06380816, 0x02390801, 0x06390816, 0x023d0801, 0x063d0816,
+        0x02410801, 0x06410816, 0x025f0801, 0x065f0816, 0x02620801, 0x06620816,
+        0x02640801, 0x06640816, 0x02660801, 0x06660816, 0x02670801, 0x06670816,
+        0x02680801, 0x06680816, 0x026c0801, 0x066c0816, 0x026d0801, 0x066d0816,
+        0x026e0801, 0x066e0816, 0x02700801, 0x06700816, 0x02720801, 0x06720816,
+        0x02750801, 0x06750816, 0x063a0800, 0x06420800, 0x06430800, 0x06440800,
+        0x06450800, 0x06460800, 0x06470800, 0x06480800, 0x06490800, 0x064a0800,
+        0x064b0800, 0x064c0800, 0x064d0800, 0x064e0800, 0x064f0800, 0x06500800,
+        0x06510800, 0x06520800, 0x06530800, 0x06540800, 0x06550800, 0x06560800,
+        0x06570800, 0x06590800, 0x066a0800, 0x066b0800, 0x06710800, 0x06760800,
+        0x06770800, 0x06780800, 0x06790800, 0x067a0800, 0x01000846, 0x01000847,
+        0x01000849, 0x0500084a, 0x02300b02, 0x02300b09, 0x02300b17, 0x06300b28,
+        0x02310b02, 0x02310b09, 0x02310b17, 0x06310b28, 0x02320b02, 0x02320b09,
+        0x02320b17, 0x06320b28, 0x02610b02, 0x02610b09, 0x02610b17, 0x06610b28,
+        0x02630b02, 0x02630b09, 0x02630b17, 0x06630b28, 0x02650b02, 0x02650b09,
+        0x02650b17, 0x06650b28, 0x02690b02, 0x02690b09, 0x02690b17, 0x06690b28,
+        0x026f0b02, 0x026f0b09, 0x026f0b17, 0x066f0b28, 0x02730b02, 0x02730b09,
+        0x02730b17, 0x06730b28, 0x02740b02, 0x02740b09, 0x02740b17, 0x06740b28,
+        0x02200b01, 0x06200b16, 0x02250b01, 0x06250b16, 0x022d0b01, 0x062d0b16,
+        0x022e0b01, 0x062e0b16, 0x022f0b01, 0x062f0b16, 0x02330b01, 0x06330b16,
+        0x02340b01, 0x06340b16, 0x02350b01, 0x06350b16, 0x02360b01, 0x06360b16,
+        0x02370b01, 0x06370b16, 0x02380b01, 0x06380b16, 0x02390b01, 0x06390b16,
+        0x023d0b01, 0x063d0b16, 0x02410b01, 0x06410b16, 0x025f0b01, 0x065f0b16,
+        0x02620b01, 0x06620b16, 0x02640b01, 0x06640b16, 0x02660b01, 0x06660b16,
+        0x02670b01, 0x06670b16, 0x02680b01, 0x06680b16, 0x026c0b01, 0x066c0b16,
+        0x026d0b01, 0x066d0b16, 0x026e0b01, 0x066e0b16, 0x02700b01, 0x06700b16,
+        0x02720b01, 0x06720b16, 0x02750b01, 0x06750b16, 0x063a0b00, 0x06420b00,
+        0x06430b00, 0x06440b00, 0x06450b00, 0x06460b00, 0x06470b00, 0x06480b00,
+        0x06490b00, 0x064a0b00, 0x064b0b00, 0x064c0b00, 0x064d0b00, 0x064e0b00,
+        0x064f0b00, 0x06500b00, 0x06510b00, 0x06520b00, 0x06530b00, 0x06540b00,
+        0x06550b00, 0x06560b00, 0x06570b00, 0x06590b00, 0x066a0b00, 0x066b0b00,
+        0x06710b00, 0x06760b00, 0x06770b00, 0x06780b00, 0x06790b00, 0x067a0b00,
+        0x01000b46, 0x01000b47, 0x01000b49, 0x05000b4a
+    },
+    /* 234 */
+    {
+        0x02300c02, 0x02300c09, 0x02300c17, 0x06300c28, 0x02310c02, 0x02310c09,
+        0x02310c17, 0x06310c28, 0x02320c02, 0x02320c09, 0x02320c17, 0x06320c28,
+        0x02610c02, 0x02610c09, 0x02610c17, 0x06610c28, 0x02630c02, 0x02630c09,
+        0x02630c17, 0x06630c28, 0x02650c02, 0x02650c09, 0x02650c17, 0x06650c28,
+        0x02690c02, 0x02690c09, 0x02690c17, 0x06690c28, 0x026f0c02, 0x026f0c09,
+        0x026f0c17, 0x066f0c28, 0x02730c02, 0x02730c09, 0x02730c17, 0x06730c28,
+        0x02740c02, 0x02740c09, 0x02740c17, 0x06740c28, 0x02200c01, 0x06200c16,
+        0x02250c01, 0x06250c16, 0x022d0c01, 0x062d0c16, 0x022e0c01, 0x062e0c16,
+        0x022f0c01, 0x062f0c16, 0x02330c01, 0x06330c16, 0x02340c01, 0x06340c16,
+        0x02350c01, 0x06350c16, 0x02360c01, 0x06360c16, 0x02370c01, 0x06370c16,
+        0x02380c01, 0x06380c16, 0x02390c01, 0x06390c16, 0x023d0c01, 0x063d0c16,
+        0x02410c01, 0x06410c16, 0x025f0c01, 0x065f0c16, 0x02620c01, 0x06620c16,
+        0x02640c01, 0x06640c16, 0x02660c01, 0x06660c16, 0x02670c01, 0x06670c16,
+        0x02680c01, 0x06680c16, 0x026c0c01, 0x066c0c16, 0x026d0c01, 0x066d0c16,
+        0x026e0c01, 0x066e0c16, 0x02700c01, 0x06700c16, 0x02720c01, 0x06720c16,
+        0x02750c01, 0x06750c16, 0x063a0c00, 0x06420c00, 0x06430c00, 0x06440c00,
+        0x06450c00, 0x06460c00, 0x06470c00, 0x06480c00, 0x06490c00, 0x064a0c00,
+        0x064b0c00, 0x064c0c00, 0x064d0c00, 0x064e0c00, 0x064f0c00, 0x06500c00,
+        0x06510c00, 0x06520c00, 0x06530c00, 0x06540c00, 0x06550c00, 0x06560c00,
+        0x06570c00, 0x06590c00, 0x066a0c00, 0x066b0c00, 0x06710c00, 0x06760c00,
+        0x06770c00, 0x06780c00, 0x06790c00, 0x067a0c00, 0x01000c46, 0x01000c47,
+        0x01000c49, 0x05000c4a, 0x02300e02, 0x02300e09, 0x02300e17, 0x06300e28,
+        0x02310e02, 0x02310e09, 0x02310e17, 0x06310e28, 0x02320e02, 0x02320e09,
+        0x02320e17, 0x06320e28, 0x02610e02, 0x02610e09, 0x02610e17, 0x06610e28,
+        0x02630e02, 0x02630e09, 0x02630e17, 0x06630e28, 0x02650e02, 0x02650e09,
+        0x02650e17, 0x06650e28, 0x02690e02, 0x02690e09, 0x02690e17, 0x06690e28,
+        0x026f0e02, 0x026f0e09, 0x026f0e17, 0x066f0e28, 0x02730e02, 0x02730e09,
+        0x02730e17, 0x06730e28, 0x02740e02, 0x02740e09, 0x02740e17, 0x06740e28,
+        0x02200e01, 0x06200e16, 0x02250e01, 0x06250e16, 0x022d0e01, 0x062d0e16,
+        0x022e0e01, 0x062e0e16, 0x022f0e01, 0x062f0e16, 0x02330e01, 0x06330e16,
+        0x02340e01, 0x06340e16, 0x02350e01, 0x06350e16, 0x02360e01, 0x06360e16,
+        0x02370e01, 0x06370e16, 0x02380e01, 0x06380e16, 0x02390e01, 0x06390e16,
+        0x023d0e01, 0x063d0e16, 0x02410e01, 0x06410e16, 0x025f0e01, 0x065f0e16,
+        0x02620e01, 0x06620e16, 0x02640e01, 0x06640e16, 0x02660e01, 0x06660e16,
+        0x02670e01, 0x06670e16, 0x02680e01, 0x06680e16, 0x026c0e01, 0x066c0e16,
+        0x026d0e01, 0x066d0e16, 0x026e0e01, 0x066e0e16, 0x02700e01, 0x06700e16,
+        0x02720e01, 0x06720e16, 0x02750e01, 0x06750e16, 0x063a0e00, 0x06420e00,
+        0x06430e00, 0x06440e00, 0x06450e00, 0x06460e00, 0x06470e00, 0x06480e00,
+        0x06490e00, 0x064a0e00, 0x064b0e00, 0x064c0e00, 0x064d0e00, 0x064e0e00,
+        0x064f0e00, 0x06500e00, 0x06510e00, 0x06520e00, 0x06530e00, 0x06540e00,
+        0x06550e00, 0x06560e00, 0x06570e00, 0x06590e00, 0x066a0e00, 0x066b0e00,
+        0x06710e00, 0x06760e00, 0x06770e00, 0x06780e00, 0x06790e00, 0x067a0e00,
+        0x01000e46, 0x01000e47, 0x01000e49, 0x05000e4a
+    },
+    /* 235 */
+    {
+        0x02300f01, 0x06300f16, 0x02310f01, 0x06310f16, 0x02320f01, 0x06320f16,
+        0x02610f01, 0x06610f16, 0x02630f01, 0x06630f16, 0x02650f01, 0x06650f16,
+        0x02690f01, 0x06690f16, 0x026f0f01, 0x066f0f16, 0x02730f01, 0x06730f16,
+        0x02740f01, 0x06740f16, 0x06200f00, 0x06250f00, 0x062d0f00, 0x062e0f00,
+        0x062f0f00, 0x06330f00, 0x06340f00, 0x06350f00, 0x06360f00, 0x06370f00,
+        0x06380f00, 0x06390f00, 0x063d0f00, 0x06410f00, 0x065f0f00, 0x06620f00,
+        0x06640f00, 0x06660f00, 0x06670f00, 0x06680f00, 0x066c0f00, 0x066d0f00,
+        0x066e0f00, 0x06700f00, 0x06720f00, 0x06750f00, 0x01000f26, 0x01000f27,
+        0x01000f2c, 0x01000f2d, 0x01000f2f, 0x01000f30, 0x01000f33, 0x01000f34,
+        0x01000f36, 0x01000f37, 0x01000f3b, 0x01000f3c, 0x01000f3e, 0x01000f3f,
+        0x01000f42, 0x01000f43, 0x01000f45, 0x05000f48, 0x02301001, 0x06301016,
+        0x02311001, 0x06311016, 0x02321001, 0x06321016, 0x02611001, 0x06611016,
+        0x02631001, 0x06631016, 0x02651001, 0x06651016, 0x02691001, 0x06691016,
+        0x026f1001, 0x066f1016, 0x02731001, 0x06731016, 0x02741001, 0x06741016,
+        0x06201000, 0x06251000, 0x062d1000, 0x062e1000, 0x062f1000, 0x06331000,
+        0x06341000, 0x06351000, 0x06361000, 0x06371000, 0x06381000, 0x06391000,
+        0x063d1000, 0x06411000, 0x065f1000, 0x06621000, 0x06641000, 0x06661000,
+        0x06671000, 0x06681000, 0x066c1000, 0x066d1000, 0x066e1000, 0x06701000,
+        0x06721000, 0x06751000, 0x01001026, 0x01001027, 0x0100102c, 0x0100102d,
+        0x0100102f, 0x01001030, 0x01001033, 0x01001034, 0x01001036, 0x01001037,
+        0x0100103b, 0x0100103c, 0x0100103e, 0x0100103f, 0x01001042, 0x01001043,
+        0x01001045, 0x05001048, 0x02301101, 0x06301116, 0x02311101, 0x06311116,
+        0x02321101, 0x06321116, 0x02611101, 0x06611116, 0x02631101, 0x06631116,
+        0x02651101, 0x06651116, 0x02691101, 0x06691116, 0x026f1101, 0x066f1116,
+        0x02731101, 0x06731116, 0x02741101, 0x06741116, 0x06201100, 0x06251100,
+        0x062d1100, 0x062e1100, 0x062f1100, 0x06331100, 0x06341100, 0x06351100,
+        0x06361100, 0x06371100, 0x06381100, 0x06391100, 0x063d1100, 0x06411100,
+        0x065f1100, 0x06621100, 0x06641100, 0x06661100, 0x06671100, 0x06681100,
+        0x066c1100, 0x066d1100, 0x066e1100, 0x06701100, 0x06721100, 0x06751100,
+        0x01001126, 0x01001127, 0x0100112c, 0x0100112d, 0x0100112f, 0x01001130,
+        0x01001133, 0x01001134, 0x01001136, 0x01001137, 0x0100113b, 0x0100113c,
+        0x0100113e, 0x0100113f, 0x01001142, 0x01001143, 0x01001145, 0x05001148,
+        0x02301201, 0x06301216, 0x02311201, 0x06311216, 0x02321201, 0x06321216,
+        0x02611201, 0x06611216, 0x02631201, 0x06631216, 0x02651201, 0x06651216,
+        0x02691201, 0x06691216, 0x026f1201, 0x066f1216, 0x02731201, 0x06731216,
+        0x02741201, 0x06741216, 0x06201200, 0x06251200, 0x062d1200, 0x062e1200,
+        0x062f1200, 0x06331200, 0x06341200, 0x06351200, 0x06361200, 0x06371200,
+        0x06381200, 0x06391200, 0x063d1200, 0x06411200, 0x065f1200, 0x06621200,
+        0x06641200, 0x06661200, 0x06671200, 0x06681200, 0x066c1200, 0x066d1200,
+        0x066e1200, 0x06701200, 0x06721200, 0x06751200, 0x01001226, 0x01001227,
+        0x0100122c, 0x0100122d, 0x0100122f, 0x01001230, 0x01001233, 0x01001234,
+        0x01001236, 0x01001237, 0x0100123b, 0x0100123c, 0x0100123e, 0x0100123f,
+        0x01001242, 0x01001243, 0x01001245, 0x05001248
+    },
+    /* 236 */
+    {
+        0x02300f02, 0x02300f09, 0x02300f17, 0x06300f28, 0x02310f02, 0x02310f09,
+        0x02310f17, 0x06310f28, 0x02320f02, 0x02320f09, 0x02320f17, 0x06320f28,
+        0x02610f02, 0x02610f09, 0x02610f17, 0x06610f28, 0x02630f02, 0x02630f09,
+        0x02630f17, 0x06630f28, 0x02650f02, 0x02650f09, 0x02650f17, 0x06650f28,
+        0x02690f02, 0x02690f09, 0x02690f17, 0x06690f28, 0x026f0f02, 0x026f0f09,
+        0x026f0f17, 0x066f0f28, 0x02730f02, 0x02730f09, 0x02730f17, 0x06730f28,
+        0x02740f02, 0x02740f09, 0x02740f17, 0x06740f28, 0x02200f01, 0x06200f16,
+        0x02250f01, 0x06250f16, 0x022d0f01, 0x062d0f16, 0x022e0f01, 0x062e0f16,
+        0x022f0f01, 0x062f0f16, 0x02330f01, 0x06330f16, 0x02340f01, 0x06340f16,
+        0x02350f01, 0x06350f16, 0x02360f01, 0x06360f16, 0x02370f01, 0x06370f16,
+        0x02380f01, 0x06380f16, 0x02390f01, 0x06390f16, 0x023d0f01, 0x063d0f16,
+        0x02410f01, 0x06410f16, 0x025f0f01, 0x065f0f16, 0x02620f01, 0x06620f16,
+        0x02640f01, 0x06640f16, 0x02660f01, 0x06660f16, 0x02670f01, 0x06670f16,
+        0x02680f01, 0x06680f16, 0x026c0f01, 0x066c0f16, 0x026d0f01, 0x066d0f16,
+        0x026e0f01, 0x066e0f16, 0x02700f01, 0x06700f16, 0x02720f01, 0x06720f16,
+        0x02750f01, 0x06750f16, 0x063a0f00, 0x06420f00, 0x06430f00, 0x06440f00,
+        0x06450f00, 0x06460f00, 0x06470f00, 0x06480f00, 0x06490f00, 0x064a0f00,
+        0x064b0f00, 0x064c0f00, 0x064d0f00, 0x064e0f00, 0x064f0f00, 0x06500f00,
+        0x06510f00, 0x06520f00, 0x06530f00, 0x06540f00, 0x06550f00, 0x06560f00,
+        0x06570f00, 0x06590f00, 0x066a0f00, 0x066b0f00, 0x06710f00, 0x06760f00,
+        0x06770f00, 0x06780f00, 0x06790f00, 0x067a0f00, 0x01000f46, 0x01000f47,
+        0x01000f49, 0x05000f4a, 0x02301002, 0x02301009, 0x02301017, 0x06301028,
+        0x02311002, 0x02311009, 0x02311017, 0x06311028, 0x02321002, 0x02321009,
+        0x02321017, 0x06321028, 0x02611002, 0x02611009, 0x02611017, 0x06611028,
+        0x02631002, 0x02631009, 0x02631017, 0x06631028, 0x02651002, 0x02651009,
+        0x02651017, 0x06651028, 0x02691002, 0x02691009, 0x02691017, 0x06691028,
+        0x026f1002, 0x026f1009, 0x026f1017, 0x066f1028, 0x02731002, 0x02731009,
+        0x02731017, 0x06731028, 0x02741002, 0x02741009, 0x02741017, 0x06741028,
+        0x02201001, 0x06201016, 0x02251001, 0x06251016, 0x022d1001, 0x062d1016,
+        0x022e1001, 0x062e1016, 0x022f1001, 0x062f1016, 0x02331001, 0x06331016,
+        0x02341001, 0x06341016, 0x02351001, 0x06351016, 0x02361001, 0x06361016,
+        0x02371001, 0x06371016, 0x02381001, 0x06381016, 0x02391001, 0x06391016,
+        0x023d1001, 0x063d1016, 0x02411001, 0x06411016, 0x025f1001, 0x065f1016,
+        0x02621001, 0x06621016, 0x02641001, 0x06641016, 0x02661001, 0x06661016,
+        0x02671001, 0x06671016, 0x02681001, 0x06681016, 0x026c1001, 0x066c1016,
+        0x026d1001, 0x066d1016, 0x026e1001, 0x066e1016, 0x02701001, 0x06701016,
+        0x02721001, 0x06721016, 0x02751001, 0x06751016, 0x063a1000, 0x06421000,
+        0x06431000, 0x06441000, 0x06451000, 0x06461000, 0x06471000, 0x06481000,
+        0x06491000, 0x064a1000, 0x064b1000, 0x064c1000, 0x064d1000, 0x064e1000,
+        0x064f1000, 0x06501000, 0x06511000, 0x06521000, 0x06531000, 0x06541000,
+        0x06551000, 0x06561000, 0x06571000, 0x06591000, 0x066a1000, 0x066b1000,
+        0x06711000, 0x06761000, 0x06771000, 0x06781000, 0x06791000, 0x067a1000,
+        0x01001046, 0x01001047, 0x01001049, 0x0500104a
+    },
+    /* 237 */
+    {
+        0x02301102, 0x02301109, 0x02301117, 0x06301128, 0x02311102, 0x02311109,
+        0x02311117, 0x06311128, 0x02321102, 0x02321109, 0x02321117, 0x06321128,
+        0x02611102, 0x02611109, 0x02611117, 0x06611128, 0x02631102, 0x02631109,
+        0x02631117, 0x06631128, 0x02651102, 0x02651109, 0x02651117, 0x06651128,
+        0x02691102, 0x02691109, 0x02691117, 0x06691128, 0x026f1102, 0x026f1109,
+        0x026f1117, 0x066f1128, 0x02731102, 0x02731109, 0x02731117, 0x06731128,
+        0x02741102, 0x02741109, 0x02741117, 0x06741128, 0x02201101, 0x06201116,
+        0x02251101, 0x06251116, 0x022d1101, 0x062d1116, 0x022e1101, 0x062e1116,
+        0x022f1101, 0x062f1116, 0x02331101, 0x06331116, 0x02341101, 0x06341116,
+        0x02351101, 0x06351116, 0x02361101, 0x06361116, 0x02371101, 0x06371116,
+        0x02381101, 0x06381116, 0x02391101, 0x06391116, 0x023d1101, 0x063d1116,
+        0x02411101, 0x06411116, 0x025f1101, 0x065f1116, 0x02621101, 0x06621116,
+        0x02641101, 0x06641116, 0x02661101, 0x06661116, 0x02671101, 0x06671116,
+        0x02681101, 0x06681116, 0x026c1101, 0x066c1116, 0x026d1101, 0x066d1116,
+        0x026e1101, 0x066e1116, 0x02701101, 0x06701116, 0x02721101, 0x06721116,
+        0x02751101, 0x06751116, 0x063a1100, 0x06421100, 0x06431100, 0x06441100,
+        0x06451100, 0x06461100, 0x06471100, 0x06481100, 0x06491100, 0x064a1100,
+        0x064b1100, 0x064c1100, 0x064d1100, 0x064e1100, 0x064f1100, 0x06501100,
+        0x06511100, 0x06521100, 0x06531100, 0x06541100, 0x06551100, 0x06561100,
+        0x06571100, 0x06591100, 0x066a1100, 0x066b1100, 0x06711100, 0x06761100,
+        0x06771100, 0x06781100, 0x06791100, 0x067a1100, 0x01001146, 0x01001147,
+        0x01001149, 0x0500114a, 0x02301202, 0x02301209, 0x02301217, 0x06301228,
+        0x02311202, 0x02311209, 0x02311217, 0x06311228, 0x02321202, 0x02321209,
+        0x02321217, 0x06321228, 0x02611202, 0x02611209, 0x02611217, 0x06611228,
+        0x02631202, 0x02631209, 0x02631217, 0x06631228, 0x02651202, 0x02651209,
+        0x02651217, 0x06651228, 0x02691202, 0x02691209, 0x02691217, 0x06691228,
+        0x026f1202, 0x026f1209, 0x026f1217, 0x066f1228, 0x02731202, 0x02731209,
+        0x02731217, 0x06731228, 0x02741202, 0x02741209, 0x02741217, 0x06741228,
+        0x02201201, 0x06201216, 0x02251201, 0x06251216, 0x022d1201, 0x062d1216,
+        0x022e1201, 0x062e1216, 0x022f1201, 0x062f1216, 0x02331201, 0x06331216,
+        0x02341201, 0x06341216, 0x02351201, 0x06351216, 0x02361201, 0x06361216,
+        0x02371201, 0x06371216, 0x02381201, 0x06381216, 0x02391201, 0x06391216,
+        0x023d1201, 0x063d1216, 0x02411201, 0x06411216, 0x025f1201, 0x065f1216,
+        0x02621201, 0x06621216, 0x02641201, 0x06641216, 0x02661201, 0x06661216,
+        0x02671201, 0x06671216, 0x02681201, 0x06681216, 0x026c1201, 0x066c1216,
+        0x026d1201, 0x066d1216, 0x026e1201, 0x066e1216, 0x02701201, 0x06701216,
+        0x02721201, 0x06721216, 0x02751201, 0x06751216, 0x063a1200, 0x06421200,
+        0x06431200, 0x06441200, 0x06451200, 0x06461200, 0x06471200, 0x06481200,
+        0x06491200, 0x064a1200, 0x064b1200, 0x064c1200, 0x064d1200, 0x064e1200,
+        0x064f1200, 0x06501200, 0x06511200, 0x06521200, 0x06531200, 0x06541200,
+        0x06551200, 0x06561200, 0x06571200, 0x06591200, 0x066a1200, 0x066b1200,
+        0x06711200, 0x06761200, 0x06771200, 0x06781200, 0x06791200, 0x067a1200,
+        0x01001246, 0x01001247, 0x01001249, 0x0500124a
+    },
+    /* 238 */
+    {
+        0x01001304, 0x01001305, 0x01001307, 0x01001308, 0x0100130b, 0x0100130c,
+        0x01001310, 0x01001313, 0x01001319, 0x0100131c, 0x01001320, 0x01001323,
+        0x0100132a, 0x01001331, 0x01001339, 0x05001340, 0x01001404, 0x01001405,
+        0x01001407, 0x01001408, 0x0100140b, 0x0100140c, 0x01001410, 0x01001413,
+        0x01001419, 0x0100141c, 0x01001420, 0x01001423, 0x0100142a, 0x01001431,
+        0x01001439, 0x05001440, 0x01001504, 0x01001505, 0x01001507, 0x01001508,
+        0x0100150b, 0x0100150c, 0x01001510, 0x01001513, 0x01001519, 0x0100151c,
+        0x01001520, 0x01001523, 0x0100152a, 0x01001531, 0x01001539, 0x05001540,
+        0x01001704, 0x01001705, 0x01001707, 0x01001708, 0x0100170b, 0x0100170c,
+        0x01001710, 0x01001713, 0x01001719, 0x0100171c, 0x01001720, 0x01001723,
+        0x0100172a, 0x01001731, 0x01001739, 0x05001740, 0x01001804, 0x01001805,
+        0x01001807, 0x01001808, 0x0100180b, 0x0100180c, 0x01001810, 0x01001813,
+        0x01001819, 0x0100181c, 0x01001820, 0x01001823, 0x0100182a, 0x01001831,
+        0x01001839, 0x05001840, 0x01001904, 0x01001905, 0x01001907, 0x01001908,
+        0x0100190b, 0x0100190c, 0x01001910, 0x01001913, 0x01001919, 0x0100191c,
+        0x01001920, 0x01001923, 0x0100192a, 0x01001931, 0x01001939, 0x05001940,
+        0x01001a04, 0x01001a05, 0x01001a07, 0x01001a08, 0x01001a0b, 0x01001a0c,
+        0x01001a10, 0x01001a13, 0x01001a19, 0x01001a1c, 0x01001a20, 0x01001a23,
+        0x01001a2a, 0x01001a31, 0x01001a39, 0x05001a40, 0x01001b04, 0x01001b05,
+        0x01001b07, 0x01001b08, 0x01001b0b, 0x01001b0c, 0x01001b10, 0x01001b13,
+        0x01001b19, 0x01001b1c, 0x01001b20, 0x01001b23, 0x01001b2a, 0x01001b31,
+        0x01001b39, 0x05001b40, 0x01001c04, 0x01001c05, 0x01001c07, 0x01001c08,
+        0x01001c0b, 0x01001c0c, 0x01001c10, 0x01001c13, 0x01001c19, 0x01001c1c,
+        0x01001c20, 0x01001c23, 0x01001c2a, 0x01001c31, 0x01001c39, 0x05001c40,
+        0x01001d04, 0x01001d05, 0x01001d07, 0x01001d08, 0x01001d0b, 0x01001d0c,
+        0x01001d10, 0x01001d13, 0x01001d19, 0x01001d1c, 0x01001d20, 0x01001d23,
+        0x01001d2a, 0x01001d31, 0x01001d39, 0x05001d40, 0x01001e04, 0x01001e05,
+        0x01001e07, 0x01001e08, 0x01001e0b, 0x01001e0c, 0x01001e10, 0x01001e13,
+        0x01001e19, 0x01001e1c, 0x01001e20, 0x01001e23, 0x01001e2a, 0x01001e31,
+        0x01001e39, 0x05001e40, 0x01001f04, 0x01001f05, 0x01001f07, 0x01001f08,
+        0x01001f0b, 0x01001f0c, 0x01001f10, 0x01001f13, 0x01001f19, 0x01001f1c,
+        0x01001f20, 0x01001f23, 0x01001f2a, 0x01001f31, 0x01001f39, 0x05001f40,
+        0x01007f04, 0x01007f05, 0x01007f07, 0x01007f08, 0x01007f0b, 0x01007f0c,
+        0x01007f10, 0x01007f13, 0x01007f19, 0x01007f1c, 0x01007f20, 0x01007f23,
+        0x01007f2a, 0x01007f31, 0x01007f39, 0x05007f40, 0x0100dc04, 0x0100dc05,
+        0x0100dc07, 0x0100dc08, 0x0100dc0b, 0x0100dc0c, 0x0100dc10, 0x0100dc13,
+        0x0100dc19, 0x0100dc1c, 0x0100dc20, 0x0100dc23, 0x0100dc2a, 0x0100dc31,
+        0x0100dc39, 0x0500dc40, 0x0100f904, 0x0100f905, 0x0100f907, 0x0100f908,
+        0x0100f90b, 0x0100f90c, 0x0100f910, 0x0100f913, 0x0100f919, 0x0100f91c,
+        0x0100f920, 0x0100f923, 0x0100f92a, 0x0100f931, 0x0100f939, 0x0500f940,
+        0x01000a02, 0x01000a09, 0x01000a17, 0x05000a28, 0x01000d02, 0x01000d09,
+        0x01000d17, 0x05000d28, 0x01001602, 0x01001609, 0x01001617, 0x05001628,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000
+    },
+    /* 239 */
+    {
+        0x06301300, 0x06311300, 0x06321300, 0x06611300, 0x06631300, 0x06651300,
+        0x06691300, 0x066f1300, 0x06731300, 0x06741300, 0x0100130d, 0x0100130e,
+        0x01001311, 0x01001312, 0x01001314, 0x01001315, 0x0100131a, 0x0100131b,
+        0x0100131d, 0x0100131e, 0x01001321, 0x01001322, 0x01001324, 0x01001325,
+        0x0100132b, 0x0100132e, 0x01001332, 0x01001335, 0x0100133a, 0x0100133d,
+        0x01001341, 0x05001344, 0x06301400, 0x06311400, 0x06321400, 0x06611400,
+        0x06631400, 0x06651400, 0x06691400, 0x066f1400, 0x06731400, 0x06741400,
+        0x0100140d, 0x0100140e, 0x01001411, 0x01001412, 0x01001414, 0x01001415,
+        0x0100141a, 0x0100141b, 0x0100141d, 0x0100141e, 0x01001421, 0x01001422,
+        0x01001424, 0x01001425, 0x0100142b, 0x0100142e, 0x01001432, 0x01001435,
+        0x0100143a, 0x0100143d, 0x01001441, 0x05001444, 0x06301500, 0x06311500,
+        0x06321500, 0x06611500, 0x06631500, 0x06651500, 0x06691500, 0x066f1500,
+        0x06731500, 0x06741500, 0x0100150d, 0x0100150e, 0x01001511, 0x01001512,
+        0x01001514, 0x01001515, 0x0100151a, 0x0100151b, 0x0100151d, 0x0100151e,
+        0x01001521, 0x01001522, 0x01001524, 0x01001525, 0x0100152b, 0x0100152e,
+        0x01001532, 0x01001535, 0x0100153a, 0x0100153d, 0x01001541, 0x05001544,
+        0x06301700, 0x06311700, 0x06321700, 0x06611700, 0x06631700, 0x06651700,
+        0x06691700, 0x066f1700, 0x06731700, 0x06741700, 0x0100170d, 0x0100170e,
+        0x01001711, 0x01001712, 0x01001714, 0x01001715, 0x0100171a, 0x0100171b,
+        0x0100171d, 0x0100171e, 0x01001721, 0x01001722, 0x01001724, 0x01001725,
+        0x0100172b, 0x0100172e, 0x01001732, 0x01001735, 0x0100173a, 0x0100173d,
+        0x01001741, 0x05001744, 0x06301800, 0x06311800, 0x06321800, 0x06611800,
+        0x06631800, 0x06651800, 0x06691800, 0x066f1800, 0x06731800, 0x06741800,
+        0x0100180d, 0x0100180e, 0x01001811, 0x01001812, 0x01001814, 0x01001815,
+        0x0100181a, 0x0100181b, 0x0100181d, 0x0100181e, 0x01001821, 0x01001822,
+        0x01001824, 0x01001825, 0x0100182b, 0x0100182e, 0x01001832, 0x01001835,
+        0x0100183a, 0x0100183d, 0x01001841, 0x05001844, 0x06301900, 0x06311900,
+        0x06321900, 0x06611900, 0x06631900, 0x06651900, 0x06691900, 0x066f1900,
+        0x06731900, 0x06741900, 0x0100190d, 0x0100190e, 0x01001911, 0x01001912,
+        0x01001914, 0x01001915, 0x0100191a, 0x0100191b, 0x0100191d, 0x0100191e,
+        0x01001921, 0x01001922, 0x01001924, 0x01001925, 0x0100192b, 0x0100192e,
+        0x01001932, 0x01001935, 0x0100193a, 0x0100193d, 0x01001941, 0x05001944,
+        0x06301a00, 0x06311a00, 0x06321a00, 0x06611a00, 0x06631a00, 0x06651a00,
+        0x06691a00, 0x066f1a00, 0x06731a00, 0x06741a00, 0x01001a0d, 0x01001a0e,
+        0x01001a11, 0x01001a12, 0x01001a14, 0x01001a15, 0x01001a1a, 0x01001a1b,
+        0x01001a1d, 0x01001a1e, 0x01001a21, 0x01001a22, 0x01001a24, 0x01001a25,
+        0x01001a2b, 0x01001a2e, 0x01001a32, 0x01001a35, 0x01001a3a, 0x01001a3d,
+        0x01001a41, 0x05001a44, 0x06301b00, 0x06311b00, 0x06321b00, 0x06611b00,
+        0x06631b00, 0x06651b00, 0x06691b00, 0x066f1b00, 0x06731b00, 0x06741b00,
+        0x01001b0d, 0x01001b0e, 0x01001b11, 0x01001b12, 0x01001b14, 0x01001b15,
+        0x01001b1a, 0x01001b1b, 0x01001b1d, 0x01001b1e, 0x01001b21, 0x01001b22,
+        0x01001b24, 0x01001b25, 0x01001b2b, 0x01001b2e, 0x01001b32, 0x01001b35,
+        0x01001b3a, 0x01001b3d, 0x01001b41, 0x05001b44
+    },
+    /* 240 */
+    {
+        0x02301301, 0x06301316, 0x02311301, 0x06311316, 0x02321301, 0x06321316,
+        0x02611301, 0x06611316, 0x02631301, 0x06631316, 0x02651301, 0x06651316,
+        0x02691301, 0x06691316, 0x026f1301, 0x066f1316, 0x02731301, 0x06731316,
+        0x02741301, 0x06741316, 0x06201300, 0x06251300, 0x062d1300, 0x062e1300,
+        0x062f1300, 0x06331300, 0x06341300, 0x06351300, 0x06361300, 0x06371300,
+        0x06381300, 0x06391300, 0x063d1300, 0x06411300, 0x065f1300, 0x06621300,
+        0x06641300, 0x06661300, 0x06671300, 0x06681300, 0x066c1300, 0x066d1300,
+        0x066e1300, 0x06701300, 0x06721300, 0x06751300, 0x01001326, 0x01001327,
+        0x0100132c, 0x0100132d, 0x0100132f, 0x01001330, 0x01001333, 0x01001334,
+        0x01001336, 0x01001337, 0x0100133b, 0x0100133c, 0x0100133e, 0x0100133f,
+        0x01001342, 0x01001343, 0x01001345, 0x05001348, 0x02301401, 0x06301416,
+        0x02311401, 0x06311416, 0x02321401, 0x06321416, 0x02611401, 0x06611416,
+        0x02631401, 0x06631416, 0x02651401, 0x06651416, 0x02691401, 0x06691416,
+        0x026f1401, 0x066f1416, 0x02731401, 0x06731416, 0x02741401, 0x06741416,
+        0x06201400, 0x06251400, 0x062d1400, 0x062e1400, 0x062f1400, 0x06331400,
+        0x06341400, 0x06351400, 0x06361400, 0x06371400, 0x06381400, 0x06391400,
+        0x063d1400, 0x06411400, 0x065f1400, 0x06621400, 0x06641400, 0x06661400,
+        0x06671400, 0x06681400, 0x066c1400, 0x066d1400, 0x066e1400, 0x06701400,
+        0x06721400, 0x06751400, 0x01001426, 0x01001427, 0x0100142c, 0x0100142d,
+        0x0100142f, 0x01001430, 0x01001433, 0x01001434, 0x01001436, 0x01001437,
+        0x0100143b, 0x0100143c, 0x0100143e, 0x0100143f, 0x01001442, 0x01001443,
+        0x01001445, 0x05001448, 0x02301501, 0x06301516, 0x02311501, 0x06311516,
+        0x02321501, 0x06321516, 0x02611501, 0x06611516, 0x02631501, 0x06631516,
+        0x02651501, 0x06651516, 0x02691501, 0x06691516, 0x026f1501, 0x066f1516,
+        0x02731501, 0x06731516, 0x02741501, 0x06741516, 0x06201500, 0x06251500,
+        0x062d1500, 0x062e1500, 0x062f1500, 0x06331500, 0x06341500, 0x06351500,
+        0x06361500, 0x06371500, 0x06381500, 0x06391500, 0x063d1500, 0x06411500,
+        0x065f1500, 0x06621500, 0x06641500, 0x06661500, 0x06671500, 0x06681500,
+        0x066c1500, 0x066d1500, 0x066e1500, 0x06701500, 0x06721500, 0x06751500,
+        0x01001526, 0x01001527, 0x0100152c, 0x0100152d, 0x0100152f, 0x01001530,
+        0x01001533, 0x01001534, 0x01001536, 0x01001537, 0x0100153b, 0x0100153c,
+        0x0100153e, 0x0100153f, 0x01001542, 0x01001543, 0x01001545, 0x05001548,
+        0x02301701, 0x06301716, 0x02311701, 0x06311716, 0x02321701, 0x06321716,
+        0x02611701, 0x06611716, 0x02631701, 0x06631716, 0x02651701, 0x06651716,
+        0x02691701, 0x06691716, 0x026f1701, 0x066f1716, 0x02731701, 0x06731716,
+        0x02741701, 0x06741716, 0x06201700, 0x06251700, 0x062d1700, 0x062e1700,
+        0x062f1700, 0x06331700, 0x06341700, 0x06351700, 0x06361700, 0x06371700,
+        0x06381700, 0x06391700, 0x063d1700, 0x06411700, 0x065f1700, 0x06621700,
+        0x06641700, 0x06661700, 0x06671700, 0x06681700, 0x066c1700, 0x066d1700,
+        0x066e1700, 0x06701700, 0x06721700, 0x06751700, 0x01001726, 0x01001727,
+        0x0100172c, 0x0100172d, 0x0100172f, 0x01001730, 0x01001733, 0x01001734,
+        0x01001736, 0x01001737, 0x0100173b, 0x0100173c, 0x0100173e, 0x0100173f,
+        0x01001742, 0x01001743, 0x01001745, 0x05001748
+    },
+    /* 241 */
+    {
+        0x02301302, 0x02301309, 0x02301317, 0x06301328, 0x02311302, 0x02311309,
+        0x02311317, 0x06311328, 0x02321302, 0x02321309, 0x02321317, 0x06321328,
+        0x02611302, 0x02611309, 0x02611317, 0x06611328, 0x02631302, 0x02631309,
+        0x02631317, 0x06631328, 0x02651302, 0x02651309, 0x02651317, 0x06651328,
+        0x02691302, 0x02691309, 0x02691317, 0x06691328, 0x026f1302, 0x026f1309,
+        0x026f1317, 0x066f1328, 0x02731302, 0x02731309, 0x02731317, 0x06731328,
+        0x02741302, 0x02741309, 0x02741317, 0x06741328, 0x02201301, 0x06201316,
+        0x02251301, 0x06251316, 0x022d1301, 0x062d1316, 0x022e1301, 0x062e1316,
+        0x022f1301, 0x062f1316, 0x02331301, 0x06331316, 0x02341301, 0x06341316,
+        0x02351301, 0x06351316, 0x02361301, 0x06361316, 0x02371301, 0x06371316,
+        0x02381301, 0x06381316, 0x02391301, 0x06391316, 0x023d1301, 0x063d1316,
+        0x02411301, 0x06411316, 0x025f1301, 0x065f1316, 0x02621301, 0x06621316,
+        0x02641301, 0x06641316, 0x02661301, 0x06661316, 0x02671301, 0x06671316,
+        0x02681301, 0x06681316, 0x026c1301, 0x066c1316, 0x026d1301, 0x066d1316,
+        0x026e1301, 0x066e1316, 0x02701301, 0x06701316, 0x02721301, 0x06721316,
+        0x02751301, 0x06751316, 0x063a1300, 0x06421300, 0x06431300, 0x06441300,
+        0x06451300, 0x06461300, 0x06471300, 0x06481300, 0x06491300, 0x064a1300,
+        0x064b1300, 0x064c1300, 0x064d1300, 0x064e1300, 0x064f1300, 0x06501300,
+        0x06511300, 0x06521300, 0x06531300, 0x06541300, 0x06551300, 0x06561300,
+        0x06571300, 0x06591300, 0x066a1300, 0x066b1300, 0x06711300, 0x06761300,
+        0x06771300, 0x06781300, 0x06791300, 0x067a1300, 0x01001346, 0x01001347,
+        0x01001349, 0x0500134a, 0x02301402, 0x02301409, 0x02301417, 0x06301428,
+        0x02311402, 0x02311409, 0x02311417, 0x06311428, 0x02321402, 0x02321409,
+        0x02321417, 0x06321428, 0x02611402, 0x02611409, 0x02611417, 0x06611428,
+        0x02631402, 0x02631409, 0x02631417, 0x06631428, 0x02651402, 0x02651409,
+        0x02651417, 0x06651428, 0x02691402, 0x02691409, 0x02691417, 0x06691428,
+        0x026f1402, 0x026f1409, 0x026f1417, 0x066f1428, 0x02731402, 0x02731409,
+        0x02731417, 0x06731428, 0x02741402, 0x02741409, 0x02741417, 0x06741428,
+        0x02201401, 0x06201416, 0x02251401, 0x06251416, 0x022d1401, 0x062d1416,
+        0x022e1401, 0x062e1416, 0x022f1401, 0x062f1416, 0x02331401, 0x06331416,
+        0x02341401, 0x06341416, 0x02351401, 0x06351416, 0x02361401, 0x06361416,
+        0x02371401, 0x06371416, 0x02381401, 0x06381416, 0x02391401, 0x06391416,
+        0x023d1401, 0x063d1416, 0x02411401, 0x06411416, 0x025f1401, 0x065f1416,
+        0x02621401, 0x06621416, 0x02641401, 0x06641416, 0x02661401, 0x06661416,
+        0x02671401, 0x06671416, 0x02681401, 0x06681416, 0x026c1401, 0x066c1416,
+        0x026d1401, 0x066d1416, 0x026e1401, 0x066e1416, 0x02701401, 0x06701416,
+        0x02721401, 0x06721416, 0x02751401, 0x06751416, 0x063a1400, 0x06421400,
+        0x06431400, 0x06441400, 0x06451400, 0x06461400, 0x06471400, 0x06481400,
+        0x06491400, 0x064a1400, 0x064b1400, 0x064c1400, 0x064d1400, 0x064e1400,
+        0x064f1400, 0x06501400, 0x06511400, 0x06521400, 0x06531400, 0x06541400,
+        0x06551400, 0x06561400, 0x06571400, 0x06591400, 0x066a1400, 0x066b1400,
+        0x06711400, 0x06761400, 0x06771400, 0x06781400, 0x06791400, 0x067a1400,
+        0x01001446, 0x01001447, 0x01001449, 0x0500144a
+    },
+    /* 242 */
+    {
+        0x02301502, 0x02301509, 0x02301517, 0x06301528, 0x02311502, 0x02311509,
+        0x02311517, 0x06311528, 0x02321502, 0x02321509, 0x02321517, 0x06321528,
+        0x02611502, 0x02611509, 0x02611517, 0x06611528, 0x02631502, 0x02631509,
+        0x02631517, 0x06631528, 0x02651502, 0x02651509, 0x02651517, 0x06651528,
+        0x02691502, 0x02691509, 0x02691517, 0x06691528, 0x026f1502, 0x026f1509,
+        0x026f1517, 0x066f1528, 0x02731502, 0x02731509, 0x02731517, 0x06731528,
+        0x02741502, 0x02741509, 0x02741517, 0x06741528, 0x02201501, 0x06201516,
+        0x02251501, 0x06251516, 0x022d1501, 0x062d1516, 0x022e1501, 0x062e1516,
+        0x022f1501, 0x062f1516, 0x02331501, 0x06331516, 0x02341501, 0x06341516,
+        0x02351501, 0x06351516, 0x02361501, 0x06361516, 0x02371501, 0x06371516,
+        0x02381501, 0x06381516, 0x02391501, 0x06391516, 0x023d1501, 0x063d1516,
+        0x02411501, 0x06411516, 0x025f1501, 0x065f1516, 0x02621501, 0x06621516,
+        0x02641501, 0x06641516, 0x02661501, 0x06661516, 0x02671501, 0x06671516,
+        0x02681501, 0x06681516, 0x026c1501, 0x066c1516, 0x026d1501, 0x066d1516,
+        0x026e1501, 0x066e1516, 0x02701501, 0x06701516, 0x02721501, 0x06721516,
+        0x02751501, 0x06751516, 0x063a1500, 0x06421500, 0x06431500, 0x06441500,
+        0x06451500, 0x06461500, 0x06471500, 0x06481500, 0x06491500, 0x064a1500,
+        0x064b1500, 0x064c1500, 0x064d1500, 0x064e1500, 0x064f1500, 0x06501500,
+        0x06511500, 0x06521500, 0x06531500, 0x06541500, 0x06551500, 0x06561500,
+        0x06571500, 0x06591500, 0x066a1500, 0x066b1500, 0x06711500, 0x06761500,
+        0x06771500, 0x06781500, 0x06791500, 0x067a1500, 0x01001546, 0x01001547,
+        0x01001549, 0x0500154a, 0x02301702, 0x02301709, 0x02301717, 0x06301728,
+        0x02311702, 0x02311709, 0x02311717, 0x06311728, 0x02321702, 0x02321709,
+        0x02321717, 0x06321728, 0x02611702, 0x02611709, 0x02611717, 0x06611728,
+        0x02631702, 0x02631709, 0x02631717, 0x06631728, 0x02651702, 0x02651709,
+        0x02651717, 0x06651728, 0x02691702, 0x02691709, 0x02691717, 0x06691728,
+        0x026f1702, 0x026f1709, 0x026f1717, 0x066f1728, 0x02731702, 0x02731709,
+        0x02731717, 0x06731728, 0x02741702, 0x02741709, 0x02741717, 0x06741728,
+        0x02201701, 0x06201716, 0x02251701, 0x06251716, 0x022d1701, 0x062d1716,
+        0x022e1701, 0x062e1716, 0x022f1701, 0x062f1716, 0x02331701, 0x06331716,
+        0x02341701, 0x06341716, 0x02351701, 0x06351716, 0x02361701, 0x06361716,
+        0x02371701, 0x06371716, 0x02381701, 0x06381716, 0x02391701, 0x06391716,
+        0x023d1701, 0x063d1716, 0x02411701, 0x06411716, 0x025f1701, 0x065f1716,
+        0x02621701, 0x06621716, 0x02641701, 0x06641716, 0x02661701, 0x06661716,
+        0x02671701, 0x06671716, 0x02681701, 0x06681716, 0x026c1701, 0x066c1716,
+        0x026d1701, 0x066d1716, 0x026e1701, 0x066e1716, 0x02701701, 0x06701716,
+        0x02721701, 0x06721716, 0x02751701, 0x06751716, 0x063a1700, 0x06421700,
+        0x06431700, 0x06441700, 0x06451700, 0x06461700, 0x06471700, 0x06481700,
+        0x06491700, 0x064a1700, 0x064b1700, 0x064c1700, 0x064d1700, 0x064e1700,
+        0x064f1700, 0x06501700, 0x06511700, 0x06521700, 0x06531700, 0x06541700,
+        0x06551700, 0x06561700, 0x06571700, 0x06591700, 0x066a1700, 0x066b1700,
+        0x06711700, 0x06761700, 0x06771700, 0x06781700, 0x06791700, 0x067a1700,
+        0x01001746, 0x01001747, 0x01001749, 0x0500174a
+    },
+    /* 243 */
+    {
+        0x02301801, 0x06301816, 0x02311801, 0x06311816, 0x02321801, 0x06321816,
+        0x02611801, 0x06611816, 0x02631801, 0x06631816, 0x02651801, 0x06651816,
+        0x02691801, 0x06691816, 0x026f1801, 0x066f1816, 0x02731801, 0x06731816,
+        0x02741801, 0x06741816, 0x06201800, 0x06251800, 0x062d1800, 0x062e1800,
+        0x062f1800, 0x06331800, 0x06341800, 0x06351800, 0x06361800, 0x06371800,
+        0x06381800, 0x06391800, 0x063d1800, 0x06411800, 0x065f1800, 0x06621800,
+        0x06641800, 0x06661800, 0x06671800, 0x06681800, 0x066c1800, 0x066d1800,
+        0x066e1800, 0x06701800, 0x06721800, 0x06751800, 0x01001826, 0x01001827,
+        0x0100182c, 0x0100182d, 0x0100182f, 0x01001830, 0x01001833, 0x01001834,
+        0x01001836, 0x01001837, 0x0100183b, 0x0100183c, 0x0100183e, 0x0100183f,
+        0x01001842, 0x01001843, 0x01001845, 0x05001848, 0x02301901, 0x06301916,
+        0x02311901, 0x06311916, 0x02321901, 0x06321916, 0x02611901, 0x06611916,
+        0x02631901, 0x06631916, 0x02651901, 0x06651916, 0x02691901, 0x06691916,
+        0x026f1901, 0x066f1916, 0x02731901, 0x06731916, 0x02741901, 0x06741916,
+        0x06201900, 0x06251900, 0x062d1900, 0x062e1900, 0x062f1900, 0x06331900,
+        0x06341900, 0x06351900, 0x06361900, 0x06371900, 0x06381900, 0x06391900,
+        0x063d1900, 0x06411900, 0x065f1900, 0x06621900, 0x06641900, 0x06661900,
+        0x06671900, 0x06681900, 0x066c1900, 0x066d1900, 0x066e1900, 0x06701900,
+        0x06721900, 0x06751900, 0x01001926, 0x01001927, 0x0100192c, 0x0100192d,
+        0x0100192f, 0x01001930, 0x01001933, 0x01001934, 0x01001936, 0x01001937,
+        0x0100193b, 0x0100193c, 0x0100193e, 0x0100193f, 0x01001942, 0x01001943,
+        0x01001945, 0x05001948, 0x02301a01, 0x06301a16, 0x02311a01, 0x06311a16,
+        0x02321a01, 0x06321a16, 0x02611a01, 0x06611a16, 0x02631a01, 0x06631a16,
+        0x02651a01, 0x06651a16, 0x02691a01, 0x06691a16, 0x026f1a01, 0x066f1a16,
+        0x02731a01, 0x06731a16, 0x02741a01, 0x06741a16, 0x06201a00, 0x06251a00,
+        0x062d1a00, 0x062e1a00, 0x062f1a00, 0x06331a00, 0x06341a00, 0x06351a00,
+        0x06361a00, 0x06371a00, 0x06381a00, 0x06391a00, 0x063d1a00, 0x06411a00,
+        0x065f1a00, 0x06621a00, 0x06641a00, 0x06661a00, 0x06671a00, 0x06681a00,
+        0x066c1a00, 0x066d1a00, 0x066e1a00, 0x06701a00, 0x06721a00, 0x06751a00,
+        0x01001a26, 0x01001a27, 0x01001a2c, 0x01001a2d, 0x01001a2f, 0x01001a30,
+        0x01001a33, 0x01001a34, 0x01001a36, 0x01001a37, 0x01001a3b, 0x01001a3c,
+        0x01001a3e, 0x01001a3f, 0x01001a42, 0x01001a43, 0x01001a45, 0x05001a48,
+        0x02301b01, 0x06301b16, 0x02311b01, 0x06311b16, 0x02321b01, 0x06321b16,
+        0x02611b01, 0x06611b16, 0x02631b01, 0x06631b16, 0x02651b01, 0x06651b16,
+        0x02691b01, 0x06691b16, 0x026f1b01, 0x066f1b16, 0x02731b01, 0x06731b16,
+        0x02741b01, 0x06741b16, 0x06201b00, 0x06251b00, 0x062d1b00, 0x062e1b00,
+        0x062f1b00, 0x06331b00, 0x06341b00, 0x06351b00, 0x06361b00, 0x06371b00,
+        0x06381b00, 0x06391b00, 0x063d1b00, 0x06411b00, 0x065f1b00, 0x06621b00,
+        0x06641b00, 0x06661b00, 0x06671b00, 0x06681b00, 0x066c1b00, 0x066d1b00,
+        0x066e1b00, 0x06701b00, 0x06721b00, 0x06751b00, 0x01001b26, 0x01001b27,
+        0x01001b2c, 0x01001b2d, 0x01001b2f, 0x01001b30, 0x01001b33, 0x01001b34,
+        0x01001b36, 0x01001b37, 0x01001b3b, 0x01001b3c, 0x01001b3e, 0x01001b3f,
+        0x01001b42, 0x01001b43, 0x01001b45, 0x05001b48
+    },
+    /* 244 */
+    {
+        0x02301802, 0x02301809, 0x02301817, 0x06301828, 0x02311802, 0x02311809,
+        0x02311817, 0x06311828, 0x02321802, 0x02321809, 0x02321817, 0x06321828,
+        0x02611802, 0x02611809, 0x02611817, 0x06611828, 0x02631802, 0x02631809,
+        0x02631817, 0x06631828, 0x02651802, 0x02651809, 0x02651817, 0x06651828,
+        0x02691802, 0x02691809, 0x02691817, 0x06691828, 0x026f1802, 0x026f1809,
+        0x026f1817, 0x066f1828, 0x02731802, 0x02731809, 0x02731817, 0x06731828,
+        0x02741802, 0x02741809, 0x02741817, 0x06741828, 0x02201801, 0x06201816,
+        0x02251801, 0x06251816, 0x022d1801, 0x062d1816, 0x022e1801, 0x062e1816,
+        0x022f1801, 0x062f1816, 0x02331801, 0x06331816, 0x02341801, 0x06341816,
+        0x02351801, 0x06351816, 0x02361801, 0x06361816, 0x02371801, 0x06371816,
+        0x02381801, 0x06381816, 0x02391801, 0x06391816, 0x023d1801, 0x063d1816,
+        0x02411801, 0x06411816, 0x025f1801, 0x065f1816, 0x02621801, 0x06621816,
+        0x02641801, 0x06641816, 0x02661801, 0x06661816, 0x02671801, 0x06671816,
+        0x02681801, 0x06681816, 0x026c1801, 0x066c1816, 0x026d1801, 0x066d1816,
+        0x026e1801, 0x066e1816, 0x02701801, 0x06701816, 0x02721801, 0x06721816,
+        0x02751801, 0x06751816, 0x063a1800, 0x06421800, 0x06431800, 0x06441800,
+        0x06451800, 0x06461800, 0x06471800, 0x06481800, 0x06491800, 0x064a1800,
+        0x064b1800, 0x064c1800, 0x064d1800, 0x064e1800, 0x064f1800, 0x06501800,
+        0x06511800, 0x06521800, 0x06531800, 0x06541800, 0x06551800, 0x06561800,
+        0x06571800, 0x06591800, 0x066a1800, 0x066b1800, 0x06711800, 0x06761800,
+        0x06771800, 0x06781800, 0x06791800, 0x067a1800, 0x01001846, 0x01001847,
+        0x01001849, 0x0500184a, 0x02301902, 0x02301909, 0x02301917, 0x06301928,
+        0x02311902, 0x02311909, 0x02311917, 0x06311928, 0x02321902, 0x02321909,
+        0x02321917, 0x06321928, 0x02611902, 0x02611909, 0x02611917, 0x06611928,
+        0x02631902, 0x02631909, 0x02631917, 0x06631928, 0x02651902, 0x02651909,
+        0x02651917, 0x06651928, 0x02691902, 0x02691909, 0x02691917, 0x06691928,
+        0x026f1902, 0x026f1909, 0x026f1917, 0x066f1928, 0x02731902, 0x02731909,
+        0x02731917, 0x06731928, 0x02741902, 0x02741909, 0x02741917, 0x06741928,
+        0x02201901, 0x06201916, 0x02251901, 0x06251916, 0x022d1901, 0x062d1916,
+        0x022e1901, 0x062e1916, 0x022f1901, 0x062f1916, 0x02331901, 0x06331916,
+        0x02341901, 0x06341916, 0x02351901, 0x06351916, 0x02361901, 0x06361916,
+        0x02371901, 0x06371916, 0x02381901, 0x06381916, 0x02391901, 0x06391916,
+        0x023d1901, 0x063d1916, 0x02411901, 0x06411916, 0x025f1901, 0x065f1916,
+        0x02621901, 0x06621916, 0x02641901, 0x06641916, 0x02661901, 0x06661916,
+        0x02671901, 0x06671916, 0x02681901, 0x06681916, 0x026c1901, 0x066c1916,
+        0x026d1901, 0x066d1916, 0x026e1901, 0x066e1916, 0x02701901, 0x06701916,
+        0x02721901, 0x06721916, 0x02751901, 0x06751916, 0x063a1900, 0x06421900,
+        0x06431900, 0x06441900, 0x06451900, 0x06461900, 0x06471900, 0x06481900,
+        0x06491900, 0x064a1900, 0x064b1900, 0x064c1900, 0x064d1900, 0x064e1900,
+        0x064f1900, 0x06501900, 0x06511900, 0x06521900, 0x06531900, 0x06541900,
+        0x06551900, 0x06561900, 0x06571900, 0x06591900, 0x066a1900, 0x066b1900,
+        0x06711900, 0x06761900, 0x06771900, 0x06781900, 0x06791900, 0x067a1900,
+        0x01001946, 0x01001947, 0x01001949, 0x0500194a
+    },
+    /* 245 */
+    {
+        0x02301a02, 0x02301a09, 0x02301a17, 0x06301a28, 0x02311a02, 0x02311a09,
+        0x02311a17, 0x06311a28, 0x02321a02, 0x02321a09, 0x02321a17, 0x06321a28,
+        0x02611a02, 0x02611a09, 0x02611a17, 0x06611a28, 0x02631a02, 0x02631a09,
+        0x02631a17, 0x06631a28, 0x02651a02, 0x02651a09, 0x02651a17, 0x06651a28,
+        0x02691a02, 0x02691a09, 0x02691a17, 0x06691a28, 0x026f1a02, 0x026f1a09,
+        0x026f1a17, 0x066f1a28, 0x02731a02, 0x02731a09, 0x02731a17, 0x06731a28,
+        0x02741a02, 0x02741a09, 0x02741a17, 0x06741a28, 0x02201a01, 0x06201a16,
+        0x02251a01, 0x06251a16, 0x022d1a01, 0x062d1a16, 0x022e1a01, 0x062e1a16,
+        0x022f1a01, 0x062f1a16, 0x02331a01, 0x06331a16, 0x02341a01, 0x06341a16,
+        0x02351a01, 0x06351a16, 0x02361a01, 0x06361a16, 0x02371a01, 0x06371a16,
+        0x02381a01, 0x06381a16, 0x02391a01, 0x06391a16, 0x023d1a01, 0x063d1a16,
+        0x02411a01, 0x06411a16, 0x025f1a01, 0x065f1a16, 0x02621a01, 0x06621a16,
+        0x02641a01, 0x06641a16, 0x02661a01, 0x06661a16, 0x02671a01, 0x06671a16,
+        0x02681a01, 0x06681a16, 0x026c1a01, 0x066c1a16, 0x026d1a01, 0x066d1a16,
+        0x026e1a01, 0x066e1a16, 0x02701a01, 0x06701a16, 0x02721a01, 0x06721a16,
+        0x02751a01, 0x06751a16, 0x063a1a00, 0x06421a00, 0x06431a00, 0x06441a00,
+        0x06451a00, 0x06461a00, 0x06471a00, 0x06481a00, 0x06491a00, 0x064a1a00,
+        0x064b1a00, 0x064c1a00, 0x064d1a00, 0x064e1a00, 0x064f1a00, 0x06501a00,
+        0x06511a00, 0x06521a00, 0x06531a00, 0x06541a00, 0x06551a00, 0x06561a00,
+        0x06571a00, 0x06591a00, 0x066a1a00, 0x066b1a00, 0x06711a00, 0x06761a00,
+        0x06771a00, 0x06781a00, 0x06791a00, 0x067a1a00, 0x01001a46, 0x01001a47,
+        0x01001a49, 0x05001a4a, 0x02301b02, 0x02301b09, 0x02301b17, 0x06301b28,
+        0x02311b02, 0x02311b09, 0x02311b17, 0x06311b28, 0x02321b02, 0x02321b09,
+        0x02321b17, 0x06321b28, 0x02611b02, 0x02611b09, 0x02611b17, 0x06611b28,
+        0x02631b02, 0x02631b09, 0x02631b17, 0x06631b28, 0x02651b02, 0x02651b09,
+        0x02651b17, 0x06651b28, 0x02691b02, 0x02691b09, 0x02691b17, 0x06691b28,
+        0x026f1b02, 0x026f1b09, 0x026f1b17, 0x066f1b28, 0x02731b02, 0x02731b09,
+        0x02731b17, 0x06731b28, 0x02741b02, 0x02741b09, 0x02741b17, 0x06741b28,
+        0x02201b01, 0x06201b16, 0x02251b01, 0x06251b16, 0x022d1b01, 0x062d1b16,
+        0x022e1b01, 0x062e1b16, 0x022f1b01, 0x062f1b16, 0x02331b01, 0x06331b16,
+        0x02341b01, 0x06341b16, 0x02351b01, 0x06351b16, 0x02361b01, 0x06361b16,
+        0x02371b01, 0x06371b16, 0x02381b01, 0x06381b16, 0x02391b01, 0x06391b16,
+        0x023d1b01, 0x063d1b16, 0x02411b01, 0x06411b16, 0x025f1b01, 0x065f1b16,
+        0x02621b01, 0x06621b16, 0x02641b01, 0x06641b16, 0x02661b01, 0x06661b16,
+        0x02671b01, 0x06671b16, 0x02681b01, 0x06681b16, 0x026c1b01, 0x066c1b16,
+        0x026d1b01, 0x066d1b16, 0x026e1b01, 0x066e1b16, 0x02701b01, 0x06701b16,
+        0x02721b01, 0x06721b16, 0x02751b01, 0x06751b16, 0x063a1b00, 0x06421b00,
+        0x06431b00, 0x06441b00, 0x06451b00, 0x06461b00, 0x06471b00, 0x06481b00,
+        0x06491b00, 0x064a1b00, 0x064b1b00, 0x064c1b00, 0x064d1b00, 0x064e1b00,
+        0x064f1b00, 0x06501b00, 0x06511b00, 0x06521b00, 0x06531b00, 0x06541b00,
+        0x06551b00, 0x06561b00, 0x06571b00, 0x06591b00, 0x066a1b00, 0x066b1b00,
+        0x06711b00, 0x06761b00, 0x06771b00, 0x06781b00, 0x06791b00, 0x067a1b00,
+        0x01001b46, 0x01001b47, 0x01001b49, 0x05001b4a
+    },
+    /* 246 */
+    {
+        0x06301c00, 0x06311c00, 0x06321c00, 0x06611c00, 0x06631c00, 0x06651c00,
+        0x06691c00, 0x066f1c00, 0x06731c00, 0x06741c00, 0x01001c0d, 0x01001c0e,
+        0x01001c11, 0x01001c12, 0x01001c14, 0x01001c15, 0x01001c1a, 0x01001c1b,
+        0x01001c1d, 0x01001c1e, 0x01001c21, 0x01001c22, 0x01001c24, 0x01001c25,
+        0x01001c2b, 0x01001c2e, 0x01001c32, 0x01001c35, 0x01001c3a, 0x01001c3d,
+        0x01001c41, 0x05001c44, 0x06301d00, 0x06311d00, 0x06321d00, 0x06611d00,
+        0x06631d00, 0x06651d00, 0x06691d00, 0x066f1d00, 0x06731d00, 0x06741d00,
+        0x01001d0d, 0x01001d0e, 0x01001d11, 0x01001d12, 0x01001d14, 0x01001d15,
+        0x01001d1a, 0x01001d1b, 0x01001d1d, 0x01001d1e, 0x01001d21, 0x01001d22,
+        0x01001d24, 0x01001d25, 0x01001d2b, 0x01001d2e, 0x01001d32, 0x01001d35,
+        0x01001d3a, 0x01001d3d, 0x01001d41, 0x05001d44, 0x06301e00, 0x06311e00,
+        0x06321e00, 0x06611e00, 0x06631e00, 0x06651e00, 0x06691e00, 0x066f1e00,
+        0x06731e00, 0x06741e00, 0x01001e0d, 0x01001e0e, 0x01001e11, 0x01001e12,
+        0x01001e14, 0x01001e15, 0x01001e1a, 0x01001e1b, 0x01001e1d, 0x01001e1e,
+        0x01001e21, 0x01001e22, 0x01001e24, 0x01001e25, 0x01001e2b, 0x01001e2e,
+        0x01001e32, 0x01001e35, 0x01001e3a, 0x01001e3d, 0x01001e41, 0x05001e44,
+        0x06301f00, 0x06311f00, 0x06321f00, 0x06611f00, 0x06631f00, 0x06651f00,
+        0x06691f00, 0x066f1f00, 0x06731f00, 0x06741f00, 0x01001f0d, 0x01001f0e,
+        0x01001f11, 0x01001f12, 0x01001f14, 0x01001f15, 0x01001f1a, 0x01001f1b,
+        0x01001f1d, 0x01001f1e, 0x01001f21, 0x01001f22, 0x01001f24, 0x01001f25,
+        0x01001f2b, 0x01001f2e, 0x01001f32, 0x01001f35, 0x01001f3a, 0x01001f3d,
+        0x01001f41, 0x05001f44, 0x06307f00, 0x06317f00, 0x06327f00, 0x06617f00,
+        0x06637f00, 0x06657f00, 0x06697f00, 0x066f7f00, 0x06737f00, 0x06747f00,
+        0x01007f0d, 0x01007f0e, 0x01007f11, 0x01007f12, 0x01007f14, 0x01007f15,
+        0x01007f1a, 0x01007f1b, 0x01007f1d, 0x01007f1e, 0x01007f21, 0x01007f22,
+        0x01007f24, 0x01007f25, 0x01007f2b, 0x01007f2e, 0x01007f32, 0x01007f35,
+        0x01007f3a, 0x01007f3d, 0x01007f41, 0x05007f44, 0x0630dc00, 0x0631dc00,
+        0x0632dc00, 0x0661dc00, 0x0663dc00, 0x0665dc00, 0x0669dc00, 0x066fdc00,
+        0x0673dc00, 0x0674dc00, 0x0100dc0d, 0x0100dc0e, 0x0100dc11, 0x0100dc12,
+        0x0100dc14, 0x0100dc15, 0x0100dc1a, 0x0100dc1b, 0x0100dc1d, 0x0100dc1e,
+        0x0100dc21, 0x0100dc22, 0x0100dc24, 0x0100dc25, 0x0100dc2b, 0x0100dc2e,
+        0x0100dc32, 0x0100dc35, 0x0100dc3a, 0x0100dc3d, 0x0100dc41, 0x0500dc44,
+        0x0630f900, 0x0631f900, 0x0632f900, 0x0661f900, 0x0663f900, 0x0665f900,
+        0x0669f900, 0x066ff900, 0x0673f900, 0x0674f900, 0x0100f90d, 0x0100f90e,
+        0x0100f911, 0x0100f912, 0x0100f914, 0x0100f915, 0x0100f91a, 0x0100f91b,
+        0x0100f91d, 0x0100f91e, 0x0100f921, 0x0100f922, 0x0100f924, 0x0100f925,
+        0x0100f92b, 0x0100f92e, 0x0100f932, 0x0100f935, 0x0100f93a, 0x0100f93d,
+        0x0100f941, 0x0500f944, 0x01000a03, 0x01000a06, 0x01000a0a, 0x01000a0f,
+        0x01000a18, 0x01000a1f, 0x01000a29, 0x05000a38, 0x01000d03, 0x01000d06,
+        0x01000d0a, 0x01000d0f, 0x01000d18, 0x01000d1f, 0x01000d29, 0x05000d38,
+        0x01001603, 0x01001606, 0x0100160a, 0x0100160f, 0x01001618, 0x0100161f,
+        0x01001629, 0x05001638, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000
+    },
+    /* 247 */
+    {
+        0x02301c01, 0x06301c16, 0x02311c01, 0x06311c16, 0x02321c01, 0x06321c16,
+        0x02611c01, 0x06611c16, 0x02631c01, 0x06631c16, 0x02651c01, 0x06651c16,
+        0x02691c01, 0x06691c16, 0x026f1c01, 0x066f1c16, 0x02731c01, 0x06731c16,
+        0x02741c01, 0x06741c16, 0x06201c00, 0x06251c00, 0x062d1c00, 0x062e1c00,
+        0x062f1c00, 0x06331c00, 0x06341c00, 0x06351c00, 0x06361c00, 0x06371c00,
+        0x06381c00, 0x06391c00, 0x063d1c00, 0x06411c00, 0x065f1c00, 0x06621c00,
+        0x06641c00, 0x06661c00, 0x06671c00, 0x06681c00, 0x066c1c00, 0x066d1c00,
+        0x066e1c00, 0x06701c00, 0x06721c00, 0x06751c00, 0x01001c26, 0x01001c27,
+        0x01001c2c, 0x01001c2d, 0x01001c2f, 0x01001c30, 0x01001c33, 0x01001c34,
+        0x01001c36, 0x01001c37, 0x01001c3b, 0x01001c3c, 0x01001c3e, 0x01001c3f,
+        0x01001c42, 0x01001c43, 0x01001c45, 0x05001c48, 0x02301d01, 0x06301d16,
+        0x02311d01, 0x06311d16, 0x02321d01, 0x06321d16, 0x02611d01, 0x06611d16,
+        0x02631d01, 0x06631d16, 0x02651d01, 0x06651d16, 0x02691d01, 0x06691d16,
+        0x026f1d01, 0x066f1d16, 0x02731d01, 0x06731d16, 0x02741d01, 0x06741d16,
+        0x06201d00, 0x06251d00, 0x062d1d00, 0x062e1d00, 0x062f1d00, 0x06331d00,
+        0x06341d00, 0x06351d00, 0x06361d00, 0x06371d00, 0x06381d00, 0x06391d00,
+        0x063d1d00, 0x06411d00, 0x065f1d00, 0x06621d00, 0x06641d00, 0x06661d00,
+        0x06671d00, 0x06681d00, 0x066c1d00, 0x066d1d00, 0x066e1d00, 0x06701d00,
+        0x06721d00, 0x06751d00, 0x01001d26, 0x01001d27, 0x01001d2c, 0x01001d2d,
+        0x01001d2f, 0x01001d30, 0x01001d33, 0x01001d34, 0x01001d36, 0x01001d37,
+        0x01001d3b, 0x01001d3c, 0x01001d3e, 0x01001d3f, 0x01001d42, 0x01001d43,
+        0x01001d45, 0x05001d48, 0x02301e01, 0x06301e16, 0x02311e01, 0x06311e16,
+        0x02321e01, 0x06321e16, 0x02611e01, 0x06611e16, 0x02631e01, 0x06631e16,
+        0x02651e01, 0x06651e16, 0x02691e01, 0x06691e16, 0x026f1e01, 0x066f1e16,
+        0x02731e01, 0x06731e16, 0x02741e01, 0x06741e16, 0x06201e00, 0x06251e00,
+        0x062d1e00, 0x062e1e00, 0x062f1e00, 0x06331e00, 0x06341e00, 0x06351e00,
+        0x06361e00, 0x06371e00, 0x06381e00, 0x06391e00, 0x063d1e00, 0x06411e00,
+        0x065f1e00, 0x06621e00, 0x06641e00, 0x06661e00, 0x06671e00, 0x06681e00,
+        0x066c1e00, 0x066d1e00, 0x066e1e00, 0x06701e00, 0x06721e00, 0x06751e00,
+        0x01001e26, 0x01001e27, 0x01001e2c, 0x01001e2d, 0x01001e2f, 0x01001e30,
+        0x01001e33, 0x01001e34, 0x01001e36, 0x01001e37, 0x01001e3b, 0x01001e3c,
+        0x01001e3e, 0x01001e3f, 0x01001e42, 0x01001e43, 0x01001e45, 0x05001e48,
+        0x02301f01, 0x06301f16, 0x02311f01, 0x06311f16, 0x02321f01, 0x06321f16,
+        0x02611f01, 0x06611f16, 0x02631f01, 0x06631f16, 0x02651f01, 0x06651f16,
+        0x02691f01, 0x06691f16, 0x026f1f01, 0x066f1f16, 0x02731f01, 0x06731f16,
+        0x02741f01, 0x06741f16, 0x06201f00, 0x06251f00, 0x062d1f00, 0x062e1f00,
+        0x062f1f00, 0x06331f00, 0x06341f00, 0x06351f00, 0x06361f00, 0x06371f00,
+        0x06381f00, 0x06391f00, 0x063d1f00, 0x06411f00, 0x065f1f00, 0x06621f00,
+        0x06641f00, 0x06661f00, 0x06671f00, 0x06681f00, 0x066c1f00, 0x066d1f00,
+        0x066e1f00, 0x06701f00, 0x06721f00, 0x06751f00, 0x01001f26, 0x01001f27,
+        0x01001f2c, 0x01001f2d, 0x01001f2f, 0x01001f30, 0x01001f33, 0x01001f34,
+        0x01001f36, 0x01001f37, 0x01001f3b, 0x01001f3c, 0x01001f3e, 0x01001f3f,
+        0x01001f42, 0x01001f43, 0x01001f45, 0x05001f48
+    },
+    /* 248 */
+    {
+        0x02301c02, 0x02301c09, 0x02301c17, 0x06301c28, 0x02311c02, 0x02311c09,
+        0x02311c17, 0x06311c28, 0x02321c02, 0x02321c09, 0x02321c17, 0x06321c28,
+        0x02611c02, 0x02611c09, 0x02611c17, 0x06611c28, 0x02631c02, 0x02631c09,
+        0x02631c17, 0x06631c28, 0x02651c02, 0x02651c09, 0x02651c17, 0x06651c28,
+        0x02691c02, 0x02691c09, 0x02691c17, 0x06691c28, 0x026f1c02, 0x026f1c09,
+        0x026f1c17, 0x066f1c28, 0x02731c02, 0x02731c09, 0x02731c17, 0x06731c28,
+        0x02741c02, 0x02741c09, 0x02741c17, 0x06741c28, 0x02201c01, 0x06201c16,
+        0x02251c01, 0x06251c16, 0x022d1c01, 0x062d1c16, 0x022e1c01, 0x062e1c16,
+        0x022f1c01, 0x062f1c16, 0x02331c01, 0x06331c16, 0x02341c01, 0x06341c16,
+        0x02351c01, 0x06351c16, 0x02361c01, 0x06361c16, 0x02371c01, 0x06371c16,
+        0x02381c01, 0x06381c16, 0x02391c01, 0x06391c16, 0x023d1c01, 0x063d1c16,
+        0x02411c01, 0x06411c16, 0x025f1c01, 0x065f1c16, 0x02621c01, 0x06621c16,
+        0x02641c01, 0x06641c16, 0x02661c01, 0x06661c16, 0x02671c01, 0x06671c16,
+        0x02681c01, 0x06681c16, 0x026c1c01, 0x066c1c16, 0x026d1c01, 0x066d1c16,
+        0x026e1c01, 0x066e1c16, 0x02701c01, 0x06701c16, 0x02721c01, 0x06721c16,
+        0x02751c01, 0x06751c16, 0x063a1c00, 0x06421c00, 0x06431c00, 0x06441c00,
+        0x06451c00, 0x06461c00, 0x06471c00, 0x06481c00, 0x06491c00, 0x064a1c00,
+        0x064b1c00, 0x064c1c00, 0x064d1c00, 0x064e1c00, 0x064f1c00, 0x06501c00,
+        0x06511c00, 0x06521c00, 0x06531c00, 0x06541c00, 0x06551c00, 0x06561c00,
+        0x06571c00, 0x06591c00, 0x066a1c00, 0x066b1c00, 0x06711c00, 0x06761c00,
+        0x06771c00, 0x06781c00, 0x06791c00, 0x067a1c00, 0x01001c46, 0x01001c47,
+        0x01001c49, 0x05001c4a, 0x02301d02, 0x02301d09, 0x02301d17, 0x06301d28,
+        0x02311d02, 0x02311d09, 0x02311d17, 0x06311d28, 0x02321d02, 0x02321d09,
+        0x02321d17, 0x06321d28, 0x02611d02, 0x02611d09, 0x02611d17, 0x06611d28,
+        0x02631d02, 0x02631d09, 0x02631d17, 0x06631d28, 0x02651d02, 0x02651d09,
+        0x02651d17, 0x06651d28, 0x02691d02, 0x02691d09, 0x02691d17, 0x06691d28,
+        0x026f1d02, 0x026f1d09, 0x026f1d17, 0x066f1d28, 0x02731d02, 0x02731d09,
+        0x02731d17, 0x06731d28, 0x02741d02, 0x02741d09, 0x02741d17, 0x06741d28,
+        0x02201d01, 0x06201d16, 0x02251d01, 0x06251d16, 0x022d1d01, 0x062d1d16,
+        0x022e1d01, 0x062e1d16, 0x022f1d01, 0x062f1d16, 0x02331d01, 0x06331d16,
+        0x02341d01, 0x06341d16, 0x02351d01, 0x06351d16, 0x02361d01, 0x06361d16,
+        0x02371d01, 0x06371d16, 0x02381d01, 0x06381d16, 0x02391d01, 0x06391d16,
+        0x023d1d01, 0x063d1d16, 0x02411d01, 0x06411d16, 0x025f1d01, 0x065f1d16,
+        0x02621d01, 0x06621d16, 0x02641d01, 0x06641d16, 0x02661d01, 0x06661d16,
+        0x02671d01, 0x06671d16, 0x02681d01, 0x06681d16, 0x026c1d01, 0x066c1d16,
+        0x026d1d01, 0x066d1d16, 0x026e1d01, 0x066e1d16, 0x02701d01, 0x06701d16,
+        0x02721d01, 0x06721d16, 0x02751d01, 0x06751d16, 0x063a1d00, 0x06421d00,
+        0x06431d00, 0x06441d00, 0x06451d00, 0x06461d00, 0x06471d00, 0x06481d00,
+        0x06491d00, 0x064a1d00, 0x064b1d00, 0x064c1d00, 0x064d1d00, 0x064e1d00,
+        0x064f1d00, 0x06501d00, 0x06511d00, 0x06521d00, 0x06531d00, 0x06541d00,
+        0x06551d00, 0x06561d00, 0x06571d00, 0x06591d00, 0x066a1d00, 0x066b1d00,
+        0x06711d00, 0x06761d00, 0x06771d00, 0x06781d00, 0x06791d00, 0x067a1d00,
+        0x01001d46, 0x01001d47, 0x01001d49, 0x05001d4a
+    },
+    /* 249 */
+    {
+        0x02301e02, 0x02301e09, 0x02301e17, 0x06301e28, 0x02311e02, 0x02311e09,
+        0x02311e17, 0x06311e28, 0x02321e02, 0x02321e09, 0x02321e17, 0x06321e28,
+        0x02611e02, 0x02611e09, 0x02611e17, 0x06611e28, 0x02631e02, 0x02631e09,
+        0x02631e17, 0x06631e28, 0x02651e02, 0x02651e09, 0x02651e17, 0x06651e28,
+        0x02691e02, 0x02691e09, 0x02691e17, 0x06691e28, 0x026f1e02, 0x026f1e09,
+        0x026f1e17, 0x066f1e28, 0x02731e02, 0x02731e09, 0x02731e17, 0x06731e28,
+        0x02741e02, 0x02741e09, 0x02741e17, 0x06741e28, 0x02201e01, 0x06201e16,
+        0x02251e01, 0x06251e16, 0x022d1e01, 0x062d1e16, 0x022e1e01, 0x062e1e16,
+        0x022f1e01, 0x062f1e16, 0x02331e01, 0x06331e16, 0x02341e01, 0x06341e16,
+        0x02351e01, 0x06351e16, 0x02361e01, 0x06361e16, 0x02371e01, 0x06371e16,
+        0x02381e01, 0x06381e16, 0x02391e01, 0x06391e16, 0x023d1e01, 0x063d1e16,
+        0x02411e01, 0x06411e16, 0x025f1e01, 0x065f1e16, 0x02621e01, 0x06621e16,
+        0x02641e01, 0x06641e16, 0x02661e01, 0x06661e16, 0x02671e01, 0x06671e16,
+        0x02681e01, 0x06681e16, 0x026c1e01, 0x066c1e16, 0x026d1e01, 0x066d1e16,
+        0x026e1e01, 0x066e1e16, 0x02701e01, 0x06701e16, 0x02721e01, 0x06721e16,
+        0x02751e01, 0x06751e16, 0x063a1e00, 0x06421e00, 0x06431e00, 0x06441e00,
+        0x06451e00, 0x06461e00, 0x06471e00, 0x06481e00, 0x06491e00, 0x064a1e00,
+        0x064b1e00, 0x064c1e00, 0x064d1e00, 0x064e1e00, 0x064f1e00, 0x06501e00,
+        0x06511e00, 0x06521e00, 0x06531e00, 0x06541e00, 0x06551e00, 0x06561e00,
+        0x06571e00, 0x06591e00, 0x066a1e00, 0x066b1e00, 0x06711e00, 0x06761e00,
+        0x06771e00, 0x06781e00, 0x06791e00, 0x067a1e00, 0x01001e46, 0x01001e47,
+        0x01001e49, 0x05001e4a, 0x02301f02, 0x02301f09, 0x02301f17, 0x06301f28,
+        0x02311f02, 0x02311f09, 0x02311f17, 0x06311f28, 0x02321f02, 0x02321f09,
+        0x02321f17, 0x06321f28, 0x02611f02, 0x02611f09, 0x02611f17, 0x06611f28,
+        0x02631f02, 0x02631f09, 0x02631f17, 0x06631f28, 0x02651f02, 0x02651f09,
+        0x02651f17, 0x06651f28, 0x02691f02, 0x02691f09, 0x02691f17, 0x06691f28,
+        0x026f1f02, 0x026f1f09, 0x026f1f17, 0x066f1f28, 0x02731f02, 0x02731f09,
+        0x02731f17, 0x06731f28, 0x02741f02, 0x02741f09, 0x02741f17, 0x06741f28,
+        0x02201f01, 0x06201f16, 0x02251f01, 0x06251f16, 0x022d1f01, 0x062d1f16,
+        0x022e1f01, 0x062e1f16, 0x022f1f01, 0x062f1f16, 0x02331f01, 0x06331f16,
+        0x02341f01, 0x06341f16, 0x02351f01, 0x06351f16, 0x02361f01, 0x06361f16,
+        0x02371f01, 0x06371f16, 0x02381f01, 0x06381f16, 0x02391f01, 0x06391f16,
+        0x023d1f01, 0x063d1f16, 0x02411f01, 0x06411f16, 0x025f1f01, 0x065f1f16,
+        0x02621f01, 0x06621f16, 0x02641f01, 0x06641f16, 0x02661f01, 0x06661f16,
+        0x02671f01, 0x06671f16, 0x02681f01, 0x06681f16, 0x026c1f01, 0x066c1f16,
+        0x026d1f01, 0x066d1f16, 0x026e1f01, 0x066e1f16, 0x02701f01, 0x06701f16,
+        0x02721f01, 0x06721f16, 0x02751f01, 0x06751f16, 0x063a1f00, 0x06421f00,
+        0x06431f00, 0x06441f00, 0x06451f00, 0x06461f00, 0x06471f00, 0x06481f00,
+        0x06491f00, 0x064a1f00, 0x064b1f00, 0x064c1f00, 0x064d1f00, 0x064e1f00,
+        0x064f1f00, 0x06501f00, 0x06511f00, 0x06521f00, 0x06531f00, 0x06541f00,
+        0x06551f00, 0x06561f00, 0x06571f00, 0x06591f00, 0x066a1f00, 0x066b1f00,
+        0x06711f00, 0x06761f00, 0x06771f00, 0x06781f00, 0x06791f00, 0x067a1f00,
+        0x01001f46, 0x01001f47, 0x01001f49, 0x05001f4a
+    },
+    /* 250 */
+    {
+        0x02307f01, 0x06307f16, 0x02317f01, 0x06317f16, 0x02327f01, 0x06327f16,
+        0x02617f01, 0x06617f16, 0x02637f01, 0x06637f16, 0x02657f01, 0x06657f16,
+        0x02697f01, 0x06697f16, 0x026f7f01, 0x066f7f16, 0x02737f01, 0x06737f16,
+        0x02747f01, 0x06747f16, 0x06207f00, 0x06257f00, 0x062d7f00, 0x062e7f00,
+        0x062f7f00, 0x06337f00, 0x06347f00, 0x06357f00, 0x06367f00, 0x06377f00,
+        0x06387f00, 0x06397f00, 0x063d7f00, 0x06417f00, 0x065f7f00, 0x06627f00,
+        0x06647f00, 0x06667f00, 0x06677f00, 0x06687f00, 0x066c7f00, 0x066d7f00,
+        0x066e7f00, 0x06707f00, 0x06727f00, 0x06757f00, 0x01007f26, 0x01007f27,
+        0x01007f2c, 0x01007f2d, 0x01007f2f, 0x01007f30, 0x01007f33, 0x01007f34,
+        0x01007f36, 0x01007f37, 0x01007f3b, 0x01007f3c, 0x01007f3e, 0x01007f3f,
+        0x01007f42, 0x01007f43, 0x01007f45, 0x05007f48, 0x0230dc01, 0x0630dc16,
+        0x0231dc01, 0x0631dc16, 0x0232dc01, 0x0632dc16, 0x0261dc01, 0x0661dc16,
+        0x0263dc01, 0x0663dc16, 0x0265dc01, 0x0665dc16, 0x0269dc01, 0x0669dc16,
+        0x026fdc01, 0x066fdc16, 0x0273dc01, 0x0673dc16, 0x0274dc01, 0x0674dc16,
+        0x0620dc00, 0x0625dc00, 0x062ddc00, 0x062edc00, 0x062fdc00, 0x0633dc00,
+        0x0634dc00, 0x0635dc00, 0x0636dc00, 0x0637dc00, 0x0638dc00, 0x0639dc00,
+        0x063ddc00, 0x0641dc00, 0x065fdc00, 0x0662dc00, 0x0664dc00, 0x0666dc00,
+        0x0667dc00, 0x0668dc00, 0x066cdc00, 0x066ddc00, 0x066edc00, 0x0670dc00,
+        0x0672dc00, 0x0675dc00, 0x0100dc26, 0x0100dc27, 0x0100dc2c, 0x0100dc2d,
+        0x0100dc2f, 0x0100dc30, 0x0100dc33, 0x0100dc34, 0x0100dc36, 0x0100dc37,
+        0x0100dc3b, 0x0100dc3c, 0x0100dc3e, 0x0100dc3f, 0x0100dc42, 0x0100dc43,
+        0x0100dc45, 0x0500dc48, 0x0230f901, 0x0630f916, 0x0231f901, 0x0631f916,
+        0x0232f901, 0x0632f916, 0x0261f901, 0x0661f916, 0x0263f901, 0x0663f916,
+        0x0265f901, 0x0665f916, 0x0269f901, 0x0669f916, 0x026ff901, 0x066ff916,
+        0x0273f901, 0x0673f916, 0x0274f901, 0x0674f916, 0x0620f900, 0x0625f900,
+        0x062df900, 0x062ef900, 0x062ff900, 0x0633f900, 0x0634f900, 0x0635f900,
+        0x0636f900, 0x0637f900, 0x0638f900, 0x0639f900, 0x063df900, 0x0641f900,
+        0x065ff900, 0x0662f900, 0x0664f900, 0x0666f900, 0x0667f900, 0x0668f900,
+        0x066cf900, 0x066df900, 0x066ef900, 0x0670f900, 0x0672f900, 0x0675f900,
+        0x0100f926, 0x0100f927, 0x0100f92c, 0x0100f92d, 0x0100f92f, 0x0100f930,
+        0x0100f933, 0x0100f934, 0x0100f936, 0x0100f937, 0x0100f93b, 0x0100f93c,
+        0x0100f93e, 0x0100f93f, 0x0100f942, 0x0100f943, 0x0100f945, 0x0500f948,
+        0x01000a04, 0x01000a05, 0x01000a07, 0x01000a08, 0x01000a0b, 0x01000a0c,
+        0x01000a10, 0x01000a13, 0x01000a19, 0x01000a1c, 0x01000a20, 0x01000a23,
+        0x01000a2a, 0x01000a31, 0x01000a39, 0x05000a40, 0x01000d04, 0x01000d05,
+        0x01000d07, 0x01000d08, 0x01000d0b, 0x01000d0c, 0x01000d10, 0x01000d13,
+        0x01000d19, 0x01000d1c, 0x01000d20, 0x01000d23, 0x01000d2a, 0x01000d31,
+        0x01000d39, 0x05000d40, 0x01001604, 0x01001605, 0x01001607, 0x01001608,
+        0x0100160b, 0x0100160c, 0x01001610, 0x01001613, 0x01001619, 0x0100161c,
+        0x01001620, 0x01001623, 0x0100162a, 0x01001631, 0x01001639, 0x05001640,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000
+    },
+    /* 251 */
+    {
+        0x02307f02, 0x02307f09, 0x02307f17, 0x06307f28, 0x02317f02, 0x02317f09,
+        0x02317f17, 0x06317f28, 0x02327f02, 0x02327f09, 0x02327f17, 0x06327f28,
+        0x02617f02, 0x02617f09, 0x02617f17, 0x06617f28, 0x02637f02, 0x02637f09,
+        0x02637f17, 0x06637f28, 0x02657f02, 0x02657f09, 0x02657f17, 0x06657f28,
+        0x02697f02, 0x02697f09, 0x02697f17, 0x06697f28, 0x026f7f02, 0x026f7f09,
+        0x026f7f17, 0x066f7f28, 0x02737f02, 0x02737f09, 0x02737f17, 0x06737f28,
+        0x02747f02, 0x02747f09, 0x02747f17, 0x06747f28, 0x02207f01, 0x06207f16,
+        0x02257f01, 0x06257f16, 0x022d7f01, 0x062d7f16, 0x022e7f01, 0x062e7f16,
+        0x022f7f01, 0x062f7f16, 0x02337f01, 0x06337f16, 0x02347f01, 0x06347f16,
+        0x02357f01, 0x06357f16, 0x02367f01, 0x06367f16, 0x02377f01, 0x06377f16,
+        0x02387f01, 0x06387f16, 0x02397f01, 0x06397f16, 0x023d7f01, 0x063d7f16,
+        0x02417f01, 0x06417f16, 0x025f7f01, 0x065f7f16, 0x02627f01, 0x06627f16,
+        0x02647f01, 0x06647f16, 0x02667f01, 0x06667f16, 0x02677f01, 0x06677f16,
+        0x02687f01, 0x06687f16, 0x026c7f01, 0x066c7f16, 0x026d7f01, 0x066d7f16,
+        0x026e7f01, 0x066e7f16, 0x02707f01, 0x06707f16, 0x02727f01, 0x06727f16,
+        0x02757f01, 0x06757f16, 0x063a7f00, 0x06427f00, 0x06437f00, 0x06447f00,
+        0x06457f00, 0x06467f00, 0x06477f00, 0x06487f00, 0x06497f00, 0x064a7f00,
+        0x064b7f00, 0x064c7f00, 0x064d7f00, 0x064e7f00, 0x064f7f00, 0x06507f00,
+        0x06517f00, 0x06527f00, 0x06537f00, 0x06547f00, 0x06557f00, 0x06567f00,
+        0x06577f00, 0x06597f00, 0x066a7f00, 0x066b7f00, 0x06717f00, 0x06767f00,
+        0x06777f00, 0x06787f00, 0x06797f00, 0x067a7f00, 0x01007f46, 0x01007f47,
+        0x01007f49, 0x05007f4a, 0x0230dc02, 0x0230dc09, 0x0230dc17, 0x0630dc28,
+        0x0231dc02, 0x0231dc09, 0x0231dc17, 0x0631dc28, 0x0232dc02, 0x0232dc09,
+        0x0232dc17, 0x0632dc28, 0x0261dc02, 0x0261dc09, 0x0261dc17, 0x0661dc28,
+        0x0263dc02, 0x0263dc09, 0x0263dc17, 0x0663dc28, 0x0265dc02, 0x0265dc09,
+        0x0265dc17, 0x0665dc28, 0x0269dc02, 0x0269dc09, 0x0269dc17, 0x0669dc28,
+        0x026fdc02, 0x026fdc09, 0x026fdc17, 0x066fdc28, 0x0273dc02, 0x0273dc09,
+        0x0273dc17, 0x0673dc28, 0x0274dc02, 0x0274dc09, 0x0274dc17, 0x0674dc28,
+        0x0220dc01, 0x0620dc16, 0x0225dc01, 0x0625dc16, 0x022ddc01, 0x062ddc16,
+        0x022edc01, 0x062edc16, 0x022fdc01, 0x062fdc16, 0x0233dc01, 0x0633dc16,
+        0x0234dc01, 0x0634dc16, 0x0235dc01, 0x0635dc16, 0x0236dc01, 0x0636dc16,
+        0x0237dc01, 0x0637dc16, 0x0238dc01, 0x0638dc16, 0x0239dc01, 0x0639dc16,
+        0x023ddc01, 0x063ddc16, 0x0241dc01, 0x0641dc16, 0x025fdc01, 0x065fdc16,
+        0x0262dc01, 0x0662dc16, 0x0264dc01, 0x0664dc16, 0x0266dc01, 0x0666dc16,
+        0x0267dc01, 0x0667dc16, 0x0268dc01, 0x0668dc16, 0x026cdc01, 0x066cdc16,
+        0x026ddc01, 0x066ddc16, 0x026edc01, 0x066edc16, 0x0270dc01, 0x0670dc16,
+        0x0272dc01, 0x0672dc16, 0x0275dc01, 0x0675dc16, 0x063adc00, 0x0642dc00,
+        0x0643dc00, 0x0644dc00, 0x0645dc00, 0x0646dc00, 0x0647dc00, 0x0648dc00,
+        0x0649dc00, 0x064adc00, 0x064bdc00, 0x064cdc00, 0x064ddc00, 0x064edc00,
+        0x064fdc00, 0x0650dc00, 0x0651dc00, 0x0652dc00, 0x0653dc00, 0x0654dc00,
+        0x0655dc00, 0x0656dc00, 0x0657dc00, 0x0659dc00, 0x066adc00, 0x066bdc00,
+        0x0671dc00, 0x0676dc00, 0x0677dc00, 0x0678dc00, 0x0679dc00, 0x067adc00,
+        0x0100dc46, 0x0100dc47, 0x0100dc49, 0x0500dc4a
+    },
+    /* 252 */
+    {
+        0x0230f902, 0x0230f909, 0x0230f917, 0x0630f928, 0x0231f902, 0x0231f909,
+        0x0231f917, 0x0631f928, 0x0232f902, 0x0232f909, 0x0232f917, 0x0632f928,
+        0x0261f902, 0x0261f909, 0x0261f917, 0x0661f928, 0x0263f902, 0x0263f909,
+        0x0263f917, 0x0663f928, 0x0265f902, 0x0265f909, 0x0265f917, 0x0665f928,
+        0x0269f902, 0x0269f909, 0x0269f917, 0x0669f928, 0x026ff902, 0x026ff909,
+        0x026ff917, 0x066ff928, 0x0273f902, 0x0273f909, 0x0273f917, 0x0673f928,
+        0x0274f902, 0x0274f909, 0x0274f917, 0x0674f928, 0x0220f901, 0x0620f916,
+        0x0225f901, 0x0625f916, 0x022df901, 0x062df916, 0x022ef901, 0x062ef916,
+        0x022ff901, 0x062ff916, 0x0233f901, 0x0633f916, 0x0234f901, 0x0634f916,
+        0x0235f901, 0x0635f916, 0x0236f901, 0x0636f916, 0x0237f901, 0x0637f916,
+        0x0238f901, 0x0638f916, 0x0239f901, 0x0639f916, 0x023df901, 0x063df916,
+        0x0241f901, 0x0641f916, 0x025ff901, 0x065ff916, 0x0262f901, 0x0662f916,
+        0x0264f901, 0x0664f916, 0x0266f901, 0x0666f916, 0x0267f901, 0x0667f916,
+        0x0268f901, 0x0668f916, 0x026cf901, 0x066cf916, 0x026df901, 0x066df916,
+        0x026ef901, 0x066ef916, 0x0270f901, 0x0670f916, 0x0272f901, 0x0672f916,
+        0x0275f901, 0x0675f916, 0x063af900, 0x0642f900, 0x0643f900, 0x0644f900,
+        0x0645f900, 0x0646f900, 0x0647f900, 0x0648f900, 0x0649f900, 0x064af900,
+        0x064bf900, 0x064cf900, 0x064df900, 0x064ef900, 0x064ff900, 0x0650f900,
+        0x0651f900, 0x0652f900, 0x0653f900, 0x0654f900, 0x0655f900, 0x0656f900,
+        0x0657f900, 0x0659f900, 0x066af900, 0x066bf900, 0x0671f900, 0x0676f900,
+        0x0677f900, 0x0678f900, 0x0679f900, 0x067af900, 0x0100f946, 0x0100f947,
+        0x0100f949, 0x0500f94a, 0x06300a00, 0x06310a00, 0x06320a00, 0x06610a00,
+        0x06630a00, 0x06650a00, 0x06690a00, 0x066f0a00, 0x06730a00, 0x06740a00,
+        0x01000a0d, 0x01000a0e, 0x01000a11, 0x01000a12, 0x01000a14, 0x01000a15,
+        0x01000a1a, 0x01000a1b, 0x01000a1d, 0x01000a1e, 0x01000a21, 0x01000a22,
+        0x01000a24, 0x01000a25, 0x01000a2b, 0x01000a2e, 0x01000a32, 0x01000a35,
+        0x01000a3a, 0x01000a3d, 0x01000a41, 0x05000a44, 0x06300d00, 0x06310d00,
+        0x06320d00, 0x06610d00, 0x06630d00, 0x06650d00, 0x06690d00, 0x066f0d00,
+        0x06730d00, 0x06740d00, 0x01000d0d, 0x01000d0e, 0x01000d11, 0x01000d12,
+        0x01000d14, 0x01000d15, 0x01000d1a, 0x01000d1b, 0x01000d1d, 0x01000d1e,
+        0x01000d21, 0x01000d22, 0x01000d24, 0x01000d25, 0x01000d2b, 0x01000d2e,
+        0x01000d32, 0x01000d35, 0x01000d3a, 0x01000d3d, 0x01000d41, 0x05000d44,
+        0x06301600, 0x06311600, 0x06321600, 0x06611600, 0x06631600, 0x06651600,
+        0x06691600, 0x066f1600, 0x06731600, 0x06741600, 0x0100160d, 0x0100160e,
+        0x01001611, 0x01001612, 0x01001614, 0x01001615, 0x0100161a, 0x0100161b,
+        0x0100161d, 0x0100161e, 0x01001621, 0x01001622, 0x01001624, 0x01001625,
+        0x0100162b, 0x0100162e, 0x01001632, 0x01001635, 0x0100163a, 0x0100163d,
+        0x01001641, 0x05001644, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000
+    },
+    /* 253 */
+    {
+        0x02300a01, 0x06300a16, 0x02310a01, 0x06310a16, 0x02320a01, 0x06320a16,
+        0x02610a01, 0x06610a16, 0x02630a01, 0x06630a16, 0x02650a01, 0x06650a16,
+        0x02690a01, 0x06690a16, 0x026f0a01, 0x066f0a16, 0x02730a01, 0x06730a16,
+        0x02740a01, 0x06740a16, 0x06200a00, 0x06250a00, 0x062d0a00, 0x062e0a00,
+        0x062f0a00, 0x06330a00, 0x06340a00, 0x06350a00, 0x06360a00, 0x06370a00,
+        0x06380a00, 0x06390a00, 0x063d0a00, 0x06410a00, 0x065f0a00, 0x06620a00,
+        0x06640a00, 0x06660a00, 0x06670a00, 0x06680a00, 0x066c0a00, 0x066d0a00,
+        0x066e0a00, 0x06700a00, 0x06720a00, 0x06750a00, 0x01000a26, 0x01000a27,
+        0x01000a2c, 0x01000a2d, 0x01000a2f, 0x01000a30, 0x01000a33, 0x01000a34,
+        0x01000a36, 0x01000a37, 0x01000a3b, 0x01000a3c, 0x01000a3e, 0x01000a3f,
+        0x01000a42, 0x01000a43, 0x01000a45, 0x05000a48, 0x02300d01, 0x06300d16,
+        0x02310d01, 0x06310d16, 0x02320d01, 0x06320d16, 0x02610d01, 0x06610d16,
+        0x02630d01, 0x06630d16, 0x02650d01, 0x06650d16, 0x02690d01, 0x06690d16,
+        0x026f0d01, 0x066f0d16, 0x02730d01, 0x06730d16, 0x02740d01, 0x06740d16,
+        0x06200d00, 0x06250d00, 0x062d0d00, 0x062e0d00, 0x062f0d00, 0x06330d00,
+        0x06340d00, 0x06350d00, 0x06360d00, 0x06370d00, 0x06380d00, 0x06390d00,
+        0x063d0d00, 0x06410d00, 0x065f0d00, 0x06620d00, 0x06640d00, 0x06660d00,
+        0x06670d00, 0x06680d00, 0x066c0d00, 0x066d0d00, 0x066e0d00, 0x06700d00,
+        0x06720d00, 0x06750d00, 0x01000d26, 0x01000d27, 0x01000d2c, 0x01000d2d,
+        0x01000d2f, 0x01000d30, 0x01000d33, 0x01000d34, 0x01000d36, 0x01000d37,
+        0x01000d3b, 0x01000d3c, 0x01000d3e, 0x01000d3f, 0x01000d42, 0x01000d43,
+        0x01000d45, 0x05000d48, 0x02301601, 0x06301616, 0x02311601, 0x06311616,
+        0x02321601, 0x06321616, 0x02611601, 0x06611616, 0x02631601, 0x06631616,
+        0x02651601, 0x06651616, 0x02691601, 0x06691616, 0x026f1601, 0x066f1616,
+        0x02731601, 0x06731616, 0x02741601, 0x06741616, 0x06201600, 0x06251600,
+        0x062d1600, 0x062e1600, 0x062f1600, 0x06331600, 0x06341600, 0x06351600,
+        0x06361600, 0x06371600, 0x06381600, 0x06391600, 0x063d1600, 0x06411600,
+        0x065f1600, 0x06621600, 0x06641600, 0x06661600, 0x06671600, 0x06681600,
+        0x066c1600, 0x066d1600, 0x066e1600, 0x06701600, 0x06721600, 0x06751600,
+        0x01001626, 0x01001627, 0x0100162c, 0x0100162d, 0x0100162f, 0x01001630,
+        0x01001633, 0x01001634, 0x01001636, 0x01001637, 0x0100163b, 0x0100163c,
+        0x0100163e, 0x0100163f, 0x01001642, 0x01001643, 0x01001645, 0x05001648,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000
+    },
+    /* 254 */
+    {
+        0x02300a02, 0x02300a09, 0x02300a17, 0x06300a28, 0x02310a02, 0x02310a09,
+        0x02310a17, 0x06310a28, 0x02320a02, 0x02320a09, 0x02320a17, 0x06320a28,
+        0x02610a02, 0x02610a09, 0x02610a17, 0x06610a28, 0x02630a02, 0x02630a09,
+        0x02630a17, 0x06630a28, 0x02650a02, 0x02650a09, 0x02650a17, 0x06650a28,
+        0x02690a02, 0x02690a09, 0x02690a17, 0x06690a28, 0x026f0a02, 0x026f0a09,
+        0x026f0a17, 0x066f0a28, 0x02730a02, 0x02730a09, 0x02730a17, 0x06730a28,
+        0x02740a02, 0x02740a09, 0x02740a17, 0x06740a28, 0x02200a01, 0x06200a16,
+        0x02250a01, 0x06250a16, 0x022d0a01, 0x062d0a16, 0x022e0a01, 0x062e0a16,
+        0x022f0a01, 0x062f0a16, 0x02330a01, 0x06330a16, 0x02340a01, 0x06340a16,
+        0x02350a01, 0x06350a16, 0x02360a01, 0x06360a16, 0x02370a01, 0x06370a16,
+        0x02380a01, 0x06380a16, 0x02390a01, 0x06390a16, 0x023d0a01, 0x063d0a16,
+        0x02410a01, 0x06410a16, 0x025f0a01, 0x065f0a16, 0x02620a01, 0x06620a16,
+        0x02640a01, 0x06640a16, 0x02660a01, 0x06660a16, 0x02670a01, 0x06670a16,
+        0x02680a01, 0x06680a16, 0x026c0a01, 0x066c0a16, 0x026d0a01, 0x066d0a16,
+        0x026e0a01, 0x066e0a16, 0x02700a01, 0x06700a16, 0x02720a01, 0x06720a16,
+        0x02750a01, 0x06750a16, 0x063a0a00, 0x06420a00, 0x06430a00, 0x06440a00,
+        0x06450a00, 0x06460a00, 0x06470a00, 0x06480a00, 0x06490a00, 0x064a0a00,
+        0x064b0a00, 0x064c0a00, 0x064d0a00, 0x064e0a00, 0x064f0a00, 0x06500a00,
+        0x06510a00, 0x06520a00, 0x06530a00, 0x06540a00, 0x06550a00, 0x06560a00,
+        0x06570a00, 0x06590a00, 0x066a0a00, 0x066b0a00, 0x06710a00, 0x06760a00,
+        0x06770a00, 0x06780a00, 0x06790a00, 0x067a0a00, 0x01000a46, 0x01000a47,
+        0x01000a49, 0x05000a4a, 0x02300d02, 0x02300d09, 0x02300d17, 0x06300d28,
+        0x02310d02, 0x02310d09, 0x02310d17, 0x06310d28, 0x02320d02, 0x02320d09,
+        0x02320d17, 0x06320d28, 0x02610d02, 0x02610d09, 0x02610d17, 0x06610d28,
+        0x02630d02, 0x02630d09, 0x02630d17, 0x06630d28, 0x02650d02, 0x02650d09,
+        0x02650d17, 0x06650d28, 0x02690d02, 0x02690d09, 0x02690d17, 0x06690d28,
+        0x026f0d02, 0x026f0d09, 0x026f0d17, 0x066f0d28, 0x02730d02, 0x02730d09,
+        0x02730d17, 0x06730d28, 0x02740d02, 0x02740d09, 0x02740d17, 0x06740d28,
+        0x02200d01, 0x06200d16, 0x02250d01, 0x06250d16, 0x022d0d01, 0x062d0d16,
+        0x022e0d01, 0x062e0d16, 0x022f0d01, 0x062f0d16, 0x02330d01, 0x06330d16,
+        0x02340d01, 0x06340d16, 0x02350d01, 0x06350d16, 0x02360d01, 0x06360d16,
+        0x02370d01, 0x06370d16, 0x02380d01, 0x06380d16, 0x02390d01, 0x06390d16,
+        0x023d0d01, 0x063d0d16, 0x02410d01, 0x06410d16, 0x025f0d01, 0x065f0d16,
+        0x02620d01, 0x06620d16, 0x02640d01, 0x06640d16, 0x02660d01, 0x06660d16,
+        0x02670d01, 0x06670d16, 0x02680d01, 0x06680d16, 0x026c0d01, 0x066c0d16,
+        0x026d0d01, 0x066d0d16, 0x026e0d01, 0x066e0d16, 0x02700d01, 0x06700d16,
+        0x02720d01, 0x06720d16, 0x02750d01, 0x06750d16, 0x063a0d00, 0x06420d00,
+        0x06430d00, 0x06440d00, 0x06450d00, 0x06460d00, 0x06470d00, 0x06480d00,
+        0x06490d00, 0x064a0d00, 0x064b0d00, 0x064c0d00, 0x064d0d00, 0x064e0d00,
+        0x064f0d00, 0x06500d00, 0x06510d00, 0x06520d00, 0x06530d00, 0x06540d00,
+        0x06550d00, 0x06560d00, 0x06570d00, 0x06590d00, 0x066a0d00, 0x066b0d00,
+        0x06710d00, 0x06760d00, 0x06770d00, 0x06780d00, 0x06790d00, 0x067a0d00,
+        0x01000d46, 0x01000d47, 0x01000d49, 0x05000d4a
+    },
+    /* 255 */
+    {
+        0x02301602, 0x02301609, 0x02301617, 0x06301628, 0x02311602, 0x02311609,
+        0x02311617, 0x06311628, 0x02321602, 0x02321609, 0x02321617, 0x06321628,
+        0x02611602, 0x02611609, 0x02611617, 0x06611628, 0x02631602, 0x02631609,
+        0x02631617, 0x06631628, 0x02651602, 0x02651609, 0x02651617, 0x06651628,
+        0x02691602, 0x02691609, 0x02691617, 0x06691628, 0x026f1602, 0x026f1609,
+        0x026f1617, 0x066f1628, 0x02731602, 0x02731609, 0x02731617, 0x06731628,
+        0x02741602, 0x02741609, 0x02741617, 0x06741628, 0x02201601, 0x06201616,
+        0x02251601, 0x06251616, 0x022d1601, 0x062d1616, 0x022e1601, 0x062e1616,
+        0x022f1601, 0x062f1616, 0x02331601, 0x06331616, 0x02341601, 0x06341616,
+        0x02351601, 0x06351616, 0x02361601, 0x06361616, 0x02371601, 0x06371616,
+        0x02381601, 0x06381616, 0x02391601, 0x06391616, 0x023d1601, 0x063d1616,
+        0x02411601, 0x06411616, 0x025f1601, 0x065f1616, 0x02621601, 0x06621616,
+        0x02641601, 0x06641616, 0x02661601, 0x06661616, 0x02671601, 0x06671616,
+        0x02681601, 0x06681616, 0x026c1601, 0x066c1616, 0x026d1601, 0x066d1616,
+        0x026e1601, 0x066e1616, 0x02701601, 0x06701616, 0x02721601, 0x06721616,
+        0x02751601, 0x06751616, 0x063a1600, 0x06421600, 0x06431600, 0x06441600,
+        0x06451600, 0x06461600, 0x06471600, 0x06481600, 0x06491600, 0x064a1600,
+        0x064b1600, 0x064c1600, 0x064d1600, 0x064e1600, 0x064f1600, 0x06501600,
+        0x06511600, 0x06521600, 0x06531600, 0x06541600, 0x06551600, 0x06561600,
+        0x06571600, 0x06591600, 0x066a1600, 0x066b1600, 0x06711600, 0x06761600,
+        0x06771600, 0x06781600, 0x06791600, 0x067a1600, 0x01001646, 0x01001647,
+        0x01001649, 0x0500164a, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000, 0x08000000,
+        0x08000000, 0x08000000, 0x08000000, 0x08000000
+    }
+};
+
+
 ngx_int_t
 ngx_http_huff_decode(u_char *state, u_char *src, size_t len, u_char **dst,
     ngx_uint_t last, ngx_log_t *log)
 {
-    u_char  *end, ch, ending;
+    u_char    *end, *p, ch, ending, st;
+    uint32_t   code;
 
     ch = 0;
     ending = 1;
 
     end = src + len;
 
+    st = *state;
+    p = *dst;
+
     while (src != end) {
         ch = *src++;
 
-        if (ngx_http_huff_decode_bits(state, &ending, ch >> 4, dst)
-            != NGX_OK)
-        {
-            ngx_log_debug2(NGX_LOG_DEBUG_HTTP, log, 0,
-                           "http huffman decoding error at state %d: "
-                           "bad code 0x%Xd", *state, ch >> 4);
+        code = ngx_http_huff_decode_bytes[st][ch];
 
-            return NGX_ERROR;
+        if (code & NGX_HTTP_HUFF_ERROR) {
+            *state = st;
+            *dst = p;
+
+            /* the nibble transitions tell where the error is */
+
+            return ngx_http_huff_decode_nibbles(state, &ending, ch, dst, log);
         }
 
-        if (ngx_http_huff_decode_bits(state, &ending, ch & 0xf, dst)
-            != NGX_OK)
-        {
-            ngx_log_debug2(NGX_LOG_DEBUG_HTTP, log, 0,
-                           "http huffman decoding error at state %d: "
-                           "bad code 0x%Xd", *state, ch & 0xf);
+        switch (NGX_HTTP_HUFF_EMIT(code)) {
 
-            return NGX_ERROR;
+        case 2:
+            p[0] = (u_char) NGX_HTTP_HUFF_SYM1(code);
+            p[1] = (u_char) NGX_HTTP_HUFF_SYM2(code);
+            p += 2;
+            break;
+
+        case 1:
+            *p++ = (u_char) NGX_HTTP_HUFF_SYM1(code);
+            break;
         }
+
+        ending = (code & NGX_HTTP_HUFF_ENDING) ? 1 : 0;
+        st = (u_char) NGX_HTTP_HUFF_NEXT(code);
     }
 
+    *state = st;
+    *dst = p;
+
     if (last) {
         if (!ending) {
             ngx_log_debug1(NGX_LOG_DEBUG_HTTP, log, 0,
@@ -2690,6 +14500,29 @@ ngx_http_huff_decode(u_char *state, u_char *src, size_t len, u_char **dst,
 }
 
 
+static ngx_int_t
+ngx_http_huff_decode_nibbles(u_char *state, u_char *ending, u_char ch,
+    u_char **dst, ngx_log_t *log)
+{
+    if (ngx_http_huff_decode_bits(state, ending, ch >> 4, dst) != NGX_OK) {
+        ngx_log_debug2(NGX_LOG_DEBUG_HTTP, log, 0,
+                       "http huffman decoding error at state %d: "
+                       "bad code 0x%Xd", *state, ch >> 4);
+
+        return NGX_ERROR;
+    }
+
+    if (ngx_http_huff_decode_bits(state, ending, ch & 0xf, dst) != NGX_OK) {
+        ngx_log_debug2(NGX_LOG_DEBUG_HTTP, log, 0,
+                       "http huffman decoding error at state %d: "
+                       "bad code 0x%Xd", *state, ch & 0xf);
+
+        return NGX_ERROR;
+    }
+
+    return NGX_OK;
+}
+
 
 static ngx_inline ngx_int_t
 ngx_http_huff_decode_bits(u_char *state, u_char *ending, ngx_uint_t bits,
@@ -9,6 +9,16 @@
 #include <ngx_core.h>
 #include <ngx_http.h>
 
+#if (NGX_HAVE_AVX2)
+#include <immintrin.h>
+#elif (NGX_HAVE_SSE42)
+#include <nmmintrin.h>
+#endif
+
+#if (NGX_HAVE_NEON)
+#include <arm_neon.h>
+#endif
+
 
 static uint32_t  usual[] = {
     0x00000000, /* 0000 0000 0000 0000  0000 0000 0000 0000 */
@@ -98,6 +108,175 @@ static uint32_t  usual[] = {
 #endif
 
 
+/*
+ * The fast paths skip the bytes which do not change the parser state,
+ * 16 or 32 at a time.  They return the first byte the state machine
+ * has to look at, or a byte in the last bytes of the buffer, which are
+ * left to the state machine as well.
+ */
+
+#if (NGX_HAVE_SSE42)
+
+/*
+ * pairs of the first and the last byte of ranges which stop skipping,
+ * the zero padding repeats the "\x00 " range
+ */
+
+static u_char  ngx_http_uri_ranges[16] =
+    "\x00 ##%%++./??\x7f\x7f"
+#if (NGX_WIN32)
+    "\\\\"
+#endif
+    ;
+
+static u_char  ngx_http_args_ranges[16] = "\x00 ##\x7f\x7f";
+
+static u_char  ngx_http_value_ranges[16] = "\x00 ";
+
+
+__attribute__ ((target("sse4.2")))
+static u_char *
+ngx_http_parse_skip_sse42(u_char *p, u_char *last, u_char *ranges)
+{
+    int      n;
+    __m128i  r, v;
+
+    r = _mm_loadu_si128((__m128i *) ranges);
+
+    while (last - p >= 16) {
+        v = _mm_loadu_si128((__m128i *) p);
+
+        n = _mm_cmpestri(r, 16, v, 16,
+                         _SIDD_UBYTE_OPS|_SIDD_CMP_RANGES
+                         |_SIDD_LEAST_SIGNIFICANT);
+
+        if (n != 16) {
+            return p + n;
+        }
+
+        p += 16;
+    }
+
+    return p;
+}
+
+#endif
+
+
+#if (NGX_HAVE_AVX2)
+
+__attribute__ ((target("avx2")))
+static u_char *
+ngx_http_parse_skip_value_avx2(u_char *p, u_char *last)
+{
+    int      m;
+    __m256i  sp, v;
+
+    sp = _mm256_set1_epi8(' ');
+
+    while (last - p >= 32) {
+        v = _mm256_loadu_si256((__m256i *) p);
+
+        /* ch <= ' ' */
+        v = _mm256_cmpeq_epi8(_mm256_min_epu8(v, sp), v);
+        m = _mm256_movemask_epi8(v);
+
+        if (m) {
+            return p + __builtin_ctz(m);
+        }
+
+        p += 32;
+    }
+
+    return p;
+}
+
+#endif
+
+
+#if (NGX_HAVE_NEON)
+
+static u_char *
+ngx_http_parse_skip_value_neon(u_char *p, u_char *last)
+{
+    uint64_t    m;
+    uint8x16_t  sp, v;
+
+    sp = vdupq_n_u8(' ');
+
+    while (last - p >= 16) {
+        v = vcleq_u8(vld1q_u8(p), sp);
+
+        if (vmaxvq_u8(v)) {
+            /* 4 bits per byte */
+            m = vget_lane_u64(vreinterpret_u64_u8(
+                                  vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+
+            return p + (__builtin_ctzll(m) >> 2);
+        }
+
+        p += 16;
+    }
+
+    return p;
+}
+
+#endif
+
+
+static ngx_inline u_char *
+ngx_http_parse_skip_uri(u_char *p, u_char *last)
+{
+#if (NGX_HAVE_SSE42)
+    if ((ngx_cpu_features & NGX_CPU_SSE42) && last - p >= 16) {
+        return ngx_http_parse_skip_sse42(p, last, ngx_http_uri_ranges);
+    }
+#endif
+
+    return p;
+}
+
+
+static ngx_inline u_char *
+ngx_http_parse_skip_args(u_char *p, u_char *last)
+{
+#if (NGX_HAVE_SSE42)
+    if ((ngx_cpu_features & NGX_CPU_SSE42) && last - p >= 16) {
+        return ngx_http_parse_skip_sse42(p, last, ngx_http_args_ranges);
+    }
+#endif
+
+    return p;
+}
+
+
+static ngx_inline u_char *
+ngx_http_parse_skip_value(u_char *p, u_char *last)
+{
+    if (last - p < 16) {
+        return p;
+    }
+
+#if (NGX_HAVE_AVX2)
+    if ((ngx_cpu_features & NGX_CPU_AVX2) && last - p >= 32) {
+        return ngx_http_parse_skip_value_avx2(p, last);
+    }
+#endif
+
+#if (NGX_HAVE_SSE42)
+    if (ngx_cpu_features & NGX_CPU_SSE42) {
+        return ngx_http_parse_skip_sse42(p, last, ngx_http_value_ranges);
+    }
+#endif
+
+#if (NGX_HAVE_NEON)
+    return ngx_http_parse_skip_value_neon(p, last);
+#else
+    return p;
+#endif
+}
+
+
 /* gcc, icc, msvc and others compile these switches as an jump table */
 
 ngx_int_t
@@ -478,6 +657,7 @@ ngx_http_parse_request_line(ngx_http_request_t *r, ngx_buf_t *b)
         case sw_after_slash_in_uri:
 
             if (usual[ch >> 5] & (1U << (ch & 0x1f))) {
+                p = ngx_http_parse_skip_uri(p + 1, b->last) - 1;
                 state = sw_check_uri;
                 break;
             }
@@ -538,6 +718,7 @@ ngx_http_parse_request_line(ngx_http_request_t *r, ngx_buf_t *b)
         case sw_check_uri:
 
             if (usual[ch >> 5] & (1U << (ch & 0x1f))) {
+                p = ngx_http_parse_skip_uri(p + 1, b->last) - 1;
                 break;
             }
 
@@ -602,6 +783,7 @@ ngx_http_parse_request_line(ngx_http_request_t *r, ngx_buf_t *b)
         case sw_uri:
 
             if (usual[ch >> 5] & (1U << (ch & 0x1f))) {
+                p = ngx_http_parse_skip_args(p + 1, b->last) - 1;
                 break;
             }
 
@@ -987,6 +1169,7 @@ ngx_http_parse_header_line(ngx_http_request_t *r, ngx_buf_t *b,
                 return NGX_HTTP_PARSE_INVALID_HEADER;
             default:
                 r->header_start = p;
+                p = ngx_http_parse_skip_value(p + 1, b->last) - 1;
                 state = sw_value;
                 break;
             }
@@ -1009,6 +1192,9 @@ ngx_http_parse_header_line(ngx_http_request_t *r, ngx_buf_t *b,
             case '\0':
                 r->header_end = p;
                 return NGX_HTTP_PARSE_INVALID_HEADER;
+            default:
+                p = ngx_http_parse_skip_value(p + 1, b->last) - 1;
+                break;
             }
             break;
 
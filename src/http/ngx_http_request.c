@@ -42,6 +42,8 @@ static void ngx_http_writer(ngx_http_request_t *r);
 static void ngx_http_request_finalizer(ngx_http_request_t *r);
 
 static void ngx_http_set_keepalive(ngx_http_request_t *r);
+static ngx_int_t ngx_http_compact_connection(ngx_connection_t *c);
+static ngx_int_t ngx_http_compact_string(ngx_pool_t *pool, ngx_str_t *s);
 static void ngx_http_keepalive_handler(ngx_event_t *ev);
 static void ngx_http_set_lingering_close(ngx_connection_t *c);
 static void ngx_http_lingering_close_handler(ngx_event_t *ev);
@@ -570,11 +572,16 @@ ngx_http_alloc_request(ngx_connection_t *c)
 
     cscf = ngx_http_get_module_srv_conf(hc->conf_ctx, ngx_http_core_module);
 
-    pool = ngx_create_pool(cscf->request_pool_size, c->log);
+    pool = ngx_create_pool(cscf->request_pool_adapt
+                           ? cscf->request_pool_adapt->size
+                           : cscf->request_pool_size,
+                           c->log);
     if (pool == NULL) {
         return NULL;
     }
 
+    ngx_pool_set_tag(pool, NGX_POOL_REQUEST);
+
     r = ngx_pcalloc(pool, sizeof(ngx_http_request_t));
     if (r == NULL) {
         ngx_destroy_pool(pool);
@@ -3265,6 +3272,13 @@ ngx_http_set_keepalive(ngx_http_request_t *r)
     }
 #endif
 
+    if (clcf->keepalive_compact
+        && ngx_http_compact_connection(c) == NGX_ERROR)
+    {
+        ngx_http_close_connection(c);
+        return;
+    }
+
     rev->handler = ngx_http_keepalive_handler;
 
     if (wev->active && (ngx_event_flags & NGX_USE_LEVEL_EVENT)) {
@@ -3311,13 +3325,214 @@ ngx_http_set_keepalive(ngx_http_request_t *r)
 }
 
 
+/*
+ * The connection pool of an idle keepalive connection is replaced with
+ * a pool of the exact size, which holds only the connection state needed
+ * to process the next request: the log, addresses, PROXY protocol header,
+ * and ngx_http_connection_t.  The large header buffers and their chain
+ * links are already freed, and the c->buffer descriptor, whose memory
+ * was freed too, is dropped and created again by the keepalive handler.
+ * The pool grows again when the next request arrives.
+ */
+
+static ngx_int_t
+ngx_http_compact_connection(ngx_connection_t *c)
+{
+    size_t                  size, held;
+    u_char                 *text;
+    ngx_log_t              *log;
+    ngx_pool_t             *pool, *p;
+    ngx_sockaddr_t         *sa, *local;
+    ngx_pool_large_t       *l;
+    ngx_http_log_ctx_t     *ctx;
+    ngx_proxy_protocol_t   *pp;
+    ngx_http_connection_t  *hc;
+
+    if (c->pool->cleanup || c->buffer->pos) {
+        return NGX_DECLINED;
+    }
+
+#if (NGX_HTTP_SSL)
+    if (c->ssl) {
+        return NGX_DECLINED;
+    }
+#endif
+
+#if (NGX_HAVE_MSG_ZEROCOPY)
+    /* the zerocopy state is allocated from the connection pool */
+
+    if (c->zerocopy) {
+        return NGX_DECLINED;
+    }
+#endif
+
+    size = sizeof(ngx_pool_t)
+           + ngx_align(sizeof(ngx_log_t), NGX_ALIGNMENT)
+           + ngx_align(sizeof(ngx_http_log_ctx_t), NGX_ALIGNMENT)
+           + ngx_align(sizeof(ngx_http_connection_t), NGX_ALIGNMENT)
+           + ngx_align(c->socklen, NGX_ALIGNMENT)
+           + c->addr_text.len + NGX_ALIGNMENT;
+
+    if (c->local_sockaddr != c->listening->sockaddr) {
+        size += ngx_align(c->local_socklen, NGX_ALIGNMENT);
+    }
+
+    if (c->proxy_protocol) {
+        size += ngx_align(sizeof(ngx_proxy_protocol_t), NGX_ALIGNMENT)
+                + c->proxy_protocol->src_addr.len
+                + c->proxy_protocol->dst_addr.len
+                + c->proxy_protocol->tlvs.len;
+    }
+
+    held = 0;
+
+    for (p = c->pool; p; p = p->d.next) {
+        held += p->d.end - (u_char *) p;
+    }
+
+    for (l = c->pool->large; l; l = l->next) {
+        if (l->alloc) {
+            held += l->size;
+        }
+    }
+
+    ngx_log_debug2(NGX_LOG_DEBUG_HTTP, c->log, 0,
+                   "http compact connection: %uz of %uz", size, held);
+
+    if (size >= held) {
+        return NGX_DECLINED;
+    }
+
+    pool = ngx_create_pool(size, c->log);
+    if (pool == NULL) {
+        return NGX_ERROR;
+    }
+
+    ngx_pool_set_tag(pool, NGX_POOL_CONNECTION);
+
+    log = ngx_palloc(pool, sizeof(ngx_log_t));
+    ctx = ngx_palloc(pool, sizeof(ngx_http_log_ctx_t));
+    hc = ngx_palloc(pool, sizeof(ngx_http_connection_t));
+    sa = ngx_palloc(pool, c->socklen);
+
+    if (log == NULL || ctx == NULL || hc == NULL || sa == NULL) {
+        goto failed;
+    }
+
+    ngx_memcpy(log, c->log, sizeof(ngx_log_t));
+    ngx_memcpy(ctx, c->log->data, sizeof(ngx_http_log_ctx_t));
+    ngx_memcpy(hc, c->data, sizeof(ngx_http_connection_t));
+    ngx_memcpy(sa, c->sockaddr, c->socklen);
+
+    log->data = ctx;
+
+    local = NULL;
+
+    if (c->local_sockaddr != c->listening->sockaddr) {
+        local = ngx_palloc(pool, c->local_socklen);
+        if (local == NULL) {
+            goto failed;
+        }
+
+        ngx_memcpy(local, c->local_sockaddr, c->local_socklen);
+    }
+
+    text = ngx_pnalloc(pool, c->addr_text.len);
+    if (text == NULL) {
+        goto failed;
+    }
+
+    ngx_memcpy(text, c->addr_text.data, c->addr_text.len);
+
+    pp = NULL;
+
+    if (c->proxy_protocol) {
+        pp = ngx_palloc(pool, sizeof(ngx_proxy_protocol_t));
+        if (pp == NULL) {
+            goto failed;
+        }
+
+        *pp = *c->proxy_protocol;
+
+        if (ngx_http_compact_string(pool, &pp->src_addr) != NGX_OK
+            || ngx_http_compact_string(pool, &pp->dst_addr) != NGX_OK
+            || ngx_http_compact_string(pool, &pp->tlvs) != NGX_OK)
+        {
+            goto failed;
+        }
+    }
+
+    c->log = log;
+    c->read->log = log;
+    c->write->log = log;
+    pool->log = log;
+
+    c->sockaddr = &sa->sockaddr;
+    c->addr_text.data = text;
+
+    if (local) {
+        c->local_sockaddr = &local->sockaddr;
+    }
+
+    c->proxy_protocol = pp;
+    c->buffer = NULL;
+    c->data = hc;
+
+    /*
+     * the usage of the pool is accounted before it is replaced, once
+     * per connection, as the exact size pool would pull the average down
+     */
+
+    if (c->listening->pool_adapt && !c->pool_adapted) {
+        ngx_pool_adapt(c->listening->pool_adapt, c->pool);
+        c->pool_adapted = 1;
+    }
+
+    c->pool->log = log;
+    ngx_destroy_pool(c->pool);
+
+    c->pool = pool;
+
+    return NGX_OK;
+
+failed:
+
+    ngx_destroy_pool(pool);
+
+    return NGX_ERROR;
+}
+
+
+static ngx_int_t
+ngx_http_compact_string(ngx_pool_t *pool, ngx_str_t *s)
+{
+    u_char  *p;
+
+    if (s->len == 0) {
+        return NGX_OK;
+    }
+
+    p = ngx_pnalloc(pool, s->len);
+    if (p == NULL) {
+        return NGX_ERROR;
+    }
+
+    ngx_memcpy(p, s->data, s->len);
+    s->data = p;
+
+    return NGX_OK;
+}
+
+
 static void
 ngx_http_keepalive_handler(ngx_event_t *rev)
 {
-    size_t             size;
-    ssize_t            n;
-    ngx_buf_t         *b;
-    ngx_connection_t  *c;
+    size_t                     size;
+    ssize_t                    n;
+    ngx_buf_t                 *b;
+    ngx_connection_t          *c;
+    ngx_http_connection_t     *hc;
+    ngx_http_core_srv_conf_t  *cscf;
 
     c = rev->data;
 
@@ -3349,6 +3564,23 @@ ngx_http_keepalive_handler(ngx_event_t *rev)
 #endif
 
     b = c->buffer;
+
+    if (b == NULL) {
+
+        /* the descriptor was dropped by ngx_http_compact_connection() */
+
+        hc = c->data;
+        cscf = ngx_http_get_module_srv_conf(hc->conf_ctx, ngx_http_core_module);
+
+        b = ngx_create_temp_buf(c->pool, cscf->client_header_buffer_size);
+        if (b == NULL) {
+            ngx_http_close_connection(c);
+            return;
+        }
+
+        c->buffer = b;
+    }
+
     size = b->end - b->start;
 
     if (b->pos == NULL) {
@@ -3703,6 +3935,7 @@ ngx_http_free_request(ngx_http_request_t *r, ngx_int_t rc)
     struct linger              linger;
     ngx_http_cleanup_t        *cln;
     ngx_http_log_ctx_t        *ctx;
+    ngx_http_core_srv_conf_t  *cscf;
     ngx_http_core_loc_conf_t  *clcf;
 
     log = r->connection->log;
@@ -3786,6 +4019,13 @@ ngx_http_free_request(ngx_http_request_t *r, ngx_int_t rc)
     pool = r->pool;
     r->pool = NULL;
 
+    cscf = ngx_http_get_module_srv_conf(r->http_connection->conf_ctx,
+                                        ngx_http_core_module);
+
+    if (cscf->request_pool_adapt) {
+        ngx_pool_adapt(cscf->request_pool_adapt, pool);
+    }
+
     ngx_destroy_pool(pool);
 }
 
@@ -3811,7 +4051,8 @@ ngx_http_log_request(ngx_http_request_t *r)
 void
 ngx_http_close_connection(ngx_connection_t *c)
 {
-    ngx_pool_t  *pool;
+    ngx_pool_t       *pool;
+    ngx_listening_t  *ls;
 
     ngx_log_debug1(NGX_LOG_DEBUG_HTTP, c->log, 0,
                    "close http connection: %d", c->fd);
@@ -3840,6 +4081,11 @@ ngx_http_close_connection(ngx_connection_t *c)
     c->destroyed = 1;
 
     pool = c->pool;
+    ls = c->listening;
+
+    if (ls && ls->pool_adapt && !c->pool_adapted) {
+        ngx_pool_adapt(ls->pool_adapt, pool);
+    }
 
     ngx_close_connection(c);
 
@@ -1607,6 +1607,8 @@ ngx_http_upstream_connect(ngx_http_request_t *r, ngx_http_upstream_t *u)
                                                NGX_HTTP_INTERNAL_SERVER_ERROR);
             return;
         }
+
+        ngx_pool_set_tag(c->pool, NGX_POOL_UPSTREAM);
     }
 
     c->log = r->connection->log;
@@ -2392,7 +2394,7 @@ ngx_http_upstream_process_header(ngx_http_request_t *r, ngx_http_upstream_t *u)
     }
 
     if (u->buffer.start == NULL) {
-        u->buffer.start = ngx_palloc(r->pool, u->conf->buffer_size);
+        u->buffer.start = ngx_palloc_buffer(r->pool, u->conf->buffer_size);
         if (u->buffer.start == NULL) {
             ngx_http_upstream_finalize_request(r, u,
                                                NGX_HTTP_INTERNAL_SERVER_ERROR);
@@ -3490,7 +3492,7 @@ ngx_http_upstream_process_upgraded(ngx_http_request_t *r,
         }
 
         if (b->start == NULL) {
-            b->start = ngx_palloc(r->pool, u->conf->buffer_size);
+            b->start = ngx_palloc_buffer(r->pool, u->conf->buffer_size);
             if (b->start == NULL) {
                 ngx_http_upstream_finalize_request(r, u, NGX_ERROR);
                 return;
@@ -6726,7 +6728,7 @@ ngx_http_upstream_hide_headers_hash(ngx_conf_t *cf,
 
     hash->hash = &conf->hide_headers_hash;
     hash->key = ngx_hash_key_lc;
-    hash->pool = cf->pool;
+    hash->pool = cf->cycle->arena;
     hash->temp_pool = NULL;
 
     if (ngx_hash_init(hash, hide_headers.elts, hide_headers.nelts) != NGX_OK) {
@@ -6820,7 +6822,7 @@ ngx_http_upstream_init_main_conf(ngx_conf_t *cf, void *conf)
     hash.max_size = 512;
     hash.bucket_size = ngx_align(64, ngx_cacheline_size);
     hash.name = "upstream_headers_in_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
     hash.temp_pool = NULL;
 
     if (ngx_hash_init(&hash, headers_in.elts, headers_in.nelts) != NGX_OK) {
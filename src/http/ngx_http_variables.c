@@ -46,6 +46,12 @@ static ngx_int_t ngx_http_variable_argument(ngx_http_request_t *r,
 static ngx_int_t ngx_http_variable_tcpinfo(ngx_http_request_t *r,
     ngx_http_variable_value_t *v, uintptr_t data);
 #endif
+static ngx_int_t ngx_http_variable_slab_lock(ngx_http_request_t *r,
+    ngx_http_variable_value_t *v, uintptr_t data);
+#if (NGX_THREADS)
+static ngx_int_t ngx_http_variable_thread_pool(ngx_http_request_t *r,
+    ngx_http_variable_value_t *v, uintptr_t data);
+#endif
 
 static ngx_int_t ngx_http_variable_content_length(ngx_http_request_t *r,
     ngx_http_variable_value_t *v, uintptr_t data);
@@ -398,6 +404,25 @@ static ngx_http_variable_t  ngx_http_core_variables[] = {
     { ngx_string("arg_"), NULL, ngx_http_variable_argument,
       0, NGX_HTTP_VAR_NOCACHEABLE|NGX_HTTP_VAR_PREFIX, 0 },
 
+    { ngx_string("slab_lock_waits_"), NULL, ngx_http_variable_slab_lock,
+      0, NGX_HTTP_VAR_NOCACHEABLE|NGX_HTTP_VAR_PREFIX, 0 },
+
+    { ngx_string("slab_lock_spins_"), NULL, ngx_http_variable_slab_lock,
+      0, NGX_HTTP_VAR_NOCACHEABLE|NGX_HTTP_VAR_PREFIX, 0 },
+
+#if (NGX_THREADS)
+    { ngx_string("thread_pool_queue_"), NULL, ngx_http_variable_thread_pool,
+      0, NGX_HTTP_VAR_NOCACHEABLE|NGX_HTTP_VAR_PREFIX, 0 },
+
+    { ngx_string("thread_pool_wait_time_"), NULL,
+      ngx_http_variable_thread_pool,
+      0, NGX_HTTP_VAR_NOCACHEABLE|NGX_HTTP_VAR_PREFIX, 0 },
+
+    { ngx_string("thread_pool_service_time_"), NULL,
+      ngx_http_variable_thread_pool,
+      0, NGX_HTTP_VAR_NOCACHEABLE|NGX_HTTP_VAR_PREFIX, 0 },
+#endif
+
       ngx_http_null_variable
 };
 
@@ -1178,6 +1203,146 @@ ngx_http_variable_tcpinfo(ngx_http_request_t *r, ngx_http_variable_value_t *v,
 #endif
 
 
+static ngx_int_t
+ngx_http_variable_slab_lock(ngx_http_request_t *r,
+    ngx_http_variable_value_t *v, uintptr_t data)
+{
+    ngx_str_t *name = (ngx_str_t *) data;
+
+    u_char           *p;
+    ngx_str_t         s;
+    ngx_uint_t        i;
+    ngx_atomic_t      n;
+    ngx_shm_zone_t   *zone;
+    ngx_list_part_t  *part;
+    ngx_slab_pool_t  *sp;
+
+    s.data = name->data + sizeof("slab_lock_waits_") - 1;
+    s.len = name->len - (sizeof("slab_lock_waits_") - 1);
+
+    part = &((ngx_cycle_t *) ngx_cycle)->shared_memory.part;
+    zone = part->elts;
+
+    for (i = 0; /* void */ ; i++) {
+
+        if (i >= part->nelts) {
+            if (part->next == NULL) {
+                v->not_found = 1;
+                return NGX_OK;
+            }
+
+            part = part->next;
+            zone = part->elts;
+            i = 0;
+        }
+
+        if (zone[i].shm.name.len == s.len
+            && ngx_strncmp(zone[i].shm.name.data, s.data, s.len) == 0)
+        {
+            break;
+        }
+    }
+
+    sp = (ngx_slab_pool_t *) zone[i].shm.addr;
+
+    if (sp == NULL) {
+        v->not_found = 1;
+        return NGX_OK;
+    }
+
+    n = (name->data[sizeof("slab_lock_") - 1] == 'w') ? sp->lock.waits
+                                                      : sp->lock.spins;
+
+    p = ngx_pnalloc(r->pool, NGX_ATOMIC_T_LEN);
+    if (p == NULL) {
+        return NGX_ERROR;
+    }
+
+    v->len = ngx_sprintf(p, "%uA", n) - p;
+    v->valid = 1;
+    v->no_cacheable = 0;
+    v->not_found = 0;
+    v->data = p;
+
+    return NGX_OK;
+}
+
+
+#if (NGX_THREADS)
+
+static ngx_int_t
+ngx_http_variable_thread_pool(ngx_http_request_t *r,
+    ngx_http_variable_value_t *v, uintptr_t data)
+{
+    ngx_str_t *name = (ngx_str_t *) data;
+
+    u_char                   *p;
+    uint64_t                  usec;
+    ngx_str_t                 s;
+    ngx_uint_t                metric;
+    ngx_thread_pool_t        *tp;
+    ngx_thread_pool_stats_t   st;
+
+    metric = name->data[sizeof("thread_pool_") - 1];
+
+    switch (metric) {
+
+    case 'q':
+        s.len = sizeof("thread_pool_queue_") - 1;
+        break;
+
+    case 'w':
+        s.len = sizeof("thread_pool_wait_time_") - 1;
+        break;
+
+    default: /* 's' */
+        s.len = sizeof("thread_pool_service_time_") - 1;
+        break;
+    }
+
+    s.data = name->data + s.len;
+    s.len = name->len - s.len;
+
+    tp = ngx_thread_pool_get((ngx_cycle_t *) ngx_cycle, &s);
+
+    if (tp == NULL) {
+        v->not_found = 1;
+        return NGX_OK;
+    }
+
+    ngx_thread_pool_get_stats(tp, &st);
+
+    p = ngx_pnalloc(r->pool, NGX_INT64_LEN + 2);
+    if (p == NULL) {
+        return NGX_ERROR;
+    }
+
+    v->data = p;
+
+    if (metric == 'q') {
+        p = ngx_sprintf(p, "%ui", st.waiting);
+
+    } else {
+
+        /* the average time per task in seconds with microsecond resolution */
+
+        usec = (metric == 'w') ? st.wait_time : st.service_time;
+        usec = st.completed ? usec / st.completed : 0;
+
+        p = ngx_sprintf(p, "%uL.%06uL", usec / 1000000, usec % 1000000);
+    }
+
+    v->len = p - v->data;
+    v->valid = 1;
+    v->no_cacheable = 0;
+    v->not_found = 0;
+
+    return NGX_OK;
+}
+
+#endif
+
+
 static ngx_int_t
 ngx_http_variable_content_length(ngx_http_request_t *r,
     ngx_http_variable_value_t *v, uintptr_t data)
@@ -2497,28 +2662,17 @@ ngx_http_map_find(ngx_http_request_t *r, ngx_http_map_t *map, ngx_str_t *match)
 #if (NGX_PCRE)
 
     if (len && map->nregex) {
-        ngx_int_t              n;
-        ngx_uint_t             i;
-        ngx_http_map_regex_t  *reg;
+        ngx_int_t  n;
 
-        reg = map->regex;
+        n = ngx_http_regex_set_exec(r, map->regex_set, match);
 
-        for (i = 0; i < map->nregex; i++) {
-
-            n = ngx_http_regex_exec(r, reg[i].regex, match);
-
-            if (n == NGX_OK) {
-                return reg[i].value;
-            }
-
-            if (n == NGX_DECLINED) {
-                continue;
-            }
+        if (n >= 0) {
+            return map->regex[n].value;
+        }
 
-            /* NGX_ERROR */
+        /* NGX_DECLINED, NGX_ERROR */
 
-            return NULL;
-        }
+        return NULL;
     }
 
 #endif
@@ -2565,6 +2719,7 @@ ngx_http_regex_compile(ngx_conf_t *cf, ngx_regex_compile_t *rc)
     re->regex = rc->regex;
     re->ncaptures = rc->captures;
     re->name = rc->pattern;
+    re->options = rc->options;
 
     cmcf = ngx_http_conf_get_module_main_conf(cf, ngx_http_core_module);
     cmcf->ncaptures = ngx_max(cmcf->ncaptures, re->ncaptures);
@@ -2680,6 +2835,175 @@ ngx_http_regex_exec(ngx_http_request_t *r, ngx_http_regex_t *re, ngx_str_t *s)
     return NGX_OK;
 }
 
+
+ngx_http_regex_set_t *
+ngx_http_regex_set_create(ngx_conf_t *cf, ngx_http_regex_t **regex,
+    ngx_uint_t n)
+{
+    ngx_uint_t             i, j;
+    ngx_http_regex_run_t  *run;
+    ngx_http_regex_set_t  *set;
+#if (NGX_PCRE2)
+    u_char                 errstr[NGX_MAX_CONF_ERRSTR];
+    ngx_regex_compile_t    rc, *elts;
+#endif
+
+    set = ngx_palloc(cf->pool, sizeof(ngx_http_regex_set_t));
+    if (set == NULL) {
+        return NULL;
+    }
+
+    set->runs = ngx_palloc(cf->pool, n * sizeof(ngx_http_regex_run_t));
+    if (set->runs == NULL) {
+        return NULL;
+    }
+
+    set->regex = regex;
+    set->nruns = 0;
+
+#if (NGX_PCRE2)
+
+    elts = ngx_pcalloc(cf->temp_pool, n * sizeof(ngx_regex_compile_t));
+    if (elts == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < n; i++) {
+        elts[i].pattern = regex[i]->name;
+        elts[i].options = regex[i]->options;
+    }
+
+#endif
+
+    for (i = 0; i < n; i = j) {
+
+#if (NGX_PCRE2)
+
+        /*
+         * a run of anchored regexes is matched by a single combined regex,
+         * which only finds the first of them matching the subject
+         */
+
+        for (j = i;
+             j < n
+             && j - i < NGX_REGEX_COMBINE_MAX
+             && ngx_regex_combinable(&elts[j]);
+             j++)
+        {
+            /* void */
+        }
+
+        if (j - i > 1) {
+            ngx_memzero(&rc, sizeof(ngx_regex_compile_t));
+
+            rc.pool = cf->pool;
+            rc.err.len = NGX_MAX_CONF_ERRSTR;
+            rc.err.data = errstr;
+
+            if (ngx_regex_combine(&rc, &elts[i], j - i) == NGX_OK) {
+                run = &set->runs[set->nruns++];
+
+                run->regex = rc.regex;
+                run->first = i;
+                run->last = j;
+
+                continue;
+            }
+
+            ngx_conf_log_error(NGX_LOG_WARN, cf, 0,
+                               "%V, regexes will be matched one by one",
+                               &rc.err);
+        }
+
+        if (j == i) {
+            j = i + 1;
+        }
+
+#else
+
+        j = n;
+
+#endif
+
+        if (set->nruns && set->runs[set->nruns - 1].regex == NULL) {
+            set->runs[set->nruns - 1].last = j;
+            continue;
+        }
+
+        run = &set->runs[set->nruns++];
+
+        run->regex = NULL;
+        run->first = i;
+        run->last = j;
+    }
+
+    return set;
+}
+
+
+/*
+ * returns the index of the first regex in the set matching the subject,
+ * NGX_DECLINED if none of them matched, or NGX_ERROR
+ */
+
+ngx_int_t
+ngx_http_regex_set_exec(ngx_http_request_t *r, ngx_http_regex_set_t *set,
+    ngx_str_t *s)
+{
+    ngx_int_t              rc;
+    ngx_uint_t             i, n;
+    ngx_http_regex_run_t  *run;
+
+    for (n = 0; n < set->nruns; n++) {
+        run = &set->runs[n];
+
+        i = run->first;
+
+#if (NGX_PCRE2)
+
+        if (run->regex) {
+            rc = ngx_regex_exec_combined(run->regex, s);
+
+            if (rc == NGX_REGEX_NO_MATCHED) {
+                continue;
+            }
+
+            if (rc >= 0) {
+                i += rc;
+
+            } else {
+                ngx_log_debug2(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                               "http regex set combined match failed: %i "
+                               "on \"%V\"", rc, s);
+            }
+        }
+
+#endif
+
+        /* captures and variables are set by the matched regex itself */
+
+        for ( /* void */ ; i < run->last; i++) {
+
+            ngx_log_debug1(NGX_LOG_DEBUG_HTTP, r->connection->log, 0,
+                           "http regex test \"%V\"", &set->regex[i]->name);
+
+            rc = ngx_http_regex_exec(r, set->regex[i], s);
+
+            if (rc == NGX_OK) {
+                return i;
+            }
+
+            if (rc == NGX_DECLINED) {
+                continue;
+            }
+
+            return NGX_ERROR;
+        }
+    }
+
+    return NGX_DECLINED;
+}
+
 #endif
 
 
@@ -2819,7 +3143,7 @@ ngx_http_variables_init_vars(ngx_conf_t *cf)
     hash.max_size = cmcf->variables_hash_max_size;
     hash.bucket_size = cmcf->variables_hash_bucket_size;
     hash.name = "variables_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
     hash.temp_pool = NULL;
 
     if (ngx_hash_init(&hash, cmcf->variables_keys->keys.elts,
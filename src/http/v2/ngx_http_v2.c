@@ -255,6 +255,8 @@ ngx_http_v2_init(ngx_event_t *rev)
         return;
     }
 
+    ngx_pool_set_tag(h2c->pool, NGX_POOL_CONNECTION);
+
     cln = ngx_pool_cleanup_add(c->pool, 0);
     if (cln == NULL) {
         ngx_http_close_connection(c);
@@ -431,6 +433,11 @@ ngx_http_v2_read_handler(ngx_event_t *rev)
             return;
         }
 
+        if (rev->ready && ngx_event_budget_exhausted()) {
+            ngx_event_yield(rev);
+            break;
+        }
+
     } while (rev->ready);
 
     if (ngx_handle_read_event(rev, 0) != NGX_OK) {
@@ -1266,6 +1273,8 @@ ngx_http_v2_state_headers(ngx_http_v2_connection_t *h2c, u_char *pos,
         return ngx_http_v2_connection_error(h2c, NGX_HTTP_V2_INTERNAL_ERROR);
     }
 
+    ngx_pool_set_tag(h2c->state.pool, NGX_POOL_REQUEST);
+
     cscf = ngx_http_get_module_srv_conf(h2c->http_connection->conf_ctx,
                                         ngx_http_core_module);
 
@@ -1826,11 +1835,8 @@ ngx_http_v2_state_process_header(ngx_http_v2_connection_t *h2c, u_char *pos,
         h->key.len = header->name.len;
         h->key.data = header->name.data;
 
-        /*
-         * TODO Optimization: precalculate hash
-         * and handler for indexed headers.
-         */
-        h->hash = ngx_hash_key(h->key.data, h->key.len);
+        /* calculated by ngx_http_v2_validate_header() */
+        h->hash = r->header_hash;
 
         h->value.len = header->value.len;
         h->value.data = header->value.data;
@@ -3231,16 +3237,20 @@ static ngx_int_t
 ngx_http_v2_validate_header(ngx_http_request_t *r, ngx_http_v2_header_t *header)
 {
     u_char                     ch;
-    ngx_uint_t                 i;
+    ngx_uint_t                 i, hash;
     ngx_http_core_srv_conf_t  *cscf;
 
     r->invalid_header = 0;
 
     cscf = ngx_http_get_module_srv_conf(r, ngx_http_core_module);
 
+    hash = 0;
+
     for (i = (header->name.data[0] == ':'); i != header->name.len; i++) {
         ch = header->name.data[i];
 
+        hash = ngx_hash(hash, ch);
+
         if ((ch >= 'a' && ch <= 'z')
             || (ch == '-')
             || (ch >= '0' && ch <= '9')
@@ -3262,6 +3272,10 @@ ngx_http_v2_validate_header(ngx_http_request_t *r, ngx_http_v2_header_t *header)
         r->invalid_header = 1;
     }
 
+    /* the name is lowercase, so it is the key of the known headers hash */
+
+    r->header_hash = hash;
+
     for (i = 0; i != header->value.len; i++) {
         ch = header->value.data[i];
 
@@ -4633,6 +4647,8 @@ ngx_http_v2_idle_handler(ngx_event_t *rev)
         return;
     }
 
+    ngx_pool_set_tag(h2c->pool, NGX_POOL_CONNECTION);
+
     c->write->handler = ngx_http_v2_write_handler;
 
     rev->handler = ngx_http_v2_read_handler;
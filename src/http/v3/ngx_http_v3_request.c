@@ -666,7 +666,7 @@ ngx_http_v3_process_header(ngx_http_request_t *r, ngx_str_t *name,
         h->key = *name;
         h->value = *value;
         h->lowcase_key = h->key.data;
-        h->hash = ngx_hash_key(h->key.data, h->key.len);
+        h->hash = r->header_hash;
 
         cmcf = ngx_http_get_module_main_conf(r, ngx_http_core_module);
 
@@ -689,16 +689,20 @@ ngx_http_v3_validate_header(ngx_http_request_t *r, ngx_str_t *name,
     ngx_str_t *value)
 {
     u_char                     ch;
-    ngx_uint_t                 i;
+    ngx_uint_t                 i, hash;
     ngx_http_core_srv_conf_t  *cscf;
 
     r->invalid_header = 0;
 
     cscf = ngx_http_get_module_srv_conf(r, ngx_http_core_module);
 
+    hash = 0;
+
     for (i = (name->data[0] == ':'); i != name->len; i++) {
         ch = name->data[i];
 
+        hash = ngx_hash(hash, ch);
+
         if ((ch >= 'a' && ch <= 'z')
             || (ch == '-')
             || (ch >= '0' && ch <= '9')
@@ -719,6 +723,10 @@ ngx_http_v3_validate_header(ngx_http_request_t *r, ngx_str_t *name,
         r->invalid_header = 1;
     }
 
+    /* the name is lowercase, so it is the key of the known headers hash */
+
+    r->header_hash = hash;
+
     for (i = 0; i != value->len; i++) {
         ch = value->data[i];
 
@@ -174,6 +174,8 @@ ngx_mail_auth_http_init(ngx_mail_session_t *s)
         return;
     }
 
+    ngx_pool_set_tag(pool, NGX_POOL_UPSTREAM);
+
     ctx = ngx_pcalloc(pool, sizeof(ngx_mail_auth_http_ctx_t));
     if (ctx == NULL) {
         ngx_destroy_pool(pool);
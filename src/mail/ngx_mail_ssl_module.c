@@ -133,7 +133,7 @@ static ngx_command_t  ngx_mail_ssl_commands[] = {
       NULL },
 
     { ngx_string("ssl_session_cache"),
-      NGX_MAIL_MAIN_CONF|NGX_MAIL_SRV_CONF|NGX_CONF_TAKE12,
+      NGX_MAIL_MAIN_CONF|NGX_MAIL_SRV_CONF|NGX_CONF_TAKE123,
       ngx_mail_ssl_session_cache,
       NGX_MAIL_SRV_CONF_OFFSET,
       0,
@@ -577,14 +577,30 @@ ngx_mail_ssl_session_cache(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     ngx_mail_ssl_conf_t  *scf = conf;
 
     size_t       len;
+    ssize_t      hugepages;
     ngx_str_t   *value, name, size;
     ngx_int_t    n;
     ngx_uint_t   i, j;
 
     value = cf->args->elts;
 
+    hugepages = NGX_CONF_UNSET;
+
     for (i = 1; i < cf->args->nelts; i++) {
 
+        if (ngx_strncmp(value[i].data, "hugepages=", 10) == 0) {
+
+            size.len = value[i].len - 10;
+            size.data = value[i].data + 10;
+
+            hugepages = ngx_parse_hugepages(&size);
+            if (hugepages == NGX_ERROR) {
+                goto invalid;
+            }
+
+            continue;
+        }
+
         if (ngx_strcmp(value[i].data, "off") == 0) {
             scf->builtin_session_cache = NGX_SSL_NO_SCACHE;
             continue;
@@ -668,6 +684,10 @@ ngx_mail_ssl_session_cache(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
         goto invalid;
     }
 
+    if (scf->shm_zone && hugepages != NGX_CONF_UNSET) {
+        scf->shm_zone->shm.hugepages = hugepages;
+    }
+
     if (scf->shm_zone && scf->builtin_session_cache == NGX_CONF_UNSET) {
         scf->builtin_session_cache = NGX_SSL_NO_BUILTIN_SCACHE;
     }
@@ -12,6 +12,13 @@
 ngx_uint_t  ngx_pagesize;
 ngx_uint_t  ngx_pagesize_shift;
 ngx_uint_t  ngx_cacheline_size;
+ngx_uint_t  ngx_hugepage_size;
+ngx_uint_t  ngx_alloc_hugepages;
+
+
+#if (NGX_HAVE_MAP_HUGETLB)
+static void *ngx_alloc_huge(size_t size, ngx_log_t *log);
+#endif
 
 
 void *
@@ -19,6 +26,12 @@ ngx_alloc(size_t size, ngx_log_t *log)
 {
     void  *p;
 
+#if (NGX_HAVE_MAP_HUGETLB)
+    if (ngx_alloc_hugepages && size >= ngx_hugepage_size) {
+        return ngx_alloc_huge(size, log);
+    }
+#endif
+
     p = malloc(size);
     if (p == NULL) {
         ngx_log_error(NGX_LOG_EMERG, log, ngx_errno,
@@ -46,6 +59,43 @@ ngx_calloc(size_t size, ngx_log_t *log)
 }
 
 
+#if (NGX_HAVE_MAP_HUGETLB)
+
+/*
+ * Allocations of at least a huge page are aligned to the huge page size
+ * and use transparent huge pages, if available.  The memory is freed
+ * with ngx_free() as usual.
+ */
+
+static void *
+ngx_alloc_huge(size_t size, ngx_log_t *log)
+{
+    void  *p;
+    int    err;
+
+    err = posix_memalign(&p, ngx_hugepage_size, size);
+
+    if (err) {
+        ngx_log_error(NGX_LOG_EMERG, log, err,
+                      "posix_memalign(%uz, %uz) failed",
+                      ngx_hugepage_size, size);
+        return NULL;
+    }
+
+    if (madvise(p, size & ~(ngx_hugepage_size - 1), MADV_HUGEPAGE) == -1) {
+        ngx_log_debug1(NGX_LOG_DEBUG_ALLOC, log, ngx_errno,
+                       "madvise(MADV_HUGEPAGE, %uz) failed", size);
+    }
+
+    ngx_log_debug2(NGX_LOG_DEBUG_ALLOC, log, 0,
+                   "malloc: %p:%uz, huge pages", p, size);
+
+    return p;
+}
+
+#endif
+
+
 #if (NGX_HAVE_POSIX_MEMALIGN)
 
 void *
@@ -40,6 +40,8 @@ void *ngx_memalign(size_t alignment, size_t size, ngx_log_t *log);
 extern ngx_uint_t  ngx_pagesize;
 extern ngx_uint_t  ngx_pagesize_shift;
 extern ngx_uint_t  ngx_cacheline_size;
+extern ngx_uint_t  ngx_hugepage_size;
+extern ngx_uint_t  ngx_alloc_hugepages;
 
 
 #endif /* _NGX_ALLOC_H_INCLUDED_ */
@@ -26,6 +26,12 @@ ngx_uint_t  ngx_file_aio = 1;
 
 #endif
 
+#if (NGX_HAVE_FILE_URING)
+
+ngx_uint_t  ngx_file_uring = 1;
+
+#endif
+
 
 ssize_t
 ngx_read_file(ngx_file_t *file, u_char *buf, size_t size, off_t offset)
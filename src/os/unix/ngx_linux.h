@@ -11,6 +11,13 @@
 
 ngx_chain_t *ngx_linux_sendfile_chain(ngx_connection_t *c, ngx_chain_t *in,
     off_t limit);
+ngx_int_t ngx_linux_memory_usage(size_t *shared, size_t *private,
+    ngx_log_t *log);
+
+#if (NGX_HAVE_MSG_ZEROCOPY)
+ngx_int_t ngx_linux_zerocopy(ngx_connection_t *c, ngx_pool_t *pool,
+    size_t threshold);
+#endif
 
 
 #endif /* _NGX_LINUX_H_INCLUDED_ */
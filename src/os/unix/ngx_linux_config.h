@@ -103,10 +103,18 @@ typedef struct iocb  ngx_aiocb_t;
 #include <linux/capability.h>
 #endif
 
-#if (NGX_HAVE_UDP_SEGMENT)
+#if (NGX_HAVE_UDP_SEGMENT || NGX_HAVE_UDP_GRO)
 #include <netinet/udp.h>
 #endif
 
+#if (NGX_HAVE_MSG_ZEROCOPY)
+#include <linux/errqueue.h>
+#endif
+
+#if (NGX_HAVE_NUMA)
+#include <linux/mempolicy.h>
+#endif
+
 
 #define NGX_LISTEN_BACKLOG        511
 
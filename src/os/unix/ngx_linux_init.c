@@ -13,6 +13,12 @@ u_char  ngx_linux_kern_ostype[50];
 u_char  ngx_linux_kern_osrelease[50];
 
 
+#if (NGX_HAVE_MAP_HUGETLB)
+static void ngx_linux_hugepage_size(ngx_log_t *log);
+#endif
+static size_t ngx_linux_smaps_value(u_char *buf, char *name);
+
+
 static ngx_os_io_t ngx_linux_io = {
     ngx_unix_recv,
     ngx_readv_chain,
@@ -22,10 +28,15 @@ static ngx_os_io_t ngx_linux_io = {
     ngx_udp_unix_sendmsg_chain,
 #if (NGX_HAVE_SENDFILE)
     ngx_linux_sendfile_chain,
-    NGX_IO_SENDFILE
+    NGX_IO_SENDFILE,
 #else
     ngx_writev_chain,
-    0
+    0,
+#endif
+#if (NGX_HAVE_SENDFILE && NGX_HAVE_MSG_ZEROCOPY)
+    ngx_linux_zerocopy
+#else
+    NULL
 #endif
 };
 
@@ -48,10 +59,141 @@ ngx_os_specific_init(ngx_log_t *log)
 
     ngx_os_io = ngx_linux_io;
 
+#if (NGX_HAVE_MAP_HUGETLB)
+    ngx_linux_hugepage_size(log);
+#endif
+
     return NGX_OK;
 }
 
 
+#if (NGX_HAVE_MAP_HUGETLB)
+
+static void
+ngx_linux_hugepage_size(ngx_log_t *log)
+{
+    u_char    *p, *last;
+    ssize_t    n;
+    ngx_fd_t   fd;
+    u_char     buf[4096];
+
+    fd = ngx_open_file("/proc/meminfo", NGX_FILE_RDONLY, NGX_FILE_OPEN, 0);
+
+    if (fd == NGX_INVALID_FILE) {
+        ngx_log_error(NGX_LOG_INFO, log, ngx_errno,
+                      ngx_open_file_n " \"/proc/meminfo\" failed");
+        return;
+    }
+
+    n = ngx_read_fd(fd, buf, sizeof(buf) - 1);
+
+    if (n == -1) {
+        ngx_log_error(NGX_LOG_INFO, log, ngx_errno,
+                      ngx_read_fd_n " \"/proc/meminfo\" failed");
+    }
+
+    if (ngx_close_file(fd) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      ngx_close_file_n " \"/proc/meminfo\" failed");
+    }
+
+    if (n <= 0) {
+        return;
+    }
+
+    buf[n] = '\0';
+
+    p = (u_char *) ngx_strstr(buf, "Hugepagesize:");
+
+    if (p == NULL) {
+        return;
+    }
+
+    for (p += sizeof("Hugepagesize:") - 1; *p == ' '; p++) { /* void */ }
+
+    for (last = p; *last >= '0' && *last <= '9'; last++) { /* void */ }
+
+    n = ngx_atoi(p, last - p);
+
+    if (n > 0) {
+        ngx_hugepage_size = (ngx_uint_t) n * 1024;
+    }
+}
+
+#endif
+
+
+/*
+ * The memory of the process shared with other processes, such as pages
+ * of the master process not modified after fork(), and its private memory.
+ */
+
+ngx_int_t
+ngx_linux_memory_usage(size_t *shared, size_t *private, ngx_log_t *log)
+{
+    ssize_t   n;
+    ngx_fd_t  fd;
+    u_char    buf[2048];
+
+    fd = ngx_open_file("/proc/self/smaps_rollup", NGX_FILE_RDONLY,
+                       NGX_FILE_OPEN, 0);
+
+    if (fd == NGX_INVALID_FILE) {
+        ngx_log_error(NGX_LOG_INFO, log, ngx_errno,
+                      ngx_open_file_n " \"/proc/self/smaps_rollup\" failed");
+        return NGX_DECLINED;
+    }
+
+    n = ngx_read_fd(fd, buf, sizeof(buf) - 1);
+
+    if (n == -1) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      ngx_read_fd_n " \"/proc/self/smaps_rollup\" failed");
+    }
+
+    if (ngx_close_file(fd) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      ngx_close_file_n " \"/proc/self/smaps_rollup\" failed");
+    }
+
+    if (n <= 0) {
+        return NGX_DECLINED;
+    }
+
+    buf[n] = '\0';
+
+    *shared = ngx_linux_smaps_value(buf, "Shared_Clean:")
+              + ngx_linux_smaps_value(buf, "Shared_Dirty:");
+
+    *private = ngx_linux_smaps_value(buf, "Private_Clean:")
+               + ngx_linux_smaps_value(buf, "Private_Dirty:");
+
+    return NGX_OK;
+}
+
+
+static size_t
+ngx_linux_smaps_value(u_char *buf, char *name)
+{
+    u_char     *p, *last;
+    ngx_int_t   n;
+
+    p = (u_char *) ngx_strstr(buf, name);
+
+    if (p == NULL) {
+        return 0;
+    }
+
+    for (p += ngx_strlen(name); *p == ' '; p++) { /* void */ }
+
+    for (last = p; *last >= '0' && *last <= '9'; last++) { /* void */ }
+
+    n = ngx_atoi(p, last - p);
+
+    return (n > 0) ? (size_t) n * 1024 : 0;
+}
+
+
 void
 ngx_os_specific_status(ngx_log_t *log)
 {
@@ -10,9 +10,54 @@
 #include <ngx_event.h>
 
 
+static ngx_chain_t *ngx_linux_send_chain(ngx_connection_t *c,
+    ngx_chain_t *in, off_t limit);
 static ssize_t ngx_linux_sendfile(ngx_connection_t *c, ngx_buf_t *file,
     size_t size);
 
+#if (NGX_HAVE_MSG_ZEROCOPY)
+
+#define NGX_ZEROCOPY_SENDS  64
+
+
+typedef struct {
+    uint32_t            id;
+    ngx_uint_t          done;
+    off_t               start;
+} ngx_zerocopy_send_t;
+
+
+struct ngx_zerocopy_s {
+    size_t              threshold;
+
+    /* the pool of the bufs, the connection is reset if it is destroyed */
+    ngx_pool_t         *pool;
+
+    /* bytes passed to the kernel and bytes released back to the chain */
+    off_t               sent;
+    off_t               released;
+
+    /* the next notification id */
+    uint32_t            next;
+
+    ngx_uint_t          head;
+    ngx_uint_t          nsends;
+    ngx_zerocopy_send_t sends[NGX_ZEROCOPY_SENDS];
+
+    unsigned            enabled:1;
+    unsigned            copied:1;
+};
+
+
+static ngx_chain_t *ngx_linux_zerocopy_chain(ngx_connection_t *c,
+    ngx_chain_t *in, off_t limit);
+static off_t ngx_linux_zerocopy_prefix(ngx_zerocopy_t *zc, ngx_chain_t *in,
+    off_t limit);
+static ngx_int_t ngx_linux_zerocopy_notifications(ngx_connection_t *c);
+static void ngx_linux_zerocopy_cleanup(void *data);
+
+#endif
+
 #if (NGX_THREADS)
 #include <ngx_thread_pool.h>
 
@@ -48,6 +93,21 @@ static void ngx_linux_sendfile_thread_handler(void *data, ngx_log_t *log);
 
 ngx_chain_t *
 ngx_linux_sendfile_chain(ngx_connection_t *c, ngx_chain_t *in, off_t limit)
+{
+#if (NGX_HAVE_MSG_ZEROCOPY)
+
+    if (c->zerocopy) {
+        return ngx_linux_zerocopy_chain(c, in, limit);
+    }
+
+#endif
+
+    return ngx_linux_send_chain(c, in, limit);
+}
+
+
+static ngx_chain_t *
+ngx_linux_send_chain(ngx_connection_t *c, ngx_chain_t *in, off_t limit)
 {
     int            tcp_nodelay;
     off_t          send, prev_send;
@@ -228,6 +288,442 @@ ngx_linux_sendfile_chain(ngx_connection_t *c, ngx_chain_t *in, off_t limit)
 }
 
 
+#if (NGX_HAVE_MSG_ZEROCOPY)
+
+/*
+ * The memory bufs sent with MSG_ZEROCOPY are referenced by the kernel
+ * until it reports their completion via the socket error queue, so the
+ * chain is not updated for these and the following bytes till then:
+ * zc->sent is the number of bytes passed to the kernel, zc->released is
+ * the number of bytes the chain was updated for.
+ */
+
+ngx_int_t
+ngx_linux_zerocopy(ngx_connection_t *c, ngx_pool_t *pool, size_t threshold)
+{
+    int                  value;
+    ngx_zerocopy_t      *zc;
+    ngx_pool_cleanup_t  *cln;
+
+    zc = c->zerocopy;
+
+    if (zc == NULL) {
+        if (threshold == 0) {
+            return NGX_OK;
+        }
+
+        zc = ngx_pcalloc(c->pool, sizeof(ngx_zerocopy_t));
+        if (zc == NULL) {
+            return NGX_ERROR;
+        }
+
+        value = 1;
+
+        if (setsockopt(c->fd, SOL_SOCKET, SO_ZEROCOPY,
+                       (const void *) &value, sizeof(int))
+            == -1)
+        {
+            ngx_log_error(NGX_LOG_ALERT, c->log, ngx_socket_errno,
+                          "setsockopt(SO_ZEROCOPY) failed, ignored");
+
+        } else {
+            zc->enabled = 1;
+        }
+
+        c->zerocopy = zc;
+    }
+
+    zc->threshold = threshold;
+
+    if (threshold && zc->pool != pool) {
+        cln = ngx_pool_cleanup_add(pool, 0);
+        if (cln == NULL) {
+            return NGX_ERROR;
+        }
+
+        cln->handler = ngx_linux_zerocopy_cleanup;
+        cln->data = c;
+
+        zc->pool = pool;
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_linux_zerocopy_cleanup(void *data)
+{
+    ngx_connection_t  *c = data;
+
+    struct linger    linger;
+    ngx_zerocopy_t  *zc;
+
+    zc = c->zerocopy;
+    zc->pool = NULL;
+
+    if (zc->nsends == 0 || c->fd == (ngx_socket_t) -1) {
+        return;
+    }
+
+    if (ngx_linux_zerocopy_notifications(c) == NGX_OK && zc->nsends == 0) {
+        return;
+    }
+
+    /*
+     * the bufs being freed are still referenced by the kernel:
+     * reset the connection on close to discard the unsent data,
+     * so it is not sent after the memory is reused
+     */
+
+    ngx_log_debug1(NGX_LOG_DEBUG_EVENT, c->log, 0,
+                   "zerocopy reset, %ui sends pending", zc->nsends);
+
+    linger.l_onoff = 1;
+    linger.l_linger = 0;
+
+    if (setsockopt(c->fd, SOL_SOCKET, SO_LINGER,
+                   (const void *) &linger, sizeof(struct linger))
+        == -1)
+    {
+        ngx_log_error(NGX_LOG_ALERT, c->log, ngx_socket_errno,
+                      "setsockopt(SO_LINGER) failed");
+    }
+
+    c->error = 1;
+}
+
+
+static ngx_chain_t *
+ngx_linux_zerocopy_chain(ngx_connection_t *c, ngx_chain_t *in, off_t limit)
+{
+    off_t             send, prefix, sent, skip, size;
+    u_char           *prev;
+    ssize_t           n;
+    ngx_err_t         err;
+    ngx_uint_t        i;
+    ngx_chain_t      *cl;
+    ngx_event_t      *wev;
+    struct iovec     *iov, iovs[NGX_IOVS_PREALLOCATE];
+    struct msghdr     msg;
+    ngx_zerocopy_t   *zc;
+
+    zc = c->zerocopy;
+    wev = c->write;
+
+    if (zc->nsends) {
+        if (ngx_linux_zerocopy_notifications(c) != NGX_OK) {
+            wev->error = 1;
+            return NGX_CHAIN_ERROR;
+        }
+    }
+
+    sent = zc->nsends ? zc->sends[zc->head].start : zc->sent;
+
+    if (sent != zc->released) {
+        in = ngx_chain_update_sent(in, sent - zc->released);
+        zc->released = sent;
+    }
+
+    if (in == NULL || !wev->ready) {
+        return in;
+    }
+
+    if (limit == 0 || limit > (off_t) (NGX_SENDFILE_MAXSIZE - ngx_pagesize)) {
+        limit = NGX_SENDFILE_MAXSIZE - ngx_pagesize;
+    }
+
+    send = 0;
+
+    for ( ;; ) {
+
+        if (zc->sent == zc->released) {
+
+            /* nothing is referenced by the kernel, send small bufs as usual */
+
+            prefix = ngx_linux_zerocopy_prefix(zc, in, limit - send);
+
+            if (prefix) {
+                sent = c->sent;
+
+                in = ngx_linux_send_chain(c, in, prefix);
+
+                if (in == NGX_CHAIN_ERROR) {
+                    return NGX_CHAIN_ERROR;
+                }
+
+                zc->sent += c->sent - sent;
+                zc->released = zc->sent;
+
+                send += c->sent - sent;
+
+                if (in == NULL
+                    || !wev->ready
+                    || c->sent - sent < prefix
+                    || send >= limit)
+                {
+                    return in;
+                }
+            }
+        }
+
+        /* skip the bytes already passed to the kernel */
+
+        skip = zc->sent - zc->released;
+
+        for (cl = in; cl; cl = cl->next) {
+            size = ngx_buf_size(cl->buf);
+
+            if (ngx_buf_special(cl->buf) || skip >= size) {
+                skip -= ngx_buf_special(cl->buf) ? 0 : size;
+                continue;
+            }
+
+            break;
+        }
+
+        /* create the iovec of memory bufs */
+
+        i = 0;
+        size = 0;
+        prev = NULL;
+        iov = NULL;
+
+        for ( /* void */ ; cl && send + size < limit; cl = cl->next) {
+
+            if (ngx_buf_special(cl->buf)) {
+                continue;
+            }
+
+            if (cl->buf->in_file || !ngx_buf_in_memory(cl->buf)) {
+                break;
+            }
+
+            n = ngx_min(cl->buf->last - cl->buf->pos - skip,
+                        limit - send - size);
+
+            if (prev == cl->buf->pos + skip) {
+                iov->iov_len += n;
+
+            } else {
+                if (i == NGX_IOVS_PREALLOCATE) {
+                    break;
+                }
+
+                iov = &iovs[i++];
+
+                iov->iov_base = (void *) (cl->buf->pos + skip);
+                iov->iov_len = n;
+            }
+
+            prev = cl->buf->pos + skip + n;
+            size += n;
+            skip = 0;
+        }
+
+        if (size == 0) {
+
+            /*
+             * all memory bufs are passed to the kernel, or a file buf
+             * follows them: wait for the notifications, the error queue
+             * readiness is reported as a write event
+             */
+
+            wev->ready = 0;
+            return in;
+        }
+
+        if (zc->nsends == NGX_ZEROCOPY_SENDS) {
+            wev->ready = 0;
+            return in;
+        }
+
+        ngx_memzero(&msg, sizeof(struct msghdr));
+
+        msg.msg_iov = iovs;
+        msg.msg_iovlen = i;
+
+    eintr:
+
+        n = sendmsg(c->fd, &msg, MSG_ZEROCOPY);
+
+        ngx_log_debug3(NGX_LOG_DEBUG_EVENT, c->log, 0,
+                       "sendmsg zerocopy: %z of %O #%uD", n, size, zc->next);
+
+        if (n == -1) {
+            err = ngx_socket_errno;
+
+            switch (err) {
+            case NGX_EAGAIN:
+                wev->ready = 0;
+                return in;
+
+            case NGX_EINTR:
+                goto eintr;
+
+            case ENOBUFS:
+
+                /* the notification cannot be allocated, see optmem_max */
+
+                zc->copied = 1;
+
+                if (zc->sent != zc->released) {
+                    wev->ready = 0;
+                    return in;
+                }
+
+                continue;
+
+            default:
+                wev->error = 1;
+                ngx_connection_error(c, err, "sendmsg() failed");
+                return NGX_CHAIN_ERROR;
+            }
+        }
+
+        i = (zc->head + zc->nsends) % NGX_ZEROCOPY_SENDS;
+
+        zc->sends[i].id = zc->next++;
+        zc->sends[i].done = 0;
+        zc->sends[i].start = zc->sent;
+        zc->nsends++;
+
+        zc->sent += n;
+        c->sent += n;
+        send += n;
+
+        if (send >= limit) {
+            return in;
+        }
+    }
+}
+
+
+static off_t
+ngx_linux_zerocopy_prefix(ngx_zerocopy_t *zc, ngx_chain_t *in, off_t limit)
+{
+    off_t  size, total;
+
+    if (!zc->enabled || zc->copied || zc->threshold == 0) {
+        return limit;
+    }
+
+    total = 0;
+
+    for ( /* void */ ; in && total < limit; in = in->next) {
+
+        if (ngx_buf_special(in->buf)) {
+            continue;
+        }
+
+        size = ngx_buf_size(in->buf);
+
+        if (!in->buf->in_file
+            && ngx_buf_in_memory(in->buf)
+            && size >= (off_t) zc->threshold)
+        {
+            break;
+        }
+
+        total += size;
+    }
+
+    return ngx_min(total, limit);
+}
+
+
+static ngx_int_t
+ngx_linux_zerocopy_notifications(ngx_connection_t *c)
+{
+    uint32_t                  lo, hi;
+    ssize_t                   n;
+    ngx_err_t                 err;
+    ngx_uint_t                i, k;
+    struct msghdr             msg;
+    struct cmsghdr           *cmsg;
+    ngx_zerocopy_t           *zc;
+    struct sock_extended_err *serr;
+    u_char                    control[CMSG_SPACE(sizeof(struct sock_extended_err)
+                                                 + sizeof(ngx_sockaddr_t))];
+
+    zc = c->zerocopy;
+
+    for ( ;; ) {
+        ngx_memzero(&msg, sizeof(struct msghdr));
+
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        n = recvmsg(c->fd, &msg, MSG_ERRQUEUE);
+
+        if (n == -1) {
+            err = ngx_socket_errno;
+
+            if (err == NGX_EAGAIN) {
+                break;
+            }
+
+            if (err == NGX_EINTR) {
+                continue;
+            }
+
+            ngx_connection_error(c, err, "recvmsg(MSG_ERRQUEUE) failed");
+            return NGX_ERROR;
+        }
+
+        for (cmsg = CMSG_FIRSTHDR(&msg);
+             cmsg != NULL;
+             cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (!((cmsg->cmsg_level == SOL_IP
+                   && cmsg->cmsg_type == IP_RECVERR)
+                  || (cmsg->cmsg_level == SOL_IPV6
+                      && cmsg->cmsg_type == IPV6_RECVERR)))
+            {
+                continue;
+            }
+
+            serr = (struct sock_extended_err *) CMSG_DATA(cmsg);
+
+            if (serr->ee_origin != SO_EE_ORIGIN_ZEROCOPY
+                || serr->ee_errno != 0)
+            {
+                continue;
+            }
+
+            lo = serr->ee_info;
+            hi = serr->ee_data;
+
+            ngx_log_debug3(NGX_LOG_DEBUG_EVENT, c->log, 0,
+                           "zerocopy completed: #%uD-%uD%s", lo, hi,
+                           (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+                           ? " copied" : "");
+
+            if (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) {
+                zc->copied = 1;
+            }
+
+            for (i = 0; i < zc->nsends; i++) {
+                k = (zc->head + i) % NGX_ZEROCOPY_SENDS;
+
+                if (zc->sends[k].id - lo <= hi - lo) {
+                    zc->sends[k].done = 1;
+                }
+            }
+        }
+    }
+
+    while (zc->nsends && zc->sends[zc->head].done) {
+        zc->head = (zc->head + 1) % NGX_ZEROCOPY_SENDS;
+        zc->nsends--;
+    }
+
+    return NGX_OK;
+}
+
+#endif
+
+
 static ssize_t
 ngx_linux_sendfile(ngx_connection_t *c, ngx_buf_t *file, size_t size)
 {
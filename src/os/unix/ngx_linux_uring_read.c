@@ -0,0 +1,392 @@
+
+/*
+ * Copyright (C) Igor Sysoev
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_event.h>
+
+#include <linux/io_uring.h>
+
+
+/*
+ * Unlike Linux native AIO, io_uring reads do not block on buffered files,
+ * so O_DIRECT is not required.  A worker creates its ring on the first
+ * read.  The completions are signalled by an eventfd registered with
+ * the ring, the eventfd is handled by any event method.
+ */
+
+
+#define NGX_FILE_URING_ENTRIES  256
+
+
+static ngx_int_t ngx_file_uring_init_ring(ngx_log_t *log);
+static void ngx_file_uring_event_handler(ngx_event_t *ev);
+static void ngx_file_uring_eventfd_handler(ngx_event_t *ev);
+
+
+static int                    ngx_uring_ring = -1;
+static int                    ngx_uring_eventfd = -1;
+
+static uint32_t              *ngx_uring_sq_ktail;
+static uint32_t              *ngx_uring_sq_khead;
+static uint32_t               ngx_uring_sq_mask;
+static uint32_t               ngx_uring_sq_entries;
+static struct io_uring_sqe   *ngx_uring_sqes;
+
+static uint32_t              *ngx_uring_cq_khead;
+static uint32_t              *ngx_uring_cq_ktail;
+static uint32_t               ngx_uring_cq_mask;
+static struct io_uring_cqe   *ngx_uring_cqes;
+
+static ngx_event_t            ngx_uring_eventfd_rev;
+static ngx_event_t            ngx_uring_eventfd_wev;
+static ngx_connection_t       ngx_uring_eventfd_conn;
+
+
+static int
+io_uring_setup(unsigned entries, struct io_uring_params *p)
+{
+    return syscall(SYS_io_uring_setup, entries, p);
+}
+
+
+static int
+io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+    unsigned flags)
+{
+    return syscall(SYS_io_uring_enter, fd, to_submit, min_complete, flags,
+                   NULL, 0);
+}
+
+
+static int
+io_uring_register(int fd, unsigned opcode, void *arg, unsigned nr_args)
+{
+    return syscall(SYS_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+
+ssize_t
+ngx_file_uring_read(ngx_file_t *file, u_char *buf, size_t size, off_t offset,
+    ngx_pool_t *pool)
+{
+    int                   n;
+    uint32_t              tail;
+    ngx_err_t             err;
+    ngx_event_t          *ev;
+    ngx_event_aio_t      *aio;
+    struct io_uring_sqe  *sqe;
+
+    if (!ngx_file_uring) {
+        return ngx_read_file(file, buf, size, offset);
+    }
+
+    if (ngx_uring_ring == -1 && ngx_file_uring_init_ring(file->log) != NGX_OK)
+    {
+        ngx_file_uring = 0;
+        return ngx_read_file(file, buf, size, offset);
+    }
+
+    if (file->aio == NULL && ngx_file_aio_init(file, pool) != NGX_OK) {
+        return NGX_ERROR;
+    }
+
+    aio = file->aio;
+    ev = &aio->event;
+
+    if (!ev->ready) {
+        ngx_log_error(NGX_LOG_ALERT, file->log, 0,
+                      "second aio post for \"%V\"", &file->name);
+        return NGX_AGAIN;
+    }
+
+    ngx_log_debug4(NGX_LOG_DEBUG_CORE, file->log, 0,
+                   "uring complete:%d @%O:%uz %V",
+                   ev->complete, offset, size, &file->name);
+
+    if (ev->complete) {
+        ev->active = 0;
+        ev->complete = 0;
+
+        if (aio->res >= 0) {
+            ngx_set_errno(0);
+            return aio->res;
+        }
+
+        ngx_set_errno(-aio->res);
+
+        ngx_log_error(NGX_LOG_CRIT, file->log, ngx_errno,
+                      "uring read \"%s\" failed", file->name.data);
+
+        return NGX_ERROR;
+    }
+
+    tail = *ngx_uring_sq_ktail;
+
+    if (tail - *(volatile uint32_t *) ngx_uring_sq_khead
+        == ngx_uring_sq_entries)
+    {
+        return ngx_read_file(file, buf, size, offset);
+    }
+
+    sqe = &ngx_uring_sqes[tail & ngx_uring_sq_mask];
+
+    ngx_memzero(sqe, sizeof(struct io_uring_sqe));
+
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = file->fd;
+    sqe->addr = (uint64_t) (uintptr_t) buf;
+    sqe->len = size;
+    sqe->off = offset;
+    sqe->user_data = (uint64_t) (uintptr_t) ev;
+
+    ngx_memory_barrier();
+
+    *(volatile uint32_t *) ngx_uring_sq_ktail = tail + 1;
+
+    ev->handler = ngx_file_uring_event_handler;
+
+    n = io_uring_enter(ngx_uring_ring, 1, 0, 0);
+
+    if (n == 1) {
+        ev->active = 1;
+        ev->ready = 0;
+        ev->complete = 0;
+
+        return NGX_AGAIN;
+    }
+
+    err = (n == -1) ? ngx_errno : NGX_EAGAIN;
+
+    /* the SQE was not consumed by the kernel */
+
+    *(volatile uint32_t *) ngx_uring_sq_ktail = tail;
+
+    if (err == NGX_EAGAIN || err == NGX_EBUSY || err == NGX_EINTR) {
+        return ngx_read_file(file, buf, size, offset);
+    }
+
+    ngx_log_error(NGX_LOG_CRIT, file->log, err,
+                  "io_uring_enter(\"%V\") failed", &file->name);
+
+    if (err == NGX_ENOSYS) {
+        ngx_file_uring = 0;
+        return ngx_read_file(file, buf, size, offset);
+    }
+
+    return NGX_ERROR;
+}
+
+
+static ngx_int_t
+ngx_file_uring_init_ring(ngx_log_t *log)
+{
+    int                      n;
+    u_char                  *ring;
+    size_t                   size;
+    uint32_t                 i;
+    ngx_uint_t               flags;
+    struct io_uring_params   p;
+
+    ring = NULL;
+    size = 0;
+
+    ngx_memzero(&p, sizeof(struct io_uring_params));
+
+    p.flags = IORING_SETUP_CLAMP;
+
+    n = io_uring_setup(NGX_FILE_URING_ENTRIES, &p);
+
+    if (n == -1) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      "io_uring_setup() failed");
+        return NGX_ERROR;
+    }
+
+    if (!(p.features & IORING_FEAT_SINGLE_MMAP)) {
+        ngx_log_error(NGX_LOG_ALERT, log, 0,
+                      "io_uring features %08XD are not sufficient",
+                      p.features);
+        goto failed;
+    }
+
+    size = ngx_max(p.sq_off.array + p.sq_entries * sizeof(uint32_t),
+                   p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe));
+
+    ring = mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE,
+                n, IORING_OFF_SQ_RING);
+
+    if (ring == MAP_FAILED) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      "mmap(IORING_OFF_SQ_RING, %uz) failed", size);
+        ring = NULL;
+        goto failed;
+    }
+
+    ngx_uring_sqes = mmap(NULL, p.sq_entries * sizeof(struct io_uring_sqe),
+                          PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE,
+                          n, IORING_OFF_SQES);
+
+    if (ngx_uring_sqes == MAP_FAILED) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      "mmap(IORING_OFF_SQES) failed");
+        ngx_uring_sqes = NULL;
+        goto failed;
+    }
+
+    ngx_uring_sq_khead = (uint32_t *) (ring + p.sq_off.head);
+    ngx_uring_sq_ktail = (uint32_t *) (ring + p.sq_off.tail);
+    ngx_uring_sq_mask = *(uint32_t *) (ring + p.sq_off.ring_mask);
+    ngx_uring_sq_entries = p.sq_entries;
+
+    for (i = 0; i < p.sq_entries; i++) {
+        ((uint32_t *) (ring + p.sq_off.array))[i] = i;
+    }
+
+    ngx_uring_cq_khead = (uint32_t *) (ring + p.cq_off.head);
+    ngx_uring_cq_ktail = (uint32_t *) (ring + p.cq_off.tail);
+    ngx_uring_cq_mask = *(uint32_t *) (ring + p.cq_off.ring_mask);
+    ngx_uring_cqes = (struct io_uring_cqe *) (ring + p.cq_off.cqes);
+
+    ngx_uring_eventfd = eventfd(0, EFD_NONBLOCK);
+
+    if (ngx_uring_eventfd == -1) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno, "eventfd() failed");
+        goto failed;
+    }
+
+    if (io_uring_register(n, IORING_REGISTER_EVENTFD, &ngx_uring_eventfd, 1)
+        == -1)
+    {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      "io_uring_register(IORING_REGISTER_EVENTFD) failed");
+        goto failed;
+    }
+
+    ngx_uring_eventfd_rev.data = &ngx_uring_eventfd_conn;
+    ngx_uring_eventfd_rev.handler = ngx_file_uring_eventfd_handler;
+    ngx_uring_eventfd_rev.index = NGX_INVALID_INDEX;
+    ngx_uring_eventfd_rev.log = ngx_cycle->log;
+
+    ngx_uring_eventfd_wev.data = &ngx_uring_eventfd_conn;
+    ngx_uring_eventfd_wev.index = NGX_INVALID_INDEX;
+    ngx_uring_eventfd_wev.log = ngx_cycle->log;
+
+    ngx_uring_eventfd_conn.fd = ngx_uring_eventfd;
+    ngx_uring_eventfd_conn.read = &ngx_uring_eventfd_rev;
+    ngx_uring_eventfd_conn.write = &ngx_uring_eventfd_wev;
+    ngx_uring_eventfd_conn.log = ngx_cycle->log;
+
+    flags = (ngx_event_flags & NGX_USE_CLEAR_EVENT) ? NGX_CLEAR_EVENT
+                                                    : NGX_LEVEL_EVENT;
+
+    if (ngx_add_event(&ngx_uring_eventfd_rev, NGX_READ_EVENT, flags)
+        == NGX_ERROR)
+    {
+        goto failed;
+    }
+
+    ngx_uring_ring = n;
+
+    ngx_log_debug3(NGX_LOG_DEBUG_CORE, log, 0,
+                   "uring read ring: fd:%d sq:%uD eventfd:%d",
+                   n, p.sq_entries, ngx_uring_eventfd);
+
+    return NGX_OK;
+
+failed:
+
+    if (ngx_uring_sqes) {
+        (void) munmap(ngx_uring_sqes,
+                      p.sq_entries * sizeof(struct io_uring_sqe));
+        ngx_uring_sqes = NULL;
+    }
+
+    if (ring) {
+        (void) munmap(ring, size);
+    }
+
+    if (ngx_uring_eventfd != -1) {
+        if (close(ngx_uring_eventfd) == -1) {
+            ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                          "eventfd close() failed");
+        }
+
+        ngx_uring_eventfd = -1;
+    }
+
+    if (close(n) == -1) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      "io_uring close() failed");
+    }
+
+    return NGX_ERROR;
+}
+
+
+static void
+ngx_file_uring_event_handler(ngx_event_t *ev)
+{
+    ngx_event_aio_t  *aio;
+
+    aio = ev->data;
+
+    ngx_log_debug2(NGX_LOG_DEBUG_CORE, ev->log, 0,
+                   "uring event handler fd:%d %V", aio->fd, &aio->file->name);
+
+    aio->handler(ev);
+}
+
+
+static void
+ngx_file_uring_eventfd_handler(ngx_event_t *ev)
+{
+    ssize_t               n;
+    uint32_t              head, tail;
+    uint64_t              ready;
+    ngx_err_t             err;
+    ngx_event_t          *e;
+    ngx_event_aio_t      *aio;
+    struct io_uring_cqe  *cqe;
+
+    ngx_log_debug0(NGX_LOG_DEBUG_EVENT, ev->log, 0, "uring eventfd handler");
+
+    n = read(ngx_uring_eventfd, &ready, 8);
+
+    err = ngx_errno;
+
+    if (n == -1 && err != NGX_EAGAIN) {
+        ngx_log_error(NGX_LOG_ALERT, ev->log, err, "read(eventfd) failed");
+    }
+
+    head = *ngx_uring_cq_khead;
+    tail = *(volatile uint32_t *) ngx_uring_cq_ktail;
+
+    ngx_memory_barrier();
+
+    for ( /* void */ ; head != tail; head++) {
+        cqe = &ngx_uring_cqes[head & ngx_uring_cq_mask];
+
+        ngx_log_debug2(NGX_LOG_DEBUG_EVENT, ev->log, 0,
+                       "uring read event: %XL %d", cqe->user_data, cqe->res);
+
+        e = (ngx_event_t *) (uintptr_t) cqe->user_data;
+
+        e->complete = 1;
+        e->active = 0;
+        e->ready = 1;
+
+        aio = e->data;
+        aio->res = cqe->res;
+
+        ngx_post_event(e, &ngx_posted_events);
+    }
+
+    ngx_memory_barrier();
+
+    *(volatile uint32_t *) ngx_uring_cq_khead = head;
+}
@@ -0,0 +1,344 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#include <ngx_config.h>
+#include <ngx_core.h>
+
+
+#if (NGX_HAVE_NUMA)
+
+/*
+ * The node masks passed to the system calls are limited to a single word,
+ * the kernel reads one bit less than the "maxnode" argument.
+ */
+
+#define NGX_NUMA_MAXNODE  (NGX_NUMA_NODES + 1)
+
+
+static ngx_int_t ngx_numa_node_cpus(ngx_uint_t node, ngx_cpuset_t *cpus,
+    ngx_log_t *log);
+static ngx_int_t ngx_numa_allowed(unsigned long *mask, ngx_log_t *log);
+
+
+/*
+ * Worker allocations are preferably placed on the node of the CPUs
+ * the worker is bound to with worker_cpu_affinity, falling back to other
+ * nodes if the node is out of memory.  The node is only known if all CPUs
+ * of the worker belong to a single node.
+ */
+
+void
+ngx_numa_bind(ngx_cpuset_t *cpu_affinity, ngx_log_t *log)
+{
+    ngx_int_t      rc;
+    ngx_uint_t     i, node;
+    ngx_cpuset_t   cpus;
+    unsigned long  mask;
+
+    if (cpu_affinity == NULL) {
+        ngx_log_error(NGX_LOG_WARN, log, 0,
+                      "worker_numa requires worker_cpu_affinity, ignored");
+        return;
+    }
+
+    node = NGX_NUMA_NODES;
+
+    for (i = 0; i < NGX_NUMA_NODES; i++) {
+
+        rc = ngx_numa_node_cpus(i, &cpus, log);
+
+        if (rc == NGX_ERROR) {
+            return;
+        }
+
+        if (rc == NGX_DECLINED) {
+            continue;
+        }
+
+        CPU_AND(&cpus, &cpus, cpu_affinity);
+
+        if (CPU_COUNT(&cpus) == 0) {
+            continue;
+        }
+
+        if (node != NGX_NUMA_NODES) {
+            ngx_log_error(NGX_LOG_WARN, log, 0,
+                          "worker cpu affinity spans numa nodes #%ui "
+                          "and #%ui, worker_numa ignored", node, i);
+            return;
+        }
+
+        node = i;
+    }
+
+    if (node == NGX_NUMA_NODES) {
+        ngx_log_error(NGX_LOG_WARN, log, 0,
+                      "numa node of worker cpu affinity is not found, "
+                      "worker_numa ignored");
+        return;
+    }
+
+    mask = 1UL << node;
+
+    if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, &mask, NGX_NUMA_MAXNODE)
+        == -1)
+    {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      "set_mempolicy(MPOL_PREFERRED, %ui) failed", node);
+        return;
+    }
+
+    ngx_log_error(NGX_LOG_NOTICE, log, 0,
+                  "set_mempolicy(): using numa node #%ui", node);
+}
+
+
+/*
+ * Reads the CPUs of a node from sysfs, where they are listed
+ * like "0-3,8-11".
+ */
+
+static ngx_int_t
+ngx_numa_node_cpus(ngx_uint_t node, ngx_cpuset_t *cpus, ngx_log_t *log)
+{
+    u_char     *p, *last, *dash;
+    ssize_t     n;
+    ngx_fd_t    fd;
+    ngx_int_t   from, to;
+    u_char      name[NGX_MAX_PATH];
+    u_char      buf[1024];
+
+    ngx_sprintf(name, "/sys/devices/system/node/node%ui/cpulist%Z", node);
+
+    fd = ngx_open_file(name, NGX_FILE_RDONLY, NGX_FILE_OPEN, 0);
+
+    if (fd == NGX_INVALID_FILE) {
+        if (ngx_errno == NGX_ENOENT) {
+            return NGX_DECLINED;
+        }
+
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      ngx_open_file_n " \"%s\" failed", name);
+        return NGX_ERROR;
+    }
+
+    n = ngx_read_fd(fd, buf, sizeof(buf));
+
+    if (n == -1) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      ngx_read_fd_n " \"%s\" failed", name);
+    }
+
+    if (ngx_close_file(fd) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      ngx_close_file_n " \"%s\" failed", name);
+    }
+
+    if (n == -1) {
+        return NGX_ERROR;
+    }
+
+    CPU_ZERO(cpus);
+
+    p = buf;
+    last = buf + n;
+
+    while (p < last && *p != LF) {
+
+        for (n = 0; p + n < last && p[n] != ',' && p[n] != LF; n++) {
+            /* void */
+        }
+
+        dash = ngx_strlchr(p, p + n, '-');
+
+        if (dash) {
+            from = ngx_atoi(p, dash - p);
+            to = ngx_atoi(dash + 1, p + n - dash - 1);
+
+        } else {
+            from = ngx_atoi(p, n);
+            to = from;
+        }
+
+        if (from == NGX_ERROR || to == NGX_ERROR || to >= CPU_SETSIZE) {
+            ngx_log_error(NGX_LOG_ALERT, log, 0,
+                          "invalid cpu list in \"%s\"", name);
+            return NGX_ERROR;
+        }
+
+        while (from <= to) {
+            CPU_SET(from++, cpus);
+        }
+
+        p += n;
+
+        if (p < last && *p == ',') {
+            p++;
+        }
+    }
+
+    return NGX_OK;
+}
+
+
+/*
+ * The pages of a new mapping are spread over all allowed nodes
+ * as they are touched, instead of landing on the node of the process
+ * which touches them first.
+ */
+
+void
+ngx_numa_interleave(void *addr, size_t size, ngx_log_t *log)
+{
+    unsigned long  mask;
+
+    if (ngx_numa_allowed(&mask, log) != NGX_OK) {
+        return;
+    }
+
+    if ((mask & (mask - 1)) == 0) {
+
+        /* a single node */
+
+        return;
+    }
+
+    if (syscall(SYS_mbind, addr, size, MPOL_INTERLEAVE, &mask,
+                NGX_NUMA_MAXNODE, 0)
+        == -1)
+    {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      "mbind(MPOL_INTERLEAVE, %uz) failed", size);
+    }
+}
+
+
+/*
+ * Sums the memory of the process per node from /proc/self/numa_maps,
+ * where each mapping is described by a line like
+ *
+ *   7f0e7c000000 interleave:0-1 anon=512 dirty=512 N0=256 N1=256
+ *       kernelpagesize_kB=4
+ */
+
+ngx_int_t
+ngx_numa_usage(size_t *nodes, ngx_log_t *log)
+{
+    u_char       *p, *last, *word, ch;
+    size_t        len, kb;
+    ssize_t       n;
+    ngx_fd_t      fd;
+    ngx_int_t     node, pages;
+    ngx_uint_t    i;
+    size_t        line[NGX_NUMA_NODES];
+    u_char        buf[4096];
+    u_char        w[32];
+
+    fd = ngx_open_file("/proc/self/numa_maps", NGX_FILE_RDONLY,
+                       NGX_FILE_OPEN, 0);
+
+    if (fd == NGX_INVALID_FILE) {
+        ngx_log_error(NGX_LOG_INFO, log, ngx_errno,
+                      ngx_open_file_n " \"/proc/self/numa_maps\" failed");
+        return NGX_DECLINED;
+    }
+
+    ngx_memzero(nodes, NGX_NUMA_NODES * sizeof(size_t));
+    ngx_memzero(line, sizeof(line));
+
+    len = 0;
+    kb = 0;
+
+    for ( ;; ) {
+        n = ngx_read_fd(fd, buf, sizeof(buf));
+
+        if (n == -1) {
+            ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                          ngx_read_fd_n " \"/proc/self/numa_maps\" failed");
+            break;
+        }
+
+        if (n == 0) {
+            break;
+        }
+
+        last = buf + n;
+
+        for (p = buf; p < last; p++) {
+            ch = *p;
+
+            if (ch != ' ' && ch != LF) {
+                if (len < sizeof(w)) {
+                    w[len] = ch;
+                }
+
+                len++;
+                continue;
+            }
+
+            if (len > 1 && len < sizeof(w)) {
+                word = (u_char *) ngx_strlchr(w, w + len, '=');
+
+                if (word && w[0] == 'N') {
+                    node = ngx_atoi(&w[1], word - &w[1]);
+                    pages = ngx_atoi(word + 1, w + len - word - 1);
+
+                    if (node >= 0 && node < (ngx_int_t) NGX_NUMA_NODES
+                        && pages > 0)
+                    {
+                        line[node] += pages;
+                    }
+
+                } else if (word
+                           && ngx_strncmp(w, "kernelpagesize_kB=",
+                                          sizeof("kernelpagesize_kB=") - 1)
+                              == 0)
+                {
+                    pages = ngx_atoi(word + 1, w + len - word - 1);
+                    kb = (pages > 0) ? (size_t) pages : 0;
+                }
+            }
+
+            len = 0;
+
+            if (ch == LF) {
+                for (i = 0; i < NGX_NUMA_NODES; i++) {
+                    nodes[i] += line[i] * kb * 1024;
+                    line[i] = 0;
+                }
+
+                kb = 0;
+            }
+        }
+    }
+
+    if (ngx_close_file(fd) == NGX_FILE_ERROR) {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      ngx_close_file_n " \"/proc/self/numa_maps\" failed");
+    }
+
+    return NGX_OK;
+}
+
+
+static ngx_int_t
+ngx_numa_allowed(unsigned long *mask, ngx_log_t *log)
+{
+    *mask = 0;
+
+    if (syscall(SYS_get_mempolicy, NULL, mask, NGX_NUMA_MAXNODE, NULL,
+                MPOL_F_MEMS_ALLOWED)
+        == -1)
+    {
+        ngx_log_error(NGX_LOG_ALERT, log, ngx_errno,
+                      "get_mempolicy(MPOL_F_MEMS_ALLOWED) failed");
+        return NGX_ERROR;
+    }
+
+    return NGX_OK;
+}
+
+#endif
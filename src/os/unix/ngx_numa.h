@@ -0,0 +1,28 @@
+
+/*
+ * Copyright (C) Nginx, Inc.
+ */
+
+
+#ifndef _NGX_NUMA_H_INCLUDED_
+#define _NGX_NUMA_H_INCLUDED_
+
+
+#define NGX_NUMA_NODES  (8 * sizeof(unsigned long))
+
+
+#if (NGX_HAVE_NUMA)
+
+void ngx_numa_bind(ngx_cpuset_t *cpu_affinity, ngx_log_t *log);
+void ngx_numa_interleave(void *addr, size_t size, ngx_log_t *log);
+ngx_int_t ngx_numa_usage(size_t *nodes, ngx_log_t *log);
+
+#else
+
+#define ngx_numa_bind(cpu_affinity, log)
+#define ngx_numa_interleave(addr, size, log)
+
+#endif
+
+
+#endif /* _NGX_NUMA_H_INCLUDED_ */
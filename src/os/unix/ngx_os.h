@@ -22,6 +22,8 @@ typedef ssize_t (*ngx_recv_chain_pt)(ngx_connection_t *c, ngx_chain_t *in,
 typedef ssize_t (*ngx_send_pt)(ngx_connection_t *c, u_char *buf, size_t size);
 typedef ngx_chain_t *(*ngx_send_chain_pt)(ngx_connection_t *c, ngx_chain_t *in,
     off_t limit);
+typedef ngx_int_t (*ngx_zerocopy_pt)(ngx_connection_t *c, ngx_pool_t *pool,
+    size_t threshold);
 
 typedef struct {
     ngx_recv_pt        recv;
@@ -32,6 +34,7 @@ typedef struct {
     ngx_send_chain_pt  udp_send_chain;
     ngx_send_chain_pt  send_chain;
     ngx_uint_t         flags;
+    ngx_zerocopy_pt    zerocopy;
 } ngx_os_io_t;
 
 
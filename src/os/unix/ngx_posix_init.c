@@ -27,7 +27,8 @@ ngx_os_io_t ngx_os_io = {
     ngx_udp_unix_send,
     ngx_udp_unix_sendmsg_chain,
     ngx_writev_chain,
-    0
+    0,
+    NULL
 };
 
 
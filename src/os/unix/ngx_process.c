@@ -67,6 +67,11 @@ ngx_signal_t  signals[] = {
       "",
       ngx_signal_handler },
 
+    { ngx_signal_value(NGX_MEMORY_SIGNAL),
+      "SIG" ngx_value(NGX_MEMORY_SIGNAL),
+      "memory",
+      ngx_signal_handler },
+
     { SIGALRM, "SIGALRM", "", ngx_signal_handler },
 
     { SIGINT, "SIGINT", "", ngx_signal_handler },
@@ -371,6 +376,11 @@ ngx_signal_handler(int signo, siginfo_t *siginfo, void *ucontext)
             action = ", reopening logs";
             break;
 
+        case ngx_signal_value(NGX_MEMORY_SIGNAL):
+            ngx_memory_usage = 1;
+            action = ", logging memory usage";
+            break;
+
         case ngx_signal_value(NGX_CHANGEBIN_SIGNAL):
             if (ngx_getppid() == ngx_parent || ngx_new_binary > 0) {
 
@@ -431,6 +441,11 @@ ngx_signal_handler(int signo, siginfo_t *siginfo, void *ucontext)
             action = ", reopening logs";
             break;
 
+        case ngx_signal_value(NGX_MEMORY_SIGNAL):
+            ngx_memory_usage = 1;
+            action = ", logging memory usage";
+            break;
+
         case ngx_signal_value(NGX_RECONFIGURE_SIGNAL):
         case ngx_signal_value(NGX_CHANGEBIN_SIGNAL):
         case SIGIO:
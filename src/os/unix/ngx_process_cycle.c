@@ -18,6 +18,7 @@ static void ngx_start_cache_manager_processes(ngx_cycle_t *cycle,
 static void ngx_pass_open_channel(ngx_cycle_t *cycle);
 static void ngx_signal_worker_processes(ngx_cycle_t *cycle, int signo);
 static ngx_uint_t ngx_reap_children(ngx_cycle_t *cycle);
+static void ngx_reclaim_slab_caches(ngx_cycle_t *cycle, ngx_pid_t pid);
 static void ngx_master_process_exit(ngx_cycle_t *cycle);
 static void ngx_worker_process_cycle(ngx_cycle_t *cycle, void *data);
 static void ngx_worker_process_init(ngx_cycle_t *cycle, ngx_int_t worker);
@@ -42,6 +43,7 @@ sig_atomic_t  ngx_debug_quit;
 ngx_uint_t    ngx_exiting;
 sig_atomic_t  ngx_reconfigure;
 sig_atomic_t  ngx_reopen;
+sig_atomic_t  ngx_memory_usage;
 
 sig_atomic_t  ngx_change_binary;
 ngx_pid_t     ngx_new_binary;
@@ -95,6 +97,7 @@ ngx_master_process_cycle(ngx_cycle_t *cycle)
     sigaddset(&set, ngx_signal_value(NGX_TERMINATE_SIGNAL));
     sigaddset(&set, ngx_signal_value(NGX_SHUTDOWN_SIGNAL));
     sigaddset(&set, ngx_signal_value(NGX_CHANGEBIN_SIGNAL));
+    sigaddset(&set, ngx_signal_value(NGX_MEMORY_SIGNAL));
 
     if (sigprocmask(SIG_BLOCK, &set, NULL) == -1) {
         ngx_log_error(NGX_LOG_ALERT, cycle->log, ngx_errno,
@@ -259,6 +262,12 @@ ngx_master_process_cycle(ngx_cycle_t *cycle)
                                         ngx_signal_value(NGX_REOPEN_SIGNAL));
         }
 
+        if (ngx_memory_usage) {
+            ngx_memory_usage = 0;
+            ngx_signal_worker_processes(cycle,
+                                        ngx_signal_value(NGX_MEMORY_SIGNAL));
+        }
+
         if (ngx_change_binary) {
             ngx_change_binary = 0;
             ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0, "changing binary");
@@ -328,6 +337,11 @@ ngx_single_process_cycle(ngx_cycle_t *cycle)
             ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0, "reopening logs");
             ngx_reopen_files(cycle, (ngx_uid_t) -1);
         }
+
+        if (ngx_memory_usage) {
+            ngx_memory_usage = 0;
+            ngx_log_memory_usage(cycle);
+        }
     }
 }
 
@@ -498,7 +512,9 @@ ngx_signal_worker_processes(ngx_cycle_t *cycle, int signo)
                                   &ch, sizeof(ngx_channel_t), cycle->log)
                 == NGX_OK)
             {
-                if (signo != ngx_signal_value(NGX_REOPEN_SIGNAL)) {
+                if (signo != ngx_signal_value(NGX_REOPEN_SIGNAL)
+                    && signo != ngx_signal_value(NGX_MEMORY_SIGNAL))
+                {
                     ngx_processes[i].exiting = 1;
                 }
 
@@ -523,7 +539,9 @@ ngx_signal_worker_processes(ngx_cycle_t *cycle, int signo)
             continue;
         }
 
-        if (signo != ngx_signal_value(NGX_REOPEN_SIGNAL)) {
+        if (signo != ngx_signal_value(NGX_REOPEN_SIGNAL)
+            && signo != ngx_signal_value(NGX_MEMORY_SIGNAL))
+        {
             ngx_processes[i].exiting = 1;
         }
     }
@@ -562,6 +580,8 @@ ngx_reap_children(ngx_cycle_t *cycle)
 
         if (ngx_processes[i].exited) {
 
+            ngx_reclaim_slab_caches(cycle, ngx_processes[i].pid);
+
             if (!ngx_processes[i].detached) {
                 ngx_close_channel(ngx_processes[i].channel, cycle->log);
 
@@ -652,6 +672,37 @@ ngx_reap_children(ngx_cycle_t *cycle)
 }
 
 
+/*
+ * a worker process which exited abnormally did not return
+ * the chunks cached in its slab magazines
+ */
+
+static void
+ngx_reclaim_slab_caches(ngx_cycle_t *cycle, ngx_pid_t pid)
+{
+    ngx_uint_t        i;
+    ngx_shm_zone_t   *shm_zone;
+    ngx_list_part_t  *part;
+
+    part = &cycle->shared_memory.part;
+    shm_zone = part->elts;
+
+    for (i = 0; /* void */ ; i++) {
+
+        if (i >= part->nelts) {
+            if (part->next == NULL) {
+                break;
+            }
+            part = part->next;
+            shm_zone = part->elts;
+            i = 0;
+        }
+
+        ngx_slab_cache_reclaim((ngx_slab_pool_t *) shm_zone[i].shm.addr, pid);
+    }
+}
+
+
 static void
 ngx_master_process_exit(ngx_cycle_t *cycle)
 {
@@ -745,6 +796,11 @@ ngx_worker_process_cycle(ngx_cycle_t *cycle, void *data)
             ngx_log_error(NGX_LOG_NOTICE, cycle->log, 0, "reopening logs");
             ngx_reopen_files(cycle, -1);
         }
+
+        if (ngx_memory_usage) {
+            ngx_memory_usage = 0;
+            ngx_log_memory_usage(cycle);
+        }
     }
 }
 
@@ -774,6 +830,20 @@ ngx_worker_process_init(ngx_cycle_t *cycle, ngx_int_t worker)
         }
     }
 
+    if (worker >= 0 && ccf->slab_cache > 0) {
+        ngx_slab_cache_init(ccf->slab_cache);
+    }
+
+    if (worker >= 0 && ccf->hugepages && ngx_hugepage_size) {
+        ngx_alloc_hugepages = 1;
+    }
+
+    if (worker >= 0 && ccf->memory_accounting) {
+        ngx_pool_accounting = 1;
+        ngx_slab_accounting = 1;
+        ngx_pool_set_tag(cycle->pool, NGX_POOL_CYCLE);
+    }
+
     if (ccf->rlimit_nofile != NGX_CONF_UNSET) {
         rlmt.rlim_cur = (rlim_t) ccf->rlimit_nofile;
         rlmt.rlim_max = (rlim_t) ccf->rlimit_nofile;
@@ -856,6 +926,10 @@ ngx_worker_process_init(ngx_cycle_t *cycle, ngx_int_t worker)
         if (cpu_affinity) {
             ngx_setaffinity(cpu_affinity, cycle->log);
         }
+
+        if (ccf->numa) {
+            ngx_numa_bind(cpu_affinity, cycle->log);
+        }
     }
 
 #if (NGX_HAVE_PR_SET_DUMPABLE)
@@ -948,6 +1022,8 @@ ngx_worker_process_exit(ngx_cycle_t *cycle)
         }
     }
 
+    ngx_slab_cache_flush();
+
     if (ngx_exiting && !ngx_terminate) {
         c = cycle->connections;
         for (i = 0; i < cycle->connection_n; i++) {
@@ -55,6 +55,7 @@ extern sig_atomic_t    ngx_terminate;
 extern sig_atomic_t    ngx_noaccept;
 extern sig_atomic_t    ngx_reconfigure;
 extern sig_atomic_t    ngx_reopen;
+extern sig_atomic_t    ngx_memory_usage;
 extern sig_atomic_t    ngx_change_binary;
 
 
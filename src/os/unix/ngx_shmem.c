@@ -14,6 +14,47 @@
 ngx_int_t
 ngx_shm_alloc(ngx_shm_t *shm)
 {
+#if (NGX_HAVE_MAP_HUGETLB)
+    int         flags;
+    size_t      size;
+    ngx_uint_t  shift;
+
+    if (shm->hugepages) {
+
+        /* the mapping must be a multiple of the huge page size */
+
+        size = ngx_align(shm->size, shm->hugepages);
+
+        flags = MAP_ANON|MAP_SHARED|MAP_HUGETLB;
+
+        if (shm->hugepages != ngx_hugepage_size) {
+            for (shift = 0; (size_t) 1 << shift < shm->hugepages; shift++) {
+                /* void */
+            }
+
+            flags |= shift << MAP_HUGE_SHIFT;
+        }
+
+        shm->addr = (u_char *) mmap(NULL, size, PROT_READ|PROT_WRITE,
+                                    flags, -1, 0);
+
+        if (shm->addr != MAP_FAILED) {
+            shm->mapped = size;
+
+            if (shm->interleave) {
+                ngx_numa_interleave(shm->addr, size, shm->log);
+            }
+
+            return NGX_OK;
+        }
+
+        ngx_log_error(NGX_LOG_WARN, shm->log, ngx_errno,
+                      "mmap(MAP_HUGETLB, %uz) failed, "
+                      "huge pages are not used for \"%V\"",
+                      size, &shm->name);
+    }
+#endif
+
     shm->addr = (u_char *) mmap(NULL, shm->size,
                                 PROT_READ|PROT_WRITE,
                                 MAP_ANON|MAP_SHARED, -1, 0);
@@ -24,6 +65,25 @@ ngx_shm_alloc(ngx_shm_t *shm)
         return NGX_ERROR;
     }
 
+    shm->mapped = shm->size;
+
+    if (shm->interleave) {
+        ngx_numa_interleave(shm->addr, shm->size, shm->log);
+    }
+
+#if (NGX_HAVE_MAP_HUGETLB)
+
+    /* transparent huge pages, if enabled for shared memory */
+
+    if (shm->hugepages
+        && madvise(shm->addr, shm->size, MADV_HUGEPAGE) == -1)
+    {
+        ngx_log_debug1(NGX_LOG_DEBUG_CORE, shm->log, ngx_errno,
+                       "madvise(MADV_HUGEPAGE, %uz) failed", shm->size);
+    }
+
+#endif
+
     return NGX_OK;
 }
 
@@ -31,9 +91,13 @@ ngx_shm_alloc(ngx_shm_t *shm)
 void
 ngx_shm_free(ngx_shm_t *shm)
 {
-    if (munmap((void *) shm->addr, shm->size) == -1) {
+    size_t  size;
+
+    size = shm->mapped ? shm->mapped : shm->size;
+
+    if (munmap((void *) shm->addr, size) == -1) {
         ngx_log_error(NGX_LOG_ALERT, shm->log, ngx_errno,
-                      "munmap(%p, %uz) failed", shm->addr, shm->size);
+                      "munmap(%p, %uz) failed", shm->addr, size);
     }
 }
 
@@ -19,6 +19,9 @@ typedef struct {
     ngx_str_t    name;
     ngx_log_t   *log;
     ngx_uint_t   exists;   /* unsigned  exists:1;  */
+    size_t       hugepages;
+    size_t       mapped;
+    ngx_uint_t   interleave;  /* unsigned  interleave:1; */
 } ngx_shm_t;
 
 
@@ -23,11 +23,12 @@ static ngx_os_io_t ngx_solaris_io = {
     ngx_udp_unix_sendmsg_chain,
 #if (NGX_HAVE_SENDFILE)
     ngx_solaris_sendfilev_chain,
-    NGX_IO_SENDFILE
+    NGX_IO_SENDFILE,
 #else
     ngx_writev_chain,
-    0
+    0,
 #endif
+    NULL
 };
 
 
@@ -12,6 +12,7 @@
 ngx_uint_t  ngx_pagesize;
 ngx_uint_t  ngx_pagesize_shift;
 ngx_uint_t  ngx_cacheline_size;
+ngx_uint_t  ngx_hugepage_size;
 
 
 void *ngx_alloc(size_t size, ngx_log_t *log)
@@ -22,6 +22,7 @@ void *ngx_calloc(size_t size, ngx_log_t *log);
 extern ngx_uint_t  ngx_pagesize;
 extern ngx_uint_t  ngx_pagesize_shift;
 extern ngx_uint_t  ngx_cacheline_size;
+extern ngx_uint_t  ngx_hugepage_size;
 
 
 #endif /* _NGX_ALLOC_H_INCLUDED_ */
@@ -20,6 +20,8 @@ typedef struct {
     HANDLE       handle;
     ngx_log_t   *log;
     ngx_uint_t   exists;   /* unsigned  exists:1;  */
+    size_t       hugepages;
+    ngx_uint_t   interleave;  /* unsigned  interleave:1; */
 } ngx_shm_t;
 
 
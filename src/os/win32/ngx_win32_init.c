@@ -28,7 +28,8 @@ ngx_os_io_t ngx_os_io = {
     NULL,
     NULL,
     ngx_wsasend_chain,
-    0
+    0,
+    NULL
 };
 
 
@@ -780,7 +780,7 @@ ngx_stream_server_names(ngx_conf_t *cf, ngx_stream_core_main_conf_t *cmcf,
     hash.max_size = cmcf->server_names_hash_max_size;
     hash.bucket_size = cmcf->server_names_hash_bucket_size;
     hash.name = "server_names_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
 
     if (ha.keys.nelts) {
         hash.hash = &addr->hash;
@@ -1045,6 +1045,14 @@ ngx_stream_add_listening(ngx_conf_t *cf, ngx_stream_conf_addr_t *addr)
     ls->reuseport = addr->opt.reuseport;
 #endif
 
+#if (NGX_HAVE_REUSEPORT_EBPF)
+    ls->reuseport_cpu = addr->opt.reuseport_cpu;
+#endif
+
+#if (NGX_HAVE_UDP_GRO)
+    ls->udp_gro = addr->opt.udp_gro;
+#endif
+
     ls->wildcard = addr->opt.wildcard;
 
     return ls;
@@ -55,8 +55,10 @@ typedef struct {
 #endif
     unsigned                       deferred_accept:1;
     unsigned                       reuseport:1;
+    unsigned                       reuseport_cpu:1;
     unsigned                       so_keepalive:2;
     unsigned                       proxy_protocol:1;
+    unsigned                       udp_gro:1;
 
     int                            backlog;
     int                            rcvbuf;
@@ -344,7 +346,8 @@ typedef struct {
         NULL)
 
 
-#define NGX_STREAM_WRITE_BUFFERED  0x10
+#define NGX_STREAM_WRITE_BUFFERED   0x10
+#define NGX_STREAM_SPLICE_BUFFERED  0x20
 
 
 ngx_int_t ngx_stream_add_listen(ngx_conf_t *cf,
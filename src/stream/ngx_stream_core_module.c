@@ -1101,6 +1101,33 @@ ngx_stream_core_listen(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
             continue;
         }
 
+        if (ngx_strcmp(value[i].data, "reuseport=cpu") == 0) {
+#if (NGX_HAVE_REUSEPORT_EBPF)
+            lsopt.reuseport = 1;
+            lsopt.reuseport_cpu = 1;
+            lsopt.set = 1;
+            lsopt.bind = 1;
+#else
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "reuseport=cpu is not supported "
+                               "on this platform, ignored");
+#endif
+            continue;
+        }
+
+        if (ngx_strcmp(value[i].data, "udp_gro") == 0) {
+#if (NGX_HAVE_UDP_GRO)
+            lsopt.udp_gro = 1;
+            lsopt.set = 1;
+            lsopt.bind = 1;
+#else
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0,
+                               "udp_gro is not supported "
+                               "on this platform, ignored");
+#endif
+            continue;
+        }
+
         if (ngx_strcmp(value[i].data, "ssl") == 0) {
 #if (NGX_STREAM_SSL)
             lsopt.ssl = 1;
@@ -1250,6 +1277,9 @@ ngx_stream_core_listen(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
         if (lsopt.proxy_protocol) {
             return "\"proxy_protocol\" parameter is incompatible with \"udp\"";
         }
+
+    } else if (lsopt.udp_gro) {
+        return "\"udp_gro\" parameter requires \"udp\"";
     }
 
     for (n = 0; n < u.naddrs; n++) {
@@ -32,6 +32,7 @@ typedef struct {
     ngx_flag_t                       next_upstream;
     ngx_flag_t                       proxy_protocol;
     ngx_flag_t                       half_close;
+    ngx_flag_t                       splice;
     ngx_stream_upstream_local_t     *local;
     ngx_flag_t                       socket_keepalive;
 
@@ -76,6 +77,11 @@ static void ngx_stream_proxy_connect_handler(ngx_event_t *ev);
 static ngx_int_t ngx_stream_proxy_test_connect(ngx_connection_t *c);
 static void ngx_stream_proxy_process(ngx_stream_session_t *s,
     ngx_uint_t from_upstream, ngx_uint_t do_write);
+#if (NGX_HAVE_SPLICE)
+static ngx_int_t ngx_stream_proxy_splice(ngx_stream_session_t *s,
+    ngx_uint_t from_upstream);
+static void ngx_stream_proxy_close_pipe(void *data);
+#endif
 static ngx_int_t ngx_stream_proxy_test_finalize(ngx_stream_session_t *s,
     ngx_uint_t from_upstream);
 static void ngx_stream_proxy_next_upstream(ngx_stream_session_t *s);
@@ -255,6 +261,13 @@ static ngx_command_t  ngx_stream_proxy_commands[] = {
       offsetof(ngx_stream_proxy_srv_conf_t, half_close),
       NULL },
 
+    { ngx_string("proxy_splice"),
+      NGX_STREAM_MAIN_CONF|NGX_STREAM_SRV_CONF|NGX_CONF_FLAG,
+      ngx_conf_set_flag_slot,
+      NGX_STREAM_SRV_CONF_OFFSET,
+      offsetof(ngx_stream_proxy_srv_conf_t, splice),
+      NULL },
+
 #if (NGX_STREAM_SSL)
 
     { ngx_string("proxy_ssl"),
@@ -924,6 +937,25 @@ ngx_stream_proxy_init_upstream(ngx_stream_session_t *s)
     u->upload_rate = ngx_stream_complex_value_size(s, pscf->upload_rate, 0);
     u->download_rate = ngx_stream_complex_value_size(s, pscf->download_rate, 0);
 
+#if (NGX_HAVE_SPLICE)
+
+    /* splice() is not used if the data are to be encrypted or rate limited */
+
+    if (pscf->splice
+        && pc->type == SOCK_STREAM
+        && u->upload_rate == 0
+        && u->download_rate == 0
+#if (NGX_SSL)
+        && c->ssl == NULL
+        && pc->ssl == NULL
+#endif
+       )
+    {
+        u->splice = 1;
+    }
+
+#endif
+
     u->connected = 1;
 
     pc->read->handler = ngx_stream_proxy_upstream_handler;
@@ -1651,6 +1683,19 @@ ngx_stream_proxy_process(ngx_stream_session_t *s, ngx_uint_t from_upstream,
 
     for ( ;; ) {
 
+#if (NGX_HAVE_SPLICE)
+
+        if (u->splice && dst && *out == NULL && *busy == NULL) {
+
+            if (ngx_stream_proxy_splice(s, from_upstream) != NGX_OK) {
+                return;
+            }
+
+            break;
+        }
+
+#endif
+
         if (do_write && dst) {
 
             if (*out || *busy || dst->buffered) {
@@ -1801,6 +1846,208 @@ ngx_stream_proxy_process(ngx_stream_session_t *s, ngx_uint_t from_upstream,
 }
 
 
+#if (NGX_HAVE_SPLICE)
+
+static ngx_int_t
+ngx_stream_proxy_splice(ngx_stream_session_t *s, ngx_uint_t from_upstream)
+{
+    int                           size;
+    char                         *recv_action, *send_action;
+    off_t                        *received;
+    ssize_t                       n;
+    ngx_err_t                     err;
+    ngx_uint_t                   *packets;
+    ngx_connection_t             *c, *src, *dst;
+    ngx_pool_cleanup_t           *cln;
+    ngx_stream_upstream_t        *u;
+    ngx_stream_upstream_pipe_t   *p, **pp;
+    ngx_stream_proxy_srv_conf_t  *pscf;
+
+    u = s->upstream;
+    c = s->connection;
+
+    if (from_upstream) {
+        src = u->peer.connection;
+        dst = c;
+        pp = &u->upstream_pipe;
+        received = &u->received;
+        packets = &u->responses;
+        recv_action = "proxying and reading from upstream";
+        send_action = "proxying and sending to client";
+
+    } else {
+        src = c;
+        dst = u->peer.connection;
+        pp = &u->downstream_pipe;
+        received = &s->received;
+        packets = &u->requests;
+        recv_action = "proxying and reading from client";
+        send_action = "proxying and sending to upstream";
+    }
+
+    p = *pp;
+
+    if (p == NULL) {
+        cln = ngx_pool_cleanup_add(c->pool, sizeof(ngx_stream_upstream_pipe_t));
+        if (cln == NULL) {
+            ngx_stream_proxy_finalize(s, NGX_STREAM_INTERNAL_SERVER_ERROR);
+            return NGX_ERROR;
+        }
+
+        p = cln->data;
+
+        if (pipe(p->fd) == -1) {
+            ngx_log_error(NGX_LOG_ALERT, c->log, ngx_errno, "pipe() failed");
+            ngx_stream_proxy_finalize(s, NGX_STREAM_INTERNAL_SERVER_ERROR);
+            return NGX_ERROR;
+        }
+
+        cln->handler = ngx_stream_proxy_close_pipe;
+
+        if (ngx_nonblocking(p->fd[0]) == -1
+            || ngx_nonblocking(p->fd[1]) == -1)
+        {
+            ngx_log_error(NGX_LOG_ALERT, c->log, ngx_errno,
+                          ngx_nonblocking_n " failed");
+            ngx_stream_proxy_finalize(s, NGX_STREAM_INTERNAL_SERVER_ERROR);
+            return NGX_ERROR;
+        }
+
+        pscf = ngx_stream_get_module_srv_conf(s, ngx_stream_proxy_module);
+
+        /* the pipe capacity is rounded up to a power of two pages */
+
+        size = pscf->buffer_size;
+
+        if (fcntl(p->fd[1], F_SETPIPE_SZ, size) == -1) {
+            ngx_log_debug0(NGX_LOG_DEBUG_STREAM, c->log, ngx_errno,
+                           "fcntl(F_SETPIPE_SZ) failed");
+        }
+
+        p->size = 0;
+
+        *pp = p;
+    }
+
+    for ( ;; ) {
+
+        if (p->size && dst->write->ready) {
+            c->log->action = send_action;
+
+            n = splice(p->fd[0], NULL, dst->fd, NULL, p->size,
+                       SPLICE_F_MOVE|SPLICE_F_NONBLOCK);
+
+            ngx_log_debug3(NGX_LOG_DEBUG_STREAM, c->log, 0,
+                           "splice to %d: %z of %uz", dst->fd, n, p->size);
+
+            if (n == -1) {
+                err = ngx_socket_errno;
+
+                if (err == NGX_EINTR) {
+                    continue;
+                }
+
+                if (err != NGX_EAGAIN) {
+                    dst->write->error = 1;
+                    ngx_connection_error(dst, err, "splice() failed");
+                    ngx_stream_proxy_finalize(s, NGX_STREAM_OK);
+                    return NGX_ERROR;
+                }
+
+                dst->write->ready = 0;
+
+            } else {
+                p->size -= n;
+                dst->sent += n;
+                continue;
+            }
+        }
+
+        /*
+         * the pipe is filled only when it is empty: otherwise EAGAIN
+         * cannot be told apart from a full pipe
+         */
+
+        if (p->size == 0 && src->read->ready && !src->read->eof) {
+            c->log->action = recv_action;
+
+            n = splice(src->fd, NULL, p->fd[1], NULL,
+                       NGX_MAX_INT32_VALUE, SPLICE_F_MOVE|SPLICE_F_NONBLOCK);
+
+            ngx_log_debug2(NGX_LOG_DEBUG_STREAM, c->log, 0,
+                           "splice from %d: %z", src->fd, n);
+
+            if (n == -1) {
+                err = ngx_socket_errno;
+
+                if (err == NGX_EINTR) {
+                    continue;
+                }
+
+                src->read->ready = 0;
+
+                if (err != NGX_EAGAIN) {
+                    src->read->error = 1;
+                    src->read->eof = 1;
+                    ngx_connection_error(src, err, "splice() failed");
+                }
+
+                break;
+            }
+
+            if (n == 0) {
+                src->read->ready = 0;
+                src->read->eof = 1;
+                break;
+            }
+
+            if (from_upstream) {
+                if (u->state->first_byte_time == (ngx_msec_t) -1) {
+                    u->state->first_byte_time = ngx_current_msec
+                                                - u->start_time;
+                }
+            }
+
+            (*packets)++;
+            *received += n;
+            p->size = n;
+
+            continue;
+        }
+
+        break;
+    }
+
+    if (p->size) {
+        dst->buffered |= NGX_STREAM_SPLICE_BUFFERED;
+
+    } else {
+        dst->buffered &= ~NGX_STREAM_SPLICE_BUFFERED;
+    }
+
+    return NGX_OK;
+}
+
+
+static void
+ngx_stream_proxy_close_pipe(void *data)
+{
+    ngx_stream_upstream_pipe_t  *p = data;
+
+    if (close(p->fd[0]) == -1) {
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                      "close() pipe read end failed");
+    }
+
+    if (close(p->fd[1]) == -1) {
+        ngx_log_error(NGX_LOG_ALERT, ngx_cycle->log, ngx_errno,
+                      "close() pipe write end failed");
+    }
+}
+
+#endif
+
+
 static ngx_int_t
 ngx_stream_proxy_test_finalize(ngx_stream_session_t *s,
     ngx_uint_t from_upstream)
@@ -2091,6 +2338,7 @@ ngx_stream_proxy_create_srv_conf(ngx_conf_t *cf)
     conf->local = NGX_CONF_UNSET_PTR;
     conf->socket_keepalive = NGX_CONF_UNSET;
     conf->half_close = NGX_CONF_UNSET;
+    conf->splice = NGX_CONF_UNSET;
 
 #if (NGX_STREAM_SSL)
     conf->ssl_enable = NGX_CONF_UNSET;
@@ -2151,6 +2399,8 @@ ngx_stream_proxy_merge_srv_conf(ngx_conf_t *cf, void *parent, void *child)
 
     ngx_conf_merge_value(conf->half_close, prev->half_close, 0);
 
+    ngx_conf_merge_value(conf->splice, prev->splice, 0);
+
 #if (NGX_STREAM_SSL)
 
     if (ngx_stream_proxy_merge_ssl(cf, conf, prev) != NGX_OK) {
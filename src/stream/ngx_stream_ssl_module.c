@@ -178,7 +178,7 @@ static ngx_command_t  ngx_stream_ssl_commands[] = {
       NULL },
 
     { ngx_string("ssl_session_cache"),
-      NGX_STREAM_MAIN_CONF|NGX_STREAM_SRV_CONF|NGX_CONF_TAKE12,
+      NGX_STREAM_MAIN_CONF|NGX_STREAM_SRV_CONF|NGX_CONF_TAKE123,
       ngx_stream_ssl_session_cache,
       NGX_STREAM_SRV_CONF_OFFSET,
       0,
@@ -1125,14 +1125,30 @@ ngx_stream_ssl_session_cache(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
     ngx_stream_ssl_srv_conf_t  *sscf = conf;
 
     size_t       len;
+    ssize_t      hugepages;
     ngx_str_t   *value, name, size;
     ngx_int_t    n;
     ngx_uint_t   i, j;
 
     value = cf->args->elts;
 
+    hugepages = NGX_CONF_UNSET;
+
     for (i = 1; i < cf->args->nelts; i++) {
 
+        if (ngx_strncmp(value[i].data, "hugepages=", 10) == 0) {
+
+            size.len = value[i].len - 10;
+            size.data = value[i].data + 10;
+
+            hugepages = ngx_parse_hugepages(&size);
+            if (hugepages == NGX_ERROR) {
+                goto invalid;
+            }
+
+            continue;
+        }
+
         if (ngx_strcmp(value[i].data, "off") == 0) {
             sscf->builtin_session_cache = NGX_SSL_NO_SCACHE;
             continue;
@@ -1216,6 +1232,10 @@ ngx_stream_ssl_session_cache(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
         goto invalid;
     }
 
+    if (sscf->shm_zone && hugepages != NGX_CONF_UNSET) {
+        sscf->shm_zone->shm.hugepages = hugepages;
+    }
+
     if (sscf->shm_zone && sscf->builtin_session_cache == NGX_CONF_UNSET) {
         sscf->builtin_session_cache = NGX_SSL_NO_BUILTIN_SCACHE;
     }
@@ -114,6 +114,16 @@ typedef struct {
 } ngx_stream_upstream_resolved_t;
 
 
+#if (NGX_HAVE_SPLICE)
+
+typedef struct {
+    ngx_fd_t                           fd[2];
+    size_t                             size;
+} ngx_stream_upstream_pipe_t;
+
+#endif
+
+
 typedef struct {
     ngx_peer_connection_t              peer;
 
@@ -126,6 +136,11 @@ typedef struct {
     ngx_chain_t                       *downstream_out;
     ngx_chain_t                       *downstream_busy;
 
+#if (NGX_HAVE_SPLICE)
+    ngx_stream_upstream_pipe_t        *downstream_pipe;
+    ngx_stream_upstream_pipe_t        *upstream_pipe;
+#endif
+
     off_t                              received;
     time_t                             start_sec;
     ngx_uint_t                         requests;
@@ -143,6 +158,7 @@ typedef struct {
     unsigned                           connected:1;
     unsigned                           proxy_protocol:1;
     unsigned                           half_closed:1;
+    unsigned                           splice:1;
 } ngx_stream_upstream_t;
 
 
@@ -1004,28 +1004,17 @@ ngx_stream_map_find(ngx_stream_session_t *s, ngx_stream_map_t *map,
 #if (NGX_PCRE)
 
     if (len && map->nregex) {
-        ngx_int_t                n;
-        ngx_uint_t               i;
-        ngx_stream_map_regex_t  *reg;
+        ngx_int_t  n;
 
-        reg = map->regex;
+        n = ngx_stream_regex_set_exec(s, map->regex_set, match);
 
-        for (i = 0; i < map->nregex; i++) {
-
-            n = ngx_stream_regex_exec(s, reg[i].regex, match);
-
-            if (n == NGX_OK) {
-                return reg[i].value;
-            }
-
-            if (n == NGX_DECLINED) {
-                continue;
-            }
+        if (n >= 0) {
+            return map->regex[n].value;
+        }
 
-            /* NGX_ERROR */
+        /* NGX_DECLINED, NGX_ERROR */
 
-            return NULL;
-        }
+        return NULL;
     }
 
 #endif
@@ -1072,6 +1061,7 @@ ngx_stream_regex_compile(ngx_conf_t *cf, ngx_regex_compile_t *rc)
     re->regex = rc->regex;
     re->ncaptures = rc->captures;
     re->name = rc->pattern;
+    re->options = rc->options;
 
     cmcf = ngx_stream_conf_get_module_main_conf(cf, ngx_stream_core_module);
     cmcf->ncaptures = ngx_max(cmcf->ncaptures, re->ncaptures);
@@ -1186,6 +1176,175 @@ ngx_stream_regex_exec(ngx_stream_session_t *s, ngx_stream_regex_t *re,
     return NGX_OK;
 }
 
+
+ngx_stream_regex_set_t *
+ngx_stream_regex_set_create(ngx_conf_t *cf, ngx_stream_regex_t **regex,
+    ngx_uint_t n)
+{
+    ngx_uint_t               i, j;
+    ngx_stream_regex_run_t  *run;
+    ngx_stream_regex_set_t  *set;
+#if (NGX_PCRE2)
+    u_char                   errstr[NGX_MAX_CONF_ERRSTR];
+    ngx_regex_compile_t      rc, *elts;
+#endif
+
+    set = ngx_palloc(cf->pool, sizeof(ngx_stream_regex_set_t));
+    if (set == NULL) {
+        return NULL;
+    }
+
+    set->runs = ngx_palloc(cf->pool, n * sizeof(ngx_stream_regex_run_t));
+    if (set->runs == NULL) {
+        return NULL;
+    }
+
+    set->regex = regex;
+    set->nruns = 0;
+
+#if (NGX_PCRE2)
+
+    elts = ngx_pcalloc(cf->temp_pool, n * sizeof(ngx_regex_compile_t));
+    if (elts == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < n; i++) {
+        elts[i].pattern = regex[i]->name;
+        elts[i].options = regex[i]->options;
+    }
+
+#endif
+
+    for (i = 0; i < n; i = j) {
+
+#if (NGX_PCRE2)
+
+        /*
+         * a run of anchored regexes is matched by a single combined regex,
+         * which only finds the first of them matching the subject
+         */
+
+        for (j = i;
+             j < n
+             && j - i < NGX_REGEX_COMBINE_MAX
+             && ngx_regex_combinable(&elts[j]);
+             j++)
+        {
+            /* void */
+        }
+
+        if (j - i > 1) {
+            ngx_memzero(&rc, sizeof(ngx_regex_compile_t));
+
+            rc.pool = cf->pool;
+            rc.err.len = NGX_MAX_CONF_ERRSTR;
+            rc.err.data = errstr;
+
+            if (ngx_regex_combine(&rc, &elts[i], j - i) == NGX_OK) {
+                run = &set->runs[set->nruns++];
+
+                run->regex = rc.regex;
+                run->first = i;
+                run->last = j;
+
+                continue;
+            }
+
+            ngx_conf_log_error(NGX_LOG_WARN, cf, 0,
+                               "%V, regexes will be matched one by one",
+                               &rc.err);
+        }
+
+        if (j == i) {
+            j = i + 1;
+        }
+
+#else
+
+        j = n;
+
+#endif
+
+        if (set->nruns && set->runs[set->nruns - 1].regex == NULL) {
+            set->runs[set->nruns - 1].last = j;
+            continue;
+        }
+
+        run = &set->runs[set->nruns++];
+
+        run->regex = NULL;
+        run->first = i;
+        run->last = j;
+    }
+
+    return set;
+}
+
+
+/*
+ * returns the index of the first regex in the set matching the subject,
+ * NGX_DECLINED if none of them matched, or NGX_ERROR
+ */
+
+ngx_int_t
+ngx_stream_regex_set_exec(ngx_stream_session_t *s, ngx_stream_regex_set_t *set,
+    ngx_str_t *str)
+{
+    ngx_int_t                rc;
+    ngx_uint_t               i, n;
+    ngx_stream_regex_run_t  *run;
+
+    for (n = 0; n < set->nruns; n++) {
+        run = &set->runs[n];
+
+        i = run->first;
+
+#if (NGX_PCRE2)
+
+        if (run->regex) {
+            rc = ngx_regex_exec_combined(run->regex, str);
+
+            if (rc == NGX_REGEX_NO_MATCHED) {
+                continue;
+            }
+
+            if (rc >= 0) {
+                i += rc;
+
+            } else {
+                ngx_log_debug2(NGX_LOG_DEBUG_STREAM, s->connection->log, 0,
+                               "stream regex set combined match failed: %i "
+                               "on \"%V\"", rc, str);
+            }
+        }
+
+#endif
+
+        /* captures and variables are set by the matched regex itself */
+
+        for ( /* void */ ; i < run->last; i++) {
+
+            ngx_log_debug1(NGX_LOG_DEBUG_STREAM, s->connection->log, 0,
+                           "stream regex test \"%V\"", &set->regex[i]->name);
+
+            rc = ngx_stream_regex_exec(s, set->regex[i], str);
+
+            if (rc == NGX_OK) {
+                return i;
+            }
+
+            if (rc == NGX_DECLINED) {
+                continue;
+            }
+
+            return NGX_ERROR;
+        }
+    }
+
+    return NGX_DECLINED;
+}
+
 #endif
 
 
@@ -1324,7 +1483,7 @@ ngx_stream_variables_init_vars(ngx_conf_t *cf)
     hash.max_size = cmcf->variables_hash_max_size;
     hash.bucket_size = cmcf->variables_hash_bucket_size;
     hash.name = "variables_hash";
-    hash.pool = cf->pool;
+    hash.pool = cf->cycle->arena;
     hash.temp_pool = NULL;
 
     if (ngx_hash_init(&hash, cmcf->variables_keys->keys.elts,
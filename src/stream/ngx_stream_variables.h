@@ -72,9 +72,24 @@ typedef struct {
     ngx_stream_regex_variable_t  *variables;
     ngx_uint_t                    nvariables;
     ngx_str_t                     name;
+    ngx_uint_t                    options;
 } ngx_stream_regex_t;
 
 
+typedef struct {
+    ngx_regex_t                  *regex;
+    ngx_uint_t                    first;
+    ngx_uint_t                    last;
+} ngx_stream_regex_run_t;
+
+
+typedef struct {
+    ngx_stream_regex_t          **regex;
+    ngx_stream_regex_run_t       *runs;
+    ngx_uint_t                    nruns;
+} ngx_stream_regex_set_t;
+
+
 typedef struct {
     ngx_stream_regex_t           *regex;
     void                         *value;
@@ -85,6 +100,10 @@ ngx_stream_regex_t *ngx_stream_regex_compile(ngx_conf_t *cf,
     ngx_regex_compile_t *rc);
 ngx_int_t ngx_stream_regex_exec(ngx_stream_session_t *s, ngx_stream_regex_t *re,
     ngx_str_t *str);
+ngx_stream_regex_set_t *ngx_stream_regex_set_create(ngx_conf_t *cf,
+    ngx_stream_regex_t **regex, ngx_uint_t n);
+ngx_int_t ngx_stream_regex_set_exec(ngx_stream_session_t *s,
+    ngx_stream_regex_set_t *set, ngx_str_t *str);
 
 #endif
 
@@ -94,6 +113,7 @@ typedef struct {
 #if (NGX_PCRE)
     ngx_stream_map_regex_t       *regex;
     ngx_uint_t                    nregex;
+    ngx_stream_regex_set_t       *regex_set;
 #endif
 } ngx_stream_map_t;
 